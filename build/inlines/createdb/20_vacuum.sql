@@ -0,0 +1,27 @@
+-- This Source Code Form is subject to the terms of the Mozilla Public
+-- License, v. 2.0.  If a copy of the MPL was not distributed with this
+-- file, You can obtain one at http://mozilla.org/MPL/2.0/.
+--
+-- Copyright 1997 - July 2008 CWI, August 2008 - 2017 MonetDB B.V.
+
+-- Vacuum a relational table should be done with care.
+-- For, the oid's are used in join-indices.
+
+-- Vacuum of tables may improve IO performance and disk footprint.
+-- The foreign key constraints should be dropped before
+-- and re-established after the cluster operation.
+
+create procedure shrink(sys string, tab string)
+	external name sql.shrink;
+
+create procedure reuse(sys string, tab string)
+	external name sql.reuse;
+
+create procedure vacuum(sys string, tab string)
+	external name sql.vacuum;
+
+-- Dictionary encoding rebuilds the string columns of a table such
+-- that equal strings are stored once, in sorted order, which lets
+-- selections, grouping, joins and sorting work on the string codes.
+create procedure dictencode(sys string, tab string)
+	external name sql.dictencode;
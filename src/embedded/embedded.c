@@ -29,6 +29,7 @@
 #include "sql_scenario.h"
 #include "opt_prelude.h"
 #include "rel_semantic.h"
+#include "sql_semantic.h"
 #include "sql_gencode.h"
 #include "sql_optimizer.h"
 #include "rel_exp.h"
@@ -51,14 +52,43 @@ FILE* embedded_stderr;
 MT_Lock embedded_lock MT_LOCK_INITIALIZER("embedded_lock");
 
 
-static void monetdb_destroy_column(monetdb_column* column);
+static void monetdb_destroy_column(monetdb_column* column, int flags);
+static void monetdb_destroy_column_values(monetdb_column* column, int flags);
+
+/* a result column converted with a particular set of fetch flags, views keep
+ * the result BAT fixed for as long as the conversion lives */
+typedef struct monetdb_converted_column {
+	monetdb_column *column;
+	int flags;
+	bat pinned;
+	struct monetdb_converted_column *next;
+} monetdb_converted_column;
+
+/* the column last handed out by monetdb_result_fetch_range, the next range
+ * of the same column is converted into its data array */
+typedef struct {
+	monetdb_column *column;
+	size_t capacity; /* bytes allocated for column->data */
+} monetdb_range_column;
 
 typedef struct {
 	monetdb_result res;
 	res_table *monetdb_resultset;
-	monetdb_column **converted_columns;
+	monetdb_converted_column **converted_columns;
+	monetdb_range_column *range_columns;
 } monetdb_result_internal;
 
+/* a data array that a conversion may reuse instead of allocating one */
+typedef struct {
+	void *data;
+	size_t capacity;
+} monetdb_column_buffer;
+
+typedef struct {
+	monetdb_statement res;
+	int id; /* of the prepared statement in the connection's query cache */
+} monetdb_statement_internal;
+
 monetdb_connection monetdb_connect(void) {
 	Client conn = NULL;
 	mvc *m;
@@ -189,6 +219,40 @@ int monetdb_is_initialized(void) {
 }
 
 
+/* a query starts with a fresh deadline; the interrupt flag is left
+ * alone, so that a cancel that came while the query was queued still
+ * aborts it */
+static void monetdb_query_begin(Client c) {
+	c->qryctx.deadline = c->qtimeout ? GDKwallclock() + c->qtimeout : 0;
+	GDKsetqryctx(&c->qryctx);
+}
+
+/* once the query is done, a cancel is for the next one */
+static char* monetdb_query_end(Client c, char* msg) {
+	c->qryctx.interrupted = 0;
+	c->qryctx.deadline = 0;
+	return msg;
+}
+
+/* hand the result table of the last statement over to the embedded result */
+static char* monetdb_result_from_mvc(mvc *m, monetdb_result_internal *res_internal) {
+	res_internal->res.ncols = m->results->nr_cols;
+	if (m->results->nr_cols > 0 && m->results->order) {
+		res_internal->res.nrows = BATcount(BATdescriptor(m->results->order));
+		BBPunfix(m->results->order);
+	}
+	res_internal->converted_columns = GDKzalloc(sizeof(monetdb_converted_column*) * res_internal->res.ncols);
+	res_internal->range_columns = GDKzalloc(sizeof(monetdb_range_column) * res_internal->res.ncols);
+	if (!res_internal->converted_columns || !res_internal->range_columns) {
+		return GDKstrdup("Malloc fail");
+	}
+	res_internal->monetdb_resultset = m->results;
+	res_internal->res.type = (char) m->results->query_type;
+	res_internal->res.id = (size_t) m->results->query_id;
+	m->results = NULL;
+	return MAL_SUCCEED;
+}
+
 static char* monetdb_query_internal(monetdb_connection conn, char* query, char execute, monetdb_result** result, long* affected_rows, long* prepare_id, char language) {
 	str res = MAL_SUCCEED;
 	int sres;
@@ -211,18 +275,19 @@ static char* monetdb_query_internal(monetdb_connection conn, char* query, char e
 	if (!MCvalid(c)) {
 		return GDKstrdup("Invalid connection");
 	}
+	monetdb_query_begin(c);
 
 	b = (backend *) c->sqlcontext;
 	m = b->mvc;
 
 	query_stream = buffer_rastream(&query_buf, qname);
 	if (!query_stream) {
-		return GDKstrdup( "WARNING: could not setup query stream.");
+		return monetdb_query_end(c, GDKstrdup( "WARNING: could not setup query stream."));
 	}
 
 	nq = GDKmalloc(query_len);
 	if (!nq) {
-		return GDKstrdup( "WARNING: could not setup query stream.");
+		return monetdb_query_end(c, GDKstrdup( "WARNING: could not setup query stream."));
 	}
 	sprintf(nq, "%s\n;", query);
 
@@ -233,7 +298,7 @@ static char* monetdb_query_internal(monetdb_connection conn, char* query, char e
 	c->fdin = bstream_create(query_stream, query_len);
 	if (!c->fdin) {
 		close_stream(query_stream);
-		return GDKstrdup( "WARNING: could not setup query stream.");
+		return monetdb_query_end(c, GDKstrdup( "WARNING: could not setup query stream."));
 	}
 	bstream_next(c->fdin);
 
@@ -276,22 +341,7 @@ static char* monetdb_query_internal(monetdb_connection conn, char* query, char e
 
 
 	if (result && m->results) {
-		res_internal->res.ncols = m->results->nr_cols;
-		if (m->results->nr_cols > 0 && m->results->order) {
-			res_internal->res.nrows = BATcount(BATdescriptor(m->results->order));
-			BBPunfix(m->results->order);
-		}
-		res_internal->monetdb_resultset = m->results;
-		res_internal->converted_columns = GDKzalloc(sizeof(monetdb_column*) * res_internal->res.ncols);
-		if (!res_internal->converted_columns) {
-			res = GDKstrdup("Malloc fail");
-			GDKfree(res_internal);
-			goto cleanup;
-		}
-		res_internal->res.type = (char) m->results->query_type;
-		res_internal->res.id = (size_t) m->results->query_id;
-		// tODO: check alloc
-		m->results = NULL;
+		res = monetdb_result_from_mvc(m, res_internal);
 	}
 
 cleanup:
@@ -300,16 +350,18 @@ cleanup:
 	MSresetInstructions(c->curprg->def, 1);
 	bstream_destroy(c->fdin);
 	c->fdin = NULL;
+	// prepared statements run later without a query stream
+	m->scanner.rs = NULL;
 
 	sres = SQLautocommit(c, m);
 	if (!sres && !res) {
-		return GDKstrdup("Cannot COMMIT/ROLLBACK without a valid transaction.");
+		return monetdb_query_end(c, GDKstrdup("Cannot COMMIT/ROLLBACK without a valid transaction."));
 	}
 	if (res != MAL_SUCCEED && res_internal != NULL) {
 		GDKfree(res_internal);
 		*result = NULL;
 	}
-	return res;
+	return monetdb_query_end(c, res);
 }
 
 
@@ -326,6 +378,248 @@ char* monetdb_query(monetdb_connection conn, char* query, char execute, monetdb_
 	return(monetdb_query_internal(conn, query, execute, result, affected_rows, prepare_id, 'S'));
 }
 
+/* Asynchronous queries are run by a pool of executor threads that are set up
+ * like the dataflow workers. A connection runs one query at a time, queries
+ * submitted on a busy connection are chained behind the last one and become
+ * runnable when their predecessor finishes. */
+typedef struct monetdb_async_query {
+	Client c;
+	char *query;
+	monetdb_query_callback callback;
+	void *userdata;
+	char *msg;
+	monetdb_result *result;
+	long affected_rows;
+	int done;
+	int detached; /* nobody waits for it, cleaned up by the executor */
+	MT_Sema finished;
+	struct monetdb_async_query *next_conn;   /* submitted after us on the same connection */
+	struct monetdb_async_query *next_run;    /* in the runnable queue */
+	struct monetdb_async_query *next_active; /* in the list of busy connections */
+} monetdb_async_query;
+
+static struct {
+	MT_Lock lock;
+	MT_Sema runnable_sema;
+	monetdb_async_query *runnable, *runnable_tail;
+	monetdb_async_query *active; /* the last submitted query of every busy connection */
+	MT_Id threads[THREADS];
+	int nthreads;
+	int exiting;
+} async_executor;
+
+static void monetdb_async_runnable(monetdb_async_query *aq) {
+	aq->next_run = NULL;
+	if (async_executor.runnable_tail) {
+		async_executor.runnable_tail->next_run = aq;
+	} else {
+		async_executor.runnable = aq;
+	}
+	async_executor.runnable_tail = aq;
+	MT_sema_up(&async_executor.runnable_sema);
+}
+
+static void monetdb_async_free(monetdb_async_query *aq) {
+	MT_sema_destroy(&aq->finished);
+	GDKfree(aq->query);
+	GDKfree(aq);
+}
+
+static void monetdb_async_worker(void *arg) {
+	Thread thr;
+	monetdb_async_query *aq, **p;
+	int detached;
+	(void) arg;
+
+	thr = THRnew("monetdb_async_worker");
+	GDKsetbuf(GDKmalloc(GDKMAXERRLEN)); /* where to leave errors */
+	if (GDKerrbuf)
+		GDKclrerr();
+	while (1) {
+		MT_sema_down(&async_executor.runnable_sema);
+		MT_lock_set(&async_executor.lock);
+		aq = async_executor.runnable;
+		if (!aq) {
+			/* woken up without work only to exit */
+			assert(async_executor.exiting);
+			MT_lock_unset(&async_executor.lock);
+			break;
+		}
+		async_executor.runnable = aq->next_run;
+		if (!async_executor.runnable) {
+			async_executor.runnable_tail = NULL;
+		}
+		MT_lock_unset(&async_executor.lock);
+
+		aq->affected_rows = -1;
+		aq->msg = monetdb_query_internal(aq->c, aq->query, 1, &aq->result, &aq->affected_rows, NULL, 'S');
+		if (aq->callback) {
+			aq->callback(aq->c, aq->userdata, aq->msg, aq->result, aq->affected_rows);
+		}
+
+		MT_lock_set(&async_executor.lock);
+		if (aq->next_conn) {
+			monetdb_async_runnable(aq->next_conn);
+		} else {
+			for (p = &async_executor.active; *p != aq; p = &(*p)->next_active)
+				;
+			*p = aq->next_active;
+		}
+		aq->done = 1;
+		detached = aq->detached;
+		MT_lock_unset(&async_executor.lock);
+		if (detached) {
+			monetdb_async_free(aq);
+		} else {
+			MT_sema_up(&aq->finished);
+		}
+	}
+	GDKfree(GDKerrbuf);
+	GDKsetbuf(0);
+	THRdel(thr);
+}
+
+/* start the executor on first use, with one thread per core */
+static char* monetdb_async_start(void) {
+	char *res = MAL_SUCCEED;
+	int i, limit = GDKnr_threads > 0 ? GDKnr_threads : 1;
+
+	MT_lock_set(&embedded_lock);
+	if (async_executor.nthreads == 0) {
+		MT_lock_init(&async_executor.lock, "async_executor");
+		MT_sema_init(&async_executor.runnable_sema, 0, "async_executor");
+		async_executor.exiting = 0;
+		for (i = 0; i < limit && i < THREADS; i++) {
+			if (MT_create_thread(&async_executor.threads[i], monetdb_async_worker, NULL, MT_THR_JOINABLE) < 0)
+				break;
+			async_executor.nthreads++;
+		}
+		if (async_executor.nthreads == 0) {
+			MT_lock_destroy(&async_executor.lock);
+			MT_sema_destroy(&async_executor.runnable_sema);
+			res = GDKstrdup("Could not start query executor");
+		}
+	}
+	MT_lock_unset(&embedded_lock);
+	return res;
+}
+
+/* let the executor finish all submitted queries and wait for its threads */
+static void monetdb_async_stop(void) {
+	int i;
+
+	if (async_executor.nthreads == 0) {
+		return;
+	}
+	MT_lock_set(&async_executor.lock);
+	async_executor.exiting = 1;
+	MT_lock_unset(&async_executor.lock);
+	for (i = 0; i < async_executor.nthreads; i++) {
+		MT_sema_up(&async_executor.runnable_sema);
+	}
+	for (i = 0; i < async_executor.nthreads; i++) {
+		MT_join_thread(async_executor.threads[i]);
+	}
+	MT_lock_destroy(&async_executor.lock);
+	MT_sema_destroy(&async_executor.runnable_sema);
+	async_executor.nthreads = 0;
+}
+
+char* monetdb_query_async(monetdb_connection conn, char* query, monetdb_query_callback callback, void* userdata, monetdb_pending_query* pending) {
+	Client c = (Client) conn;
+	monetdb_async_query *aq, **p;
+	char *res;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	if (query == NULL || (callback == NULL && pending == NULL)) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if ((res = monetdb_async_start()) != MAL_SUCCEED) {
+		return res;
+	}
+	aq = GDKzalloc(sizeof(monetdb_async_query));
+	if (!aq || !(aq->query = GDKstrdup(query))) {
+		GDKfree(aq);
+		return GDKstrdup("Malloc fail");
+	}
+	aq->c = c;
+	aq->callback = callback;
+	aq->userdata = userdata;
+	aq->detached = pending == NULL;
+	MT_sema_init(&aq->finished, 0, "monetdb_query_async");
+
+	MT_lock_set(&async_executor.lock);
+	if (async_executor.exiting) {
+		MT_lock_unset(&async_executor.lock);
+		monetdb_async_free(aq);
+		return GDKstrdup("Embedded MonetDB is shutting down");
+	}
+	for (p = &async_executor.active; *p && (*p)->c != c; p = &(*p)->next_active)
+		;
+	if (*p) {
+		/* connection is busy, queue behind its last query */
+		(*p)->next_conn = aq;
+		aq->next_active = (*p)->next_active;
+		*p = aq;
+	} else {
+		aq->next_active = async_executor.active;
+		async_executor.active = aq;
+		monetdb_async_runnable(aq);
+	}
+	MT_lock_unset(&async_executor.lock);
+	if (pending) {
+		*pending = aq;
+	}
+	return MAL_SUCCEED;
+}
+
+int monetdb_query_poll(monetdb_pending_query pending) {
+	monetdb_async_query *aq = (monetdb_async_query *) pending;
+	int done;
+
+	MT_lock_set(&async_executor.lock);
+	done = aq->done;
+	MT_lock_unset(&async_executor.lock);
+	return done;
+}
+
+char* monetdb_query_wait(monetdb_pending_query pending, monetdb_result** result, long* affected_rows) {
+	monetdb_async_query *aq = (monetdb_async_query *) pending;
+	char *res;
+
+	MT_sema_down(&aq->finished);
+	res = aq->msg;
+	if (affected_rows) {
+		*affected_rows = aq->affected_rows;
+	}
+	if (result) {
+		*result = aq->result;
+	} else if (aq->result) {
+		monetdb_cleanup_result(aq->c, aq->result);
+	}
+	monetdb_async_free(aq);
+	return res;
+}
+
+/* append plans are kept in the connection's query cache, which is flushed
+ * on schema changes, and are found back by the id of their table */
+static cq* monetdb_append_plan(qc *cache, sql_table *t, int ncols) {
+	cq *q;
+
+	for (q = cache->q; q; q = q->next) {
+		if (q->key == t->base.id && !q->s && q->type == Q_UPDATE && q->paramlen == ncols) {
+			q->count++;
+			return q;
+		}
+	}
+	return NULL;
+}
+
 char* monetdb_append(monetdb_connection conn, const char* schema, const char* table, append_data *data, int ncols) {
 	Client c = (Client) conn;
 	mvc* m;
@@ -342,11 +636,12 @@ char* monetdb_append(monetdb_connection conn, const char* schema, const char* ta
 	if (!MCvalid(c)) {
 		return GDKstrdup("Invalid connection");
 	}
+	monetdb_query_begin(c);
 	if ((res = getSQLContext(c, NULL, &m, NULL)) != MAL_SUCCEED) {
-		return res;
+		return monetdb_query_end(c, res);
 	}
 	if (m->session->status < 0 && m->session->auto_commit == 0){
-		return GDKstrdup("Current transaction is aborted (please ROLLBACK)");
+		return monetdb_query_end(c, GDKstrdup("Current transaction is aborted (please ROLLBACK)"));
 	}
 
 	SQLtrans(m);
@@ -356,40 +651,745 @@ char* monetdb_append(monetdb_connection conn, const char* schema, const char* ta
 	{
 		sql_rel *rel;
 		node *n;
+		backend *be = (backend *) c->sqlcontext;
+		sql_subtype *lng_type = sql_bind_localtype("lng");
+		sql_schema *s = mvc_bind_schema(m, schema);
+		sql_table *t = mvc_bind_table(m, s, table);
+
+		if (!t) {
+			return monetdb_query_end(c, GDKstrdup("Can't find table."));
+		}
+		if (ncols != list_length(t->columns.set)) {
+			return monetdb_query_end(c, GDKstrdup("Incorrect number of columns."));
+		}
+		m->scanner.rs = NULL;
+		m->errstr[0] = '\0';
+		m->type = Q_UPDATE;
+		m->emode = m_normal;
+
+		// the BAT ids are the arguments of the (cached) append plan
+		sql_destroy_args(m);
+		for (i = 0; i < ncols; i++) {
+			sql_add_arg(m, atom_int(m->sa, lng_type, data[i].batid));
+		}
+		be->q = m->caching ? monetdb_append_plan(m->qc, t, ncols) : NULL;
+		if (!be->q) {
+			list *exps = sa_list(m->sa), *args = sa_list(m->sa), *types = sa_list(m->sa);
+			sql_subfunc *f = sql_find_func(m->sa, mvc_bind_schema(m, "sys"), "append", 1, F_UNION, NULL);
+
+			for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
+				sql_column *c = n->data;
+				append(args, m->caching ? exp_atom_ref(m->sa, i, lng_type) : exp_atom_lng(m->sa, data[i].batid));
+				append(exps, exp_column(m->sa, t->base.name, c->base.name, &c->type, CARD_MULTI, c->null, 0));
+				append(types, &c->type);
+			}
+
+			f->res = types;
+			rel = rel_insert(m, rel_basetable(m, t, t->base.name), rel_table_func(m->sa, NULL, exp_op(m->sa,  args, f), exps, 1));
+			if (!rel) {
+				sql_destroy_args(m);
+				return monetdb_query_end(c, GDKstrdup("Append plan generation failure"));
+			}
+			if (m->caching) {
+				char qname[IDLENGTH];
+				char *cmd = GDKstrdup("append");
+
+				(void) snprintf(qname, IDLENGTH, "s%d_%d", m->qc->id++, m->qc->clientid);
+				if (!cmd || !(be->q = qc_insert(m->qc, m->sa, rel, qname, NULL, m->args, m->argc, t->base.id, Q_UPDATE, cmd))) {
+					GDKfree(cmd);
+					sql_destroy_args(m);
+					return monetdb_query_end(c, GDKstrdup("Malloc fail"));
+				}
+				be->q->code = (backend_code) backend_dumpproc(be, c, be->q, rel);
+				be->q->stk = 0;
+				// passed over to the query cache
+				m->sa = NULL;
+				if (!be->q->code) {
+					qc_delete(m->qc, be->q);
+					be->q = NULL;
+					sql_destroy_args(m);
+					return monetdb_query_end(c, GDKstrdup("Append plan generation failure"));
+				}
+				be->q->name = putName(be->q->name);
+			} else {
+				sql_destroy_args(m);
+				if (backend_dumpstmt(be, c->curprg->def, rel, 1, 1, "append") < 0) {
+					return monetdb_query_end(c, GDKstrdup("Append plan generation failure"));
+				}
+			}
+		}
+		if (be->q) {
+			backend_call(be, c, be->q);
+			pushEndInstruction(c->curprg->def);
+			chkTypes(c->fdout, c->nspace, c->curprg->def, TRUE);
+		} else if ((res = SQLoptimizeQuery(c, c->curprg->def)) != MAL_SUCCEED) {
+			c->curprg->def->errors = 1;
+		}
+		if (res != MAL_SUCCEED || c->curprg->def->errors || (res = SQLengine(c)) != MAL_SUCCEED) {
+			// do not leave an auto-commit session behind in a failed transaction
+			MSresetInstructions(c->curprg->def, 1);
+			c->curprg->def->errors = 0;
+			if (be->q) {
+				qc_delete(m->qc, be->q);
+				be->q = NULL;
+			}
+			sql_destroy_args(m);
+			m->session->status = -1;
+			SQLautocommit(c, m);
+			return monetdb_query_end(c, res ? res : GDKstrdup("Append plan optimization failure"));
+		}
+	}
+	SQLautocommit(c, m);
+	return monetdb_query_end(c, NULL);
+}
+
+static date date_from_data(monetdb_data_date *ptr);
+static daytime time_from_data(monetdb_data_time *ptr);
+static timestamp timestamp_from_data(monetdb_data_timestamp *ptr);
+
+#define APPEND_IS_NULL(j) (null_mask && ((null_mask[(j) >> 3] >> ((j) & 7)) & 1))
+
+/* fixed-width input is borrowed from the caller when there is no null mask to apply */
+#define APPEND_FIXED(ctype, mtype)                                             \
+	{                                                                          \
+		ctype *src = (ctype *) column->data;                                   \
+		if (!null_mask) {                                                      \
+			b = BATwrap(localtype, column->data, column->count);               \
+			if (!b) {                                                          \
+				return GDKstrdup("Malloc failure!");                           \
+			}                                                                  \
+			for (j = 0; j < column->count && !has_nil; j++) {                  \
+				has_nil = src[j] == mtype##_nil;                               \
+			}                                                                  \
+		} else {                                                               \
+			ctype *dst;                                                        \
+			b = COLnew(0, localtype, column->count, TRANSIENT);                \
+			if (!b) {                                                          \
+				return GDKstrdup("Malloc failure!");                           \
+			}                                                                  \
+			dst = (ctype *) Tloc(b, 0);                                        \
+			for (j = 0; j < column->count; j++) {                              \
+				dst[j] = APPEND_IS_NULL(j) ? mtype##_nil : src[j];             \
+				has_nil |= dst[j] == mtype##_nil;                              \
+			}                                                                  \
+		}                                                                      \
+	}
+
+#define APPEND_CONVERTED(ctype, mtype, conv, isnil)                            \
+	{                                                                          \
+		ctype *src = (ctype *) column->data;                                   \
+		mtype *dst;                                                            \
+		b = COLnew(0, localtype, column->count, TRANSIENT);                    \
+		if (!b) {                                                              \
+			return GDKstrdup("Malloc failure!");                               \
+		}                                                                      \
+		dst = (mtype *) Tloc(b, 0);                                            \
+		for (j = 0; j < column->count; j++) {                                  \
+			if (APPEND_IS_NULL(j)) {                                           \
+				dst[j] = mtype##_nil;                                          \
+			} else {                                                           \
+				dst[j] = conv(src + j);                                        \
+			}                                                                  \
+			has_nil |= isnil(dst[j]);                                          \
+		}                                                                      \
+	}
+
+static int monetdb_input_type_ok(monetdb_types type, int localtype) {
+	switch (type) {
+	case monetdb_int8_t:
+		return localtype == TYPE_bte || localtype == TYPE_bit;
+	case monetdb_int16_t:
+		return localtype == TYPE_sht;
+	case monetdb_int32_t:
+		return localtype == TYPE_int;
+	case monetdb_int64_t:
+		return localtype == TYPE_lng;
+	case monetdb_size_t:
+		return localtype == TYPE_oid;
+	case monetdb_float:
+		return localtype == TYPE_flt;
+	case monetdb_double:
+		return localtype == TYPE_dbl;
+	case monetdb_str:
+		return localtype == TYPE_str;
+	case monetdb_blob:
+		return localtype == TYPE_blob || localtype == TYPE_sqlblob;
+	case monetdb_date:
+		return localtype == TYPE_date;
+	case monetdb_time:
+		return localtype == TYPE_daytime;
+	case monetdb_timestamp:
+		return localtype == TYPE_timestamp;
+	}
+	return 0;
+}
+
+/* wrap a C array in a transient BAT of the column's storage type */
+static char* monetdb_bat_from_column(monetdb_column *column, unsigned char *null_mask, sql_column *col, BAT **ret) {
+	int localtype = col->type.type->localtype;
+	int has_nil = 0;
+	BAT *b = NULL;
+	size_t j;
+
+	if (!monetdb_input_type_ok(column->type, localtype)) {
+		return createException(MAL, "embedded", "Type mismatch for column %s", col->base.name);
+	}
+	switch (column->type) {
+	case monetdb_int8_t:
+		APPEND_FIXED(int8_t, bte);
+		break;
+	case monetdb_int16_t:
+		APPEND_FIXED(int16_t, sht);
+		break;
+	case monetdb_int32_t:
+		APPEND_FIXED(int32_t, int);
+		break;
+	case monetdb_int64_t:
+		APPEND_FIXED(int64_t, lng);
+		break;
+	case monetdb_size_t:
+		APPEND_FIXED(size_t, oid);
+		break;
+	case monetdb_float:
+		APPEND_FIXED(float, flt);
+		break;
+	case monetdb_double:
+		APPEND_FIXED(double, dbl);
+		break;
+	case monetdb_date:
+		APPEND_CONVERTED(monetdb_data_date, date, date_from_data, date_isnil);
+		break;
+	case monetdb_time:
+		APPEND_CONVERTED(monetdb_data_time, daytime, time_from_data, daytime_isnil);
+		break;
+	case monetdb_timestamp: {
+		monetdb_data_timestamp *src = (monetdb_data_timestamp *) column->data;
+		timestamp *dst;
+		b = COLnew(0, localtype, column->count, TRANSIENT);
+		if (!b) {
+			return GDKstrdup("Malloc failure!");
+		}
+		dst = (timestamp *) Tloc(b, 0);
+		for (j = 0; j < column->count; j++) {
+			dst[j] = APPEND_IS_NULL(j) ? *timestamp_nil : timestamp_from_data(src + j);
+			has_nil |= ts_isnil(dst[j]);
+		}
+		break;
+	}
+	case monetdb_str: {
+		char **src = (char **) column->data;
+		b = COLnew(0, localtype, column->count, TRANSIENT);
+		if (!b) {
+			return GDKstrdup("Malloc failure!");
+		}
+		for (j = 0; j < column->count; j++) {
+			const char *v = APPEND_IS_NULL(j) || !src[j] ? str_nil : src[j];
+			has_nil |= v == str_nil;
+			if (BUNappend(b, v, FALSE) != GDK_SUCCEED) {
+				BBPreclaim(b);
+				return GDKstrdup("Malloc failure!");
+			}
+		}
+		break;
+	}
+	case monetdb_blob: {
+		monetdb_data_blob *src = (monetdb_data_blob *) column->data;
+		size_t bufsize = sizeof(blob);
+		blob *buf = GDKmalloc(bufsize);
+		b = COLnew(0, localtype, column->count, TRANSIENT);
+		if (!b || !buf) {
+			GDKfree(buf);
+			BBPreclaim(b);
+			return GDKstrdup("Malloc failure!");
+		}
+		for (j = 0; j < column->count; j++) {
+			if (APPEND_IS_NULL(j) || !src[j].data) {
+				buf->nitems = ~(size_t) 0;
+				has_nil = 1;
+			} else {
+				if (offsetof(blob, data) + src[j].size > bufsize) {
+					blob *nbuf;
+					bufsize = offsetof(blob, data) + src[j].size;
+					nbuf = GDKrealloc(buf, bufsize);
+					if (!nbuf) {
+						GDKfree(buf);
+						BBPreclaim(b);
+						return GDKstrdup("Malloc failure!");
+					}
+					buf = nbuf;
+				}
+				buf->nitems = src[j].size;
+				memcpy(buf->data, src[j].data, src[j].size);
+			}
+			if (BUNappend(b, buf, FALSE) != GDK_SUCCEED) {
+				GDKfree(buf);
+				BBPreclaim(b);
+				return GDKstrdup("Malloc failure!");
+			}
+		}
+		GDKfree(buf);
+		break;
+	}
+	}
+	BATsetcount(b, column->count);
+	b->tsorted = b->trevsorted = 0;
+	b->tkey = 0;
+	BATsettrivprop(b);
+	b->tnil = has_nil;
+	b->tnonil = !has_nil;
+	*ret = b;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_append_columns(monetdb_connection conn, const char* schema, const char* table, monetdb_column *columns, unsigned char **null_masks, int ncols) {
+	Client c = (Client) conn;
+	mvc* m;
+	sql_schema *s;
+	sql_table *t;
+	BAT **bats = NULL;
+	node *n;
+	int i, direct = 0;
+	str res = MAL_SUCCEED;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if(table == NULL || columns == NULL || ncols < 1) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	monetdb_query_begin(c);
+	for (i = 1; i < ncols; i++) {
+		if (columns[i].count != columns[0].count) {
+			return monetdb_query_end(c, GDKstrdup("Columns have different lengths."));
+		}
+	}
+	if ((res = getSQLContext(c, NULL, &m, NULL)) != MAL_SUCCEED) {
+		return monetdb_query_end(c, res);
+	}
+	if (m->session->status < 0 && m->session->auto_commit == 0){
+		return monetdb_query_end(c, GDKstrdup("Current transaction is aborted (please ROLLBACK)"));
+	}
+
+	SQLtrans(m);
+	s = mvc_bind_schema(m, schema);
+	t = s ? mvc_bind_table(m, s, table) : NULL;
+	if (!t) {
+		return monetdb_query_end(c, GDKstrdup("Can't find table."));
+	}
+	if (ncols != list_length(t->columns.set)) {
+		return monetdb_query_end(c, GDKstrdup("Incorrect number of columns."));
+	}
+	if (t->access == TABLE_READONLY) {
+		return monetdb_query_end(c, GDKstrdup("Table is read only."));
+	}
+	if (columns[0].count == 0) {
+		return monetdb_query_end(c, MAL_SUCCEED);
+	}
+	bats = GDKzalloc(sizeof(BAT*) * ncols);
+	if (!bats) {
+		return monetdb_query_end(c, GDKstrdup("Malloc failure!"));
+	}
+	for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
+		sql_column *col = n->data;
+		if ((res = monetdb_bat_from_column(&columns[i], null_masks ? null_masks[i] : NULL, col, &bats[i])) != MAL_SUCCEED) {
+			goto cleanup;
+		}
+		if (!col->null && bats[i]->tnil) {
+			res = createException(SQL, "embedded", "NOT NULL constraint violated for column %s", col->base.name);
+			goto cleanup;
+		}
+	}
+
+	// keys, indices and triggers are only maintained by the SQL plan, plain tables are appended to directly
+	direct = isTable(t) && list_empty(t->keys.set) && list_empty(t->idxs.set) && list_empty(t->triggers.set);
+	if (direct) {
+		for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
+			if (store_funcs.append_col(m->session->tr, n->data, bats[i], TYPE_bat) != LOG_OK) {
+				m->session->status = -1;
+				res = GDKstrdup("Append failed");
+				break;
+			}
+		}
+		SQLautocommit(c, m);
+	} else {
+		append_data *data = GDKzalloc(sizeof(append_data) * ncols);
+		if (!data) {
+			res = GDKstrdup("Malloc failure!");
+			goto cleanup;
+		}
+		for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
+			data[i].colname = ((sql_column *) n->data)->base.name;
+			data[i].batid = bats[i]->batCacheid;
+		}
+		res = monetdb_append(conn, schema, table, data, ncols);
+		GDKfree(data);
+	}
+
+cleanup:
+	for (i = 0; i < ncols; i++) {
+		if (bats[i]) {
+			BBPreclaim(bats[i]);
+		}
+	}
+	GDKfree(bats);
+	return monetdb_query_end(c, res);
+}
+
+/* C type a prepared statement parameter is bound with, the inverse of monetdb_input_type_ok */
+static int monetdb_param_type(int localtype, monetdb_types *ret) {
+	if (localtype == TYPE_bte || localtype == TYPE_bit) {
+		*ret = monetdb_int8_t;
+	} else if (localtype == TYPE_sht) {
+		*ret = monetdb_int16_t;
+	} else if (localtype == TYPE_int) {
+		*ret = monetdb_int32_t;
+	} else if (localtype == TYPE_lng) {
+		*ret = monetdb_int64_t;
+	} else if (localtype == TYPE_oid) {
+		*ret = monetdb_size_t;
+	} else if (localtype == TYPE_flt) {
+		*ret = monetdb_float;
+	} else if (localtype == TYPE_dbl) {
+		*ret = monetdb_double;
+	} else if (localtype == TYPE_str) {
+		*ret = monetdb_str;
+	} else if (localtype == TYPE_blob || localtype == TYPE_sqlblob) {
+		*ret = monetdb_blob;
+	} else if (localtype == TYPE_date) {
+		*ret = monetdb_date;
+	} else if (localtype == TYPE_daytime) {
+		*ret = monetdb_time;
+	} else if (localtype == TYPE_timestamp) {
+		*ret = monetdb_timestamp;
+	} else {
+		return 0;
+	}
+	return 1;
+}
+
+static size_t monetdb_type_size(monetdb_types type) {
+	switch (type) {
+	case monetdb_int8_t:
+		return sizeof(int8_t);
+	case monetdb_int16_t:
+		return sizeof(int16_t);
+	case monetdb_int32_t:
+		return sizeof(int32_t);
+	case monetdb_int64_t:
+		return sizeof(int64_t);
+	case monetdb_size_t:
+		return sizeof(size_t);
+	case monetdb_float:
+		return sizeof(float);
+	case monetdb_double:
+		return sizeof(double);
+	case monetdb_str:
+		return sizeof(char *);
+	case monetdb_blob:
+		return sizeof(monetdb_data_blob);
+	case monetdb_date:
+		return sizeof(monetdb_data_date);
+	case monetdb_time:
+		return sizeof(monetdb_data_time);
+	case monetdb_timestamp:
+		return sizeof(monetdb_data_timestamp);
+	}
+	return 0;
+}
+
+char* monetdb_prepare(monetdb_connection conn, char* query, monetdb_statement** stmt) {
+	Client c = (Client) conn;
+	mvc *m;
+	cq *q;
+	monetdb_statement_internal *stmt_internal = NULL;
+	long prepare_id = -1;
+	char *prepare_query;
+	str res = MAL_SUCCEED;
+	int i;
+
+	if (query == NULL || stmt == NULL) {
+		return GDKstrdup("Invalid parameters");
+	}
+	prepare_query = GDKmalloc(strlen(query) + 9);
+	if (!prepare_query) {
+		return GDKstrdup("Malloc fail");
+	}
+	sprintf(prepare_query, "PREPARE %s", query);
+	res = monetdb_query_internal(conn, prepare_query, 1, NULL, NULL, &prepare_id, 'S');
+	GDKfree(prepare_query);
+	if (res != MAL_SUCCEED) {
+		return res;
+	}
+	m = ((backend *) c->sqlcontext)->mvc;
+	q = qc_find(m->qc, (int) prepare_id);
+	if (!q || q->type != Q_PREPARE) {
+		return GDKstrdup("Not a prepared statement");
+	}
+
+	stmt_internal = GDKzalloc(sizeof(monetdb_statement_internal));
+	if (!stmt_internal) {
+		res = GDKstrdup("Malloc fail");
+		goto cleanup;
+	}
+	stmt_internal->id = q->id;
+	stmt_internal->res.nparams = (size_t) q->paramlen;
+	if (q->paramlen > 0) {
+		stmt_internal->res.param_types = GDKmalloc(sizeof(monetdb_types) * q->paramlen);
+		if (!stmt_internal->res.param_types) {
+			res = GDKstrdup("Malloc fail");
+			goto cleanup;
+		}
+	}
+	for (i = 0; i < q->paramlen; i++) {
+		if (!monetdb_param_type(q->params[i].type->localtype, &stmt_internal->res.param_types[i])) {
+			res = createException(SQL, "embedded", "Unsupported type %s for parameter %d", q->params[i].type->sqlname, i + 1);
+			goto cleanup;
+		}
+	}
+	*stmt = &stmt_internal->res;
+	return MAL_SUCCEED;
+
+cleanup:
+	qc_delete(m->qc, q);
+	if (stmt_internal) {
+		GDKfree(stmt_internal->res.param_types);
+		GDKfree(stmt_internal);
+	}
+	return res;
+}
+
+/* bind the C value at ptr as the next argument of a prepared statement, the value is converted
+ * to its storage representation and copied, but never formatted and parsed */
+static char* monetdb_bind_param(mvc *m, sql_subtype *tpe, monetdb_types type, void *ptr, int isnull) {
+	int localtype = tpe->type->localtype;
+	const void *value = ptr;
+	blob *buf = NULL;
+	date d;
+	daytime t;
+	timestamp ts;
+	atom *a;
+
+	if (isnull || !ptr) {
+		value = ATOMnilptr(localtype);
+	} else {
+		switch (type) {
+		case monetdb_str:
+			value = *(char **) ptr ? *(char **) ptr : str_nil;
+			break;
+		case monetdb_blob: {
+			monetdb_data_blob *src = (monetdb_data_blob *) ptr;
+			if (!src->data) {
+				value = ATOMnilptr(localtype);
+				break;
+			}
+			buf = GDKmalloc(offsetof(blob, data) + src->size);
+			if (!buf) {
+				return GDKstrdup("Malloc fail");
+			}
+			buf->nitems = src->size;
+			memcpy(buf->data, src->data, src->size);
+			value = buf;
+			break;
+		}
+		case monetdb_date:
+			d = date_from_data((monetdb_data_date *) ptr);
+			value = &d;
+			break;
+		case monetdb_time:
+			t = time_from_data((monetdb_data_time *) ptr);
+			value = &t;
+			break;
+		case monetdb_timestamp:
+			ts = timestamp_from_data((monetdb_data_timestamp *) ptr);
+			value = &ts;
+			break;
+		default:
+			break;
+		}
+	}
+	a = atom_general_ptr(m->sa, tpe, value);
+	GDKfree(buf);
+	if (!a) {
+		return GDKstrdup("Malloc fail");
+	}
+	sql_add_arg(m, a);
+	return MAL_SUCCEED;
+}
+
+/* run the prepared statement q with the arguments bound in m->args, the call
+ * into the cached plan is generated directly instead of parsing an EXEC */
+static char* monetdb_execute_prepared(Client c, backend *be, cq *q) {
+	mvc *m = be->mvc;
+
+	m->type = Q_PARSE;
+	m->emode = m_normal;
+	m->errstr[0] = '\0';
+	be->q = q;
+	be->vtop = c->curprg->def->vtop;
+	backend_call(be, c, q);
+	pushEndInstruction(c->curprg->def);
+	chkTypes(c->fdout, c->nspace, c->curprg->def, TRUE);
+	if (c->curprg->def->errors) {
+		MSresetInstructions(c->curprg->def, 1);
+		c->curprg->def->errors = 0;
+		be->q = NULL;
+		return GDKstrdup("Prepared statement call generation failure");
+	}
+	return SQLengine(c);
+}
+
+/* find the prepared statement back, after starting a transaction as that may flush the query cache */
+static char* monetdb_statement_begin(Client c, monetdb_statement* stmt, mvc **ret, cq **q) {
+	mvc *m;
+	str res;
+	int id = ((monetdb_statement_internal *) stmt)->id;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	monetdb_query_begin(c);
+	if ((res = getSQLContext(c, NULL, &m, NULL)) != MAL_SUCCEED) {
+		return monetdb_query_end(c, res);
+	}
+	if (m->session->status < 0 && m->session->auto_commit == 0){
+		return monetdb_query_end(c, GDKstrdup("Current transaction is aborted (please ROLLBACK)"));
+	}
+	SQLtrans(m);
+	if (!m->sa) {
+		m->sa = sa_create();
+		if (!m->sa) {
+			return monetdb_query_end(c, GDKstrdup("Malloc fail"));
+		}
+	}
+	*q = qc_find(m->qc, id);
+	if (!*q || (*q)->type != Q_PREPARE) {
+		return monetdb_query_end(c, createException(SQL, "embedded", "Prepared statement %d is no longer valid after a schema change, prepare it again", id));
+	}
+	sql_destroy_args(m);
+	*ret = m;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_execute_bound(monetdb_connection conn, monetdb_statement* stmt, void** params, monetdb_result** result, long* affected_rows) {
+	Client c = (Client) conn;
+	backend *be;
+	mvc *m;
+	cq *q;
+	monetdb_result_internal *res_internal = NULL;
+	size_t i;
+	str res;
+
+	if (stmt == NULL || (stmt->nparams > 0 && params == NULL)) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if ((res = monetdb_statement_begin(c, stmt, &m, &q)) != MAL_SUCCEED) {
+		return res;
+	}
+	be = (backend *) c->sqlcontext;
+	for (i = 0; i < stmt->nparams; i++) {
+		if ((res = monetdb_bind_param(m, q->params + i, stmt->param_types[i], params[i], 0)) != MAL_SUCCEED) {
+			goto cleanup;
+		}
+	}
+	if (result) {
+		res_internal = GDKzalloc(sizeof(monetdb_result_internal));
+		if (!res_internal) {
+			res = GDKstrdup("Malloc fail");
+			goto cleanup;
+		}
+		m->reply_size = -2; /* do not clean up result tables */
+	}
+	if ((res = monetdb_execute_prepared(c, be, q)) != MAL_SUCCEED) {
+		goto cleanup;
+	}
+	if (!m->results && m->rowcnt >= 0 && affected_rows) {
+		*affected_rows = m->rowcnt;
+	}
+	if (result && m->results) {
+		res = monetdb_result_from_mvc(m, res_internal);
+	}
+
+cleanup:
+	sql_destroy_args(m);
+	if (res != MAL_SUCCEED) {
+		m->session->status = -1;
+	}
+	SQLautocommit(c, m);
+	if (res != MAL_SUCCEED) {
+		GDKfree(res_internal);
+		res_internal = NULL;
+	}
+	if (result) {
+		*result = (monetdb_result *) res_internal;
+	}
+	return monetdb_query_end(c, res);
+}
 
-		list *exps = sa_list(m->sa), *args = sa_list(m->sa), *types = sa_list(m->sa);
-		sql_schema *s = mvc_bind_schema(m, schema);
-		sql_table *t = mvc_bind_table(m, s, table);
-		sql_subfunc *f = sql_find_func(m->sa, mvc_bind_schema(m, "sys"), "append", 1, F_UNION, NULL);
+char* monetdb_execute_bound_array(monetdb_connection conn, monetdb_statement* stmt, void** params, unsigned char **null_masks, size_t nrows, long* affected_rows) {
+	Client c = (Client) conn;
+	backend *be;
+	mvc *m;
+	cq *q;
+	size_t i, j;
+	long rows = 0;
+	str res;
 
-		if (!t) {
-			return GDKstrdup("Can't find table.");
-		}
-		if (ncols != list_length(t->columns.set)) {
-			return GDKstrdup("Incorrect number of columns.");
+	if (stmt == NULL || (stmt->nparams > 0 && params == NULL)) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if ((res = monetdb_statement_begin(c, stmt, &m, &q)) != MAL_SUCCEED) {
+		return res;
+	}
+	be = (backend *) c->sqlcontext;
+	for (j = 0; j < nrows && res == MAL_SUCCEED; j++) {
+		for (i = 0; i < stmt->nparams && res == MAL_SUCCEED; i++) {
+			unsigned char *null_mask = null_masks ? null_masks[i] : NULL;
+			res = monetdb_bind_param(m, q->params + i, stmt->param_types[i],
+				(char *) params[i] + j * monetdb_type_size(stmt->param_types[i]), APPEND_IS_NULL(j));
 		}
-		for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
-			sql_column *c = n->data;
-			append(args, exp_atom_lng(m->sa, data[i].batid));
-			append(exps, exp_column(m->sa, t->base.name, c->base.name, &c->type, CARD_MULTI, c->null, 0));
-			append(types, &c->type);
+		if (res == MAL_SUCCEED && (res = monetdb_execute_prepared(c, be, q)) == MAL_SUCCEED) {
+			if (m->rowcnt > 0) {
+				rows += m->rowcnt;
+			}
+			// row results are not handed out
+			res_tables_destroy(m->results);
+			m->results = NULL;
 		}
+		sql_destroy_args(m);
+	}
+	if (res != MAL_SUCCEED) {
+		m->session->status = -1;
+	} else if (affected_rows) {
+		*affected_rows = rows;
+	}
+	SQLautocommit(c, m);
+	return monetdb_query_end(c, res);
+}
 
-		f->res = types;
-		rel = rel_insert(m, rel_basetable(m, t, t->base.name), rel_table_func(m->sa, NULL, exp_op(m->sa,  args, f), exps, 1));
-		m->scanner.rs = NULL;
-		m->errstr[0] = '\0';
+void monetdb_cleanup_statement(monetdb_connection conn, monetdb_statement* stmt) {
+	monetdb_statement_internal *stmt_internal = (monetdb_statement_internal *) stmt;
+	Client c = (Client) conn;
+	mvc *m;
+	cq *q;
 
-		if (rel && backend_dumpstmt((backend *) c->sqlcontext, c->curprg->def, rel, 1, 1, "append") < 0) {
-			return GDKstrdup("Append plan generation failure");
-		}
-		if ((res = SQLoptimizeQuery(c, c->curprg->def)) != MAL_SUCCEED ||
-				c->curprg->def->errors || (res = SQLengine(c)) != MAL_SUCCEED) {
-			return(res);
+	if (!stmt) {
+		return;
+	}
+	if (monetdb_is_initialized() && MCvalid(c)) {
+		m = ((backend *) c->sqlcontext)->mvc;
+		q = qc_find(m->qc, stmt_internal->id);
+		if (q && q->type == Q_PREPARE) {
+			qc_delete(m->qc, q);
 		}
 	}
-	SQLautocommit(c, m);
-	return NULL;
+	GDKfree(stmt->param_types);
+	GDKfree(stmt_internal);
 }
 
 void monetdb_cleanup_result(monetdb_connection conn, monetdb_result* result) {
@@ -410,10 +1410,25 @@ void monetdb_cleanup_result(monetdb_connection conn, monetdb_result* result) {
 	if (res->converted_columns) {
 		size_t i;
 		for (i = 0; i < res->res.ncols; i++) {
-			monetdb_destroy_column(res->converted_columns[i]);
+			monetdb_converted_column *cc = res->converted_columns[i];
+			while (cc) {
+				monetdb_converted_column *next = cc->next;
+				monetdb_destroy_column(cc->column, cc->flags);
+				if (cc->pinned)
+					BBPunfix(cc->pinned);
+				GDKfree(cc);
+				cc = next;
+			}
+		}
+	}
+	if (res->range_columns) {
+		size_t i;
+		for (i = 0; i < res->res.ncols; i++) {
+			monetdb_destroy_column(res->range_columns[i].column, monetdb_fetch_default);
 		}
 	}
 	GDKfree(res->converted_columns);
+	GDKfree(res->range_columns);
 	GDKfree(res);
 
 }
@@ -458,6 +1473,26 @@ str monetdb_get_columns(monetdb_connection conn, const char* schema_name, const
 }
 
 
+void monetdb_cancel(monetdb_connection conn) {
+	Client c = (Client) conn;
+	if (!MCvalid(c)) {
+		return;
+	}
+	c->qryctx.interrupted = 1;
+}
+
+char* monetdb_set_query_timeout(monetdb_connection conn, long timeout_ms) {
+	Client c = (Client) conn;
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	if (timeout_ms < 0) {
+		return GDKstrdup("Invalid timeout");
+	}
+	c->qtimeout = (lng) timeout_ms * 1000;
+	return MAL_SUCCEED;
+}
+
 void monetdb_register_progress(monetdb_connection conn, monetdb_progress_callback callback, void* data) {
 	Client c = (Client) conn;
 	if (!MCvalid(c)) {
@@ -486,6 +1521,7 @@ void monetdb_unregister_progress(monetdb_connection conn) {
 void monetdb_shutdown(void) {
 	MT_lock_set(&embedded_lock);
 	if (monetdb_embedded_initialized) {
+		monetdb_async_stop();
 		mserver_reset(0);
 		fclose(embedded_stdout);
 		monetdb_embedded_initialized = 0;
@@ -535,8 +1571,8 @@ GENERATE_BASE_HEADERS(monetdb_data_timestamp, timestamp);
 		GENERATE_BAT_INPUT_BASE(tpe);                                          \
 		bat_data->count = BATcount(b);                                         \
 		bat_data->null_value = mtype##_nil;                                    \
-		bat_data->data = GDKmalloc(                                            \
-			bat_data->count * sizeof(bat_data->null_value));                   \
+		bat_data->data = monetdb_column_data(buf,                              \
+			bat_data->count * sizeof(bat_data->null_value), false);            \
 		if (!bat_data->data) {                                                 \
 			msg = GDKstrdup("Malloc failure!");                                \
 			goto wrapup;                                                       \
@@ -557,34 +1593,50 @@ GENERATE_BASE_HEADERS(monetdb_data_timestamp, timestamp);
 	}
 
 
+// allocate the data array of a converted column, taking over the buffer if it is large enough
+static void* monetdb_column_data(monetdb_column_buffer *buf, size_t size, bool zero) {
+	void *data;
+	if (size == 0) {
+		size = 1;
+	}
+	if (buf && buf->data) {
+		if (buf->capacity >= size) {
+			data = buf->data;
+			buf->data = NULL;
+			if (zero) {
+				memset(data, 0, size);
+			}
+			return data;
+		}
+		GDKfree(buf->data);
+		buf->data = NULL;
+	}
+	data = zero ? GDKzalloc(size) : GDKmalloc(size);
+	if (buf) {
+		buf->capacity = data ? size : 0;
+	}
+	return data;
+}
+
 static void data_from_date(date d, monetdb_data_date *ptr);
 static void data_from_time(daytime d, monetdb_data_time *ptr);
 static void data_from_timestamp(timestamp d, monetdb_data_timestamp *ptr);
 
 monetdb_column* monetdb_result_fetch(monetdb_result* res, size_t column_index) {
-	BAT* b = NULL;
+	return monetdb_result_fetch_flags(res, column_index, monetdb_fetch_default);
+}
+
+/* convert the values of b, which the caller keeps fixed, into a freshly allocated column */
+static char* monetdb_convert_column(BAT *b, sql_subtype *sqltpe, int flags, monetdb_column_buffer *buf, monetdb_column** column) {
 	int bat_type;
 	str msg = NULL;
-	monetdb_result_internal* result = (monetdb_result_internal*) res;
-	sql_subtype* sqltpe = NULL;
 	monetdb_column* column_result = NULL;
 	size_t j = 0;
-	if (column_index >= res->ncols) {
-		msg = GDKstrdup("Index out of range!");
-		goto wrapup;
-	}
-	// check if we have the column converted already
-	if (result->converted_columns[column_index]) {
-		return result->converted_columns[column_index];
-	}
-	// otherwise we have to convert the column
-	b = BATdescriptor(result->monetdb_resultset->cols[column_index].b);
-	if (!b) {
-		msg = GDKstrdup("Malloc failure!");
-		goto wrapup;
-	}
+
 	bat_type = b->ttype;
-	sqltpe = &result->monetdb_resultset->cols[column_index].type;
+	if (bat_type != TYPE_str) {
+		flags &= ~monetdb_fetch_strview;
+	}
 
 	if (bat_type == TYPE_bit || bat_type == TYPE_bte) {
 		GENERATE_BAT_INPUT(b, int8_t, bte);
@@ -600,12 +1652,32 @@ monetdb_column* monetdb_result_fetch(monetdb_result* res, size_t column_index) {
 		GENERATE_BAT_INPUT(b, float, flt);
 	} else if (bat_type == TYPE_dbl) {
 		GENERATE_BAT_INPUT(b, double, dbl);
+	} else if (bat_type == TYPE_str && (flags & monetdb_fetch_strview)) {
+		BATiter li;
+		BUN p = 0, q = 0;
+		GENERATE_BAT_INPUT_BASE(str);
+		bat_data->count = BATcount(b);
+		bat_data->data = monetdb_column_data(buf, sizeof(char *) * bat_data->count, false);
+		bat_data->null_value = NULL;
+		if (!bat_data->data) {
+			msg = GDKstrdup("Malloc failure!");
+			goto wrapup;
+		}
+
+		// point straight into the string heap, the BAT stays fixed until cleanup
+		j = 0;
+		li = bat_iterator(b);
+		BATloop(b, p, q)
+		{
+			char *t = (char *)BUNtvar(li, p);
+			bat_data->data[j++] = GDK_STRNIL(t) ? NULL : t;
+		}
 	} else if (bat_type == TYPE_str) {
 		BATiter li;
 		BUN p = 0, q = 0;
 		GENERATE_BAT_INPUT_BASE(str);
 		bat_data->count = BATcount(b);
-		bat_data->data = GDKzalloc(sizeof(char *) * bat_data->count);
+		bat_data->data = monetdb_column_data(buf, sizeof(char *) * bat_data->count, true);
 		bat_data->null_value = NULL;
 		if (!bat_data->data) {
 			msg = createException(MAL, "cudf.eval", MAL_MALLOC_FAIL);
@@ -627,12 +1699,62 @@ monetdb_column* monetdb_result_fetch(monetdb_result* res, size_t column_index) {
 			}
 			j++;
 		}
+	} else if (bat_type == TYPE_date && (flags & monetdb_fetch_epoch)) {
+		date *baseptr, epoch = MTIMEtodate(1, 1, 1970);
+		GENERATE_BAT_INPUT_BASE(int32_t);
+		bat_data->count = BATcount(b);
+		bat_data->null_value = int_nil;
+		bat_data->data =
+			monetdb_column_data(buf, sizeof(bat_data->null_value) * bat_data->count, false);
+		if (!bat_data->data) {
+			msg = GDKstrdup("Malloc failure!");
+			goto wrapup;
+		}
+
+		baseptr = (date *)Tloc(b, 0);
+		for (j = 0; j < bat_data->count; j++) {
+			bat_data->data[j] = date_isnil(baseptr[j]) ? int_nil : baseptr[j] - epoch;
+		}
+	} else if (bat_type == TYPE_daytime && (flags & monetdb_fetch_epoch)) {
+		daytime *baseptr;
+		GENERATE_BAT_INPUT_BASE(int64_t);
+		bat_data->count = BATcount(b);
+		bat_data->null_value = lng_nil;
+		bat_data->data =
+			monetdb_column_data(buf, sizeof(bat_data->null_value) * bat_data->count, false);
+		if (!bat_data->data) {
+			msg = GDKstrdup("Malloc failure!");
+			goto wrapup;
+		}
+
+		baseptr = (daytime *)Tloc(b, 0);
+		for (j = 0; j < bat_data->count; j++) {
+			bat_data->data[j] = daytime_isnil(baseptr[j]) ? lng_nil : (lng) baseptr[j] * 1000;
+		}
+	} else if (bat_type == TYPE_timestamp && (flags & monetdb_fetch_epoch)) {
+		timestamp *baseptr;
+		date epoch = MTIMEtodate(1, 1, 1970);
+		GENERATE_BAT_INPUT_BASE(int64_t);
+		bat_data->count = BATcount(b);
+		bat_data->null_value = lng_nil;
+		bat_data->data =
+			monetdb_column_data(buf, sizeof(bat_data->null_value) * bat_data->count, false);
+		if (!bat_data->data) {
+			msg = GDKstrdup("Malloc failure!");
+			goto wrapup;
+		}
+
+		baseptr = (timestamp *)Tloc(b, 0);
+		for (j = 0; j < bat_data->count; j++) {
+			bat_data->data[j] = ts_isnil(baseptr[j]) ? lng_nil :
+				((lng) (baseptr[j].days - epoch) * 24 * 60 * 60 * 1000 + baseptr[j].msecs) * 1000;
+		}
 	} else if (bat_type == TYPE_date) {
 		date *baseptr;
 		GENERATE_BAT_INPUT_BASE(date);
 		bat_data->count = BATcount(b);
 		bat_data->data =
-			GDKmalloc(sizeof(bat_data->null_value) * bat_data->count);
+			monetdb_column_data(buf, sizeof(bat_data->null_value) * bat_data->count, false);
 		if (!bat_data->data) {
 			msg = GDKstrdup("Malloc failure!");
 			goto wrapup;
@@ -648,7 +1770,7 @@ monetdb_column* monetdb_result_fetch(monetdb_result* res, size_t column_index) {
 		GENERATE_BAT_INPUT_BASE(time);
 		bat_data->count = BATcount(b);
 		bat_data->data =
-			GDKmalloc(sizeof(bat_data->null_value) * bat_data->count);
+			monetdb_column_data(buf, sizeof(bat_data->null_value) * bat_data->count, false);
 		if (!bat_data->data) {
 			msg = GDKstrdup("Malloc failure!");
 			goto wrapup;
@@ -664,7 +1786,7 @@ monetdb_column* monetdb_result_fetch(monetdb_result* res, size_t column_index) {
 		GENERATE_BAT_INPUT_BASE(timestamp);
 		bat_data->count = BATcount(b);
 		bat_data->data =
-			GDKmalloc(sizeof(bat_data->null_value) * bat_data->count);
+			monetdb_column_data(buf, sizeof(bat_data->null_value) * bat_data->count, false);
 		if (!bat_data->data) {
 			msg = GDKstrdup("Malloc failure!");
 			goto wrapup;
@@ -682,7 +1804,7 @@ monetdb_column* monetdb_result_fetch(monetdb_result* res, size_t column_index) {
 		GENERATE_BAT_INPUT_BASE(blob);
 		bat_data->count = BATcount(b);
 		bat_data->data =
-			GDKmalloc(sizeof(monetdb_data_blob) * bat_data->count);
+			monetdb_column_data(buf, sizeof(monetdb_data_blob) * bat_data->count, true);
 		if (!bat_data->data) {
 			msg = GDKstrdup("Malloc failure!");
 			goto wrapup;
@@ -716,7 +1838,7 @@ monetdb_column* monetdb_result_fetch(monetdb_result* res, size_t column_index) {
 		GENERATE_BAT_INPUT_BASE(str);
 		bat_data->count = BATcount(b);
 		bat_data->null_value = NULL;
-		bat_data->data = GDKzalloc(sizeof(char *) * bat_data->count);
+		bat_data->data = monetdb_column_data(buf, sizeof(char *) * bat_data->count, true);
 		if (!bat_data->data) {
 			msg = GDKstrdup("Malloc failure!");
 			goto wrapup;
@@ -743,14 +1865,71 @@ monetdb_column* monetdb_result_fetch(monetdb_result* res, size_t column_index) {
 			j++;
 		}
 	}
-	BBPunfix(b->batCacheid);
-	result->converted_columns[column_index] = column_result;
-	return result->converted_columns[column_index];
+	*column = column_result;
+	return MAL_SUCCEED;
+wrapup:
+	monetdb_destroy_column(column_result, flags);
+	return msg;
+}
+
+monetdb_column* monetdb_result_fetch_flags(monetdb_result* res, size_t column_index, int flags) {
+	BAT* b = NULL;
+	str msg = NULL;
+	monetdb_result_internal* result = (monetdb_result_internal*) res;
+	sql_subtype* sqltpe = NULL;
+	monetdb_column* column_result = NULL;
+	monetdb_converted_column* converted = NULL;
+	if (column_index >= res->ncols) {
+		msg = GDKstrdup("Index out of range!");
+		goto wrapup;
+	}
+	sqltpe = &result->monetdb_resultset->cols[column_index].type;
+	// string views only make a difference for string columns
+	if (sqltpe->type->localtype != TYPE_str) {
+		flags &= ~monetdb_fetch_strview;
+	}
+	if (sqltpe->type->localtype != TYPE_date && sqltpe->type->localtype != TYPE_daytime &&
+		sqltpe->type->localtype != TYPE_timestamp) {
+		flags &= ~monetdb_fetch_epoch;
+	}
+	// check if we have the column converted already
+	for (converted = result->converted_columns[column_index]; converted; converted = converted->next) {
+		if (converted->flags == flags) {
+			return converted->column;
+		}
+	}
+	// otherwise we have to convert the column
+	b = BATdescriptor(result->monetdb_resultset->cols[column_index].b);
+	if (!b) {
+		msg = GDKstrdup("Malloc failure!");
+		goto wrapup;
+	}
+	if (b->ttype != TYPE_str) {
+		flags &= ~monetdb_fetch_strview;
+	}
+	if ((msg = monetdb_convert_column(b, sqltpe, flags, NULL, &column_result)) != MAL_SUCCEED) {
+		goto wrapup;
+	}
+	converted = GDKmalloc(sizeof(monetdb_converted_column));
+	if (!converted) {
+		msg = GDKstrdup("Malloc failure!");
+		goto wrapup;
+	}
+	// string views point straight into the string heap, the BAT stays fixed until cleanup
+	converted->pinned = (flags & monetdb_fetch_strview) ? b->batCacheid : 0;
+	if (!converted->pinned) {
+		BBPunfix(b->batCacheid);
+	}
+	converted->column = column_result;
+	converted->flags = flags;
+	converted->next = result->converted_columns[column_index];
+	result->converted_columns[column_index] = converted;
+	return column_result;
 wrapup:
 	if (b) {
 		BBPunfix(b->batCacheid);
 	}
-	monetdb_destroy_column(column_result);
+	monetdb_destroy_column(column_result, flags);
 	if (msg) {
 		// FIXME: show message somehow?
 		GDKfree(msg);
@@ -758,6 +1937,55 @@ wrapup:
 	return NULL;
 }
 
+char* monetdb_result_fetch_range(monetdb_result* res, size_t column_index, size_t offset, size_t count, monetdb_column** column) {
+	BAT *b = NULL, *v = NULL;
+	monetdb_result_internal* result = (monetdb_result_internal*) res;
+	monetdb_column* column_result = NULL;
+	monetdb_column_buffer buf = { NULL, 0 };
+	size_t nrows;
+	str msg;
+
+	if (!res || !column) {
+		return GDKstrdup("Invalid parameters");
+	}
+	*column = NULL;
+	if (column_index >= res->ncols) {
+		return GDKstrdup("Index out of range!");
+	}
+	b = BATdescriptor(result->monetdb_resultset->cols[column_index].b);
+	if (!b) {
+		return GDKstrdup("Result column is not available");
+	}
+	nrows = BATcount(b);
+	if (offset > nrows) {
+		offset = nrows;
+	}
+	if (count > nrows - offset) {
+		count = nrows - offset;
+	}
+	v = BATslice(b, (BUN) offset, (BUN) (offset + count));
+	BBPunfix(b->batCacheid);
+	if (!v) {
+		return GDKstrdup("Malloc failure!");
+	}
+	// hand the data array of the previous range to the conversion
+	if (result->range_columns[column_index].column) {
+		monetdb_column *prev = result->range_columns[column_index].column;
+		monetdb_destroy_column_values(prev, monetdb_fetch_default);
+		buf.data = prev->data;
+		buf.capacity = result->range_columns[column_index].capacity;
+		GDKfree(prev);
+		result->range_columns[column_index].column = NULL;
+	}
+	msg = monetdb_convert_column(v, &result->monetdb_resultset->cols[column_index].type, monetdb_fetch_default, &buf, &column_result);
+	BBPunfix(v->batCacheid);
+	GDKfree(buf.data);
+	result->range_columns[column_index].column = column_result;
+	result->range_columns[column_index].capacity = column_result ? buf.capacity : 0;
+	*column = column_result;
+	return msg;
+}
+
 void* monetdb_result_fetch_rawcol(monetdb_result* res, size_t column_index) {
 	monetdb_result_internal* result = (monetdb_result_internal*) res;
 	if (column_index >= res->ncols) // index out of range
@@ -765,6 +1993,323 @@ void* monetdb_result_fetch_rawcol(monetdb_result* res, size_t column_index) {
 	return &(result->monetdb_resultset->cols[column_index]);
 }
 
+typedef struct {
+	bat pinned; /* result BAT whose tail is shared with the array, if any */
+	const void *buffers[3];
+	void *allocated[3]; /* buffers owned by the array */
+} monetdb_arrow_private;
+
+static void monetdb_arrow_release_array(struct ArrowArray *array) {
+	monetdb_arrow_private *priv;
+	int i;
+	if (!array || !array->release) {
+		return;
+	}
+	priv = (monetdb_arrow_private *) array->private_data;
+	for (i = 0; i < 3; i++) {
+		GDKfree(priv->allocated[i]);
+	}
+	if (priv->pinned) {
+		BBPunfix(priv->pinned);
+	}
+	GDKfree(priv);
+	array->release = NULL;
+}
+
+static void monetdb_arrow_release_schema(struct ArrowSchema *schema) {
+	if (!schema || !schema->release) {
+		return;
+	}
+	GDKfree((char *) schema->format);
+	GDKfree((char *) schema->name);
+	schema->release = NULL;
+}
+
+/* append a value to a growing variable-size data buffer */
+static int monetdb_arrow_append(monetdb_arrow_private *priv, size_t *size, size_t *len, const void *src, size_t srclen) {
+	if (*len + srclen > *size) {
+		size_t nsize = *size * 2;
+		char *ndata;
+		if (nsize < *len + srclen) {
+			nsize = *len + srclen;
+		}
+		ndata = GDKrealloc(priv->allocated[2], nsize);
+		if (!ndata) {
+			return -1;
+		}
+		priv->allocated[2] = ndata;
+		*size = nsize;
+	}
+	memcpy((char *) priv->allocated[2] + *len, src, srclen);
+	*len += srclen;
+	return 0;
+}
+
+#define ARROW_MALLOC(buf, size)                                                \
+	do {                                                                       \
+		if (!(priv->allocated[buf] = GDKmalloc((size) > 0 ? (size) : 1))) {    \
+			msg = GDKstrdup("Malloc failure!");                                \
+			goto wrapup;                                                       \
+		}                                                                      \
+	} while (0)
+
+/* the validity bitmap is only created once the first nil shows up */
+#define ARROW_MARK_NULL(idx)                                                   \
+	do {                                                                       \
+		if (!priv->allocated[0]) {                                             \
+			ARROW_MALLOC(0, (cnt + 7) / 8);                                    \
+			memset(priv->allocated[0], 0xFF, (cnt + 7) / 8);                   \
+		}                                                                      \
+		((unsigned char *) priv->allocated[0])[(idx) >> 3] &=                  \
+			(unsigned char) ~(1 << ((idx) & 7));                               \
+		null_count++;                                                          \
+	} while (0)
+
+/* share the tail heap of the BAT, only scanning it for nils */
+#define ARROW_SHARE_TAIL(tpe, fmt)                                             \
+	do {                                                                       \
+		const tpe *vals = (const tpe *) Tloc(b, 0);                            \
+		format = fmt;                                                          \
+		if (!b->tnonil) {                                                      \
+			for (i = 0; i < cnt; i++) {                                        \
+				if (vals[i] == tpe##_nil)                                      \
+					ARROW_MARK_NULL(i);                                        \
+			}                                                                  \
+		}                                                                      \
+		priv->buffers[1] = vals;                                               \
+		priv->pinned = b->batCacheid;                                          \
+	} while (0)
+
+#define ARROW_DECIMAL(tpe)                                                     \
+	do {                                                                       \
+		const tpe *vals = (const tpe *) Tloc(b, 0);                            \
+		int64_t *data;                                                         \
+		ARROW_MALLOC(1, 2 * sizeof(int64_t) * cnt);                            \
+		data = (int64_t *) priv->allocated[1];                                 \
+		for (i = 0; i < cnt; i++) {                                            \
+			if (vals[i] == tpe##_nil) {                                        \
+				ARROW_MARK_NULL(i);                                            \
+				data[2 * i] = data[2 * i + 1] = 0;                             \
+			} else {                                                           \
+				data[2 * i] = vals[i];                                         \
+				data[2 * i + 1] = vals[i] < 0 ? -1 : 0;                        \
+			}                                                                  \
+		}                                                                      \
+	} while (0)
+
+char* monetdb_result_fetch_arrow(monetdb_result* res, size_t column_index, struct ArrowArray* out_array, struct ArrowSchema* out_schema) {
+	res_col *col;
+	BAT *b = NULL;
+	monetdb_arrow_private *priv = NULL;
+	const char *format = NULL;
+	char decimal_format[32];
+	int64_t null_count = 0;
+	int n_buffers = 2;
+	BUN i, cnt;
+	str msg = MAL_SUCCEED;
+
+	if (!res || !out_array || !out_schema) {
+		return GDKstrdup("Invalid parameters");
+	}
+	col = (res_col *) monetdb_result_fetch_rawcol(res, column_index);
+	if (!col) {
+		return GDKstrdup("Index out of range!");
+	}
+	b = BATdescriptor(col->b);
+	if (!b) {
+		return GDKstrdup("Could not access result column");
+	}
+	priv = GDKzalloc(sizeof(monetdb_arrow_private));
+	if (!priv) {
+		msg = GDKstrdup("Malloc failure!");
+		goto wrapup;
+	}
+	cnt = BATcount(b);
+
+	if (col->type.type->eclass == EC_DEC) {
+		// Arrow decimals are 128 bits wide, so these are always widened
+		snprintf(decimal_format, sizeof(decimal_format), "d:%u,%u", col->type.digits, col->type.scale);
+		format = decimal_format;
+		switch (b->ttype) {
+		case TYPE_bte:
+			ARROW_DECIMAL(bte);
+			break;
+		case TYPE_sht:
+			ARROW_DECIMAL(sht);
+			break;
+		case TYPE_int:
+			ARROW_DECIMAL(int);
+			break;
+		case TYPE_lng:
+			ARROW_DECIMAL(lng);
+			break;
+		default:
+			msg = GDKstrdup("Unsupported decimal type for Arrow export");
+			goto wrapup;
+		}
+	} else if (b->ttype == TYPE_bte) {
+		ARROW_SHARE_TAIL(bte, "c");
+	} else if (b->ttype == TYPE_sht) {
+		ARROW_SHARE_TAIL(sht, "s");
+	} else if (b->ttype == TYPE_int) {
+		ARROW_SHARE_TAIL(int, "i");
+	} else if (b->ttype == TYPE_lng) {
+		ARROW_SHARE_TAIL(lng, "l");
+	} else if (b->ttype == TYPE_flt) {
+		ARROW_SHARE_TAIL(flt, "f");
+	} else if (b->ttype == TYPE_dbl) {
+		ARROW_SHARE_TAIL(dbl, "g");
+	} else if (b->ttype == TYPE_oid) {
+		ARROW_SHARE_TAIL(oid, SIZEOF_OID == 8 ? "L" : "I");
+	} else if (b->ttype == TYPE_daytime) {
+		// milliseconds since midnight, same as Arrow time32[ms]
+		ARROW_SHARE_TAIL(daytime, "ttm");
+	} else if (b->ttype == TYPE_void) {
+		oid *data;
+		format = SIZEOF_OID == 8 ? "L" : "I";
+		ARROW_MALLOC(1, sizeof(oid) * cnt);
+		data = (oid *) priv->allocated[1];
+		for (i = 0; i < cnt; i++) {
+			if (b->tseqbase == oid_nil) {
+				ARROW_MARK_NULL(i);
+				data[i] = 0;
+			} else {
+				data[i] = b->tseqbase + i;
+			}
+		}
+	} else if (b->ttype == TYPE_bit) {
+		const bit *vals = (const bit *) Tloc(b, 0);
+		unsigned char *data;
+		format = "b";
+		ARROW_MALLOC(1, (cnt + 7) / 8);
+		data = (unsigned char *) priv->allocated[1];
+		memset(data, 0, (cnt + 7) / 8);
+		for (i = 0; i < cnt; i++) {
+			if (vals[i] == bit_nil) {
+				ARROW_MARK_NULL(i);
+			} else if (vals[i]) {
+				data[i >> 3] |= (unsigned char) (1 << (i & 7));
+			}
+		}
+	} else if (b->ttype == TYPE_date) {
+		// MonetDB counts days from year zero, Arrow from the UNIX epoch
+		const date *vals = (const date *) Tloc(b, 0);
+		date epoch = MTIMEtodate(1, 1, 1970);
+		int32_t *data;
+		format = "tdD";
+		ARROW_MALLOC(1, sizeof(int32_t) * cnt);
+		data = (int32_t *) priv->allocated[1];
+		for (i = 0; i < cnt; i++) {
+			if (date_isnil(vals[i])) {
+				ARROW_MARK_NULL(i);
+				data[i] = 0;
+			} else {
+				data[i] = vals[i] - epoch;
+			}
+		}
+	} else if (b->ttype == TYPE_timestamp) {
+		const timestamp *vals = (const timestamp *) Tloc(b, 0);
+		date epoch = MTIMEtodate(1, 1, 1970);
+		int64_t *data;
+		format = "tsm:";
+		ARROW_MALLOC(1, sizeof(int64_t) * cnt);
+		data = (int64_t *) priv->allocated[1];
+		for (i = 0; i < cnt; i++) {
+			if (ts_isnil(vals[i])) {
+				ARROW_MARK_NULL(i);
+				data[i] = 0;
+			} else {
+				data[i] = (int64_t) (vals[i].days - epoch) * 86400000 + vals[i].msecs;
+			}
+		}
+	} else if (b->ttype == TYPE_str || b->ttype == TYPE_blob || b->ttype == TYPE_sqlblob) {
+		// 64-bit offsets and a data buffer filled in a single pass over the BAT
+		BATiter li = bat_iterator(b);
+		BUN p = 0, q = 0;
+		size_t size = b->tvheap->free > 0 ? b->tvheap->free : 1, len = 0;
+		int64_t *offsets;
+		format = b->ttype == TYPE_str ? "U" : "Z";
+		n_buffers = 3;
+		ARROW_MALLOC(1, sizeof(int64_t) * (cnt + 1));
+		ARROW_MALLOC(2, size);
+		offsets = (int64_t *) priv->allocated[1];
+		offsets[0] = 0;
+		i = 0;
+		BATloop(b, p, q)
+		{
+			const void *t = BUNtvar(li, p);
+			const void *src = t;
+			size_t srclen = 0;
+			if (b->ttype == TYPE_str) {
+				if (GDK_STRNIL(t)) {
+					ARROW_MARK_NULL(i);
+				} else {
+					srclen = strlen((const char *) t);
+				}
+			} else {
+				const blob *bl = (const blob *) t;
+				if (bl->nitems == ~(size_t)0) {
+					ARROW_MARK_NULL(i);
+				} else {
+					src = bl->data;
+					srclen = bl->nitems;
+				}
+			}
+			if (srclen > 0 && monetdb_arrow_append(priv, &size, &len, src, srclen) < 0) {
+				msg = GDKstrdup("Malloc failure!");
+				goto wrapup;
+			}
+			offsets[++i] = (int64_t) len;
+		}
+	} else {
+		msg = GDKstrdup("Unsupported type for Arrow export");
+		goto wrapup;
+	}
+
+	for (i = 1; i < 3; i++) {
+		if (priv->allocated[i]) {
+			priv->buffers[i] = priv->allocated[i];
+		}
+	}
+	priv->buffers[0] = priv->allocated[0];
+
+	memset(out_schema, 0, sizeof(struct ArrowSchema));
+	out_schema->format = GDKstrdup(format);
+	out_schema->name = GDKstrdup(col->name);
+	if (!out_schema->format || !out_schema->name) {
+		GDKfree((char *) out_schema->format);
+		GDKfree((char *) out_schema->name);
+		out_schema->format = out_schema->name = NULL;
+		msg = GDKstrdup("Malloc failure!");
+		goto wrapup;
+	}
+	out_schema->flags = ARROW_FLAG_NULLABLE;
+	out_schema->release = monetdb_arrow_release_schema;
+
+	memset(out_array, 0, sizeof(struct ArrowArray));
+	out_array->length = (int64_t) cnt;
+	out_array->null_count = null_count;
+	out_array->n_buffers = n_buffers;
+	out_array->buffers = priv->buffers;
+	out_array->release = monetdb_arrow_release_array;
+	out_array->private_data = priv;
+
+	// a shared tail keeps the BAT fixed until the array is released
+	if (!priv->pinned) {
+		BBPunfix(b->batCacheid);
+	}
+	return MAL_SUCCEED;
+wrapup:
+	if (priv) {
+		for (i = 0; i < 3; i++) {
+			GDKfree(priv->allocated[i]);
+		}
+		GDKfree(priv);
+	}
+	BBPunfix(b->batCacheid);
+	return msg;
+}
+
 void data_from_date(date d, monetdb_data_date *ptr)
 {
 	int day, month, year;
@@ -838,13 +2383,23 @@ int blob_is_null(monetdb_data_blob value) {
 	return value.data == NULL;
 }
 
-void monetdb_destroy_column(monetdb_column* column) {
-	size_t j;
+void monetdb_destroy_column(monetdb_column* column, int flags) {
 	if (!column) {
 		return;
 	}
 
-	if (column->type == monetdb_str) {
+	monetdb_destroy_column_values(column, flags);
+	GDKfree(column->data);
+	GDKfree(column);
+}
+
+// free what the values of a column point to, but not the data array itself
+static void monetdb_destroy_column_values(monetdb_column* column, int flags) {
+	size_t j;
+	if (!column->data) {
+		return;
+	}
+	if (column->type == monetdb_str && !(flags & monetdb_fetch_strview)) {
 		// FIXME: clean up individual strings
 		char** data = (char**)column->data;
 		for(j = 0; j < column->count; j++) {
@@ -860,6 +2415,4 @@ void monetdb_destroy_column(monetdb_column* column) {
 			}
 		}
 	}
-	GDKfree(column->data);
-	GDKfree(column);
 }
@@ -73,6 +73,17 @@ typedef struct {
 	char* name;
 } monetdb_column;
 
+/* flags for monetdb_result_fetch_flags, can be combined */
+typedef enum {
+	monetdb_fetch_default = 0,
+	/* string data points into the result heap instead of being copied. the
+	 * strings are read-only and stay valid until monetdb_cleanup_result */
+	monetdb_fetch_strview = 1,
+	/* dates become int32 days and timestamps int64 microseconds since
+	 * 1970-01-01, times int64 microseconds since midnight */
+	monetdb_fetch_epoch = 2
+} monetdb_fetch_flags;
+
 typedef struct {
 	size_t nrows;
 	size_t ncols;
@@ -82,6 +93,46 @@ typedef struct {
 
 typedef void* monetdb_connection;
 
+typedef struct {
+	size_t nparams;
+	monetdb_types *param_types; /* C type each parameter is bound with */
+} monetdb_statement;
+
+/* Arrow C data interface, see https://arrow.apache.org/docs/format/CDataInterface.html */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+	const char* format;
+	const char* name;
+	const char* metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema** children;
+	struct ArrowSchema* dictionary;
+	void (*release)(struct ArrowSchema*);
+	void* private_data;
+};
+
+struct ArrowArray {
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void** buffers;
+	struct ArrowArray** children;
+	struct ArrowArray* dictionary;
+	void (*release)(struct ArrowArray*);
+	void* private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
 #define DEFAULT_STRUCT_DEFINITION(ctype, typename)                              \
 	typedef struct                                          \
 	{                                                                          \
@@ -117,13 +168,47 @@ embedded_export int   monetdb_is_initialized(void);
 
 embedded_export char* monetdb_set_autocommit(monetdb_connection conn, char val);
 embedded_export char* monetdb_query(monetdb_connection conn, char* query, char execute, monetdb_result** result, long *affected_rows, long* prepare_id);
+// run a query on the executor threads, queries on the same connection run one after the other in submission order.
+// the callback is called from an executor thread when the query finishes. without a pending handle it takes over
+// the error and result, otherwise these are handed out by monetdb_query_wait, which releases the handle
+typedef void* monetdb_pending_query;
+typedef void (*monetdb_query_callback)(monetdb_connection conn, void* userdata, char* error, monetdb_result* result, long affected_rows);
+embedded_export char* monetdb_query_async(monetdb_connection conn, char* query, monetdb_query_callback callback, void* userdata, monetdb_pending_query* pending);
+embedded_export int   monetdb_query_poll(monetdb_pending_query pending);
+embedded_export char* monetdb_query_wait(monetdb_pending_query pending, monetdb_result** result, long* affected_rows);
 embedded_export monetdb_column* monetdb_result_fetch(monetdb_result* result, size_t column_index);
+embedded_export monetdb_column* monetdb_result_fetch_flags(monetdb_result* result, size_t column_index, int flags);
+// convert rows [offset, offset + count) of a result column into *column, count is clipped to the end of the result.
+// the column stays owned by the result and is reused by the next range of the same column, so it is valid until then
+embedded_export char* monetdb_result_fetch_range(monetdb_result* result, size_t column_index, size_t offset, size_t count, monetdb_column** column);
 embedded_export void* monetdb_result_fetch_rawcol(monetdb_result* result, size_t column_index); // actually a res_col
+// export a result column through the Arrow C data interface, fixed-width tails are shared with the
+// result BAT, which stays alive until the release callback of the array is called
+embedded_export char* monetdb_result_fetch_arrow(monetdb_result* result, size_t column_index, struct ArrowArray* out_array, struct ArrowSchema* out_schema);
 
 embedded_export char* monetdb_append(monetdb_connection conn, const char* schema, const char* table, append_data *data, int ncols);
+// append C arrays to a table, one monetdb_column per table column in table order. NULLs are the types' null
+// values (NULL pointers for strings and blobs) or set bits in the optional per-column null_masks
+embedded_export char* monetdb_append_columns(monetdb_connection conn, const char* schema, const char* table, monetdb_column *columns, unsigned char **null_masks, int ncols);
+// prepare a statement with ? placeholders, its parameters are bound as C values without going through the parser
+embedded_export char* monetdb_prepare(monetdb_connection conn, char* query, monetdb_statement** stmt);
+// execute a prepared statement, params[i] points to a value of param_types[i], or is NULL for a NULL. DECIMAL
+// parameters are bound as their raw scaled integers, e.g. 12345 for 123.45 in a DECIMAL(8,2). The statement
+// stays valid when its execution fails, but a schema change invalidates it
+embedded_export char* monetdb_execute_bound(monetdb_connection conn, monetdb_statement* stmt, void** params, monetdb_result** result, long* affected_rows);
+// execute a prepared statement once per parameter row in a single transaction, params[i] is an array of nrows values of
+// param_types[i]. NULLs are the types' null values or set bits in the optional per-parameter null_masks
+embedded_export char* monetdb_execute_bound_array(monetdb_connection conn, monetdb_statement* stmt, void** params, unsigned char **null_masks, size_t nrows, long* affected_rows);
+embedded_export void  monetdb_cleanup_statement(monetdb_connection conn, monetdb_statement* stmt);
 embedded_export void  monetdb_cleanup_result(monetdb_connection conn, monetdb_result* result);
 char* monetdb_get_columns(monetdb_connection conn, const char* schema_name, const char *table_name, int *column_count, char ***column_names, int **column_types);
 
+// abort the query running or queued on the connection, it returns an error as soon as the kernel notices;
+// a cancel while the connection is idle aborts its next query
+embedded_export void  monetdb_cancel(monetdb_connection conn);
+// abort queries on the connection that run longer than timeout_ms milliseconds, 0 disables the timeout
+embedded_export char* monetdb_set_query_timeout(monetdb_connection conn, long timeout_ms);
+
 // progress monitoring
 typedef int (*monetdb_progress_callback)(monetdb_connection conn, void* data, size_t num_statements, size_t num_completed_statement, float percentage_done);
 embedded_export void monetdb_register_progress(monetdb_connection conn, monetdb_progress_callback callback, void* data);
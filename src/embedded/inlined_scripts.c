@@ -1,79 +1,80 @@
 unsigned char mal_init_inline_arr[] = 
-{120,218,236,189,125,115,228,54,146,62,248,183,244,41,56,190,248,69,151,198,37,77,75,222,189,189,179,166,29,215,111,246,244,110,191,77,119,187,119,239,60,14,5,171,138,146,56,174,34,203,36,75,45,249,211,95,38,192,23,144,4,72,0,4,64,244,221,76,76,180,85,85,0,50,241,32,51,31,188,36,193,227,227,193,255,237,210,205,97,27,5,187,93,88,220,94,30,31,175,83,248,43,217,4,225,58,205,23,247,223,95,111,139,19,252,39,56,14,55,155,44,202,243,224,205,211,79,127,59,36,97,246,112,245,244,249,187,143,240,211,101,183,206,102,181,61,193,127,68,117,224,39,82,37,74,138,224,155,79,183,81,89,239,36,184,62,36,235,34,78,147,96,29,110,215,135,109,88,68,121,80,224,239,217,58,128,34,113,18,5,233,117,112,191,132,47,195,34,136,233,143,199,71,119,225,246,16,5,95,110,211,60,170,138,193,111,247,103,1,182,77,127,132,207,89,84,28,178,36,218,4,113,18,100,225,38,14,147,60,64,165,225,167,227,35,236,124,4,255,196,32,121,251,16,108,162,235,24,139,22,105,176,138,224,255,197,151,40,74,130,199,164,252,251,87,193,34,78,214,219,67,30,223,69,39,103,223,176,152,129,236,18,179,32,16,162,246,241,213,219,54,106,180,22,162,6,181,68,184,65,173,62,110,164,230,48,110,2,212,40,44,199,71,20,53,13,204,58,136,29,31,241,49,59,125,255,234,47,23,20,56,242,167,24,187,34,108,176,11,6,224,251,244,180,3,31,173,72,225,11,6,16,132,138,125,4,73,229,97,4,161,200,13,86,24,3,177,42,103,15,199,210,254,70,80,188,160,48,46,31,4,206,187,138,107,60,46,122,72,94,80,40,161,50,223,139,217,202,92,52,161,129,229,131,52,160,248,85,241,37,13,142,131,242,127,119,97,22,135,171,45,148,190,39,189,125,56,11,130,87,4,211,60,222,197,219,48,67,92,170,54,227,228,166,106,244,248,136,105,245,33,248,11,14,85,116,191,142,246,5,29,49,44,150,199,55,128,59,252,190,74,139,91,168,116,115,64,213,97,36,178,168,81,224,144,83,236,55,81,17,101,59,244,11,172,250,251,33,220,100,97,163,51,224,113,216,22,160,91,107,152,143,143,228,7,154,63,204,181,26,35,227,93,143,89,19,165,161,210,145,216,109,186,161,186,137,212,101,61,129,215,240,194,117,55,90,211,78,211,241,109,133,233,47,183,17,64,123,143,189,191,1,213,19,68,165,238,97,9,15,245,20,218,68,131,100,109,246,231,4,131,243,150,145,179,81,118,168,207,221,64,203,198,217,161,62,243,66,109,55,210,186,238,115,43,58,14,244,185,27,29,91,193,113,160,207,188,224,216,141,141,108,159,91,65,177,238,31,175,243,101,159,217,206,172,211,66,210,104,63,117,140,182,144,52,218,79,28,163,45,132,157,121,158,78,236,78,126,43,67,93,224,75,127,235,58,225,173,12,117,97,69,158,23,222,46,152,14,181,122,116,251,176,143,178,85,186,141,215,93,235,140,215,183,52,84,85,1,168,19,151,194,60,88,68,247,123,196,234,219,0,255,56,189,63,57,129,120,122,209,117,65,169,46,131,43,253,173,235,131,82,93,198,138,60,39,228,119,153,244,153,237,116,175,203,245,152,66,223,199,123,126,42,238,57,88,138,84,207,193,161,254,214,245,68,169,158,99,69,158,43,182,122,46,24,235,246,84,69,106,176,233,128,96,63,169,53,182,231,19,165,181,203,116,248,195,211,23,175,158,190,109,179,76,83,125,180,219,101,245,94,207,171,38,216,41,69,154,220,69,89,129,3,121,147,69,48,85,136,19,96,209,218,49,131,70,253,178,128,140,250,47,94,254,244,225,229,203,182,250,77,245,81,245,203,234,61,245,171,38,120,234,87,19,4,162,126,89,176,165,62,177,70,137,56,249,242,127,222,183,244,166,245,198,227,36,212,235,41,92,122,0,215,210,40,85,129,113,69,193,2,63,175,194,156,124,172,157,43,9,161,112,184,13,182,233,13,204,227,138,219,93,126,2,189,140,203,41,21,86,217,167,95,162,140,216,103,203,206,160,130,84,79,95,191,251,169,213,83,90,111,188,167,80,175,215,83,82,87,208,211,94,71,184,42,159,63,102,44,107,64,229,243,199,93,165,73,205,202,168,6,148,62,127,204,83,27,107,11,20,199,33,57,61,127,204,83,188,150,15,99,208,90,34,240,116,47,231,249,239,223,253,119,75,
-117,90,181,89,32,240,148,111,170,246,116,39,213,91,203,3,190,125,221,139,172,230,161,205,66,191,103,197,162,234,195,208,68,240,239,31,218,19,137,178,34,237,193,208,76,16,42,246,89,8,43,11,13,39,77,78,147,232,6,34,236,29,196,174,52,45,250,134,179,94,201,105,253,252,89,71,235,178,226,168,214,88,177,63,93,88,13,104,189,62,172,186,218,54,82,163,120,91,171,59,52,187,121,249,234,117,91,93,90,113,124,118,3,21,251,234,98,229,150,186,233,33,217,224,170,240,176,255,18,102,240,87,105,26,73,4,203,183,188,192,32,26,221,68,89,11,233,235,112,149,203,104,240,227,211,103,253,200,77,42,223,139,103,27,240,115,186,61,20,140,213,146,221,168,42,20,94,111,83,178,64,61,221,167,160,90,144,28,118,43,48,225,182,37,64,153,52,99,176,21,65,251,227,235,119,239,62,180,176,173,106,142,133,16,82,179,223,53,82,155,139,238,38,253,146,140,226,187,15,11,88,28,39,193,245,46,221,80,245,151,101,28,108,247,224,249,155,23,176,158,127,243,238,5,174,188,195,237,101,183,34,198,145,50,12,182,59,208,169,216,209,30,43,119,54,25,210,221,254,80,109,49,100,48,193,137,147,13,13,24,155,248,46,222,224,62,193,125,176,122,128,240,113,124,196,91,122,221,195,140,47,9,254,28,60,84,235,183,164,218,226,249,253,144,22,113,53,165,130,73,210,195,18,22,249,8,22,9,78,20,169,63,162,44,69,184,194,132,107,133,164,120,29,112,161,132,200,143,202,192,249,225,221,207,111,95,180,167,81,101,11,52,238,54,45,136,66,47,105,161,63,147,34,173,36,203,96,119,82,155,114,57,242,52,210,238,130,253,54,92,71,245,208,103,241,205,109,209,88,116,105,225,155,104,29,239,128,26,137,93,95,6,241,53,212,3,176,210,93,12,99,187,89,98,229,199,101,67,103,240,211,26,80,89,225,38,89,29,21,113,174,134,66,161,65,28,159,155,24,166,66,219,232,186,224,10,56,107,228,239,130,221,1,12,17,26,19,0,29,231,9,172,88,55,165,65,173,98,174,47,189,250,248,246,233,219,54,48,180,30,55,54,102,104,31,215,116,9,248,40,73,139,211,240,148,122,242,163,70,175,197,219,240,237,201,50,160,1,103,139,51,34,232,69,246,5,248,11,181,107,148,139,147,235,90,57,12,9,92,229,94,189,253,177,171,28,214,227,41,119,122,78,85,203,162,61,52,67,118,178,106,140,155,229,78,2,19,255,184,0,195,238,151,222,195,202,144,148,110,10,161,166,143,249,29,32,69,162,49,120,127,124,245,246,213,167,151,29,135,165,53,71,1,78,162,24,5,87,234,48,189,72,210,44,8,187,3,64,112,167,62,44,68,255,248,248,144,228,225,53,174,150,171,21,9,252,179,224,141,0,254,2,95,54,170,151,65,34,36,117,210,93,25,194,177,81,110,155,119,212,49,133,13,135,217,141,76,219,245,20,5,127,89,228,81,180,41,219,189,75,227,77,187,225,188,167,50,194,22,135,219,248,15,186,107,73,154,96,80,255,18,227,190,103,128,141,182,167,81,219,174,176,94,39,202,50,154,210,200,240,224,146,179,44,196,74,223,199,11,178,207,220,18,183,143,251,88,129,211,239,246,105,86,224,54,44,187,142,165,38,64,6,187,125,164,181,10,11,70,206,46,206,50,96,189,213,247,240,245,47,223,135,201,195,213,197,175,104,199,248,9,160,253,181,233,239,179,255,122,78,11,55,58,124,96,215,219,81,184,57,165,5,64,163,240,134,112,127,24,60,123,250,9,86,69,95,82,242,59,216,198,246,176,75,242,206,110,237,38,218,70,224,9,84,135,128,40,113,254,235,50,184,69,5,74,93,170,111,89,109,104,181,70,155,23,228,115,240,236,231,183,224,43,27,192,0,2,47,210,27,145,92,58,68,116,191,190,13,147,27,164,62,50,16,219,16,98,39,212,96,161,23,168,179,41,63,35,42,163,90,93,237,14,219,34,238,233,70,190,221,111,137,146,203,32,191,141,175,201,110,61,124,202,97,6,55,170,68,53,48,66,169,96,75,61,153,104,95,240,57,139,129,121,90,4,28,17,58,226,195,14,132,69,191,16,139,92,29,146,171,56,33,109,176,22,65,190,40,55,67,227,109,51,13,76,19,58,52,228,220,225,22,183,88,210,93,196,140,141,134,110,203,224,58,205,214,17,6,93,41,53,175,72,113,103,202,102,241,166,241,163,37,86,100,
-117,28,208,56,44,250,192,190,143,50,208,126,87,9,195,158,147,145,37,166,83,78,17,242,104,157,130,62,232,114,100,243,164,32,44,147,229,133,1,117,229,176,110,52,239,98,61,93,255,230,64,110,191,143,32,92,6,113,91,191,3,251,49,16,43,73,171,95,125,201,194,125,163,30,253,178,60,183,128,73,20,157,218,30,112,86,22,183,78,18,37,100,51,80,141,171,65,138,90,85,38,103,130,249,168,58,48,47,149,133,134,196,79,44,31,111,32,210,6,219,24,34,105,62,93,71,37,244,136,186,42,16,42,41,221,211,185,23,117,70,212,3,31,26,211,142,134,156,102,108,153,99,231,34,92,223,46,138,2,103,29,75,140,61,251,235,120,27,125,159,23,217,0,44,164,82,159,160,67,152,69,126,33,142,69,0,216,68,73,94,134,51,186,7,15,177,175,244,65,122,162,83,60,236,35,242,211,33,143,242,122,190,217,252,142,154,16,149,219,115,29,108,136,158,226,145,2,95,98,112,112,88,152,192,226,153,50,49,148,169,27,203,163,236,174,179,82,33,106,65,207,22,249,31,223,111,147,27,118,26,210,230,58,90,172,233,230,243,44,34,71,233,180,155,191,224,156,112,121,71,12,30,187,12,61,203,81,195,71,249,31,143,218,43,163,228,58,13,22,193,170,29,150,23,244,35,224,12,99,222,252,125,194,170,128,53,153,216,150,193,204,10,98,90,8,0,172,182,212,226,96,173,141,204,142,5,51,156,145,193,204,47,92,165,135,162,156,18,197,73,240,11,12,86,22,175,96,129,190,36,70,240,107,64,139,50,107,187,87,69,213,86,78,130,229,62,75,247,81,6,43,239,58,100,98,91,25,132,205,108,115,22,176,93,187,137,138,143,216,231,94,239,16,88,182,39,101,65,6,203,42,51,129,230,16,172,139,3,204,37,9,126,140,200,77,148,175,179,120,95,164,25,181,204,124,137,44,121,27,149,199,250,187,125,134,83,101,50,11,35,7,17,48,248,5,99,72,236,242,26,155,220,69,187,52,123,8,246,56,107,36,162,112,210,29,172,86,251,51,80,239,61,124,139,42,46,78,218,135,48,240,19,248,89,184,134,21,218,162,221,73,236,99,208,233,100,85,148,63,121,93,31,178,12,191,4,144,211,53,29,45,170,7,168,190,11,239,171,125,42,220,227,223,70,36,61,226,164,158,222,246,148,34,115,220,79,224,65,29,240,49,156,129,37,245,52,171,203,7,124,229,136,51,86,89,33,232,170,116,22,93,43,176,196,3,171,102,241,79,203,83,141,187,186,125,72,183,196,38,42,170,31,84,12,11,243,53,202,224,151,36,220,213,90,49,115,123,62,44,121,84,252,87,244,208,193,99,25,192,138,132,51,163,104,233,1,53,127,139,152,81,251,24,21,84,135,71,240,245,163,202,35,30,120,248,128,113,61,66,9,143,206,130,87,73,89,30,63,47,91,1,237,183,40,75,162,45,141,85,57,68,173,164,216,62,4,43,48,131,223,0,208,28,189,45,37,189,134,137,224,58,132,112,8,189,219,28,246,91,178,188,168,27,194,249,245,3,218,121,7,141,206,70,76,216,7,161,187,103,64,161,255,175,168,103,168,184,5,71,246,1,40,167,209,30,214,147,86,154,174,115,72,226,223,129,77,22,208,213,147,46,254,79,215,224,138,57,127,8,6,57,165,174,203,108,95,64,103,49,225,8,151,82,52,78,28,246,132,79,67,82,16,70,37,190,139,183,241,77,132,135,172,196,199,227,156,216,68,240,6,197,29,31,5,217,47,184,92,76,147,237,195,175,101,102,15,241,189,47,1,126,5,17,13,153,137,180,117,6,133,195,95,40,97,214,229,171,194,88,142,134,28,42,31,11,127,249,37,139,139,8,227,112,167,101,12,160,104,44,196,189,73,187,160,81,137,27,214,38,161,123,69,82,144,66,146,197,244,14,125,255,55,140,226,97,25,103,75,149,151,101,132,198,22,243,195,42,143,0,116,128,133,234,144,7,215,56,42,116,153,159,4,17,89,16,239,160,39,16,198,80,40,235,71,132,9,138,60,218,94,119,29,149,59,90,39,60,47,237,142,77,105,45,52,120,147,209,192,33,46,167,19,85,200,165,195,65,226,6,142,98,6,97,190,31,44,62,146,126,173,163,103,97,30,245,52,105,109,187,148,60,194,148,111,244,249,41,42,211,204,202,95,233,241,40,78,255,201,244,7,219,25,138,28,113,254,49,205,96,33,191,24,243,154,170,32,39,98,149,187,105,216,99,198,
-89,128,51,163,44,218,180,119,35,105,27,31,34,152,154,228,145,180,204,178,188,180,232,140,150,7,75,103,148,144,155,125,202,76,57,165,39,155,76,120,120,139,225,188,75,88,56,49,167,177,1,199,169,19,20,176,6,51,204,184,99,26,226,1,43,217,124,34,236,128,155,255,212,237,59,150,197,19,198,231,160,103,207,222,39,61,57,57,216,16,132,231,130,30,251,54,242,68,212,67,25,182,23,250,10,113,223,104,141,209,222,137,24,185,189,94,141,243,79,89,152,228,120,94,50,30,252,153,194,151,108,31,6,154,224,232,95,151,110,186,240,38,252,45,170,131,78,81,253,126,22,212,1,233,248,104,149,2,175,135,73,149,33,83,238,161,229,104,192,56,115,39,17,99,179,131,137,45,224,70,39,73,184,53,130,135,74,16,87,40,25,108,58,206,11,203,254,28,138,75,118,189,41,221,234,251,80,35,156,206,55,197,5,189,223,215,5,218,150,18,222,69,139,100,23,141,73,128,98,23,188,106,37,139,118,122,133,63,51,211,151,144,24,18,25,131,52,200,97,2,13,180,176,68,132,161,218,23,64,115,155,134,155,114,103,120,19,195,196,6,6,168,158,101,84,35,85,205,4,94,189,35,85,146,8,195,124,152,97,217,247,48,128,57,6,152,106,81,6,211,150,227,35,220,99,166,89,193,16,248,235,157,232,187,56,101,50,144,139,116,71,210,226,118,59,208,4,166,85,69,10,70,253,167,63,181,44,25,192,253,27,76,243,187,211,237,94,151,105,177,238,250,12,250,141,139,4,232,117,118,128,101,5,134,224,132,153,205,116,156,246,21,93,68,228,18,194,170,162,125,129,73,181,22,201,101,164,66,56,127,0,134,218,4,139,213,121,59,84,172,46,186,251,227,125,38,32,85,153,57,82,148,23,205,80,225,14,120,61,221,200,169,20,160,192,36,45,218,193,49,139,14,93,222,89,110,162,109,179,16,22,198,127,82,19,68,48,182,118,123,184,190,222,70,77,228,71,233,228,136,17,207,26,35,52,62,50,155,37,155,1,245,1,24,117,108,76,7,63,36,221,13,99,144,240,38,220,75,168,215,93,178,87,202,237,88,98,122,17,101,228,224,19,212,195,89,0,252,182,71,35,197,169,1,41,79,188,4,103,11,27,28,50,178,85,131,179,252,244,116,21,157,210,253,238,214,121,205,46,202,110,34,220,218,89,132,204,110,210,138,209,77,176,159,80,87,100,194,5,126,69,6,173,189,87,84,102,165,165,73,212,222,71,40,144,206,215,133,142,244,86,229,70,131,87,213,215,163,90,148,255,171,146,8,64,200,89,18,125,193,141,163,161,13,252,231,111,94,0,188,80,240,82,88,115,73,214,192,229,209,215,180,54,96,65,190,172,194,238,192,22,178,146,82,102,27,100,246,155,68,109,136,246,155,162,221,30,22,160,53,165,210,37,57,153,255,227,220,224,20,151,227,121,64,137,146,30,74,181,178,69,80,159,28,236,126,27,45,112,203,125,96,146,71,21,161,101,57,177,181,222,221,11,3,90,166,220,171,136,138,174,184,125,8,171,90,116,243,94,108,109,62,156,157,157,117,4,215,181,56,178,97,157,28,147,249,87,190,37,59,62,233,93,185,80,37,115,134,242,145,18,186,51,72,54,252,49,10,110,112,26,65,246,191,54,1,204,135,97,93,117,38,169,40,140,124,140,156,71,173,32,33,22,58,128,88,221,202,69,79,115,146,202,115,10,152,17,189,219,106,175,178,244,55,146,220,142,68,141,19,118,76,190,32,114,91,81,17,245,140,59,92,181,42,162,222,204,129,234,82,149,188,28,172,159,223,22,147,234,195,223,147,234,131,51,76,170,127,189,157,38,127,179,218,142,212,103,70,242,54,130,181,0,146,70,116,79,38,117,56,142,89,176,238,206,0,200,60,245,190,34,255,238,42,129,213,2,247,26,217,129,108,109,153,182,213,128,162,151,99,109,144,193,156,216,6,25,208,137,109,144,65,157,216,6,25,216,137,109,144,193,29,110,131,187,155,81,78,150,91,123,209,245,236,142,14,110,61,199,59,99,243,30,170,196,135,112,123,19,173,178,144,93,138,194,116,104,191,122,88,220,196,155,214,9,212,26,154,108,121,66,159,185,159,190,254,169,172,221,59,7,232,29,183,144,130,160,35,204,180,138,248,58,174,207,66,90,59,133,229,195,79,248,0,93,179,233,79,22,151,69,188,139,154,28,139,42,147,33,142,216,229,103,85,190,105,131,8,37,96,181,227,213,53,
-64,181,232,173,132,75,218,97,29,14,122,136,101,249,59,192,20,111,154,42,149,150,11,95,122,50,30,4,175,174,97,94,27,228,7,88,67,226,25,58,113,203,234,97,207,224,221,171,23,167,73,188,61,251,38,96,117,138,138,245,109,87,169,251,50,253,131,124,110,105,133,165,81,83,174,102,173,188,83,148,15,43,160,123,12,241,181,178,100,76,30,7,127,125,18,220,7,127,13,86,103,107,152,19,183,56,18,86,63,255,132,153,87,71,161,59,242,199,119,236,44,225,187,150,61,148,213,112,68,26,213,126,196,125,229,122,160,74,126,134,241,202,49,97,167,149,240,67,107,35,217,145,188,63,214,30,73,202,33,43,54,24,213,162,197,211,239,233,119,52,159,48,78,246,7,152,73,147,135,67,72,42,35,249,162,251,252,228,158,183,81,205,161,88,144,136,133,251,99,177,191,125,200,201,102,9,254,204,223,154,33,150,209,29,118,118,18,20,23,172,28,82,188,47,168,90,98,61,130,154,143,130,116,189,62,100,244,200,233,172,179,118,221,246,199,20,150,219,95,170,105,224,45,128,81,253,189,141,81,56,126,71,255,11,99,21,179,211,204,110,40,160,141,159,179,199,20,248,5,217,33,110,156,54,39,52,69,119,87,58,57,39,113,78,159,162,75,200,38,241,43,50,68,113,94,173,206,78,177,141,104,67,103,150,233,161,16,254,74,13,44,78,142,143,234,246,219,113,163,14,156,68,2,214,16,169,116,124,196,60,124,201,44,33,201,86,58,224,137,112,49,15,224,226,22,198,54,198,224,179,71,235,187,139,182,15,199,71,183,49,121,68,57,42,78,202,103,130,75,221,201,190,55,38,213,224,230,105,69,201,141,104,26,67,64,208,241,17,40,71,4,97,30,100,188,93,210,135,57,112,13,27,226,121,75,142,11,104,226,77,49,217,70,13,22,209,245,117,37,30,55,254,33,124,29,125,91,39,114,158,208,134,113,48,75,189,150,108,196,140,171,231,86,119,123,122,200,7,197,223,130,47,31,149,61,143,25,61,113,2,155,224,164,16,115,238,112,95,125,25,28,146,45,90,3,168,253,132,168,138,122,147,191,142,143,182,241,19,98,96,248,47,74,127,242,24,154,126,10,182,65,158,139,104,159,225,52,207,74,95,215,109,33,146,101,99,4,251,109,140,173,81,37,0,0,242,224,54,52,141,41,53,216,250,57,152,208,219,180,136,154,103,188,27,155,201,15,49,61,233,192,164,38,154,111,67,109,161,218,145,39,137,162,208,103,92,91,209,200,222,218,53,234,236,173,242,124,170,69,165,70,29,236,98,212,193,74,243,38,89,67,178,70,94,57,30,205,150,109,149,100,29,167,14,44,117,19,84,216,241,81,11,71,12,114,52,157,158,85,66,224,203,76,214,83,83,14,159,75,228,185,117,233,46,40,122,56,10,28,31,149,97,32,208,139,2,120,107,0,27,153,84,163,0,62,240,223,132,129,64,57,10,148,30,87,135,129,64,45,10,28,31,245,195,64,160,24,5,142,143,186,97,32,80,137,2,224,242,189,48,16,40,68,1,246,202,132,107,78,72,177,28,5,98,232,0,215,225,161,149,34,228,123,125,205,219,160,193,158,61,81,238,186,50,211,198,4,194,76,87,209,67,53,223,221,146,61,203,234,198,155,119,239,131,207,79,95,207,201,162,56,122,84,167,252,54,222,7,183,233,118,147,171,17,160,36,230,121,55,97,83,117,0,44,4,212,254,192,4,236,184,72,6,89,6,250,118,114,40,27,100,191,242,1,238,208,40,248,42,132,153,78,38,62,251,161,207,135,180,10,119,12,241,161,144,38,166,180,72,27,116,234,26,82,121,32,77,185,56,39,161,97,96,87,21,229,67,35,231,231,188,68,195,106,186,95,109,163,49,16,52,217,42,103,77,42,216,167,26,102,84,174,132,15,99,218,162,124,174,233,132,73,87,140,54,157,154,228,252,156,222,94,144,175,163,132,60,211,22,87,151,209,144,62,5,120,84,67,227,60,152,204,17,212,66,202,71,77,105,63,137,130,85,157,242,43,166,10,147,29,160,4,220,162,93,142,57,7,232,193,120,161,13,35,129,172,60,77,132,32,223,64,131,236,139,59,13,57,216,230,23,198,146,241,184,48,139,170,164,131,255,255,14,194,240,128,124,167,61,32,75,102,52,154,65,104,208,26,24,141,37,51,152,205,174,17,155,64,250,255,153,241,74,91,123,27,58,161,231,226,95,161,71,18,69,249,56,116,241,175,56,52,239,136,
-12,143,206,191,130,146,195,193,187,153,28,161,190,251,87,132,210,129,84,62,92,125,247,175,112,229,209,240,12,15,213,191,98,215,244,145,172,135,146,38,249,15,108,5,136,214,253,180,34,127,201,95,62,57,80,237,186,100,233,174,187,205,201,110,1,140,173,189,205,111,107,30,31,49,203,118,249,109,77,98,54,96,21,184,71,139,125,133,145,83,60,136,248,196,219,224,165,250,85,25,105,117,114,86,206,122,28,111,152,134,71,230,92,119,100,164,198,100,116,63,228,248,72,7,217,160,6,150,110,122,171,236,127,176,7,142,89,154,231,123,114,126,94,176,231,159,205,195,201,173,19,208,11,8,50,71,71,11,38,241,112,153,9,2,16,219,50,135,50,46,170,59,9,202,179,217,242,145,228,37,221,79,206,201,227,249,204,83,78,167,208,62,88,83,64,7,226,17,42,250,136,132,140,71,68,195,71,237,125,34,204,175,204,202,148,39,0,151,22,199,218,108,13,34,55,250,29,31,179,67,128,90,123,53,255,76,227,100,209,126,14,59,107,125,202,89,8,114,6,131,101,18,111,175,232,174,116,78,226,120,4,125,129,207,101,166,219,130,41,41,0,14,101,55,120,253,39,124,106,221,243,6,93,153,83,187,74,126,163,225,107,60,220,198,175,120,15,249,182,80,5,27,141,178,57,149,175,21,232,104,79,190,151,235,67,30,237,226,57,187,80,201,103,99,214,46,150,211,157,108,64,79,80,62,221,147,204,191,201,125,168,245,104,93,204,83,132,195,189,168,243,231,241,148,197,245,16,92,66,244,248,223,130,255,124,247,234,237,213,219,151,193,147,39,193,233,119,199,71,139,236,124,153,93,0,185,60,97,161,93,102,32,28,68,46,79,191,235,194,85,203,194,246,202,196,156,178,145,203,99,124,88,168,234,90,43,67,46,217,76,232,237,250,188,60,156,88,95,148,127,148,71,192,229,9,176,242,224,85,250,52,99,247,172,138,152,223,51,103,117,91,18,107,203,3,58,156,96,101,193,105,176,62,15,254,250,203,147,95,225,71,242,159,44,248,54,88,95,180,47,120,77,110,34,94,111,219,207,5,100,23,146,189,159,216,215,90,29,134,191,200,137,181,160,183,231,127,201,46,152,30,119,122,219,234,233,38,190,190,6,158,74,214,145,21,51,230,207,119,26,161,204,211,0,245,119,200,183,213,176,141,133,146,58,123,222,161,246,181,76,78,182,126,153,50,49,164,126,176,136,207,96,102,121,27,110,175,73,198,52,132,205,83,28,71,114,253,83,115,23,32,206,182,217,188,231,95,49,211,153,228,209,135,249,154,174,204,54,100,126,178,46,134,18,39,104,59,188,199,251,233,124,254,45,115,208,247,236,155,203,65,249,173,227,70,235,202,112,239,234,248,168,162,226,141,255,250,14,107,37,17,26,102,26,95,211,154,57,29,108,103,202,15,61,214,117,34,218,61,36,101,217,133,10,189,116,160,136,240,154,55,76,120,33,107,171,235,224,33,61,160,204,179,224,93,117,181,223,242,248,168,188,192,34,10,162,36,61,220,220,214,73,211,248,40,238,154,188,247,163,76,115,193,132,204,228,56,56,170,159,136,15,22,152,68,18,39,119,233,246,174,122,131,8,94,237,113,210,62,170,198,231,36,184,153,186,203,224,129,185,175,141,183,43,138,85,175,56,121,187,116,187,128,60,128,81,63,237,69,150,158,248,84,216,125,80,96,6,237,3,94,66,207,125,183,139,64,35,50,254,15,3,143,245,84,26,13,104,67,159,225,169,159,89,41,154,20,226,74,43,25,77,200,67,42,15,3,143,81,213,216,180,174,17,180,164,141,52,46,87,152,161,111,78,155,195,74,90,161,94,238,95,89,87,168,17,174,201,235,52,17,21,237,216,135,3,110,110,178,214,203,43,14,237,167,141,73,202,53,251,208,2,73,124,134,66,87,173,155,136,24,173,170,59,101,234,139,100,120,151,200,196,73,147,23,221,146,221,122,60,30,128,138,111,146,52,139,174,96,190,146,87,87,99,113,181,73,216,124,16,70,155,190,240,74,193,237,67,173,69,41,37,63,62,58,34,192,17,24,19,124,134,13,119,110,96,130,198,170,241,228,201,167,15,63,191,236,41,126,149,164,248,115,251,241,254,139,95,133,250,166,90,42,147,205,42,70,231,250,22,197,150,202,245,83,32,181,134,97,182,137,147,112,139,119,6,181,245,227,1,10,133,249,35,219,180,194,110,96,179,71,56,61,201,187,56,233,166,246,144,255,178,2,161,
-12,124,199,21,185,77,191,224,117,211,108,2,92,22,144,231,40,216,39,96,195,251,113,25,225,189,72,6,102,23,138,133,84,68,28,222,221,4,139,30,116,236,77,165,207,223,188,192,87,81,65,193,238,181,13,228,65,243,59,178,161,134,27,109,12,96,221,253,192,188,216,68,119,189,91,73,89,41,24,24,176,16,79,6,62,92,177,129,65,10,224,247,184,126,160,185,47,178,37,109,47,37,110,111,66,30,121,157,87,210,142,134,60,137,85,57,158,204,234,55,57,73,123,89,81,123,117,89,157,135,143,201,97,72,188,1,83,188,107,207,119,90,143,243,189,123,245,226,127,232,51,122,173,85,84,245,4,21,74,133,34,229,115,70,97,70,86,192,187,242,26,191,242,128,135,209,64,66,62,251,208,232,252,186,108,59,207,218,114,52,34,143,165,51,51,208,52,201,211,45,61,103,16,171,212,85,224,54,204,133,227,193,62,94,131,2,153,178,253,248,80,94,100,83,158,116,17,177,244,193,174,174,196,155,168,16,75,236,209,59,202,101,106,240,233,157,145,73,47,202,104,36,215,119,230,208,103,251,196,128,51,167,152,220,105,15,42,210,215,162,185,71,130,81,162,245,108,97,53,127,32,135,139,221,71,11,187,167,63,11,250,36,32,179,252,136,238,241,26,18,246,155,91,232,90,202,60,124,88,107,248,211,135,247,164,250,249,229,144,144,101,235,32,208,136,192,139,75,118,26,199,147,121,99,82,102,37,99,92,44,219,162,21,21,190,83,233,249,50,98,91,103,31,31,53,165,206,191,233,34,98,95,181,127,239,154,254,38,77,34,39,230,223,23,228,198,5,56,114,93,185,193,112,151,157,185,194,48,2,179,184,131,60,50,110,92,162,247,8,122,123,149,153,31,118,236,77,3,60,253,74,223,129,21,89,243,244,124,51,111,251,233,167,15,208,198,119,87,173,183,154,252,132,210,203,140,10,20,129,251,41,208,252,55,211,4,99,185,190,224,21,59,103,146,18,188,146,150,189,204,127,139,247,245,138,119,25,174,210,172,184,74,147,43,114,165,34,187,109,203,81,13,165,240,149,67,189,112,24,240,157,32,19,84,99,15,20,166,169,73,238,176,30,87,181,179,201,152,147,93,198,206,3,228,155,201,131,138,141,12,141,106,153,72,193,31,89,121,13,38,97,134,98,248,42,86,218,137,198,87,69,65,67,3,140,34,197,35,220,83,120,116,148,53,60,23,47,32,233,123,46,124,59,191,231,114,84,35,158,203,85,110,62,207,21,168,73,198,117,92,85,43,158,219,83,137,122,174,120,84,93,123,46,15,51,226,185,92,21,103,246,92,145,178,226,17,118,226,185,120,237,79,223,115,91,199,4,115,121,46,71,53,226,185,92,229,230,243,92,129,154,100,92,199,85,181,226,185,61,149,168,231,138,71,213,181,231,242,48,35,158,203,85,113,102,207,21,41,43,30,97,39,158,139,171,130,190,231,182,14,176,230,242,92,142,106,196,115,185,202,205,231,185,2,53,201,184,142,171,106,197,115,123,42,81,207,21,143,170,107,207,229,97,70,60,151,171,226,204,158,43,82,86,60,194,147,60,23,41,222,226,2,27,154,159,40,88,115,154,222,19,188,146,150,61,235,52,125,76,53,191,167,233,218,131,170,48,77,239,143,172,188,6,30,76,211,29,13,176,197,105,186,236,32,107,78,211,93,120,174,141,105,186,133,129,117,56,77,215,30,84,133,105,186,19,207,181,55,77,119,52,192,22,167,233,178,131,172,57,77,119,225,185,54,166,233,22,6,214,225,52,93,123,80,21,166,233,78,60,215,222,52,221,209,0,91,156,166,99,160,176,56,77,143,147,169,130,53,201,190,39,120,37,45,123,86,178,31,83,205,111,178,215,30,84,5,178,239,143,172,188,6,30,144,189,163,1,182,72,246,178,131,172,73,246,46,60,215,6,217,91,24,88,135,100,175,61,168,10,100,239,196,115,237,145,189,163,1,182,72,246,40,206,34,217,67,243,19,5,107,134,140,158,224,149,180,236,89,67,198,152,106,126,135,12,237,65,85,8,25,253,145,149,215,192,131,144,225,104,128,45,134,12,124,3,141,204,32,99,185,190,231,194,183,195,158,11,5,196,238,49,44,91,26,49,142,106,196,115,185,202,73,122,238,152,106,26,3,43,80,147,140,235,184,170,74,158,171,61,168,212,115,197,163,202,120,110,127,100,229,53,152,132,25,241,92,174,138,42,158,235,104,128,107,207,149,83,216,134,231,106,146,189,11,
-207,229,168,70,60,151,171,220,124,158,43,80,147,140,235,184,170,86,60,183,167,18,245,92,241,168,186,246,92,30,102,196,115,185,42,206,236,185,34,101,197,35,60,201,115,81,156,69,207,133,2,98,247,24,150,61,171,231,142,169,230,183,231,106,15,170,130,231,246,71,86,94,3,15,60,215,209,0,155,246,220,240,238,166,149,182,211,190,26,37,226,60,146,217,211,10,154,56,31,26,227,16,95,135,122,19,113,18,155,84,132,87,23,177,16,156,121,79,211,148,170,92,200,171,178,12,194,109,158,150,47,209,202,131,250,213,126,204,8,119,53,180,99,129,136,32,95,235,74,97,145,5,42,232,103,200,0,81,87,177,1,246,244,149,160,14,163,32,203,88,9,21,121,33,217,3,179,86,162,52,10,10,157,153,58,36,163,189,100,239,88,208,141,20,164,145,65,146,239,223,141,176,200,67,124,183,214,95,240,189,87,171,24,175,252,57,17,36,191,246,52,180,52,19,64,57,2,130,149,83,95,56,93,80,233,129,169,9,3,202,28,152,50,40,246,104,220,221,91,183,103,76,50,164,189,170,37,237,211,253,129,190,137,233,47,227,150,180,119,101,74,123,121,228,57,29,24,180,165,253,28,198,180,87,179,166,161,62,141,90,83,247,110,20,93,123,170,218,25,178,168,250,94,19,233,136,196,213,206,142,37,85,162,248,250,15,170,46,178,32,85,237,13,217,80,37,86,108,69,114,189,145,182,157,189,41,227,217,203,89,143,108,20,226,235,103,215,124,246,99,136,43,68,32,101,253,13,27,208,94,198,130,38,69,31,102,218,71,114,169,236,174,157,58,217,102,42,194,77,175,157,64,160,218,172,216,80,46,156,181,181,147,133,84,56,247,107,167,201,32,207,189,118,50,58,10,190,174,157,116,35,133,193,181,19,39,35,185,167,225,87,189,118,114,228,206,243,174,157,38,25,146,161,181,147,192,146,246,174,76,201,197,218,201,165,49,205,185,118,210,181,39,19,107,167,190,29,113,181,251,106,215,78,142,108,104,190,181,211,84,227,153,180,118,18,91,207,222,161,249,88,93,59,57,54,32,167,107,39,146,154,106,119,237,212,73,222,85,17,110,122,237,68,110,120,87,153,21,27,74,45,182,182,118,178,144,89,236,126,237,52,25,228,185,215,78,70,71,193,215,181,147,110,164,48,184,118,226,60,224,209,211,240,171,94,59,57,114,231,121,215,78,147,12,201,208,218,73,96,73,123,87,166,228,98,237,228,210,152,230,92,59,233,218,147,137,181,83,223,142,184,218,125,181,107,39,71,54,52,223,218,105,170,241,76,90,59,137,173,103,239,208,124,172,174,157,28,27,144,211,181,19,121,70,199,238,218,169,243,20,147,138,112,211,107,39,250,158,54,133,89,177,161,103,172,172,173,157,44,60,98,229,126,237,52,25,228,185,215,78,70,71,193,215,181,147,110,164,48,184,118,226,60,233,218,211,240,171,94,59,57,114,231,121,215,78,147,12,201,208,218,73,96,73,123,87,166,228,98,237,228,210,152,230,92,59,233,218,147,137,181,83,223,142,184,218,125,181,107,39,71,54,52,223,218,105,170,241,76,90,59,137,173,103,239,208,124,172,174,157,28,27,144,211,181,19,121,214,210,238,218,169,243,52,170,138,112,211,107,39,16,168,54,43,182,248,172,172,145,181,147,163,71,101,237,174,157,38,131,60,247,218,201,232,40,248,186,118,210,141,20,6,215,78,156,27,11,122,26,126,213,107,39,87,87,27,204,186,118,154,100,72,134,214,78,2,75,218,187,50,37,23,107,39,151,198,52,231,218,73,215,158,76,172,157,250,118,196,213,238,171,93,59,57,178,161,249,214,78,83,141,103,210,218,73,108,61,123,135,230,99,117,237,228,216,128,156,174,157,200,20,205,238,218,169,115,31,136,138,112,211,107,39,40,164,54,43,182,120,91,137,145,181,147,163,203,74,236,174,157,38,131,60,247,218,201,232,40,248,186,118,210,141,20,6,215,78,156,59,163,122,26,126,213,107,39,87,151,75,205,186,118,154,100,72,134,214,78,2,75,218,187,50,37,23,107,39,151,198,52,231,218,73,215,158,76,172,157,250,118,196,213,238,171,93,59,57,178,161,249,214,78,83,141,103,210,218,73,108,61,123,135,230,99,117,237,228,216,128,236,175,157,118,113,82,245,173,236,131,160,119,23,149,237,208,98,45,141,161,145,239,216,54,195,251,78,155,66,139,188,96,46,105,228,53,28,222,127,215,30,17,5,125,219,
-35,80,193,141,229,186,112,67,163,125,128,225,203,120,55,112,137,166,146,38,34,187,24,209,10,7,78,66,51,153,5,74,127,80,76,0,23,222,115,212,11,239,135,129,83,209,68,11,184,240,94,0,92,87,51,41,224,166,90,28,199,174,105,179,87,119,225,118,102,187,19,234,70,2,143,156,126,78,172,79,160,104,120,47,80,210,165,13,10,117,27,0,81,217,18,201,106,86,62,172,46,33,172,198,55,73,154,69,93,109,123,239,58,32,45,127,167,47,10,34,248,96,203,168,64,31,129,222,234,156,124,113,149,164,8,175,52,37,141,137,78,81,120,123,232,121,189,83,52,70,222,235,34,72,179,130,110,10,205,80,81,151,49,67,20,234,197,15,135,29,221,132,38,216,16,123,180,129,57,135,244,224,136,221,131,54,244,29,199,47,200,15,109,188,226,100,27,39,81,112,125,72,214,100,185,197,211,2,100,145,63,46,143,143,86,73,240,253,19,226,227,101,185,101,80,100,135,232,4,126,162,59,67,65,184,189,137,86,89,120,118,29,21,235,219,197,42,89,6,143,255,175,199,240,123,132,219,185,32,249,140,214,236,68,12,94,223,101,195,1,173,220,116,247,13,167,155,99,178,204,4,204,142,34,67,184,79,80,72,51,98,18,41,2,234,238,40,216,49,214,190,173,254,126,8,147,34,222,70,210,74,255,222,76,199,7,212,172,154,229,216,110,245,211,176,245,10,244,106,75,239,217,114,83,107,25,252,174,110,208,85,245,246,168,142,171,34,61,122,85,83,13,42,127,231,162,161,38,221,136,201,247,85,27,30,48,99,42,234,57,65,37,115,208,13,106,205,69,94,80,254,111,151,110,14,80,106,247,91,244,192,244,44,75,11,40,188,184,251,158,60,183,148,128,74,57,62,140,6,122,225,171,142,42,125,222,252,215,203,255,155,150,108,212,216,70,215,197,41,253,50,8,201,67,122,193,234,129,182,128,98,247,97,81,68,96,143,183,97,126,11,205,67,7,79,122,77,226,111,77,131,235,112,187,198,197,43,52,71,106,193,178,118,123,136,56,109,33,110,186,109,117,155,42,34,83,77,229,183,198,180,194,1,48,212,212,245,214,88,83,96,227,166,154,130,86,140,193,94,100,211,13,107,117,216,254,118,69,109,249,234,62,205,174,72,219,183,29,159,88,6,212,140,69,174,81,215,108,36,239,211,188,248,62,248,229,123,248,229,201,175,139,95,190,167,5,225,207,219,178,221,147,101,240,11,86,249,117,177,58,57,97,35,142,164,70,171,206,59,46,56,115,63,84,112,157,38,121,193,107,146,81,53,139,190,15,130,219,128,8,15,242,219,244,176,133,63,162,32,127,72,214,16,108,128,173,110,163,112,115,28,84,255,83,239,218,8,216,76,174,124,15,114,97,199,176,45,210,185,57,59,54,50,102,252,142,73,142,220,220,131,86,178,6,40,215,33,14,210,185,238,188,91,208,135,176,144,117,200,46,91,173,182,233,10,190,14,139,116,87,253,93,41,80,64,95,178,197,9,244,170,146,245,236,245,187,103,228,219,203,186,208,117,150,238,104,49,182,80,249,109,83,108,189,219,147,150,218,109,193,183,151,237,254,158,116,139,224,183,77,153,228,176,221,246,203,224,183,77,153,12,6,164,95,6,191,109,202,124,201,98,224,228,110,215,200,183,77,161,253,161,224,232,12,223,54,69,54,209,150,83,4,190,109,138,108,163,228,166,32,29,99,139,208,111,153,206,71,225,158,211,121,248,150,53,127,24,159,5,204,106,224,63,39,228,223,99,182,48,126,113,69,190,173,205,224,109,154,238,97,2,114,40,96,82,124,246,77,191,37,18,218,249,13,213,35,120,124,220,177,136,56,185,65,94,71,37,2,108,225,184,59,240,109,29,110,162,34,40,110,193,208,30,112,149,139,191,19,233,65,152,131,109,210,230,96,138,29,111,183,199,71,88,236,58,206,242,34,120,76,138,7,105,70,170,226,204,58,189,166,173,64,213,111,46,69,10,45,97,146,180,137,238,209,255,3,129,114,241,230,94,77,183,227,35,60,133,204,0,194,155,32,44,168,94,143,136,152,71,68,237,160,214,250,248,104,80,237,179,150,222,100,4,40,185,6,253,33,160,191,55,138,230,69,154,69,181,78,84,191,110,155,9,24,239,46,199,136,65,236,3,223,154,221,114,18,242,115,211,100,80,117,62,57,236,86,81,134,154,82,24,226,4,190,142,243,186,125,26,27,242,223,183,248,197,247,163,49,226,227,223,95,75,133,
-137,178,92,99,103,245,82,128,74,66,243,164,127,157,84,127,104,155,59,211,36,90,60,175,185,242,59,198,238,219,1,178,121,33,86,180,61,108,48,118,124,127,7,171,141,86,27,229,111,80,154,96,87,23,109,26,195,184,220,117,195,21,227,208,1,183,135,151,66,191,13,196,126,219,237,251,170,7,231,152,48,62,106,193,48,106,109,118,233,140,44,24,64,213,24,227,154,31,63,125,32,214,34,30,72,166,1,116,118,210,198,50,189,190,206,163,162,92,75,117,218,251,20,198,204,62,240,7,186,112,71,99,167,169,30,191,208,186,103,103,201,175,224,222,96,249,181,103,229,191,60,198,111,37,132,46,201,134,30,93,73,116,164,127,60,172,62,146,74,61,21,72,202,67,41,168,210,129,254,247,91,210,220,175,60,101,24,93,190,93,4,91,162,71,144,149,161,163,35,250,121,154,172,67,102,103,148,126,142,18,156,10,20,95,210,178,229,188,229,29,37,67,5,164,135,24,55,217,208,1,109,190,38,191,115,225,164,85,89,165,91,45,39,36,162,136,91,126,134,63,115,27,46,17,40,219,135,144,68,90,106,53,126,72,226,117,186,137,158,22,229,208,52,177,191,47,232,191,159,223,102,79,139,118,224,15,171,22,130,245,109,152,133,107,152,58,31,31,45,48,180,146,181,246,9,229,131,122,48,96,102,23,227,158,18,107,26,101,3,139,47,216,2,223,18,127,132,70,80,58,51,55,75,147,187,40,99,229,23,41,124,168,149,104,71,46,164,158,252,191,99,24,31,218,75,8,42,215,241,125,25,1,226,86,39,223,147,159,26,65,244,51,52,28,173,127,99,181,6,94,162,45,6,37,112,249,225,186,108,19,199,168,211,234,71,242,99,211,42,253,220,180,202,80,193,235,244,75,148,49,163,221,129,130,252,220,50,205,18,135,18,97,128,97,139,69,32,74,230,81,155,45,127,222,239,135,90,38,63,15,183,124,192,34,117,203,13,190,81,152,173,27,36,214,2,67,133,111,63,146,146,12,14,228,115,112,13,100,31,54,126,125,22,80,35,206,33,174,84,22,179,12,78,207,131,248,58,72,210,2,138,31,146,13,219,183,236,74,82,133,15,17,244,41,143,62,246,53,41,127,41,251,162,173,81,131,201,126,27,23,123,176,187,90,167,36,138,54,219,136,254,125,29,71,219,13,111,134,133,48,85,53,25,152,240,171,106,28,48,109,37,218,198,187,24,205,156,209,235,38,190,139,18,218,114,176,32,129,16,75,19,255,75,129,1,90,107,64,104,105,39,182,4,140,187,123,70,58,126,12,190,220,130,192,124,31,174,97,118,19,102,216,223,86,184,170,227,224,112,211,175,241,231,161,166,137,190,196,97,187,1,177,30,236,97,9,31,164,36,148,211,74,110,192,101,218,7,183,190,24,2,233,130,53,160,93,122,23,209,128,158,38,55,81,94,15,24,196,42,96,204,132,142,221,246,161,9,82,165,46,36,84,71,80,106,83,79,77,41,190,205,84,126,24,231,1,45,9,222,150,180,108,190,174,134,107,72,225,76,78,225,15,46,20,102,22,21,93,117,27,128,247,176,2,174,212,5,10,21,120,235,107,40,214,104,251,35,174,101,14,251,86,208,68,41,212,55,75,34,6,246,217,131,6,228,103,248,173,177,205,54,125,213,192,201,41,242,65,93,145,112,47,163,199,32,34,67,166,7,197,47,250,26,117,65,31,131,136,25,214,114,200,90,131,58,134,212,144,169,77,80,176,129,78,66,191,118,134,112,92,28,138,168,156,136,228,25,97,170,229,38,47,200,127,161,219,229,121,75,127,54,92,214,100,39,17,213,119,165,190,233,122,125,200,178,8,83,236,64,149,71,208,248,35,152,242,29,31,61,130,230,31,157,5,193,171,235,235,0,129,133,121,236,38,120,66,142,228,232,42,53,206,241,96,174,252,1,236,0,22,29,180,246,26,166,113,171,136,210,27,93,211,70,88,50,63,108,107,159,9,94,37,176,86,223,192,188,0,112,130,113,3,144,10,44,3,170,228,120,122,72,119,147,152,26,4,167,67,66,25,108,115,124,148,199,127,68,203,82,47,4,20,244,33,254,188,1,214,2,126,189,14,64,19,162,33,18,45,195,201,216,12,116,172,5,112,152,175,227,184,90,30,117,184,159,252,214,155,39,87,211,71,104,12,55,33,241,191,180,249,222,184,49,11,24,26,241,184,203,150,186,104,123,245,244,242,190,64,43,105,150,79,12,249,200,73,170,45,90,44,178,47,142,133,
-171,100,214,172,181,19,67,254,94,146,233,78,105,217,240,159,246,187,171,113,254,91,106,179,229,202,223,119,166,204,108,95,233,111,180,183,172,3,177,75,67,50,23,30,148,144,119,166,207,172,4,250,27,87,66,103,245,137,71,129,18,29,233,46,90,179,248,230,182,144,80,143,141,148,41,174,23,23,249,57,117,242,11,174,61,210,66,77,167,94,147,207,12,161,86,19,77,145,173,240,164,44,25,203,228,202,187,152,32,48,78,114,88,17,84,161,171,54,76,2,74,221,203,14,54,180,78,35,244,21,249,220,240,18,84,133,133,27,184,246,109,148,177,178,32,30,108,129,138,170,5,91,88,180,160,236,8,41,11,107,73,129,168,179,40,177,91,115,71,151,150,105,77,237,81,49,129,41,224,111,76,89,106,85,220,205,46,168,249,190,222,235,98,202,71,251,120,155,222,28,184,21,94,150,191,65,13,248,116,198,182,126,121,116,44,249,63,178,21,73,14,223,177,11,204,62,60,177,166,239,241,63,39,228,223,230,120,228,211,171,55,47,241,155,171,77,203,100,133,123,133,245,78,101,221,4,169,221,219,87,43,119,62,219,165,202,93,207,230,40,238,201,19,60,215,197,135,2,191,148,218,177,203,235,231,111,94,220,133,217,203,191,51,225,225,247,67,8,11,166,7,66,200,95,82,210,106,206,156,201,254,73,162,189,183,47,229,219,251,235,120,115,175,63,41,52,39,161,222,107,5,245,126,24,111,238,39,5,245,126,144,80,239,39,5,245,226,28,211,39,239,132,109,189,250,248,246,213,107,198,230,128,60,11,92,6,32,103,17,43,174,143,229,170,220,145,34,222,69,77,251,184,93,124,102,218,132,72,163,166,237,136,52,106,216,152,104,155,134,45,138,52,106,216,172,104,155,134,108,75,24,244,30,208,54,58,113,143,23,172,72,185,171,226,15,153,144,85,150,21,68,45,242,43,233,14,249,75,221,240,72,53,78,248,146,104,120,216,248,122,13,255,85,182,221,97,3,236,183,43,173,240,107,53,133,127,144,109,247,39,53,133,127,144,86,248,39,53,133,155,88,39,108,113,56,220,81,251,85,136,120,230,205,143,13,125,230,109,144,137,129,230,13,145,13,134,230,173,145,137,138,230,77,146,13,143,230,236,114,100,146,72,138,21,225,110,79,146,201,134,34,102,93,242,170,127,22,221,141,152,77,217,42,102,30,146,60,188,142,2,230,68,232,254,42,218,167,235,219,197,201,247,117,233,246,108,180,41,211,116,244,19,172,100,126,134,239,3,242,61,145,19,44,30,63,254,158,252,63,248,249,211,115,220,59,255,207,48,57,132,217,67,112,190,12,206,255,207,255,120,140,219,226,29,241,35,146,233,30,75,113,213,252,92,43,128,74,157,82,177,164,145,19,88,157,238,247,41,172,147,202,77,33,152,196,199,184,61,83,180,52,101,103,206,84,120,209,8,111,175,227,136,6,164,204,69,204,62,188,33,45,89,40,144,172,102,4,93,230,116,181,58,128,227,180,94,174,182,154,113,102,143,205,74,105,36,181,114,76,218,150,221,210,168,4,238,226,237,54,150,21,219,97,227,250,39,112,30,6,96,181,144,88,87,236,113,178,116,243,67,49,145,219,252,95,85,90,31,10,138,252,214,149,148,127,173,170,252,15,42,173,255,164,170,252,15,74,202,255,164,170,124,197,216,131,173,14,113,118,19,67,165,89,219,158,153,54,220,109,207,86,107,6,183,103,176,13,143,219,179,218,154,205,237,153,110,195,233,230,237,87,249,127,53,225,255,129,251,238,163,124,143,165,198,23,71,180,88,39,141,13,139,252,241,125,37,170,189,133,70,9,128,87,171,238,93,181,189,63,198,30,28,237,154,38,162,117,174,202,120,63,23,49,65,187,126,46,10,216,102,157,69,52,63,184,241,242,50,225,165,73,8,28,99,126,2,252,31,25,70,132,177,117,41,22,26,7,157,148,234,160,183,137,174,227,36,90,236,200,86,45,201,60,0,75,195,127,111,201,191,187,184,60,90,32,122,180,161,192,111,94,68,215,143,217,221,213,34,131,16,182,38,201,148,15,73,186,123,96,44,7,139,179,135,114,29,201,184,207,170,40,249,220,180,100,9,153,23,138,50,91,41,232,52,174,183,163,60,187,201,122,149,31,86,87,96,22,87,160,68,148,1,45,192,132,136,108,122,148,54,41,216,123,237,214,186,250,146,133,251,214,113,32,61,21,169,12,174,180,196,13,125,74,172,167,192,142,167,193,46,167,83,179,1,
-21,90,245,174,160,52,209,131,153,81,146,146,80,87,163,139,221,90,157,46,62,221,108,234,222,145,185,30,175,111,216,134,78,223,122,245,120,125,107,162,11,15,194,38,140,87,178,70,131,212,16,162,125,161,188,190,105,8,133,175,197,125,74,147,226,150,223,190,100,200,228,52,35,50,85,82,170,182,212,214,204,93,67,59,5,196,219,218,85,144,79,213,144,12,207,116,252,250,205,112,252,160,84,172,191,228,209,80,75,218,106,198,129,83,83,173,189,208,29,211,224,162,254,171,211,150,32,158,209,125,146,198,237,201,231,126,219,28,31,148,139,172,88,249,155,182,155,10,162,143,172,38,253,24,52,18,0,75,21,154,8,24,95,95,47,160,222,121,45,20,151,29,23,245,86,81,231,169,64,26,252,232,6,54,86,109,36,85,87,82,182,31,110,64,221,130,85,84,124,137,162,36,120,132,114,30,145,4,15,252,243,226,81,235,8,176,137,169,93,203,147,227,1,106,68,98,195,218,116,30,126,110,248,73,67,30,62,202,223,145,39,136,0,149,216,227,214,51,61,228,232,116,240,228,244,162,125,114,122,19,37,81,86,157,190,195,10,147,199,100,11,114,252,203,107,16,42,72,182,215,74,22,216,94,85,243,150,197,73,223,14,218,37,250,207,247,144,223,155,153,79,156,84,150,216,245,108,50,123,39,165,75,247,166,211,252,214,89,54,51,207,207,163,130,150,102,158,212,225,138,188,196,212,36,220,231,201,131,67,30,109,200,234,122,159,197,52,207,181,181,248,17,104,3,214,95,119,143,163,200,77,95,145,155,137,138,244,108,164,92,187,8,204,176,156,218,247,55,189,152,108,126,234,246,15,251,168,115,248,217,18,243,144,209,148,161,93,74,255,11,62,62,104,255,116,29,195,200,37,159,243,210,222,169,237,47,30,162,48,91,18,111,88,66,123,39,29,111,39,65,164,233,31,39,194,85,129,70,186,151,173,227,142,214,204,190,148,214,236,128,15,9,188,40,255,203,169,47,14,199,184,66,108,42,246,106,150,139,23,154,249,82,46,42,8,194,120,55,220,96,239,197,80,147,190,82,168,111,211,67,150,227,58,229,0,63,45,143,143,74,79,91,146,205,207,242,195,73,176,15,179,112,23,97,234,225,217,55,188,85,238,134,134,190,77,195,64,140,63,6,227,132,63,172,42,179,220,93,16,57,65,45,165,150,161,172,161,188,90,87,176,188,11,15,219,66,74,61,144,192,42,19,44,226,132,227,215,39,67,74,42,104,134,66,59,153,50,67,186,85,39,20,178,26,54,217,75,176,190,172,60,78,176,148,229,56,91,181,101,65,118,28,74,86,227,37,211,226,207,139,50,128,148,59,6,191,149,113,164,50,246,64,40,150,111,58,32,233,197,199,79,52,219,236,47,81,25,172,154,53,116,55,108,179,59,61,162,160,221,235,223,115,81,200,44,27,57,227,240,195,130,153,153,139,4,117,123,196,202,193,140,108,25,33,245,60,123,88,200,85,235,224,67,93,16,29,29,136,75,100,116,150,17,254,75,255,150,146,190,201,11,206,192,213,196,79,31,238,194,8,69,102,155,17,73,56,62,62,34,150,244,211,155,79,100,62,72,198,249,172,158,39,85,26,34,131,52,238,212,59,215,34,84,20,209,220,206,43,44,219,168,81,126,155,147,38,168,213,18,219,89,36,105,242,71,148,165,199,71,132,36,234,185,233,233,191,255,31,255,251,127,252,219,249,57,209,230,219,242,67,203,191,171,141,154,179,82,41,122,65,14,180,89,221,26,138,47,59,31,209,239,10,239,61,96,175,17,69,114,148,237,32,41,204,233,33,249,190,233,34,79,229,74,142,170,206,116,106,220,81,26,124,90,86,101,40,202,81,24,190,101,70,132,167,47,21,161,170,45,212,234,234,74,120,17,200,183,97,11,142,194,148,103,171,86,72,21,142,214,196,128,75,181,31,58,43,185,90,113,42,175,86,157,148,27,210,158,35,186,103,35,148,212,9,228,210,157,40,43,241,172,133,254,50,218,147,70,172,94,95,202,250,221,222,148,115,17,181,222,148,149,56,189,105,45,176,7,122,211,136,213,235,77,89,191,215,155,223,183,87,122,61,106,42,14,244,106,65,238,190,186,198,47,227,52,1,90,111,79,231,70,59,221,210,78,179,227,77,27,125,195,108,148,81,181,206,166,38,215,68,155,159,37,236,180,165,133,174,177,54,141,112,194,29,153,193,179,59,79,129,120,75,134,78,236,152,144,68,247,74,186,115,79,54,
-24,54,243,248,102,194,120,196,157,206,241,214,52,236,206,92,112,199,206,215,213,116,84,211,45,12,242,125,180,142,175,227,117,75,185,246,170,178,11,89,33,161,75,49,12,86,161,133,84,91,151,101,7,37,57,181,228,212,193,109,142,16,214,95,131,224,228,81,241,169,154,123,37,48,129,31,156,181,246,246,87,62,97,166,64,217,12,125,62,136,43,3,231,204,56,53,91,180,214,112,156,249,55,157,203,213,14,95,180,158,36,46,191,166,179,251,226,54,44,130,13,174,55,32,186,3,187,28,213,15,114,226,44,189,6,162,139,127,132,23,188,43,43,18,177,151,3,14,171,81,62,158,57,168,68,197,103,45,37,122,145,170,173,130,136,69,217,13,206,146,78,81,167,227,35,226,45,116,183,11,159,90,195,43,38,130,47,128,16,76,115,91,131,67,231,99,69,57,199,230,232,65,214,68,195,19,63,118,222,215,59,201,132,249,147,108,235,188,57,90,51,69,235,182,12,147,229,223,84,90,47,203,247,37,148,63,240,165,52,131,37,137,144,104,160,90,179,157,230,236,181,179,204,128,134,113,118,158,47,200,154,128,110,49,144,133,67,117,105,164,120,215,153,148,226,239,130,147,232,16,94,131,153,214,199,251,199,71,96,50,164,10,190,211,32,207,227,213,246,33,72,240,94,206,248,174,189,155,80,111,104,183,116,162,95,141,42,213,221,154,30,209,10,44,245,248,168,220,181,30,87,11,6,173,173,20,126,49,170,18,22,82,131,9,107,140,169,195,158,94,20,205,209,197,192,202,68,230,208,130,232,122,36,123,106,241,144,94,171,44,83,235,10,221,39,75,243,224,109,240,229,22,86,199,193,6,163,7,170,244,22,252,27,157,231,168,124,80,152,172,101,23,255,172,18,82,235,215,128,157,159,116,60,84,77,165,166,70,95,39,242,160,55,252,94,193,83,146,45,22,238,4,156,244,26,203,41,193,128,21,248,34,203,156,89,18,135,202,206,147,194,71,20,161,243,39,96,174,240,219,50,56,59,91,6,255,241,36,63,224,167,214,131,189,155,77,43,77,138,156,68,209,13,149,64,234,228,146,111,36,13,207,19,18,130,50,16,92,30,145,182,31,29,31,113,172,181,180,236,71,196,97,30,241,109,151,157,191,161,1,179,147,166,222,169,75,163,164,212,249,27,59,211,150,53,233,154,170,57,179,37,54,195,172,163,79,156,228,241,166,179,27,84,222,222,12,163,134,79,82,18,134,190,77,183,155,188,126,54,188,217,37,194,167,47,215,81,134,87,52,4,251,20,55,174,112,224,113,138,223,190,66,127,183,199,199,225,179,114,175,138,88,162,48,250,148,165,175,232,206,102,154,181,109,188,252,181,137,66,229,230,38,153,100,144,57,46,125,62,24,107,81,218,104,241,55,160,188,32,127,148,151,66,245,12,158,238,158,144,205,221,214,142,99,101,232,148,192,203,193,250,229,252,244,252,226,215,246,245,71,120,77,86,70,78,231,98,136,74,41,152,26,62,210,190,11,139,53,222,141,249,208,98,76,162,17,204,37,75,149,250,215,34,49,42,21,233,160,66,225,46,106,103,165,53,150,67,181,92,146,148,60,208,235,36,32,79,200,126,137,243,238,244,3,193,193,205,95,1,52,184,85,35,6,166,21,138,81,230,127,84,192,224,148,147,62,203,47,137,11,170,130,168,84,7,90,28,76,80,23,17,34,40,127,4,143,255,16,194,209,73,57,120,72,210,228,97,151,47,194,237,54,253,66,110,109,232,156,32,149,5,152,35,108,44,25,84,223,211,236,96,124,70,62,196,139,135,224,19,244,152,112,55,26,239,95,106,71,236,44,3,50,236,92,115,150,184,44,43,150,35,211,247,25,166,6,103,87,151,89,242,212,251,229,203,224,144,87,151,130,148,11,31,122,200,137,250,45,242,40,130,161,73,176,236,158,108,16,244,14,225,41,248,213,217,78,91,63,206,104,213,53,56,234,117,47,110,161,45,74,170,119,221,83,175,196,162,57,169,236,161,199,59,9,108,42,9,182,197,13,2,88,62,74,88,3,88,230,112,12,99,200,84,146,192,144,182,104,2,67,38,29,183,163,162,128,145,187,117,5,120,50,199,99,198,64,173,30,56,42,145,101,56,122,28,91,182,174,61,128,89,62,194,9,200,98,195,166,201,178,39,205,57,231,234,117,194,6,88,173,127,172,78,124,28,201,17,120,57,41,72,250,12,59,143,248,70,116,188,61,124,170,206,100,229,150,27,60,212,23,200,30,39,30,
-201,68,27,70,40,103,163,139,233,216,200,249,189,65,73,77,30,144,88,222,119,170,242,154,217,76,247,209,48,133,167,200,46,123,173,144,32,207,75,217,96,11,92,114,133,47,4,61,100,203,92,118,206,229,134,159,57,107,252,0,11,95,246,182,62,228,234,146,210,221,125,13,185,170,80,246,178,115,14,36,91,149,148,22,109,29,73,40,77,203,95,246,14,61,100,27,40,203,95,114,207,25,164,27,105,234,92,242,247,236,229,251,211,84,234,26,1,179,35,209,111,2,85,224,141,254,104,37,206,176,55,235,183,126,28,195,42,156,225,102,170,112,165,8,134,121,172,154,112,120,199,42,54,16,118,30,32,197,138,11,65,124,238,228,150,97,92,41,231,197,176,66,33,233,149,244,57,17,152,152,159,226,243,169,103,253,100,67,209,133,50,68,198,190,119,165,140,240,62,153,242,89,210,250,70,25,122,0,51,126,225,114,55,145,45,16,38,178,117,246,236,55,76,134,100,192,191,91,230,114,236,196,33,80,56,113,224,102,28,119,159,30,10,212,159,30,226,39,45,7,227,73,203,50,185,69,129,100,110,145,228,99,77,130,230,120,181,25,123,31,213,134,60,30,54,146,253,23,12,101,255,245,89,122,211,203,230,11,212,178,249,218,217,213,193,64,58,159,212,89,96,160,118,22,216,122,11,5,207,99,10,122,122,89,55,84,191,137,130,164,68,168,156,164,117,143,52,89,115,98,146,44,130,174,64,217,180,181,178,125,129,125,213,103,176,242,2,68,237,237,154,6,241,117,28,242,13,226,115,7,130,115,93,78,123,213,249,177,56,195,179,163,97,99,23,194,33,227,181,56,106,35,149,206,189,247,135,132,5,8,70,138,60,58,62,106,238,50,140,147,197,61,251,146,53,230,245,203,193,241,17,243,96,104,190,142,49,9,235,10,126,198,87,47,95,97,213,75,126,75,215,219,162,105,9,63,136,91,130,95,171,150,152,182,214,105,174,171,21,84,189,228,183,164,170,21,109,137,105,171,8,181,177,42,194,22,86,76,75,170,90,209,150,154,182,244,161,106,35,165,15,84,23,39,125,147,106,91,148,190,65,117,237,73,127,224,218,227,166,63,108,156,81,187,213,31,182,219,75,126,75,234,3,119,219,29,185,91,253,161,187,189,228,183,164,62,120,183,221,209,187,213,31,190,219,75,126,75,234,3,216,214,42,11,241,149,131,186,190,87,214,190,20,182,167,168,94,211,94,211,226,38,186,201,162,72,87,195,178,246,165,176,61,69,13,155,246,154,22,163,251,189,166,118,80,243,146,219,142,162,86,180,157,166,37,88,166,104,106,4,53,47,185,237,40,106,68,219,105,181,116,254,88,95,167,243,199,151,130,182,212,245,34,109,49,62,254,123,86,232,70,11,168,122,201,111,73,53,90,208,150,152,120,184,210,214,10,171,94,242,91,82,141,172,171,174,86,81,188,213,213,10,170,94,242,91,82,213,138,182,212,180,117,29,174,116,195,3,86,189,228,183,164,168,85,217,18,211,214,54,77,51,93,181,176,238,165,160,45,85,197,104,91,199,71,213,85,42,215,48,147,102,245,90,62,208,23,129,10,116,131,175,223,188,123,145,199,55,73,136,176,243,90,65,37,160,21,242,102,82,129,86,157,86,218,147,200,11,5,117,216,238,173,115,58,147,188,64,208,46,5,109,74,40,199,111,243,122,91,112,53,5,89,208,94,51,172,99,154,98,139,216,242,144,166,32,171,106,147,12,239,152,166,237,54,187,154,238,211,47,19,16,133,218,29,45,153,246,52,208,196,246,248,26,234,34,41,210,80,23,197,90,67,238,114,179,220,160,104,238,23,91,157,51,91,7,203,213,5,103,35,97,21,51,121,215,212,252,217,155,155,202,11,245,159,157,7,127,13,158,93,180,46,47,27,104,156,125,233,180,150,160,206,11,165,243,234,141,210,140,116,86,220,93,181,225,166,34,9,4,125,30,107,114,66,71,176,249,241,110,148,98,86,218,35,243,25,241,26,107,82,191,27,164,121,81,55,184,198,64,247,80,24,123,40,211,252,13,218,155,64,132,75,171,43,37,222,49,79,84,152,177,189,110,195,78,44,144,74,90,77,25,49,190,29,114,27,118,103,141,205,30,95,109,44,253,109,191,233,22,57,40,198,157,85,50,50,239,90,123,223,38,44,147,223,184,3,235,108,100,173,166,141,32,207,66,7,26,183,110,165,79,116,233,249,37,215,82,158,116,172,243,137,9,130,22,139,26,29,186,39,170,20,253,
-146,103,35,79,218,214,248,100,10,73,139,4,72,116,69,145,166,95,242,108,226,73,219,250,158,76,33,106,145,0,53,171,211,160,106,117,219,155,72,214,102,44,80,133,174,21,237,80,151,176,39,90,163,50,101,203,219,228,36,210,54,97,153,218,180,173,106,157,70,136,219,132,133,170,83,183,146,149,78,35,239,73,150,170,73,223,178,214,106,128,192,181,45,246,7,77,2,255,137,59,213,251,161,109,165,63,24,160,111,177,160,177,161,251,65,145,188,121,146,64,208,231,177,38,39,116,4,155,31,239,134,26,113,255,196,155,204,253,208,178,186,31,38,208,182,168,121,37,75,83,39,109,101,123,155,70,217,70,172,78,129,176,213,108,79,147,174,167,89,160,42,89,75,219,225,20,170,54,96,141,186,68,173,104,145,38,104,218,128,85,42,147,180,138,101,78,162,232,41,214,169,71,208,146,22,58,157,158,245,173,84,119,125,253,19,119,66,247,67,103,22,249,131,137,245,245,128,168,209,161,83,93,95,243,100,161,168,207,163,141,78,232,12,17,32,209,21,69,154,230,77,217,126,104,207,14,127,152,178,190,22,10,80,179,58,13,170,86,183,189,137,100,109,198,2,85,232,90,209,14,117,9,123,162,53,42,83,182,188,77,78,34,109,19,150,169,77,219,170,214,105,132,184,77,88,168,58,117,43,89,233,52,242,158,100,169,154,244,45,107,173,6,8,92,219,98,159,232,50,56,251,6,165,198,100,158,116,236,244,137,9,6,31,16,53,54,124,79,84,25,156,39,11,69,125,30,109,116,66,103,136,0,137,174,168,49,56,71,210,103,130,218,104,163,250,93,161,2,212,172,78,157,193,53,108,111,26,131,27,178,64,5,6,87,181,67,77,6,159,106,141,170,12,174,96,147,83,24,220,136,101,234,50,184,178,117,154,96,112,35,22,170,204,224,106,86,58,137,193,167,89,170,30,131,75,91,235,116,6,215,183,216,63,233,50,248,91,238,164,239,79,29,59,253,147,9,6,31,16,53,54,124,127,82,101,112,158,44,20,245,121,180,209,9,157,33,2,36,186,162,198,224,111,121,211,186,63,181,237,239,79,83,24,92,40,64,205,234,212,25,92,195,246,166,49,184,33,11,84,96,112,85,59,212,100,240,169,214,168,202,224,10,54,57,133,193,141,88,166,46,131,43,91,167,9,6,55,98,161,202,12,174,102,165,147,24,124,154,165,234,49,184,180,181,78,103,112,117,139,237,189,248,178,125,37,162,4,171,11,222,3,128,213,201,19,211,141,70,47,234,23,78,84,47,189,205,163,34,167,55,104,20,157,27,171,89,225,82,46,132,143,140,15,93,206,40,173,75,251,234,182,126,242,61,125,233,61,115,245,57,124,113,182,141,146,155,226,118,17,148,195,4,95,253,26,112,1,250,248,233,3,230,34,144,226,189,177,34,55,103,147,159,80,145,144,121,175,75,87,94,178,122,192,219,81,100,229,61,123,104,93,200,203,136,43,175,191,42,165,198,73,64,26,230,137,44,210,215,233,151,40,227,203,196,15,221,62,98,233,254,139,80,66,230,189,46,91,44,2,86,217,190,176,176,150,247,243,126,175,32,143,148,30,150,119,192,34,181,188,158,192,44,222,73,75,251,8,165,217,151,12,226,71,124,177,24,128,183,15,215,248,174,160,44,61,144,119,169,244,95,206,83,217,140,146,192,215,88,122,72,32,185,193,172,190,3,124,64,110,166,36,247,131,148,220,242,210,239,33,147,237,73,93,6,249,5,254,49,10,243,197,213,58,77,216,139,76,169,18,235,219,16,175,105,192,247,45,149,23,225,210,59,125,170,1,47,71,0,127,184,142,179,188,40,191,207,165,134,66,70,57,50,36,154,202,181,71,75,70,199,76,75,199,15,83,117,44,71,150,171,161,220,16,203,251,211,5,62,251,164,168,101,110,96,156,229,29,80,79,67,99,131,45,239,177,19,20,85,25,241,237,62,220,116,212,36,111,231,30,4,18,234,116,13,242,125,22,237,81,46,27,88,32,96,55,12,69,62,102,81,184,190,37,95,210,187,128,41,107,157,5,159,178,67,178,174,222,159,89,149,79,105,15,179,248,230,182,192,171,105,225,67,156,149,85,114,188,212,123,27,102,55,17,94,226,26,38,253,54,57,67,162,209,213,15,156,174,62,221,123,215,83,169,81,173,231,22,163,99,219,178,188,41,35,155,219,232,112,46,59,182,82,29,254,208,235,240,132,241,181,215,95,89,191,149,162,61,168,91,50,138,200,141,251,
-92,82,66,208,10,40,210,134,222,174,229,202,177,165,232,85,140,69,105,7,126,67,161,230,249,242,214,65,158,180,182,99,27,185,61,68,212,67,131,188,141,112,16,49,100,33,182,1,81,138,29,114,83,41,198,107,184,100,193,153,154,124,173,1,68,110,202,38,2,68,100,34,249,215,30,69,20,236,4,61,199,142,149,248,23,74,20,172,165,7,139,41,91,113,29,79,200,194,40,255,239,184,184,93,176,216,236,179,232,58,190,111,190,56,225,236,122,82,60,222,147,146,45,251,128,207,176,218,137,214,191,113,134,97,88,30,185,3,117,88,210,186,67,107,45,97,93,105,48,36,84,86,103,49,119,184,110,245,46,224,238,234,150,107,99,82,150,89,204,145,207,194,254,13,75,100,201,74,40,171,213,195,174,184,30,158,81,152,173,187,210,214,114,27,147,240,251,71,82,157,17,71,62,147,247,107,132,160,244,170,220,81,10,170,183,128,236,211,60,198,55,112,46,131,211,115,52,64,124,219,200,53,238,0,240,134,154,175,26,139,193,144,82,109,24,166,232,213,11,5,87,83,80,251,192,129,237,67,116,23,225,155,72,114,131,240,9,181,28,1,240,3,31,65,35,42,246,189,25,43,87,135,67,68,65,250,174,191,254,85,183,156,80,250,41,140,183,220,125,241,2,126,8,242,95,104,83,103,103,201,175,236,246,38,252,240,24,191,227,6,23,145,58,244,133,55,67,138,116,192,82,215,165,167,76,133,109,55,20,96,4,100,153,7,223,219,185,137,238,165,32,171,27,101,35,68,249,85,80,94,157,11,131,87,190,66,227,23,34,107,73,254,253,150,146,192,175,202,154,146,185,20,213,16,81,60,62,26,87,174,19,193,166,234,119,72,226,117,186,137,158,22,45,202,8,4,168,113,92,226,191,159,223,102,79,139,246,253,241,97,80,54,219,108,204,5,11,250,130,118,98,44,173,215,79,213,94,193,49,186,65,237,24,187,19,234,213,66,107,154,106,220,145,141,139,67,17,181,148,203,51,18,69,150,155,156,188,188,101,9,83,58,242,22,38,241,6,113,221,78,127,104,201,215,229,60,37,93,211,215,100,208,131,189,71,32,231,81,176,122,56,62,122,4,146,30,157,5,193,171,235,235,0,231,143,48,187,217,4,79,130,34,59,224,44,39,198,169,203,241,81,253,195,151,219,120,27,149,181,215,208,233,85,68,35,80,253,170,52,208,12,95,45,82,133,174,87,73,144,102,27,156,246,164,120,195,63,204,120,10,44,3,170,228,104,107,228,30,82,182,6,57,105,60,36,219,120,23,131,184,227,163,60,254,35,90,150,122,33,162,248,198,210,100,251,16,108,200,235,75,65,101,208,132,104,136,177,144,9,154,228,240,52,47,90,71,149,199,97,1,131,179,95,103,204,93,233,196,20,22,251,176,248,30,191,7,191,226,188,11,236,253,243,15,47,73,185,6,221,242,45,94,65,121,76,189,44,95,114,72,223,238,21,109,234,129,15,22,16,203,31,227,155,229,146,38,90,183,222,226,67,106,84,111,27,218,151,111,236,105,189,192,14,197,147,82,204,220,42,202,182,193,243,116,7,229,227,21,140,199,135,232,230,0,211,203,224,229,253,30,171,160,224,234,0,157,212,36,167,62,55,97,156,228,205,185,31,171,68,44,167,69,220,81,227,121,152,71,91,242,163,97,125,176,157,122,96,136,78,162,113,169,74,54,74,189,78,97,130,142,18,91,91,245,239,223,125,124,245,63,106,74,128,209,109,195,117,4,35,24,223,196,9,81,163,82,7,127,34,127,92,111,195,155,242,245,0,236,59,150,80,179,178,250,213,151,44,220,179,236,69,190,13,174,194,237,246,170,52,23,98,243,255,248,166,84,238,31,223,160,47,253,227,27,42,22,95,206,4,223,144,44,133,127,124,83,182,137,77,253,227,155,179,227,163,224,61,196,160,29,190,99,24,126,36,186,64,217,112,189,142,246,228,157,203,248,254,53,162,96,240,40,126,180,12,30,237,240,159,28,254,33,239,84,188,127,132,45,4,193,163,232,209,247,56,155,192,161,138,144,80,192,173,163,221,190,120,168,162,24,248,28,174,192,99,112,99,48,109,112,228,21,190,31,234,46,220,198,165,249,210,102,226,78,51,8,62,245,147,116,31,101,36,185,2,58,134,135,204,167,128,121,148,160,135,220,65,17,8,166,160,200,209,187,234,165,116,203,186,88,175,16,138,217,73,137,217,65,72,137,79,183,113,210,170,155,75,213,253,199,55,155,180,56,
-133,1,250,199,55,164,218,167,230,109,87,212,180,242,218,182,16,221,94,28,252,199,55,248,22,44,140,39,225,62,102,218,192,210,176,222,43,200,57,211,46,124,192,74,85,96,165,10,190,77,233,187,249,234,82,100,177,8,3,180,108,143,96,53,128,65,152,193,80,224,251,247,162,82,114,105,4,180,57,246,93,165,165,233,108,234,247,142,65,96,34,83,200,218,8,137,254,20,19,106,123,225,150,119,106,205,186,5,187,74,228,185,6,179,104,108,49,23,235,31,184,92,71,31,97,221,31,160,187,250,253,144,54,47,100,233,58,23,249,177,55,39,12,201,111,181,151,87,155,134,248,14,212,170,147,216,59,88,135,31,72,189,232,30,8,124,251,208,126,21,225,239,219,11,148,95,135,158,40,95,243,117,168,74,242,82,43,62,254,253,117,176,141,127,139,106,93,136,3,55,171,126,104,52,220,179,115,8,136,107,105,71,255,150,90,162,183,227,16,168,226,36,102,152,255,21,124,138,193,57,255,136,200,175,36,253,14,254,219,122,5,14,243,218,187,51,131,113,142,125,181,237,246,38,90,101,225,25,162,208,33,150,101,80,99,10,12,19,176,141,97,233,239,46,101,26,225,215,189,232,215,5,218,189,82,83,2,106,8,244,16,180,37,108,130,163,78,172,166,75,44,208,36,150,82,35,30,192,36,86,6,37,30,64,37,150,133,165,82,137,73,28,43,219,105,79,145,59,67,207,204,222,57,186,86,123,54,181,176,103,79,63,85,38,113,169,212,234,72,99,23,220,214,24,179,208,211,179,52,23,245,198,199,219,228,107,28,79,82,55,22,42,27,235,104,26,15,35,27,79,133,54,30,196,54,214,4,183,54,100,94,176,194,121,241,186,104,237,118,4,76,166,106,191,7,75,50,227,137,111,146,52,139,80,34,206,194,138,152,172,252,130,166,222,113,55,222,81,57,23,236,102,28,126,129,115,130,224,54,10,55,1,121,163,119,222,158,11,199,201,254,80,96,79,200,78,19,172,232,232,94,247,241,17,217,79,33,53,112,206,247,143,111,80,2,76,40,27,218,90,0,175,157,230,197,195,54,58,169,153,141,92,122,158,102,248,210,243,178,33,70,50,93,117,214,89,53,68,64,169,75,185,21,79,148,57,62,2,109,96,206,242,138,104,6,178,195,96,3,115,191,232,20,91,130,57,11,252,10,19,150,67,33,252,149,242,107,156,64,31,42,49,93,69,168,84,97,223,129,28,233,220,238,54,222,211,183,127,159,209,89,91,41,22,171,128,232,60,205,112,25,156,50,253,33,237,183,200,122,204,18,48,221,120,216,24,20,6,255,59,142,224,216,137,228,115,19,93,86,144,247,239,70,122,170,32,240,223,4,29,252,103,26,39,139,45,35,45,99,254,174,144,204,183,140,248,60,99,62,36,241,246,170,156,143,18,87,143,242,2,87,214,17,121,209,91,176,96,74,50,185,237,181,138,175,95,253,215,75,84,160,241,249,255,76,227,86,206,50,84,10,94,55,51,206,202,81,241,235,15,199,228,235,116,143,166,14,243,251,58,241,157,228,189,231,193,199,215,196,159,63,126,40,119,1,171,186,229,124,181,20,240,242,227,243,99,146,140,158,146,53,52,9,93,1,179,88,195,190,157,29,127,34,171,14,178,183,3,142,131,153,228,48,41,189,73,34,186,3,70,245,131,174,145,224,84,47,200,179,244,75,206,245,165,120,118,224,95,249,138,124,107,53,109,3,251,81,232,109,219,250,185,150,65,88,55,132,243,254,115,16,59,124,103,6,243,236,8,126,60,110,182,157,182,103,100,99,98,191,141,238,23,80,138,174,173,214,116,209,21,126,31,38,15,103,103,103,39,229,127,155,135,54,158,190,125,245,227,187,215,47,178,104,23,238,223,84,245,153,118,169,32,43,77,147,118,195,36,190,6,70,236,53,27,52,237,18,152,224,195,175,189,166,35,228,71,242,102,207,62,86,5,35,41,137,190,84,17,28,218,185,186,248,181,213,46,124,102,90,254,180,15,215,236,51,43,209,53,110,244,132,193,155,40,187,137,130,167,121,158,174,99,186,9,248,41,196,253,200,5,84,57,57,11,126,196,105,209,10,170,86,7,255,216,76,185,245,3,133,143,201,54,109,185,231,141,175,135,221,130,191,176,79,175,97,241,5,213,102,76,185,207,100,222,213,168,248,6,16,200,202,85,57,74,134,98,193,2,156,143,206,207,78,170,245,63,204,50,122,2,53,65,225,73,20,75,121,149,172,51,178,175,216,22,
-183,220,199,209,58,42,223,190,58,32,182,174,222,78,70,193,237,169,184,250,9,130,30,190,38,30,139,203,74,95,179,159,76,43,208,177,198,109,152,220,28,194,155,136,81,13,77,160,218,129,106,237,186,60,127,243,2,127,251,216,57,238,123,89,154,58,90,226,211,215,245,33,80,150,222,100,225,238,140,121,170,141,52,188,163,190,36,110,254,199,67,66,78,228,46,187,10,49,169,31,188,122,48,188,92,157,74,69,64,175,52,163,251,133,196,20,88,197,242,244,144,173,163,133,64,41,116,229,31,227,45,179,227,69,29,142,78,172,161,202,97,77,183,71,27,9,116,213,177,141,26,82,44,95,214,206,194,210,125,211,116,22,198,121,180,216,229,55,229,166,63,158,170,179,122,144,223,153,221,63,252,72,118,173,239,113,231,27,221,126,27,174,34,244,94,88,149,160,220,176,222,191,13,118,208,6,140,50,138,237,72,13,243,60,202,138,197,29,97,4,64,99,199,1,1,134,149,22,123,22,23,226,6,242,219,241,6,62,222,14,52,128,231,186,99,13,188,74,6,26,0,30,27,109,224,53,190,236,88,216,5,48,205,209,46,224,3,127,162,6,160,198,104,3,239,226,77,221,64,189,156,172,26,64,63,63,95,238,147,112,23,17,109,48,76,147,63,192,8,105,16,16,53,251,41,67,22,99,242,191,200,183,104,22,69,84,30,9,86,210,96,2,22,94,111,211,47,139,246,97,23,52,69,14,190,95,148,63,55,109,125,98,44,24,194,69,134,235,207,213,54,5,26,1,202,136,238,163,245,1,151,135,116,10,87,53,142,167,39,69,150,110,207,90,100,2,69,126,163,221,36,49,189,219,149,155,48,91,129,157,98,169,70,250,231,16,34,58,16,90,94,158,194,180,142,101,110,34,114,116,64,73,44,139,111,110,34,18,126,202,134,160,236,22,215,52,120,26,125,252,115,222,120,103,173,37,233,6,105,57,68,101,130,40,204,182,15,48,139,220,70,56,201,172,185,234,172,29,188,243,188,26,171,19,86,125,252,129,217,24,135,133,248,158,13,17,40,101,19,231,160,219,134,4,11,84,144,30,45,103,17,44,170,19,186,111,207,40,183,33,153,141,81,178,126,96,197,19,149,75,127,249,82,67,201,158,17,110,34,82,102,211,27,200,103,100,208,240,8,250,14,22,241,225,10,166,147,197,3,201,31,217,226,146,190,194,249,11,61,44,43,16,84,236,19,214,184,99,85,200,162,27,152,191,71,25,27,206,151,152,32,64,254,184,141,182,123,126,44,173,234,85,65,190,210,236,27,60,70,69,32,72,172,196,68,131,38,247,25,73,133,30,193,208,186,1,110,175,226,118,200,117,217,72,251,184,187,67,112,121,184,3,183,96,55,255,15,171,3,206,236,178,29,67,187,248,68,53,121,225,120,127,113,252,241,233,155,247,175,95,150,85,186,135,47,244,104,165,90,83,144,52,9,44,86,74,197,239,240,40,63,200,191,25,87,96,207,188,3,77,172,0,190,86,76,83,137,39,193,98,31,220,3,186,7,156,113,156,156,44,209,105,96,166,240,24,175,61,223,227,63,231,103,143,57,83,4,92,188,237,160,129,140,252,84,89,64,253,237,25,76,182,192,85,242,69,251,144,228,221,251,79,120,54,178,199,106,226,58,213,220,58,40,39,215,162,54,152,176,134,53,193,22,118,41,56,102,211,226,55,2,229,214,105,148,173,145,157,149,212,107,106,169,43,248,55,24,99,180,187,152,128,95,60,224,129,87,213,156,88,203,221,46,77,62,1,113,168,234,217,212,67,77,41,123,16,93,75,174,24,211,246,57,105,1,109,242,52,106,210,22,26,88,249,234,214,23,7,168,105,219,84,227,194,26,12,106,250,38,204,126,235,236,31,52,17,139,0,219,151,120,151,110,161,70,170,164,101,85,71,67,197,143,49,44,70,81,185,178,141,128,108,26,151,4,9,184,10,180,36,137,254,97,82,168,142,125,85,75,67,211,23,135,253,54,38,41,221,85,51,2,151,234,203,133,25,44,78,109,51,37,101,235,74,26,186,62,167,20,142,83,231,61,206,104,200,161,125,70,87,178,101,179,98,191,202,139,55,192,38,91,69,100,171,90,234,222,255,178,220,83,41,137,44,47,159,190,175,246,217,1,223,198,205,68,90,51,211,51,121,165,235,74,234,58,191,168,231,66,25,44,18,163,130,18,112,156,252,147,78,156,132,106,70,225,6,75,170,169,89,85,210,80,19,143,53,136,106,163,81,159,36,242,172,
-226,100,163,164,91,83,75,99,220,171,5,103,153,67,20,21,204,64,231,103,34,69,255,25,23,74,42,98,121,117,229,222,131,231,132,55,196,219,59,251,175,48,27,254,231,33,47,78,227,228,20,47,58,169,36,133,67,227,94,109,109,169,97,91,85,154,0,109,29,170,24,100,97,102,186,142,132,240,150,171,128,50,130,164,106,49,171,87,89,93,245,159,218,171,16,136,90,99,209,245,38,74,112,95,78,85,213,186,150,186,142,31,163,223,15,36,63,182,110,100,84,73,168,144,61,224,171,215,85,116,172,43,169,171,88,49,0,230,23,145,102,48,17,188,0,3,142,215,57,115,107,17,51,81,173,87,106,85,246,79,221,126,93,232,170,252,141,155,66,68,38,212,44,10,221,254,244,123,81,75,248,251,187,79,85,169,166,237,119,229,55,236,166,76,189,5,43,50,223,56,193,84,62,37,148,203,42,26,94,118,191,167,153,193,36,123,176,90,90,229,226,73,64,201,14,240,219,173,234,84,128,173,170,174,41,57,126,194,186,52,32,224,218,58,109,141,81,117,86,210,145,180,109,22,91,130,205,251,167,175,127,106,215,97,86,90,41,204,224,0,24,88,143,222,210,9,254,63,43,53,170,35,115,50,213,15,129,226,31,114,186,151,14,131,139,91,19,176,144,93,255,246,32,140,81,187,112,157,165,139,2,31,147,43,42,48,232,167,26,145,214,42,26,32,33,85,88,187,37,99,86,47,157,203,67,127,218,72,107,149,44,146,222,61,226,48,160,77,216,149,31,28,242,106,251,181,246,128,214,10,190,175,92,154,173,195,157,26,52,164,10,171,12,125,198,136,232,136,211,197,53,148,131,8,135,19,200,106,67,171,82,130,139,15,85,97,18,62,67,42,129,217,199,52,243,187,206,42,41,51,11,131,114,11,183,134,15,247,184,197,70,132,59,210,5,46,133,148,124,145,169,166,238,135,31,162,60,221,222,81,187,163,137,199,164,165,96,131,231,82,113,49,180,222,221,197,69,10,78,162,166,107,89,71,93,81,152,203,199,215,15,116,193,176,13,201,46,28,204,32,182,105,140,167,34,25,30,120,109,43,211,32,207,80,148,121,212,184,124,95,167,153,112,113,217,28,60,246,199,156,183,206,198,253,45,106,121,117,77,226,16,205,9,130,192,13,132,39,156,70,229,114,131,67,65,206,226,148,134,169,172,163,62,76,63,39,25,240,124,149,157,126,214,62,165,20,104,248,207,60,77,212,38,208,88,193,134,110,28,89,89,180,57,172,213,28,178,172,162,227,140,88,177,204,202,64,237,200,93,51,193,122,27,198,187,92,172,224,46,220,43,234,135,53,116,212,131,122,123,114,139,24,27,207,232,190,123,249,208,120,109,157,116,91,39,41,6,212,78,139,232,239,48,17,140,21,119,160,218,53,157,134,188,44,34,79,132,41,170,75,235,232,40,74,159,63,91,61,112,14,19,226,50,164,113,39,118,135,252,182,76,44,83,154,212,53,213,52,150,167,80,57,160,181,243,96,147,126,193,105,123,53,11,19,226,153,110,11,53,211,37,21,212,149,123,69,182,65,200,136,191,123,253,233,125,128,7,40,244,124,27,31,214,139,239,202,163,33,118,126,219,60,112,208,221,74,143,11,186,194,98,78,3,122,9,32,75,178,91,95,229,228,224,145,102,43,29,160,201,199,249,244,1,234,62,191,61,176,71,101,207,179,136,156,122,39,181,40,58,143,184,142,49,230,223,100,97,66,206,68,64,0,121,86,166,157,48,21,6,119,113,244,165,149,11,149,68,247,197,152,122,193,128,126,247,69,71,193,247,89,90,7,42,252,57,88,227,239,132,157,26,10,110,241,96,15,32,144,123,75,14,90,131,162,220,229,102,101,174,14,201,171,178,235,45,169,216,52,145,10,5,112,215,32,66,223,192,255,148,207,0,3,60,229,83,172,228,24,144,248,117,71,143,46,20,163,138,188,133,42,3,93,135,18,188,142,183,176,207,139,104,79,100,108,195,188,192,63,78,190,103,41,191,4,249,10,190,187,12,56,53,241,76,158,212,132,63,78,240,159,94,77,248,142,91,19,15,23,73,77,146,4,195,30,46,86,53,225,59,110,77,180,9,82,147,28,168,193,63,189,154,240,29,183,230,245,182,148,9,127,156,224,63,189,154,240,29,183,230,102,181,165,53,201,25,26,158,145,117,107,194,119,1,115,138,180,185,11,147,117,249,100,84,219,85,194,210,89,200,185,47,231,100,177,73,115,3,6,91,51,6,18,231,224,
-254,105,101,34,171,225,123,244,95,125,252,127,94,126,120,199,78,48,194,236,129,94,170,65,108,2,155,10,210,187,40,235,101,144,67,101,102,165,210,23,42,121,55,244,36,5,70,111,60,111,171,5,54,230,30,11,20,234,33,22,236,197,0,206,176,32,215,58,248,135,5,94,210,237,28,11,20,234,33,22,16,217,220,99,129,66,61,196,2,98,181,123,44,80,232,172,88,48,122,37,241,150,205,13,25,84,229,237,171,215,98,77,18,20,45,131,68,71,162,52,16,218,210,37,76,34,73,11,37,32,222,125,26,214,134,52,39,9,71,79,180,60,34,211,212,24,55,15,104,160,230,251,120,48,104,128,42,220,27,132,158,165,233,54,34,119,183,144,173,72,166,231,157,182,101,223,51,33,39,103,116,200,89,233,236,244,9,254,30,146,72,17,6,189,240,30,5,114,225,136,196,24,119,100,113,123,106,76,174,74,207,217,201,18,254,109,179,231,162,57,146,57,185,42,61,23,222,153,100,161,231,162,25,145,57,185,42,61,103,39,66,173,55,151,88,232,185,104,254,99,78,238,120,8,203,227,155,68,210,211,63,190,250,233,109,87,9,172,30,44,78,207,151,143,151,231,39,50,221,239,202,147,244,118,125,217,163,131,207,106,212,90,30,57,64,64,184,50,154,13,129,214,162,200,1,2,194,245,208,108,8,180,150,66,14,16,16,174,130,102,67,160,181,0,114,128,128,112,237,51,27,2,173,101,143,3,4,132,43,30,39,8,52,233,26,171,92,146,11,158,62,251,216,85,2,42,203,116,187,35,67,178,215,138,242,70,7,155,209,98,100,150,103,164,167,10,179,59,139,61,29,153,213,25,233,169,194,108,206,98,79,71,102,113,70,122,170,48,123,179,216,83,54,86,227,223,54,122,42,138,207,211,229,169,244,148,141,201,248,183,141,158,138,226,240,116,121,227,193,247,84,118,193,253,242,167,174,224,36,186,145,233,232,169,206,50,91,77,218,232,128,158,202,46,174,167,247,82,101,73,109,171,151,99,11,233,233,189,84,89,62,219,234,229,216,162,121,122,47,85,150,202,182,122,57,18,106,13,244,82,33,208,90,235,229,72,152,53,208,75,133,32,107,170,151,181,18,223,126,43,25,101,95,189,125,254,161,43,186,190,200,65,166,187,109,73,146,209,86,79,234,232,224,54,186,140,68,93,131,189,86,136,190,214,123,61,18,133,13,246,90,33,26,91,239,245,72,84,54,216,107,133,232,108,189,215,35,81,218,96,175,21,162,181,245,94,143,68,109,131,189,86,136,222,134,123,221,48,137,236,84,249,197,203,190,2,155,72,161,219,167,58,83,102,61,169,227,12,45,59,117,54,216,107,133,32,110,189,215,35,65,220,96,175,21,130,184,245,94,143,4,113,131,189,86,8,226,214,123,61,18,196,13,246,90,33,136,91,239,245,72,16,55,216,107,133,32,110,184,215,205,197,126,113,178,88,157,55,73,188,231,191,46,87,23,236,199,147,128,253,212,209,234,205,171,183,189,60,135,90,44,52,29,239,14,187,230,226,93,242,54,189,125,24,103,248,129,220,192,155,51,176,140,106,194,67,202,141,86,45,45,170,107,142,102,215,96,54,60,42,249,171,217,236,132,171,129,83,60,88,117,174,146,244,138,36,71,77,241,163,178,145,105,138,45,3,114,117,56,62,142,145,84,87,82,119,176,147,82,86,5,74,231,138,235,120,163,23,74,250,140,170,150,79,123,161,164,55,168,50,151,229,222,79,137,5,79,255,103,64,191,240,94,41,86,142,105,34,15,158,105,173,212,189,216,133,6,179,225,161,225,127,46,52,112,138,7,171,142,1,78,125,250,63,227,238,46,161,216,104,124,146,84,86,5,74,231,138,235,120,163,23,74,250,140,170,150,79,123,161,164,55,168,50,155,172,181,119,145,61,192,202,183,216,173,71,94,26,207,139,23,81,66,222,184,222,211,239,217,121,240,109,240,236,98,73,238,239,13,147,34,194,28,94,178,146,166,87,191,61,148,47,243,68,157,170,119,182,63,236,217,103,3,6,84,146,205,50,26,85,143,187,130,159,166,51,163,229,29,254,71,83,63,80,239,179,89,69,12,128,134,74,153,135,140,106,183,154,106,113,159,113,68,205,42,50,29,50,162,148,41,200,198,92,131,221,50,231,165,162,205,224,173,162,189,117,45,245,108,123,43,62,180,174,167,159,97,111,197,199,232,167,131,230,192,91,245,45,206,176,183,154,177,51,167,222,202,30,245,240,210,41,103,240,
-86,209,153,144,150,122,182,189,149,121,179,188,162,126,134,189,21,175,174,152,14,154,3,111,213,183,56,195,222,106,198,206,156,122,43,123,88,199,75,148,157,193,91,69,167,122,90,234,217,246,86,188,98,69,79,63,195,222,138,151,190,76,7,205,129,183,234,91,156,97,111,53,99,103,182,189,149,204,0,120,235,214,249,102,194,61,149,252,159,9,19,149,91,235,214,153,102,194,141,34,30,207,132,113,158,190,154,106,113,38,188,181,163,136,255,51,225,150,107,248,177,110,237,169,244,213,120,235,252,235,214,70,145,175,195,91,231,93,183,118,20,249,202,188,213,143,117,107,79,37,255,215,173,165,147,204,191,110,109,20,241,120,221,202,56,201,188,235,214,142,34,254,175,91,91,174,225,199,186,181,167,146,255,235,214,210,73,230,95,183,54,138,120,188,110,101,156,100,222,117,107,71,17,255,215,173,36,166,240,214,173,243,113,107,79,37,255,185,149,168,220,90,183,206,196,173,141,34,30,115,43,50,255,106,170,197,153,240,214,142,34,254,115,107,203,53,216,85,132,39,222,42,90,79,120,233,173,204,186,117,94,111,21,172,91,253,243,86,125,139,51,236,173,102,236,204,169,183,250,177,110,237,169,244,213,120,235,252,235,214,70,145,175,195,91,231,93,183,118,20,249,202,188,213,143,117,107,79,37,255,215,173,165,147,204,191,110,109,20,241,120,221,202,56,201,188,235,214,142,34,254,175,91,201,147,212,126,121,107,79,37,255,189,149,168,236,131,183,54,138,120,236,173,248,170,31,47,188,181,163,136,255,222,74,180,228,237,50,205,231,173,61,149,252,247,86,162,114,107,151,105,38,111,109,20,241,216,91,49,150,172,166,90,156,9,111,237,40,242,149,121,43,187,230,247,196,91,69,171,127,47,189,149,217,101,154,215,91,5,187,76,254,121,171,190,197,25,246,86,51,118,230,212,91,217,53,191,39,222,42,90,253,123,233,173,204,46,211,188,222,42,216,101,242,207,91,245,45,206,176,183,154,177,51,167,222,202,94,60,230,137,183,138,110,40,243,210,91,201,107,121,125,240,86,92,144,125,21,222,170,111,113,134,189,213,140,157,57,245,86,63,118,153,122,42,125,53,222,58,255,46,83,163,200,215,225,173,243,238,50,117,20,241,205,91,217,75,207,53,46,143,248,248,243,179,1,127,56,157,230,174,167,147,47,143,24,87,207,180,237,157,42,93,30,49,164,31,168,247,217,172,34,6,64,67,165,204,67,166,114,121,196,128,118,159,113,68,205,42,50,29,50,162,148,113,114,61,213,186,60,98,14,111,85,120,56,98,126,111,29,126,8,199,161,183,202,63,132,51,179,183,234,91,156,97,111,53,99,103,78,189,117,36,181,100,14,111,85,72,50,153,223,91,135,147,153,28,122,171,124,50,211,204,222,170,111,113,134,189,213,140,157,57,245,214,145,101,196,28,222,170,176,160,152,223,91,135,23,174,14,189,85,126,225,58,179,183,234,91,156,97,111,53,99,103,182,189,85,229,242,8,71,222,170,123,121,196,140,222,42,117,121,132,11,111,85,190,60,98,14,111,149,191,60,194,178,183,234,93,30,225,139,183,250,177,110,213,189,60,98,126,111,157,127,221,170,124,121,196,204,222,58,239,186,85,239,242,8,95,188,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,98,70,111,85,185,60,194,145,183,234,94,30,49,163,183,74,93,30,225,194,91,149,47,143,152,195,91,229,47,143,176,236,173,122,151,71,248,226,173,35,143,242,207,225,173,10,15,245,207,239,173,195,151,71,56,244,86,249,203,35,102,246,86,125,139,51,236,173,102,236,204,169,183,250,177,110,213,189,60,98,126,111,157,127,221,170,124,121,196,204,222,58,239,186,85,239,242,8,95,188,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,204,232,173,42,151,71,56,242,86,221,203,35,102,244,86,169,203,35,92,120,171,242,229,17,115,120,171,252,229,17,150,189,85,239,242,136,25,189,85,229,242,8,71,222,170,123,121,196,140,222,42,117,121,132,11,111,85,190,60,98,14,111,149,191,60,194,178,183,234,93,30,225,139,183,142,60,202,63,135,183,42,60,212,63,191,183,14,95,30,225,208,91,229,47,143,152,217,
-91,245,45,206,176,183,154,177,51,167,222,58,242,40,255,28,222,170,240,80,255,252,222,58,124,121,132,67,111,149,191,60,98,102,111,213,183,56,195,222,106,198,206,156,122,235,200,163,252,115,120,171,194,67,253,243,123,235,240,229,17,14,189,85,254,242,136,153,189,85,223,226,12,123,171,25,59,115,234,173,126,236,50,233,94,30,49,191,183,206,191,203,164,124,121,196,204,222,58,239,46,147,222,229,17,206,188,181,214,245,207,90,151,71,188,249,249,245,128,63,252,121,154,187,254,121,242,229,17,227,234,153,182,189,63,43,93,30,49,164,31,168,247,217,172,34,6,64,67,165,204,67,166,114,121,196,128,118,159,113,68,205,42,50,29,50,162,148,113,114,253,179,214,229,17,115,120,171,194,195,17,243,123,235,240,67,56,14,189,85,254,33,156,153,189,85,223,226,12,123,171,25,59,115,234,173,35,169,37,115,120,171,66,146,201,252,222,58,156,204,228,208,91,229,147,153,102,246,86,125,139,51,236,173,102,236,204,169,183,142,44,35,230,240,86,133,5,197,252,222,58,188,112,117,232,173,242,11,215,153,189,85,223,226,12,123,171,25,59,179,237,173,42,151,71,56,242,86,221,203,35,102,244,86,169,203,35,92,120,171,242,229,17,115,120,171,252,229,17,150,189,85,239,242,8,95,188,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,194,23,111,245,99,221,170,123,121,196,252,222,58,255,186,85,249,242,136,153,189,117,222,117,171,222,229,17,51,122,171,202,229,17,142,188,85,247,242,136,25,189,85,234,242,8,23,222,170,124,121,196,28,222,42,127,121,132,101,111,213,187,60,194,23,111,29,121,148,127,14,111,85,120,168,127,126,111,29,190,60,194,161,183,202,95,30,49,179,183,234,91,156,97,111,53,99,103,78,189,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,98,70,111,85,185,60,194,145,183,234,94,30,49,163,183,74,93,30,225,194,91,149,47,143,152,195,91,229,47,143,176,236,173,122,151,71,204,232,173,42,151,71,56,242,86,221,203,35,102,244,86,169,203,35,92,120,171,242,229,17,115,120,171,252,229,17,150,189,85,239,242,8,95,188,117,228,81,254,57,188,85,225,161,254,249,189,117,248,242,8,135,222,42,127,121,196,204,222,170,111,113,134,189,213,140,157,57,245,214,145,71,249,231,240,86,133,135,250,231,247,214,225,203,35,28,122,171,252,229,17,51,123,171,190,197,25,246,86,51,118,230,212,91,71,30,229,159,195,91,21,30,234,159,223,91,135,47,143,112,232,173,242,151,71,204,236,173,250,22,103,216,91,205,216,153,83,111,245,99,151,73,247,242,136,249,189,117,254,93,38,229,203,35,102,246,214,121,119,153,244,46,143,112,230,173,181,174,223,142,95,30,129,127,119,244,124,250,226,69,30,223,36,225,150,231,14,223,18,111,165,191,7,81,150,165,89,144,38,181,90,12,78,223,170,221,18,161,163,135,0,48,9,229,64,208,85,146,146,18,186,16,137,193,169,199,104,29,30,114,208,234,237,171,215,193,93,184,61,68,170,10,200,227,164,136,144,140,134,223,138,111,204,80,27,43,80,228,179,172,197,200,92,141,161,46,221,144,157,168,193,33,2,66,217,58,244,49,81,66,67,206,38,132,87,130,40,141,202,103,52,78,73,155,144,186,251,67,93,186,25,155,80,132,67,4,132,170,77,76,192,68,9,141,33,189,198,2,61,187,87,197,185,154,197,42,201,136,182,167,116,244,176,72,50,227,16,89,38,25,53,156,28,144,12,179,37,172,54,86,218,36,35,216,251,85,151,110,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,236,22,43,231,201,76,171,36,35,218,85,213,209,195,34,201,140,67,100,153,100,212,112,114,64,50,204,73,134,218,88,105,147,140,224,200,66,93,186,13,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,39,3,156,196,108,171,36,35,58,12,
-208,209,195,34,201,140,67,100,153,100,212,112,114,64,50,204,1,156,218,88,105,147,140,224,164,77,93,186,13,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,7,90,248,183,75,146,17,157,97,233,232,97,145,100,198,33,178,76,50,106,56,57,32,25,230,220,88,109,172,180,73,70,112,64,172,46,221,6,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,48,41,97,32,65,193,42,201,160,60,201,68,137,57,73,102,28,34,203,36,163,134,147,3,146,1,193,122,99,165,77,50,32,102,186,165,216,34,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,12,146,140,240,138,103,7,7,255,82,119,57,207,127,240,175,8,145,121,146,153,128,147,77,146,233,223,107,109,251,224,127,248,2,235,153,15,254,101,225,48,76,50,58,152,88,33,25,193,197,221,22,15,254,37,110,232,158,239,224,95,9,14,115,36,163,141,137,51,146,113,156,93,38,117,5,185,103,36,51,71,118,217,4,156,28,144,140,195,236,178,225,123,215,253,32,25,215,217,101,58,152,216,38,25,71,217,101,18,23,203,123,65,50,46,179,203,180,49,113,70,50,142,179,203,164,110,206,159,63,187,76,17,34,203,36,227,79,118,89,255,45,2,182,179,203,134,95,23,48,115,118,153,44,28,118,72,102,254,236,50,193,107,18,44,102,151,73,188,15,97,190,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,76,248,178,33,7,217,101,82,111,21,154,63,187,76,17,34,203,36,227,79,118,89,255,13,75,182,179,203,134,95,165,52,115,118,153,44,28,118,72,102,254,236,50,193,43,164,44,102,151,73,188,43,106,190,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,76,248,34,70,7,103,50,82,111,92,156,255,76,70,17,34,243,36,51,1,39,155,36,211,127,251,164,237,51,153,225,215,76,206,124,38,35,11,135,97,146,209,193,196,10,201,8,94,175,105,241,76,70,226,61,154,243,157,201,40,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,198,113,118,153,212,251,109,61,35,153,57,178,203,38,224,228,128,100,28,102,151,13,191,212,215,15,146,113,157,93,166,131,137,109,146,113,148,93,38,241,214,98,47,72,198,101,118,153,54,38,206,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,100,77,197,75,157,114,176,93,214,147,237,231,118,153,34,68,230,73,102,2,78,54,73,134,168,213,74,167,178,189,93,214,72,244,112,187,76,22,14,195,36,163,131,137,21,146,193,13,187,213,196,56,162,70,50,29,137,126,109,151,41,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,
-198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,17,186,227,165,78,57,88,201,244,100,251,185,146,81,132,200,60,201,76,192,201,38,201,16,181,90,233,84,182,87,50,141,68,15,87,50,178,112,24,38,25,29,76,172,144,12,174,165,86,19,227,136,26,201,116,36,250,181,146,81,130,195,28,201,104,99,226,140,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,142,179,203,122,178,191,2,146,153,35,187,108,2,78,14,72,198,97,118,89,35,209,95,146,113,157,93,166,131,137,109,146,113,148,93,214,145,232,45,201,184,204,46,211,198,196,25,201,56,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,35,154,240,82,167,28,144,76,79,182,159,36,163,8,145,121,146,153,128,147,77,146,33,106,181,210,169,108,147,76,35,209,67,146,145,133,195,48,201,232,96,98,133,100,144,230,86,19,227,136,26,201,116,36,250,69,50,74,112,152,35,25,109,76,156,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,115,36,83,107,118,90,71,48,146,131,192,203,157,194,191,59,186,124,252,249,153,56,186,159,202,178,204,128,108,30,38,58,122,232,91,74,126,88,245,130,188,34,68,98,112,100,108,70,74,1,121,156,20,17,146,209,240,116,193,166,175,180,242,169,
-212,198,10,20,249,44,107,49,93,137,211,45,5,165,27,178,19,53,56,68,64,40,91,135,62,38,74,104,200,217,4,213,96,53,49,142,124,70,227,148,180,137,158,196,201,54,65,164,155,177,9,69,56,68,64,168,218,196,4,76,148,208,144,90,202,8,2,61,155,7,129,127,187,36,25,81,50,132,142,30,22,73,102,28,34,203,36,163,134,147,3,146,97,242,169,212,198,74,155,100,4,169,84,234,210,109,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,205,131,192,191,93,146,140,40,25,66,71,15,139,36,51,14,145,101,146,81,195,201,1,201,48,249,84,106,99,165,77,50,130,84,42,117,233,54,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,51,242,14,55,171,36,163,240,34,183,57,73,102,28,34,203,36,163,134,147,3,146,25,126,23,164,13,146,145,127,13,228,12,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,25,185,101,199,42,201,40,92,181,51,39,201,140,67,100,153,100,212,112,114,64,50,195,183,117,217,32,25,249,139,186,102,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,204,72,30,132,85,146,81,72,134,152,147,100,198,33,178,76,50,106,56,57,32,153,225,124,42,27,36,35,159,74,53,3,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,144,100,200,233,16,47,117,202,193,193,127,79,182,159,7,255,138,16,153,39,153,9,56,217,36,25,162,86,43,157,202,246,193,127,35,209,195,131,127,89,56,12,147,140,14,38,86,72,6,83,15,86,19,227,136,26,201,116,36,250,117,240,175,4,135,57,146,209,198,196,25,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,181,2,152,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,178,86,0,115,156,93,214,147,237,103,118,153,34,68,150,73,198,159,236,178,50,188,57,204,46,107,36,122,152,93,38,11,135,29,146,153,63,187,140,9,111,142,178,203,58,18,253,202,46,83,130,195,10,201,248,147,93,70,54,238,120,169,83,14,206,100,122,178,253,60,147,81,132,200,60,201,76,192,201,38,201,16,181,90,233,84,182,207,100,26,137,30,158,201,200,194,97,152,100,116,48,177,66,50,120,42,180,154,24,71,212,72,166,35,209,175,51,25,37,56,204,145,140,54,38,206,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,
-68,191,178,203,148,224,176,66,50,254,100,151,181,2,152,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,50,178,166,226,165,78,57,216,46,235,201,246,115,187,76,17,34,243,36,51,1,39,155,36,67,212,106,165,83,217,222,46,107,36,122,184,93,38,11,135,97,146,209,193,196,10,201,224,134,221,106,98,28,81,35,153,142,68,191,182,203,148,224,48,71,50,218,152,56,35,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,28,103,151,245,100,127,5,36,51,71,118,217,4,156,28,144,140,195,236,178,70,162,191,36,227,58,187,76,7,19,219,36,227,40,187,172,35,209,91,146,113,153,93,166,141,137,51,146,113,156,93,214,147,237,103,118,153,34,68,150,73,198,159,236,178,50,188,57,204,46,107,36,122,152,93,38,11,135,29,146,153,63,187,140,9,111,142,178,203,58,18,253,202,46,83,130,195,10,201,248,147,93,214,10,96,142,179,203,122,178,253,204,46,83,132,200,50,201,248,147,93,86,134,55,135,217,101,141,68,15,179,203,100,225,176,67,50,243,103,151,49,225,205,81,118,89,71,162,95,217,101,74,112,88,33,25,127,178,203,8,221,241,82,167,28,172,100,122,178,253,92,201,40,66,100,158,100,38,224,100,147,100,136,90,173,116,42,219,43,153,70,162,135,43,25,89,56,12,147,140,14,38,86,72,6,215,82,171,137,113,68,141,100,58,18,253,90,201,40,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,199,217,101,61,217,95,1,201,204,145,93,54,1,39,7,36,227,48,187,172,145,232,47,201,184,206,46,211,193,196,54,201,56,202,46,235,72,244,150,100,92,102,151,105,99,226,140,100,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,17,77,120,169,83,14,72,166,39,219,79,146,81,132,200,60,201,76,192,201,38,201,16,181,90,233,84,182,73,166,145,232,33,201,200,194,97,152,100,116,48,177,66,50,72,115,171,137,113,68,141,100,58,18,253,34,25,37,56,204,145,140,54,38,206,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,
-34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,28,103,151,245,100,127,5,36,51,71,118,217,4,156,28,144,140,195,236,178,70,162,191,36,227,58,187,76,7,19,219,36,227,40,187,172,35,209,91,146,113,153,93,166,141,137,57,146,169,53,251,115,29,193,72,14,2,47,119,10,255,238,232,242,230,231,215,226,232,254,103,89,150,25,144,205,195,68,71,15,125,75,217,29,182,189,32,175,8,145,24,28,25,155,145,82,64,30,39,69,132,100,52,252,243,130,77,95,105,229,83,169,141,21,40,242,89,214,98,186,18,167,91,10,74,55,100,39,106,112,136,128,80,182,14,125,76,148,208,144,179,9,170,193,106,98,28,249,140,198,41,105,19,61,137,147,109,130,72,55,99,19,138,112,136,128,80,181,137,9,152,40,161,33,181,148,17,4,122,54,15,2,255,118,73,50,162,100,8,29,61,44,146,204,56,68,150,73,70,13,39,7,36,195,228,83,169,141,149,54,201,8,82,169,212,165,219,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,7,129,127,187,36,25,81,50,132,142,30,22,73,102,28,34,203,36,163,134,147,3,146,97,242,169,212,198,74,155,100,4,169,84,234,210,109,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,102,228,29,110,86,73,70,225,69,110,115,146,204,56,68,150,73,70,13,39,7,36,51,252,46,72,27,36,35,255,26,200,25,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,51,114,203,142,85,146,81,184,106,103,78,146,25,135,200,50,201,168,225,228,128,100,134,111,235,178,65,50,242,23,117,205,64,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,153,145,60,8,171,36,163,144,12,49,39,201,140,67,100,153,100,212,112,114,64,50,195,249,84,54,72,70,62,149,106,6,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,32,201,144,211,33,94,234,148,131,131,255,158,108,63,15,254,21,33,50,79,50,19,112,178,73,50,68,173,86,58,149,237,131,255,70,162,135,7,255,178,112,24,38,25,29,76,172,144,12,166,30,172,38,198,17,53,146,233,72,244,235,224,95,9,14,115,36,163,141,137,51,146,113,156,93,214,147,253,21,144,204,28,217,101,19,112,114,64,50,14,179,203,26,137,254,146,140,235,236,50,29,76,108,147,140,163,236,178,142,68,111,73,198,101,118,153,54,38,206,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,140,108,220,241,82,167,28,156,201,244,100,251,121,38,163,8,145,121,146,153,128,147,77,146,33,106,181,210,169,108,159,201,52,18,61,60,147,145,133,195,48,201,232,96,98,133,100,240,84,104,53,49,142,168,145,76,71,162,95,103,50,74,112,152,35,25,109,76,156,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,
-57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,113,156,93,214,147,253,21,144,204,28,217,101,19,112,114,64,50,14,179,203,26,137,254,146,140,235,236,50,29,76,108,147,140,163,236,178,142,68,111,73,198,101,118,153,54,38,206,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,100,77,197,75,157,114,176,93,214,147,237,231,118,153,34,68,230,73,102,2,78,54,73,134,168,213,74,167,178,189,93,214,72,244,112,187,76,22,14,195,36,163,131,137,21,146,193,13,187,213,196,56,162,70,50,29,137,126,109,151,41,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,17,186,227,165,78,57,88,201,244,100,251,185,146,81,132,200,60,201,76,192,201,38,201,16,181,90,233,84,182,87,50,141,68,15,87,50,178,112,24,38,25,29,76,172,144,12,174,165,86,19,227,136,26,201,116,36,250,181,146,81,130,195,28,201,104,99,226,140,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,142,179,203,122,178,191,2,146,153,35,187,108,2,78,14,72,198,97,118,89,35,209,95,146,113,157,93,166,131,137,109,146,113,148,93,214,145,232,45,201,184,204,46,211,198,196,25,201,56,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,35,154,240,82,167,28,144,76,79,182,159,36,163,8,145,121,146,153,128,147,77,146,33,106,181,210,169,108,147,76,35,209,67,146,145,133,195,48,201,232,96,98,133,100,144,230,86,19,227,136,26,201,116,36,250,69,
-50,74,112,152,35,25,109,76,156,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,115,36,83,107,246,109,29,193,242,34,99,78,149,225,67,165,11,254,221,209,229,233,139,23,61,93,214,105,178,6,241,73,88,196,136,253,53,134,49,208,9,2,25,3,196,128,56,30,12,147,69,115,177,105,235,195,104,112,135,255,153,44,155,136,254,60,44,196,104,103,169,192,241,174,82,201,43,115,35,252,153,162,60,44,196,100,87,75,129,162,174,214,106,252,165,54,51,146,89,195,203,8,196,191,59,42,188,120,245,89,60,103,249,139,236,220,105,64,54,15,10,29,61,244,227,223,38,190,235,77,93,20,33,18,131,35,19,9,165,20,144,199,73,17,33,25,13,255,178,96,147,178,90,89,130,106,99,5,138,124,150,181,152,174,196,233,150,130,210,13,217,137,26,28,34,32,148,173,67,31,19,37,52,228,108,130,106,176,154,24,71,62,163,113,74,218,68,79,226,100,155,32,210,205,216,132,34,28,34,32,84,109,98,2,38,74,104,72,45,208,5,129,158,205,238,113,77,50,162,20,31,207,72,102,28,34,203,36,163,134,147,3,146,97,178,4,29,145,140,32,65,208,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,217,61,174,73,70,148,226,227,25,201,140,67,100,153,100,212,112,114,64,50,76,150,160,35,146,17,36,8,250,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,187,199,53,201,136,82,124,60,35,153,113,136,44,147,140,26,78,14,72,134,201,18,116,68,50,130,4,65,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,51,114,119,148,85,146,81,184,64,106,78,146,25,135,200,50,201,168,225,228,128,100,134,239,160,179,65,50,242,215,207,205,64,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,153,145,236,30,171,36,163,144,226,51,39,201,140,67,100,153,100,212,112,114,64,50,195,89,130,54,72,70,62,65,112,6,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,32,201,144,211,33,94,234,20,254,96,153,100,122,178,185,137,118,183,115,175,100,20,33,50,79,50,19,112,178,73,50,68,173,86,58,149,218,88,169,147,76,35,113,186,165,24,39,25,89,56,12,147,140,14,38,86,72,6,83,15,86,19,227,136,26,201,116,36,78,182,9,163,36,163,4,135,57,146,209,198,196,25,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,
-36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,181,2,152,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,50,178,113,199,75,157,194,31,44,147,76,79,54,15,18,29,61,204,146,140,34,68,230,73,102,2,78,54,73,134,168,213,74,167,82,27,43,117,146,105,36,78,183,20,227,36,35,11,135,97,146,209,193,196,10,201,224,169,208,106,98,28,81,35,153,142,196,201,54,97,148,100,148,224,48,71,50,218,152,56,35,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,140,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,178,86,0,115,156,93,214,147,237,103,118,153,34,68,150,73,198,159,236,178,50,188,57,204,46,107,36,122,152,93,38,11,135,29,146,153,63,187,140,9,111,142,178,203,58,18,253,202,46,83,130,195,10,201,248,147,93,70,214,84,188,212,41,252,193,50,201,244,100,243,32,209,209,195,44,201,40,66,100,158,100,38,224,100,147,100,136,90,173,116,42,181,177,82,39,153,70,226,116,75,49,78,50,178,112,24,38,25,29,76,172,144,12,110,216,173,38,198,17,53,146,233,72,156,108,19,70,73,70,9,14,115,36,163,141,137,51,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,132,238,120,169,83,14,86,50,61,217,126,174,100,20,33,50,79,50,19,112,178,73,50,68,173,86,58,149,237,149,76,35,209,195,149,140,44,28,134,73,70,7,19,43,36,131,107,169,213,196,56,162,70,50,29,137,126,173,100,148,224,48,71,50,
-218,152,56,35,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,140,227,236,178,158,236,175,128,100,230,200,46,155,128,147,3,146,113,152,93,214,72,244,151,100,92,103,151,233,96,98,155,100,28,101,151,117,36,122,75,50,46,179,203,180,49,113,70,50,142,179,203,122,178,253,204,46,83,132,200,50,201,248,147,93,86,134,55,135,217,101,141,68,15,179,203,100,225,176,67,50,243,103,151,49,225,205,81,118,89,71,162,95,217,101,74,112,88,33,25,127,178,203,136,38,188,212,41,7,36,211,147,237,39,201,40,66,100,158,100,38,224,100,147,100,136,90,173,116,42,219,36,211,72,244,144,100,100,225,48,76,50,58,152,88,33,25,164,185,213,196,56,162,70,50,29,137,126,145,140,18,28,230,72,70,27,19,103,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,142,179,203,122,178,191,2,146,153,35,187,108,2,78,14,72,198,97,118,89,35,209,95,146,113,157,93,166,131,137,109,146,113,148,93,214,145,232,45,201,184,204,46,211,198,196,28,201,212,154,253,175,58,130,145,28,4,94,238,20,254,221,209,229,205,187,23,226,232,254,191,184,44,3,16,196,155,40,88,61,4,127,68,89,202,96,51,160,1,15,25,29,109,36,237,69,168,226,46,221,244,2,190,34,92,98,160,218,82,135,172,72,74,13,121,204,20,209,146,215,243,127,45,216,180,150,86,158,149,218,232,129,58,159,213,44,169,43,119,186,5,161,14,70,237,71,13,26,17,40,154,86,163,143,143,18,50,42,182,66,245,88,77,140,59,159,209,116,149,108,165,39,119,178,173,16,29,76,218,138,34,52,34,80,244,108,101,2,62,74,200,140,107,55,70,21,108,62,197,60,100,37,74,173,240,146,172,198,225,114,66,86,106,152,57,35,43,38,95,203,41,89,9,18,182,124,34,171,81,104,108,146,149,18,62,110,200,74,59,238,76,36,43,35,209,198,46,89,105,196,24,115,100,53,49,178,216,37,43,54,47,99,30,178,18,165,104,120,73,86,227,112,57,33,43,53,204,156,145,21,147,247,229,148,172,4,137,95,62,145,213,40,52,54,201,74,9,31,55,100,165,29,119,38,146,149,145,104,99,151,172,52,98,140,57,178,154,24,89,236,146,21,155,223,49,15,89,137,82,61,188,36,171,113,184,156,144,149,26,102,206,200,138,201,31,115,74,86,130,4,50,159,200,106,20,26,155,100,165,132,143,27,178,210,142,59,19,201,202,72,180,177,75,86,26,49,198,28,89,77,140,44,118,201,106,228,22,34,7,100,165,112,33,209,252,100,53,14,151,19,178,82,195,204,25,89,13,223,114,102,143,172,
-228,175,57,155,141,172,70,161,177,73,86,74,248,184,33,43,237,184,51,145,172,140,68,27,187,100,165,17,99,204,145,213,196,200,98,151,172,70,242,77,28,144,149,66,234,201,252,100,53,14,151,19,178,82,195,204,25,89,13,231,179,217,35,43,249,132,182,217,200,106,20,26,155,100,165,132,143,27,178,210,142,59,19,201,202,72,180,177,75,86,26,49,198,28,89,77,140,44,198,201,138,156,161,205,154,13,216,211,192,231,109,64,69,184,108,145,213,4,204,236,147,21,81,110,134,108,192,70,174,183,219,128,178,208,88,33,43,29,124,44,146,21,38,122,204,145,13,216,145,235,227,54,160,18,52,166,201,74,27,31,199,100,197,166,158,224,223,238,201,74,148,127,162,163,141,117,178,26,135,203,9,89,169,97,230,140,172,152,148,55,181,209,155,72,86,130,108,55,117,29,236,145,213,40,52,54,201,74,9,31,55,100,165,29,119,38,146,149,145,104,99,151,172,52,98,140,57,178,154,24,89,236,146,21,155,122,50,15,89,137,242,79,188,36,171,113,184,156,144,149,26,102,206,200,138,73,121,115,74,86,130,108,55,159,200,106,20,26,155,100,165,132,143,27,178,210,142,59,19,201,202,72,180,177,75,86,26,49,198,28,89,77,140,44,118,201,138,77,61,153,135,172,68,249,39,94,146,213,56,92,78,200,74,13,51,103,100,197,164,188,57,37,43,65,182,155,79,100,53,10,141,77,178,82,194,199,13,89,105,199,157,137,100,101,36,218,216,37,171,255,183,189,55,108,146,219,54,214,133,63,219,191,130,78,213,169,172,114,214,178,165,243,126,138,45,85,217,142,94,199,117,21,59,71,118,116,115,238,173,212,214,236,12,119,53,199,179,51,235,25,238,74,202,175,127,1,146,67,130,36,128,70,55,30,128,204,91,39,85,177,118,102,200,238,70,247,131,110,116,19,108,8,124,12,46,88,69,122,150,180,193,106,150,221,128,19,9,150,188,27,144,169,174,44,193,106,105,187,1,91,167,152,125,55,96,207,119,177,187,1,67,85,147,50,88,45,101,55,160,225,20,179,238,6,28,241,93,226,110,64,150,106,18,6,171,165,237,6,28,184,189,89,118,3,78,36,88,242,110,64,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,238,6,12,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,187,1,89,170,73,24,172,150,182,27,176,46,75,206,186,27,112,34,193,146,119,3,50,213,149,42,88,69,232,44,125,176,170,133,155,97,55,96,207,119,177,187,1,67,85,147,36,88,73,244,147,48,88,233,103,103,115,236,6,28,241,93,226,110,64,150,106,208,193,74,172,159,204,193,106,150,221,128,19,9,150,252,204,138,169,174,44,193,106,105,187,1,91,167,152,125,55,96,207,119,177,207,172,66,85,147,50,88,45,101,55,160,225,20,179,238,6,28,241,93,226,51,43,150,106,18,6,171,165,237,6,28,184,61,115,235,137,254,59,127,176,114,237,63,145,72,147,60,88,209,234,202,18,172,120,58,203,22,172,140,45,111,60,235,69,6,43,199,110,55,190,12,233,130,21,169,154,148,193,138,165,159,60,193,74,236,119,34,131,21,196,219,164,13,86,2,31,131,11,86,145,158,37,109,176,50,183,158,204,19,172,92,251,79,22,25,172,104,117,101,9,86,60,157,101,11,86,198,150,183,172,193,202,177,219,109,73,193,138,84,77,202,96,197,210,79,158,96,37,246,59,145,193,10,226,109,210,6,43,129,143,193,5,171,72,207,146,54,88,205,178,27,112,34,193,146,119,3,50,213,149,37,88,45,109,55,96,235,20,179,239,6,236,249,46,118,55,96,168,106,82,6,171,165,236,6,52,156,98,214,221,128,35,190,75,220,13,200,82,77,194,96,181,180,221,128,3,183,55,203,110,192,137,4,75,222,13,200,84,87,150,96,181,180,221,128,173,83,204,190,27,176,231,187,216,221,128,161,170,73,25,172,150,178,27,208,112,138,89,119,3,142,248,46,113,55,32,75,53,9,131,213,210,118,3,214,153,222,172,187,1,39,18,44,121,55,32,83,93,169,130,85,132,206,210,7,171,90,184,25,118,3,246,124,23,187,27,48,84,53,73,130,149,68,63,9,131,149,46,71,206,177,27,112,196,119,137,187,1,89,170,65,7,43,177,126,50,7,171,89,118,3,78,36,88,242,110,64,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,238,6,
-12,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,187,1,89,170,73,24,172,150,182,27,112,224,246,102,217,13,56,145,96,201,27,44,152,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,193,34,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,110,176,96,169,38,97,176,90,218,110,192,129,219,51,183,158,232,191,243,7,43,215,254,19,137,52,201,131,21,173,174,44,193,138,167,179,108,193,202,216,242,198,179,94,100,176,114,236,118,227,203,144,46,88,145,170,73,25,172,88,250,201,19,172,196,126,39,50,88,65,188,77,218,96,37,240,49,184,96,21,233,89,210,6,171,89,118,3,78,36,88,242,110,64,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,238,6,12,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,187,1,89,170,73,24,172,150,182,27,112,224,246,102,217,13,56,145,96,201,187,1,153,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,27,48,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,238,6,100,169,38,97,176,90,218,110,192,58,120,218,182,183,101,203,172,38,18,44,57,179,98,170,43,85,176,138,208,89,250,96,85,11,55,216,242,150,39,179,234,249,46,54,179,10,85,77,146,96,37,209,79,194,96,165,51,188,235,72,191,35,9,86,35,190,75,204,172,88,170,65,7,43,177,126,50,7,43,115,235,201,60,193,202,181,255,100,145,193,138,86,87,150,96,197,211,89,182,96,101,108,121,203,26,172,28,187,221,150,20,172,72,213,164,12,86,44,253,228,9,86,98,191,19,25,172,32,222,38,109,176,18,248,24,92,176,138,244,44,105,131,149,185,245,100,158,96,229,218,127,178,200,96,69,171,43,75,176,226,233,44,91,176,50,182,188,101,13,86,142,221,110,75,10,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,122,50,79,176,114,237,63,89,100,176,162,213,149,37,88,241,116,150,45,88,25,91,222,178,6,43,199,110,183,37,5,43,82,53,41,131,21,75,63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,53,203,110,192,137,4,255,50,193,106,190,221,128,17,58,203,22,172,178,239,6,236,249,46,61,88,205,179,27,80,162,159,60,193,42,235,110,192,17,223,133,7,171,252,187,1,197,250,201,28,172,102,217,13,56,145,96,201,187,1,153,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,27,48,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,238,6,100,169,38,97,176,90,218,110,192,90,30,219,246,182,108,193,106,34,193,146,131,21,83,93,169,130,85,132,206,210,7,171,90,184,193,150,183,60,193,170,231,187,216,96,21,170,154,36,193,74,162,159,132,193,74,7,205,235,72,191,35,9,86,35,190,75,12,86,44,213,160,131,149,88,63,153,131,149,185,245,100,158,96,229,218,127,178,200,96,69,171,43,75,176,226,233,44,91,176,50,182,188,101,13,86,142,221,110,75,10,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,122,50,79,176,114,237,63,89,100,176,162,213,149,37,88,241,116,150,45,88,25,91,222,178,6,43,199,110,183,37,5,43,82,53,41,131,21,75,63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,101,110,61,153,39,88,185,246,159,44,50,88,209,234,202,18,172,120,58,203,22,172,140,45,111,89,131,149,99,183,219,146,130,21,169,154,148,193,138,165,159,60,193,74,236,119,34,131,21,196,219,164,13,86,2,31,131,11,86,145,158,37,109,176,50,183,158,204,19,172,92,251,79,22,25,172,104,117,101,9,86,60,157,101,11,86,198,150,183,172,193,202,177,219,109,73,193,138,84,77,202,96,197,210,79,158,96,37,246,59,145,193,10,226,109,210,6,43,129,143,193,5,171,72,207,146,54,88,205,178,27,112,34,193,191,76,176,154,111,55,96,132,206,178,5,171,236,187,1,123,190,75,15,86,243,236,6,148,232,39,79,176,202,186,27,112,196,119,225,193,42,255,110,64,177,126,208,193,170,147,79,
-221,219,121,190,235,173,217,104,110,219,71,114,253,247,72,166,111,126,180,122,59,245,181,242,119,198,248,189,244,173,135,79,50,121,89,117,48,22,192,96,249,168,255,225,50,171,121,189,165,168,198,12,167,225,16,50,152,134,213,181,216,74,111,27,197,81,84,35,6,211,114,112,13,198,142,13,189,223,40,240,228,101,17,246,198,244,3,15,62,133,97,79,179,164,142,6,230,99,175,163,26,51,28,22,246,20,171,107,177,149,156,216,27,82,141,24,140,4,123,245,246,129,192,131,84,37,216,155,208,15,60,199,16,133,189,154,37,117,210,39,27,123,61,213,152,225,112,176,167,89,93,139,173,228,194,222,136,106,196,96,36,216,171,159,6,6,158,139,40,193,222,132,126,224,177,100,40,236,213,44,169,131,251,216,216,235,169,198,12,135,131,61,205,234,90,108,37,23,246,70,84,35,6,35,193,30,231,152,51,9,246,164,231,151,161,176,23,116,14,23,27,123,236,3,182,162,177,23,126,80,20,7,123,178,19,160,36,216,235,24,27,85,22,78,174,241,211,27,27,28,126,122,51,68,158,143,120,224,98,214,195,136,178,84,95,10,8,202,50,108,156,52,163,183,4,201,136,129,212,228,3,134,193,201,47,44,124,222,214,250,34,72,202,135,209,144,39,221,156,9,6,70,102,193,71,154,48,173,192,32,45,36,167,96,34,141,155,80,68,34,45,56,155,8,71,154,40,149,128,32,141,147,71,176,145,38,77,34,32,72,11,202,32,120,72,99,167,15,113,72,11,207,29,130,145,38,75,28,32,72,227,100,13,108,164,73,83,6,8,210,130,242,5,30,210,216,201,66,28,210,194,51,133,96,164,201,210,4,8,210,56,57,2,27,105,210,4,1,130,180,160,236,128,135,52,118,106,16,135,180,240,188,32,24,105,178,164,128,143,180,142,235,7,97,78,240,119,59,6,254,62,70,219,7,64,90,224,229,69,89,234,3,51,51,176,50,171,121,189,165,168,198,12,167,225,16,50,24,78,126,240,119,43,50,254,62,66,222,135,136,20,193,195,129,116,115,31,132,89,130,8,123,194,68,1,134,189,144,92,129,143,61,110,186,16,143,189,224,140,129,133,61,81,210,128,194,30,39,111,144,96,79,154,58,160,176,23,148,61,176,177,199,78,32,162,177,23,158,67,112,176,39,75,35,80,216,227,100,18,18,236,73,147,9,20,246,130,242,9,54,246,216,41,69,52,246,194,179,10,14,246,100,137,5,10,123,156,220,66,130,61,105,122,129,194,94,80,134,193,198,30,59,201,136,198,94,120,158,193,193,158,44,213,144,96,175,99,252,245,215,162,245,222,235,159,255,236,222,13,251,245,215,245,158,211,227,106,123,42,251,205,104,135,135,170,56,220,168,111,247,183,101,113,42,215,135,253,166,56,220,151,234,243,198,80,132,79,158,192,53,8,45,155,99,147,152,72,224,221,233,221,100,191,44,83,147,30,29,122,100,240,109,177,11,18,42,92,157,92,69,10,165,214,182,103,44,205,61,118,214,210,189,141,64,160,112,41,79,73,148,12,119,60,173,57,245,133,64,155,92,117,60,165,201,49,198,201,152,220,22,125,91,207,0,57,198,164,25,22,37,81,42,140,49,181,230,212,23,0,99,17,170,227,41,141,41,43,25,196,204,20,105,9,65,213,149,92,45,63,168,210,154,156,33,168,242,212,57,87,80,53,106,14,51,6,85,71,141,98,177,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,214,126,150,16,84,93,85,163,229,7,85,90,147,51,4,85,158,58,231,10,170,70,49,117,198,160,234,40,190,46,54,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,203,26,84,205,162,246,18,130,170,171,28,190,252,160,74,107,114,134,160,202,83,231,92,65,213,120,74,52,99,80,117,60,85,90,108,80,37,181,150,47,168,178,84,55,75,80,21,251,57,104,80,133,120,183,140,65,85,224,211,82,5,213,72,79,150,58,168,14,246,25,153,85,115,203,254,149,28,65,117,34,79,224,222,154,249,131,42,83,147,121,130,106,132,58,179,7,213,118,115,152,241,116,144,103,103,76,80,237,165,136,71,94,142,160,26,170,181,12,65,85,162,186,124,65,213,216,179,39,246,115,241,65,117,36,69,52,198,82,7,85,150,214,210,6,85,177,234,230,13,170,196,
-182,211,236,65,149,177,97,117,97,65,149,214,228,12,65,149,167,206,185,130,170,127,31,119,174,160,26,190,239,123,25,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,86,205,151,16,84,93,165,243,229,7,85,90,147,51,4,85,158,58,231,10,170,198,211,193,25,131,170,227,193,224,98,131,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,213,172,154,47,33,168,186,74,231,203,15,170,180,38,103,8,170,60,117,206,21,84,141,167,131,51,6,85,199,131,193,197,6,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,169,131,234,224,253,121,179,106,110,121,47,59,71,80,157,200,19,248,206,248,252,65,149,169,201,60,65,53,66,157,217,131,106,219,244,192,120,58,200,179,51,38,168,246,82,196,35,47,71,80,13,213,90,134,160,42,81,93,190,160,106,244,162,16,251,185,248,160,58,146,34,26,99,169,131,42,75,107,105,131,170,88,117,243,6,85,179,106,190,132,160,234,42,157,47,63,168,210,154,156,33,168,242,212,57,87,80,53,158,14,206,24,84,29,15,6,23,27,84,73,173,229,11,170,44,213,205,18,84,197,126,14,26,84,33,222,45,99,80,21,248,180,84,65,53,210,147,101,13,170,68,143,178,236,65,149,209,221,108,97,65,149,214,228,12,65,149,167,206,185,130,170,191,233,95,174,160,26,222,36,112,25,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,86,205,151,16,84,93,165,243,229,7,85,90,147,51,4,85,158,58,231,10,170,198,211,193,25,131,170,227,193,224,98,131,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,212,65,117,208,23,218,172,154,91,250,13,231,8,170,19,121,2,123,33,207,31,84,153,154,204,19,84,35,212,153,61,168,182,205,188,141,167,131,60,59,99,130,106,47,69,60,242,114,4,213,80,173,101,8,170,18,213,229,11,170,70,143,117,177,159,139,15,170,35,41,162,49,150,58,168,178,180,150,54,168,138,85,55,111,80,53,171,230,75,8,170,174,210,249,242,131,42,173,201,25,130,42,79,157,115,5,85,227,233,224,140,65,213,241,96,112,177,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,86,205,151,16,84,93,165,243,229,7,85,90,147,51,4,85,158,58,231,10,170,198,211,193,25,131,170,227,193,224,98,131,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,149,56,208,46,123,80,101,28,133,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,66,100,174,160,26,126,162,228,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,50,104,80,237,164,125,249,82,116,12,232,27,95,228,122,249,82,30,85,125,242,4,54,78,166,101,67,34,239,24,121,160,234,27,123,208,106,117,40,196,224,17,120,160,170,79,64,172,199,211,182,103,28,13,234,177,179,150,238,109,4,2,133,167,130,82,18,37,195,29,79,107,78,125,33,208,38,87,29,79,105,114,140,113,142,6,125,227,137,97,122,6,200,49,38,61,21,148,146,40,21,198,152,90,115,234,11,128,177,8,213,241,148,38,77,85,93,65,140,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,149,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,149,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,
-181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,212,65,149,115,12,104,142,160,42,61,1,116,254,160,202,212,100,158,160,26,161,206,236,65,53,232,104,208,228,65,149,125,42,232,204,65,53,84,107,25,130,170,68,117,249,130,106,248,209,160,41,131,170,236,84,208,249,130,42,75,107,105,131,170,88,117,243,6,85,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,82,7,85,206,49,160,57,130,170,244,4,208,249,131,42,83,147,121,130,106,132,58,179,7,213,160,163,65,147,7,85,246,169,160,51,7,213,80,173,101,8,170,18,213,229,11,170,225,71,131,166,12,170,178,83,65,231,11,170,44,173,165,13,170,98,213,205,27,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,203,26,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,203,26,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,75,29,84,57,199,128,230,8,170,210,19,64,231,15,170,76,77,230,9,170,17,234,204,30,84,131,142,6,77,30,84,217,167,130,206,28,84,67,181,150,33,168,74,84,151,47,168,134,31,13,154,50,168,202,78,5,157,47,168,178,180,150,54,168,138,85,55,111,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,12,26,84,251,3,115,251,142,235,91,243,69,198,173,113,14,193,118,242,204,247,245,47,214,147,171,149,159,53,207,226,117,147,182,182,64,230,176,177,170,97,200,219,224,246,168,255,97,242,81,108,222,250,9,70,12,162,112,29,191,60,224,216,112,185,150,90,228,173,214,148,159,160,124,8,53,113,215,16,44,16,56,85,71,163,250,172,62,224,208,53,33,157,15,93,53,183,71,253,15,8,93,61,193,12,232,210,92,174,165,22,177,161,107,68,48,31,186,52,135,14,2,98,179,91,209,53,33,157,15,93,53,183,71,253,15,8,93,61,193,12,232,210,92,174,163,0,224,39,152,15,93,238,243,177,227,35,99,208,41,215,105,34,227,244,248,229,200,200,232,63,68,25,28,25,29,167,251,202,35,99,192,25,189,233,209,53,56,84,17,139,46,231,33,137,41,209,101,158,67,10,65,151,235,52,209,100,232,226,91,132,64,87,156,
-29,162,208,53,56,93,12,139,46,231,105,97,41,209,101,30,200,7,65,151,235,88,189,100,232,226,91,132,64,87,156,29,162,208,53,56,102,7,139,46,231,177,57,41,209,101,158,76,5,65,151,235,124,169,100,232,226,91,132,64,87,156,29,162,208,117,179,75,230,187,52,233,236,232,82,76,177,232,82,4,243,162,139,111,17,2,93,113,118,136,66,215,230,122,151,10,93,154,116,118,116,41,166,88,116,41,130,121,209,197,183,8,129,174,56,59,176,235,93,174,243,191,0,245,174,144,83,188,18,213,187,38,199,75,197,214,187,188,135,68,161,235,93,246,211,139,34,234,93,244,25,68,25,208,133,205,25,131,142,179,73,138,46,92,206,232,63,45,37,29,186,48,57,99,192,97,28,25,208,133,205,25,131,206,117,72,138,46,92,206,232,63,54,32,29,186,48,57,99,64,87,250,12,232,194,230,140,65,13,206,147,162,11,151,51,250,251,103,167,67,23,38,103,12,104,207,156,1,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,243,161,203,217,223,60,30,93,65,93,202,211,160,107,218,62,59,18,93,254,38,216,96,116,57,186,51,203,209,21,208,99,57,3,186,176,57,99,80,187,222,164,232,194,229,140,254,110,176,233,208,133,201,25,3,154,141,102,64,23,54,103,12,234,91,153,20,93,184,156,209,223,22,49,29,186,48,57,99,64,215,189,12,232,194,230,140,65,13,220,146,162,11,151,51,250,251,131,165,67,23,38,103,12,104,63,149,1,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,243,161,203,217,191,45,30,93,65,93,216,210,160,107,218,30,44,18,93,254,38,95,96,116,57,186,79,201,209,21,208,67,42,3,186,176,57,99,80,59,162,164,232,194,229,140,254,110,55,233,208,133,201,25,3,154,169,100,64,23,54,103,12,234,203,145,20,93,184,156,209,223,246,33,29,186,48,57,99,64,87,129,12,232,194,230,140,65,47,168,39,69,23,46,103,244,191,255,156,14,93,152,156,49,224,245,218,12,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,103,66,23,54,103,156,144,206,142,46,92,206,216,19,204,139,46,76,206,56,34,152,15,93,53,150,211,228,140,19,210,249,208,85,179,70,230,140,61,193,12,232,210,30,18,154,51,142,8,206,132,46,108,206,56,33,157,29,93,184,156,177,39,152,23,93,152,156,113,68,112,38,116,97,115,198,9,233,236,232,194,229,140,61,193,188,232,194,228,140,35,130,51,161,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,243,161,171,230,150,38,103,156,144,206,135,174,154,53,50,103,236,9,102,64,151,198,48,52,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,103,66,23,54,103,156,144,206,142,46,92,206,216,19,204,139,46,76,206,56,34,56,19,186,176,57,227,132,116,118,116,225,114,198,158,96,94,116,97,114,198,17,193,153,208,133,205,25,39,164,179,163,11,151,51,246,4,243,162,11,147,51,142,8,166,66,87,207,243,133,172,167,248,43,171,225,95,140,0,246,34,190,171,184,155,17,105,159,23,188,190,226,175,108,48,120,49,4,217,11,121,103,113,23,249,128,97,176,122,139,191,178,65,225,197,16,104,47,228,221,197,93,228,105,71,246,66,214,95,156,139,52,113,135,113,4,210,194,122,140,179,144,198,239,50,30,133,52,70,159,241,80,164,9,59,141,35,144,198,234,53,206,69,154,184,219,56,2,105,97,253,198,89,72,227,119,28,143,66,26,163,231,120,40,210,132,93,199,17,72,99,245,29,103,71,79,105,231,113,72,244,12,234,61,206,139,158,236,238,227,113,209,51,188,255,120,112,244,148,117,32,135,35,141,170,246,69,33,141,83,249,3,34,141,168,193,74,144,198,168,194,162,144,198,183,12,137,180,56,123,68,34,
-141,170,252,69,33,141,83,5,4,34,141,168,199,74,144,198,168,200,162,144,198,183,12,137,180,56,123,68,34,141,170,2,70,33,141,83,17,4,34,141,168,205,74,144,198,168,206,162,144,198,183,12,137,180,56,123,68,34,141,170,8,70,33,141,83,29,4,34,141,168,211,74,144,198,168,212,162,144,198,183,12,137,180,56,123,68,34,141,170,14,70,33,141,83,41,4,34,141,168,217,74,144,198,168,218,162,144,198,183,12,137,180,56,123,8,234,105,156,254,229,236,122,154,180,131,57,164,158,22,212,195,156,87,79,99,119,49,143,171,167,133,247,49,15,174,167,201,58,153,195,145,134,206,61,197,221,204,129,72,67,230,158,252,142,230,40,164,161,114,79,97,87,115,56,210,208,185,167,184,179,57,16,105,200,220,147,223,221,28,133,52,84,238,41,236,112,14,71,26,58,247,20,119,57,7,34,13,153,123,242,59,157,163,144,134,202,61,133,221,206,225,72,67,231,158,226,142,231,64,164,33,115,79,126,215,115,20,210,80,185,167,176,243,57,28,105,232,220,83,220,253,28,136,52,100,238,201,239,128,142,66,26,42,247,20,118,65,71,32,141,213,7,157,139,52,113,39,116,4,210,194,122,161,179,144,198,239,134,30,133,52,70,63,244,80,164,9,59,162,195,145,134,206,61,197,93,209,129,72,67,230,158,252,206,232,40,164,161,114,79,97,119,116,56,210,208,185,167,184,67,58,16,105,200,220,147,223,37,29,133,52,84,238,41,236,148,14,71,26,58,247,20,119,75,7,34,13,153,123,242,59,166,163,144,134,202,61,133,93,211,225,72,67,231,158,226,206,233,64,164,33,115,79,126,247,116,20,210,80,185,167,176,131,58,28,105,232,220,83,220,69,29,136,52,100,238,201,239,164,142,66,26,42,247,20,118,83,71,32,141,213,79,157,139,52,113,71,117,4,210,194,122,170,179,144,198,239,170,30,133,52,70,95,245,80,164,9,59,171,195,145,134,206,61,197,221,213,129,72,67,230,158,252,14,235,40,164,161,114,79,97,151,117,56,210,208,185,167,184,211,58,16,105,200,220,147,223,109,29,133,52,84,238,41,236,184,14,71,26,58,247,20,119,93,7,34,13,153,123,242,59,175,163,144,134,202,61,133,221,215,225,72,67,231,158,226,14,236,64,164,33,115,79,126,23,118,20,210,80,185,167,176,19,59,28,105,232,220,83,220,141,29,136,52,100,238,201,239,200,142,66,26,42,247,20,118,101,71,32,141,213,151,157,139,52,113,103,118,4,210,194,122,179,179,144,198,239,206,30,133,52,70,127,246,80,164,9,59,180,195,145,134,206,61,197,93,218,129,72,67,230,158,252,78,237,40,164,161,114,79,97,183,118,56,210,208,185,167,184,99,59,16,105,200,220,147,223,181,29,133,52,84,238,41,236,220,14,71,26,58,247,20,119,111,7,34,13,153,123,242,59,184,163,144,134,202,61,133,93,220,225,72,67,231,158,226,78,238,64,164,33,115,79,126,55,119,20,210,80,185,167,176,163,59,28,105,232,220,83,220,213,29,136,52,100,238,201,239,236,142,66,26,42,247,20,118,119,71,32,141,213,223,157,139,52,113,135,119,4,210,194,122,188,179,144,198,239,242,30,133,52,70,159,247,80,164,9,59,189,195,145,134,206,61,197,221,222,129,72,67,230,158,252,142,239,40,164,161,114,79,97,215,119,56,210,208,185,167,184,243,59,16,105,200,220,147,223,253,29,133,52,84,238,41,236,0,15,71,26,58,247,20,119,129,7,34,13,153,123,242,59,193,163,144,134,202,61,133,221,224,225,72,67,231,158,226,142,240,64,164,33,115,79,126,87,120,20,210,80,185,167,176,51,60,28,105,232,220,83,220,29,30,136,52,100,238,201,239,16,143,66,26,42,247,20,118,137,103,35,173,227,250,82,212,37,254,123,235,241,0,47,135,64,123,25,221,35,222,205,134,178,207,75,86,135,120,27,31,197,230,173,159,96,196,32,52,113,122,8,156,238,240,223,219,14,10,120,57,0,216,75,113,111,120,23,113,210,145,189,20,117,134,103,162,75,218,23,30,128,174,160,174,240,28,116,177,123,194,199,160,43,188,35,124,32,186,100,253,224,1,232,226,116,131,103,162,75,218,11,30,128,174,160,78,240,28,116,177,251,192,199,160,43,188,11,124,32,186,100,61,224,1,232,226,116,128,231,70,70,97,255,119,68,100,12,233,254,206,138,140,220,222,239,81,145,49,184,243,123,104,100,20,245,125,
-71,163,139,168,247,197,160,139,81,247,195,161,203,95,133,21,160,43,188,6,11,66,23,223,34,4,186,226,236,16,133,46,162,198,23,131,46,70,173,15,135,46,127,229,85,128,174,240,186,43,8,93,124,139,16,232,138,179,67,20,186,136,186,94,12,186,24,245,61,28,186,252,213,86,1,186,194,107,173,32,116,241,45,66,160,43,206,14,81,232,34,106,121,49,232,98,212,244,112,232,242,87,88,5,232,10,175,175,130,208,197,183,8,129,174,56,59,68,161,139,168,223,197,160,139,81,199,195,161,203,95,85,21,160,43,188,166,10,66,23,223,34,4,186,226,236,192,174,119,49,58,183,115,235,93,194,190,237,136,122,87,72,215,118,86,189,139,219,179,61,170,222,21,220,177,61,180,222,37,234,215,142,70,23,54,103,148,246,106,199,161,11,151,51,178,251,180,131,208,133,201,25,101,61,218,209,232,194,230,140,210,254,236,56,116,225,114,70,118,111,118,16,186,48,57,163,172,47,59,26,93,216,156,81,218,147,29,135,46,92,206,200,238,199,14,66,23,38,103,148,245,98,71,163,11,155,51,74,251,176,227,208,133,203,25,217,61,216,65,232,194,228,140,178,254,235,104,116,97,115,70,105,239,117,28,186,112,57,35,187,239,58,8,93,152,156,81,214,115,29,128,46,78,199,117,38,186,164,253,214,1,232,10,234,182,206,65,23,187,215,122,12,186,194,59,173,7,162,75,214,103,29,141,46,108,206,40,237,177,142,67,23,46,103,100,247,87,7,161,11,147,51,202,122,171,163,209,133,205,25,165,125,213,113,232,194,229,140,236,158,234,32,116,97,114,70,89,63,117,52,186,176,57,163,180,151,58,14,93,184,156,145,221,71,29,132,46,76,206,40,235,161,142,70,23,54,103,148,246,79,199,161,11,151,51,178,123,167,131,208,133,201,25,101,125,211,209,232,194,230,140,210,158,233,56,116,225,114,70,118,191,116,16,186,48,57,163,172,87,58,0,93,156,78,233,76,116,73,251,164,3,208,21,212,37,157,131,46,118,143,244,24,116,133,119,72,15,68,151,172,63,58,26,93,216,156,81,218,27,29,135,46,92,206,200,238,139,14,66,23,38,103,148,245,68,71,163,11,155,51,74,251,161,227,208,133,203,25,217,189,208,65,232,194,228,140,178,62,232,104,116,97,115,70,105,15,116,28,186,112,57,35,187,255,57,8,93,152,156,81,214,251,28,141,46,108,206,40,237,123,142,67,23,46,103,100,247,60,7,161,11,147,51,202,250,157,163,209,133,205,25,165,189,206,113,232,194,229,140,236,62,231,32,116,97,114,70,89,143,115,0,186,56,29,206,153,232,146,246,55,7,160,43,168,187,57,7,93,236,222,230,49,232,10,239,108,30,136,46,89,95,115,52,186,176,57,163,180,167,57,14,93,184,156,145,221,207,28,132,46,76,206,40,235,101,142,70,23,54,103,148,246,49,199,161,11,151,51,178,123,152,131,208,133,201,25,101,253,203,209,232,194,230,140,210,222,229,56,116,225,114,70,118,223,114,16,186,48,57,163,172,103,57,26,93,216,156,81,218,175,28,135,46,92,206,200,238,85,14,66,23,38,103,148,245,41,71,163,11,155,51,74,123,148,227,208,133,203,25,217,253,201,65,232,194,228,140,178,222,228,0,116,113,58,147,51,209,37,237,75,14,64,87,80,87,114,14,186,216,61,201,99,208,21,222,145,60,16,93,178,126,228,104,116,97,115,70,105,47,114,28,186,112,57,35,187,15,57,8,93,152,156,81,214,131,28,141,46,108,206,40,237,63,142,67,23,46,103,100,247,30,7,161,11,147,51,202,250,142,163,209,133,205,25,165,61,199,113,232,194,229,140,236,126,227,32,116,97,114,70,89,175,113,52,186,176,57,163,180,207,56,14,93,184,156,145,221,99,28,132,46,76,206,40,235,47,142,70,23,54,103,148,246,22,199,161,11,151,51,178,251,138,131,208,133,201,25,101,61,197,217,232,234,121,190,144,245,20,183,54,149,127,57,234,94,239,35,30,58,50,55,35,210,62,47,120,125,197,109,237,229,95,14,187,215,219,72,70,12,164,38,31,48,12,86,111,113,91,123,249,151,195,238,245,54,146,242,97,52,228,105,71,246,66,214,95,156,139,52,113,135,113,4,210,194,122,140,179,144,198,239,50,30,133,52,70,159,241,80,164,9,59,141,35,144,198,234,53,206,69,154,184,219,56,2,105,97,253,198,89,72,227,119,28,143,66,26,163,231,120,40,210,132,93,
-199,17,72,99,245,29,103,71,79,105,231,113,72,244,12,234,61,206,139,158,236,238,227,113,209,51,188,255,120,112,244,148,117,32,135,35,141,170,246,69,33,141,83,249,3,34,141,168,193,74,144,198,168,194,162,144,198,183,12,137,180,56,123,68,34,141,170,252,69,33,141,83,5,4,34,141,168,199,74,144,198,168,200,162,144,198,183,12,137,180,56,123,68,34,141,170,2,70,33,141,83,17,4,34,141,168,205,74,144,198,168,206,162,144,198,183,12,137,180,56,123,68,34,141,170,8,70,33,141,83,29,4,34,141,168,211,74,144,198,168,212,162,144,198,183,12,137,180,56,123,68,34,141,170,14,70,33,141,83,41,4,34,141,168,217,74,144,198,168,218,162,144,198,183,12,137,180,56,123,8,234,105,156,254,229,236,122,154,180,131,57,164,158,22,212,195,156,87,79,99,119,49,143,171,167,133,247,49,15,174,167,201,58,153,195,145,134,206,61,197,221,204,129,72,67,230,158,252,142,230,40,164,161,114,79,97,87,115,56,210,208,185,167,184,179,57,16,105,200,220,147,223,221,28,133,52,84,238,41,236,112,14,71,26,58,247,20,119,57,7,34,13,153,123,242,59,157,163,144,134,202,61,133,221,206,225,72,67,231,158,226,142,231,64,164,33,115,79,126,215,115,20,210,80,185,167,176,243,57,28,105,232,220,83,220,253,28,136,52,100,238,201,239,128,142,66,26,42,247,20,118,65,71,32,141,213,7,157,139,52,113,39,116,4,210,194,122,161,179,144,198,239,134,30,133,52,70,63,244,80,164,9,59,162,195,145,134,206,61,197,93,209,129,72,67,230,158,252,206,232,40,164,161,114,79,97,119,116,56,210,208,185,167,184,67,58,16,105,200,220,147,223,37,29,133,52,84,238,41,236,148,14,71,26,58,247,20,119,75,7,34,13,153,123,242,59,166,163,144,134,202,61,133,93,211,225,72,67,231,158,226,206,233,64,164,33,115,79,126,247,116,20,210,80,185,167,176,131,58,28,105,232,220,83,220,69,29,136,52,100,238,201,239,164,142,66,26,42,247,20,118,83,71,32,141,213,79,157,139,52,113,71,117,4,210,194,122,170,179,144,198,239,170,30,133,52,70,95,245,80,164,9,59,171,195,145,134,206,61,197,221,213,129,72,67,230,158,252,14,235,40,164,161,114,79,97,151,117,56,210,208,185,167,184,211,58,16,105,200,220,147,223,109,29,133,52,84,238,41,236,184,14,71,26,58,247,20,119,93,7,34,13,153,123,242,59,175,163,144,134,202,61,133,221,215,225,72,67,231,158,226,14,236,64,164,33,115,79,126,23,118,20,210,80,185,167,176,19,59,28,105,232,220,83,220,141,29,136,52,100,238,201,239,200,142,66,26,42,247,20,118,101,71,32,141,213,151,157,139,52,113,103,118,4,210,194,122,179,179,144,198,239,206,30,133,52,70,127,246,80,164,9,59,180,195,145,134,206,61,197,93,218,129,72,67,230,158,252,78,237,40,164,161,114,79,97,183,118,56,210,208,185,167,184,99,59,16,105,200,220,147,223,181,29,133,52,84,238,41,236,220,14,71,26,58,247,20,119,111,7,34,13,153,123,242,59,184,163,144,134,202,61,133,93,220,225,72,67,231,158,226,78,238,64,164,33,115,79,126,55,119,20,210,80,185,167,176,163,59,28,105,232,220,83,220,213,29,136,52,100,238,201,239,236,142,66,26,42,247,20,118,119,71,32,141,213,223,157,139,52,113,135,119,4,210,194,122,188,179,144,198,239,242,30,133,52,70,159,247,80,164,9,59,189,195,145,134,206,61,197,221,222,129,72,67,230,158,252,142,239,40,164,161,114,79,97,215,119,56,210,208,185,167,184,243,59,16,105,200,220,147,223,253,29,133,52,84,238,41,236,0,15,71,26,58,247,20,119,129,7,34,13,153,123,242,59,193,163,144,134,202,61,133,221,224,225,72,67,231,158,226,142,240,64,164,33,115,79,126,87,120,20,210,80,185,167,176,51,60,28,105,232,220,83,220,29,30,136,52,100,238,201,239,16,143,66,26,42,247,20,118,137,103,35,173,227,250,66,214,38,254,213,127,218,16,240,98,4,181,23,241,109,226,61,140,40,27,189,224,181,137,183,113,210,140,222,18,36,35,6,82,147,15,24,6,167,77,188,133,207,219,90,95,4,73,249,48,26,242,164,83,123,33,107,19,207,70,154,180,77,60,4,105,65,109,226,121,72,99,183,137,143,67,90,120,155,248,96,164,201,218,196,67,144,
-198,105,19,207,70,154,180,77,60,4,105,65,109,226,121,72,99,183,137,143,67,90,120,155,248,96,164,201,218,196,67,144,198,105,19,207,143,158,194,54,241,152,232,25,210,38,158,25,61,185,109,226,35,163,103,112,155,248,240,232,41,106,19,143,71,26,81,32,140,67,26,163,84,136,68,154,191,116,43,66,90,120,233,22,134,52,190,101,72,164,197,217,35,18,105,68,129,48,14,105,140,82,33,18,105,254,210,173,8,105,225,165,91,24,210,248,150,33,145,22,103,143,72,164,17,5,194,56,164,49,74,133,72,164,249,75,183,34,164,133,151,110,97,72,227,91,134,68,90,156,61,34,145,70,20,8,227,144,198,40,21,34,145,230,47,221,138,144,22,94,186,133,33,141,111,25,18,105,113,246,136,68,26,81,32,140,67,26,163,84,136,68,154,191,116,43,66,90,120,233,22,134,52,190,101,72,164,197,217,67,80,79,99,180,137,231,215,211,132,109,226,49,245,180,144,54,241,204,122,26,183,77,124,100,61,45,184,77,124,120,61,77,212,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,4,105,156,54,241,108,164,73,219,196,67,144,22,212,38,158,135,52,118,155,248,56,164,133,183,137,15,70,154,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,8,210,56,109,226,217,72,147,182,137,135,32,45,168,77,60,15,105,236,54,241,113,72,11,111,19,31,140,52,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,16,164,113,218,196,179,145,38,109,19,15,65,90,80,155,120,30,210,216,109,226,227,144,22,222,38,62,24,105,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,33,72,227,180,137,103,35,77,218,38,30,130,180,160,54,241,60,164,177,219,196,199,33,45,188,77,124,48,210,100,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,243,145,214,113,253,76,214,38,254,71,235,65,1,159,141,160,246,89,124,155,120,15,35,202,70,159,241,218,196,219,56,105,70,111,9,146,17,3,169,201,7,12,131,211,38,254,71,219,145,1,159,13,161,246,153,188,77,188,147,60,233,
-212,62,147,181,137,103,35,77,218,38,30,130,180,160,54,241,60,164,177,219,196,199,33,45,188,77,124,48,210,100,109,226,33,72,227,180,137,103,35,77,218,38,30,130,180,160,54,241,60,164,177,219,196,199,33,45,188,77,124,48,210,100,109,226,33,72,227,180,137,231,71,79,97,155,120,76,244,12,105,19,207,140,158,220,54,241,145,209,51,184,77,124,120,244,20,181,137,199,35,141,40,16,198,33,141,81,42,68,34,205,95,186,21,33,45,188,116,11,67,26,223,50,36,210,226,236,17,137,52,162,64,24,135,52,70,169,16,137,52,127,233,86,132,180,240,210,45,12,105,124,203,144,72,139,179,71,36,210,136,2,97,28,210,24,165,66,36,210,252,165,91,17,210,194,75,183,48,164,241,45,67,34,45,206,30,145,72,35,10,132,113,72,99,148,10,145,72,243,151,110,69,72,11,47,221,194,144,198,183,12,137,180,56,123,68,34,141,40,16,198,33,141,81,42,68,34,205,95,186,21,33,45,188,116,11,67,26,223,50,36,210,226,236,33,168,167,49,218,196,243,235,105,194,54,241,152,122,90,72,155,120,102,61,141,219,38,62,178,158,22,220,38,62,188,158,38,106,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,130,52,78,155,120,54,210,164,109,226,33,72,11,106,19,207,67,26,187,77,124,28,210,194,219,196,7,35,77,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,4,105,156,54,241,108,164,73,219,196,67,144,22,212,38,158,135,52,118,155,248,56,164,133,183,137,15,70,154,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,8,210,56,109,226,217,72,147,182,137,135,32,45,168,77,60,15,105,236,54,241,113,72,11,111,19,31,140,52,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,16,164,113,218,196,179,145,38,109,19,15,65,90,80,155,120,30,210,216,109,226,227,144,22,222,38,62,24,105,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,249,72,235,184,174,239,238,3,250,196,171,228,100,196,242,187,191,252,117,194,243,243,103,95,124,249,197,
-179,98,123,163,209,240,245,23,47,94,124,241,114,8,61,47,51,235,88,99,24,83,54,172,165,113,246,145,103,115,62,51,126,59,98,225,238,241,206,101,241,182,27,27,53,10,140,46,187,17,133,104,50,172,239,188,124,200,164,211,52,193,229,238,67,159,0,201,97,125,233,51,33,217,210,167,30,136,100,87,15,121,52,146,137,214,248,169,145,28,210,215,62,19,146,221,125,238,19,32,57,172,239,125,38,36,91,250,224,3,145,236,234,81,143,70,50,209,122,63,53,146,67,250,230,103,66,178,187,143,126,138,213,69,80,95,253,92,171,139,105,159,125,228,234,194,209,3,31,190,186,240,183,246,79,190,186,8,232,203,63,7,146,7,21,218,212,72,118,214,110,243,34,217,172,173,167,65,114,148,86,3,145,236,42,231,103,68,50,204,158,8,36,15,42,192,169,145,236,172,13,231,69,178,89,187,79,131,228,40,173,6,34,217,245,184,32,35,146,97,246,68,32,121,80,97,78,141,100,103,237,57,47,146,205,103,3,105,144,28,165,213,64,36,187,30,71,100,68,50,204,158,8,36,15,42,216,169,145,236,172,109,231,69,178,249,236,33,13,146,163,180,26,136,100,215,227,142,140,72,134,217,19,129,228,65,133,60,53,146,157,181,243,188,72,54,159,109,164,65,114,148,86,3,145,236,122,156,146,17,201,48,123,74,235,201,206,115,24,82,212,147,131,206,101,200,85,79,158,158,211,128,172,39,59,206,80,128,215,147,253,71,67,36,175,39,7,156,235,48,7,146,83,215,46,194,206,125,200,139,228,68,181,11,215,25,13,137,144,60,87,237,34,228,220,136,57,144,156,186,118,17,118,174,68,94,36,39,170,93,184,206,128,72,132,228,185,106,23,33,231,82,204,129,228,212,181,139,176,115,43,242,34,57,81,237,194,117,198,68,34,36,207,85,187,8,57,247,98,14,36,167,174,93,132,157,139,145,23,201,137,106,23,174,51,44,18,33,121,174,218,69,200,185,26,115,32,57,117,237,34,236,220,141,188,72,78,84,187,112,157,145,145,8,201,115,213,46,66,206,237,200,132,100,247,57,30,9,144,28,118,174,71,38,36,91,206,249,0,34,217,117,6,7,26,201,196,209,34,169,145,28,114,46,200,28,72,78,93,187,8,59,55,36,47,146,19,213,46,92,103,124,36,66,242,92,181,139,144,115,71,230,64,114,234,218,69,216,185,36,121,145,156,168,118,225,58,67,36,17,146,231,170,93,132,156,107,50,7,146,83,215,46,194,206,61,201,139,228,68,181,11,215,25,37,137,144,60,87,237,34,228,220,148,57,144,156,186,118,17,118,174,74,94,36,39,170,93,184,206,64,73,132,228,185,106,23,33,231,178,204,129,228,212,181,139,176,115,91,242,34,57,81,237,194,117,198,74,34,36,207,85,187,8,57,247,37,19,146,221,231,192,36,64,114,216,185,48,153,144,108,57,39,6,136,100,215,25,46,104,36,19,71,211,164,70,114,200,185,50,115,32,57,117,237,34,236,220,153,188,72,78,84,187,112,157,17,147,8,201,115,213,46,66,206,173,153,3,201,169,107,23,97,231,218,228,69,114,162,218,133,235,12,154,68,72,158,171,118,17,114,46,206,28,72,78,93,187,8,59,55,39,47,146,19,213,46,92,103,220,36,66,242,92,181,139,144,115,119,230,64,114,234,218,69,216,185,60,121,145,156,168,118,225,58,67,39,17,146,231,170,93,132,156,235,51,7,146,83,215,46,194,206,253,201,139,228,68,181,11,215,25,61,137,144,60,87,237,34,228,220,160,76,72,118,159,35,148,0,201,97,231,10,101,66,178,229,156,33,32,146,93,103,0,161,145,76,28,109,148,26,201,33,231,18,205,129,228,212,181,139,176,115,139,242,34,57,81,237,194,117,198,80,34,36,207,85,187,8,57,247,104,14,36,167,174,93,132,157,139,148,23,201,137,106,23,174,51,140,18,33,121,174,218,69,200,185,74,115,32,57,117,237,34,236,220,165,188,72,78,84,187,112,157,145,148,8,201,115,213,46,66,206,109,154,3,201,169,107,23,97,231,58,229,69,114,162,218,133,235,12,166,68,72,158,171,118,17,114,46,212,28,72,78,93,187,8,59,55,42,47,146,19,213,46,92,103,60,37,66,242,92,181,139,144,115,167,50,33,217,125,14,85,2,36,135,157,75,149,9,201,150,115,170,128,72,118,157,33,133,70,50,113,52,86,106,36,135,156,107,53,7,146,83,215,46,194,206,189,202,139,228,68,181,
-11,215,25,85,137,144,60,87,237,34,228,220,172,57,144,156,186,118,17,118,174,86,94,36,39,170,93,184,206,192,74,132,228,185,106,23,33,231,114,205,129,228,212,181,139,176,115,187,242,34,57,81,237,194,117,198,86,34,36,207,85,187,8,57,247,107,14,36,167,174,93,132,157,11,150,23,201,137,106,23,174,51,188,18,33,121,174,218,69,200,185,98,115,32,57,117,237,34,236,220,177,188,72,78,84,187,112,157,17,150,8,201,115,213,46,66,206,45,75,128,228,78,138,235,178,122,95,150,251,179,54,86,251,143,87,207,254,113,185,59,12,62,190,219,154,31,61,231,169,125,251,234,151,255,253,234,213,143,189,108,223,158,25,20,175,127,42,148,24,197,159,127,40,182,251,245,238,225,180,125,44,13,101,8,196,8,60,226,141,39,18,101,180,80,57,235,191,230,84,84,253,215,178,84,212,136,52,35,150,108,2,44,84,69,249,241,51,100,157,85,45,99,225,174,78,31,21,185,234,184,93,143,196,124,124,54,252,248,156,7,165,142,172,77,222,183,207,106,121,223,62,47,46,14,199,226,113,187,46,139,199,242,120,90,61,241,169,81,38,41,79,185,177,82,7,130,145,49,148,64,112,206,170,110,1,138,23,160,232,70,234,101,227,218,38,227,191,174,162,23,137,229,161,116,203,80,110,239,165,87,143,183,23,195,103,49,106,229,106,10,179,94,237,214,234,162,94,128,149,98,178,186,45,139,195,77,177,63,236,63,223,111,119,197,227,106,247,160,136,31,110,220,139,84,7,191,145,58,226,120,187,217,60,41,46,234,197,121,81,23,157,130,88,104,213,238,31,238,174,203,35,155,219,112,80,120,206,100,232,53,228,105,31,75,100,51,170,229,249,64,10,163,54,195,202,101,212,233,160,230,53,106,91,161,207,102,84,75,169,60,133,81,155,97,229,50,234,116,80,243,26,181,45,86,103,51,170,165,106,156,194,168,205,176,114,25,117,58,168,121,141,218,214,109,179,25,213,82,64,77,97,212,102,88,185,140,58,29,212,188,70,109,75,152,217,140,106,169,37,166,48,106,51,172,92,70,157,14,106,6,163,170,149,119,183,112,219,86,206,5,249,250,176,87,44,171,211,246,118,191,218,93,169,95,123,89,214,171,83,85,220,28,15,119,154,86,81,29,244,63,151,69,115,101,81,30,143,106,101,126,216,23,7,117,251,205,238,240,222,204,28,134,172,67,242,2,166,24,214,209,135,202,118,181,63,212,87,48,212,67,75,68,179,96,168,65,168,0,151,249,205,141,104,34,189,87,165,212,252,174,205,97,113,98,96,205,79,171,135,150,136,102,129,48,191,95,1,14,243,15,118,111,73,244,174,8,8,205,239,220,81,21,39,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,254,193,150,39,137,222,21,1,161,249,157,219,144,226,196,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,63,216,39,36,209,187,34,32,52,191,115,239,78,156,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,7,155,107,36,122,87,4,132,230,119,110,120,137,19,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,255,96,71,138,68,239,138,128,208,252,206,93,34,113,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,143,214,187,34,32,52,191,102,13,51,127,47,6,212,252,17,246,232,37,162,89,0,204,79,40,192,181,242,175,142,145,75,238,234,40,93,249,43,214,184,149,127,39,6,118,229,79,171,135,150,136,102,129,88,249,251,21,48,48,127,85,90,235,26,163,189,121,35,189,87,165,175,220,80,149,97,42,30,178,14,217,34,200,20,35,194,252,85,233,45,251,216,229,162,37,162,89,48,212,32,84,128,203,252,158,247,15,195,244,222,150,27,4,230,15,124,39,144,41,6,214,252,180,122,104,137,104,22,8,243,251,21,224,48,191,239,165,189,32,189,159,203,13,124,243,135,190,72,199,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,239,77,183,32,189,159,203,13,124,243,135,190,125,198,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,239,245,176,32,189,159,203,13,124,243,135,190,178,197,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,239,157,170,32,189,159,203,13,124,243,135,190,231,196,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,239,69,164,32,189,159,203,13,
-124,243,135,190,28,196,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,127,180,222,207,229,6,190,249,157,245,142,56,49,160,230,143,176,71,47,17,205,2,96,126,66,1,174,149,191,89,215,16,45,185,219,114,131,96,229,239,170,119,196,137,129,93,249,211,234,161,37,162,89,32,86,254,126,5,152,230,87,73,130,173,174,161,83,16,183,222,213,175,158,114,131,238,200,18,162,226,17,107,219,184,35,197,144,155,95,221,236,43,251,56,228,162,37,162,89,48,212,32,84,128,203,252,70,93,67,166,247,166,220,32,49,191,163,222,17,41,6,214,252,180,122,104,137,104,22,8,243,251,21,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,163,245,222,150,27,4,230,119,213,59,34,197,128,154,63,194,30,189,68,52,11,128,249,9,5,184,86,254,70,93,67,182,228,110,202,13,146,149,191,163,222,17,41,6,118,229,79,171,135,150,136,102,129,88,249,251,21,96,154,95,173,18,109,117,13,189,6,117,235,93,253,234,41,55,232,246,165,33,42,30,177,182,141,59,82,12,185,249,213,205,190,178,143,67,46,90,34,154,5,67,13,66,5,184,204,111,212,53,100,122,111,202,13,18,243,59,234,29,145,98,96,205,79,171,135,150,136,102,129,48,191,95,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,63,90,239,109,185,65,96,126,87,189,35,82,12,168,249,35,236,209,75,68,179,0,152,159,80,128,107,229,111,212,53,100,75,238,166,220,32,89,249,59,234,29,145,98,96,87,254,180,122,104,137,104,22,136,149,191,95,1,166,249,213,50,193,86,215,208,139,16,183,222,213,175,158,114,131,62,235,35,68,197,35,214,182,113,71,138,33,55,191,186,217,87,246,113,200,69,75,68,179,96,168,65,168,0,151,249,141,186,134,76,239,77,185,65,98,126,71,189,35,82,12,172,249,105,245,208,18,209,44,16,230,247,43,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,71,235,189,45,55,8,204,239,170,119,68,138,1,53,127,132,61,122,137,104,22,0,243,19,10,112,173,252,141,186,134,108,201,221,148,27,36,43,127,71,189,35,82,12,236,202,159,86,15,45,17,205,2,177,242,247,43,192,52,191,138,19,182,186,134,142,66,110,189,171,95,61,229,6,125,48,102,136,138,71,172,109,227,142,20,67,110,126,117,179,175,236,227,144,139,150,136,102,193,80,131,80,1,46,243,27,117,13,153,222,155,114,131,196,252,142,122,71,164,24,88,243,211,234,161,37,162,89,32,204,239,87,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,
-41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,143,214,123,91,110,16,152,223,85,239,136,20,3,106,254,8,123,244,18,209,44,0,230,39,20,224,90,249,27,117,13,217,146,187,41,55,72,86,254,142,122,71,164,24,216,149,63,173,30,90,34,154,5,98,229,239,87,128,105,126,229,40,108,117,13,237,134,220,122,215,167,168,185,203,13,245,105,100,1,42,30,177,182,141,59,82,12,185,249,213,205,190,178,143,67,46,90,34,154,5,67,13,66,5,184,204,111,212,53,100,122,111,202,13,18,243,59,234,29,145,98,96,205,79,171,135,150,136,102,129,48,191,95,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,63,90,239,109,185,65,96,126,87,189,35,82,12,168,249,35,236,209,75,68,179,0,152,159,80,128,107,229,111,212,53,100,75,238,166,220,32,89,249,59,234,29,145,98,96,87,254,180,122,104,137,104,22,136,149,191,95,1,166,249,21,23,91,93,67,51,119,235,93,253,234,41,55,168,95,131,84,60,98,109,27,119,164,24,114,243,171,155,125,101,31,135,92,180,68,52,11,134,26,132,10,112,153,223,168,107,200,244,222,148,27,36,230,119,212,59,34,197,192,154,159,86,15,45,17,205,2,97,126,191,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,127,180,222,219,114,131,192,252,174,122,71,164,24,80,243,71,216,163,151,136,102,1,48,63,161,0,215,202,223,168,107,200,150,220,77,185,65,178,242,119,212,59,34,197,192,174,252,105,245,208,18,209,44,16,43,127,191,2,6,29,189,171,142,249,106,255,177,239,33,173,4,241,180,210,174,142,54,182,138,64,221,73,186,58,134,117,205,30,178,182,182,178,142,19,35,162,163,119,117,28,219,38,64,61,180,68,52,11,134,26,132,10,24,116,246,186,169,222,149,251,114,119,42,47,30,117,213,233,178,184,126,214,201,114,245,236,31,234,243,115,243,243,89,162,230,147,41,83,67,169,23,231,135,155,207,245,23,159,107,218,197,225,190,60,174,170,173,210,181,146,107,117,58,149,119,215,187,178,88,21,106,32,155,173,254,94,153,67,17,122,216,17,194,61,62,107,56,47,76,172,177,206,30,159,55,127,206,37,150,89,69,52,116,182,40,177,254,69,116,182,12,156,121,53,55,131,136,221,255,238,14,155,7,117,221,122,181,91,155,146,159,254,89,30,15,122,118,84,165,150,103,91,153,114,60,174,142,63,252,252,127,94,189,249,169,23,229,111,251,213,241,99,177,126,87,174,127,45,110,148,83,214,183,23,135,155,226,237,239,108,84,79,239,170,4,84,183,251,20,84,85,26,158,128,170,202,238,18,80,85,73,67,60,85,131,236,126,187,83,84,21,
-16,29,84,127,252,225,181,155,168,186,217,74,243,80,145,100,127,250,197,79,185,38,49,37,174,190,111,28,186,149,174,162,218,147,124,83,86,15,234,14,53,125,138,111,15,135,93,185,210,157,26,85,72,62,149,166,98,91,130,205,28,168,74,31,193,70,70,197,245,253,86,77,70,117,227,196,74,13,177,6,250,250,36,15,0,177,6,241,186,63,36,128,88,3,116,221,117,64,68,172,95,22,169,197,153,71,107,63,255,240,253,143,99,122,250,150,226,226,243,103,151,95,94,170,240,49,22,175,37,216,58,13,28,193,214,95,224,8,182,174,2,71,176,245,18,56,130,173,131,136,32,216,81,92,93,159,60,86,254,230,219,159,199,244,212,13,135,221,67,85,22,143,171,221,67,57,145,176,161,231,154,30,82,122,174,25,34,165,231,154,36,82,122,141,133,245,59,31,24,122,141,129,245,102,2,41,189,142,224,231,62,215,247,234,251,49,185,125,121,219,44,63,198,130,125,238,243,122,76,58,78,135,199,164,227,244,117,76,58,46,243,113,233,184,204,22,66,167,35,244,239,255,238,177,216,15,63,126,247,166,73,155,199,4,223,22,255,94,60,51,5,170,233,184,44,198,165,227,178,24,151,142,203,98,92,58,46,139,113,233,184,44,22,64,167,183,188,111,138,253,233,149,155,208,231,67,129,62,247,77,49,46,29,151,193,184,116,92,6,227,210,113,25,140,75,199,101,176,0,58,189,229,47,84,94,169,76,117,169,114,221,198,110,150,72,245,167,63,141,201,181,139,205,183,207,20,2,222,62,191,44,110,31,86,199,213,190,42,245,2,170,171,93,21,215,31,85,126,166,47,220,238,111,139,221,234,120,91,30,139,234,227,253,96,65,106,10,208,24,220,18,218,114,9,208,32,197,18,11,115,9,208,64,195,18,236,146,11,160,207,60,236,48,48,135,9,90,1,230,195,64,43,192,124,24,104,5,152,15,3,250,0,132,14,3,115,104,160,21,160,193,192,140,2,204,135,129,86,128,249,48,160,187,33,206,42,128,126,47,191,3,225,140,2,52,32,156,81,128,6,132,51,10,208,172,119,102,20,32,43,8,205,236,133,92,18,253,252,183,111,221,18,124,30,169,130,207,3,150,68,217,4,112,185,194,108,2,184,64,144,94,0,98,73,148,77,128,249,48,64,44,137,178,9,48,31,6,136,37,81,54,1,92,75,162,108,2,204,135,1,98,73,148,94,0,98,73,148,94,0,98,73,148,77,0,215,146,40,155,0,174,37,81,54,1,92,75,162,108,2,100,5,97,39,193,31,2,150,68,127,249,219,107,183,4,127,136,84,193,31,2,150,68,217,4,112,185,194,108,2,184,64,144,94,0,98,73,148,77,128,249,48,64,44,137,178,9,48,31,6,136,37,81,54,1,92,75,162,108,2,204,135,1,98,73,148,94,0,98,73,148,94,0,98,73,148,77,0,215,146,40,155,0,174,37,81,54,1,92,75,162,108,2,100,5,161,231,193,153,101,203,8,93,167,10,216,247,173,104,118,155,178,131,120,186,185,117,67,92,175,30,78,229,169,248,241,135,215,205,94,9,255,19,57,209,35,65,241,200,60,60,129,35,115,110,163,73,56,50,15,79,224,200,156,27,122,18,142,204,195,19,56,50,231,214,162,132,35,243,240,4,142,204,185,201,41,225,200,60,60,17,35,27,164,10,153,60,8,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,136,145,13,82,232,76,243,140,230,9,28,89,196,46,30,241,200,60,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,49,178,182,180,20,177,9,141,63,50,154,39,112,100,17,187,219,196,35,243,240,4,142,44,98,219,156,120,100,30,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,49,178,65,213,59,147,205,104,158,192,145,53,126,42,239,200,60,60,129,35,107,252,84,222,145,121,120,2,71,214,248,169,188,35,243,240,4,142,44,171,111,164,121,2,71,150,213,55,210,60,17,35,211,141,189,227,246,141,243,71,70,243,4,142,44,98,67,186,120,100,30,158,192,145,69,236,116,23,143,204,195,19,56,178,136,45,244,226,145,121,120,2,71,22,177,55,95,60,50,15,79,224,200,178,250,70,154,167,112,100,158,215,25,44,205,18,232,221,131,33,13,
-202,30,174,25,15,170,21,79,55,183,32,163,125,30,240,208,56,229,200,60,60,129,35,115,21,255,82,142,204,195,19,56,50,87,130,155,114,100,30,158,192,145,185,22,113,41,71,230,225,9,28,153,203,81,165,28,153,135,39,98,100,196,67,227,36,35,163,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,49,50,226,161,113,146,145,209,60,129,35,139,120,183,82,60,50,15,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,140,120,104,156,100,100,52,79,224,200,34,222,57,22,143,204,195,19,56,178,136,151,153,197,35,243,240,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,136,145,17,15,141,147,140,140,230,9,28,153,235,161,113,202,145,121,120,2,71,230,122,104,156,114,100,30,158,192,145,185,30,26,167,28,153,135,39,112,100,89,125,35,205,19,56,178,172,190,145,230,137,24,25,241,208,56,201,200,104,158,192,145,69,180,9,17,143,204,195,19,56,178,136,254,35,226,145,121,120,2,71,22,209,216,68,60,50,15,79,224,200,34,58,166,136,71,230,225,9,28,89,86,223,72,243,20,142,204,211,100,102,250,208,56,224,157,238,128,161,221,61,236,24,15,170,21,79,55,183,32,163,253,33,224,161,113,202,145,121,120,2,71,230,42,254,165,28,153,135,39,112,100,174,4,55,229,200,60,60,129,35,115,45,226,82,142,204,195,19,56,50,151,163,74,57,50,15,79,196,200,136,135,198,73,70,70,243,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,98,100,196,67,227,36,35,163,121,2,71,22,209,241,78,60,50,15,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,140,120,104,156,100,100,52,79,224,200,34,58,65,138,71,230,225,9,28,89,68,139,73,241,200,60,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,98,100,196,67,227,36,35,163,121,2,71,230,122,104,156,114,100,30,158,192,145,185,30,26,167,28,153,135,39,112,100,174,135,198,41,71,230,225,9,28,89,86,223,72,243,4,142,44,171,111,164,121,34,70,70,60,52,78,50,50,154,39,112,100,17,205,155,197,35,243,240,4,142,44,162,43,180,120,100,30,158,192,145,69,180,155,22,143,204,195,19,56,178,136,62,214,226,145,121,120,2,71,150,213,55,210,60,133,35,171,111,91,237,55,109,115,202,234,88,79,231,234,168,31,31,84,71,203,203,226,234,203,142,211,119,135,253,122,85,149,123,245,255,226,245,171,255,247,151,66,19,122,243,195,247,127,254,69,145,158,16,222,182,147,201,69,87,23,174,252,164,235,139,110,139,99,121,175,110,86,151,117,7,108,159,121,118,234,251,98,242,8,220,114,50,241,15,111,221,134,250,34,212,80,83,78,150,179,139,19,113,178,156,70,13,225,180,217,62,50,182,18,40,158,110,110,65,211,234,139,201,99,253,28,214,114,5,173,84,156,242,90,203,195,19,104,45,87,234,128,215,161,43,16,167,226,148,215,90,30,158,64,107,185,210,33,188,14,93,139,139,84,156,242,90,203,195,19,104,45,215,50,6,175,67,87,50,153,82,135,30,158,64,29,186,22,76,41,71,230,225,137,24,217,96,243,74,210,185,60,224,148,20,135,196,134,156,36,214,162,121,2,173,149,97,85,51,224,148,195,90,174,77,70,41,173,229,225,9,180,86,134,85,205,128,83,14,107,181,185,87,86,107,121,120,2,173,149,97,85,51,224,148,195,90,13,167,188,214,242,240,4,90,43,195,170,134,216,118,150,82,135,137,87,53,196,182,179,148,35,75,188,170,25,108,59,75,58,151,7,156,146,226,144,216,74,151,196,90,52,79,160,181,50,172,106,6,156,114,88,203,181,61,48,165,181,60,60,129,214,202,176,170,25,112,202,97,45,215,150,199,148,214,242,240,4,90,43,195,170,102,192,41,135,181,26,78,121,173,229,225,9,180,86,134,85,13,177,97,52,165,14,19,175,106,136,13,163,41,71,150,120,85,51,216,48,154,116,46,15,56,37,197,33,177,9,54,137,181,104,158,64,107,101,88,
-213,12,56,229,176,150,107,99,111,74,107,121,120,2,173,149,97,85,51,224,148,195,90,174,205,202,41,173,229,225,9,180,86,134,85,205,128,83,14,107,185,54,96,167,180,150,135,39,208,90,25,86,53,196,86,239,148,58,76,188,170,33,182,122,167,28,89,226,85,205,96,171,119,82,116,16,155,202,147,232,144,230,9,212,97,134,21,0,177,125,61,165,14,61,60,129,58,204,16,151,137,141,242,41,117,232,225,9,212,97,134,104,73,108,201,79,169,67,15,79,160,14,51,68,75,98,243,127,74,29,38,142,150,196,230,255,148,35,75,28,45,137,205,255,73,70,70,243,4,142,44,109,12,179,143,204,195,19,56,178,180,145,197,62,50,15,79,224,200,210,250,123,251,200,60,60,129,35,75,235,133,237,35,243,240,4,142,44,171,111,164,121,10,71,214,49,252,183,144,46,117,63,121,78,167,251,55,235,208,212,56,182,155,178,184,254,88,252,179,60,30,204,55,42,14,27,78,127,188,159,254,228,230,57,228,225,53,224,191,5,108,201,78,63,74,15,103,248,40,93,91,153,211,143,210,195,25,62,74,215,22,224,244,163,244,112,134,143,210,249,150,105,242,81,122,56,195,71,233,124,171,42,249,40,61,156,113,163,28,108,116,205,138,88,154,51,124,148,206,206,119,201,71,233,225,12,31,165,107,99,101,250,81,122,56,195,71,233,218,144,152,126,148,30,206,240,81,206,224,99,105,206,240,81,206,224,99,105,206,184,81,14,182,221,101,245,177,52,103,248,40,103,240,177,52,103,248,40,157,221,244,146,143,210,195,25,62,74,215,246,168,244,163,244,112,134,143,114,6,31,75,115,134,143,114,6,31,75,115,198,141,114,176,9,40,171,143,165,57,195,71,57,131,143,165,57,195,71,57,131,143,165,57,195,71,233,236,208,151,124,148,30,206,240,81,206,224,99,105,206,240,81,206,224,99,105,206,184,81,82,93,252,210,141,146,230,12,31,165,179,163,95,242,81,122,56,195,71,233,236,238,151,124,148,30,206,240,81,58,59,253,37,31,165,135,51,124,148,51,248,88,154,51,124,148,51,248,88,154,51,110,148,84,55,192,116,163,164,57,195,71,233,236,12,152,124,148,30,206,240,81,58,187,4,38,31,165,135,51,124,148,206,142,129,201,71,233,225,12,31,165,179,123,96,242,81,122,56,195,71,57,131,143,165,57,71,141,178,99,187,218,111,234,71,108,219,102,65,185,173,31,10,111,199,129,235,155,31,173,236,212,215,138,161,169,181,51,57,255,126,1,46,57,226,161,17,151,28,81,57,228,146,35,210,71,146,92,71,175,125,218,233,55,197,79,111,108,212,126,122,51,146,45,104,223,6,139,22,97,4,22,45,194,2,44,90,132,250,9,90,29,177,15,65,218,255,187,157,220,223,39,178,125,8,50,0,151,28,97,3,46,57,194,12,92,114,132,37,72,114,29,189,175,191,14,208,221,235,159,255,236,118,190,95,127,93,123,194,227,106,123,42,141,157,92,15,149,110,128,122,92,237,111,203,226,84,174,15,251,77,113,184,47,213,231,141,225,137,119,167,119,140,189,79,74,12,143,0,30,142,222,232,51,208,128,107,67,82,102,13,120,196,72,173,1,215,102,165,204,26,240,136,145,90,3,174,141,76,153,53,224,17,35,153,6,136,222,115,185,52,64,139,145,90,3,46,183,159,89,3,30,49,82,107,192,181,161,38,179,6,60,98,164,214,128,107,179,77,102,13,120,196,72,166,1,162,91,83,46,13,208,98,164,214,128,171,3,82,102,13,120,196,72,173,1,215,138,53,179,6,60,98,164,214,128,107,67,72,102,13,120,196,72,166,1,162,191,73,46,13,208,98,164,214,128,171,103,72,102,13,120,196,72,173,1,87,31,142,204,26,240,136,145,90,3,174,100,59,179,6,60,98,0,53,208,9,241,242,101,64,102,254,198,167,130,151,47,229,42,56,178,10,4,111,236,42,104,5,144,130,96,160,1,87,102,158,89,3,30,49,82,107,192,149,153,103,214,128,71,140,212,26,112,101,230,153,53,224,17,35,153,6,136,204,60,151,6,104,49,82,107,192,149,153,103,214,128,71,140,212,26,112,101,230,153,53,224,17,35,181,6,92,153,121,102,13,120,196,72,166,1,34,51,207,165,1,90,140,212,26,112,101,230,153,53,224,17,35,181,6,92,153,121,102,13,120,196,72,173,1,87,102,158,89,3,30,49,146,105,128,200,204,115,105,128,22,35,181,6,92,153,121,102,13,
-120,196,72,173,1,87,102,158,89,3,30,49,82,107,192,149,153,103,214,128,71,12,160,6,250,26,73,192,94,142,215,191,88,75,19,163,189,13,95,79,142,122,141,162,116,216,110,52,37,245,79,44,165,97,217,1,64,169,77,223,1,148,218,52,24,64,169,77,39,1,148,154,253,130,8,74,205,158,188,56,60,13,122,61,0,40,1,108,55,72,93,16,148,0,182,27,188,123,143,160,4,176,221,240,29,114,0,37,128,237,6,203,77,4,37,128,237,6,239,244,34,40,1,108,55,124,55,21,64,9,96,187,193,18,1,65,9,96,187,193,187,130,8,74,0,219,13,222,121,67,80,2,216,110,240,238,22,130,18,192,118,131,119,144,16,148,0,182,27,188,75,131,160,4,176,221,224,157,16,4,37,128,237,6,239,54,32,40,201,108,215,147,122,17,178,142,126,101,165,245,98,44,214,139,144,149,52,135,22,181,150,230,208,162,86,211,2,90,78,140,10,104,57,81,42,160,229,196,169,128,150,19,169,2,90,78,172,178,240,69,172,172,5,180,32,118,164,86,215,2,90,16,59,82,43,108,1,45,136,29,169,85,182,128,22,196,142,212,74,91,64,11,98,71,106,181,45,160,5,177,35,181,226,22,208,130,216,145,90,117,11,104,65,236,72,173,188,5,180,32,118,164,86,223,2,90,16,59,82,43,112,1,45,136,29,169,85,184,128,22,196,142,212,74,92,64,11,98,71,106,53,46,160,5,177,35,181,34,23,208,18,218,177,47,239,7,172,201,191,183,174,239,95,142,196,122,25,176,34,103,80,34,214,227,12,74,196,106,156,79,201,133,81,62,37,23,66,249,148,92,248,228,83,114,161,147,79,201,133,77,14,158,252,43,112,62,37,128,237,136,213,55,159,18,192,118,196,202,155,79,9,96,59,98,213,205,167,4,176,29,177,226,230,83,2,216,142,88,109,243,41,1,108,71,172,180,249,148,0,182,35,86,217,124,74,0,219,17,43,108,62,37,128,237,136,213,53,159,18,192,118,196,202,154,79,9,96,59,98,85,205,167,4,176,29,177,162,230,83,2,216,142,88,77,243,41,1,108,71,172,164,249,148,100,182,235,73,133,212,182,191,183,174,201,95,142,215,247,47,67,106,219,44,90,212,90,154,67,139,90,77,11,104,57,49,42,160,229,68,169,128,150,19,167,2,90,78,164,10,104,57,177,202,194,23,177,178,22,208,130,216,145,90,93,11,104,65,236,72,173,176,5,180,32,118,164,86,217,2,90,16,59,82,43,109,1,45,136,29,169,213,182,128,22,196,142,212,138,91,64,11,98,71,106,213,45,160,5,177,35,181,242,22,208,130,216,145,90,125,11,104,65,236,72,173,192,5,180,32,118,164,86,225,2,90,16,59,82,43,113,1,45,136,29,169,213,184,128,22,196,142,212,138,92,64,75,104,199,142,216,139,144,69,249,171,255,180,17,123,49,22,236,69,200,162,156,69,139,88,148,179,104,17,139,114,9,45,23,88,37,180,92,96,149,208,114,129,85,66,203,5,86,9,45,23,88,121,248,242,47,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,18,218,177,35,246,89,200,162,252,71,235,10,255,179,177,96,159,133,44,202,89,180,136,69,57,139,22,177,40,151,208,114,129,85,66,203,5,86,9,45,23,88,37,180,92,96,149,208,114,129,149,135,47,255,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,161,29,59,98,235,187,251,233,170,124,210,118,241,187,191,252,117,66,238,243,103,95,124,249,197,179,98,123,83,111,47,255,226,197,139,47,198,187,108,90,218,195,85,58,150,246,112,213,142,165,77,52,100,69,208,118,181,58,69,208,118,53,17,69,208,118,181,231,68,208,110,
-103,71,18,218,237,108,1,227,123,144,37,36,161,157,4,39,195,44,34,9,237,36,56,25,102,25,73,104,39,193,201,48,11,73,66,59,9,78,134,89,74,18,218,73,112,50,204,98,146,208,78,130,147,97,150,147,132,118,18,156,12,179,160,36,180,147,224,100,152,37,37,161,157,4,39,195,44,42,9,237,36,56,25,102,89,73,104,39,193,201,48,11,75,66,59,9,78,134,89,90,18,218,73,112,50,204,226,146,208,78,130,147,97,150,151,132,54,6,39,29,241,235,178,122,95,150,251,139,235,63,174,246,31,175,158,93,238,14,237,31,239,182,205,31,214,20,243,219,87,191,252,239,87,175,126,236,25,126,123,38,84,188,254,73,159,106,91,252,249,135,98,187,95,239,30,78,219,199,65,103,209,246,178,171,211,71,117,103,117,220,174,59,206,106,136,237,31,207,105,206,221,237,54,17,212,96,181,8,111,159,23,23,135,99,241,184,93,151,197,99,121,60,173,158,216,69,122,84,41,228,197,227,31,31,155,76,82,255,51,86,237,79,63,190,125,245,198,120,39,228,187,213,169,42,222,126,243,250,111,175,138,234,80,223,111,161,215,36,212,56,114,245,28,134,145,107,166,45,140,92,51,83,97,228,154,201,9,35,215,204,71,24,185,102,10,194,200,129,113,215,20,91,228,228,250,169,186,173,250,105,49,157,137,4,57,117,195,96,222,215,196,92,143,126,69,180,28,165,71,9,45,87,233,81,66,203,85,122,148,208,114,149,30,37,180,92,165,71,9,45,87,233,81,66,11,137,47,215,118,128,48,90,61,177,170,52,144,63,13,181,4,181,106,24,241,106,98,206,242,170,132,150,107,57,39,160,229,92,190,9,104,57,151,107,2,90,206,229,153,128,150,115,57,38,160,229,92,126,9,104,33,241,229,44,177,7,209,234,136,41,56,244,200,159,158,189,66,80,83,55,152,146,53,196,26,228,131,104,57,78,70,146,208,114,157,49,36,161,229,58,173,71,66,203,117,238,141,132,86,131,124,12,173,6,249,24,90,72,124,53,200,151,210,234,136,41,19,246,200,159,158,54,66,80,83,55,152,146,53,196,26,228,131,104,57,206,2,146,208,114,157,170,35,161,229,58,159,70,66,203,117,210,139,132,86,131,124,12,173,6,249,24,90,72,124,53,200,151,210,234,207,227,220,223,246,200,159,158,175,65,80,83,55,152,146,53,196,26,228,131,104,57,78,191,145,208,114,157,35,35,161,229,58,145,69,66,203,117,182,137,132,86,131,124,12,173,6,249,24,90,72,124,53,200,151,210,234,136,41,85,245,200,87,31,120,212,212,13,166,100,13,177,6,249,32,90,53,242,49,180,26,228,99,104,53,200,199,208,106,144,143,161,213,32,31,67,171,65,62,134,22,18,95,13,242,165,180,58,98,106,120,61,242,213,7,30,53,117,131,41,89,67,172,65,62,136,86,141,124,12,173,6,249,24,90,13,242,49,180,26,228,99,104,53,200,199,208,106,144,143,161,133,196,87,131,124,41,173,142,216,160,216,207,46,146,142,74,174,102,165,31,68,171,70,62,134,86,131,124,12,173,6,249,24,90,13,242,49,180,26,228,99,104,53,200,199,208,66,226,171,65,190,148,86,159,46,87,71,69,108,181,255,168,211,229,234,200,76,151,171,227,128,216,221,118,127,209,61,177,43,140,71,118,245,191,61,237,111,94,127,167,46,157,60,153,84,223,233,99,249,186,39,117,230,160,213,111,87,251,195,213,126,187,99,112,104,239,32,25,93,22,219,219,253,225,184,221,223,22,234,242,230,220,191,211,128,251,234,67,48,219,213,135,41,191,213,7,247,192,86,31,184,3,235,238,32,25,57,7,166,111,212,151,220,215,230,191,175,177,116,239,50,191,254,193,129,128,251,6,1,93,10,122,83,189,43,247,229,238,84,94,92,215,123,136,171,118,68,55,237,120,44,195,57,189,223,86,235,119,186,60,223,241,248,225,166,229,176,61,21,213,241,161,44,142,205,240,254,242,195,159,254,244,250,85,161,233,23,111,126,248,254,207,191,152,67,217,149,251,219,234,221,197,201,158,1,171,47,155,11,122,46,175,235,207,90,95,63,255,242,230,135,31,191,215,196,238,14,155,135,93,89,172,110,111,143,102,77,233,225,78,143,103,85,253,95,237,138,255,49,173,169,126,251,205,47,234,26,83,73,187,245,195,110,85,53,148,202,91,253,151,186,64,243,250,246,169,113,168,229,136,240,165,50,210,213,246,230,170,188,187,175,62,218,
-159,14,160,56,157,154,191,149,59,136,28,78,161,204,247,174,88,43,11,108,55,250,251,221,246,84,5,50,6,15,215,37,137,199,140,163,2,97,66,51,38,226,52,52,99,4,19,176,25,19,72,226,49,227,104,174,39,52,99,34,78,67,51,70,48,1,155,49,129,36,30,51,142,74,55,9,205,152,136,211,208,140,17,76,192,102,76,32,137,199,140,163,108,44,161,25,19,113,26,154,49,130,9,216,140,9,36,177,137,162,124,119,154,216,168,9,231,137,141,53,167,57,98,227,152,241,140,177,177,53,35,62,98,185,204,152,136,211,28,177,49,196,140,153,98,99,107,70,124,196,114,153,49,17,167,57,98,99,136,25,51,197,198,214,140,248,136,229,50,99,34,78,115,196,198,16,51,102,138,141,106,210,167,113,170,154,112,30,167,90,115,154,195,169,142,25,207,232,84,91,51,226,93,157,203,140,137,56,205,225,84,67,204,152,201,169,182,102,196,187,58,151,25,19,113,154,195,169,134,152,49,147,83,85,104,73,51,27,53,225,60,179,177,230,52,199,108,28,51,158,113,54,182,102,196,207,17,151,25,19,113,154,99,54,134,152,49,211,108,188,217,213,78,117,180,155,4,160,92,77,216,54,174,68,156,134,102,140,96,194,48,227,152,49,120,184,2,51,226,231,136,203,140,137,56,205,49,27,67,204,152,105,54,42,54,105,204,168,9,231,49,99,205,105,14,51,142,25,231,54,227,253,241,176,33,159,27,235,139,252,252,244,21,15,235,106,162,226,49,249,176,199,169,64,126,212,51,100,30,43,202,176,62,246,41,134,46,49,239,180,180,155,214,188,73,249,81,245,243,121,205,155,74,30,159,121,167,213,137,180,230,77,202,143,42,1,205,107,222,84,242,248,204,59,205,147,210,154,55,41,63,42,25,157,215,188,169,228,241,153,119,26,234,211,154,55,41,63,106,61,53,175,121,83,201,99,21,200,249,188,26,163,238,240,167,214,64,126,243,197,94,217,19,236,244,230,77,21,11,195,159,102,39,51,111,206,216,43,123,178,157,222,188,169,98,97,248,83,238,100,230,205,25,123,101,79,188,211,155,55,85,44,12,127,250,157,204,188,57,99,175,236,73,120,66,243,58,159,135,99,212,29,254,84,28,200,111,62,231,44,123,66,158,222,188,169,156,101,248,211,242,100,230,205,233,156,101,79,206,211,155,55,149,179,12,127,138,158,204,188,57,157,179,236,137,122,66,243,58,159,171,99,212,29,254,116,29,200,111,190,217,43,123,210,158,222,188,169,102,83,248,83,247,100,230,205,57,123,101,79,224,19,154,215,249,28,30,163,238,240,167,241,64,126,212,51,249,116,230,149,61,153,79,111,222,84,179,41,252,41,125,50,243,230,156,189,178,39,246,9,205,235,124,110,143,81,119,248,211,123,32,191,249,204,43,123,146,15,50,239,240,127,237,27,226,74,148,211,111,187,175,206,31,235,191,141,166,10,171,99,117,241,164,110,40,82,116,66,253,252,159,175,79,234,223,237,193,232,124,240,115,253,242,123,253,38,253,241,176,214,191,238,111,245,133,154,68,85,234,107,6,125,8,106,194,207,91,202,22,194,207,9,202,247,199,82,93,112,191,221,149,27,45,178,131,203,118,191,173,44,60,244,215,175,246,143,219,227,97,175,111,49,94,215,87,63,108,87,187,237,63,203,162,122,87,22,101,127,77,113,115,56,22,127,249,230,245,160,225,193,227,90,17,55,211,88,69,91,125,217,211,251,190,172,106,66,119,15,187,106,171,155,180,171,145,41,195,84,171,221,225,182,88,31,246,85,249,161,122,90,124,250,99,89,110,212,56,52,139,245,225,168,70,86,245,227,41,54,229,125,185,223,148,251,245,182,60,125,122,177,173,45,244,244,225,94,91,246,178,56,189,59,60,236,54,197,181,130,194,141,146,169,254,237,122,187,223,168,145,107,250,235,7,69,77,209,40,63,148,235,135,74,49,127,162,229,127,216,159,86,55,10,50,237,48,170,227,74,125,177,214,63,95,60,49,135,98,252,96,154,67,91,174,88,237,139,213,67,117,208,223,110,43,147,196,160,181,127,253,235,144,104,243,93,79,238,151,227,246,246,86,73,174,213,212,82,59,220,151,199,149,166,85,107,100,165,213,94,92,239,14,235,95,77,218,171,235,195,113,68,186,254,202,78,185,254,201,79,184,163,92,62,174,118,23,235,187,77,221,126,193,130,252,179,101,140,9,217,32,177,110,85,209,168,90,253,93,104,156,54,19,170,183,166,
-225,21,76,54,151,197,225,161,186,127,168,106,7,0,102,89,92,232,107,14,247,122,220,171,221,199,226,84,234,143,53,187,66,105,66,107,167,253,164,4,41,87,119,79,134,19,104,189,123,216,148,23,55,251,213,93,233,80,72,123,13,41,219,96,150,158,89,223,168,11,77,134,90,43,223,236,110,203,235,227,202,80,142,18,254,78,77,202,94,61,29,255,55,223,112,149,243,251,99,185,91,53,202,40,86,13,167,223,15,12,212,201,162,92,171,242,156,229,241,66,185,198,70,144,78,13,151,234,199,221,213,169,186,171,154,79,167,237,109,163,29,211,27,24,178,61,159,10,167,71,111,136,98,216,171,38,125,167,34,129,150,255,44,68,161,38,198,234,84,220,169,75,111,30,246,245,84,187,44,148,96,79,107,153,46,148,0,251,85,245,112,44,159,152,157,68,110,118,15,167,119,87,202,217,92,20,227,166,249,202,112,221,175,189,112,245,87,181,104,218,67,237,15,239,7,83,238,116,42,213,156,107,250,161,220,157,110,123,60,12,102,97,125,149,233,3,247,122,214,105,107,40,99,172,203,26,136,197,251,119,229,190,184,126,241,66,55,69,49,38,69,199,66,31,67,69,176,248,97,31,200,229,179,23,95,218,88,232,19,140,8,22,175,247,183,28,22,125,116,43,171,183,171,227,118,117,189,43,47,84,64,168,71,83,60,174,142,61,124,234,6,54,77,15,153,98,136,26,227,94,195,233,182,129,164,190,77,7,121,5,231,38,80,106,178,245,197,38,255,91,130,127,49,110,95,115,107,99,250,125,24,211,81,56,81,192,209,147,250,66,255,199,229,53,148,76,87,237,117,61,187,87,123,77,241,139,205,246,164,255,45,78,171,71,29,232,181,0,67,127,166,130,205,122,216,212,104,175,194,232,85,45,229,69,113,234,117,124,42,127,123,80,113,243,60,98,179,164,161,5,232,239,234,101,104,219,243,104,166,250,231,126,232,181,24,45,189,65,123,242,122,245,244,116,42,65,243,148,163,58,254,99,44,71,209,103,233,3,113,212,183,24,145,148,45,249,202,232,110,178,50,62,175,35,156,188,71,24,80,100,235,133,163,75,128,203,102,253,167,165,176,200,210,222,125,165,238,48,165,169,191,28,112,110,22,186,141,80,245,175,131,72,162,87,212,122,45,180,221,124,232,39,193,105,253,174,188,91,53,50,84,26,103,205,159,234,178,242,67,243,231,106,173,215,152,117,71,184,198,82,245,76,25,217,74,93,127,165,232,106,155,189,63,174,238,191,50,14,106,232,126,73,205,212,56,27,72,175,248,180,98,126,223,112,122,90,51,121,90,211,255,125,161,242,135,70,81,13,147,226,87,245,253,31,63,253,228,203,226,115,133,222,83,217,72,244,233,39,207,212,231,237,94,123,189,211,167,159,60,87,31,154,53,230,9,172,211,139,135,237,198,72,127,30,148,245,204,17,63,201,166,231,40,65,254,37,117,127,169,230,167,154,86,251,99,243,97,127,188,210,159,231,131,58,68,158,255,223,89,98,41,19,36,153,140,115,90,140,84,197,250,176,123,184,219,143,117,81,16,120,156,170,62,33,35,82,127,13,233,133,41,144,15,25,160,82,101,204,255,21,21,237,153,181,217,64,28,41,3,75,237,154,242,182,73,196,254,5,12,48,227,36,72,32,87,206,249,113,174,104,108,202,93,181,186,208,99,236,5,252,15,149,99,13,7,80,12,71,160,47,80,132,205,47,138,39,159,126,242,201,224,139,110,140,127,122,245,250,151,111,212,47,147,158,180,205,112,116,202,215,140,166,150,229,247,167,98,117,127,191,219,150,155,167,131,118,180,199,195,127,151,235,170,21,247,84,238,212,7,83,64,192,0,10,143,248,45,251,168,33,156,30,174,199,218,110,101,87,191,14,100,117,137,222,124,238,4,215,31,59,177,245,135,161,204,138,223,68,222,174,106,167,37,86,121,103,163,200,178,197,193,83,0,50,188,106,84,191,60,95,20,12,66,140,254,124,1,86,247,90,249,121,140,153,219,65,78,196,27,124,56,18,146,40,135,180,43,111,170,201,44,121,173,91,66,159,170,242,190,169,118,233,107,116,113,188,60,22,255,125,216,238,21,148,203,51,255,218,219,109,247,251,246,167,226,98,119,121,124,82,28,30,219,231,13,245,157,219,125,93,85,223,110,202,226,66,73,251,228,119,253,40,116,189,173,121,28,116,177,86,38,216,87,74,153,117,218,99,169,203,180,23,78,148,166,249,40,255,184,170,93,232,249,225,
-146,98,166,136,221,108,149,28,205,51,142,134,252,224,233,174,50,123,57,136,35,125,145,166,234,255,92,247,127,234,25,172,27,171,15,234,148,90,186,134,210,40,24,124,83,127,169,159,215,53,207,116,106,236,213,132,159,214,52,139,139,251,195,233,180,189,222,125,236,10,251,245,213,199,242,126,183,90,151,173,102,117,24,56,195,193,184,249,105,209,140,254,212,23,129,246,15,119,215,237,112,15,199,141,250,171,123,98,86,14,134,221,68,19,198,176,143,219,77,61,238,75,125,171,93,1,13,205,145,2,254,86,127,217,151,78,79,231,138,217,84,23,188,225,216,158,222,173,119,229,234,120,85,71,208,11,219,136,70,123,185,180,208,198,45,35,201,191,211,191,212,162,86,77,13,182,150,177,145,215,84,165,130,235,69,225,85,228,19,195,229,15,158,41,110,55,150,217,223,42,166,118,78,173,218,182,10,19,15,247,74,134,30,209,39,93,187,63,172,183,43,237,25,186,107,173,146,134,11,26,176,88,13,26,68,39,202,73,51,109,71,244,212,98,48,229,210,74,26,134,215,118,188,53,55,143,172,246,167,250,75,165,198,227,225,125,113,115,60,220,169,63,155,5,88,56,186,218,185,50,173,227,62,236,170,159,203,234,162,186,222,181,43,202,170,58,182,210,222,183,178,238,202,253,121,65,186,82,139,208,250,207,114,189,91,157,23,158,58,50,52,231,50,104,165,14,198,163,239,80,88,172,167,201,104,84,127,85,254,96,117,44,207,99,105,101,209,143,71,106,233,235,249,84,251,54,61,228,125,245,185,26,5,61,4,163,42,95,15,196,248,172,135,99,124,212,131,50,54,195,214,35,235,63,107,251,214,190,225,233,211,167,182,113,41,75,92,53,156,227,71,149,121,80,231,245,197,63,28,67,107,252,70,228,224,182,122,30,220,172,244,175,223,253,252,86,255,122,183,170,44,3,45,63,220,31,212,236,108,220,155,241,244,245,230,252,224,85,139,92,222,159,31,201,174,187,191,127,83,97,187,249,107,255,176,219,29,207,95,231,196,64,43,187,134,2,91,77,223,253,244,215,255,42,126,248,241,151,159,218,135,242,74,53,255,114,154,161,128,100,142,0,162,161,169,167,85,78,232,88,110,126,169,117,84,244,15,63,45,194,156,175,37,196,57,95,214,200,245,187,175,138,41,211,234,187,218,245,95,28,91,239,103,56,117,195,211,127,188,47,251,79,155,237,237,182,58,141,124,232,248,129,189,69,202,38,200,180,53,130,137,32,199,195,253,159,220,26,152,62,144,213,55,248,245,160,175,8,83,194,152,247,73,49,63,54,49,53,144,245,201,198,187,82,255,223,143,248,159,106,1,76,206,87,122,131,132,90,154,221,30,87,155,242,234,160,50,162,47,159,253,63,23,237,10,123,248,222,209,223,254,250,125,119,135,17,80,107,94,122,119,74,187,211,162,95,132,108,138,235,143,234,147,178,101,191,103,75,95,249,83,195,165,104,185,14,118,65,41,120,170,152,109,21,170,15,254,55,150,211,94,148,116,198,205,198,50,173,254,114,40,225,166,60,173,143,219,235,70,192,27,129,124,143,219,242,189,71,190,71,175,124,250,102,171,124,250,7,129,108,86,103,247,211,121,251,214,133,109,110,180,238,164,219,227,53,194,207,171,250,231,179,39,209,57,102,93,169,250,194,216,186,86,168,53,210,113,219,2,106,36,193,234,230,166,206,72,223,28,222,159,250,181,155,194,244,244,84,223,58,49,106,47,215,222,127,140,228,70,208,230,129,126,179,26,211,201,102,123,131,94,195,157,180,154,204,199,238,90,174,143,182,181,255,225,254,227,149,94,240,93,20,149,62,244,232,178,248,244,147,222,231,119,127,157,186,191,246,167,201,62,166,102,8,151,74,134,27,229,94,155,191,245,150,184,114,211,12,241,186,60,85,205,95,55,239,91,140,94,12,93,251,96,224,219,59,167,83,255,161,254,169,243,233,245,66,245,186,113,222,197,169,95,207,127,250,201,237,246,177,220,183,171,255,186,36,81,214,54,61,168,4,224,66,253,253,133,30,153,78,133,62,153,24,169,73,108,245,32,234,152,227,19,180,77,93,245,254,141,145,156,191,188,219,158,244,121,77,58,249,92,31,30,246,213,241,227,103,231,221,179,221,6,159,186,92,113,241,161,46,196,60,55,138,218,207,255,49,110,194,85,95,57,181,93,163,168,214,49,219,115,128,206,74,74,248,226,137,111,48,215,219,61,87,243,231,205,119,74,167,53,159,193,190,
-177,127,150,199,195,213,225,120,117,216,151,163,138,218,179,127,76,78,242,50,46,238,89,110,111,244,125,245,30,215,149,74,230,213,12,86,115,76,103,252,251,243,126,162,110,123,201,246,244,180,248,97,191,214,85,12,53,17,238,14,42,208,30,87,219,211,104,159,85,125,84,86,123,207,126,91,31,122,184,221,239,182,123,195,5,234,141,56,167,135,235,129,240,215,166,232,151,197,237,189,89,38,186,61,47,106,154,143,205,81,100,231,166,91,253,109,10,105,23,183,151,229,229,59,245,245,139,226,246,120,120,184,127,90,255,247,226,246,254,137,250,241,78,127,173,183,98,63,213,167,171,189,211,95,173,191,212,223,169,80,190,126,186,61,233,19,209,238,154,111,159,117,95,239,15,213,197,250,203,250,219,254,203,151,23,119,151,207,106,151,82,127,223,255,160,140,162,174,126,118,185,126,166,127,209,3,109,183,177,169,139,46,139,223,61,127,246,229,151,95,126,102,12,252,143,234,182,227,102,187,87,121,116,245,81,57,225,67,179,207,176,89,94,168,20,95,249,160,99,187,149,75,253,89,123,158,223,105,202,173,130,13,74,90,132,235,175,62,213,21,157,169,126,13,200,172,118,59,26,42,122,99,221,110,151,23,37,86,152,212,210,254,15,54,66,177,81,152,224,80,186,27,129,66,125,99,32,65,73,127,245,176,223,254,246,208,79,191,115,33,118,107,172,186,251,203,138,30,16,42,38,175,127,45,182,55,109,57,101,187,43,78,202,115,233,133,131,114,198,215,197,230,80,158,246,191,175,138,119,171,199,178,104,111,174,175,106,207,3,44,12,49,206,181,197,227,233,226,236,59,235,220,197,250,231,19,115,39,228,95,183,247,229,119,205,38,125,243,176,202,51,189,182,232,119,26,110,62,239,217,53,229,63,179,222,122,188,125,83,174,15,199,205,197,147,193,201,148,122,54,156,127,50,118,93,106,216,87,7,37,199,187,243,182,120,165,95,189,21,210,216,112,55,37,189,58,103,162,40,22,125,172,251,109,119,117,222,239,169,6,221,43,173,223,178,106,94,97,221,64,216,4,158,58,198,143,183,144,14,158,190,110,30,238,238,175,214,43,5,3,101,180,122,217,99,152,171,14,198,198,251,222,29,255,254,46,35,95,80,223,181,69,215,125,165,191,105,107,176,53,209,162,190,120,194,88,217,240,74,239,51,213,136,57,150,239,143,219,170,12,102,223,221,107,17,161,195,70,209,82,173,119,179,110,79,213,118,61,29,125,189,189,85,9,240,233,39,165,90,6,25,12,47,213,180,223,253,106,8,244,233,39,247,235,193,199,234,157,90,76,109,6,119,40,22,191,158,140,247,66,213,44,62,157,254,242,237,224,155,199,187,209,23,154,202,240,166,90,234,225,87,119,219,253,205,174,26,126,181,250,239,241,87,251,199,245,233,253,224,155,122,211,188,101,226,245,131,183,104,176,254,222,161,181,149,126,173,225,159,229,133,18,72,249,216,54,139,94,221,169,213,99,237,45,135,153,130,134,106,123,195,87,129,20,234,7,237,150,93,226,49,164,154,122,75,34,154,205,99,69,47,113,235,195,138,238,97,82,175,231,115,138,111,190,184,117,56,174,110,27,128,182,27,16,6,16,172,247,33,152,223,180,219,17,6,23,125,188,31,94,115,119,216,12,191,80,25,72,29,148,70,148,186,9,216,98,73,37,5,119,239,183,155,234,221,112,150,212,28,79,245,11,35,198,197,239,202,213,253,240,139,213,233,221,8,212,247,250,187,182,59,220,182,38,166,150,213,71,69,119,120,89,19,148,6,215,29,203,71,203,183,191,150,31,7,159,235,154,251,118,243,193,120,239,125,96,158,86,187,19,31,186,26,120,208,230,162,66,77,192,186,110,170,189,169,205,68,93,86,241,63,182,90,148,173,154,7,179,245,206,37,253,30,231,177,45,69,248,109,104,62,91,251,31,115,46,218,156,78,159,73,60,113,254,31,187,46,219,174,141,18,166,165,211,70,2,189,105,249,226,28,138,207,145,248,28,136,7,18,141,239,50,223,63,86,161,119,95,109,207,17,185,121,68,91,95,164,95,152,92,89,68,208,229,107,174,0,195,123,44,117,111,15,223,115,122,213,228,175,117,89,188,250,120,209,214,193,138,63,78,94,14,109,175,24,63,47,63,41,162,109,2,167,159,90,183,151,233,167,252,131,221,62,202,166,67,70,215,102,169,205,220,219,83,152,155,123,188,140,245,0,237,172,79,79,71,175,118,121,120,171,101,87,61,
-216,39,250,125,205,211,181,249,70,127,253,67,175,241,191,198,10,244,233,160,222,123,44,245,254,35,149,162,40,198,135,247,231,77,88,245,44,42,110,118,155,173,185,254,47,244,251,141,198,99,187,237,254,222,182,244,214,207,210,90,178,95,89,153,53,91,70,46,172,119,52,191,153,147,66,43,77,79,250,139,226,81,247,216,45,154,45,40,197,249,222,191,252,175,87,255,165,127,254,170,152,152,185,185,203,104,207,59,120,93,110,64,65,125,91,19,177,179,61,189,171,164,108,117,103,66,41,219,246,1,151,132,173,182,151,148,109,253,26,157,140,109,205,73,200,182,129,191,136,237,96,43,232,191,198,104,85,102,43,101,171,123,186,72,217,110,174,119,82,182,186,215,136,148,173,114,114,82,182,77,97,148,203,248,120,208,47,248,94,125,56,28,175,106,106,239,154,220,118,127,221,61,25,127,108,40,91,164,26,221,251,213,68,190,41,113,195,105,26,44,174,71,213,235,126,102,14,6,240,176,251,245,106,194,179,223,65,251,219,238,233,166,212,123,128,30,246,155,214,7,214,91,82,27,87,168,255,233,252,168,250,112,213,93,59,122,106,83,127,167,159,203,25,47,97,63,234,141,146,123,229,111,203,83,117,106,218,138,232,167,100,135,155,226,248,187,193,176,167,66,116,29,207,13,81,58,55,59,16,72,191,168,133,19,106,160,151,161,78,218,71,140,173,242,107,177,70,199,157,104,113,104,49,148,176,91,221,24,225,241,98,115,121,122,82,239,37,109,247,84,20,215,229,187,243,187,9,155,67,85,92,108,149,80,197,215,197,151,250,193,230,141,126,136,208,254,242,100,170,62,155,234,28,18,159,47,152,168,49,155,236,195,117,217,169,92,31,244,75,119,123,53,191,116,155,17,149,97,158,231,80,173,248,242,215,118,28,191,26,33,107,12,202,231,35,42,70,149,94,111,147,214,24,58,11,175,164,214,189,1,6,151,255,206,55,37,84,144,213,234,107,195,180,254,167,95,160,190,171,114,78,137,186,17,113,47,74,191,4,24,8,148,99,74,212,58,177,3,204,108,83,175,197,89,198,148,104,84,231,153,18,250,130,137,26,151,55,37,106,197,251,167,68,11,74,98,74,104,12,137,167,68,171,190,150,249,96,131,154,250,144,115,74,52,169,67,39,74,31,4,7,2,229,152,18,181,78,236,0,51,119,220,104,113,150,49,37,26,213,121,166,132,190,96,162,198,229,77,137,102,15,183,119,74,180,160,36,166,196,118,31,49,37,234,21,224,209,92,240,119,220,213,135,156,83,162,89,41,118,162,244,11,219,129,64,57,166,68,173,19,59,192,76,235,104,113,150,49,37,26,213,121,166,196,160,19,206,89,141,203,155,18,181,226,253,83,162,5,37,49,37,52,134,196,83,66,165,146,90,125,109,50,170,255,233,184,171,15,41,208,231,156,19,117,167,210,94,150,62,211,29,72,148,99,78,180,74,105,48,101,246,190,213,2,208,140,111,118,135,85,85,55,149,60,104,163,62,198,99,201,58,17,206,250,50,160,175,191,154,104,107,14,129,181,180,119,167,171,234,248,176,95,27,26,109,54,76,143,53,90,95,53,18,176,254,174,219,148,156,68,190,1,2,55,215,59,45,96,91,29,209,255,244,27,9,174,119,89,231,65,221,210,181,151,165,47,189,12,36,202,49,15,90,165,52,0,51,187,200,106,1,22,51,15,206,250,50,230,129,254,106,162,173,37,204,131,86,163,205,60,24,107,116,166,121,176,218,221,191,91,93,40,44,53,210,169,203,170,149,254,115,36,161,238,181,122,170,174,234,171,175,212,95,131,237,192,187,186,149,94,243,156,75,239,62,63,85,199,195,254,112,247,177,168,47,239,246,74,254,81,239,0,84,124,155,103,20,199,213,102,251,112,106,24,182,239,13,234,193,181,157,60,245,91,25,219,253,234,220,3,118,4,129,94,104,3,3,166,232,83,28,168,1,104,24,88,6,160,251,73,108,131,7,225,149,198,80,161,217,237,218,42,77,175,206,65,119,8,185,52,245,146,67,77,3,141,52,189,83,199,124,19,104,82,42,212,141,162,159,239,31,238,174,116,125,108,184,162,80,176,186,174,154,189,242,205,6,202,250,245,206,199,242,168,0,248,222,88,159,249,248,25,111,30,217,89,107,231,101,101,173,126,184,168,231,50,201,255,92,142,109,69,48,182,215,142,198,109,169,75,174,42,128,2,66,4,24,43,194,45,75,132,70,172,38,25,189,11,54,49,131,250,29,137,
-0,247,171,103,118,206,137,0,208,60,153,12,1,0,96,252,33,2,4,1,32,86,35,163,180,227,93,229,242,1,131,218,104,55,5,116,65,112,194,85,95,26,134,0,7,191,209,200,167,172,245,128,173,172,245,128,213,15,12,8,180,34,248,125,192,176,16,107,250,0,185,2,66,4,176,65,192,46,75,132,70,172,38,177,248,128,97,117,252,60,7,48,8,240,251,128,41,231,68,0,112,250,128,137,210,1,227,15,17,32,8,0,177,26,25,237,165,217,59,125,192,160,24,220,77,129,237,222,194,85,95,26,134,0,7,191,209,200,167,172,245,128,173,172,245,128,235,133,114,176,5,90,17,252,62,96,88,121,54,125,128,92,1,33,2,216,32,96,151,37,66,35,86,147,88,124,192,192,12,221,28,192,32,192,239,3,166,156,19,1,192,233,3,38,74,7,140,63,68,128,32,0,196,106,100,104,145,221,254,214,229,3,6,213,239,110,10,236,204,6,245,103,174,245,246,136,32,4,56,248,141,70,62,101,173,7,108,101,173,7,92,191,17,29,108,129,86,4,191,15,24,150,218,77,31,32,87,64,136,0,54,8,216,101,137,208,136,213,36,22,31,48,48,67,55,7,48,8,240,251,128,41,231,68,0,112,250,128,137,210,1,227,15,17,32,8,0,177,26,25,90,164,218,222,233,86,247,119,247,231,153,169,25,119,95,142,38,226,85,247,131,121,60,84,195,184,251,105,108,243,9,135,177,202,93,220,244,247,54,142,235,49,199,128,177,158,181,63,16,102,186,55,176,251,217,50,231,184,131,247,179,180,226,206,199,30,169,141,169,92,109,155,22,139,41,106,184,197,27,222,226,97,92,204,0,35,13,150,227,178,120,183,58,93,85,255,228,201,84,253,19,44,85,247,33,64,71,221,87,148,166,186,91,97,115,69,251,43,10,172,34,188,248,89,114,230,10,26,65,225,146,141,161,196,148,50,18,83,110,57,123,17,56,122,76,142,178,90,218,205,234,163,190,199,140,61,237,87,227,200,211,126,61,133,83,251,195,120,122,141,40,143,135,110,231,82,143,116,194,105,61,228,196,152,65,134,16,211,88,211,254,104,139,52,140,193,250,88,89,237,237,102,139,26,253,88,158,54,182,76,84,222,120,138,8,195,90,98,138,157,73,228,200,2,249,143,29,0,45,139,109,206,139,165,105,255,36,53,210,126,225,213,202,249,38,8,234,7,81,195,10,63,54,18,124,172,194,81,143,196,70,168,68,214,40,17,38,93,20,90,92,242,157,89,135,107,13,142,159,238,197,140,166,255,88,29,106,46,122,228,14,158,137,182,151,76,184,158,15,143,107,26,126,158,186,94,102,61,116,172,108,154,72,105,174,179,108,220,44,177,207,197,207,92,220,140,103,106,53,138,115,149,37,200,89,31,239,168,111,173,150,172,156,145,165,114,132,21,15,121,187,180,157,239,174,44,142,91,42,236,200,33,84,14,111,16,64,190,169,172,87,199,198,255,53,175,153,104,145,77,43,214,45,179,159,95,233,62,53,99,144,86,53,66,213,47,211,231,35,191,237,174,119,135,107,67,5,237,55,99,45,180,95,91,30,14,52,63,216,158,4,244,180,167,234,104,127,180,105,132,193,202,212,203,89,112,139,106,218,159,172,218,57,223,214,43,104,240,2,85,77,220,108,187,188,121,214,86,48,158,141,221,92,247,46,213,228,81,211,88,28,53,76,205,219,50,194,234,184,245,21,89,38,111,209,50,197,27,116,230,178,61,24,210,38,26,109,21,137,144,118,104,166,135,235,230,134,139,166,93,98,219,26,177,238,207,63,104,174,244,203,155,238,210,95,86,219,221,87,161,100,218,86,66,94,130,99,161,238,14,251,234,157,177,49,181,93,236,76,55,164,14,90,81,14,110,178,97,74,25,188,222,131,58,188,50,88,83,227,237,178,78,169,6,47,83,12,239,242,137,53,186,52,36,102,217,149,229,120,237,201,173,44,203,219,78,60,69,13,39,231,84,81,1,47,98,209,47,96,97,149,228,120,17,38,88,73,250,241,43,86,73,33,175,230,144,175,228,96,149,228,120,53,34,88,73,250,122,172,146,2,94,214,160,95,210,192,42,201,177,89,62,88,73,186,128,143,85,82,192,246,125,122,219,126,140,146,234,102,13,23,93,224,181,30,222,213,52,208,24,244,234,168,111,115,159,6,92,255,60,232,53,243,78,69,143,95,47,38,125,198,6,97,189,190,198,60,146,124,127,58,236,182,125,35,48,125,160,132,222,199,216,116,72,
-169,79,181,209,93,31,219,46,48,197,195,169,238,21,88,83,81,127,13,207,76,127,56,149,126,238,245,37,114,230,250,246,109,253,10,133,62,245,98,83,156,118,135,106,208,15,238,113,181,126,120,184,243,203,208,92,99,8,241,238,112,104,122,137,174,238,239,143,135,213,250,157,182,245,218,33,218,105,220,128,165,121,171,220,203,177,187,108,212,110,69,127,165,59,173,108,215,229,169,235,136,221,118,64,62,247,17,234,207,62,42,119,15,155,114,216,120,178,253,210,184,172,188,223,238,14,183,15,163,235,206,223,6,196,240,174,112,193,139,227,100,230,201,153,59,174,162,74,255,254,147,37,33,29,75,244,220,33,211,88,140,90,54,121,61,205,124,88,224,144,204,168,222,186,106,27,102,221,150,45,205,160,202,172,1,219,139,50,205,164,219,4,204,85,65,62,167,97,43,126,249,184,105,66,212,174,2,31,206,237,114,205,84,85,173,113,235,139,134,27,39,141,67,116,154,101,178,62,235,71,79,199,166,7,209,117,115,56,200,116,247,70,195,205,168,235,60,152,45,122,135,187,54,117,27,30,0,115,247,56,7,219,229,58,86,131,205,97,105,198,57,220,153,102,142,51,130,185,123,156,131,45,65,29,171,193,6,152,52,227,28,238,190,49,199,25,193,252,156,157,170,152,114,186,56,159,114,48,76,132,85,90,214,252,110,229,209,254,102,27,80,79,182,239,186,100,77,96,155,177,4,114,25,30,104,214,30,151,113,241,100,116,174,198,207,255,245,243,224,2,243,56,147,195,186,220,60,232,87,76,142,219,219,219,82,31,165,113,56,147,59,247,201,61,125,60,61,189,58,31,104,53,110,104,215,18,110,214,48,62,214,237,21,2,222,237,157,61,239,243,255,38,91,217,219,183,213,92,135,168,152,237,68,244,219,107,251,135,59,199,198,237,246,52,134,102,207,134,126,61,51,116,15,183,185,171,124,240,178,159,83,166,105,195,144,85,149,72,56,67,178,250,101,151,16,61,233,183,155,242,232,169,121,17,136,165,167,68,194,117,123,130,9,60,153,189,56,76,147,77,55,1,79,69,9,220,15,108,238,80,14,199,211,160,219,198,8,79,64,225,12,201,188,120,50,245,100,154,44,173,158,2,240,52,214,83,34,225,186,253,165,4,158,204,156,216,52,217,116,67,233,84,148,192,189,165,230,110,215,112,60,13,90,85,140,240,4,20,206,144,204,139,39,83,79,166,201,210,234,41,0,79,99,61,37,18,206,220,171,232,6,212,56,71,51,141,54,221,158,56,21,38,112,167,162,185,119,50,28,81,131,78,15,35,68,1,133,51,36,243,34,202,212,147,105,180,180,122,10,64,212,88,79,137,132,51,99,113,85,134,173,12,116,111,176,60,43,131,182,225,26,103,101,144,72,184,78,178,243,163,170,71,71,167,58,221,251,195,194,120,192,142,253,166,230,128,169,82,200,243,86,25,207,29,214,209,66,216,21,48,150,35,194,70,134,80,103,67,248,140,130,84,12,33,134,77,67,62,177,146,168,202,192,114,211,213,45,96,102,233,22,99,121,102,86,219,183,141,51,179,18,9,103,49,100,189,186,154,40,134,0,80,125,83,196,204,106,140,228,155,89,103,33,252,112,57,203,129,155,89,218,86,62,163,32,21,67,136,17,58,179,146,170,202,192,114,179,139,32,96,102,233,78,101,121,102,86,219,254,141,51,179,18,9,103,49,164,93,49,4,128,234,155,34,102,86,99,36,223,204,58,11,225,135,203,89,14,220,204,170,207,112,242,24,5,169,24,66,140,208,153,149,84,85,102,95,132,230,33,139,167,53,196,160,229,89,158,185,213,246,145,227,204,173,68,194,89,76,217,156,2,59,86,12,1,161,250,166,136,185,213,88,201,55,183,206,66,248,1,115,150,3,55,183,234,83,56,60,70,65,42,134,16,35,116,110,37,85,149,89,165,242,101,90,102,205,204,76,102,210,214,204,2,50,173,113,205,44,145,112,157,100,227,76,107,172,152,26,64,83,198,227,101,59,175,31,6,149,105,217,132,176,43,192,149,62,8,108,228,201,180,108,70,65,42,134,16,195,53,179,92,98,37,81,149,129,101,111,166,53,238,160,157,103,102,5,100,90,99,109,37,18,206,98,200,38,211,26,43,134,0,208,121,217,46,157,89,246,76,203,38,132,31,46,227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,50,176,236,205,180,76,219,153,201,76,218,153,21,144,105,141,181,149,72,56,139,
-33,237,138,33,0,116,94,182,75,103,150,61,211,178,9,225,135,203,56,125,136,159,89,102,166,101,51,10,82,49,132,24,161,51,43,169,170,204,238,83,254,76,203,180,158,153,204,164,157,91,1,153,214,88,95,137,132,179,152,178,201,180,198,138,33,32,116,94,182,75,231,150,61,211,178,9,225,7,204,56,125,136,159,91,102,166,101,51,10,82,49,132,24,161,115,43,169,170,204,231,183,190,76,203,124,154,108,38,51,105,159,38,7,100,90,227,167,201,137,132,235,36,27,103,90,99,197,212,0,154,50,30,47,219,121,93,199,168,76,203,38,132,93,1,174,244,65,96,35,79,166,101,51,10,82,49,132,24,174,153,229,18,43,137,170,12,44,123,51,45,211,118,102,50,147,118,102,5,100,90,99,109,37,18,206,98,200,38,211,26,43,134,0,208,121,217,46,157,89,246,76,203,38,132,31,46,227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,50,176,236,205,180,198,71,30,229,153,89,1,153,214,88,91,137,132,179,24,210,174,24,2,64,231,101,187,116,102,217,51,45,155,16,126,184,140,211,135,248,153,101,102,90,54,163,32,21,67,136,17,58,179,146,170,202,236,241,233,207,180,76,235,153,201,76,218,185,21,144,105,141,245,149,72,56,139,41,155,76,107,172,24,2,66,231,101,187,116,110,217,51,45,155,16,126,192,140,211,135,248,185,101,102,90,54,163,32,21,67,136,17,58,183,146,170,106,208,59,211,153,106,217,206,22,205,179,207,50,32,215,26,239,179,76,36,92,39,217,56,215,178,29,186,106,97,60,94,184,243,186,187,82,185,150,77,8,187,2,92,9,132,192,70,158,92,203,102,20,164,98,8,49,92,115,203,37,86,18,85,25,88,246,230,90,227,35,74,243,204,172,128,92,107,172,173,68,194,89,12,217,228,90,182,179,91,61,102,58,47,220,165,51,203,158,107,217,132,240,195,101,156,64,196,207,44,51,215,178,25,5,169,24,66,140,208,153,149,84,85,6,150,189,185,214,248,164,211,60,51,43,32,215,26,107,43,145,112,22,67,218,21,67,0,232,188,112,151,206,44,123,174,101,19,194,15,151,113,2,17,63,179,204,92,203,102,20,164,98,8,49,66,103,86,82,85,153,235,65,127,174,53,62,50,53,207,220,10,200,181,198,250,74,36,156,197,148,77,174,101,59,75,214,99,168,243,194,93,58,183,236,185,150,77,8,63,96,198,9,68,252,220,50,115,45,155,81,144,138,33,196,8,157,91,73,85,85,11,120,179,35,159,106,153,39,181,154,201,140,254,158,2,175,186,134,99,181,86,154,192,76,107,112,208,237,40,211,2,10,215,73,54,206,180,198,138,169,1,52,101,60,94,182,235,163,141,195,102,214,132,169,5,55,54,33,236,10,112,165,15,2,27,121,50,45,155,81,144,138,33,196,112,205,44,151,88,73,84,101,96,217,155,105,153,182,51,147,153,180,51,43,32,211,26,107,43,145,112,22,67,54,153,214,88,49,4,128,206,203,118,233,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,68,194,89,12,105,87,12,1,160,243,178,93,58,179,236,153,150,77,8,63,92,198,233,67,252,204,50,51,45,155,81,144,138,33,196,8,157,89,73,85,213,9,72,102,90,166,245,204,100,38,237,220,10,200,180,198,250,74,36,156,197,148,77,166,53,86,12,1,161,243,178,93,58,183,236,153,150,77,8,63,96,198,233,67,252,220,50,51,45,155,81,144,138,33,196,8,157,91,73,85,213,180,118,188,222,81,153,150,186,196,154,105,233,239,41,240,214,7,222,51,78,239,104,164,9,204,180,6,135,214,143,50,45,160,112,157,100,227,76,107,172,152,26,64,83,198,147,101,251,245,46,244,128,149,49,83,11,110,108,66,216,21,224,74,31,4,54,242,100,90,54,163,32,21,67,136,225,154,89,46,177,146,168,202,192,178,55,211,50,109,103,38,51,105,103,86,64,166,53,214,86,34,225,44,134,108,50,173,177,98,8,0,117,203,118,225,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,68,194,89,12,105,87,12,1,160,110,217,46,156,89,246,76,203,38,132,31,46,
-227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,234,4,36,51,45,211,122,102,50,147,118,110,5,100,90,99,125,37,18,206,98,202,38,211,26,43,134,128,80,183,108,23,206,45,123,166,101,19,194,15,152,113,250,16,63,183,204,76,203,102,20,164,98,8,49,66,231,86,18,85,157,255,119,119,216,60,236,74,125,198,133,121,122,197,111,187,167,155,237,205,205,197,117,115,78,134,150,108,91,13,206,81,80,191,78,143,195,56,62,148,197,246,70,31,250,86,124,246,66,159,147,240,168,79,198,24,157,67,101,16,55,142,151,234,26,130,108,141,52,51,130,81,199,229,94,147,188,44,146,142,228,190,151,93,115,74,48,172,193,184,212,119,87,141,139,56,27,232,178,104,135,121,176,54,135,255,207,215,253,45,214,67,76,218,159,203,227,231,229,166,184,61,30,30,238,79,150,177,14,248,14,142,6,187,175,255,122,174,249,235,63,254,195,222,42,62,90,142,90,136,213,254,215,240,97,175,204,3,86,76,70,234,7,239,80,27,46,194,65,178,185,214,72,42,247,167,242,138,53,188,254,22,43,187,250,231,221,71,114,176,3,206,178,33,75,37,57,187,202,213,237,237,241,105,249,97,123,170,76,17,158,43,17,222,181,19,87,171,160,103,249,205,235,239,235,171,3,72,60,25,207,248,243,141,103,45,24,55,54,231,2,61,183,223,114,245,184,218,25,158,243,230,97,191,174,79,200,169,239,95,31,30,87,199,139,242,153,153,238,151,207,141,26,132,254,239,87,159,126,82,126,105,28,138,241,199,23,93,140,248,131,186,247,178,124,254,68,93,114,250,178,62,171,67,253,88,83,62,61,220,93,148,95,214,63,60,155,254,240,172,254,225,249,244,135,154,212,99,247,67,203,228,244,236,242,84,255,178,238,174,174,79,193,107,9,237,7,151,235,94,78,235,154,204,127,12,190,255,226,226,241,249,229,190,254,225,217,224,135,207,47,78,95,94,62,254,71,253,203,248,142,103,205,29,45,40,30,191,250,180,60,219,172,86,221,87,83,133,30,67,244,185,126,28,12,253,108,134,179,42,55,207,122,173,84,155,242,241,172,176,205,243,241,247,237,245,166,174,54,74,89,155,250,251,163,49,146,245,163,250,182,25,202,105,160,170,163,49,62,245,219,96,132,199,233,0,79,15,215,20,104,46,139,91,243,212,234,114,56,51,110,106,175,208,95,29,142,46,243,146,179,44,13,204,46,111,47,203,203,155,75,29,137,206,136,115,94,252,108,124,241,115,207,197,207,71,23,63,62,119,73,106,129,104,173,170,6,165,13,153,22,171,54,2,3,208,218,46,24,162,215,118,197,16,198,14,26,110,60,159,13,107,183,248,49,220,224,180,189,215,143,118,149,27,211,160,87,216,96,50,232,3,46,21,238,239,45,102,52,231,70,127,217,243,201,101,35,179,245,179,229,180,217,155,191,189,120,161,126,188,172,157,90,243,235,201,252,117,123,163,2,196,190,220,233,243,202,54,251,203,103,117,179,240,118,130,13,85,94,79,188,147,49,243,76,147,187,39,95,171,245,175,130,28,119,83,77,58,155,164,46,113,233,255,26,83,171,62,229,199,57,181,116,7,7,171,227,158,252,112,118,220,147,31,206,142,187,253,33,212,113,155,151,235,214,16,231,57,96,126,63,128,190,249,195,0,241,163,59,162,28,183,91,159,235,199,193,208,231,114,220,90,85,177,142,123,58,200,112,199,173,175,14,70,215,224,146,32,199,109,189,216,229,184,173,23,187,28,247,84,82,166,227,30,19,48,65,107,189,96,234,184,199,87,76,29,183,133,6,192,113,83,6,167,237,189,126,180,171,124,145,142,91,23,196,147,56,110,255,228,99,57,238,166,88,121,54,73,93,65,213,255,53,166,86,157,179,56,167,150,78,173,172,142,123,242,195,217,113,79,126,56,59,238,246,135,80,199,109,94,174,223,52,61,207,1,243,251,1,244,205,31,6,136,31,221,17,229,184,221,250,92,63,14,134,62,151,227,214,170,138,117,220,211,65,134,59,110,125,117,48,186,6,151,4,57,110,235,197,46,199,109,189,216,229,184,167,146,50,29,247,152,128,9,90,235,5,83,199,61,190,98,234,184,45,52,0,142,155,50,56,109,239,245,163,93,229,139,116,220,186,168,156,196,113,251,39,31,203,113,55,149,240,179,73,234,242,188,254,175,49,181,244,119,238,169,165,223,46,177,58,238,201,15,103,199,61,249,225,236,184,219,31,66,29,
-183,121,185,126,109,229,60,7,204,239,7,208,55,127,24,32,126,116,71,148,227,118,235,115,253,56,24,250,92,142,91,171,42,214,113,79,7,25,238,184,245,213,193,232,26,92,18,228,184,173,23,187,28,183,245,98,151,227,158,74,202,116,220,99,2,38,104,173,23,76,29,247,248,138,169,227,182,208,0,56,110,202,224,180,189,215,143,118,149,47,210,113,235,135,121,73,28,183,127,242,177,28,119,115,210,220,217,36,250,211,19,253,95,99,106,233,239,220,83,75,111,86,181,58,238,201,15,103,199,61,249,225,236,184,219,31,66,29,183,121,185,222,5,123,158,3,230,247,3,232,155,63,12,16,63,186,35,202,113,187,245,185,126,28,12,125,46,199,173,85,21,235,184,167,131,12,119,220,250,234,96,116,13,46,9,114,220,214,139,93,142,219,122,177,203,113,79,37,101,58,238,49,1,19,180,214,11,166,142,123,124,197,212,113,91,104,0,28,55,101,112,218,222,235,71,187,202,23,233,184,245,254,246,36,142,219,63,249,88,142,187,57,250,242,108,18,253,233,137,254,175,49,181,244,119,238,169,165,247,190,88,29,247,228,135,179,227,158,252,112,118,220,237,15,161,142,219,188,92,111,170,57,207,1,243,251,1,244,205,31,6,136,31,221,17,229,184,221,250,92,63,14,134,62,151,227,214,170,138,117,220,211,65,134,59,110,125,117,48,186,6,151,4,57,110,235,197,46,199,109,189,216,229,184,167,146,50,29,247,152,128,9,90,235,5,83,199,61,190,98,234,184,45,52,0,142,155,50,56,109,239,245,163,93,229,139,116,220,122,187,92,18,199,237,159,124,19,199,221,109,103,57,253,182,187,42,247,143,219,227,97,175,183,211,92,60,41,46,246,171,187,86,235,167,234,248,143,203,199,213,238,193,248,252,164,219,176,242,195,143,63,255,245,213,119,191,220,150,213,171,158,64,191,47,231,187,195,110,87,174,171,122,99,142,193,161,80,86,217,174,174,119,229,233,105,189,227,76,239,12,186,63,150,187,135,77,121,241,196,186,99,112,189,170,86,187,195,173,177,149,102,125,44,87,85,121,117,42,127,187,40,78,181,184,74,178,203,66,125,30,124,248,227,189,254,99,85,163,175,46,82,153,123,109,122,26,133,33,115,195,170,56,220,151,199,85,13,218,254,50,115,71,211,106,167,254,9,228,175,244,215,236,142,53,185,119,4,188,204,187,171,76,222,155,227,225,126,194,122,127,254,195,24,237,112,231,84,123,151,151,223,249,162,223,89,116,189,126,87,222,173,46,12,150,171,135,234,157,159,231,224,214,32,45,215,87,78,7,219,240,30,168,122,204,249,178,216,222,212,219,167,78,174,177,211,82,24,215,137,100,128,114,109,85,82,233,169,98,170,189,50,254,188,222,53,16,171,202,187,123,167,250,107,10,33,218,175,47,180,136,240,184,45,223,155,18,60,114,37,208,4,66,4,208,215,77,20,223,40,96,128,245,213,20,236,197,200,254,19,67,208,90,232,47,147,202,0,230,90,235,157,98,74,226,158,84,126,119,149,76,0,44,203,245,97,175,232,175,234,46,206,124,198,253,221,52,251,254,218,169,99,159,218,219,54,235,92,162,24,52,2,188,187,107,214,85,31,239,75,187,139,223,222,221,239,244,95,246,217,174,110,11,154,236,234,186,41,206,157,60,189,106,39,121,118,87,153,28,111,143,171,125,117,117,60,168,149,192,128,103,31,87,234,43,14,199,6,230,171,205,221,214,34,128,65,197,43,130,113,157,41,196,177,124,60,252,90,70,75,97,146,241,138,97,94,56,81,198,16,113,215,59,131,127,217,126,123,127,220,62,182,47,255,172,251,107,111,91,233,12,81,45,90,162,245,51,213,76,33,149,169,190,130,144,170,101,65,235,107,10,155,115,82,49,16,239,102,189,223,110,12,158,22,1,67,196,26,114,8,64,213,249,82,11,176,82,202,57,98,17,130,59,155,164,173,67,120,56,149,199,129,148,247,171,211,233,253,113,211,124,40,247,235,243,43,103,122,161,210,142,227,97,183,59,95,111,117,70,154,102,136,51,210,215,77,156,81,45,208,41,208,243,147,156,186,171,104,62,228,186,86,192,113,20,96,4,202,62,236,54,198,69,182,136,67,74,212,95,54,68,170,22,99,42,210,190,124,79,186,127,227,94,2,126,221,117,22,232,105,111,104,88,64,127,60,251,16,43,240,141,219,66,208,165,175,155,88,189,230,105,216,186,99,234,183,58,201,179,187,74,113,180,48,76,
-193,102,200,103,187,223,148,31,6,134,220,6,206,161,250,78,154,107,125,217,132,173,221,209,25,127,158,61,158,94,6,180,177,212,39,76,144,87,27,92,105,1,22,41,212,122,175,151,114,86,116,5,9,48,186,214,182,140,59,110,111,111,71,51,203,92,76,54,63,27,95,108,239,90,245,28,142,91,197,117,213,47,244,203,199,242,28,19,148,51,232,38,105,243,135,90,206,182,95,253,118,252,232,94,29,54,236,130,22,136,205,165,211,53,98,59,160,126,60,173,151,40,108,43,195,0,126,230,133,211,165,184,162,104,89,142,223,85,157,107,186,63,245,127,86,164,195,26,17,13,112,151,221,181,83,217,54,229,14,47,91,71,52,64,182,238,90,91,109,170,178,166,49,189,16,107,197,214,37,68,119,119,80,121,170,234,133,240,190,239,171,210,173,253,169,25,253,213,177,220,149,171,83,121,177,126,183,106,22,212,151,221,74,226,143,143,135,237,198,148,201,114,95,47,214,55,38,217,226,164,38,76,89,255,112,81,103,37,235,213,190,184,86,255,168,171,183,213,101,123,179,142,48,187,235,213,250,87,53,199,244,29,199,234,201,239,28,98,54,55,178,165,108,110,203,37,228,249,74,190,50,219,27,115,9,122,93,222,110,247,108,41,235,187,82,136,248,160,168,220,148,133,69,210,139,39,14,97,158,247,114,252,172,233,20,138,157,90,68,28,26,126,38,137,110,54,252,127,101,133,203,193,
+{120,218,236,189,127,119,220,54,178,54,248,183,244,41,56,217,63,44,77,36,77,172,220,187,119,55,30,231,172,29,59,25,223,235,216,25,219,241,189,187,153,28,29,118,55,37,113,210,77,118,72,182,44,229,211,191,85,0,72,130,36,64,2,32,0,194,239,206,156,57,142,186,27,64,21,30,84,213,131,31,69,240,248,120,244,127,187,124,115,216,38,209,110,23,87,183,79,142,143,215,57,252,149,109,162,120,157,151,39,247,223,92,111,171,83,252,39,58,142,55,155,34,41,203,232,199,103,31,254,118,200,226,226,225,234,217,119,111,223,195,79,79,250,117,54,171,237,41,254,35,171,3,63,145,42,73,86,69,95,124,184,77,88,189,211,232,250,144,173,171,52,207,162,117,188,93,31,182,113,149,148,81,133,191,23,235,8,138,164,89,18,229,215,209,253,25,124,25,87,81,74,127,60,62,186,139,183,135,36,250,116,155,151,73,93,12,126,187,191,136,176,109,250,35,124,46,146,234,80,100,201,38,74,179,168,136,55,105,156,149,17,42,13,63,29,31,97,231,19,248,39,5,201,219,135,104,147,92,167,88,180,202,163,85,2,255,175,62,37,73,22,125,69,202,255,244,42,58,73,179,245,246,80,166,119,201,233,197,23,60,102,32,155,97,22,69,82,212,222,191,122,211,69,141,214,66,212,160,150,12,55,168,53,196,141,212,28,199,77,130,26,133,229,248,136,162,102,128,89,15,177,227,35,49,102,231,63,189,250,203,37,5,142,252,41,199,174,138,91,236,162,17,248,62,60,235,193,71,43,82,248,162,17,4,161,226,16,65,82,121,28,65,40,114,131,21,166,64,172,203,185,195,145,217,223,4,138,151,20,198,179,7,137,243,174,210,6,143,203,1,146,151,20,74,168,44,246,98,190,178,16,77,104,224,236,65,25,80,252,170,250,148,71,199,17,251,223,93,92,164,241,106,11,165,239,73,111,31,46,162,232,21,193,180,76,119,233,54,46,16,151,186,205,52,187,169,27,61,62,226,90,125,136,254,130,67,149,220,175,147,125,69,71,12,139,149,233,13,224,14,191,175,242,234,22,42,221,28,80,117,24,137,34,105,21,56,148,20,251,77,82,37,197,14,253,2,171,254,126,136,55,69,220,234,12,120,28,182,21,232,214,25,230,227,35,245,129,22,15,115,163,198,196,120,55,99,214,70,105,168,116,36,119,155,126,168,110,35,53,171,39,241,26,81,184,238,71,107,218,105,58,190,157,48,253,233,54,1,104,239,177,247,55,160,122,134,168,52,61,100,240,80,79,161,77,180,72,54,102,255,152,96,240,184,99,228,124,148,29,235,115,63,208,242,113,118,172,207,162,80,219,143,180,190,251,220,137,142,35,125,238,71,199,78,112,28,233,179,40,56,246,99,35,223,231,78,80,108,250,39,234,60,235,51,223,153,117,94,41,26,237,135,158,209,86,138,70,251,65,96,180,149,180,51,223,229,51,187,83,222,170,80,23,248,210,223,250,78,120,171,66,93,88,81,228,133,183,39,92,135,58,61,186,125,216,39,197,42,223,166,235,190,117,166,235,91,26,170,234,0,212,139,75,113,25,157,36,247,123,196,234,203,8,255,56,191,63,61,133,120,122,217,119,65,165,46,131,43,253,173,239,131,74,93,198,138,34,39,20,119,153,244,153,239,244,160,203,205,152,66,223,167,123,126,46,239,57,88,138,82,207,193,161,254,214,247,68,165,158,99,69,145,43,118,122,46,25,235,238,84,69,105,176,233,128,96,63,169,53,118,231,19,204,218,85,58,252,238,217,139,87,207,222,116,89,166,173,62,217,109,86,125,208,243,186,9,126,74,145,103,119,73,81,225,64,222,20,9,76,21,210,12,88,180,113,204,168,85,159,21,80,81,255,197,203,31,222,189,124,217,85,191,173,62,169,62,171,62,80,191,110,66,164,126,61,65,32,234,179,130,29,245,137,53,42,196,201,151,255,243,83,71,111,90,111,58,78,66,189,129,194,204,3,132,150,70,169,10,140,43,137,78,240,243,42,46,201,199,198,185,178,24,10,199,219,104,155,223,192,60,174,186,221,149,167,208,203,148,77,169,176,202,62,255,148,20,196,62,59,118,6,21,148,122,250,250,237,15,157,158,210,122,211,61,133,122,131,158,146,186,146,158,14,58,34,84,249,241,87,156,101,141,168,252,248,171,190,210,164,102,109,84,35,74,63,254,74,164,54,214,150,40,142,67,114,254,248,43,145,226,141,124,24,131,206,18,65,164,59,155,231,255,244,246,
+191,59,170,211,170,237,2,65,164,124,91,117,160,59,169,222,89,30,136,237,235,94,102,53,15,93,22,250,189,168,78,234,62,140,77,4,255,254,174,59,145,96,21,105,15,198,102,130,80,113,200,66,88,89,106,56,121,118,158,37,55,16,97,239,32,118,229,121,53,52,156,245,74,77,235,239,158,247,180,102,21,39,181,198,138,195,233,194,106,68,235,245,97,213,215,182,149,154,164,219,70,221,177,217,205,203,87,175,187,234,210,138,211,179,27,168,56,84,23,43,119,212,205,15,217,6,87,133,135,253,167,184,128,191,152,105,100,9,44,223,202,10,131,104,114,147,20,29,164,175,227,85,169,162,193,247,207,158,15,35,55,169,124,47,159,109,192,207,249,246,80,113,86,75,118,163,234,80,120,189,205,201,2,245,124,159,131,106,81,118,216,173,192,132,187,150,0,101,242,130,195,86,6,237,247,175,223,190,125,215,193,182,174,57,21,66,72,205,97,215,72,109,33,186,155,252,83,54,137,239,62,174,96,113,156,69,215,187,124,67,213,63,99,113,176,219,131,239,126,124,1,235,249,31,223,190,192,149,119,188,125,210,175,136,113,132,133,193,110,7,122,21,123,218,99,229,222,38,67,190,219,31,234,45,134,2,38,56,105,182,161,1,99,147,222,165,27,220,39,184,143,86,15,16,62,142,143,68,75,175,123,152,241,101,209,159,163,135,122,253,150,213,91,60,191,31,242,42,173,167,84,48,73,122,56,131,69,62,130,69,130,19,69,234,143,164,200,17,174,56,19,90,33,41,222,4,92,40,33,243,35,22,56,223,189,253,249,205,139,238,52,138,181,64,227,110,219,130,44,244,146,22,134,51,41,210,74,118,22,237,78,27,83,102,35,79,35,237,46,218,111,227,117,210,12,125,145,222,220,86,173,69,51,11,223,36,235,116,7,212,72,236,250,73,148,94,67,61,0,43,223,165,48,182,155,51,172,252,21,107,232,2,126,90,3,42,43,220,36,107,162,34,206,213,80,40,52,136,227,115,147,194,84,104,155,92,87,66,1,23,173,252,93,180,59,128,33,66,99,18,160,211,50,131,21,235,134,25,212,42,21,250,210,171,247,111,158,189,233,2,67,235,9,99,99,129,246,113,77,151,128,143,178,188,58,143,207,169,39,63,106,245,58,121,19,191,57,61,139,104,192,217,226,140,8,122,81,124,2,254,66,237,90,229,210,236,186,81,14,67,130,80,185,87,111,190,239,43,135,245,68,202,157,63,166,170,21,201,30,154,33,59,89,13,198,237,114,39,131,137,127,90,129,97,15,75,239,97,101,72,74,183,133,80,211,175,196,29,32,69,146,41,120,191,127,245,230,213,135,151,61,135,165,53,39,1,206,146,20,5,215,234,112,189,200,242,34,138,251,3,64,112,167,62,44,69,255,248,248,144,149,241,53,174,150,235,21,9,252,115,34,26,1,252,5,190,108,85,103,65,34,38,117,242,29,11,225,216,168,176,205,59,234,152,210,134,227,226,70,165,237,102,138,130,191,156,148,73,178,97,237,222,229,233,166,219,112,57,80,25,97,75,227,109,250,7,221,181,36,77,112,168,127,74,113,223,51,194,70,187,211,168,109,95,216,160,19,172,140,161,52,50,60,184,228,100,133,120,233,251,244,132,236,51,119,196,237,211,33,86,224,244,187,125,94,84,184,13,203,175,99,169,9,144,193,238,30,105,173,226,138,147,179,75,139,2,88,111,245,13,124,253,203,55,113,246,112,117,249,43,218,49,126,2,104,127,109,251,251,252,191,190,163,133,91,29,222,241,235,237,36,222,156,211,2,160,81,124,67,184,63,142,158,63,251,0,171,162,79,57,249,29,108,99,123,216,101,101,111,183,118,147,108,19,240,4,170,67,68,148,120,252,235,89,116,139,10,48,93,234,111,121,109,104,181,86,155,23,228,115,244,252,231,55,224,43,27,192,0,2,47,210,27,145,204,28,34,185,95,223,198,217,13,82,31,25,136,109,12,177,19,106,240,208,75,212,217,176,207,136,202,164,86,87,187,195,182,74,7,186,145,111,247,91,162,228,89,84,222,166,215,100,183,30,62,149,48,131,155,84,162,30,24,169,84,176,165,129,76,180,47,248,92,164,192,60,29,2,78,8,29,137,97,7,194,162,95,200,69,174,14,217,85,154,145,54,120,139,32,95,176,205,208,116,219,78,3,243,140,14,13,57,119,184,197,45,150,124,151,112,99,99,160,219,89,116,157,23,235,4,131,174,146,154,87,164,184,55,101,139,116,211,250,209,
+25,86,228,117,28,209,56,174,134,192,254,148,20,160,253,174,22,134,61,39,35,75,76,135,77,17,202,100,157,131,62,232,114,100,243,164,34,44,83,148,149,5,117,213,176,110,53,239,99,61,95,255,246,64,110,191,79,32,92,70,105,87,191,3,255,49,146,43,73,171,95,125,42,226,125,171,30,253,146,157,91,192,36,138,78,109,15,56,43,75,59,39,137,10,178,57,168,166,213,32,69,157,42,83,114,193,124,82,29,152,151,170,66,67,226,39,150,79,55,16,105,163,109,10,145,180,156,175,163,22,122,68,93,29,8,181,148,30,232,60,136,58,19,234,129,15,77,105,71,67,78,59,182,220,177,115,21,175,111,79,170,10,103,29,103,24,123,246,215,233,54,249,166,172,138,17,88,72,165,33,65,199,48,139,252,68,28,139,0,176,73,178,146,133,51,186,7,15,177,143,249,32,61,209,169,30,246,9,249,233,80,38,101,51,223,108,127,71,77,136,202,221,185,14,54,68,79,241,72,129,79,41,56,56,44,76,96,241,76,153,24,202,52,141,149,73,113,215,91,169,16,181,160,103,39,229,31,223,108,179,27,126,26,210,229,58,90,172,237,230,119,69,66,142,210,105,55,127,193,57,225,217,29,49,120,236,50,244,172,68,13,31,149,127,60,234,174,140,178,235,60,58,137,86,221,176,124,66,63,2,206,48,230,237,223,167,188,10,88,147,139,109,5,204,172,32,166,197,0,192,106,75,45,14,214,218,200,236,88,176,192,25,25,204,252,226,85,126,168,216,148,40,205,162,95,96,176,138,116,5,11,244,51,98,4,191,70,180,40,183,182,123,85,213,109,149,36,88,238,139,124,159,20,176,242,110,66,38,182,85,64,216,44,54,23,17,223,181,155,164,122,143,125,30,244,14,129,229,123,194,10,114,88,214,153,9,52,135,96,93,29,96,46,73,240,227,68,110,146,114,93,164,251,42,47,168,101,150,103,200,146,183,9,59,214,223,237,11,156,42,147,89,24,57,136,128,193,175,56,67,226,151,215,216,228,46,217,229,197,67,180,199,89,35,17,133,147,238,104,181,218,95,128,122,63,193,183,168,226,201,105,247,16,6,126,2,63,139,215,176,66,59,233,118,18,251,24,245,58,89,23,21,79,94,215,135,162,192,47,1,228,124,77,71,139,234,1,170,239,226,251,122,159,10,247,248,183,9,73,143,56,109,166,183,3,165,200,28,247,3,120,80,15,124,12,103,96,73,3,205,154,242,145,88,57,226,140,117,86,8,186,42,157,69,55,10,156,225,129,85,187,248,167,229,169,198,125,221,222,229,91,98,19,53,213,143,42,134,133,197,26,21,240,75,22,239,26,173,184,185,189,24,150,50,169,254,43,121,232,225,113,22,193,138,68,48,163,232,232,1,53,127,75,184,81,123,159,84,84,135,71,240,245,163,218,35,30,68,248,128,113,61,66,9,143,46,162,87,25,43,143,159,207,58,1,237,183,164,200,146,45,141,85,37,68,173,172,218,62,68,43,48,131,223,0,208,18,189,45,39,189,134,137,224,58,134,112,8,189,219,28,246,91,178,188,104,26,194,249,245,3,218,121,15,141,222,70,76,60,4,161,191,103,64,161,255,175,100,96,168,184,5,71,246,1,40,167,209,30,54,147,86,154,174,115,200,210,223,129,77,78,160,171,167,125,252,159,173,193,21,75,241,16,140,114,74,83,151,219,190,128,206,98,194,17,46,165,104,156,56,236,9,159,198,164,32,140,74,122,151,110,211,155,4,15,89,137,143,167,37,177,137,232,71,20,119,124,20,21,191,224,114,49,207,182,15,191,178,204,30,226,123,159,34,252,10,34,26,50,19,105,235,2,10,199,191,80,194,108,202,215,133,177,28,13,57,84,62,22,254,244,75,145,86,9,198,225,94,203,24,64,209,88,136,123,147,118,65,35,134,27,214,38,161,123,69,82,144,98,146,197,244,22,125,255,55,140,226,49,139,179,76,229,51,22,161,177,197,242,176,42,19,0,29,96,161,58,148,209,53,142,10,93,230,103,81,66,22,196,59,232,9,132,49,20,202,251,17,97,130,170,76,182,215,125,71,21,142,214,169,200,75,251,99,195,172,133,6,111,50,26,56,196,108,58,81,135,92,58,28,36,110,224,40,22,16,230,135,193,226,61,233,215,58,121,30,151,201,64,147,206,182,11,227,17,174,124,171,207,15,9,75,51,99,191,210,227,81,156,254,147,233,15,182,51,22,57,210,242,125,94,192,66,254,100,202,107,234,130,130,136,197,118,211,
+176,199,156,179,0,103,38,69,178,233,238,70,210,54,222,37,48,53,41,19,101,153,172,188,178,232,130,150,7,75,231,148,80,155,125,170,76,57,149,39,155,92,120,120,131,225,188,79,88,56,49,167,177,1,199,169,23,20,176,6,55,204,184,99,26,227,1,43,217,124,34,236,128,155,255,212,237,123,150,37,18,38,230,160,231,207,127,202,6,114,74,176,33,8,207,21,61,246,109,229,201,168,135,50,236,32,244,85,242,190,209,26,147,189,147,49,114,119,189,154,150,31,138,56,43,241,188,100,58,248,115,133,159,240,125,24,105,66,160,127,83,186,237,194,143,241,111,73,19,116,170,250,247,139,168,9,72,199,71,171,28,120,61,206,234,12,25,182,135,86,162,1,227,204,157,68,140,205,14,38,182,128,27,157,36,225,214,8,30,42,65,92,161,100,176,233,57,47,44,251,75,40,174,216,245,182,116,167,239,99,141,8,58,223,22,151,244,126,223,20,232,90,74,124,151,156,100,187,100,74,2,20,187,20,85,99,44,218,235,21,254,204,77,95,98,98,72,100,12,242,168,132,9,52,208,194,25,34,12,213,62,1,154,219,60,222,176,157,225,77,10,19,27,24,160,102,150,81,143,84,61,19,120,245,150,84,201,18,12,243,113,129,101,127,130,1,44,49,192,212,139,50,152,182,28,31,225,30,51,205,10,134,192,223,236,68,223,165,57,151,129,92,229,59,146,22,183,219,129,38,48,173,170,114,48,234,63,253,169,99,201,0,238,223,96,154,223,159,110,15,186,76,139,245,215,103,208,111,92,36,64,175,139,3,44,43,48,4,103,220,108,166,231,180,175,232,34,162,84,16,86,23,29,10,204,234,181,72,169,34,21,194,249,3,48,212,38,58,89,61,238,134,138,213,101,127,127,124,200,4,164,42,55,71,74,202,170,29,42,220,1,111,166,27,37,149,2,20,152,229,85,55,56,22,201,161,207,59,103,155,100,219,46,132,165,241,159,212,4,17,156,173,221,30,174,175,183,73,27,249,81,58,57,98,196,179,198,4,141,143,204,102,201,102,64,115,0,70,29,27,211,193,15,89,127,195,24,36,252,24,239,21,212,235,47,217,107,229,118,60,49,189,72,10,114,240,9,234,225,44,0,126,219,163,145,226,212,128,148,39,94,130,179,133,13,14,25,217,170,193,89,126,126,190,74,206,233,126,119,231,188,102,151,20,55,9,110,237,156,196,220,110,210,138,211,77,178,159,208,84,228,194,5,126,69,6,173,187,87,196,178,210,242,44,233,238,35,84,72,231,235,202,68,122,167,114,171,193,171,250,107,101,45,192,192,33,96,87,245,232,144,61,11,110,255,162,227,51,180,40,231,47,249,254,129,95,88,148,7,32,0,250,76,7,117,29,28,24,92,232,71,183,249,22,166,220,9,204,37,33,62,149,85,10,177,164,254,61,7,171,62,195,69,80,73,38,69,116,110,3,83,136,156,123,214,128,149,188,190,46,113,29,199,78,193,201,195,5,16,200,214,48,81,45,185,19,171,58,47,2,250,112,145,37,159,112,47,108,236,76,226,187,31,95,128,197,64,193,39,210,154,103,100,89,207,78,243,230,181,177,205,110,206,106,38,25,217,21,215,82,202,110,131,220,22,154,172,13,217,22,90,178,219,195,154,186,153,37,208,93,6,178,164,193,233,206,57,238,48,148,17,229,126,122,206,214,73,128,65,125,74,24,231,109,114,130,167,8,35,243,86,170,8,45,43,160,139,102,195,50,142,104,25,182,253,146,84,125,113,251,24,22,234,24,185,6,116,209,126,184,184,184,232,9,110,106,9,100,195,210,63,37,83,202,114,75,54,177,242,59,182,246,38,211,32,246,148,12,221,236,36,103,24,24,216,209,35,232,150,222,38,130,41,62,44,21,47,20,21,133,145,79,145,198,169,21,100,196,66,71,16,107,90,185,28,104,78,178,147,206,1,51,162,119,87,237,85,145,255,70,242,245,113,238,129,107,16,204,39,33,114,59,129,30,245,76,123,244,187,170,146,193,100,136,234,82,151,124,50,90,191,188,173,102,213,135,191,103,213,7,103,152,85,255,122,59,79,254,102,181,157,168,207,141,228,109,2,203,27,228,193,228,158,204,83,113,28,139,104,221,159,212,144,169,247,125,61,159,233,47,124,120,45,112,251,148,31,200,206,46,112,87,13,40,250,100,170,13,50,152,51,219,32,3,58,179,13,50,168,51,219,32,3,59,179,13,50,184,227,109,8,55,104,216,252,191,179,189,222,76,88,233,224,54,
+211,214,11,62,149,163,206,229,136,183,55,201,170,136,249,213,53,204,240,246,171,135,147,155,116,211,57,84,91,67,147,29,79,24,78,70,158,189,254,129,213,30,28,109,12,78,144,72,65,208,17,38,143,85,122,157,54,199,59,157,205,79,246,60,23,62,19,216,158,99,144,245,114,149,238,146,54,109,164,78,206,72,19,126,69,93,151,111,219,32,66,9,88,221,120,117,13,80,157,12,22,247,140,118,120,135,131,30,98,89,241,166,54,197,155,102,127,229,108,45,79,15,251,163,232,213,53,76,213,233,172,8,211,2,136,91,214,207,175,70,111,95,189,56,207,210,237,197,23,17,175,83,82,173,111,251,74,221,179,140,22,242,185,163,21,150,70,77,133,154,117,82,105,81,62,204,166,238,49,196,55,202,146,49,249,42,250,235,211,232,62,250,107,180,186,88,195,52,191,195,145,176,160,251,103,210,78,14,153,66,119,228,143,175,249,89,194,215,29,123,96,213,112,68,90,213,190,199,173,242,102,160,24,63,195,120,149,152,131,212,201,97,162,181,145,236,72,42,35,111,143,36,139,146,23,27,77,106,209,225,233,159,232,119,52,69,50,205,246,7,88,28,144,231,93,72,118,38,249,162,255,72,232,94,180,247,46,160,88,144,136,133,135,99,177,191,125,40,201,254,15,254,44,222,109,34,150,209,31,118,126,18,148,86,188,28,82,124,40,168,94,53,62,130,154,143,162,124,189,62,20,244,20,237,162,183,28,223,14,199,52,218,230,159,234,105,224,45,128,81,255,189,77,81,56,126,71,255,11,99,149,242,211,204,126,40,160,141,63,230,79,94,240,11,178,233,221,58,109,73,104,138,110,24,245,210,104,210,146,62,24,152,145,125,239,87,100,136,210,178,94,112,158,99,27,201,134,206,44,243,67,37,253,149,26,88,154,29,31,53,237,119,227,70,19,56,137,4,172,33,83,233,248,136,123,158,148,91,21,147,211,1,192,19,225,226,158,41,198,93,153,109,138,193,103,143,214,119,151,108,31,142,143,110,83,242,212,117,82,157,178,199,156,153,238,100,43,191,108,150,62,89,79,52,141,33,32,232,248,8,148,35,130,48,181,51,221,158,209,231,83,112,89,30,227,17,82,137,123,2,196,155,82,178,51,28,157,36,215,215,181,120,60,203,128,240,117,244,101,147,155,122,74,27,198,193,100,122,157,241,17,51,173,31,197,221,237,233,185,37,20,127,3,190,124,196,122,158,114,122,226,4,54,195,73,33,166,17,226,81,193,89,116,200,182,104,13,160,246,83,162,42,234,77,254,58,62,218,166,79,137,129,225,191,40,253,233,87,208,244,51,176,13,242,168,71,247,88,170,125,252,251,186,105,11,145,100,141,17,236,183,41,182,70,149,0,0,200,179,232,208,52,102,9,97,235,143,193,132,222,228,85,210,46,37,91,155,41,15,41,61,188,193,60,45,154,66,68,109,161,62,100,32,185,175,208,103,92,91,209,200,222,217,8,235,109,23,139,124,170,67,165,86,29,236,114,210,193,152,121,147,68,40,85,35,175,29,143,38,0,119,74,242,142,211,4,150,166,9,42,236,248,168,131,35,6,57,250,132,0,175,132,196,151,185,68,174,182,28,62,106,41,114,107,230,46,40,122,60,10,28,31,177,48,16,153,69,1,188,8,129,143,76,186,81,0,239,48,104,195,64,164,29,5,152,199,53,97,32,210,139,2,199,71,195,48,16,105,70,129,227,163,126,24,136,116,162,0,184,252,32,12,68,26,81,128,191,5,226,90,16,82,28,71,129,20,58,32,116,120,104,165,138,197,94,223,240,54,104,176,231,15,201,251,174,204,181,49,131,48,243,85,242,80,207,119,183,100,27,182,190,196,231,237,79,209,199,103,175,151,100,81,28,61,170,83,121,155,178,93,64,61,2,84,196,188,236,231,160,234,14,128,131,128,58,28,152,136,31,23,197,32,203,65,223,205,119,229,131,236,103,62,192,61,26,5,95,133,48,211,123,184,128,255,48,228,67,90,69,56,134,248,156,75,27,83,58,164,13,58,245,13,137,157,177,83,46,46,73,104,24,217,85,69,249,208,200,227,199,162,220,201,122,186,95,111,163,113,16,180,9,56,23,109,118,219,135,6,102,84,142,193,135,49,237,132,61,170,117,202,101,96,38,155,94,77,178,109,78,47,100,40,215,73,70,30,211,75,235,251,117,72,159,34,60,125,162,113,30,76,230,8,106,33,229,163,166,180,159,68,193,186,14,251,138,171,194,37,60,104,1,119,210,45,
+199,29,109,12,96,188,52,134,145,64,198,14,72,33,200,183,208,32,251,226,78,67,9,182,249,137,179,100,60,1,45,146,58,143,226,255,191,131,48,62,32,95,27,15,200,25,55,26,237,32,180,104,141,140,198,25,55,152,237,174,17,159,19,251,191,205,120,229,157,189,13,147,208,115,249,175,208,163,136,162,122,28,186,252,87,28,90,118,68,198,71,231,95,65,201,227,224,221,204,142,80,95,255,43,66,153,64,170,30,174,190,254,87,184,10,104,120,198,135,234,95,177,107,254,72,54,67,73,159,91,24,217,10,144,173,251,105,69,241,146,159,61,12,81,239,186,20,249,174,191,205,201,111,1,76,173,189,237,111,107,30,31,113,203,118,245,109,77,98,54,96,21,184,71,139,125,133,145,211,60,136,248,32,218,224,165,250,213,73,118,77,190,89,201,123,156,104,152,198,71,230,177,233,200,40,141,201,228,126,200,241,145,9,178,81,3,44,221,244,214,217,255,224,15,28,139,188,44,247,228,252,188,226,207,63,219,231,173,59,39,160,151,16,100,142,142,78,184,92,202,179,66,18,128,248,150,5,148,113,89,95,179,192,206,102,217,83,214,103,116,63,185,172,104,6,94,123,105,3,180,15,214,20,209,129,120,132,138,62,34,33,227,17,209,240,81,119,159,8,83,70,11,150,242,4,224,210,226,88,155,175,65,228,38,191,227,147,131,8,80,103,175,230,159,121,154,157,116,31,45,47,58,159,74,30,130,146,195,224,44,75,183,87,116,87,186,36,113,60,129,190,192,103,150,233,118,194,149,148,0,135,178,91,188,254,19,62,117,174,174,131,174,44,169,93,45,191,213,240,53,30,110,227,87,162,231,150,59,168,130,141,38,197,146,202,55,10,244,180,39,223,171,245,161,76,118,233,146,93,168,229,243,49,107,151,170,233,78,54,160,103,40,159,239,73,230,223,236,62,52,122,116,238,26,170,226,241,94,52,143,4,224,41,139,239,33,120,2,209,227,255,136,254,243,237,171,55,87,111,94,70,79,159,70,231,95,31,31,157,20,143,207,138,75,32,151,167,60,180,103,5,8,7,145,103,231,95,247,225,106,100,97,123,44,49,135,53,242,228,24,159,127,170,187,214,201,144,203,54,51,122,187,126,204,14,39,214,151,236,15,118,4,204,78,128,181,7,175,214,167,29,187,231,117,196,252,134,59,171,219,146,88,203,14,232,112,130,85,68,231,209,250,113,244,215,95,158,254,10,63,146,255,20,209,151,209,250,178,123,103,109,118,147,136,122,219,125,212,161,184,84,236,253,204,190,54,234,112,252,69,78,172,37,189,125,252,151,226,146,235,113,175,183,157,158,110,210,235,107,224,169,108,157,56,49,99,241,124,167,21,202,61,224,208,124,135,124,91,15,219,84,40,105,30,8,240,168,125,35,83,240,0,2,75,153,24,83,63,58,73,47,96,102,121,27,111,175,73,198,52,132,205,115,28,199,211,62,241,95,167,91,104,213,78,199,100,125,105,229,240,151,26,116,110,252,160,153,236,237,209,63,233,30,153,254,237,226,7,122,98,71,82,40,206,232,156,40,198,117,203,46,222,227,57,244,243,109,14,223,208,246,113,18,88,240,89,118,173,232,213,33,221,110,78,122,61,235,184,79,47,51,189,238,13,102,103,138,123,67,154,228,66,131,84,165,110,199,10,114,95,9,167,26,76,28,87,9,155,162,225,99,28,219,250,241,179,125,252,80,146,219,7,235,187,121,0,147,252,134,100,162,137,199,145,180,212,27,204,206,240,93,183,125,210,31,61,210,250,220,33,36,235,85,252,145,193,115,77,102,233,205,133,155,184,254,227,51,241,127,197,220,123,242,100,71,92,174,233,94,65,253,148,203,152,210,180,29,209,29,26,116,133,249,134,211,242,249,23,79,70,229,119,14,192,157,43,35,188,16,231,189,142,138,55,225,235,59,174,149,2,89,45,52,190,182,53,243,58,216,222,148,31,123,118,242,84,182,159,77,202,242,75,103,122,179,71,149,224,93,138,152,130,69,86,251,215,209,67,126,64,153,23,209,219,250,254,204,179,227,35,118,75,76,18,37,89,126,184,185,109,210,248,241,121,247,53,121,185,14,75,188,194,20,225,236,56,58,106,174,157,136,78,48,173,41,205,238,242,237,93,253,154,30,124,172,238,180,155,60,129,79,238,8,115,199,207,162,7,238,82,68,209,62,61,86,189,18,100,146,211,13,44,242,72,80,243,72,37,217,12,193,71,47,239,163,10,115,186,31,240,77,15,194,23,
+40,73,52,34,227,255,48,242,160,89,173,209,136,54,77,32,167,79,81,85,109,82,123,173,149,138,38,228,177,169,135,145,7,251,26,108,58,119,117,58,210,70,25,151,43,124,102,196,158,54,135,149,178,66,131,108,84,86,87,170,17,238,18,53,137,75,58,218,241,143,171,220,220,20,157,55,196,28,186,143,244,147,135,0,248,199,104,72,42,62,20,186,234,92,247,197,105,85,95,220,212,220,214,36,186,169,41,205,218,76,253,142,236,206,29,20,0,84,122,147,229,69,114,5,83,149,178,190,127,78,168,77,198,103,40,113,218,12,133,215,10,110,31,26,45,152,148,242,248,232,136,0,71,96,204,240,169,74,220,75,132,37,3,175,198,211,167,31,222,253,252,114,160,248,85,150,227,207,221,59,52,46,127,149,234,155,27,169,76,182,79,57,157,155,171,74,59,42,55,207,37,53,26,198,197,38,205,226,45,94,204,213,213,79,4,40,20,22,143,108,219,10,127,164,194,31,42,14,36,239,210,172,159,108,70,254,203,11,132,50,240,157,80,228,54,255,132,119,186,243,41,153,69,68,158,236,225,31,51,143,239,167,101,196,247,50,25,152,239,42,23,82,19,113,124,119,19,157,12,160,227,175,3,254,238,199,23,248,190,55,40,216,191,27,133,220,230,112,71,182,120,113,18,207,1,214,223,161,46,171,77,114,55,184,250,151,151,130,129,1,11,137,100,224,227,62,27,24,164,8,126,79,155,91,3,134,34,59,210,246,74,226,246,54,228,145,119,230,101,221,104,40,146,88,151,19,201,172,127,83,147,180,87,21,181,215,151,213,123,28,158,28,207,165,27,48,197,187,238,124,167,243,128,233,219,87,47,254,135,62,53,218,89,215,215,207,244,161,84,40,194,158,124,139,11,178,39,179,99,119,101,178,35,71,78,3,5,249,252,99,204,203,235,50,88,99,15,53,34,119,63,240,247,32,100,101,190,165,39,95,114,149,250,10,220,198,165,116,60,248,7,190,80,32,87,118,24,31,216,109,81,236,236,149,136,165,143,26,246,37,194,170,92,46,113,64,239,40,151,171,33,166,119,78,38,221,14,104,37,55,23,83,209,167,77,229,128,115,231,234,194,105,15,42,50,212,162,189,172,133,83,162,243,180,107,61,127,32,199,221,253,135,93,251,231,145,39,244,217,84,110,249,145,220,227,93,63,252,55,183,208,181,156,123,28,182,209,240,135,119,63,145,234,143,159,140,9,57,235,28,77,91,17,120,249,132,159,198,137,100,222,216,148,89,203,152,22,203,183,232,68,133,175,117,122,126,150,240,173,243,15,52,219,82,231,223,76,17,113,175,218,191,247,77,127,147,103,137,23,243,31,10,242,227,2,2,185,190,220,96,188,203,222,92,97,28,129,69,220,65,29,25,63,46,49,184,20,161,187,202,44,15,59,254,238,11,145,126,204,119,96,69,214,222,231,208,206,219,126,248,225,29,180,241,245,85,231,213,65,63,160,116,150,227,131,34,112,63,5,154,255,98,158,96,44,55,20,188,226,231,76,74,130,87,202,178,207,202,223,210,125,179,226,61,139,87,121,81,93,229,217,21,185,183,148,223,182,21,168,134,82,196,202,161,94,56,12,248,226,157,25,170,241,39,65,243,212,36,23,197,79,171,218,219,100,44,201,46,99,239,74,131,205,236,65,197,70,198,70,149,165,246,136,71,86,93,131,89,152,161,24,177,138,181,118,178,241,213,81,208,210,0,163,72,249,8,15,20,158,28,101,3,207,197,43,113,134,158,11,223,46,239,185,2,213,136,231,10,149,91,206,115,37,106,146,113,157,86,213,137,231,14,84,162,158,43,31,85,223,158,43,194,140,120,174,80,197,133,61,87,166,172,124,132,189,120,46,94,68,53,244,220,206,49,193,82,158,43,80,141,120,174,80,185,229,60,87,162,38,25,215,105,85,157,120,238,64,37,234,185,242,81,245,237,185,34,204,136,231,10,85,92,216,115,101,202,202,71,216,139,231,118,115,101,106,207,237,28,96,45,229,185,2,213,136,231,10,149,91,206,115,37,106,146,113,157,86,213,137,231,14,84,162,158,43,31,85,223,158,43,194,140,120,174,80,197,133,61,87,166,172,124,132,103,121,46,82,188,195,5,54,52,63,83,176,225,52,125,32,120,165,44,123,209,105,250,148,106,97,79,211,141,7,85,99,154,62,28,89,117,13,2,152,166,123,26,96,135,211,116,213,65,54,156,166,251,240,92,23,211,116,7,3,235,113,154,110,60,168,26,211,116,47,158,
+235,110,154,238,105,128,29,78,211,85,7,217,112,154,238,195,115,93,76,211,29,12,172,199,105,186,241,160,106,76,211,189,120,174,187,105,186,167,1,118,56,77,199,64,225,112,154,158,102,115,5,27,146,253,64,240,74,89,246,162,100,63,165,90,216,100,111,60,168,26,100,63,28,89,117,13,2,32,123,79,3,236,144,236,85,7,217,144,236,125,120,174,11,178,119,48,176,30,201,222,120,80,53,200,222,139,231,186,35,123,79,3,236,144,236,201,211,151,238,200,30,154,159,41,216,48,100,12,4,175,148,101,47,26,50,166,84,11,59,100,24,15,170,70,200,24,142,172,186,6,1,132,12,79,3,236,48,100,224,59,145,84,6,25,203,13,61,23,190,29,247,92,40,32,119,143,113,217,202,136,9,84,35,158,43,84,78,209,115,167,84,51,24,88,137,154,100,92,167,85,213,242,92,227,65,165,158,43,31,85,206,115,135,35,171,174,193,44,204,136,231,10,85,212,241,92,79,3,220,120,174,154,194,46,60,215,144,236,125,120,174,64,53,226,185,66,229,150,243,92,137,154,100,92,167,85,117,226,185,3,149,168,231,202,71,213,183,231,138,48,35,158,43,84,113,97,207,149,41,43,31,225,89,158,139,226,28,122,46,20,144,187,199,184,236,69,61,119,74,181,176,61,215,120,80,53,60,119,56,178,234,26,4,224,185,158,6,216,129,231,146,151,240,198,219,254,43,98,165,94,90,151,231,94,98,72,191,193,198,200,221,10,43,122,131,17,212,139,14,251,40,185,143,215,120,113,64,149,211,183,112,31,118,67,55,17,233,48,130,102,126,125,77,238,130,232,32,217,220,213,66,134,66,120,87,75,227,36,195,62,52,16,242,125,145,116,131,60,198,141,241,232,154,94,61,69,30,225,57,107,47,146,96,215,25,67,99,219,3,189,138,170,46,201,181,62,49,10,236,69,187,139,142,194,132,77,255,239,54,10,241,221,77,39,133,173,123,77,80,34,120,60,121,48,48,208,196,227,177,120,23,227,203,170,111,18,65,146,159,142,112,1,196,221,39,203,152,42,151,234,170,156,69,48,14,57,123,197,97,25,53,47,94,229,12,164,175,161,155,104,140,8,138,181,174,21,150,69,99,13,253,44,5,99,212,85,30,140,7,250,42,4,99,171,32,171,88,9,21,121,169,216,3,187,86,162,53,10,26,157,153,59,36,147,189,228,239,27,49,141,20,164,145,209,9,239,240,158,144,147,50,198,55,31,254,5,223,74,184,74,241,250,171,83,73,34,248,64,67,71,179,98,148,35,153,108,170,169,47,157,58,235,244,192,214,228,25,101,142,76,159,53,123,52,237,238,157,155,100,102,25,210,94,215,146,246,249,254,64,223,147,247,151,105,75,218,251,50,165,189,58,242,130,14,140,218,210,126,9,99,218,235,89,211,88,159,38,173,169,127,79,144,169,61,213,237,140,89,84,115,199,143,114,68,18,106,231,198,146,106,81,98,253,71,85,151,89,144,174,246,150,108,168,22,43,183,34,181,222,40,219,206,222,150,241,236,213,172,71,53,10,137,245,115,107,62,251,41,196,53,34,144,182,254,150,13,104,175,98,65,179,162,15,55,237,35,121,133,110,215,78,189,204,75,29,225,182,215,78,32,80,111,86,108,41,47,212,217,218,201,65,90,168,255,181,211,108,144,151,94,59,89,29,133,80,215,78,166,145,194,226,218,73,144,157,63,208,240,179,94,59,121,114,231,101,215,78,179,12,201,210,218,73,98,73,123,95,166,228,99,237,228,211,152,150,92,59,153,218,147,141,181,211,208,142,132,218,125,182,107,39,79,54,180,220,218,105,174,241,204,90,59,201,173,103,239,209,124,156,174,157,60,27,144,215,181,19,73,211,118,187,118,234,37,178,235,8,183,189,118,34,111,59,208,153,21,91,74,179,119,182,118,114,144,101,239,127,237,52,27,228,165,215,78,86,71,33,212,181,147,105,164,176,184,118,18,60,236,52,208,240,179,94,59,121,114,231,101,215,78,179,12,201,210,218,73,98,73,123,95,166,228,99,237,228,211,152,150,92,59,153,218,147,141,181,211,208,142,132,218,125,182,107,39,79,54,180,220,218,105,174,241,204,90,59,201,173,103,239,209,124,156,174,157,60,27,144,215,181,19,121,94,205,237,218,169,247,68,159,142,112,219,107,39,250,206,66,141,89,177,165,231,13,157,173,157,28,60,110,232,127,237,52,27,228,165,215,78,86,71,33,212,181,147,105,164,176,184,118,18,60,245,61,208,
+240,179,94,59,121,114,231,101,215,78,179,12,201,210,218,73,98,73,123,95,166,228,99,237,228,211,152,150,92,59,153,218,147,141,181,211,208,142,132,218,125,182,107,39,79,54,180,220,218,105,174,241,204,90,59,201,173,103,239,209,124,156,174,157,60,27,144,215,181,19,121,222,206,237,218,169,247,100,182,142,112,219,107,39,16,168,55,43,118,248,220,184,149,181,147,167,199,198,221,174,157,102,131,188,244,218,201,234,40,132,186,118,50,141,20,22,215,78,130,219,59,6,26,126,214,107,39,95,215,124,44,186,118,154,101,72,150,214,78,18,75,218,251,50,37,31,107,39,159,198,180,228,218,201,212,158,108,172,157,134,118,36,212,238,179,93,59,121,178,161,229,214,78,115,141,103,214,218,73,110,61,123,143,230,227,116,237,228,217,128,188,174,157,200,20,205,237,218,169,119,55,142,142,112,219,107,39,40,164,55,43,118,120,115,143,149,181,147,167,139,123,220,174,157,102,131,188,244,218,201,234,40,132,186,118,50,141,20,22,215,78,130,251,211,6,26,126,214,107,39,95,23,173,45,186,118,154,101,72,150,214,78,18,75,218,251,50,37,31,107,39,159,198,180,228,218,201,212,158,108,172,157,134,118,36,212,238,179,93,59,121,178,161,229,214,78,115,141,103,214,218,73,110,61,123,143,230,227,116,237,228,217,128,220,175,157,118,105,86,247,141,245,65,210,187,203,218,118,104,177,142,198,208,200,215,124,155,241,125,175,77,169,69,94,114,23,150,138,26,142,239,191,238,142,136,134,190,253,187,16,219,114,125,184,161,209,33,192,240,101,186,27,185,80,86,75,19,153,93,76,104,133,3,167,160,153,202,2,101,56,40,54,128,139,239,5,234,197,247,227,192,233,104,98,4,92,124,47,1,174,175,153,18,112,115,45,78,96,215,180,217,171,187,120,187,176,221,73,117,35,129,71,77,63,47,214,39,81,52,190,151,40,233,211,6,165,186,141,128,168,109,137,100,53,171,30,86,207,32,172,166,55,89,94,36,125,109,7,239,253,32,45,127,109,46,10,34,248,104,203,168,192,16,129,193,234,156,124,113,149,229,8,175,50,37,77,137,206,81,120,119,232,69,189,211,52,70,209,171,83,72,179,146,110,74,205,80,83,151,41,67,148,234,37,14,135,61,221,164,38,216,18,123,178,129,57,135,242,224,200,221,131,54,244,181,192,47,200,15,93,188,210,108,155,102,73,116,125,200,214,100,185,37,210,2,100,145,63,158,28,31,173,178,232,155,167,196,199,89,185,179,168,42,14,201,41,252,68,119,134,162,120,123,147,172,138,248,226,58,169,214,183,39,171,236,44,250,234,255,249,10,126,79,112,59,23,36,95,208,154,189,136,33,234,187,106,56,160,149,219,238,254,40,232,230,148,44,59,1,179,167,200,24,238,51,20,50,140,152,68,138,132,186,123,10,246,140,117,104,171,191,31,226,172,74,183,137,178,210,191,15,239,250,22,168,89,55,43,176,221,250,167,113,235,149,232,213,149,62,176,229,182,214,89,244,187,190,65,215,213,187,163,58,173,138,242,232,213,77,181,168,252,93,136,134,158,116,43,38,63,84,109,124,192,172,169,104,230,4,181,204,81,55,104,52,151,120,65,115,56,181,223,23,249,253,149,146,205,225,42,179,115,14,213,173,219,234,242,140,252,144,238,80,224,16,66,152,28,148,21,249,113,67,181,139,163,234,124,147,222,36,227,154,237,56,76,63,113,127,107,233,120,181,75,138,155,41,77,243,107,114,35,61,20,90,129,99,110,26,237,74,6,38,212,44,96,208,0,234,56,43,35,152,162,129,182,159,146,244,230,22,75,244,15,77,84,241,213,53,101,225,169,149,108,64,154,83,18,27,3,35,232,149,194,216,56,232,95,127,48,71,123,105,109,80,235,22,203,223,104,44,157,58,191,37,134,41,12,133,180,133,86,255,15,160,95,173,22,125,37,196,117,94,244,253,224,44,138,75,210,19,170,40,175,38,84,193,151,69,212,93,41,37,177,74,164,248,200,232,40,191,55,98,234,21,18,170,221,110,95,15,209,130,48,28,252,113,28,224,135,180,104,145,80,122,207,68,93,90,16,132,232,202,99,3,177,19,214,189,213,96,98,137,239,66,20,4,157,110,45,113,208,201,14,187,85,82,160,14,117,185,8,150,131,7,152,91,159,100,121,69,39,224,105,118,19,1,240,167,2,255,252,219,195,62,41,94,231,55,240,255,136,226,42,246,212,177,14,216,88,219,76,244,88,
+228,153,78,123,78,106,215,237,138,61,181,189,218,119,184,44,236,214,236,154,234,80,112,107,166,157,202,36,58,137,150,115,99,122,77,47,150,6,26,139,155,85,81,90,226,105,195,94,156,69,105,86,23,44,54,73,33,133,154,148,62,41,90,77,5,222,49,172,160,235,26,253,88,62,236,29,20,42,198,160,31,232,57,141,187,116,233,44,233,138,158,205,171,117,9,226,216,109,82,36,245,16,166,209,42,217,230,217,77,137,47,216,161,195,115,243,75,250,43,89,229,176,255,237,242,205,1,216,111,247,91,242,192,193,81,228,21,168,115,114,71,2,123,148,129,115,151,120,217,64,111,176,126,252,175,151,255,47,45,217,246,106,155,92,87,231,244,75,136,185,120,9,67,180,122,160,45,160,216,125,92,85,9,172,55,110,227,242,22,154,7,4,79,7,77,226,111,109,131,235,120,187,198,195,9,104,142,212,162,128,8,218,194,8,100,218,86,191,169,42,177,213,84,121,107,77,43,28,0,75,77,93,111,173,53,5,172,110,171,41,104,197,26,236,85,49,223,176,86,135,237,111,87,212,150,175,238,243,226,138,180,125,219,243,137,179,136,154,177,204,53,154,154,173,228,125,94,86,223,68,191,124,3,191,60,253,245,228,151,111,104,65,248,243,150,181,11,124,246,11,86,249,245,100,117,122,202,135,41,69,141,86,189,247,249,9,2,20,42,184,206,179,178,18,53,201,169,90,36,223,68,209,45,153,62,173,162,242,54,63,108,225,15,8,48,15,217,26,162,80,14,128,39,241,230,56,170,255,167,223,181,9,176,185,103,33,7,144,75,59,134,109,145,206,45,217,177,137,49,19,119,76,113,228,150,30,52,198,26,160,92,143,56,72,231,132,19,169,97,31,226,74,213,33,251,108,181,218,230,43,248,58,174,242,93,253,119,173,64,5,125,41,78,78,161,87,181,172,231,175,223,62,39,223,62,105,10,93,23,249,142,22,227,11,177,111,219,98,235,221,158,180,212,109,11,190,125,210,237,239,105,191,8,126,219,150,201,14,219,237,176,12,126,219,150,41,96,64,134,101,240,219,182,204,167,34,5,78,238,119,141,124,219,22,218,31,42,129,206,240,109,91,100,147,108,5,69,224,219,182,200,54,201,110,42,210,49,190,8,253,150,235,124,18,239,5,157,135,111,121,243,135,241,57,129,245,1,252,231,148,252,123,204,23,198,47,174,200,183,141,25,188,201,243,61,76,64,14,48,253,73,46,190,24,182,68,66,187,184,161,102,4,143,143,123,22,1,11,5,228,117,84,34,194,22,142,251,3,223,213,225,38,169,200,116,107,245,128,167,24,248,59,145,142,75,202,56,162,205,157,69,176,202,220,30,31,97,177,235,180,128,165,233,87,164,56,76,128,73,85,220,57,101,147,54,172,250,197,19,153,66,56,119,222,36,247,232,255,145,68,185,116,115,175,167,219,241,17,102,153,21,100,125,20,87,84,175,71,68,204,35,162,118,212,104,125,124,52,170,246,69,71,111,50,2,148,92,163,225,16,208,223,91,69,203,42,47,146,70,39,170,95,191,205,12,140,119,71,222,80,73,236,3,48,232,52,73,127,110,155,140,234,206,183,19,101,10,3,44,63,170,219,180,108,218,167,177,161,252,125,139,95,124,51,25,35,222,255,253,181,82,152,96,229,90,59,107,214,15,84,18,154,39,253,235,180,254,195,216,220,185,38,209,226,69,205,177,239,56,187,239,6,200,246,229,191,201,246,176,193,216,241,205,29,44,96,58,109,176,223,160,52,193,174,41,218,54,134,113,185,239,134,43,206,161,35,97,15,159,72,253,54,146,251,109,191,239,171,1,156,83,194,196,168,69,227,168,117,217,165,55,178,96,0,117,99,156,107,190,255,240,142,88,139,124,32,185,6,208,217,73,27,184,89,86,38,21,91,75,245,218,251,16,167,220,57,255,59,122,48,131,198,78,83,121,127,161,117,47,46,178,95,193,189,193,242,27,207,42,127,249,10,191,85,16,122,70,22,164,116,37,209,147,254,254,176,122,79,42,13,84,32,41,173,76,80,173,3,253,239,151,164,185,95,69,202,112,186,124,121,18,109,137,30,81,193,66,71,79,244,119,121,182,142,185,221,32,250,57,201,112,42,80,125,202,89,203,101,199,59,24,67,69,164,135,24,55,249,208,1,109,190,38,191,11,225,164,85,121,165,59,45,103,36,162,200,91,126,142,63,11,27,102,8,176,246,33,36,145,150,58,141,31,178,116,157,111,146,103,21,27,154,54,246,
+15,5,253,247,119,183,197,179,170,27,248,227,186,133,104,125,27,23,241,26,166,206,199,71,39,24,90,201,90,251,148,242,65,51,24,48,179,75,241,204,144,55,13,214,192,201,39,108,65,108,137,223,67,35,40,157,155,155,229,217,93,82,240,242,171,28,62,52,74,116,35,23,82,79,249,223,41,140,15,237,37,4,149,235,244,158,69,128,180,211,201,159,200,79,220,107,143,201,103,104,56,89,255,198,107,13,188,68,91,140,24,112,229,225,154,181,137,99,212,107,245,61,249,177,109,149,126,110,91,229,168,224,117,254,41,41,184,209,238,65,65,126,238,152,38,195,129,33,12,48,108,177,8,68,201,50,233,178,229,207,251,253,88,203,228,231,241,150,15,88,164,105,185,197,55,137,139,117,139,196,90,98,168,240,237,123,82,146,195,129,124,166,199,6,173,95,95,68,212,136,75,136,43,181,197,156,69,231,143,163,244,58,194,173,214,107,240,242,13,223,183,226,74,81,133,119,9,244,169,76,222,15,53,97,191,176,190,24,107,212,98,178,223,166,21,190,9,186,209,41,75,146,205,54,161,127,95,167,201,118,35,154,97,33,76,117,77,14,38,252,170,30,7,76,75,78,182,233,46,69,51,231,244,186,73,239,146,140,182,28,157,52,187,209,196,255,114,96,128,206,26,16,90,218,201,45,1,227,238,158,147,142,31,163,79,183,32,176,220,199,107,152,221,196,5,246,183,19,174,154,56,56,222,244,107,252,121,172,105,162,47,113,216,126,64,108,6,123,92,194,59,37,9,108,90,41,12,184,92,251,224,214,151,99,32,93,242,6,180,203,239,18,26,208,243,140,156,13,177,1,131,88,5,140,153,209,177,219,62,180,65,138,233,66,66,117,2,165,54,205,212,148,226,219,78,229,199,113,30,209,146,224,237,72,203,246,235,122,184,198,20,46,212,20,126,231,67,97,110,81,209,87,183,5,120,15,43,224,90,93,160,80,137,183,190,134,98,173,182,223,227,90,230,176,239,4,77,114,136,71,124,147,17,49,176,207,30,52,32,63,195,111,173,109,118,233,171,1,78,77,145,119,250,138,196,123,21,61,70,17,25,51,61,40,126,57,212,168,15,250,20,68,220,176,178,33,235,12,234,20,82,99,166,54,67,193,22,58,5,253,186,79,128,165,213,161,74,216,68,164,44,8,83,157,109,202,138,252,23,186,205,78,46,135,179,97,86,147,159,68,212,223,49,125,243,245,250,80,20,9,62,66,1,170,60,130,198,31,193,148,239,248,232,17,52,255,232,34,138,94,93,95,71,8,44,57,150,124,74,82,174,232,42,53,45,49,241,138,253,0,118,0,139,14,90,123,13,211,184,85,66,233,141,174,105,19,44,89,30,182,141,207,68,175,50,122,198,134,56,193,184,1,72,21,150,1,85,74,204,14,163,187,73,92,13,130,211,33,163,12,182,57,62,42,211,63,146,51,166,23,2,10,250,16,127,222,0,107,1,191,94,71,160,9,209,16,137,150,227,100,114,42,85,86,29,128,227,114,157,166,245,242,168,199,253,228,183,193,60,185,158,62,66,99,184,9,137,255,165,205,15,198,141,91,192,208,136,39,92,182,52,69,187,171,167,151,247,21,90,73,187,124,226,200,71,77,82,99,209,114,145,67,113,60,92,140,89,139,206,78,12,249,251,140,76,119,152,101,195,127,190,232,46,213,97,166,202,180,217,10,229,239,123,83,102,190,175,244,55,218,91,222,129,248,165,33,153,11,143,74,40,123,211,103,94,2,253,77,40,161,183,250,196,163,64,133,142,244,23,173,5,38,105,40,168,199,71,202,28,215,139,39,229,99,234,228,151,66,123,164,133,218,78,189,38,159,57,66,173,39,154,50,91,17,73,57,227,44,83,40,239,114,134,192,52,43,97,69,80,135,174,198,48,9,40,77,47,123,216,208,58,173,208,87,228,115,203,75,80,21,22,110,224,218,183,221,83,122,136,7,91,160,162,122,193,22,87,29,40,123,66,88,97,35,41,16,117,78,24,118,107,225,232,210,50,157,169,61,42,38,49,5,252,141,43,75,173,74,184,217,5,53,127,106,246,186,184,242,201,62,221,230,55,7,97,133,151,236,55,168,1,159,46,248,214,159,28,29,43,254,143,108,69,146,228,74,236,2,183,15,79,172,233,27,252,207,41,249,183,61,30,249,240,234,199,151,248,205,213,166,99,178,210,189,194,102,167,178,105,130,212,30,236,171,177,157,207,110,41,182,235,217,30,197,61,125,138,231,186,152,240,247,137,105,
+199,47,175,191,251,241,197,93,92,188,252,59,23,30,126,63,196,176,96,122,32,132,252,41,39,173,150,220,153,236,159,20,218,123,243,82,189,189,191,78,55,247,250,131,70,115,10,234,189,214,80,239,219,233,230,126,208,80,239,91,5,245,126,208,80,47,45,241,241,152,59,105,91,175,222,191,121,245,154,179,57,32,207,10,151,1,200,89,196,138,155,99,185,58,119,164,74,119,73,219,62,110,23,95,216,54,33,210,168,109,59,34,141,90,54,38,218,166,101,139,34,141,90,54,43,218,166,37,219,146,6,189,7,180,141,94,220,19,5,43,82,238,170,250,67,37,100,177,178,146,168,69,126,37,221,33,127,233,27,30,169,38,8,95,10,13,143,27,223,160,225,191,170,182,59,110,128,195,118,149,21,126,173,167,240,183,170,237,254,160,167,240,183,202,10,255,160,167,112,27,235,164,45,142,135,59,106,191,26,17,207,190,249,241,161,207,190,13,114,49,208,190,33,242,193,208,190,53,114,81,209,190,73,242,225,209,158,93,78,76,18,73,177,42,222,237,73,50,217,88,196,108,74,94,13,207,162,251,17,179,45,91,199,204,67,86,198,215,36,153,180,62,17,186,191,74,246,249,250,246,228,244,155,166,116,119,54,218,150,233,38,14,255,12,223,71,228,123,34,39,58,249,234,171,111,200,255,163,159,63,124,135,123,231,255,25,103,135,184,120,136,30,159,69,143,255,239,255,248,10,183,197,123,226,39,36,211,61,150,234,170,253,185,81,0,149,58,167,98,73,35,167,176,58,221,239,115,88,39,177,77,33,152,196,167,184,61,83,117,52,229,103,206,84,120,213,10,239,174,227,136,6,164,204,101,202,63,156,171,44,89,42,144,172,102,36,93,22,116,181,62,128,19,180,206,86,91,237,56,243,199,102,76,26,73,173,156,146,182,229,183,52,106,129,187,116,187,77,85,197,246,216,184,249,9,156,135,3,88,47,36,54,21,7,156,172,220,252,88,76,20,54,255,87,157,214,199,130,162,184,117,45,229,95,235,42,255,173,78,235,63,232,42,255,173,150,242,63,232,42,95,51,246,104,171,99,156,221,198,80,101,214,118,103,166,45,119,187,179,213,134,193,221,25,108,203,227,238,172,182,97,115,119,166,219,114,186,125,251,213,254,95,67,248,127,224,190,251,36,223,99,169,233,197,17,45,214,75,99,195,34,127,124,83,139,234,110,161,81,2,16,213,106,122,87,111,239,79,177,135,64,187,182,137,100,93,234,50,222,207,85,74,208,110,158,123,7,182,89,23,9,205,15,110,189,156,37,188,180,9,129,83,204,79,128,255,163,192,136,48,181,46,197,66,211,160,147,82,61,244,54,201,117,154,225,115,175,184,85,75,50,15,192,210,240,223,91,242,239,46,101,71,11,68,143,46,20,248,205,139,228,250,43,126,119,181,42,32,132,173,73,50,229,67,150,239,30,56,203,193,226,252,161,92,79,50,238,179,106,74,126,108,91,178,130,204,75,77,153,157,20,116,26,215,187,81,158,223,100,189,42,15,171,43,48,139,43,80,34,41,128,22,96,66,68,54,61,152,77,74,246,94,251,181,174,62,21,241,190,115,28,72,79,69,106,131,99,150,184,161,183,0,12,20,216,137,52,216,149,116,106,54,162,66,167,222,21,148,38,122,112,51,74,82,18,234,26,116,177,95,171,215,197,103,155,77,211,59,50,215,19,245,13,219,48,233,219,160,158,168,111,109,116,17,65,216,134,241,90,214,100,144,26,67,116,40,84,212,55,3,161,240,181,188,79,121,86,221,138,219,87,12,153,130,102,100,166,74,74,53,150,218,153,185,27,104,167,129,120,87,187,26,242,185,26,146,225,153,143,223,176,25,129,31,48,197,134,75,30,3,181,148,173,102,26,56,61,213,186,11,221,41,13,46,155,191,122,109,73,226,25,221,39,105,221,158,124,30,182,45,240,65,181,200,138,149,191,232,186,169,36,250,168,106,50,140,65,19,1,144,169,208,70,192,244,250,250,4,234,61,110,132,226,178,227,178,217,42,234,61,21,72,131,31,221,192,198,170,173,164,250,202,241,238,195,13,168,91,180,74,170,79,73,146,69,143,80,206,35,146,224,129,127,94,62,234,28,1,182,49,181,111,121,106,60,64,141,72,110,88,155,222,229,54,45,63,25,200,195,171,154,122,242,36,17,160,22,123,220,121,166,135,28,157,142,158,156,94,118,79,78,111,146,44,41,234,211,119,88,97,138,152,236,132,28,255,138,26,132,10,138,237,117,146,
+5,182,87,245,188,229,228,116,104,7,221,18,195,231,123,200,239,237,204,39,205,106,75,236,123,54,153,189,147,210,204,189,233,52,191,115,150,205,205,243,203,164,162,165,185,39,117,132,34,159,96,106,18,238,243,148,209,161,76,54,100,117,189,47,82,154,231,218,89,252,72,180,1,235,111,186,39,80,228,102,168,200,205,76,69,6,54,194,214,46,18,51,100,83,251,225,166,23,151,205,79,221,254,97,159,244,14,63,59,98,30,10,154,50,180,203,233,127,193,199,71,237,159,174,99,56,185,228,115,201,236,157,218,254,201,67,18,23,103,196,27,206,160,189,211,158,183,147,32,210,246,79,16,225,234,64,163,220,203,206,113,71,103,102,207,164,181,59,224,99,2,47,217,127,5,245,229,225,24,87,136,109,197,65,77,182,120,161,153,47,108,81,65,16,198,187,127,71,123,47,135,154,244,149,66,125,155,31,138,18,215,41,7,248,233,236,248,136,121,218,25,217,252,100,31,78,163,125,92,196,187,4,83,15,47,190,16,173,114,55,52,244,109,90,6,226,252,49,154,38,252,113,85,185,229,238,9,145,19,53,82,26,25,218,26,170,171,117,5,203,187,248,176,173,148,212,3,9,188,50,209,73,154,9,252,250,116,76,73,13,205,80,104,47,83,102,76,183,250,132,66,85,195,54,123,9,214,151,181,199,73,150,178,2,103,171,183,44,200,142,3,99,53,81,50,45,254,124,194,2,8,219,49,248,141,197,145,218,216,35,169,88,177,233,128,164,23,239,63,208,108,179,191,36,44,88,181,107,232,126,216,230,119,122,100,65,123,208,191,239,100,33,147,53,114,33,224,135,19,110,102,46,19,212,239,17,47,7,51,178,85,132,52,243,236,113,33,87,157,131,15,125,65,116,116,32,46,145,209,57,75,240,95,250,183,146,244,77,89,9,6,174,33,126,250,112,23,70,40,50,219,76,72,194,241,241,17,177,164,31,126,252,64,230,131,100,156,47,154,121,82,173,33,50,72,235,78,131,115,45,66,69,9,205,237,188,194,178,173,26,236,219,146,52,65,173,150,216,206,73,150,103,127,36,69,126,124,68,72,162,153,155,158,255,251,255,245,127,254,199,191,61,126,76,180,249,146,125,232,248,119,189,81,115,193,148,162,87,130,197,120,5,16,253,27,212,251,117,66,191,43,188,247,128,191,38,30,201,81,181,131,164,176,160,135,228,251,182,139,34,149,107,57,186,58,211,169,113,79,105,240,105,85,149,161,168,64,97,248,150,27,17,145,190,84,132,174,182,80,171,175,43,225,69,32,223,150,45,4,10,83,158,173,91,33,85,4,90,19,3,102,106,63,244,86,114,141,226,84,94,163,58,41,55,166,189,64,244,192,70,40,169,19,200,149,59,193,42,137,172,133,254,50,217,147,86,172,89,95,88,253,126,111,216,92,68,175,55,172,146,160,55,157,5,246,72,111,90,177,102,189,97,245,7,189,249,125,123,101,214,163,182,226,72,175,78,200,85,112,215,248,101,154,103,64,235,221,233,220,100,167,59,218,25,118,188,109,99,104,152,173,50,186,214,217,214,20,154,104,251,179,130,157,118,180,48,53,214,182,17,65,184,35,51,120,126,231,41,146,111,201,208,137,29,23,146,232,94,73,127,238,201,7,195,118,30,223,78,24,143,132,211,57,209,154,134,223,153,139,238,248,249,186,158,142,122,186,197,81,185,79,214,233,117,186,238,40,215,93,85,246,33,171,20,116,169,198,193,170,140,144,234,234,114,214,67,73,77,45,53,117,112,155,35,134,245,215,40,56,101,82,125,168,231,94,25,76,224,71,103,173,131,253,149,15,152,41,192,154,161,207,7,9,101,224,156,25,167,102,39,157,53,156,96,254,77,231,114,141,195,87,157,39,137,217,215,116,118,95,221,198,85,180,193,245,6,68,119,96,151,163,230,65,78,156,165,55,64,244,241,79,240,5,62,218,138,36,252,229,207,227,106,176,199,51,71,149,168,249,172,163,196,32,82,117,85,144,177,40,191,193,201,232,20,117,58,62,34,222,66,119,187,200,213,171,56,66,159,0,33,152,230,118,6,135,206,199,42,54,199,22,232,65,214,68,227,19,63,126,222,55,56,201,132,249,147,106,235,162,57,90,59,69,235,183,12,147,229,223,116,90,103,229,135,18,216,15,98,41,237,96,41,34,36,27,168,206,108,167,61,123,237,45,51,160,97,156,157,151,39,100,77,64,183,24,200,194,161,190,52,82,190,235,76,74,137,119,193,73,116,136,175,193,76,
+155,227,253,227,35,48,25,82,5,223,89,85,150,233,106,251,16,101,120,55,117,122,215,221,77,104,54,180,59,58,209,175,38,149,234,111,77,79,104,5,150,122,124,196,118,173,167,213,130,65,235,42,133,95,76,170,132,133,244,96,194,26,83,234,240,167,23,85,123,116,49,178,50,81,57,180,32,186,30,169,158,90,60,228,215,58,203,212,166,66,255,201,210,50,122,195,46,63,221,96,244,64,149,222,128,127,163,243,28,177,7,133,201,90,246,228,159,117,66,106,243,154,215,199,167,61,15,213,83,169,173,49,212,137,60,232,13,191,215,240,48,178,197,194,189,128,147,95,99,57,45,24,176,130,88,36,203,153,37,113,136,117,158,20,62,162,8,61,126,10,230,10,191,157,69,23,23,103,209,127,60,45,15,248,169,243,96,239,102,211,73,147,34,39,81,116,67,37,82,58,185,20,27,73,203,243,132,132,160,12,4,151,71,164,237,71,199,71,2,107,101,150,253,136,56,204,35,177,237,242,243,55,52,96,126,210,52,56,117,105,149,84,58,127,227,103,218,170,38,221,80,181,96,182,196,103,152,245,244,73,179,50,221,244,118,131,216,219,57,96,212,240,73,74,194,208,183,249,118,83,54,207,134,183,187,68,248,244,229,58,41,240,138,134,104,159,227,198,21,14,60,78,241,187,151,49,239,246,248,56,124,193,246,170,136,37,74,163,15,43,125,69,119,54,243,162,107,227,236,215,54,10,177,205,77,50,201,32,115,92,250,124,48,214,162,180,209,225,111,64,249,132,252,193,46,133,26,24,60,221,61,33,155,187,157,29,199,218,208,41,129,179,193,250,229,241,249,227,203,95,187,215,31,225,53,89,5,57,157,75,33,42,229,96,106,248,72,251,46,198,171,145,227,236,161,195,152,68,35,152,75,50,149,134,215,34,113,42,85,249,168,66,241,46,233,102,165,181,150,67,181,60,35,41,121,120,111,121,68,158,144,253,148,150,253,233,7,130,131,155,191,18,104,112,171,70,14,76,39,20,163,204,255,168,129,193,41,39,125,150,95,17,23,84,5,81,169,15,180,4,152,160,46,50,68,80,254,4,30,255,33,133,163,151,114,240,144,229,217,195,174,60,137,183,219,252,19,185,181,161,119,130,196,10,112,71,216,88,50,170,191,167,217,193,248,140,124,140,23,15,193,39,232,49,225,110,52,222,191,52,142,216,91,6,20,216,185,246,44,241,140,85,100,35,51,244,25,174,134,96,87,151,91,242,52,251,229,103,209,161,172,47,5,97,11,31,122,200,137,250,157,148,73,2,67,147,97,217,61,217,32,24,28,194,83,240,235,179,157,174,126,130,209,106,106,8,212,235,95,220,66,91,84,84,239,122,160,30,195,162,61,169,28,160,39,58,9,108,43,73,182,197,45,2,200,30,37,108,0,100,57,28,227,24,114,149,20,48,164,45,218,192,144,75,199,237,169,40,97,228,126,93,9,158,220,241,152,53,80,235,7,142,24,178,28,71,79,99,203,215,117,7,48,207,71,56,1,57,217,240,105,178,252,73,115,41,184,122,157,176,1,86,27,30,171,19,31,71,114,4,94,206,42,146,62,195,207,35,190,144,29,111,143,159,170,115,89,185,108,131,135,250,2,217,227,196,35,153,100,195,9,21,108,116,113,29,155,56,191,183,40,169,205,3,146,203,251,90,87,94,59,155,233,63,26,166,241,20,217,147,65,43,36,200,139,82,54,248,2,79,132,194,79,36,61,228,203,60,233,157,203,141,63,115,214,250,1,22,126,50,216,250,80,171,75,74,247,247,53,212,170,66,217,39,189,115,32,213,170,164,180,108,235,72,65,105,90,254,201,224,208,67,181,1,86,254,137,240,156,65,185,145,182,206,19,241,158,189,122,127,218,74,125,35,224,118,36,134,77,160,10,162,209,159,172,36,24,246,118,253,54,140,99,88,69,48,220,92,21,161,20,201,48,79,85,147,14,239,84,197,22,194,222,3,164,88,241,68,18,159,123,185,101,24,87,216,188,24,86,40,36,189,146,62,39,2,19,243,115,124,62,245,98,152,108,40,187,80,134,200,216,15,174,148,145,222,39,195,158,37,109,110,148,161,7,48,211,23,46,247,19,217,34,105,34,91,111,207,126,195,101,72,70,226,187,101,158,76,157,56,68,26,39,14,194,140,227,254,211,67,145,254,211,67,226,164,229,104,58,105,89,37,183,40,82,204,45,82,124,172,73,210,156,168,54,103,239,147,218,144,199,195,38,178,255,162,177,236,191,33,75,111,6,217,
+124,145,94,54,95,55,187,58,26,73,231,83,58,11,140,244,206,2,59,111,161,16,121,76,69,79,47,155,134,154,55,81,144,148,8,157,147,180,254,145,38,111,78,92,146,69,212,23,168,154,182,198,218,151,216,87,115,6,171,46,64,214,222,174,109,16,95,199,161,222,32,62,119,32,57,215,21,180,87,159,31,203,51,60,123,26,182,118,33,29,50,81,139,147,54,82,235,60,120,127,72,92,129,96,164,200,163,227,163,246,46,195,52,59,185,231,95,22,202,189,105,50,58,62,226,30,12,45,215,41,38,97,93,193,207,87,240,235,21,86,125,34,110,233,122,91,181,45,225,7,121,75,240,107,221,18,215,214,58,47,77,181,130,170,79,196,45,233,106,69,91,226,218,170,98,99,172,170,184,131,21,215,146,174,86,180,165,182,45,115,168,186,72,153,3,213,199,201,220,164,186,22,101,110,80,125,123,50,31,184,238,184,153,15,155,96,212,110,205,135,237,246,137,184,37,253,129,187,237,143,220,173,249,208,221,62,17,183,164,63,120,183,253,209,187,53,31,190,219,39,226,150,244,7,176,171,85,17,227,43,165,77,125,143,213,126,34,109,79,83,189,182,189,182,197,77,114,83,36,137,169,134,172,246,19,105,123,154,26,182,237,181,45,38,247,123,67,237,160,230,19,97,59,154,90,209,118,218,150,96,153,98,168,17,212,124,34,108,71,83,35,218,78,167,165,199,95,153,235,244,248,171,39,146,182,244,245,34,109,113,62,254,123,81,153,70,11,168,250,68,220,146,110,180,160,45,113,241,112,101,172,21,86,125,34,110,73,55,178,174,250,90,37,233,214,84,43,168,250,68,220,146,174,86,180,165,182,173,235,120,101,26,30,176,234,19,113,75,154,90,177,150,184,182,182,121,94,152,170,133,117,159,72,218,210,85,140,182,117,124,84,95,165,114,13,51,105,94,175,179,7,250,34,80,137,110,240,245,143,111,95,148,233,77,22,35,236,162,86,80,9,104,133,188,153,84,162,85,175,149,238,36,242,82,67,29,190,123,235,146,206,36,47,17,180,39,146,54,21,148,19,183,121,189,173,132,154,130,44,104,175,29,214,41,77,177,69,108,121,76,83,144,85,183,73,134,119,74,211,110,155,125,77,247,249,167,25,136,66,237,158,150,92,123,6,104,98,123,98,13,77,145,148,105,104,138,98,163,161,112,185,201,54,40,218,251,197,86,143,185,173,131,179,213,165,96,35,97,149,114,121,215,212,252,249,155,155,216,133,250,207,31,71,127,141,158,95,118,46,47,27,105,252,172,108,223,99,109,36,136,30,203,172,1,176,148,220,254,26,109,211,178,234,74,231,197,221,213,27,110,58,146,64,208,199,169,38,103,116,4,155,159,238,6,19,179,50,30,153,143,136,215,84,147,230,221,32,205,203,186,33,52,6,186,135,194,217,3,75,243,183,104,111,18,17,62,173,142,73,188,227,158,168,176,99,123,253,134,189,88,32,149,180,154,51,98,98,59,20,54,236,207,26,219,61,190,198,88,134,219,126,243,45,114,84,140,63,171,228,100,222,117,246,190,109,88,166,184,113,15,214,217,202,90,205,27,65,145,133,142,52,238,220,74,159,154,210,243,75,161,165,60,237,89,231,83,27,4,45,23,53,57,116,79,117,41,250,165,200,70,158,118,173,241,233,28,146,150,9,80,232,138,38,77,191,20,217,196,211,174,245,61,157,67,212,50,1,122,86,103,64,213,250,182,55,147,172,237,88,160,14,93,107,218,161,41,97,207,180,70,109,202,86,183,201,89,164,109,195,50,141,105,91,215,58,173,16,183,13,11,213,167,110,45,43,157,71,222,179,44,213,144,190,85,173,213,2,129,27,91,236,183,134,4,254,131,112,170,247,109,215,74,191,181,64,223,114,65,83,67,247,173,38,121,139,36,129,160,143,83,77,206,232,8,54,63,221,13,61,226,254,65,52,153,251,182,99,117,223,206,160,109,89,243,90,150,166,79,218,218,246,54,143,178,173,88,157,6,97,235,217,158,33,93,207,179,64,93,178,86,182,195,57,84,109,193,26,77,137,90,211,34,109,208,180,5,171,212,38,105,29,203,156,69,209,115,172,211,140,160,21,45,116,62,61,155,91,169,233,250,250,7,225,132,238,219,222,44,242,91,27,235,235,17,81,147,67,167,187,190,22,201,66,81,31,39,27,157,209,25,34,64,161,43,154,52,45,154,178,125,219,157,29,126,59,103,125,45,21,160,103,117,6,84,173,111,123,51,201,218,142,5,234,208,
+181,166,29,154,18,246,76,107,212,166,108,117,155,156,69,218,54,44,211,152,182,117,173,211,10,113,219,176,80,125,234,214,178,210,121,228,61,203,82,13,233,91,213,90,45,16,184,177,197,62,53,101,112,254,13,74,173,201,60,237,217,233,83,27,12,62,34,106,106,248,158,234,50,184,72,22,138,250,56,217,232,140,206,16,1,10,93,209,99,112,129,164,143,4,181,201,70,205,187,66,5,232,89,157,62,131,27,216,222,60,6,183,100,129,26,12,174,107,135,134,12,62,215,26,117,25,92,195,38,231,48,184,21,203,52,101,112,109,235,180,193,224,86,44,84,155,193,245,172,116,22,131,207,179,84,51,6,87,182,214,249,12,110,110,177,127,50,101,240,55,194,73,223,159,122,118,250,39,27,12,62,34,106,106,248,254,164,203,224,34,89,40,234,227,100,163,51,58,67,4,40,116,69,143,193,223,136,166,117,127,234,218,223,159,230,48,184,84,128,158,213,233,51,184,129,237,205,99,112,75,22,168,193,224,186,118,104,200,224,115,173,81,151,193,53,108,114,14,131,91,177,76,83,6,215,182,78,27,12,110,197,66,181,25,92,207,74,103,49,248,60,75,53,99,112,101,107,157,207,224,250,22,59,120,241,101,247,74,68,5,86,151,188,7,0,171,147,39,166,91,141,94,52,47,156,168,95,122,91,38,85,73,111,208,168,122,55,86,243,194,149,92,8,31,25,31,187,156,81,89,151,238,213,109,195,228,123,250,210,123,238,234,115,248,226,98,155,100,55,213,237,73,196,134,9,190,250,53,18,2,244,254,195,59,204,69,32,197,7,99,69,110,206,38,63,161,34,49,247,94,151,190,188,108,245,128,183,163,168,202,123,254,208,185,144,151,19,199,174,191,98,82,211,44,34,13,139,68,86,249,235,252,83,82,136,101,226,135,126,31,177,244,240,69,40,49,247,94,151,45,22,1,171,236,94,88,216,200,251,121,191,215,144,71,74,143,203,59,96,145,70,222,64,96,145,238,148,165,189,135,210,252,75,6,241,35,190,88,12,192,219,199,107,124,87,80,145,31,200,187,84,134,47,231,169,109,70,75,224,107,44,61,38,144,220,96,214,220,1,62,34,183,208,146,251,78,73,46,187,244,123,204,100,7,82,207,162,242,18,255,152,132,249,242,106,157,103,252,69,166,84,137,245,109,140,215,52,224,251,150,216,69,184,244,78,159,122,192,217,8,224,15,215,105,81,86,236,251,82,105,40,84,148,35,67,98,168,92,119,180,84,116,44,140,116,124,55,87,71,54,178,66,13,213,134,88,221,159,46,241,217,39,77,45,75,11,227,172,238,128,102,26,90,27,108,117,143,157,161,168,206,136,111,247,241,166,167,38,121,59,247,40,144,80,167,111,144,63,21,201,30,229,242,129,5,2,118,203,80,228,99,145,196,235,91,242,37,189,11,152,178,214,69,244,161,56,100,235,250,253,153,117,249,156,246,176,72,111,110,43,188,154,22,62,164,5,171,82,226,165,222,219,184,184,73,240,18,215,56,27,182,41,24,18,131,174,190,19,116,245,217,62,184,158,42,141,106,51,183,152,28,219,142,229,205,25,217,210,69,135,75,213,177,85,234,240,187,65,135,103,140,175,187,254,170,250,173,18,237,65,93,198,40,50,55,30,114,9,131,160,19,80,148,13,189,91,203,151,99,43,209,171,28,11,102,7,97,67,161,231,249,234,214,65,158,180,118,99,27,165,59,68,244,67,131,186,141,8,16,177,100,33,174,1,209,138,29,106,83,41,206,107,132,100,33,152,154,124,174,1,68,109,202,38,3,68,102,34,229,231,30,69,52,236,4,61,199,141,149,132,23,74,52,172,101,0,139,45,91,241,29,79,200,194,168,252,239,180,186,61,225,177,217,23,201,117,122,223,126,113,42,216,245,164,120,252,68,74,118,236,3,62,195,106,39,89,255,38,24,134,113,121,228,14,212,113,73,235,30,173,117,132,245,165,193,144,80,89,189,197,220,225,186,211,187,72,184,171,203,214,198,164,44,183,152,35,159,165,253,27,151,200,147,149,84,86,167,135,125,113,3,60,147,184,88,247,165,173,213,54,38,225,247,247,164,58,39,142,124,38,239,215,136,65,233,21,219,81,138,234,183,128,236,243,50,197,55,112,158,69,231,143,209,0,241,109,35,215,184,3,32,26,106,177,106,60,6,99,74,117,97,152,163,215,32,20,92,205,65,237,157,0,182,119,201,93,130,111,34,41,45,194,39,213,114,2,192,119,98,4,173,168,56,244,
+102,172,92,31,14,17,5,233,187,254,134,87,221,10,66,233,135,56,221,10,247,197,43,248,33,42,127,161,77,93,92,100,191,242,219,155,240,195,87,248,157,48,184,200,212,161,47,188,25,83,164,7,150,190,46,3,101,106,108,251,161,0,35,32,207,60,248,222,206,77,114,175,4,89,211,40,31,33,216,87,17,187,58,23,6,143,189,66,227,23,34,235,140,252,251,37,37,129,95,181,53,37,115,41,170,33,162,120,124,52,173,92,47,130,205,213,239,144,165,235,124,147,60,171,58,148,17,73,80,19,184,196,127,127,119,91,60,171,186,247,199,199,17,107,182,221,152,139,78,232,11,218,137,177,116,94,63,213,120,133,192,232,70,181,227,236,78,170,87,7,173,121,170,9,71,54,173,14,85,210,81,174,44,72,20,57,219,148,228,229,45,103,48,165,35,111,97,146,111,16,55,237,12,135,150,124,205,230,41,249,154,190,38,131,30,236,61,2,57,143,162,213,195,241,209,35,144,244,232,34,138,94,93,95,71,56,127,132,217,205,38,122,26,85,197,1,103,57,41,78,93,142,143,154,31,62,221,166,219,132,213,94,67,167,87,9,141,64,205,171,210,64,51,124,181,72,29,186,94,101,81,94,108,112,218,147,227,13,255,48,227,169,176,12,168,82,162,173,145,123,72,249,26,228,164,241,144,109,211,93,10,226,142,143,202,244,143,228,140,233,133,136,226,27,75,179,237,67,180,33,175,47,5,149,65,19,162,33,198,66,46,104,146,195,211,178,234,28,85,30,199,21,12,206,126,93,112,119,165,19,83,56,217,199,213,55,248,61,248,149,224,93,96,63,125,247,238,37,41,215,162,203,222,226,21,177,99,234,51,246,146,67,250,118,175,100,211,12,124,116,2,177,252,43,124,179,92,214,70,235,206,91,124,72,141,250,109,67,123,246,198,158,206,11,236,80,60,41,197,205,173,146,98,27,125,151,239,160,124,186,130,241,120,151,220,28,96,122,25,189,188,223,99,21,20,92,31,160,147,154,228,212,231,38,78,179,178,61,247,227,149,72,213,180,72,123,106,124,23,151,201,150,252,104,89,31,108,167,25,24,162,147,108,92,234,146,173,82,175,115,152,160,163,196,206,86,253,79,111,223,191,250,31,61,37,192,232,182,241,58,129,17,76,111,210,140,168,81,171,131,63,145,63,174,183,241,13,123,61,0,255,142,37,212,140,85,191,250,84,196,123,158,189,200,183,209,85,188,221,94,49,115,33,54,255,143,47,152,114,255,248,2,125,233,31,95,80,177,248,114,38,248,134,100,41,252,227,11,214,38,54,245,143,47,46,142,143,162,159,32,6,237,240,29,195,240,35,209,5,202,198,235,117,178,39,239,92,198,247,175,17,5,163,71,233,163,179,232,209,14,255,41,225,31,242,78,197,251,71,216,66,20,61,74,30,125,131,179,9,28,170,4,9,5,220,58,217,237,171,135,58,138,129,207,225,10,60,5,55,6,211,6,71,94,225,251,161,238,226,109,202,204,151,54,147,246,154,65,240,169,159,228,251,164,32,201,21,208,49,60,100,62,7,204,147,12,61,228,14,138,64,48,5,69,142,222,214,47,165,59,107,138,13,10,161,152,157,146,152,29,132,148,244,124,155,102,157,186,165,82,221,127,124,177,201,171,115,24,160,127,124,65,170,125,104,223,118,69,77,171,108,108,11,209,29,196,193,127,124,129,111,193,194,120,18,239,83,174,13,44,13,235,189,138,156,51,237,226,7,172,84,7,86,170,224,155,156,190,155,175,41,69,22,139,48,64,103,221,17,172,7,48,138,11,24,10,124,255,94,194,36,51,35,160,205,241,239,42,101,166,179,105,222,59,6,129,137,76,33,27,35,36,250,83,76,168,237,197,91,209,169,53,239,22,252,42,81,228,26,220,162,177,195,92,188,127,224,114,29,125,132,119,127,128,238,234,247,67,222,190,144,165,239,92,228,199,193,156,48,38,191,53,94,94,111,26,226,59,80,235,78,98,239,96,29,126,32,245,146,123,32,240,237,67,247,85,132,191,111,47,81,126,19,122,146,114,45,214,161,46,41,74,173,120,255,247,215,209,54,253,45,105,116,33,14,220,174,250,161,209,120,207,207,33,32,174,229,61,253,59,106,201,222,142,67,160,74,179,148,99,254,87,240,41,5,231,252,35,33,191,146,244,59,248,111,231,21,56,220,107,239,46,44,198,57,254,213,182,219,155,100,85,196,23,136,66,143,88,206,162,6,83,96,152,136,111,12,75,127,253,68,165,17,113,
+221,203,97,93,160,221,43,61,37,160,134,68,15,73,91,210,38,4,234,164,122,186,164,18,77,82,37,53,210,17,76,82,109,80,210,17,84,82,85,88,106,149,184,196,49,214,78,119,138,220,27,122,110,246,46,208,181,222,179,105,132,61,127,246,161,54,137,39,90,173,78,52,118,41,108,141,51,11,51,61,153,185,232,55,62,221,166,88,227,116,150,186,169,84,217,212,68,211,116,28,217,116,46,180,233,40,182,169,33,184,141,33,139,130,21,206,139,215,85,103,183,35,226,50,85,135,61,56,35,51,158,244,38,203,139,4,37,226,44,172,74,201,202,47,106,235,29,247,227,29,149,115,201,111,198,225,23,56,39,136,110,147,120,19,145,55,122,151,221,185,112,154,237,15,21,246,132,236,52,193,138,142,238,117,31,31,145,253,20,82,3,231,124,255,248,2,37,192,132,178,165,173,19,224,181,243,178,122,216,38,167,13,179,145,75,207,243,2,95,122,206,26,226,36,211,85,103,147,85,67,4,48,93,216,86,60,81,230,248,8,180,129,57,203,43,162,25,200,142,163,13,204,253,146,115,108,9,230,44,240,43,76,88,14,149,244,87,202,175,105,6,125,168,197,244,21,161,82,165,125,7,114,164,115,187,219,116,79,223,254,125,65,103,109,76,44,86,1,209,101,94,224,50,56,231,250,67,218,239,144,245,148,37,96,186,241,184,49,104,12,254,215,2,193,169,23,201,143,109,116,89,67,222,191,91,233,169,134,192,127,147,116,240,159,121,154,157,108,57,105,5,247,119,141,100,185,229,196,151,5,247,33,75,183,87,108,62,74,92,61,41,43,92,89,39,228,69,111,209,9,87,146,203,109,111,84,124,253,234,191,94,162,2,173,207,255,103,158,118,114,150,161,82,244,186,157,113,214,142,138,95,191,59,38,95,231,123,52,117,152,223,55,137,239,36,239,189,140,222,191,38,254,252,254,29,219,5,172,235,178,249,42,19,240,242,253,119,199,36,25,61,39,107,104,18,186,34,110,177,134,125,187,56,254,64,86,29,100,111,7,28,7,51,201,97,82,122,147,37,116,7,140,234,7,93,35,193,169,89,144,23,249,167,82,232,75,233,226,192,191,10,21,249,206,106,218,5,246,147,208,187,182,245,199,70,6,225,220,16,30,15,159,131,216,225,59,51,184,103,71,240,227,113,187,237,180,189,32,27,19,251,109,114,127,2,165,232,218,106,77,23,93,241,55,113,246,112,113,113,113,202,254,219,62,180,241,236,205,171,239,223,190,126,81,36,187,120,255,99,93,159,107,151,10,114,210,52,105,55,206,210,107,96,196,65,179,81,219,46,129,9,62,252,58,104,58,65,126,36,111,246,28,98,85,113,146,178,228,83,29,193,161,157,171,203,95,59,237,194,103,174,229,15,251,120,205,63,179,146,92,227,70,79,28,253,152,20,55,73,244,172,44,243,117,74,55,1,63,196,184,31,121,2,85,78,47,162,239,113,90,180,130,170,245,193,63,54,195,182,126,160,240,49,217,166,101,123,222,248,122,216,45,248,11,255,244,26,22,63,161,218,76,41,247,145,204,187,90,21,127,4,4,10,182,42,71,201,80,44,58,1,231,163,243,179,211,122,253,15,179,140,129,64,67,80,68,18,229,82,94,101,235,130,236,43,118,197,157,237,211,100,157,176,183,175,142,136,109,170,119,147,81,112,123,42,173,127,130,160,135,175,137,199,226,170,210,215,252,39,219,10,244,172,113,27,103,55,135,248,38,225,84,67,19,168,119,160,58,187,46,223,253,248,2,127,123,223,59,238,123,201,76,29,45,241,217,235,230,16,168,200,111,138,120,119,193,61,213,70,26,222,81,95,146,55,255,253,33,35,39,114,79,250,10,113,169,31,162,122,48,188,66,157,152,34,160,87,94,208,253,66,98,10,188,98,101,126,40,214,201,137,68,41,116,229,239,211,45,183,227,69,29,142,78,172,161,202,97,77,183,71,91,9,116,213,177,77,90,82,100,47,107,231,97,233,191,105,186,136,211,50,57,217,149,55,108,211,31,79,213,121,61,200,239,220,238,31,126,36,187,214,247,184,243,141,110,191,141,87,9,122,47,172,74,80,110,220,236,223,70,59,104,3,70,25,197,246,164,198,101,153,20,213,201,29,97,4,64,99,39,0,1,134,149,22,123,158,86,242,6,202,219,233,6,222,223,142,52,128,231,186,83,13,188,202,70,26,0,30,155,108,224,53,190,236,88,218,5,48,205,201,46,224,3,127,178,6,160,198,100,3,111,211,77,
+211,64,179,156,172,27,64,63,127,124,182,207,226,93,66,180,193,48,77,254,0,35,164,65,64,214,236,135,2,89,140,203,255,34,223,162,89,84,9,59,18,172,165,193,4,44,190,222,230,159,78,186,135,93,208,20,57,248,126,193,126,110,219,250,192,89,48,132,139,2,215,159,171,109,14,52,2,148,145,220,39,235,3,46,15,233,20,174,110,28,79,79,170,34,223,94,116,200,4,138,252,70,187,73,98,122,191,43,55,113,177,2,59,197,82,173,244,143,49,68,116,32,180,146,157,194,116,142,101,110,18,114,116,64,73,172,72,111,110,18,18,126,88,67,80,118,139,107,26,60,141,62,254,185,108,189,179,209,146,116,131,180,28,163,50,81,18,23,219,7,152,69,110,19,156,100,54,92,117,209,13,222,101,89,143,213,41,175,62,254,192,109,140,195,66,124,207,135,8,148,178,73,75,208,109,67,130,5,42,72,143,150,139,4,22,213,25,221,183,231,148,219,144,204,198,36,91,63,240,226,137,202,204,95,62,53,80,242,103,132,155,132,148,217,12,6,242,57,25,52,60,130,190,131,69,124,188,130,233,100,245,64,242,71,182,184,164,175,113,254,68,15,203,42,4,21,251,132,53,238,120,21,138,228,6,230,239,73,193,135,243,51,76,16,32,127,220,38,219,189,56,150,214,245,234,32,95,107,246,5,30,163,34,16,36,86,98,162,65,155,251,140,164,66,143,96,104,221,8,183,87,113,59,228,154,53,210,61,238,238,17,92,25,239,192,45,248,205,255,195,234,128,51,187,98,199,209,46,62,81,77,94,56,62,92,28,191,127,246,227,79,175,95,178,42,253,195,23,122,180,82,175,41,72,154,4,22,99,82,241,59,60,202,143,202,47,166,21,216,115,239,64,147,43,128,175,21,51,84,226,105,116,178,143,238,1,221,3,206,56,78,79,207,208,105,96,166,240,21,94,123,190,199,127,30,95,124,37,152,34,224,226,109,7,13,20,228,167,218,2,154,111,47,96,178,5,174,82,158,116,15,73,222,254,244,1,207,70,246,88,77,94,167,158,91,71,108,114,45,107,131,11,107,88,19,108,97,151,131,99,182,45,126,33,81,110,157,39,197,26,217,89,75,189,182,150,190,130,127,131,49,70,187,75,9,248,213,3,30,120,213,205,201,181,220,237,242,236,3,16,135,174,158,109,61,212,148,178,7,209,149,113,197,148,182,223,145,22,208,38,207,147,54,109,161,133,85,172,110,115,113,128,158,182,109,53,33,172,209,168,166,63,198,197,111,189,253,131,54,98,17,96,135,18,239,242,45,212,200,181,180,172,235,24,168,248,62,133,197,40,42,199,218,136,200,166,49,35,72,192,85,162,37,73,244,143,179,74,119,236,235,90,6,154,190,56,236,183,41,73,233,174,155,145,184,212,80,46,204,96,113,106,91,104,41,219,84,50,208,245,59,74,225,56,117,222,227,140,134,28,218,23,116,37,203,154,149,251,85,89,253,8,108,178,213,68,182,174,165,239,253,47,217,158,10,35,178,146,61,125,95,239,179,3,190,173,155,201,180,230,166,103,234,74,55,149,244,117,126,209,204,133,10,88,36,38,21,37,224,52,251,39,157,56,73,213,76,226,13,150,212,83,179,174,100,160,38,30,107,16,213,38,163,62,73,228,89,165,217,70,75,183,182,150,193,184,215,11,78,150,67,148,84,220,64,151,23,50,69,255,153,86,90,42,98,121,125,229,126,2,207,137,111,136,183,247,246,95,97,54,252,207,67,89,157,167,217,57,94,116,82,75,138,199,198,189,222,218,210,195,182,174,52,3,218,38,84,113,200,194,204,116,157,72,225,101,171,0,22,65,114,189,152,53,168,172,175,250,15,221,85,8,68,173,169,232,122,147,100,184,47,167,171,106,83,75,95,199,247,201,239,7,146,31,219,52,50,169,36,84,40,30,240,213,235,58,58,54,149,244,85,172,25,0,243,139,72,51,152,8,94,129,1,167,235,146,187,181,136,155,168,54,43,181,58,251,167,105,191,41,116,197,126,19,166,16,145,9,53,143,66,191,63,195,94,52,18,254,254,246,67,93,170,109,251,45,251,134,223,148,105,182,96,101,230,155,102,152,202,167,133,50,171,98,224,101,247,123,154,25,76,178,7,235,165,149,108,98,133,231,0,192,188,149,230,52,128,171,166,175,225,247,164,34,187,21,233,186,62,208,7,122,5,3,78,207,177,233,230,113,180,238,249,63,123,56,13,139,203,231,52,140,236,224,183,91,221,153,13,95,85,191,91,228,
+52,13,235,210,248,134,91,5,121,199,228,234,163,159,158,164,109,187,118,148,156,69,60,123,253,67,183,14,183,112,204,97,66,10,227,12,203,235,91,186,94,249,103,173,70,157,1,64,86,46,49,204,88,30,74,122,52,0,182,138,59,45,176,46,95,255,246,32,13,185,187,120,93,228,39,21,62,245,87,213,96,208,79,13,34,157,77,1,128,132,84,225,221,144,152,96,179,19,192,70,145,54,210,89,244,203,164,247,79,108,44,104,19,247,229,71,135,178,222,77,110,28,186,179,33,49,84,46,47,214,241,78,15,26,82,133,87,134,62,50,69,116,196,217,239,26,202,65,192,198,249,112,189,63,87,43,33,196,135,170,48,11,159,49,149,192,236,83,154,200,222,36,201,176,68,201,136,237,72,55,240,225,150,189,220,136,112,131,189,194,149,157,150,47,114,213,244,253,240,93,82,230,219,59,106,119,52,143,154,180,20,109,240,152,45,173,198,150,239,187,180,202,193,73,244,116,101,117,244,21,133,165,73,122,253,64,215,63,219,152,108,42,194,132,104,155,167,120,200,83,224,249,221,182,54,13,242,72,8,75,11,199,221,136,117,94,72,215,202,237,57,234,112,204,69,219,6,184,93,71,45,175,169,73,28,162,61,16,145,184,129,244,192,214,170,92,97,112,168,200,209,162,214,48,177,58,250,195,244,115,86,192,180,165,78,182,191,232,30,186,202,104,181,204,51,61,66,197,10,46,116,19,200,42,146,205,97,173,231,144,172,138,137,51,98,69,150,100,130,218,145,171,115,162,245,54,78,119,165,92,193,93,188,215,212,15,107,152,168,7,245,246,228,82,52,62,158,209,99,4,246,12,124,99,157,116,151,42,171,70,212,206,171,228,239,48,175,77,53,55,212,186,53,189,134,188,34,33,15,184,105,170,75,235,152,40,74,31,167,91,61,8,206,70,82,22,210,132,19,187,67,121,203,242,228,180,38,117,109,53,131,213,54,84,142,104,237,50,218,228,159,112,21,82,207,194,164,120,230,219,74,207,116,73,5,125,229,94,145,93,29,50,226,111,95,127,248,41,194,243,32,122,92,143,207,30,166,119,236,164,139,159,223,182,207,79,244,79,6,210,138,46,24,185,195,141,65,62,203,25,57,124,168,83,140,240,132,182,147,221,208,166,23,125,120,7,117,191,187,61,240,39,127,223,21,9,57,196,207,26,81,116,30,113,157,98,204,191,41,226,140,28,241,128,0,242,232,79,55,255,43,142,238,210,228,83,39,181,43,75,238,171,41,245,162,17,253,238,171,158,130,63,21,121,19,168,240,231,104,141,191,19,118,106,41,184,195,131,3,128,64,238,45,57,55,142,42,182,105,207,203,92,29,178,87,172,235,29,169,216,52,145,10,5,112,217,147,160,111,224,127,216,35,205,0,15,123,40,151,156,106,18,191,238,233,209,135,98,82,145,55,80,101,164,235,80,66,212,241,14,246,101,149,236,137,140,109,92,86,248,199,233,55,60,229,51,144,175,224,187,39,145,160,38,166,24,144,154,240,199,41,254,51,168,9,223,9,107,226,89,41,169,73,114,122,248,179,210,186,38,124,39,172,137,54,65,106,146,243,65,248,103,80,19,190,19,214,188,222,50,153,240,199,41,254,51,168,9,223,9,107,110,86,91,90,147,28,9,226,145,95,191,38,124,23,113,135,98,155,187,56,91,179,7,189,186,174,18,51,103,33,75,98,193,65,105,155,181,7,12,182,230,12,36,45,193,253,243,218,68,86,227,175,5,120,245,254,255,123,249,238,45,63,193,136,139,7,122,71,8,177,9,108,42,202,239,216,242,157,79,136,135,202,220,74,101,40,84,241,170,235,89,10,76,94,224,222,85,11,108,204,63,22,40,52,64,44,248,123,14,188,97,65,110,169,8,15,11,188,115,220,59,22,40,52,64,44,32,178,249,199,2,133,6,136,5,196,106,255,88,160,208,69,177,224,244,202,210,45,159,234,50,170,202,155,87,175,229,154,100,40,90,5,137,158,68,101,32,140,165,43,152,68,150,87,90,64,188,253,48,174,13,105,78,17,142,129,104,117,68,230,169,49,109,30,208,64,195,247,233,104,208,0,85,132,23,34,61,207,243,109,66,174,162,33,91,145,92,207,123,109,171,190,54,67,77,206,228,144,243,210,249,233,19,252,61,38,145,34,12,122,225,181,16,228,254,20,133,49,238,201,18,246,212,154,92,157,158,243,147,37,252,219,101,207,101,115,36,123,114,117,122,46,189,2,202,65,207,101,51,34,123,114,117,
+122,206,79,132,58,47,98,113,208,115,217,252,199,158,220,233,16,86,166,55,153,162,167,191,127,245,195,155,190,18,88,61,58,57,127,124,246,213,217,227,83,149,238,247,229,41,122,187,185,236,201,193,231,53,234,44,143,60,32,32,93,25,45,134,64,103,81,228,1,1,233,122,104,49,4,58,75,33,15,8,72,87,65,139,33,208,89,0,121,64,64,186,246,89,12,129,206,178,199,3,2,210,21,143,23,4,218,116,141,85,169,200,5,207,158,191,239,43,1,149,85,186,221,147,161,216,107,77,121,147,131,205,105,49,49,203,179,210,83,141,217,157,195,158,78,204,234,172,244,84,99,54,231,176,167,19,179,56,43,61,213,152,189,57,236,41,31,171,241,111,23,61,149,197,231,249,242,116,122,202,199,100,252,219,69,79,101,113,120,190,188,233,224,123,174,186,224,126,249,67,95,112,150,220,168,116,244,220,100,153,173,39,109,114,64,207,85,23,215,243,123,169,179,164,118,213,203,169,133,244,252,94,234,44,159,93,245,114,106,209,60,191,151,58,75,101,87,189,156,8,181,22,122,169,17,104,157,245,114,34,204,90,232,165,70,144,181,213,203,70,137,47,191,84,140,178,175,222,124,247,174,47,186,185,151,66,165,187,93,73,138,209,214,76,234,228,224,182,186,76,68,93,139,189,214,136,190,206,123,61,17,133,45,246,90,35,26,59,239,245,68,84,182,216,107,141,232,236,188,215,19,81,218,98,175,53,162,181,243,94,79,68,109,139,189,214,136,222,150,123,221,50,137,234,84,249,197,203,161,2,155,68,163,219,231,38,83,102,51,169,211,12,173,58,117,182,216,107,141,32,238,188,215,19,65,220,98,175,53,130,184,243,94,79,4,113,139,189,214,8,226,206,123,61,17,196,45,246,90,35,136,59,239,245,68,16,183,216,107,141,32,110,185,215,237,61,133,105,118,178,122,220,38,241,62,254,245,108,117,201,127,60,141,248,79,61,173,126,124,245,102,144,231,208,136,133,166,211,221,97,215,222,35,76,94,14,184,143,211,2,63,144,135,41,75,14,150,73,77,68,72,249,209,170,163,69,125,107,211,226,26,44,134,71,45,127,181,152,157,8,53,240,138,7,175,206,85,150,95,145,228,168,57,126,196,26,153,167,216,89,68,110,66,199,199,49,178,250,134,237,30,118,74,202,234,64,233,93,113,19,111,12,66,201,144,81,53,242,233,32,148,12,6,85,238,238,223,251,57,177,224,217,255,140,232,23,223,107,197,202,41,77,212,193,179,173,149,190,23,251,208,96,49,60,12,252,207,135,6,94,241,224,213,177,192,169,207,254,103,218,221,21,20,155,140,79,138,202,234,64,233,93,113,19,111,12,66,201,144,81,53,242,233,32,148,12,6,85,110,147,181,241,46,178,7,88,251,22,191,245,40,74,227,121,241,34,201,200,11,228,7,250,61,127,28,125,25,61,191,60,35,215,17,199,89,149,96,14,47,89,73,211,155,236,30,216,187,73,81,167,250,21,244,15,123,254,217,128,17,149,84,179,140,38,213,19,174,224,231,233,204,105,121,135,255,49,212,15,212,251,104,87,17,11,160,161,82,246,33,163,218,173,230,90,220,71,28,81,187,138,204,135,140,40,101,11,178,41,215,224,183,204,69,169,104,11,120,171,108,111,221,72,61,215,222,138,15,173,155,233,103,217,91,241,49,250,249,160,121,240,86,115,139,179,236,173,118,236,204,171,183,242,71,61,162,116,202,5,188,85,118,38,100,164,158,107,111,37,47,182,55,210,207,178,183,226,213,21,243,65,243,224,173,230,22,103,217,91,237,216,153,87,111,229,15,235,68,137,178,11,120,171,236,84,207,72,61,215,222,138,87,172,152,233,103,217,91,241,210,151,249,160,121,240,86,115,139,179,236,173,118,236,204,181,183,146,25,128,104,221,186,220,76,120,160,82,248,51,97,162,114,103,221,186,208,76,184,85,36,224,153,48,206,211,87,115,45,206,134,183,246,20,9,127,38,220,113,141,48,214,173,3,149,62,27,111,93,126,221,218,42,242,121,120,235,178,235,214,158,34,159,153,183,134,177,110,29,168,20,254,186,149,57,201,242,235,214,86,145,128,215,173,156,147,44,187,110,237,41,18,254,186,181,227,26,97,172,91,7,42,133,191,110,101,78,178,252,186,181,85,36,224,117,43,231,36,203,174,91,123,138,132,191,110,37,49,69,180,110,93,142,91,7,42,133,207,173,68,229,206,186,117,33,110,109,21,9,152,91,145,249,87,115,45,
+206,134,183,246,20,9,159,91,59,174,193,175,34,2,241,86,217,122,34,72,111,229,214,173,203,122,171,100,221,26,158,183,154,91,156,101,111,181,99,103,94,189,53,140,117,235,64,165,207,198,91,151,95,183,182,138,124,30,222,186,236,186,181,167,200,103,230,173,97,172,91,7,42,133,191,110,101,78,178,252,186,181,85,36,224,117,43,231,36,203,174,91,123,138,132,191,110,37,79,82,135,229,173,3,149,194,247,86,162,114,8,222,218,42,18,176,183,226,171,126,130,240,214,158,34,225,123,43,209,82,180,203,180,156,183,14,84,10,223,91,137,202,157,93,166,133,188,181,85,36,96,111,197,88,178,154,107,113,54,188,181,167,200,103,230,173,252,154,63,16,111,149,173,254,131,244,86,110,151,105,89,111,149,236,50,133,231,173,230,22,103,217,91,237,216,153,87,111,229,215,252,129,120,171,108,245,31,164,183,114,187,76,203,122,171,100,151,41,60,111,53,183,56,203,222,106,199,206,188,122,43,127,241,88,32,222,42,187,161,44,72,111,37,175,229,13,193,91,113,65,246,89,120,171,185,197,89,246,86,59,118,230,213,91,195,216,101,26,168,244,217,120,235,242,187,76,173,34,159,135,183,46,187,203,212,83,36,52,111,229,47,61,55,184,60,226,253,207,207,71,252,225,124,158,187,158,207,190,60,98,90,61,219,182,119,174,117,121,196,152,126,160,222,71,187,138,88,0,13,149,178,15,153,206,229,17,35,218,125,196,17,181,171,200,124,200,136,82,214,201,245,220,232,242,136,37,188,85,227,225,136,229,189,117,252,33,28,143,222,170,254,16,206,194,222,106,110,113,150,189,213,142,157,121,245,214,137,212,146,37,188,85,35,201,100,121,111,29,79,102,242,232,173,234,201,76,11,123,171,185,197,89,246,86,59,118,230,213,91,39,150,17,75,120,171,198,130,98,121,111,29,95,184,122,244,86,245,133,235,194,222,106,110,113,150,189,213,142,157,185,246,86,157,203,35,60,121,171,233,229,17,11,122,171,210,229,17,62,188,85,251,242,136,37,188,85,253,242,8,199,222,106,118,121,68,40,222,26,198,186,213,244,242,136,229,189,117,249,117,171,246,229,17,11,123,235,178,235,86,179,203,35,66,241,214,48,214,173,166,151,71,44,239,173,203,175,91,181,47,143,88,216,91,151,93,183,154,93,30,17,138,183,134,177,110,53,189,60,98,121,111,93,126,221,170,125,121,196,194,222,186,236,186,213,236,242,136,5,189,85,231,242,8,79,222,106,122,121,196,130,222,170,116,121,132,15,111,213,190,60,98,9,111,85,191,60,194,177,183,154,93,30,17,138,183,78,60,202,191,132,183,106,60,212,191,188,183,142,95,30,225,209,91,213,47,143,88,216,91,205,45,206,178,183,218,177,51,175,222,26,198,186,213,244,242,136,229,189,117,249,117,171,246,229,17,11,123,235,178,235,86,179,203,35,66,241,214,48,214,173,166,151,71,44,239,173,203,175,91,181,47,143,88,216,91,151,93,183,154,93,30,177,160,183,234,92,30,225,201,91,77,47,143,88,208,91,149,46,143,240,225,173,218,151,71,44,225,173,234,151,71,56,246,86,179,203,35,22,244,86,157,203,35,60,121,171,233,229,17,11,122,171,210,229,17,62,188,85,251,242,136,37,188,85,253,242,8,199,222,106,118,121,68,40,222,58,241,40,255,18,222,170,241,80,255,242,222,58,126,121,132,71,111,85,191,60,98,97,111,53,183,56,203,222,106,199,206,188,122,235,196,163,252,75,120,171,198,67,253,203,123,235,248,229,17,30,189,85,253,242,136,133,189,213,220,226,44,123,171,29,59,243,234,173,19,143,242,47,225,173,26,15,245,47,239,173,227,151,71,120,244,86,245,203,35,22,246,86,115,139,179,236,173,118,236,204,171,183,134,177,203,100,122,121,196,242,222,186,252,46,147,246,229,17,11,123,235,178,187,76,102,151,71,120,243,214,70,215,63,27,93,30,241,227,207,175,71,252,225,207,243,220,245,207,179,47,143,152,86,207,182,237,253,89,235,242,136,49,253,64,189,143,118,21,177,0,26,42,101,31,50,157,203,35,70,180,251,136,35,106,87,145,249,144,17,165,172,147,235,159,141,46,143,88,194,91,53,30,142,88,222,91,199,31,194,241,232,173,234,15,225,44,236,173,230,22,103,217,91,237,216,153,87,111,157,72,45,89,194,91,53,146,76,150,247,214,241,100,38,143,222,170,158,204,180,176,183,154,91,156,101,111,181,99,
+103,94,189,117,98,25,177,132,183,106,44,40,150,247,214,241,133,171,71,111,85,95,184,46,236,173,230,22,103,217,91,237,216,153,107,111,213,185,60,194,147,183,154,94,30,177,160,183,42,93,30,225,195,91,181,47,143,88,194,91,213,47,143,112,236,173,102,151,71,132,226,173,97,172,91,77,47,143,88,222,91,151,95,183,106,95,30,177,176,183,46,187,110,53,187,60,34,20,111,13,99,221,106,122,121,196,242,222,186,252,186,85,251,242,136,133,189,117,217,117,171,217,229,17,161,120,107,24,235,86,211,203,35,150,247,214,229,215,173,218,151,71,44,236,173,203,174,91,205,46,143,88,208,91,117,46,143,240,228,173,166,151,71,44,232,173,74,151,71,248,240,86,237,203,35,150,240,86,245,203,35,28,123,171,217,229,17,161,120,235,196,163,252,75,120,171,198,67,253,203,123,235,248,229,17,30,189,85,253,242,136,133,189,213,220,226,44,123,171,29,59,243,234,173,97,172,91,77,47,143,88,222,91,151,95,183,106,95,30,177,176,183,46,187,110,53,187,60,34,20,111,13,99,221,106,122,121,196,242,222,186,252,186,85,251,242,136,133,189,117,217,117,171,217,229,17,11,122,171,206,229,17,158,188,213,244,242,136,5,189,85,233,242,8,31,222,170,125,121,196,18,222,170,126,121,132,99,111,53,187,60,98,65,111,213,185,60,194,147,183,154,94,30,177,160,183,42,93,30,225,195,91,181,47,143,88,194,91,213,47,143,112,236,173,102,151,71,132,226,173,19,143,242,47,225,173,26,15,245,47,239,173,227,151,71,120,244,86,245,203,35,22,246,86,115,139,179,236,173,118,236,204,171,183,78,60,202,191,132,183,106,60,212,191,188,183,142,95,30,225,209,91,213,47,143,88,216,91,205,45,206,178,183,218,177,51,175,222,58,241,40,255,18,222,170,241,80,255,242,222,58,126,121,132,71,111,85,191,60,98,97,111,53,183,56,203,222,106,199,206,188,122,107,24,187,76,166,151,71,44,239,173,203,239,50,105,95,30,177,176,183,46,187,203,100,118,121,132,55,111,109,116,253,114,250,242,8,252,187,167,231,179,23,47,202,244,38,139,183,34,119,248,146,120,43,253,61,74,138,34,47,162,60,107,212,226,112,250,82,239,150,8,19,61,36,128,41,40,7,130,174,178,156,148,48,133,72,14,78,51,70,235,248,80,130,86,111,94,189,142,238,226,237,33,209,85,64,29,39,77,132,84,52,252,82,126,99,134,222,88,129,34,31,85,45,70,229,106,12,125,233,150,236,68,15,14,25,16,218,214,97,142,137,22,26,106,54,33,189,18,68,107,84,62,162,113,42,218,132,210,221,31,250,210,237,216,132,38,28,50,32,116,109,98,6,38,90,104,140,233,53,21,232,249,189,42,193,213,44,78,73,70,182,61,101,162,135,67,146,153,134,200,49,201,232,225,228,129,100,184,45,97,189,177,50,38,25,201,222,175,190,116,23,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,225,183,88,5,79,102,58,37,25,217,174,170,137,30,14,73,102,26,34,199,36,163,135,147,7,146,225,78,50,244,198,202,152,100,36,71,22,250,210,93,144,204,36,28,110,72,70,11,19,215,36,99,28,71,140,73,198,74,244,112,69,50,6,49,195,6,201,204,140,20,174,72,134,63,25,16,36,102,59,37,25,217,97,128,137,30,14,73,102,26,34,199,36,163,135,147,7,146,225,14,224,244,198,202,152,100,36,39,109,250,210,93,144,204,36,28,110,72,70,11,19,215,36,99,28,71,140,73,198,74,244,112,69,50,6,49,195,6,201,204,140,20,174,72,134,63,208,194,191,125,146,140,236,12,203,68,15,135,36,51,13,145,99,146,209,195,201,3,201,112,231,198,122,99,101,76,50,146,3,98,125,233,46,72,102,18,14,55,36,163,133,137,107,146,49,142,35,198,36,99,37,122,184,34,25,131,152,97,131,100,102,70,10,87,36,131,73,9,35,9,10,78,73,6,229,41,38,74,44,73,50,211,16,57,38,25,61,156,60,144,12,8,54,27,43,99,146,1,49,243,45,197,21,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,97,145,100,164,87,60,123,56,248,87,186,203,121,249,131,127,77,136,236,147,204,12,156,92,146,204,240,94,107,215,7,255,227,23,88,47,124,
+240,175,10,135,101,146,49,193,196,9,201,72,46,238,118,120,240,175,112,67,247,114,7,255,90,112,216,35,25,99,76,188,145,140,231,236,50,165,43,200,3,35,153,37,178,203,102,224,228,129,100,60,102,151,141,223,187,30,6,201,248,206,46,51,193,196,53,201,120,202,46,83,184,88,62,8,146,241,153,93,102,140,137,55,146,241,156,93,166,116,115,254,242,217,101,154,16,57,38,153,112,178,203,134,111,17,112,157,93,54,254,186,128,133,179,203,84,225,112,67,50,203,103,151,73,94,147,224,48,187,76,225,125,8,203,101,151,105,193,225,132,100,194,201,46,235,4,48,207,217,101,3,217,97,102,151,105,66,228,152,100,194,201,46,99,225,205,99,118,89,43,49,192,236,50,85,56,220,144,204,242,217,101,92,120,243,148,93,214,147,24,86,118,153,22,28,78,72,38,156,236,50,233,203,134,60,100,151,41,189,85,104,249,236,50,77,136,28,147,76,56,217,101,195,55,44,185,206,46,27,127,149,210,194,217,101,170,112,184,33,153,229,179,203,36,175,144,114,152,93,166,240,174,168,229,178,203,180,224,112,66,50,225,100,151,117,2,152,231,236,178,129,236,48,179,203,52,33,114,76,50,225,100,151,177,240,230,49,187,172,149,24,96,118,153,42,28,110,72,102,249,236,50,46,188,121,202,46,235,73,12,43,187,76,11,14,39,36,19,78,118,153,244,69,140,30,206,100,148,222,184,184,252,153,140,38,68,246,73,102,6,78,46,73,102,248,246,73,215,103,50,227,175,153,92,248,76,70,21,14,203,36,99,130,137,19,146,145,188,94,211,225,153,140,194,123,52,151,59,147,209,130,195,30,201,24,99,226,141,100,248,52,8,223,36,35,203,133,8,140,100,166,33,114,76,50,122,56,121,32,25,46,157,202,19,201,72,50,169,194,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,140,231,236,50,165,247,219,6,70,50,75,100,151,205,192,201,3,201,120,204,46,27,127,169,111,24,36,227,59,187,204,4,19,215,36,227,41,187,76,225,173,197,65,144,140,207,236,50,99,76,188,145,140,231,236,178,129,236,48,179,203,52,33,114,76,50,225,100,151,177,240,230,49,187,172,149,24,96,118,153,42,28,110,72,102,249,236,50,46,188,121,202,46,235,73,12,43,187,76,11,14,39,36,19,78,118,89,39,128,121,206,46,27,200,14,51,187,76,19,34,199,36,19,78,118,25,11,111,30,179,203,90,137,1,102,151,169,194,225,134,100,150,207,46,227,194,155,167,236,178,158,196,176,178,203,180,224,112,66,50,225,100,151,117,2,152,231,236,178,129,236,48,179,203,52,33,114,76,50,225,100,151,177,240,230,49,187,172,149,24,96,118,153,42,28,110,72,102,249,236,50,46,188,121,202,46,235,73,12,43,187,76,11,14,39,36,19,78,118,25,89,83,137,82,167,60,108,151,13,100,135,185,93,166,9,145,125,146,153,129,147,75,146,33,106,117,210,169,92,111,151,181,18,3,220,46,83,133,195,50,201,152,96,226,132,100,112,195,110,53,51,142,232,145,76,79,98,88,219,101,90,112,216,35,25,99,76,188,145,12,159,6,225,155,100,100,185,16,129,145,204,52,68,142,73,70,15,39,15,36,195,165,83,121,34,25,73,38,85,24,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,225,211,32,124,147,140,44,23,34,48,146,153,134,200,49,201,232,225,228,129,100,184,116,42,79,36,35,201,164,10,131,100,38,225,112,67,50,90,152,184,38,25,227,56,98,76,50,86,162,135,43,146,49,136,25,54,72,102,102,164,112,69,50,158,179,203,6,178,63,3,146,89,34,187,108,6,78,30,72,198,99,118,89,43,49,92,146,241,157,93,102,130,137,107,146,241,148,93,214,147,24,44,201,248,204,46,51,198,196,27,201,120,206,46,27,200,14,51,187,76,19,34,199,36,19,78,118,25,11,111,30,179,203,90,137,1,102,151,169,194,225,134,100,150,207,46,227,194,155,167,236,178,158,196,176,178,203,180,224,112,66,50,225,100,151,117,2,152,231,236,178,129,236,48,179,203,52,33,114,76,50,225,100,151,177,240,230,49,187,172,149,24,96,118,153,42,28,110,72,102,249,236,50,46,188,121,202,46,235,73,12,43,187,76,11,14,39,36,19,78,
+118,25,161,59,81,234,148,135,149,204,64,118,152,43,25,77,136,236,147,204,12,156,92,146,12,81,171,147,78,229,122,37,211,74,12,112,37,163,10,135,101,146,49,193,196,9,201,224,90,106,53,51,142,232,145,76,79,98,88,43,25,45,56,236,145,140,49,38,222,72,134,79,131,240,77,50,178,92,136,192,72,102,26,34,199,36,163,135,147,7,146,225,210,169,60,145,140,36,147,42,12,146,153,132,195,13,201,104,97,226,154,100,140,227,136,49,201,88,137,30,174,72,198,32,102,216,32,153,153,145,194,21,201,240,105,16,190,73,70,150,11,17,24,201,76,67,228,152,100,244,112,242,64,50,92,58,149,39,146,145,100,82,133,65,50,147,112,184,33,25,45,76,92,147,140,113,28,49,38,25,43,209,195,21,201,24,196,12,27,36,51,51,82,184,34,25,62,13,194,55,201,200,114,33,2,35,153,105,136,28,147,140,30,78,30,72,134,75,167,242,68,50,146,76,170,48,72,102,18,14,55,36,163,133,137,107,146,49,142,35,198,36,99,37,122,184,34,25,131,152,97,131,100,102,70,10,87,36,227,57,187,108,32,251,51,32,153,37,178,203,102,224,228,129,100,60,102,151,181,18,195,37,25,223,217,101,38,152,184,38,25,79,217,101,61,137,193,146,140,207,236,50,99,76,188,145,140,231,236,178,129,236,48,179,203,52,33,114,76,50,225,100,151,177,240,230,49,187,172,149,24,96,118,153,42,28,110,72,102,249,236,50,46,188,121,202,46,235,73,12,43,187,76,11,14,39,36,19,78,118,25,209,68,148,58,229,129,100,6,178,195,36,25,77,136,236,147,204,12,156,92,146,12,81,171,147,78,229,154,100,90,137,1,146,140,42,28,150,73,198,4,19,39,36,131,52,183,154,25,71,244,72,166,39,49,44,146,209,130,195,30,201,24,99,226,141,100,248,52,8,223,36,35,203,133,8,140,100,166,33,114,76,50,122,56,121,32,25,46,157,202,19,201,72,50,169,194,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,12,159,6,225,155,100,100,185,16,129,145,204,52,68,142,73,70,15,39,15,36,195,165,83,121,34,25,73,38,85,24,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,225,211,32,124,147,140,44,23,34,48,146,153,134,200,49,201,232,225,228,129,100,184,116,42,79,36,35,201,164,10,131,100,38,225,112,67,50,90,152,184,38,25,227,56,98,76,50,86,162,135,43,146,49,136,25,54,72,102,102,164,112,69,50,124,26,132,111,146,145,229,66,4,70,50,211,16,57,38,25,61,156,60,144,12,151,78,229,137,100,36,153,84,97,144,204,36,28,110,72,70,11,19,215,36,99,28,71,140,73,198,74,244,112,69,50,6,49,195,6,201,204,140,20,174,72,198,115,118,217,64,246,103,64,50,75,100,151,205,192,201,3,201,120,204,46,107,37,134,75,50,190,179,203,76,48,113,77,50,158,178,203,122,18,131,37,25,159,217,101,198,152,216,35,153,70,179,243,38,130,145,28,4,81,238,20,254,221,211,229,253,207,207,229,209,253,92,149,101,70,100,139,48,49,209,195,220,82,202,195,106,16,228,53,33,146,131,163,98,51,74,10,168,227,164,137,144,138,134,231,39,124,250,74,39,159,74,111,172,64,145,143,170,22,211,151,56,223,82,80,186,37,59,209,131,67,6,132,182,117,152,99,162,133,134,154,77,80,13,86,51,227,200,71,52,78,69,155,24,72,156,109,19,68,186,29,155,208,132,67,6,132,174,77,204,192,68,11,13,165,165,140,36,208,243,121,16,248,183,79,146,145,37,67,152,232,225,144,100,166,33,114,76,50,122,56,121,32,25,46,159,74,111,172,140,73,70,146,74,165,47,221,5,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,248,60,8,252,219,39,201,200,146,33,76,244,112,72,50,211,16,57,38,25,61,156,60,144,12,151,79,165,55,86,198,36,35,73,165,210,151,238,130,100,38,225,112,67,50,90,152,184,38,25,227,56,98,76,50,86,162,135,43,146,49,136,25,54,72,102,102,164,112,69,50,19,239,112,115,74,50,26,47,114,91,146,100,166,33,114,76,50,122,56,121,32,153,241,119,65,186,32,
+25,245,215,64,46,64,50,147,112,184,33,25,45,76,92,147,140,113,28,49,38,25,43,209,195,21,201,24,196,12,27,36,51,51,82,184,34,153,137,91,118,156,146,140,198,85,59,75,146,204,52,68,142,73,70,15,39,15,36,51,126,91,151,11,146,81,191,168,107,1,146,153,132,195,13,201,104,97,226,154,100,140,227,136,49,201,88,137,30,174,72,198,32,102,216,32,153,153,145,194,21,201,76,228,65,56,37,25,141,100,136,37,73,102,26,34,199,36,163,135,147,7,146,25,207,167,114,65,50,234,169,84,11,144,204,36,28,110,72,70,11,19,215,36,99,28,71,140,73,198,74,244,112,69,50,6,49,195,6,201,204,140,20,22,73,134,156,14,137,82,167,60,28,252,15,100,135,121,240,175,9,145,125,146,153,129,147,75,146,33,106,117,210,169,92,31,252,183,18,3,60,248,87,133,195,50,201,152,96,226,132,100,48,245,96,53,51,142,232,145,76,79,98,88,7,255,90,112,216,35,25,99,76,188,145,140,231,236,178,129,236,207,128,100,150,200,46,155,129,147,7,146,241,152,93,214,74,12,151,100,124,103,151,153,96,226,154,100,60,101,151,245,36,6,75,50,62,179,203,140,49,241,70,50,158,179,203,6,178,195,204,46,211,132,200,49,201,132,147,93,198,194,155,199,236,178,86,98,128,217,101,170,112,184,33,153,229,179,203,184,240,230,41,187,172,39,49,172,236,50,45,56,156,144,76,56,217,101,157,0,230,57,187,108,32,59,204,236,50,77,136,28,147,76,56,217,101,44,188,121,204,46,107,37,6,152,93,166,10,135,27,146,89,62,187,140,11,111,158,178,203,122,18,195,202,46,211,130,195,9,201,132,147,93,214,9,96,158,179,203,6,178,195,204,46,211,132,200,49,201,132,147,93,198,194,155,199,236,178,86,98,128,217,101,170,112,184,33,153,229,179,203,184,240,230,41,187,172,39,49,172,236,50,45,56,156,144,76,56,217,101,157,0,230,57,187,108,32,59,204,236,50,77,136,28,147,76,56,217,101,44,188,121,204,46,107,37,6,152,93,166,10,135,27,146,89,62,187,140,11,111,158,178,203,122,18,195,202,46,211,130,195,9,201,132,147,93,70,54,238,68,169,83,30,206,100,6,178,195,60,147,209,132,200,62,201,204,192,201,37,201,16,181,58,233,84,174,207,100,90,137,1,158,201,168,194,97,153,100,76,48,113,66,50,120,42,180,154,25,71,244,72,166,39,49,172,51,25,45,56,236,145,140,49,38,222,72,134,79,131,240,77,50,178,92,136,192,72,102,26,34,199,36,163,135,147,7,146,225,210,169,60,145,140,36,147,42,12,146,153,132,195,13,201,104,97,226,154,100,140,227,136,49,201,88,137,30,174,72,198,32,102,216,32,153,153,145,194,21,201,120,206,46,27,200,254,12,72,102,137,236,178,25,56,121,32,25,143,217,101,173,196,112,73,198,119,118,153,9,38,174,73,198,83,118,89,79,98,176,36,227,51,187,204,24,19,111,36,227,57,187,108,32,59,204,236,50,77,136,28,147,76,56,217,101,44,188,121,204,46,107,37,6,152,93,166,10,135,27,146,89,62,187,140,11,111,158,178,203,122,18,195,202,46,211,130,195,9,201,132,147,93,214,9,96,158,179,203,6,178,195,204,46,211,132,200,49,201,132,147,93,198,194,155,199,236,178,86,98,128,217,101,170,112,184,33,153,229,179,203,184,240,230,41,187,172,39,49,172,236,50,45,56,156,144,76,56,217,101,157,0,230,57,187,108,32,59,204,236,50,77,136,28,147,76,56,217,101,44,188,121,204,46,107,37,6,152,93,166,10,135,27,146,89,62,187,140,11,111,158,178,203,122,18,195,202,46,211,130,195,9,201,132,147,93,70,214,84,162,212,41,15,219,101,3,217,97,110,151,105,66,100,159,100,102,224,228,146,100,136,90,157,116,42,215,219,101,173,196,0,183,203,84,225,176,76,50,38,152,56,33,25,220,176,91,205,140,35,122,36,211,147,24,214,118,153,22,28,246,72,198,24,19,111,36,195,167,65,248,38,25,89,46,68,96,36,51,13,145,99,146,209,195,201,3,201,112,233,84,158,72,70,146,73,21,6,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,248,52,8,223,36,35,203,133,8,140,100,166,33,114,76,50,122,56,121,32,25,46,157,202,19,201,72,50,169,194,32,153,73,56,220,144,
+140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,140,231,236,178,129,236,207,128,100,150,200,46,155,129,147,7,146,241,152,93,214,74,12,151,100,124,103,151,153,96,226,154,100,60,101,151,245,36,6,75,50,62,179,203,140,49,241,70,50,158,179,203,6,178,195,204,46,211,132,200,49,201,132,147,93,198,194,155,199,236,178,86,98,128,217,101,170,112,184,33,153,229,179,203,184,240,230,41,187,172,39,49,172,236,50,45,56,156,144,76,56,217,101,157,0,230,57,187,108,32,59,204,236,50,77,136,28,147,76,56,217,101,44,188,121,204,46,107,37,6,152,93,166,10,135,27,146,89,62,187,140,11,111,158,178,203,122,18,195,202,46,211,130,195,9,201,132,147,93,70,232,78,148,58,229,97,37,51,144,29,230,74,70,19,34,251,36,51,3,39,151,36,67,212,234,164,83,185,94,201,180,18,3,92,201,168,194,97,153,100,76,48,113,66,50,184,150,90,205,140,35,122,36,211,147,24,214,74,70,11,14,123,36,99,140,137,55,146,225,211,32,124,147,140,44,23,34,48,146,153,134,200,49,201,232,225,228,129,100,184,116,42,79,36,35,201,164,10,131,100,38,225,112,67,50,90,152,184,38,25,227,56,98,76,50,86,162,135,43,146,49,136,25,54,72,102,102,164,112,69,50,124,26,132,111,146,145,229,66,4,70,50,211,16,57,38,25,61,156,60,144,12,151,78,229,137,100,36,153,84,97,144,204,36,28,110,72,70,11,19,215,36,99,28,71,140,73,198,74,244,112,69,50,6,49,195,6,201,204,140,20,174,72,134,79,131,240,77,50,178,92,136,192,72,102,26,34,199,36,163,135,147,7,146,225,210,169,60,145,140,36,147,42,12,146,153,132,195,13,201,104,97,226,154,100,140,227,136,49,201,88,137,30,174,72,198,32,102,216,32,153,153,145,194,21,201,120,206,46,27,200,254,12,72,102,137,236,178,25,56,121,32,25,143,217,101,173,196,112,73,198,119,118,153,9,38,174,73,198,83,118,89,79,98,176,36,227,51,187,204,24,19,111,36,227,57,187,108,32,59,204,236,50,77,136,28,147,76,56,217,101,44,188,121,204,46,107,37,6,152,93,166,10,135,27,146,89,62,187,140,11,111,158,178,203,122,18,195,202,46,211,130,195,9,201,132,147,93,70,52,17,165,78,121,32,153,129,236,48,73,70,19,34,251,36,51,3,39,151,36,67,212,234,164,83,185,38,153,86,98,128,36,163,10,135,101,146,49,193,196,9,201,32,205,173,102,198,17,61,146,233,73,12,139,100,180,224,176,71,50,198,152,120,35,25,62,13,194,55,201,200,114,33,2,35,153,105,136,28,147,140,30,78,30,72,134,75,167,242,68,50,146,76,170,48,72,102,18,14,55,36,163,133,137,107,146,49,142,35,198,36,99,37,122,184,34,25,131,152,97,131,100,102,70,10,87,36,195,167,65,248,38,25,89,46,68,96,36,51,13,145,99,146,209,195,201,3,201,112,233,84,158,72,70,146,73,21,6,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,248,52,8,223,36,35,203,133,8,140,100,166,33,114,76,50,122,56,121,32,25,46,157,202,19,201,72,50,169,194,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,12,159,6,225,155,100,100,185,16,129,145,204,52,68,142,73,70,15,39,15,36,195,165,83,121,34,25,73,38,85,24,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,241,156,93,54,144,253,25,144,204,18,217,101,51,112,242,64,50,30,179,203,90,137,225,146,140,239,236,50,19,76,92,147,140,167,236,178,158,196,96,73,198,103,118,153,49,38,246,72,166,209,236,207,77,4,35,57,8,162,220,41,252,187,167,203,143,63,191,150,71,247,63,171,178,204,136,108,17,38,38,122,152,91,202,238,176,29,4,121,77,136,228,224,168,216,140,146,2,234,56,105,34,164,162,225,159,79,248,244,149,78,62,149,222,88,129,34,31,85,45,166,47,113,190,165,160,116,75,118,162,7,135,12,8,109,235,48,199,68,11,13,53,155,160,26,172,102,198,145,143,104,156,138,54,49,144,56,219,38,136,116,59,54,161,
+9,135,12,8,93,155,152,129,137,22,26,74,75,25,73,160,231,243,32,240,111,159,36,35,75,134,48,209,195,33,201,76,67,228,152,100,244,112,242,64,50,92,62,149,222,88,25,147,140,36,149,74,95,186,11,146,153,132,195,13,201,104,97,226,154,100,140,227,136,49,201,88,137,30,174,72,198,32,102,216,32,153,153,145,194,21,201,240,121,16,248,183,79,146,145,37,67,152,232,225,144,100,166,33,114,76,50,122,56,121,32,25,46,159,74,111,172,140,73,70,146,74,165,47,221,5,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,38,222,225,230,148,100,52,94,228,182,36,201,76,67,228,152,100,244,112,242,64,50,227,239,130,116,65,50,234,175,129,92,128,100,38,225,112,67,50,90,152,184,38,25,227,56,98,76,50,86,162,135,43,146,49,136,25,54,72,102,102,164,112,69,50,19,183,236,56,37,25,141,171,118,150,36,153,105,136,28,147,140,30,78,30,72,102,252,182,46,23,36,163,126,81,215,2,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,153,200,131,112,74,50,26,201,16,75,146,204,52,68,142,73,70,15,39,15,36,51,158,79,229,130,100,212,83,169,22,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,44,146,12,57,29,18,165,78,121,56,248,31,200,14,243,224,95,19,34,251,36,51,3,39,151,36,67,212,234,164,83,185,62,248,111,37,6,120,240,175,10,135,101,146,49,193,196,9,201,96,234,193,106,102,28,209,35,153,158,196,176,14,254,181,224,176,71,50,198,152,120,35,25,207,217,101,3,217,159,1,201,44,145,93,54,3,39,15,36,227,49,187,172,149,24,46,201,248,206,46,51,193,196,53,201,120,202,46,235,73,12,150,100,124,102,151,25,99,226,141,100,60,103,151,13,100,135,153,93,166,9,145,99,146,9,39,187,140,133,55,143,217,101,173,196,0,179,203,84,225,112,67,50,203,103,151,113,225,205,83,118,89,79,98,88,217,101,90,112,56,33,153,112,178,203,58,1,204,115,118,217,64,118,152,217,101,154,16,57,38,153,112,178,203,88,120,243,152,93,214,74,12,48,187,76,21,14,55,36,179,124,118,25,23,222,60,101,151,245,36,134,149,93,166,5,135,19,146,9,39,187,172,19,192,60,103,151,13,100,135,153,93,166,9,145,99,146,9,39,187,140,133,55,143,217,101,173,196,0,179,203,84,225,112,67,50,203,103,151,113,225,205,83,118,89,79,98,88,217,101,90,112,56,33,153,112,178,203,58,1,204,115,118,217,64,118,152,217,101,154,16,57,38,153,112,178,203,88,120,243,152,93,214,74,12,48,187,76,21,14,55,36,179,124,118,25,23,222,60,101,151,245,36,134,149,93,166,5,135,19,146,9,39,187,140,108,220,137,82,167,60,156,201,12,100,135,121,38,163,9,145,125,146,153,129,147,75,146,33,106,117,210,169,92,159,201,180,18,3,60,147,81,133,195,50,201,152,96,226,132,100,240,84,104,53,51,142,232,145,76,79,98,88,103,50,90,112,216,35,25,99,76,188,145,12,159,6,225,155,100,100,185,16,129,145,204,52,68,142,73,70,15,39,15,36,195,165,83,121,34,25,73,38,85,24,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,241,156,93,54,144,253,25,144,204,18,217,101,51,112,242,64,50,30,179,203,90,137,225,146,140,239,236,50,19,76,92,147,140,167,236,178,158,196,96,73,198,103,118,153,49,38,222,72,198,115,118,217,64,118,152,217,101,154,16,57,38,153,112,178,203,88,120,243,152,93,214,74,12,48,187,76,21,14,55,36,179,124,118,25,23,222,60,101,151,245,36,134,149,93,166,5,135,19,146,9,39,187,172,19,192,60,103,151,13,100,135,153,93,166,9,145,99,146,9,39,187,140,133,55,143,217,101,173,196,0,179,203,84,225,112,67,50,203,103,151,113,225,205,83,118,89,79,98,88,217,101,90,112,56,33,153,112,178,203,58,1,204,115,118,217,64,118,152,217,101,154,16,57,38,153,112,178,203,88,120,243,152,93,214,74,12,48,187,76,21,14,55,36,179,124,118,25,23,222,
+60,101,151,245,36,134,149,93,166,5,135,19,146,9,39,187,140,172,169,68,169,83,30,182,203,6,178,195,220,46,211,132,200,62,201,204,192,201,37,201,16,181,58,233,84,174,183,203,90,137,1,110,151,169,194,97,153,100,76,48,113,66,50,184,97,183,154,25,71,244,72,166,39,49,172,237,50,45,56,236,145,140,49,38,222,72,134,79,131,240,77,50,178,92,136,192,72,102,26,34,199,36,163,135,147,7,146,225,210,169,60,145,140,36,147,42,12,146,153,132,195,13,201,104,97,226,154,100,140,227,136,49,201,88,137,30,174,72,198,32,102,216,32,153,153,145,194,21,201,240,105,16,190,73,70,150,11,17,24,201,76,67,228,152,100,244,112,242,64,50,92,58,149,39,146,145,100,82,133,65,50,147,112,184,33,25,45,76,92,147,140,113,28,49,38,25,43,209,195,21,201,24,196,12,27,36,51,51,82,184,34,25,207,217,101,3,217,159,1,201,44,145,93,54,3,39,15,36,227,49,187,172,149,24,46,201,248,206,46,51,193,196,53,201,120,202,46,235,73,12,150,100,124,102,151,25,99,226,141,100,60,103,151,13,100,135,153,93,166,9,145,99,146,9,39,187,140,133,55,143,217,101,173,196,0,179,203,84,225,112,67,50,203,103,151,113,225,205,83,118,89,79,98,88,217,101,90,112,56,33,153,112,178,203,58,1,204,115,118,217,64,118,152,217,101,154,16,57,38,153,112,178,203,88,120,243,152,93,214,74,12,48,187,76,21,14,55,36,179,124,118,25,23,222,60,101,151,245,36,134,149,93,166,5,135,19,146,9,39,187,140,208,157,40,117,202,195,74,102,32,59,204,149,140,38,68,246,73,102,6,78,46,73,134,168,213,73,167,114,189,146,105,37,6,184,146,81,133,195,50,201,152,96,226,132,100,112,45,181,154,25,71,244,72,166,39,49,172,149,140,22,28,246,72,198,24,19,111,36,195,167,65,248,38,25,89,46,68,96,36,51,13,145,99,146,209,195,201,3,201,112,233,84,158,72,70,146,73,21,6,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,248,52,8,223,36,35,203,133,8,140,100,166,33,114,76,50,122,56,121,32,25,46,157,202,19,201,72,50,169,194,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,12,159,6,225,155,100,100,185,16,129,145,204,52,68,142,73,70,15,39,15,36,195,165,83,121,34,25,73,38,85,24,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,241,156,93,54,144,253,25,144,204,18,217,101,51,112,242,64,50,30,179,203,90,137,225,146,140,239,236,50,19,76,92,147,140,167,236,178,158,196,96,73,198,103,118,153,49,38,222,72,198,115,118,217,64,118,152,217,101,154,16,57,38,153,112,178,203,88,120,243,152,93,214,74,12,48,187,76,21,14,55,36,179,124,118,25,23,222,60,101,151,245,36,134,149,93,166,5,135,19,146,9,39,187,140,104,34,74,157,242,64,50,3,217,97,146,140,38,68,246,73,102,6,78,46,73,134,168,213,73,167,114,77,50,173,196,0,73,70,21,14,203,36,99,130,137,19,146,65,154,91,205,140,35,122,36,211,147,24,22,201,104,193,97,143,100,140,49,241,70,50,124,26,132,111,146,145,229,66,4,70,50,211,16,57,38,25,61,156,60,144,12,151,78,229,137,100,36,153,84,97,144,204,36,28,110,72,70,11,19,215,36,99,28,71,140,73,198,74,244,112,69,50,6,49,195,6,201,204,140,20,174,72,134,79,131,240,77,50,178,92,136,192,72,102,26,34,199,36,163,135,147,7,146,225,210,169,60,145,140,36,147,42,12,146,153,132,195,13,201,104,97,226,154,100,140,227,136,49,201,88,137,30,174,72,198,32,102,216,32,153,153,145,194,21,201,240,105,16,190,73,70,150,11,17,24,201,76,67,228,152,100,244,112,242,64,50,92,58,149,39,146,145,100,82,133,65,50,147,112,184,33,25,45,76,92,147,140,113,28,49,38,25,43,209,195,21,201,24,196,12,27,36,51,51,82,184,34,25,62,13,194,55,201,200,114,33,2,35,153,105,136,28,147,140,30,78,30,72,134,75,167,242,68,50,146,76,170,48,72,102,18,14,55,36,163,133,137,107,
+146,49,142,35,198,36,99,37,122,184,34,25,131,152,97,131,100,102,70,10,87,36,227,57,187,108,32,251,51,32,153,37,178,203,102,224,228,129,100,60,102,151,181,18,195,37,25,223,217,101,38,152,184,38,25,79,217,101,61,137,193,146,140,207,236,50,99,76,236,145,76,163,217,151,77,4,43,171,130,59,85,134,15,181,46,248,119,79,151,103,47,94,12,116,89,231,217,26,196,103,113,149,34,246,215,24,198,64,39,8,100,28,16,35,226,68,48,204,22,45,196,166,171,15,167,193,29,254,103,182,108,34,250,227,184,16,171,157,165,2,167,187,74,37,175,236,141,240,71,138,242,184,16,155,93,101,2,101,93,109,212,248,75,99,102,36,179,70,148,17,136,127,247,84,120,241,234,163,124,206,242,23,213,185,211,136,108,17,20,38,122,152,199,191,77,122,55,152,186,104,66,36,7,71,37,18,42,41,160,142,147,38,66,42,26,254,229,132,79,202,234,100,9,234,141,21,40,242,81,213,98,250,18,231,91,10,74,183,100,39,122,112,200,128,208,182,14,115,76,180,208,80,179,9,170,193,106,102,28,249,136,198,169,104,19,3,137,179,109,130,72,183,99,19,154,112,200,128,208,181,137,25,152,104,161,161,180,64,151,4,122,62,187,199,55,201,200,82,124,2,35,153,105,136,28,147,140,30,78,30,72,134,203,18,244,68,50,146,4,193,48,72,102,18,14,55,36,163,133,137,107,146,49,142,35,198,36,99,37,122,184,34,25,131,152,97,131,100,102,70,10,87,36,195,103,247,248,38,25,89,138,79,96,36,51,13,145,99,146,209,195,201,3,201,112,89,130,158,72,70,146,32,24,6,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,248,236,30,223,36,35,75,241,9,140,100,166,33,114,76,50,122,56,121,32,25,46,75,208,19,201,72,18,4,195,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,204,196,221,81,78,73,70,227,2,169,37,73,102,26,34,199,36,163,135,147,7,146,25,191,131,206,5,201,168,95,63,183,0,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,38,178,123,156,146,140,70,138,207,146,36,51,13,145,99,146,209,195,201,3,201,140,103,9,186,32,25,245,4,193,5,72,102,18,14,55,36,163,133,137,107,146,49,142,35,198,36,99,37,122,184,34,25,131,152,97,131,100,102,70,10,139,36,67,78,135,68,169,83,248,131,99,146,25,200,22,38,218,221,46,189,146,209,132,200,62,201,204,192,201,37,201,16,181,58,233,84,122,99,165,79,50,173,196,249,150,98,157,100,84,225,176,76,50,38,152,56,33,25,76,61,88,205,140,35,122,36,211,147,56,219,38,172,146,140,22,28,246,72,198,24,19,111,36,195,167,65,248,38,25,89,46,68,96,36,51,13,145,99,146,209,195,201,3,201,112,233,84,158,72,70,146,73,21,6,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,248,52,8,223,36,35,203,133,8,140,100,166,33,114,76,50,122,56,121,32,25,46,157,202,19,201,72,50,169,194,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,12,159,6,225,155,100,100,185,16,129,145,204,52,68,142,73,70,15,39,15,36,195,165,83,121,34,25,73,38,85,24,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,241,156,93,54,144,29,102,118,153,38,68,142,73,38,156,236,50,22,222,60,102,151,181,18,3,204,46,83,133,195,13,201,44,159,93,198,133,55,79,217,101,61,137,97,101,151,105,193,225,132,100,194,201,46,235,4,48,207,217,101,3,217,97,102,151,105,66,228,152,100,194,201,46,99,225,205,99,118,89,43,49,192,236,50,85,56,220,144,204,242,217,101,92,120,243,148,93,214,147,24,86,118,153,22,28,78,72,38,156,236,50,178,113,39,74,157,194,31,28,147,204,64,182,8,18,19,61,236,146,140,38,68,246,73,102,6,78,46,73,134,168,213,73,167,210,27,43,125,146,
+105,37,206,183,20,235,36,163,10,135,101,146,49,193,196,9,201,224,169,208,106,102,28,209,35,153,158,196,217,54,97,149,100,180,224,176,71,50,198,152,120,35,25,62,13,194,55,201,200,114,33,2,35,153,105,136,28,147,140,30,78,30,72,134,75,167,242,68,50,146,76,170,48,72,102,18,14,55,36,163,133,137,107,146,49,142,35,198,36,99,37,122,184,34,25,131,152,97,131,100,102,70,10,87,36,195,167,65,248,38,25,89,46,68,96,36,51,13,145,99,146,209,195,201,3,201,112,233,84,158,72,70,146,73,21,6,201,76,194,225,134,100,180,48,113,77,50,198,113,196,152,100,172,68,15,87,36,99,16,51,108,144,204,204,72,225,138,100,248,52,8,223,36,35,203,133,8,140,100,166,33,114,76,50,122,56,121,32,25,46,157,202,19,201,72,50,169,194,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,140,231,236,178,129,236,48,179,203,52,33,114,76,50,225,100,151,177,240,230,49,187,172,149,24,96,118,153,42,28,110,72,102,249,236,50,46,188,121,202,46,235,73,12,43,187,76,11,14,39,36,19,78,118,89,39,128,121,206,46,27,200,14,51,187,76,19,34,199,36,19,78,118,25,11,111,30,179,203,90,137,1,102,151,169,194,225,134,100,150,207,46,227,194,155,167,236,178,158,196,176,178,203,180,224,112,66,50,225,100,151,145,53,149,40,117,10,127,112,76,50,3,217,34,72,76,244,176,75,50,154,16,217,39,153,25,56,185,36,25,162,86,39,157,74,111,172,244,73,166,149,56,223,82,172,147,140,42,28,150,73,198,4,19,39,36,131,27,118,171,153,113,68,143,100,122,18,103,219,132,85,146,209,130,195,30,201,24,99,226,141,100,248,52,8,223,36,35,203,133,8,140,100,166,33,114,76,50,122,56,121,32,25,46,157,202,19,201,72,50,169,194,32,153,73,56,220,144,140,22,38,174,73,198,56,142,24,147,140,149,232,225,138,100,12,98,134,13,146,153,25,41,92,145,12,159,6,225,155,100,100,185,16,129,145,204,52,68,142,73,70,15,39,15,36,195,165,83,121,34,25,73,38,85,24,36,51,9,135,27,146,209,194,196,53,201,24,199,17,99,146,177,18,61,92,145,140,65,204,176,65,50,51,35,133,43,146,225,211,32,124,147,140,44,23,34,48,146,153,134,200,49,201,232,225,228,129,100,184,116,42,79,36,35,201,164,10,131,100,38,225,112,67,50,90,152,184,38,25,227,56,98,76,50,86,162,135,43,146,49,136,25,54,72,102,102,164,112,69,50,158,179,203,6,178,195,204,46,211,132,200,49,201,132,147,93,198,194,155,199,236,178,86,98,128,217,101,170,112,184,33,153,229,179,203,184,240,230,41,187,172,39,49,172,236,50,45,56,156,144,76,56,217,101,157,0,230,57,187,108,32,59,204,236,50,77,136,28,147,76,56,217,101,44,188,121,204,46,107,37,6,152,93,166,10,135,27,146,89,62,187,140,11,111,158,178,203,122,18,195,202,46,211,130,195,9,201,132,147,93,70,232,78,148,58,229,97,37,51,144,29,230,74,70,19,34,251,36,51,3,39,151,36,67,212,234,164,83,185,94,201,180,18,3,92,201,168,194,97,153,100,76,48,113,66,50,184,150,90,205,140,35,122,36,211,147,24,214,74,70,11,14,123,36,99,140,137,55,146,225,211,32,124,147,140,44,23,34,48,146,153,134,200,49,201,232,225,228,129,100,184,116,42,79,36,35,201,164,10,131,100,38,225,112,67,50,90,152,184,38,25,227,56,98,76,50,86,162,135,43,146,49,136,25,54,72,102,102,164,112,69,50,124,26,132,111,146,145,229,66,4,70,50,211,16,57,38,25,61,156,60,144,12,151,78,229,137,100,36,153,84,97,144,204,36,28,110,72,70,11,19,215,36,99,28,71,140,73,198,74,244,112,69,50,6,49,195,6,201,204,140,20,174,72,134,79,131,240,77,50,178,92,136,192,72,102,26,34,199,36,163,135,147,7,146,225,210,169,60,145,140,36,147,42,12,146,153,132,195,13,201,104,97,226,154,100,140,227,136,49,201,88,137,30,174,72,198,32,102,216,32,153,153,145,194,21,201,120,206,46,27,200,254,12,72,102,137,236,178,25,56,121,32,25,143,217,101,173,196,112,73,198,119,118,153,9,38,174,73,198,83,118,89,79,98,176,36,227,51,187,204,24,19,111,
+36,227,57,187,108,32,59,204,236,50,77,136,28,147,76,56,217,101,44,188,121,204,46,107,37,6,152,93,166,10,135,27,146,89,62,187,140,11,111,158,178,203,122,18,195,202,46,211,130,195,9,201,132,147,93,70,52,17,165,78,121,32,153,129,236,48,73,70,19,34,251,36,51,3,39,151,36,67,212,234,164,83,185,38,153,86,98,128,36,163,10,135,101,146,49,193,196,9,201,32,205,173,102,198,17,61,146,233,73,12,139,100,180,224,176,71,50,198,152,120,35,25,62,13,194,55,201,200,114,33,2,35,153,105,136,28,147,204,255,106,239,109,155,228,182,145,116,209,207,246,175,160,39,98,98,90,187,109,217,210,222,79,99,75,17,126,209,245,56,142,198,158,181,61,58,179,231,196,68,71,117,21,187,85,235,234,170,118,21,187,37,205,175,191,0,201,34,65,18,64,34,19,15,64,250,198,78,196,88,93,85,100,102,34,243,65,38,50,9,38,120,122,202,16,100,140,237,84,153,130,140,99,39,213,50,130,12,169,142,52,65,134,165,147,212,65,70,236,71,196,65,6,226,61,82,5,25,129,207,64,4,153,72,79,145,42,200,152,219,32,114,7,25,215,94,136,133,5,25,90,69,137,131,12,79,79,25,130,140,177,157,42,83,144,113,236,164,90,70,144,33,213,145,38,200,176,116,146,58,200,136,253,136,56,200,64,188,71,170,32,35,240,25,136,32,19,233,41,82,5,25,115,27,68,238,32,227,218,11,177,176,32,67,171,40,113,144,225,233,41,67,144,49,182,83,101,10,50,142,157,84,203,8,50,164,58,210,4,25,150,78,82,7,25,177,31,17,7,25,136,247,72,21,100,4,62,3,17,100,34,61,69,170,32,99,110,131,200,29,100,92,123,33,22,22,100,104,21,37,14,50,60,61,101,8,50,198,118,170,76,65,198,177,147,106,25,65,134,84,71,154,32,195,210,73,234,32,35,246,35,226,32,3,241,30,169,130,140,192,103,32,130,76,164,167,72,21,100,50,239,46,155,240,254,29,4,153,57,118,151,69,232,41,67,144,201,184,187,172,231,184,220,32,147,123,119,153,68,39,169,131,76,166,221,101,35,142,139,13,50,57,119,151,137,117,130,11,50,157,100,127,236,60,88,189,7,193,182,119,74,255,61,146,229,175,63,126,235,246,238,127,180,70,25,165,130,237,166,44,174,63,20,255,42,143,7,67,55,30,9,108,154,145,72,19,136,23,167,136,119,135,205,196,225,51,213,229,86,212,144,171,15,69,65,98,132,235,140,169,173,112,57,255,120,97,110,107,25,236,179,226,89,79,137,243,134,135,164,49,223,120,4,105,25,160,248,225,169,198,165,20,33,106,228,250,97,105,134,131,149,70,142,235,72,191,243,70,67,151,133,149,9,223,104,172,212,50,32,177,194,84,141,75,41,50,172,68,232,135,165,25,90,58,42,84,152,251,41,230,9,86,174,173,21,139,12,86,180,186,178,4,43,158,206,178,5,43,99,191,86,214,96,229,216,176,181,164,96,69,170,38,101,176,98,233,39,79,176,18,251,157,200,96,5,241,54,105,131,149,192,199,224,130,85,164,103,73,27,172,204,125,25,243,4,43,215,22,141,69,6,43,90,93,89,130,21,79,103,217,130,149,177,239,43,107,176,114,108,252,90,82,176,34,85,147,50,88,177,244,147,39,88,137,253,78,100,176,130,120,155,180,193,74,224,99,112,193,42,210,179,164,13,86,230,254,142,121,130,149,107,171,199,34,131,21,173,174,44,193,138,167,179,108,193,202,216,63,150,53,88,57,54,144,45,41,88,145,170,73,25,172,88,250,201,19,172,196,126,39,50,88,65,188,77,218,96,37,240,49,184,96,21,233,89,210,6,43,162,11,81,134,96,197,104,72,52,127,176,162,213,149,37,88,241,116,150,45,88,249,187,156,165,11,86,225,109,206,102,11,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,138,216,111,146,33,88,49,182,158,204,31,172,104,117,101,9,86,60,157,101,11,86,254,253,108,233,130,85,248,134,182,217,130,21,169,154,148,193,138,165,159,60,193,74,236,119,34,131,21,196,219,164,13,86,2,31,131,11,86,145,158,5,30,172,234,103,104,179,238,6,156,72,176,228,50,32,83,93,169,130,85,132,206,210,7,171,90,184,25,118,3,246,124,23,91,6,12,85,77,146,96,37,209,79,194,96,165,55,122,204,177,27,112,196,
+119,137,101,64,150,106,208,193,74,172,159,204,193,202,220,122,162,255,206,31,172,92,251,79,36,210,36,15,86,180,186,178,4,43,158,206,178,5,43,99,203,27,207,122,145,193,202,177,219,141,47,67,186,96,69,170,38,101,176,98,233,39,79,176,18,251,157,200,96,5,241,54,105,131,149,192,199,224,130,85,164,103,73,27,172,204,173,39,243,4,43,215,254,147,69,6,43,90,93,89,130,21,79,103,217,130,149,177,229,45,107,176,114,236,118,91,82,176,34,85,147,50,88,177,244,147,39,88,137,253,78,100,176,130,120,155,180,193,74,224,99,112,193,42,210,179,164,13,86,230,214,147,121,130,149,107,255,201,34,131,21,173,174,44,193,138,167,179,108,193,202,216,242,150,53,88,57,118,187,45,41,88,145,170,73,25,172,88,250,201,19,172,196,126,39,50,88,65,188,77,218,96,37,240,49,184,96,21,233,89,210,6,171,89,118,3,78,36,88,242,110,64,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,238,6,12,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,187,1,89,170,73,24,172,150,182,27,112,224,246,102,217,13,56,145,96,201,187,1,153,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,27,48,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,238,6,100,169,38,97,176,90,218,110,192,186,44,57,235,110,192,137,4,75,222,13,200,84,87,170,96,21,161,179,244,193,170,22,110,134,221,128,61,223,197,238,6,12,85,77,146,96,37,209,79,194,96,165,159,157,205,177,27,112,196,119,137,187,1,89,170,65,7,43,177,126,50,7,171,89,118,3,78,36,88,242,51,43,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,62,179,10,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,207,172,88,170,73,24,172,150,182,27,112,224,246,204,173,39,250,239,252,193,202,181,255,68,34,77,242,96,69,171,43,75,176,226,233,44,91,176,50,182,188,241,172,23,25,172,28,187,221,248,50,164,11,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,122,50,79,176,114,237,63,89,100,176,162,213,149,37,88,241,116,150,45,88,25,91,222,178,6,43,199,110,183,37,5,43,82,53,41,131,21,75,63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,53,203,110,192,137,4,75,222,13,200,84,87,150,96,181,180,221,128,173,83,204,190,27,176,231,187,216,221,128,161,170,73,25,172,150,178,27,208,112,138,89,119,3,142,248,46,113,55,32,75,53,9,131,213,210,118,3,14,220,222,44,187,1,39,18,44,121,55,32,83,93,89,130,213,210,118,3,182,78,49,251,110,192,158,239,98,119,3,134,170,38,101,176,90,202,110,64,195,41,102,221,13,56,226,187,196,221,128,44,213,36,12,86,75,219,13,88,103,122,179,238,6,156,72,176,228,221,128,76,117,165,10,86,17,58,75,31,172,106,225,102,216,13,216,243,93,236,110,192,80,213,36,9,86,18,253,36,12,86,186,28,57,199,110,192,17,223,37,238,6,100,169,6,29,172,196,250,201,28,172,102,217,13,56,145,96,201,187,1,153,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,27,48,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,238,6,100,169,38,97,176,90,218,110,192,129,219,155,101,55,224,68,130,37,111,176,96,170,43,75,176,90,218,110,192,214,41,102,223,13,216,243,93,236,6,139,80,213,164,12,86,75,217,13,104,56,197,172,187,1,71,124,151,184,193,130,165,154,132,193,106,105,187,1,7,110,207,220,122,162,255,206,31,172,92,251,79,36,210,36,15,86,180,186,178,4,43,158,206,178,5,43,99,203,27,207,122,145,193,202,177,219,141,47,67,186,96,69,170,38,101,176,98,233,39,79,176,18,251,157,200,96,5,241,54,105,131,149,192,199,224,130,85,164,103,73,27,172,102,217,13,56,145,96,201,187,1,153,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,27,48,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,238,6,100,169,38,97,176,90,218,110,192,129,219,155,101,55,224,68,130,37,239,
+6,100,170,43,75,176,90,218,110,192,214,41,102,223,13,216,243,93,236,110,192,80,213,164,12,86,75,217,13,104,56,197,172,187,1,71,124,151,184,27,144,165,154,132,193,106,105,187,1,235,224,105,219,222,150,45,179,154,72,176,228,204,138,169,174,84,193,42,66,103,233,131,85,45,220,96,203,91,158,204,170,231,187,216,204,42,84,53,73,130,149,68,63,9,131,149,206,240,174,35,253,142,36,88,141,248,46,49,179,98,169,6,29,172,196,250,201,28,172,204,173,39,243,4,43,215,254,147,69,6,43,90,93,89,130,21,79,103,217,130,149,177,229,45,107,176,114,236,118,91,82,176,34,85,147,50,88,177,244,147,39,88,137,253,78,100,176,130,120,155,180,193,74,224,99,112,193,42,210,179,164,13,86,230,214,147,121,130,149,107,255,201,34,131,21,173,174,44,193,138,167,179,108,193,202,216,242,150,53,88,57,118,187,45,41,88,145,170,73,25,172,88,250,201,19,172,196,126,39,50,88,65,188,77,218,96,37,240,49,184,96,21,233,89,210,6,43,115,235,201,60,193,202,181,255,100,145,193,138,86,87,150,96,197,211,89,182,96,101,108,121,203,26,172,28,187,221,150,20,172,72,213,164,12,86,44,253,228,9,86,98,191,19,25,172,32,222,38,109,176,18,248,24,92,176,138,244,44,105,131,213,44,187,1,39,18,252,110,130,213,124,187,1,35,116,150,45,88,101,223,13,216,243,93,122,176,154,103,55,160,68,63,121,130,85,214,221,128,35,190,11,15,86,249,119,3,138,245,147,57,88,205,178,27,112,34,193,146,119,3,50,213,149,37,88,45,109,55,96,235,20,179,239,6,236,249,46,118,55,96,168,106,82,6,171,165,236,6,52,156,98,214,221,128,35,190,75,220,13,200,82,77,194,96,181,180,221,128,181,60,182,237,109,217,130,213,68,130,37,7,43,166,186,82,5,171,8,157,165,15,86,181,112,131,45,111,121,130,85,207,119,177,193,42,84,53,73,130,149,68,63,9,131,149,14,154,215,145,126,71,18,172,70,124,151,24,172,88,170,65,7,43,177,126,50,7,43,115,235,201,60,193,202,181,255,100,145,193,138,86,87,150,96,197,211,89,182,96,101,108,121,203,26,172,28,187,221,150,20,172,72,213,164,12,86,44,253,228,9,86,98,191,19,25,172,32,222,38,109,176,18,248,24,92,176,138,244,44,105,131,149,185,245,100,158,96,229,218,127,178,200,96,69,171,43,75,176,226,233,44,91,176,50,182,188,101,13,86,142,221,110,75,10,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,122,50,79,176,114,237,63,89,100,176,162,213,149,37,88,241,116,150,45,88,25,91,222,178,6,43,199,110,183,37,5,43,82,53,41,131,21,75,63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,101,110,61,153,39,88,185,246,159,44,50,88,209,234,202,18,172,120,58,203,22,172,140,45,111,89,131,149,99,183,219,146,130,21,169,154,148,193,138,165,159,60,193,74,236,119,34,131,21,196,219,164,13,86,2,31,131,11,86,145,158,37,109,176,154,101,55,224,68,130,223,77,176,154,111,55,96,132,206,178,5,171,236,187,1,123,190,75,15,86,243,236,6,148,232,39,79,176,202,186,27,112,196,119,225,193,42,255,110,64,177,126,208,193,170,147,79,221,219,121,190,235,173,217,104,110,219,71,114,253,247,72,166,175,126,176,122,59,245,181,242,119,198,248,189,244,173,135,79,50,121,89,117,48,22,192,96,249,168,255,225,50,171,121,189,161,168,198,12,167,225,16,50,152,134,213,181,216,74,111,26,197,81,84,35,6,211,114,112,13,198,142,13,189,223,40,240,228,101,17,246,198,244,3,15,62,133,97,79,179,164,142,6,230,99,175,163,26,51,28,22,246,20,171,107,177,149,156,216,27,82,141,24,140,4,123,245,246,129,192,131,84,37,216,155,208,15,60,199,16,133,189,154,37,117,210,39,27,123,61,213,152,225,112,176,167,89,93,139,173,228,194,222,136,106,196,96,36,216,171,159,6,6,158,139,40,193,222,132,126,224,177,100,40,236,213,44,169,131,251,216,216,235,169,198,12,135,131,61,205,234,90,108,37,23,246,70,84,35,6,35,193,30,231,152,51,9,246,164,231,151,161,176,23,116,14,23,27,123,236,3,182,162,177,23,126,
+80,20,7,123,178,19,160,36,216,235,24,27,85,22,78,174,241,227,79,54,56,252,248,211,16,121,62,226,129,139,89,15,35,202,82,125,41,32,40,203,176,113,210,140,222,16,36,35,6,82,147,15,24,6,39,191,176,240,121,83,235,139,32,41,31,70,67,158,116,115,38,24,24,153,5,31,105,194,180,2,131,180,144,156,130,137,52,110,66,17,137,180,224,108,34,28,105,162,84,2,130,52,78,30,193,70,154,52,137,128,32,45,40,131,224,33,141,157,62,196,33,45,60,119,8,70,154,44,113,128,32,141,147,53,176,145,38,77,25,32,72,11,202,23,120,72,99,39,11,113,72,11,207,20,130,145,38,75,19,32,72,227,228,8,108,164,73,19,4,8,210,130,178,3,30,210,216,169,65,28,210,194,243,130,96,164,201,146,2,62,210,58,174,239,133,57,193,63,236,24,248,199,24,109,239,1,105,129,151,23,101,169,247,204,204,192,202,172,230,245,134,162,26,51,156,134,67,200,96,56,249,193,63,172,200,248,199,8,121,239,35,82,4,15,7,210,205,189,23,102,9,34,236,9,19,5,24,246,66,114,5,62,246,184,233,66,60,246,130,51,6,22,246,68,73,3,10,123,156,188,65,130,61,105,234,128,194,94,80,246,192,198,30,59,129,136,198,94,120,14,193,193,158,44,141,64,97,143,147,73,72,176,39,77,38,80,216,11,202,39,216,216,99,167,20,209,216,11,207,42,56,216,147,37,22,40,236,113,114,11,9,246,164,233,5,10,123,65,25,6,27,123,236,36,35,26,123,225,121,6,7,123,178,84,67,130,189,142,241,151,95,138,214,123,175,127,254,139,123,55,236,151,95,214,123,78,143,171,237,169,236,55,163,29,30,170,226,112,163,190,221,223,150,197,169,92,31,246,155,226,112,95,170,207,27,67,17,62,121,2,215,32,180,108,142,77,98,34,129,119,167,183,147,253,178,76,77,122,116,232,145,193,183,197,46,72,168,112,117,114,21,41,148,90,219,158,177,52,247,216,89,75,247,38,2,129,194,165,60,37,81,50,220,241,180,230,212,23,2,109,114,213,241,148,38,199,24,39,99,114,91,244,77,61,3,228,24,147,102,88,148,68,169,48,198,212,154,83,95,0,140,69,168,142,167,52,166,172,100,16,51,83,164,37,4,85,87,114,181,252,160,74,107,114,134,160,202,83,231,92,65,213,168,57,204,24,84,29,53,138,197,6,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,89,131,170,89,251,89,66,80,117,85,141,150,31,84,105,77,206,16,84,121,234,156,43,168,26,197,212,25,131,170,163,248,186,216,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,53,139,218,75,8,170,174,114,248,242,131,42,173,201,25,130,42,79,157,115,5,85,227,41,209,140,65,213,241,84,105,177,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,234,160,58,216,103,100,86,205,45,251,87,114,4,213,137,60,129,123,107,230,15,170,76,77,230,9,170,17,234,204,30,84,219,205,97,198,211,65,158,157,49,65,181,151,34,30,121,57,130,106,168,214,50,4,85,137,234,242,5,85,99,207,158,216,207,197,7,213,145,20,209,24,75,29,84,89,90,75,27,84,197,170,155,55,168,18,219,78,179,7,85,198,134,213,133,5,85,90,147,51,4,85,158,58,231,10,170,254,125,220,185,130,106,248,190,239,101,4,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,89,131,170,89,53,95,66,80,117,149,206,151,31,84,105,77,206,16,84,121,234,156,43,168,26,79,7,103,12,170,142,7,131,139,13,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,179,106,190,132,160,234,42,157,47,63,168,210,154,156,33,168,242,212,57,87,80,53,158,14,206,24,84,29,15,6,23,27,84,73,173,229,11,170,44,213,205,18,84,197,126,14,26,84,33,222,45,99,80,21,248,180,84,65,53,210,147,165,14,170,131,247,231,205,170,185,229,189,236,28,65,117,34,79,224,59,227,243,7,85,166,38,243,4,213,8,117,102,15,170,109,211,3,227,233,32,207,
+206,152,160,218,75,17,143,188,28,65,53,84,107,25,130,170,68,117,249,130,170,209,139,66,236,231,226,131,234,72,138,104,140,165,14,170,44,173,165,13,170,98,213,205,27,84,205,170,249,18,130,170,171,116,190,252,160,74,107,114,134,160,202,83,231,92,65,213,120,58,56,99,80,117,60,24,92,108,80,37,181,150,47,168,178,84,55,75,80,21,251,57,104,80,133,120,183,140,65,85,224,211,82,5,213,72,79,150,53,168,18,61,202,178,7,85,70,119,179,133,5,85,90,147,51,4,85,158,58,231,10,170,254,166,127,185,130,106,120,147,192,101,4,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,89,131,170,89,53,95,66,80,117,149,206,151,31,84,105,77,206,16,84,121,234,156,43,168,26,79,7,103,12,170,142,7,131,139,13,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,82,7,213,65,95,104,179,106,110,233,55,156,35,168,78,228,9,236,133,60,127,80,101,106,50,79,80,141,80,103,246,160,218,54,243,54,158,14,242,236,140,9,170,189,20,241,200,203,17,84,67,181,150,33,168,74,84,151,47,168,26,61,214,197,126,46,62,168,142,164,136,198,88,234,160,202,210,90,218,160,42,86,221,188,65,213,172,154,47,33,168,186,74,231,203,15,170,180,38,103,8,170,60,117,206,21,84,141,167,131,51,6,85,199,131,193,197,6,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,89,131,170,89,53,95,66,80,117,149,206,151,31,84,105,77,206,16,84,121,234,156,43,168,26,79,7,103,12,170,142,7,131,139,13,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,226,64,187,236,65,149,113,20,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,9,145,185,130,106,248,137,146,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,160,65,181,147,246,229,75,209,49,160,63,249,34,215,203,151,242,168,234,147,39,176,113,50,45,27,18,121,199,200,3,85,127,178,7,173,86,135,66,12,30,129,7,170,250,4,196,122,60,109,123,198,209,160,30,59,107,233,222,68,32,80,120,42,40,37,81,50,220,241,180,230,212,23,2,109,114,213,241,148,38,199,24,231,104,208,159,60,49,76,207,0,57,198,164,167,130,82,18,165,194,24,83,107,78,125,1,48,22,161,58,158,210,164,169,170,43,136,17,71,230,101,15,170,140,115,243,22,22,84,105,77,206,16,84,121,234,156,43,168,250,143,6,205,21,84,195,79,5,93,70,80,37,181,150,47,168,178,84,55,75,80,21,251,57,104,80,133,120,183,140,65,85,224,211,82,5,213,72,79,150,53,168,18,71,230,101,15,170,140,115,243,22,22,84,105,77,206,16,84,121,234,156,43,168,250,143,6,205,21,84,195,79,5,93,70,80,37,181,150,47,168,178,84,55,75,80,21,251,57,104,80,133,120,183,140,65,85,224,211,82,5,213,72,79,150,53,168,18,71,230,101,15,170,140,115,243,22,22,84,105,77,206,16,84,121,234,156,43,168,250,143,6,205,21,84,195,79,5,93,70,80,37,181,150,47,168,178,84,55,75,80,21,251,57,104,80,133,120,183,140,65,85,224,211,82,5,213,72,79,150,58,168,114,142,1,205,17,84,165,39,128,206,31,84,153,154,204,19,84,35,212,153,61,168,6,29,13,154,60,168,178,79,5,157,57,168,134,106,45,67,80,149,168,46,95,80,13,63,26,52,101,80,149,157,10,58,95,80,101,105,45,109,80,21,171,110,222,160,74,28,153,151,61,168,50,206,205,91,88,80,165,53,57,67,80,229,169,115,174,160,234,63,26,52,87,80,13,63,21,116,25,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,74,28,153,151,61,168,50,206,205,91,88,80,165,53,57,67,80,229,169,115,174,160,234,63,26,52,87,80,13,63,21,116,25,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,74,28,153,
+151,61,168,50,206,205,91,88,80,165,53,57,67,80,229,169,115,174,160,234,63,26,52,87,80,13,63,21,116,25,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,234,160,202,57,6,52,71,80,149,158,0,58,127,80,101,106,50,79,80,141,80,103,246,160,26,116,52,104,242,160,202,62,21,116,230,160,26,170,181,12,65,85,162,186,124,65,53,252,104,208,148,65,85,118,42,232,124,65,149,165,181,180,65,85,172,186,121,131,42,113,100,94,246,160,202,56,55,111,97,65,149,214,228,12,65,149,167,206,185,130,170,255,104,208,92,65,53,252,84,208,101,4,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,89,131,42,113,100,94,246,160,202,56,55,111,97,65,149,214,228,12,65,149,167,206,185,130,170,255,104,208,92,65,53,252,84,208,101,4,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,89,131,42,113,100,94,246,160,202,56,55,111,97,65,149,214,228,12,65,149,167,206,185,130,170,255,104,208,92,65,53,252,84,208,101,4,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,169,131,42,231,24,208,28,65,85,122,2,232,252,65,149,169,201,60,65,53,66,157,217,131,106,208,209,160,201,131,42,251,84,208,153,131,106,168,214,50,4,85,137,234,242,5,213,240,163,65,83,6,85,217,169,160,243,5,85,150,214,210,6,85,177,234,230,13,170,196,145,121,217,131,42,227,220,188,133,5,85,90,147,51,4,85,158,58,231,10,170,254,163,65,115,5,213,240,83,65,151,17,84,73,173,229,11,170,44,213,205,18,84,197,126,14,26,84,33,222,45,99,80,21,248,180,84,65,53,210,147,101,13,170,196,145,121,217,131,42,227,220,188,133,5,85,90,147,51,4,85,158,58,231,10,170,254,163,65,115,5,213,240,83,65,151,17,84,73,173,229,11,170,44,213,205,18,84,197,126,14,26,84,33,222,45,99,80,21,248,180,84,65,53,210,147,101,13,170,196,145,121,217,131,42,227,220,188,133,5,85,90,147,51,4,85,158,58,231,10,170,254,163,65,115,5,213,240,83,65,151,17,84,73,173,229,11,170,44,213,205,18,84,197,126,14,26,84,33,222,45,99,80,21,248,180,84,65,53,210,147,65,131,106,127,96,110,223,113,125,107,190,200,184,53,206,33,216,78,158,249,190,254,197,122,114,181,242,179,230,89,188,110,210,214,22,200,28,54,86,53,12,121,27,220,30,245,63,76,62,138,205,27,63,193,136,65,20,174,227,151,7,28,27,46,215,82,139,188,209,154,242,19,148,15,161,38,238,26,130,5,2,167,234,104,84,159,213,7,28,186,38,164,243,161,171,230,246,168,255,1,161,171,39,152,1,93,154,203,181,212,34,54,116,141,8,230,67,151,230,208,65,64,108,118,43,186,38,164,243,161,171,230,246,168,255,1,161,171,39,152,1,93,154,203,117,20,0,252,4,243,161,203,125,62,118,124,100,12,58,229,58,77,100,156,30,191,28,25,25,253,135,40,131,35,163,227,116,95,121,100,12,56,163,55,61,186,6,135,42,98,209,229,60,36,49,37,186,204,115,72,33,232,114,157,38,154,12,93,124,139,16,232,138,179,67,20,186,6,167,139,97,209,229,60,45,44,37,186,204,3,249,32,232,114,29,171,151,12,93,124,139,16,232,138,179,67,20,186,6,199,236,96,209,229,60,54,39,37,186,204,147,169,32,232,114,157,47,149,12,93,124,139,16,232,138,179,67,20,186,110,118,201,124,151,38,157,29,93,138,41,22,93,138,96,94,116,241,45,66,160,43,206,14,81,232,218,92,239,82,161,75,147,206,142,46,197,20,139,46,69,48,47,186,248,22,33,208,21,103,7,118,189,203,117,254,23,160,222,21,114,138,87,162,122,215,228,120,169,216,122,151,247,144,40,116,189,203,126,122,81,68,189,139,62,131,40,3,186,176,57,99,208,113,54,73,209,133,203,25,253,167,165,164,67,23,38,103,12,56,140,35,3,186,176,57,99,208,185,14,73,209,133,203,25,253,199,6,164,67,23,38,103,12,232,74,159,1,93,216,156,49,168,193,121,82,116,225,114,70,127,255,236,116,232,194,228,140,1,237,153,51,160,
+11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,96,62,116,57,251,155,199,163,43,168,75,121,26,116,77,219,103,71,162,203,223,4,27,140,46,71,119,102,57,186,2,122,44,103,64,23,54,103,12,106,215,155,20,93,184,156,209,223,13,54,29,186,48,57,99,64,179,209,12,232,194,230,140,65,125,43,147,162,11,151,51,250,219,34,166,67,23,38,103,12,232,186,151,1,93,216,156,49,168,129,91,82,116,225,114,70,127,127,176,116,232,194,228,140,1,237,167,50,160,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,96,62,116,57,251,183,197,163,43,168,11,91,26,116,77,219,131,69,162,203,223,228,11,140,46,71,247,41,57,186,2,122,72,101,64,23,54,103,12,106,71,148,20,93,184,156,209,223,237,38,29,186,48,57,99,64,51,149,12,232,194,230,140,65,125,57,146,162,11,151,51,250,219,62,164,67,23,38,103,12,232,42,144,1,93,216,156,49,232,5,245,164,232,194,229,140,254,247,159,211,161,11,147,51,6,188,94,155,1,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,243,161,171,198,114,154,156,113,66,58,31,186,106,214,200,156,177,39,152,1,93,218,67,66,115,198,17,193,153,208,133,205,25,39,164,179,163,11,151,51,246,4,243,162,11,147,51,142,8,206,132,46,108,206,56,33,157,29,93,184,156,177,39,152,23,93,152,156,113,68,112,38,116,97,115,198,9,233,236,232,194,229,140,61,193,188,232,194,228,140,35,130,51,161,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,96,62,116,213,220,210,228,140,19,210,249,208,85,179,70,230,140,61,193,12,232,210,24,134,230,140,35,130,51,161,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,103,66,23,54,103,156,144,206,142,46,92,206,216,19,204,139,46,76,206,56,34,56,19,186,176,57,227,132,116,118,116,225,114,198,158,96,94,116,97,114,198,17,193,84,232,234,121,190,144,245,20,127,101,53,252,139,17,192,94,196,119,21,119,51,34,237,243,130,215,87,252,149,13,6,47,134,32,123,33,239,44,238,34,31,48,12,86,111,241,87,54,40,188,24,2,237,133,188,187,184,139,60,237,200,94,200,250,139,115,145,38,238,48,142,64,90,88,143,113,22,210,248,93,198,163,144,198,232,51,30,138,52,97,167,113,4,210,88,189,198,185,72,19,119,27,71,32,45,172,223,56,11,105,252,142,227,81,72,99,244,28,15,69,154,176,235,56,2,105,172,190,227,236,232,41,237,60,14,137,158,65,189,199,121,209,147,221,125,60,46,122,134,247,31,15,142,158,178,14,228,112,164,81,213,190,40,164,113,42,127,64,164,17,53,88,9,210,24,85,88,20,210,248,150,33,145,22,103,143,72,164,81,149,191,40,164,113,170,128,64,164,17,245,88,9,210,24,21,89,20,210,248,150,33,145,22,103,143,72,164,81,85,192,40,164,113,42,130,64,164,17,181,89,9,210,24,213,89,20,210,248,150,33,145,22,103,143,72,164,81,21,193,40,164,113,170,131,64,164,17,117,90,9,210,24,149,90,20,210,248,150,33,145,22,103,143,72,164,81,213,193,40,164,113,42,133,64,164,17,53,91,9,210,24,85,91,20,210,248,150,33,145,22,103,15,65,61,141,211,191,156,93,79,147,118,48,135,212,211,130,122,152,243,234,105,236,46,230,113,245,180,240,62,230,193,245,52,89,39,115,56,210,208,185,167,184,155,57,16,105,200,220,147,223,209,28,133,52,84,238,41,236,106,14,71,26,58,247,20,119,54,7,34,13,153,123,242,187,155,163,144,134,202,61,133,29,206,225,72,67,231,158,226,46,231,64,164,33,115,79,126,167,115,20,210,80,185,167,176,219,57,28,105,232,220,83,220,241,28,
+136,52,100,238,201,239,122,142,66,26,42,247,20,118,62,135,35,13,157,123,138,187,159,3,145,134,204,61,249,29,208,81,72,67,229,158,194,46,232,8,164,177,250,160,115,145,38,238,132,142,64,90,88,47,116,22,210,248,221,208,163,144,198,232,135,30,138,52,97,71,116,56,210,208,185,167,184,43,58,16,105,200,220,147,223,25,29,133,52,84,238,41,236,142,14,71,26,58,247,20,119,72,7,34,13,153,123,242,187,164,163,144,134,202,61,133,157,210,225,72,67,231,158,226,110,233,64,164,33,115,79,126,199,116,20,210,80,185,167,176,107,58,28,105,232,220,83,220,57,29,136,52,100,238,201,239,158,142,66,26,42,247,20,118,80,135,35,13,157,123,138,187,168,3,145,134,204,61,249,157,212,81,72,67,229,158,194,110,234,8,164,177,250,169,115,145,38,238,168,142,64,90,88,79,117,22,210,248,93,213,163,144,198,232,171,30,138,52,97,103,117,56,210,208,185,167,184,187,58,16,105,200,220,147,223,97,29,133,52,84,238,41,236,178,14,71,26,58,247,20,119,90,7,34,13,153,123,242,187,173,163,144,134,202,61,133,29,215,225,72,67,231,158,226,174,235,64,164,33,115,79,126,231,117,20,210,80,185,167,176,251,58,28,105,232,220,83,220,129,29,136,52,100,238,201,239,194,142,66,26,42,247,20,118,98,135,35,13,157,123,138,187,177,3,145,134,204,61,249,29,217,81,72,67,229,158,194,174,236,8,164,177,250,178,115,145,38,238,204,142,64,90,88,111,118,22,210,248,221,217,163,144,198,232,207,30,138,52,97,135,118,56,210,208,185,167,184,75,59,16,105,200,220,147,223,169,29,133,52,84,238,41,236,214,14,71,26,58,247,20,119,108,7,34,13,153,123,242,187,182,163,144,134,202,61,133,157,219,225,72,67,231,158,226,238,237,64,164,33,115,79,126,7,119,20,210,80,185,167,176,139,59,28,105,232,220,83,220,201,29,136,52,100,238,201,239,230,142,66,26,42,247,20,118,116,135,35,13,157,123,138,187,186,3,145,134,204,61,249,157,221,81,72,67,229,158,194,238,238,8,164,177,250,187,115,145,38,238,240,142,64,90,88,143,119,22,210,248,93,222,163,144,198,232,243,30,138,52,97,167,119,56,210,208,185,167,184,219,59,16,105,200,220,147,223,241,29,133,52,84,238,41,236,250,14,71,26,58,247,20,119,126,7,34,13,153,123,242,187,191,163,144,134,202,61,133,29,224,225,72,67,231,158,226,46,240,64,164,33,115,79,126,39,120,20,210,80,185,167,176,27,60,28,105,232,220,83,220,17,30,136,52,100,238,201,239,10,143,66,26,42,247,20,118,134,135,35,13,157,123,138,187,195,3,145,134,204,61,249,29,226,81,72,67,229,158,194,46,241,108,164,117,92,95,138,186,196,127,103,61,30,224,229,16,104,47,163,123,196,187,217,80,246,121,201,234,16,111,227,163,216,188,241,19,140,24,132,38,78,15,129,211,29,254,59,219,65,1,47,7,0,123,41,238,13,239,34,78,58,178,151,162,206,240,76,116,73,251,194,3,208,21,212,21,158,131,46,118,79,248,24,116,133,119,132,15,68,151,172,31,60,0,93,156,110,240,76,116,73,123,193,3,208,21,212,9,158,131,46,118,31,248,24,116,133,119,129,15,68,151,172,7,60,0,93,156,14,240,220,200,40,236,255,142,136,140,33,221,223,89,145,145,219,251,61,42,50,6,119,126,15,141,140,162,190,239,104,116,17,245,190,24,116,49,234,126,56,116,249,171,176,2,116,133,215,96,65,232,226,91,132,64,87,156,29,162,208,69,212,248,98,208,197,168,245,225,208,229,175,188,10,208,21,94,119,5,161,139,111,17,2,93,113,118,136,66,23,81,215,139,65,23,163,190,135,67,151,191,218,42,64,87,120,173,21,132,46,190,69,8,116,197,217,33,10,93,68,45,47,6,93,140,154,30,14,93,254,10,171,0,93,225,245,85,16,186,248,22,33,208,21,103,135,40,116,17,245,187,24,116,49,234,120,56,116,249,171,170,2,116,133,215,84,65,232,226,91,132,64,87,156,29,216,245,46,70,231,118,110,189,75,216,183,29,81,239,10,233,218,206,170,119,113,123,182,71,213,187,130,59,182,135,214,187,68,253,218,209,232,194,230,140,210,94,237,56,116,225,114,70,118,159,118,16,186,48,57,163,172,71,59,26,93,216,156,81,218,159,29,135,46,92,206,200,238,205,14,66,23,38,103,148,245,101,
+71,163,11,155,51,74,123,178,227,208,133,203,25,217,253,216,65,232,194,228,140,178,94,236,104,116,97,115,70,105,31,118,28,186,112,57,35,187,7,59,8,93,152,156,81,214,127,29,141,46,108,206,40,237,189,142,67,23,46,103,100,247,93,7,161,11,147,51,202,122,174,3,208,197,233,184,206,68,151,180,223,58,0,93,65,221,214,57,232,98,247,90,143,65,87,120,167,245,64,116,201,250,172,163,209,133,205,25,165,61,214,113,232,194,229,140,236,254,234,32,116,97,114,70,89,111,117,52,186,176,57,163,180,175,58,14,93,184,156,145,221,83,29,132,46,76,206,40,235,167,142,70,23,54,103,148,246,82,199,161,11,151,51,178,251,168,131,208,133,201,25,101,61,212,209,232,194,230,140,210,254,233,56,116,225,114,70,118,239,116,16,186,48,57,163,172,111,58,26,93,216,156,81,218,51,29,135,46,92,206,200,238,151,14,66,23,38,103,148,245,74,7,160,139,211,41,157,137,46,105,159,116,0,186,130,186,164,115,208,197,238,145,30,131,174,240,14,233,129,232,146,245,71,71,163,11,155,51,74,123,163,227,208,133,203,25,217,125,209,65,232,194,228,140,178,158,232,104,116,97,115,70,105,63,116,28,186,112,57,35,187,23,58,8,93,152,156,81,214,7,29,141,46,108,206,40,237,129,142,67,23,46,103,100,247,63,7,161,11,147,51,202,122,159,163,209,133,205,25,165,125,207,113,232,194,229,140,236,158,231,32,116,97,114,70,89,191,115,52,186,176,57,163,180,215,57,14,93,184,156,145,221,231,28,132,46,76,206,40,235,113,14,64,23,167,195,57,19,93,210,254,230,0,116,5,117,55,231,160,139,221,219,60,6,93,225,157,205,3,209,37,235,107,142,70,23,54,103,148,246,52,199,161,11,151,51,178,251,153,131,208,133,201,25,101,189,204,209,232,194,230,140,210,62,230,56,116,225,114,70,118,15,115,16,186,48,57,163,172,127,57,26,93,216,156,81,218,187,28,135,46,92,206,200,238,91,14,66,23,38,103,148,245,44,71,163,11,155,51,74,251,149,227,208,133,203,25,217,189,202,65,232,194,228,140,178,62,229,104,116,97,115,70,105,143,114,28,186,112,57,35,187,63,57,8,93,152,156,81,214,155,28,128,46,78,103,114,38,186,164,125,201,1,232,10,234,74,206,65,23,187,39,121,12,186,194,59,146,7,162,75,214,143,28,141,46,108,206,40,237,69,142,67,23,46,103,100,247,33,7,161,11,147,51,202,122,144,163,209,133,205,25,165,253,199,113,232,194,229,140,236,222,227,32,116,97,114,70,89,223,113,52,186,176,57,163,180,231,56,14,93,184,156,145,221,111,28,132,46,76,206,40,235,53,142,70,23,54,103,148,246,25,199,161,11,151,51,178,123,140,131,208,133,201,25,101,253,197,209,232,194,230,140,210,222,226,56,116,225,114,70,118,95,113,16,186,48,57,163,172,167,56,27,93,61,207,23,178,158,226,214,166,242,47,71,221,235,125,196,67,71,230,102,68,218,231,5,175,175,184,173,189,252,203,97,247,122,27,201,136,129,212,228,3,134,193,234,45,110,107,47,255,114,216,189,222,70,82,62,140,134,60,237,200,94,200,250,139,115,145,38,238,48,142,64,90,88,143,113,22,210,248,93,198,163,144,198,232,51,30,138,52,97,167,113,4,210,88,189,198,185,72,19,119,27,71,32,45,172,223,56,11,105,252,142,227,81,72,99,244,28,15,69,154,176,235,56,2,105,172,190,227,236,232,41,237,60,14,137,158,65,189,199,121,209,147,221,125,60,46,122,134,247,31,15,142,158,178,14,228,112,164,81,213,190,40,164,113,42,127,64,164,17,53,88,9,210,24,85,88,20,210,248,150,33,145,22,103,143,72,164,81,149,191,40,164,113,170,128,64,164,17,245,88,9,210,24,21,89,20,210,248,150,33,145,22,103,143,72,164,81,85,192,40,164,113,42,130,64,164,17,181,89,9,210,24,213,89,20,210,248,150,33,145,22,103,143,72,164,81,21,193,40,164,113,170,131,64,164,17,117,90,9,210,24,149,90,20,210,248,150,33,145,22,103,143,72,164,81,213,193,40,164,113,42,133,64,164,17,53,91,9,210,24,85,91,20,210,248,150,33,145,22,103,15,65,61,141,211,191,156,93,79,147,118,48,135,212,211,130,122,152,243,234,105,236,46,230,113,245,180,240,62,230,193,245,52,89,39,115,56,210,208,185,167,184,155,57,16,105,200,220,147,223,
+209,28,133,52,84,238,41,236,106,14,71,26,58,247,20,119,54,7,34,13,153,123,242,187,155,163,144,134,202,61,133,29,206,225,72,67,231,158,226,46,231,64,164,33,115,79,126,167,115,20,210,80,185,167,176,219,57,28,105,232,220,83,220,241,28,136,52,100,238,201,239,122,142,66,26,42,247,20,118,62,135,35,13,157,123,138,187,159,3,145,134,204,61,249,29,208,81,72,67,229,158,194,46,232,8,164,177,250,160,115,145,38,238,132,142,64,90,88,47,116,22,210,248,221,208,163,144,198,232,135,30,138,52,97,71,116,56,210,208,185,167,184,43,58,16,105,200,220,147,223,25,29,133,52,84,238,41,236,142,14,71,26,58,247,20,119,72,7,34,13,153,123,242,187,164,163,144,134,202,61,133,157,210,225,72,67,231,158,226,110,233,64,164,33,115,79,126,199,116,20,210,80,185,167,176,107,58,28,105,232,220,83,220,57,29,136,52,100,238,201,239,158,142,66,26,42,247,20,118,80,135,35,13,157,123,138,187,168,3,145,134,204,61,249,157,212,81,72,67,229,158,194,110,234,8,164,177,250,169,115,145,38,238,168,142,64,90,88,79,117,22,210,248,93,213,163,144,198,232,171,30,138,52,97,103,117,56,210,208,185,167,184,187,58,16,105,200,220,147,223,97,29,133,52,84,238,41,236,178,14,71,26,58,247,20,119,90,7,34,13,153,123,242,187,173,163,144,134,202,61,133,29,215,225,72,67,231,158,226,174,235,64,164,33,115,79,126,231,117,20,210,80,185,167,176,251,58,28,105,232,220,83,220,129,29,136,52,100,238,201,239,194,142,66,26,42,247,20,118,98,135,35,13,157,123,138,187,177,3,145,134,204,61,249,29,217,81,72,67,229,158,194,174,236,8,164,177,250,178,115,145,38,238,204,142,64,90,88,111,118,22,210,248,221,217,163,144,198,232,207,30,138,52,97,135,118,56,210,208,185,167,184,75,59,16,105,200,220,147,223,169,29,133,52,84,238,41,236,214,14,71,26,58,247,20,119,108,7,34,13,153,123,242,187,182,163,144,134,202,61,133,157,219,225,72,67,231,158,226,238,237,64,164,33,115,79,126,7,119,20,210,80,185,167,176,139,59,28,105,232,220,83,220,201,29,136,52,100,238,201,239,230,142,66,26,42,247,20,118,116,135,35,13,157,123,138,187,186,3,145,134,204,61,249,157,221,81,72,67,229,158,194,238,238,8,164,177,250,187,115,145,38,238,240,142,64,90,88,143,119,22,210,248,93,222,163,144,198,232,243,30,138,52,97,167,119,56,210,208,185,167,184,219,59,16,105,200,220,147,223,241,29,133,52,84,238,41,236,250,14,71,26,58,247,20,119,126,7,34,13,153,123,242,187,191,163,144,134,202,61,133,29,224,225,72,67,231,158,226,46,240,64,164,33,115,79,126,39,120,20,210,80,185,167,176,27,60,28,105,232,220,83,220,17,30,136,52,100,238,201,239,10,143,66,26,42,247,20,118,134,135,35,13,157,123,138,187,195,3,145,134,204,61,249,29,226,81,72,67,229,158,194,46,241,108,164,117,92,95,200,218,196,191,250,79,27,2,94,140,160,246,34,190,77,188,135,17,101,163,23,188,54,241,54,78,154,209,27,130,100,196,64,106,242,1,195,224,180,137,183,240,121,83,235,139,32,41,31,70,67,158,116,106,47,100,109,226,217,72,147,182,137,135,32,45,168,77,60,15,105,236,54,241,113,72,11,111,19,31,140,52,89,155,120,8,210,56,109,226,217,72,147,182,137,135,32,45,168,77,60,15,105,236,54,241,113,72,11,111,19,31,140,52,89,155,120,8,210,56,109,226,249,209,83,216,38,30,19,61,67,218,196,51,163,39,183,77,124,100,244,12,110,19,31,30,61,69,109,226,241,72,35,10,132,113,72,99,148,10,145,72,243,151,110,69,72,11,47,221,194,144,198,183,12,137,180,56,123,68,34,141,40,16,198,33,141,81,42,68,34,205,95,186,21,33,45,188,116,11,67,26,223,50,36,210,226,236,17,137,52,162,64,24,135,52,70,169,16,137,52,127,233,86,132,180,240,210,45,12,105,124,203,144,72,139,179,71,36,210,136,2,97,28,210,24,165,66,36,210,252,165,91,17,210,194,75,183,48,164,241,45,67,34,45,206,30,145,72,35,10,132,113,72,99,148,10,145,72,243,151,110,69,72,11,47,221,194,144,198,183,12,137,180,56,123,8,234,105,140,54,241,252,122,154,176,77,60,166,158,22,210,38,158,89,
+79,227,182,137,143,172,167,5,183,137,15,175,167,137,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,135,32,141,211,38,158,141,52,105,155,120,8,210,130,218,196,243,144,198,110,19,31,135,180,240,54,241,193,72,147,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,15,65,26,167,77,60,27,105,210,54,241,16,164,5,181,137,231,33,141,221,38,62,14,105,225,109,226,131,145,38,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,130,52,78,155,120,54,210,164,109,226,33,72,11,106,19,207,67,26,187,77,124,28,210,194,219,196,7,35,77,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,4,105,156,54,241,108,164,73,219,196,67,144,22,212,38,158,135,52,118,155,248,56,164,133,183,137,15,70,154,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,62,210,58,174,159,200,218,196,255,96,61,40,224,147,17,212,62,137,111,19,239,97,68,217,232,19,94,155,120,27,39,205,232,13,65,50,98,32,53,249,128,97,112,218,196,255,96,59,50,224,147,33,212,62,145,183,137,119,146,39,157,218,39,178,54,241,108,164,73,219,196,67,144,22,212,38,158,135,52,118,155,248,56,164,133,183,137,15,70,154,172,77,60,4,105,156,54,241,108,164,73,219,196,67,144,22,212,38,158,135,52,118,155,248,56,164,133,183,137,15,70,154,172,77,60,4,105,156,54,241,252,232,41,108,19,143,137,158,33,109,226,153,209,147,219,38,62,50,122,6,183,137,15,143,158,162,54,241,120,164,17,5,194,56,164,49,74,133,72,164,249,75,183,34,164,133,151,110,97,72,227,91,134,68,90,156,61,34,145,70,20,8,227,144,198,40,21,34,145,230,47,221,138,144,22,94,186,133,33,141,111,25,18,105,113,246,136,68,26,81,32,140,67,26,163,84,136,68,154,191,116,43,66,90,120,233,22,134,52,190,101,72,164,197,217,35,18,105,68,129,48,14,105,140,82,33,18,105,254,210,173,8,105,225,165,91,24,210,248,150,33,145,22,103,143,72,164,17,5,194,56,164,49,74,133,72,164,249,75,
+183,34,164,133,151,110,97,72,227,91,134,68,90,156,61,4,245,52,70,155,120,126,61,77,216,38,30,83,79,11,105,19,207,172,167,113,219,196,71,214,211,130,219,196,135,215,211,68,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,67,144,198,105,19,207,70,154,180,77,60,4,105,65,109,226,121,72,99,183,137,143,67,90,120,155,248,96,164,201,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,135,32,141,211,38,158,141,52,105,155,120,8,210,130,218,196,243,144,198,110,19,31,135,180,240,54,241,193,72,147,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,15,65,26,167,77,60,27,105,210,54,241,16,164,5,181,137,231,33,141,221,38,62,14,105,225,109,226,131,145,38,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,130,52,78,155,120,54,210,164,109,226,33,72,11,106,19,207,67,26,187,77,124,28,210,194,219,196,7,35,77,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,31,105,29,215,245,221,125,64,159,120,149,156,140,88,126,243,215,191,77,120,126,250,236,179,207,63,123,86,108,111,52,26,190,252,236,197,139,207,94,14,161,231,101,102,29,107,12,99,202,134,181,52,206,62,242,108,206,103,198,111,70,44,220,61,222,185,44,222,116,99,163,70,129,209,101,55,162,16,77,134,245,157,151,15,153,116,154,38,184,220,125,232,19,32,57,172,47,125,38,36,91,250,212,3,145,236,234,33,143,70,50,209,26,63,53,146,67,250,218,103,66,178,187,207,125,2,36,135,245,189,207,132,100,75,31,124,32,146,93,61,234,209,72,38,90,239,167,70,114,72,223,252,76,72,118,247,209,79,177,186,8,234,171,159,107,117,49,237,179,143,92,93,56,122,224,195,87,23,254,214,254,201,87,23,1,125,249,231,64,242,160,66,155,26,201,206,218,109,94,36,155,181,245,52,72,142,210,106,32,146,93,229,252,140,72,134,217,19,129,228,65,5,56,53,146,157,181,225,188,72,54,107,247,105,144,28,165,213,64,36,187,30,23,100,68,50,204,158,8,36,15,42,204,169,145,
+236,172,61,231,69,178,249,108,32,13,146,163,180,26,136,100,215,227,136,140,72,134,217,19,129,228,65,5,59,53,146,157,181,237,188,72,54,159,61,164,65,114,148,86,3,145,236,122,220,145,17,201,48,123,34,144,60,168,144,167,70,178,179,118,158,23,201,230,179,141,52,72,142,210,106,32,146,93,143,83,50,34,25,102,79,105,61,217,121,14,67,138,122,114,208,185,12,185,234,201,211,115,26,144,245,100,199,25,10,240,122,178,255,104,136,228,245,228,128,115,29,230,64,114,234,218,69,216,185,15,121,145,156,168,118,225,58,163,33,17,146,231,170,93,132,156,27,49,7,146,83,215,46,194,206,149,200,139,228,68,181,11,215,25,16,137,144,60,87,237,34,228,92,138,57,144,156,186,118,17,118,110,69,94,36,39,170,93,184,206,152,72,132,228,185,106,23,33,231,94,204,129,228,212,181,139,176,115,49,242,34,57,81,237,194,117,134,69,34,36,207,85,187,8,57,87,99,14,36,167,174,93,132,157,187,145,23,201,137,106,23,174,51,50,18,33,121,174,218,69,200,185,29,153,144,236,62,199,35,1,146,195,206,245,200,132,100,203,57,31,64,36,187,206,224,64,35,153,56,90,36,53,146,67,206,5,153,3,201,169,107,23,97,231,134,228,69,114,162,218,133,235,140,143,68,72,158,171,118,17,114,238,200,28,72,78,93,187,8,59,151,36,47,146,19,213,46,92,103,136,36,66,242,92,181,139,144,115,77,230,64,114,234,218,69,216,185,39,121,145,156,168,118,225,58,163,36,17,146,231,170,93,132,156,155,50,7,146,83,215,46,194,206,85,201,139,228,68,181,11,215,25,40,137,144,60,87,237,34,228,92,150,57,144,156,186,118,17,118,110,75,94,36,39,170,93,184,206,88,73,132,228,185,106,23,33,231,190,100,66,178,251,28,152,4,72,14,59,23,38,19,146,45,231,196,0,145,236,58,195,5,141,100,226,104,154,212,72,14,57,87,102,14,36,167,174,93,132,157,59,147,23,201,137,106,23,174,51,98,18,33,121,174,218,69,200,185,53,115,32,57,117,237,34,236,92,155,188,72,78,84,187,112,157,65,147,8,201,115,213,46,66,206,197,153,3,201,169,107,23,97,231,230,228,69,114,162,218,133,235,140,155,68,72,158,171,118,17,114,238,206,28,72,78,93,187,8,59,151,39,47,146,19,213,46,92,103,232,36,66,242,92,181,139,144,115,125,230,64,114,234,218,69,216,185,63,121,145,156,168,118,225,58,163,39,17,146,231,170,93,132,156,27,148,9,201,238,115,132,18,32,57,236,92,161,76,72,182,156,51,4,68,178,235,12,32,52,146,137,163,141,82,35,57,228,92,162,57,144,156,186,118,17,118,110,81,94,36,39,170,93,184,206,24,74,132,228,185,106,23,33,231,30,205,129,228,212,181,139,176,115,145,242,34,57,81,237,194,117,134,81,34,36,207,85,187,8,57,87,105,14,36,167,174,93,132,157,187,148,23,201,137,106,23,174,51,146,18,33,121,174,218,69,200,185,77,115,32,57,117,237,34,236,92,167,188,72,78,84,187,112,157,193,148,8,201,115,213,46,66,206,133,154,3,201,169,107,23,97,231,70,229,69,114,162,218,133,235,140,167,68,72,158,171,118,17,114,238,84,38,36,187,207,161,74,128,228,176,115,169,50,33,217,114,78,21,16,201,174,51,164,208,72,38,142,198,74,141,228,144,115,173,230,64,114,234,218,69,216,185,87,121,145,156,168,118,225,58,163,42,17,146,231,170,93,132,156,155,53,7,146,83,215,46,194,206,213,202,139,228,68,181,11,215,25,88,137,144,60,87,237,34,228,92,174,57,144,156,186,118,17,118,110,87,94,36,39,170,93,184,206,216,74,132,228,185,106,23,33,231,126,205,129,228,212,181,139,176,115,193,242,34,57,81,237,194,117,134,87,34,36,207,85,187,8,57,87,108,14,36,167,174,93,132,157,59,150,23,201,137,106,23,174,51,194,18,33,121,174,218,69,200,185,101,9,144,220,73,113,93,86,239,202,114,127,214,198,106,255,225,234,217,63,47,119,135,193,199,183,91,243,163,231,60,181,175,95,253,242,191,95,189,250,161,151,237,235,51,131,226,245,143,133,18,163,248,203,247,197,118,191,222,61,156,182,143,165,161,12,129,24,129,71,188,241,68,162,140,22,42,103,253,215,156,138,170,255,90,150,138,26,145,102,196,146,77,128,133,170,40,63,126,134,172,179,170,101,44,220,213,233,131,34,87,
+29,183,235,145,152,143,207,134,31,159,243,160,212,145,181,201,251,230,89,45,239,155,231,197,197,225,88,60,110,215,101,241,88,30,79,171,39,62,53,202,36,229,41,55,86,234,64,48,50,134,18,8,206,89,213,45,64,241,2,20,221,72,189,108,92,219,100,252,253,42,122,145,88,30,74,183,12,229,246,94,122,245,120,123,49,124,22,163,86,174,166,48,235,213,110,173,46,234,5,88,41,38,171,219,178,56,220,20,251,195,254,211,253,118,87,60,174,118,15,138,248,225,198,189,72,117,240,27,169,35,142,183,155,205,147,226,162,94,156,23,117,209,41,136,133,86,237,254,225,238,186,60,178,185,13,7,133,231,76,134,94,67,158,246,177,68,54,163,90,158,15,164,48,106,51,172,92,70,157,14,106,94,163,182,21,250,108,70,181,148,202,83,24,181,25,86,46,163,78,7,53,175,81,219,98,117,54,163,90,170,198,41,140,218,12,43,151,81,167,131,154,215,168,109,221,54,155,81,45,5,212,20,70,109,134,149,203,168,211,65,205,107,212,182,132,153,205,168,150,90,98,10,163,54,195,202,101,212,233,160,102,48,170,90,121,119,11,183,109,229,92,144,175,15,123,197,178,58,109,111,247,171,221,149,250,181,151,101,189,58,85,197,205,241,112,167,105,21,213,65,255,115,89,52,87,22,229,241,168,86,230,135,125,113,80,183,223,236,14,239,204,204,97,200,58,36,47,96,138,97,29,125,168,108,87,251,67,125,5,67,61,180,68,52,11,134,26,132,10,112,153,223,220,136,38,210,123,85,74,205,239,218,28,22,39,6,214,252,180,122,104,137,104,22,8,243,251,21,224,48,255,96,247,150,68,239,138,128,208,252,206,29,85,113,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,31,108,121,146,232,93,17,16,154,223,185,13,41,78,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,131,125,66,18,189,43,2,66,243,59,247,238,196,137,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,127,176,185,70,162,119,69,64,104,126,231,134,151,56,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,15,118,164,72,244,174,8,8,205,239,220,37,18,39,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,254,104,189,43,2,66,243,107,214,48,243,247,98,64,205,31,97,143,94,34,154,5,192,252,132,2,92,43,255,234,24,185,228,174,142,210,149,191,98,141,91,249,119,98,96,87,254,180,122,104,137,104,22,136,149,191,95,1,3,243,87,165,181,174,49,218,155,55,210,123,85,250,202,13,85,25,166,226,33,235,144,45,130,76,49,34,204,95,149,222,178,143,93,46,90,34,154,5,67,13,66,5,184,204,239,121,255,48,76,239,109,185,65,96,254,192,119,2,153,98,96,205,79,171,135,150,136,102,129,48,191,95,1,14,243,251,94,218,11,210,251,185,220,192,55,127,232,139,116,76,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,251,222,116,11,210,251,185,220,192,55,127,232,219,103,76,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,251,94,15,11,210,251,185,220,192,55,127,232,43,91,76,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,251,222,169,10,210,251,185,220,192,55,127,232,123,78,76,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,251,94,68,10,210,251,185,220,192,55,127,232,203,65,76,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,71,235,253,92,110,224,155,223,89,239,136,19,3,106,254,8,123,244,18,209,44,0,230,39,20,224,90,249,155,117,13,209,146,187,45,55,8,86,254,174,122,71,156,24,216,149,63,173,30,90,34,154,5,98,229,239,87,128,105,126,149,36,216,234,26,58,5,113,235,93,253,234,41,55,232,142,44,33,42,30,177,182,141,59,82,12,185,249,213,205,190,178,143,67,46,90,34,154,5,67,13,66,5,184,204,111,212,53,100,122,111,202,13,18,243,59,234,29,145,98,96,205,79,171,135,150,136,102,129,48,191,95,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,
+222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,63,90,239,109,185,65,96,126,87,189,35,82,12,168,249,35,236,209,75,68,179,0,152,159,80,128,107,229,111,212,53,100,75,238,166,220,32,89,249,59,234,29,145,98,96,87,254,180,122,104,137,104,22,136,149,191,95,1,166,249,213,42,209,86,215,208,107,80,183,222,213,175,158,114,131,110,95,26,162,226,17,107,219,184,35,197,144,155,95,221,236,43,251,56,228,162,37,162,89,48,212,32,84,128,203,252,70,93,67,166,247,166,220,32,49,191,163,222,17,41,6,214,252,180,122,104,137,104,22,8,243,251,21,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,163,245,222,150,27,4,230,119,213,59,34,197,128,154,63,194,30,189,68,52,11,128,249,9,5,184,86,254,70,93,67,182,228,110,202,13,146,149,191,163,222,17,41,6,118,229,79,171,135,150,136,102,129,88,249,251,21,96,154,95,45,19,108,117,13,189,8,113,235,93,253,234,41,55,232,179,62,66,84,60,98,109,27,119,164,24,114,243,171,155,125,101,31,135,92,180,68,52,11,134,26,132,10,112,153,223,168,107,200,244,222,148,27,36,230,119,212,59,34,197,192,154,159,86,15,45,17,205,2,97,126,191,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,127,180,222,219,114,131,192,252,174,122,71,164,24,80,243,71,216,163,151,136,102,1,48,63,161,0,215,202,223,168,107,200,150,220,77,185,65,178,242,119,212,59,34,197,192,174,252,105,245,208,18,209,44,16,43,127,191,2,76,243,171,56,97,171,107,232,40,228,214,187,250,213,83,110,208,7,99,134,168,120,196,218,54,238,72,49,228,230,87,55,251,202,62,14,185,104,137,104,22,12,53,8,21,224,50,191,81,215,144,233,189,41,55,72,204,239,168,119,68,138,129,53,63,173,30,90,34,154,5,194,252,126,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,254,104,189,183,229,6,129,249,93,245,142,72,49,160,230,143,176,71,47,17,205,2,96,126,66,1,174,149,191,81,215,144,45,185,155,114,131,100,229,239,168,119,68,138,129,93,249,211,234,161,37,162,89,32,86,254,126,5,152,230,87,142,194,86,215,208,110,200,173,119,125,138,154,187,220,80,159,70,22,160,226,17,107,219,184,35,197,144,155,95,221,236,43,
+251,56,228,162,37,162,89,48,212,32,84,128,203,252,70,93,67,166,247,166,220,32,49,191,163,222,17,41,6,214,252,180,122,104,137,104,22,8,243,251,21,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,163,245,222,150,27,4,230,119,213,59,34,197,128,154,63,194,30,189,68,52,11,128,249,9,5,184,86,254,70,93,67,182,228,110,202,13,146,149,191,163,222,17,41,6,118,229,79,171,135,150,136,102,129,88,249,251,21,96,154,95,113,177,213,53,52,115,183,222,213,175,158,114,131,250,53,72,197,35,214,182,113,71,138,33,55,191,186,217,87,246,113,200,69,75,68,179,96,168,65,168,0,151,249,141,186,134,76,239,77,185,65,98,126,71,189,35,82,12,172,249,105,245,208,18,209,44,16,230,247,43,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,71,235,189,45,55,8,204,239,170,119,68,138,1,53,127,132,61,122,137,104,22,0,243,19,10,112,173,252,141,186,134,108,201,221,148,27,36,43,127,71,189,35,82,12,236,202,159,86,15,45,17,205,2,177,242,247,43,96,208,209,187,234,152,175,246,31,250,30,210,74,16,79,43,237,234,104,99,171,8,212,157,164,171,99,88,215,236,33,107,107,43,235,56,49,34,58,122,87,199,177,109,2,212,67,75,68,179,96,168,65,168,128,65,103,175,155,234,109,185,47,119,167,242,226,81,87,157,46,139,235,103,157,44,87,207,254,169,62,63,55,63,159,37,106,62,153,50,53,148,122,113,190,191,249,84,127,241,169,166,93,28,238,203,227,170,218,42,93,43,185,86,167,83,121,119,189,43,139,85,161,6,178,217,234,239,149,57,20,161,135,29,33,220,227,179,134,243,194,196,26,235,236,241,121,243,231,92,98,153,85,68,67,103,139,18,235,119,162,179,101,224,204,171,185,25,68,236,254,119,119,216,60,168,235,214,171,221,218,148,252,244,175,242,120,208,179,163,42,181,60,219,202,148,227,113,117,252,254,231,255,243,234,167,31,123,81,254,190,95,29,63,20,235,183,229,250,215,226,70,57,101,125,123,113,184,41,222,252,193,70,245,244,182,74,64,117,187,79,65,85,165,225,9,168,170,236,46,1,85,149,52,196,83,53,200,238,183,59,69,85,1,209,65,245,135,239,95,187,137,170,155,173,52,15,21,73,246,199,95,252,148,107,18,83,226,234,251,198,161,91,233,42,170,61,201,159,202,234,65,221,161,166,79,241,245,225,176,43,87,186,83,163,10,201,167,210,84,108,75,176,153,3,85,233,35,216,200,168,184,190,219,170,201,168,110,156,88,169,33,214,64,95,159,228,1,32,214,32,94,247,135,4,16,107,128,174,187,14,136,136,245,203,34,181,56,243,104,237,231,239,191,251,97,76,79,223,82,92,124,250,236,242,243,75,21,62,198,226,181,4,91,167,129,35,216,250,11,28,193,214,85,224,8,182,94,2,71,176,117,16,17,4,59,138,171,235,147,199,202,95,125,253,243,152,158,186,225,176,123,168,202,226,113,181,123,40,39,18,54,244,92,211,67,74,207,53,67,164,244,92,147,68,74,175,177,176,126,231,3,67,175,49,176,222,76,32,165,215,17,252,212,231,250,94,125,55,38,183,47,111,155,229,199,88,176,79,125,94,143,
+73,199,233,240,152,116,156,190,142,73,199,101,62,46,29,151,217,66,232,116,132,254,253,223,61,22,251,254,135,111,126,106,210,230,49,193,55,197,191,23,207,76,129,106,58,46,139,113,233,184,44,198,165,227,178,24,151,142,203,98,92,58,46,139,5,208,233,45,239,155,98,223,190,114,19,250,116,40,208,167,190,41,198,165,227,50,24,151,142,203,96,92,58,46,131,113,233,184,12,22,64,167,183,252,133,202,43,149,169,46,85,174,219,216,205,18,169,190,253,118,76,174,93,108,190,121,166,16,240,230,249,101,113,251,176,58,174,246,85,169,23,80,93,237,170,184,254,160,242,51,125,225,118,127,91,236,86,199,219,242,88,84,31,238,7,11,82,83,128,198,224,150,208,150,75,128,6,41,150,88,152,75,128,6,26,150,96,151,92,0,125,230,97,135,129,57,76,208,10,48,31,6,90,1,230,195,64,43,192,124,24,208,7,32,116,24,152,67,3,173,0,13,6,102,20,96,62,12,180,2,204,135,1,221,13,113,86,1,244,123,249,29,8,103,20,160,1,225,140,2,52,32,156,81,128,102,189,51,163,0,89,65,104,102,47,228,146,232,231,191,127,237,150,224,211,72,21,124,26,176,36,202,38,128,203,21,102,19,192,5,130,244,2,16,75,162,108,2,204,135,1,98,73,148,77,128,249,48,64,44,137,178,9,224,90,18,101,19,96,62,12,16,75,162,244,2,16,75,162,244,2,16,75,162,108,2,184,150,68,217,4,112,45,137,178,9,224,90,18,101,19,32,43,8,59,9,254,45,96,73,244,215,191,191,118,75,240,111,145,42,248,183,128,37,81,54,1,92,174,48,155,0,46,16,164,23,128,88,18,101,19,96,62,12,16,75,162,108,2,204,135,1,98,73,148,77,0,215,146,40,155,0,243,97,128,88,18,165,23,128,88,18,165,23,128,88,18,101,19,192,181,36,202,38,128,107,73,148,77,0,215,146,40,155,0,89,65,232,121,112,102,217,50,66,215,169,2,246,125,43,154,221,166,236,32,158,110,110,221,16,215,171,135,83,121,42,126,248,254,117,179,87,194,255,68,78,244,72,80,60,50,15,79,224,200,156,219,104,18,142,204,195,19,56,50,231,134,158,132,35,243,240,4,142,204,185,181,40,225,200,60,60,129,35,115,110,114,74,56,50,15,79,196,200,6,169,66,38,15,66,243,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,98,100,131,20,58,211,60,163,121,2,71,22,177,139,71,60,50,15,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,172,45,45,69,108,66,227,143,140,230,9,28,89,196,238,54,241,200,60,60,129,35,139,216,54,39,30,153,135,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,108,80,245,206,100,51,154,39,112,100,141,159,202,59,50,15,79,224,200,26,63,149,119,100,30,158,192,145,53,126,42,239,200,60,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,196,200,116,99,239,184,125,227,252,145,209,60,129,35,139,216,144,46,30,153,135,39,112,100,17,59,221,197,35,243,240,4,142,44,98,11,189,120,100,30,158,192,145,69,236,205,23,143,204,195,19,56,178,172,190,145,230,41,28,153,231,117,6,75,179,4,122,247,96,72,131,178,135,107,198,131,106,197,211,205,45,200,104,159,6,60,52,78,57,50,15,79,224,200,92,197,191,148,35,243,240,4,142,204,149,224,166,28,153,135,39,112,100,174,69,92,202,145,121,120,2,71,230,114,84,41,71,230,225,137,24,25,241,208,56,201,200,104,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,140,120,104,156,100,100,52,79,224,200,34,222,173,20,143,204,195,19,56,178,172,190,145,230,9,28,89,86,223,72,243,4,142,44,171,111,164,121,2,71,150,213,55,210,60,17,35,35,30,26,39,25,25,205,19,56,178,136,119,142,197,35,243,240,4,142,44,226,101,102,241,200,60,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,98,100,196,67,227,36,35,163,121,2,71,230,122,104,156,114,100,30,158,192,145,185,30,26,167,28,153,135,39,
+112,100,174,135,198,41,71,230,225,9,28,89,86,223,72,243,4,142,44,171,111,164,121,34,70,70,60,52,78,50,50,154,39,112,100,17,109,66,196,35,243,240,4,142,44,162,255,136,120,100,30,158,192,145,69,52,54,17,143,204,195,19,56,178,136,142,41,226,145,121,120,2,71,150,213,55,210,60,133,35,243,52,153,153,62,52,14,120,167,59,96,104,119,15,59,198,131,106,197,211,205,45,200,104,255,22,240,208,56,229,200,60,60,129,35,115,21,255,82,142,204,195,19,56,50,87,130,155,114,100,30,158,192,145,185,22,113,41,71,230,225,9,28,153,203,81,165,28,153,135,39,98,100,196,67,227,36,35,163,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,49,50,226,161,113,146,145,209,60,129,35,139,232,120,39,30,153,135,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,4,142,44,171,111,164,121,34,70,70,60,52,78,50,50,154,39,112,100,17,157,32,197,35,243,240,4,142,44,162,197,164,120,100,30,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,49,50,226,161,113,146,145,209,60,129,35,115,61,52,78,57,50,15,79,224,200,92,15,141,83,142,204,195,19,56,50,215,67,227,148,35,243,240,4,142,44,171,111,164,121,2,71,150,213,55,210,60,17,35,35,30,26,39,25,25,205,19,56,178,136,230,205,226,145,121,120,2,71,22,209,21,90,60,50,15,79,224,200,34,218,77,139,71,230,225,9,28,89,68,31,107,241,200,60,60,129,35,203,234,27,105,158,194,145,213,183,173,246,155,182,57,101,117,172,167,115,117,212,143,15,170,163,229,101,113,245,101,199,233,155,195,126,189,170,202,189,250,127,241,250,213,255,251,75,161,9,253,244,253,119,127,249,69,145,158,16,222,182,147,201,69,87,23,174,252,164,235,139,110,139,99,121,175,110,86,151,117,7,108,159,121,118,234,251,108,242,8,220,114,50,241,247,111,220,134,250,44,212,80,83,78,150,179,139,19,113,178,156,70,13,225,180,217,62,50,182,18,40,158,110,110,65,211,234,179,201,99,253,28,214,114,5,173,84,156,242,90,203,195,19,104,45,87,234,128,215,161,43,16,167,226,148,215,90,30,158,64,107,185,210,33,188,14,93,139,139,84,156,242,90,203,195,19,104,45,215,50,6,175,67,87,50,153,82,135,30,158,64,29,186,22,76,41,71,230,225,137,24,217,96,243,74,210,185,60,224,148,20,135,196,134,156,36,214,162,121,2,173,149,97,85,51,224,148,195,90,174,77,70,41,173,229,225,9,180,86,134,85,205,128,83,14,107,181,185,87,86,107,121,120,2,173,149,97,85,51,224,148,195,90,13,167,188,214,242,240,4,90,43,195,170,134,216,118,150,82,135,137,87,53,196,182,179,148,35,75,188,170,25,108,59,75,58,151,7,156,146,226,144,216,74,151,196,90,52,79,160,181,50,172,106,6,156,114,88,203,181,61,48,165,181,60,60,129,214,202,176,170,25,112,202,97,45,215,150,199,148,214,242,240,4,90,43,195,170,102,192,41,135,181,26,78,121,173,229,225,9,180,86,134,85,13,177,97,52,165,14,19,175,106,136,13,163,41,71,150,120,85,51,216,48,154,116,46,15,56,37,197,33,177,9,54,137,181,104,158,64,107,101,88,213,12,56,229,176,150,107,99,111,74,107,121,120,2,173,149,97,85,51,224,148,195,90,174,205,202,41,173,229,225,9,180,86,134,85,205,128,83,14,107,185,54,96,167,180,150,135,39,208,90,25,86,53,196,86,239,148,58,76,188,170,33,182,122,167,28,89,226,85,205,96,171,119,82,116,16,155,202,147,232,144,230,9,212,97,134,21,0,177,125,61,165,14,61,60,129,58,204,16,151,137,141,242,41,117,232,225,9,212,97,134,104,73,108,201,79,169,67,15,79,160,14,51,68,75,98,243,127,74,29,38,142,150,196,230,255,148,35,75,28,45,137,205,255,73,70,70,243,4,142,44,109,12,179,143,204,195,19,56,178,180,145,197,62,50,15,79,224,200,210,250,123,251,200,60,60,129,35,75,235,133,237,35,243,240,4,142,44,171,111,164,121,10,71,214,49,252,99,72,151,186,31,61,167,211,253,209,58,52,53,142,237,166,44,174,63,20,255,42,143,7,243,141,138,195,134,211,31,
+239,199,111,221,60,135,60,188,6,252,99,192,150,236,244,163,244,112,134,143,210,181,149,57,253,40,61,156,225,163,116,109,1,78,63,74,15,103,248,40,157,111,153,38,31,165,135,51,124,148,206,183,170,146,143,210,195,25,55,202,193,70,215,172,136,165,57,195,71,233,236,124,151,124,148,30,206,240,81,186,54,86,166,31,165,135,51,124,148,174,13,137,233,71,233,225,12,31,229,12,62,150,230,12,31,229,12,62,150,230,140,27,229,96,219,93,86,31,75,115,134,143,114,6,31,75,115,134,143,210,217,77,47,249,40,61,156,225,163,116,109,143,74,63,74,15,103,248,40,103,240,177,52,103,248,40,103,240,177,52,103,220,40,7,155,128,178,250,88,154,51,124,148,51,248,88,154,51,124,148,51,248,88,154,51,124,148,206,14,125,201,71,233,225,12,31,229,12,62,150,230,12,31,229,12,62,150,230,140,27,37,213,197,47,221,40,105,206,240,81,58,59,250,37,31,165,135,51,124,148,206,238,126,201,71,233,225,12,31,165,179,211,95,242,81,122,56,195,71,57,131,143,165,57,195,71,57,131,143,165,57,227,70,73,117,3,76,55,74,154,51,124,148,206,206,128,201,71,233,225,12,31,165,179,75,96,242,81,122,56,195,71,233,236,24,152,124,148,30,206,240,81,58,187,7,38,31,165,135,51,124,148,51,248,88,154,115,212,40,59,182,171,253,166,126,196,182,109,22,148,219,250,161,240,118,28,184,190,250,193,202,78,125,173,24,154,90,59,147,243,239,23,224,146,35,30,26,113,201,17,149,67,46,57,34,125,36,201,117,244,218,167,157,126,83,252,248,147,141,218,143,63,141,100,11,218,183,193,162,69,24,129,69,139,176,0,139,22,161,126,130,86,71,236,125,144,246,255,97,39,247,143,137,108,239,131,12,192,37,71,216,128,75,142,48,3,151,28,97,9,146,92,71,239,203,47,3,116,247,250,231,191,184,157,239,151,95,214,158,240,184,218,158,74,99,39,215,67,165,27,160,30,87,251,219,178,56,149,235,195,126,83,28,238,75,245,121,99,120,226,221,233,45,99,239,147,18,195,35,128,135,163,55,250,12,52,224,218,144,148,89,3,30,49,82,107,192,181,89,41,179,6,60,98,164,214,128,107,35,83,102,13,120,196,72,166,1,162,247,92,46,13,208,98,164,214,128,203,237,103,214,128,71,140,212,26,112,109,168,201,172,1,143,24,169,53,224,218,108,147,89,3,30,49,146,105,128,232,214,148,75,3,180,24,169,53,224,234,128,148,89,3,30,49,82,107,192,181,98,205,172,1,143,24,169,53,224,218,16,146,89,3,30,49,146,105,128,232,111,146,75,3,180,24,169,53,224,234,25,146,89,3,30,49,82,107,192,213,135,35,179,6,60,98,164,214,128,43,217,206,172,1,143,24,64,13,116,66,188,124,25,144,153,255,228,83,193,203,151,114,21,28,89,5,130,159,236,42,104,5,144,130,96,160,1,87,102,158,89,3,30,49,82,107,192,149,153,103,214,128,71,140,212,26,112,101,230,153,53,224,17,35,153,6,136,204,60,151,6,104,49,82,107,192,149,153,103,214,128,71,140,212,26,112,101,230,153,53,224,17,35,181,6,92,153,121,102,13,120,196,72,166,1,34,51,207,165,1,90,140,212,26,112,101,230,153,53,224,17,35,181,6,92,153,121,102,13,120,196,72,173,1,87,102,158,89,3,30,49,146,105,128,200,204,115,105,128,22,35,181,6,92,153,121,102,13,120,196,72,173,1,87,102,158,89,3,30,49,82,107,192,149,153,103,214,128,71,12,160,6,250,26,73,192,94,142,215,191,88,75,19,163,189,13,95,78,142,122,141,162,116,216,110,52,37,245,79,44,165,97,217,1,64,169,77,223,1,148,218,52,24,64,169,77,39,1,148,154,253,130,8,74,205,158,188,56,60,13,122,61,0,40,1,108,55,72,93,16,148,0,182,27,188,123,143,160,4,176,221,240,29,114,0,37,128,237,6,203,77,4,37,128,237,6,239,244,34,40,1,108,55,124,55,21,64,9,96,187,193,18,1,65,9,96,187,193,187,130,8,74,0,219,13,222,121,67,80,2,216,110,240,238,22,130,18,192,118,131,119,144,16,148,0,182,27,188,75,131,160,4,176,221,224,157,16,4,37,128,237,6,239,54,32,40,201,108,215,147,122,17,178,142,126,101,165,245,98,44,214,139,144,149,52,135,22,181,150,230,208,162,86,211,2,90,78,140,10,104,57,81,42,160,229,196,
+169,128,150,19,169,2,90,78,172,178,240,69,172,172,5,180,32,118,164,86,215,2,90,16,59,82,43,108,1,45,136,29,169,85,182,128,22,196,142,212,74,91,64,11,98,71,106,181,45,160,5,177,35,181,226,22,208,130,216,145,90,117,11,104,65,236,72,173,188,5,180,32,118,164,86,223,2,90,16,59,82,43,112,1,45,136,29,169,85,184,128,22,196,142,212,74,92,64,11,98,71,106,53,46,160,5,177,35,181,34,23,208,18,218,177,47,239,7,172,201,191,179,174,239,95,142,196,122,25,176,34,103,80,34,214,227,12,74,196,106,156,79,201,133,81,62,37,23,66,249,148,92,248,228,83,114,161,147,79,201,133,77,14,158,252,43,112,62,37,128,237,136,213,55,159,18,192,118,196,202,155,79,9,96,59,98,213,205,167,4,176,29,177,226,230,83,2,216,142,88,109,243,41,1,108,71,172,180,249,148,0,182,35,86,217,124,74,0,219,17,43,108,62,37,128,237,136,213,53,159,18,192,118,196,202,154,79,9,96,59,98,85,205,167,4,176,29,177,162,230,83,2,216,142,88,77,243,41,1,108,71,172,164,249,148,100,182,235,73,133,212,182,191,179,174,201,95,142,215,247,47,67,106,219,44,90,212,90,154,67,139,90,77,11,104,57,49,42,160,229,68,169,128,150,19,167,2,90,78,164,10,104,57,177,202,194,23,177,178,22,208,130,216,145,90,93,11,104,65,236,72,173,176,5,180,32,118,164,86,217,2,90,16,59,82,43,109,1,45,136,29,169,213,182,128,22,196,142,212,138,91,64,11,98,71,106,213,45,160,5,177,35,181,242,22,208,130,216,145,90,125,11,104,65,236,72,173,192,5,180,32,118,164,86,225,2,90,16,59,82,43,113,1,45,136,29,169,213,184,128,22,196,142,212,138,92,64,75,104,199,142,216,139,144,69,249,171,255,180,17,123,49,22,236,69,200,162,156,69,139,88,148,179,104,17,139,114,9,45,23,88,37,180,92,96,149,208,114,129,85,66,203,5,86,9,45,23,88,121,248,242,47,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,18,218,177,35,246,73,200,162,252,7,235,10,255,147,177,96,159,132,44,202,89,180,136,69,57,139,22,177,40,151,208,114,129,85,66,203,5,86,9,45,23,88,37,180,92,96,149,208,114,129,149,135,47,255,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,161,29,59,98,235,187,251,233,170,124,210,118,241,155,191,254,109,66,238,211,103,159,125,254,217,179,98,123,83,111,47,255,236,197,139,207,198,187,108,90,218,195,85,58,150,246,112,213,142,165,77,52,100,69,208,118,181,58,69,208,118,53,17,69,208,118,181,231,68,208,110,103,71,18,218,237,108,1,227,123,144,37,36,161,157,4,39,195,44,34,9,237,36,56,25,102,25,73,104,39,193,201,48,11,73,66,59,9,78,134,89,74,18,218,73,112,50,204,98,146,208,78,130,147,97,150,147,132,118,18,156,12,179,160,36,180,147,224,100,152,37,37,161,157,4,39,195,44,42,9,237,36,56,25,102,89,73,104,39,193,201,48,11,75,66,59,9,78,134,89,90,18,218,73,112,50,204,226,146,208,78,130,147,97,150,151,132,54,6,39,29,241,235,178,122,87,150,251,139,235,63,175,246,31,174,158,93,238,14,237,31,111,183,205,31,214,20,243,235,87,191,252,239,87,175,126,232,25,126,125,38,84,188,254,81,159,106,91,252,229,251,98,187,95,239,30,78,219,199,65,103,209,246,178,171,211,7,117,103,117,220,174,59,206,106,136,237,31,207,105,206,221,237,54,17,212,96,181,8,111,158,23,23,135,99,241,184,93,151,197,99,121,60,173,158,216,69,122,84,
+41,228,197,227,159,31,155,76,82,255,51,86,237,143,63,188,121,245,147,241,78,200,55,171,83,85,188,249,234,245,223,95,21,213,161,190,223,66,175,73,168,113,228,234,57,12,35,215,76,91,24,185,102,166,194,200,53,147,19,70,174,153,143,48,114,205,20,132,145,3,227,174,41,182,200,201,245,83,117,91,245,211,98,58,19,9,114,234,134,193,188,175,137,185,30,253,138,104,57,74,143,18,90,174,210,163,132,150,171,244,40,161,229,42,61,74,104,185,74,143,18,90,174,210,163,132,22,18,95,174,237,0,97,180,122,98,85,105,32,127,26,106,9,106,213,48,226,213,196,156,229,85,9,45,215,114,78,64,203,185,124,19,208,114,46,215,4,180,156,203,51,1,45,231,114,76,64,203,185,252,18,208,66,226,203,89,98,15,162,213,17,83,112,232,145,63,61,123,133,160,166,110,48,37,107,136,53,200,7,209,114,156,140,36,161,229,58,99,72,66,203,117,90,143,132,150,235,220,27,9,173,6,249,24,90,13,242,49,180,144,248,106,144,47,165,213,17,83,38,236,145,63,61,109,132,160,166,110,48,37,107,136,53,200,7,209,114,156,5,36,161,229,58,85,71,66,203,117,62,141,132,150,235,164,23,9,173,6,249,24,90,13,242,49,180,144,248,106,144,47,165,213,159,199,185,191,237,145,63,61,95,131,160,166,110,48,37,107,136,53,200,7,209,114,156,126,35,161,229,58,71,70,66,203,117,34,139,132,150,235,108,19,9,173,6,249,24,90,13,242,49,180,144,248,106,144,47,165,213,17,83,170,234,145,175,62,240,168,169,27,76,201,26,98,13,242,65,180,106,228,99,104,53,200,199,208,106,144,143,161,213,32,31,67,171,65,62,134,86,131,124,12,45,36,190,26,228,75,105,117,196,212,240,122,228,171,15,60,106,234,6,83,178,134,88,131,124,16,173,26,249,24,90,13,242,49,180,26,228,99,104,53,200,199,208,106,144,143,161,213,32,31,67,11,137,175,6,249,82,90,29,177,65,177,159,93,36,29,149,92,205,74,63,136,86,141,124,12,173,6,249,24,90,13,242,49,180,26,228,99,104,53,200,199,208,106,144,143,161,133,196,87,131,124,41,173,62,93,174,142,138,216,106,255,65,167,203,213,145,153,46,87,199,1,177,187,237,254,162,123,98,87,24,143,236,234,127,123,218,95,189,254,70,93,58,121,50,169,190,211,199,242,117,79,234,204,65,171,223,174,246,135,171,253,118,199,224,208,222,65,50,186,44,182,183,251,195,113,187,191,45,212,229,205,185,127,167,1,247,213,251,96,182,171,247,83,126,171,247,238,129,173,222,115,7,214,221,65,50,114,14,76,223,168,47,185,175,205,127,95,99,233,222,101,126,253,131,3,1,247,13,2,186,20,244,166,122,91,238,203,221,169,188,184,174,247,16,87,237,136,110,218,241,88,134,115,122,183,173,214,111,117,121,190,227,241,253,77,203,97,123,42,170,227,67,89,28,155,225,253,245,251,111,191,125,253,170,208,244,139,159,190,255,238,47,191,152,67,217,149,251,219,234,237,197,201,158,1,171,47,155,11,122,46,175,235,207,90,95,63,255,242,211,247,63,124,167,137,221,29,54,15,187,178,88,221,222,30,205,154,210,195,157,30,207,170,250,191,218,21,255,115,90,83,253,250,171,95,212,53,166,146,118,235,135,221,170,106,40,149,183,250,47,117,129,230,245,245,83,227,80,203,17,225,75,101,164,171,237,205,85,121,119,95,125,176,63,29,64,113,58,53,127,43,119,16,57,156,66,153,239,109,177,86,22,216,110,244,247,187,237,169,10,100,12,30,174,75,18,143,25,71,5,194,132,102,76,196,105,104,198,8,38,96,51,38,144,196,99,198,209,92,79,104,198,68,156,134,102,140,96,2,54,99,2,73,60,102,28,149,110,18,154,49,17,167,161,25,35,152,128,205,152,64,18,143,25,71,217,88,66,51,38,226,52,52,99,4,19,176,25,19,72,98,19,69,249,238,52,177,81,19,206,19,27,107,78,115,196,198,49,227,25,99,99,107,70,124,196,114,153,49,17,167,57,98,99,136,25,51,197,198,214,140,248,136,229,50,99,34,78,115,196,198,16,51,102,138,141,173,25,241,17,203,101,198,68,156,230,136,141,33,102,204,20,27,213,164,79,227,84,53,225,60,78,181,230,52,135,83,29,51,158,209,169,182,102,196,187,58,151,25,19,113,154,195,169,134,152,49,147,83,109,205,136,119,117,46,51,38,226,52,135,83,
+13,49,99,38,167,170,208,146,102,54,106,194,121,102,99,205,105,142,217,56,102,60,227,108,108,205,136,159,35,46,51,38,226,52,199,108,12,49,99,166,217,120,179,171,157,234,104,55,9,64,185,154,176,109,92,137,56,13,205,24,193,132,97,198,49,99,240,112,5,102,196,207,17,151,25,19,113,154,99,54,134,152,49,211,108,84,108,210,152,81,19,206,99,198,154,211,28,102,28,51,206,109,198,251,227,97,67,62,55,214,23,249,249,233,43,30,214,213,68,197,99,242,97,143,83,129,252,168,103,200,60,86,148,97,125,236,83,12,93,98,222,105,105,55,173,121,147,242,163,234,231,243,154,55,149,60,62,243,78,171,19,105,205,155,148,31,85,2,154,215,188,169,228,241,153,119,154,39,165,53,111,82,126,84,50,58,175,121,83,201,227,51,239,52,212,167,53,111,82,126,212,122,106,94,243,166,146,199,42,144,243,121,53,70,221,225,79,173,129,252,230,139,189,178,39,216,233,205,155,42,22,134,63,205,78,102,222,156,177,87,246,100,59,189,121,83,197,194,240,167,220,201,204,155,51,246,202,158,120,167,55,111,170,88,24,254,244,59,153,121,115,198,94,217,147,240,132,230,117,62,15,199,168,59,252,169,56,144,223,124,206,89,246,132,60,189,121,83,57,203,240,167,229,201,204,155,211,57,203,158,156,167,55,111,42,103,25,254,20,61,153,121,115,58,103,217,19,245,132,230,117,62,87,199,168,59,252,233,58,144,223,124,179,87,246,164,61,189,121,83,205,166,240,167,238,201,204,155,115,246,202,158,192,39,52,175,243,57,60,70,221,225,79,227,129,252,168,103,242,233,204,43,123,50,159,222,188,169,102,83,248,83,250,100,230,205,57,123,101,79,236,19,154,215,249,220,30,163,238,240,167,247,64,126,243,153,87,246,36,31,100,222,225,255,218,55,196,149,40,167,223,118,95,156,63,214,127,27,77,21,86,199,234,226,73,221,80,164,232,132,250,249,63,95,159,212,191,219,131,209,249,224,231,250,229,247,250,77,250,227,97,173,127,221,223,234,11,53,137,170,212,215,12,250,16,212,132,159,183,148,45,132,159,19,148,239,143,165,186,224,126,187,43,55,90,100,7,151,237,126,91,89,120,232,175,95,237,31,183,199,195,94,223,98,188,174,175,126,216,174,118,219,127,149,69,245,182,44,202,254,154,226,230,112,44,254,250,213,235,65,195,131,199,181,34,110,166,177,138,182,250,178,167,247,93,89,213,132,238,30,118,213,86,55,105,87,35,83,134,169,86,187,195,109,177,62,236,171,242,125,245,180,248,248,135,178,220,168,113,104,22,235,195,81,141,172,234,199,83,108,202,251,114,191,41,247,235,109,121,250,248,98,91,91,232,233,195,189,182,236,101,113,122,123,120,216,109,138,107,5,133,27,37,83,253,219,245,118,191,81,35,215,244,215,15,138,154,162,81,190,47,215,15,149,98,254,68,203,255,176,63,173,110,20,100,218,97,84,199,149,250,98,173,127,190,120,98,14,197,248,193,52,135,182,92,177,218,23,171,135,234,160,191,221,86,38,137,65,107,255,250,215,33,209,230,187,158,220,47,199,237,237,173,146,92,171,169,165,118,184,47,143,43,77,171,214,200,74,171,189,184,222,29,214,191,154,180,87,215,135,227,136,116,253,149,157,114,253,147,159,112,71,185,124,92,237,46,214,119,155,186,253,130,5,249,103,203,24,19,178,65,98,221,170,162,81,181,250,187,208,56,109,38,84,111,77,195,43,152,108,46,139,195,67,117,255,80,213,14,0,204,178,184,208,215,28,238,245,184,87,187,15,197,169,212,31,107,118,133,210,132,214,78,251,73,9,82,174,238,158,12,39,208,122,247,176,41,47,110,246,171,187,210,161,144,246,26,82,182,193,44,61,179,190,81,23,154,12,181,86,190,218,221,150,215,199,149,161,28,37,252,157,154,148,189,122,58,254,63,125,197,85,206,159,142,229,110,213,40,163,88,53,156,254,52,48,80,39,139,114,173,202,115,150,199,11,229,26,27,65,58,53,92,170,31,119,87,167,234,174,106,62,157,182,183,141,118,76,111,96,200,246,124,42,156,30,189,33,138,97,175,154,244,157,138,4,90,254,179,16,133,154,24,171,83,113,167,46,189,121,216,215,83,237,178,80,130,61,173,101,186,80,2,236,87,213,195,177,124,98,118,18,185,217,61,156,222,94,41,103,115,81,140,155,230,43,195,117,191,246,194,213,95,213,162,105,15,181,63,188,27,76,185,211,
+169,84,115,174,233,135,114,119,186,237,241,48,152,133,245,85,166,15,220,235,89,167,173,161,140,177,46,107,32,22,239,222,150,251,226,250,197,11,221,20,197,152,20,29,11,125,12,21,193,226,251,125,32,151,79,94,124,110,99,161,79,48,34,88,188,222,223,114,88,244,209,173,172,222,172,142,219,213,245,174,188,80,1,161,30,77,241,184,58,246,240,169,27,216,52,61,100,138,33,106,140,123,13,167,219,6,146,250,54,29,228,21,156,155,64,169,201,214,23,155,252,111,9,254,197,184,125,205,173,141,233,119,97,76,71,225,68,1,71,79,234,11,253,31,151,215,80,50,93,181,215,245,236,94,237,53,197,207,54,219,147,254,183,56,173,30,117,160,215,2,12,253,153,10,54,235,97,83,163,189,10,163,87,181,148,23,197,169,215,241,169,252,237,65,197,205,243,136,205,146,134,22,160,191,171,151,161,109,207,163,153,234,159,251,161,215,98,180,244,6,237,201,235,213,211,211,169,4,205,83,142,234,248,207,177,28,69,159,165,15,196,81,223,98,68,82,182,228,43,163,187,201,202,248,188,142,112,242,30,97,64,145,173,23,142,46,1,46,155,245,159,150,194,34,75,123,247,149,186,195,148,166,254,114,192,185,89,232,54,66,213,191,14,34,137,94,81,235,181,208,118,243,190,159,4,167,245,219,242,110,213,200,80,105,156,53,127,170,203,202,247,205,159,171,181,94,99,214,29,225,26,75,213,51,101,100,43,117,253,149,162,171,109,246,238,184,186,255,194,56,168,161,251,37,53,83,227,108,32,189,226,211,138,249,83,195,233,105,205,228,105,77,255,79,133,202,31,26,69,53,76,138,95,213,247,127,254,248,163,207,139,79,21,122,79,101,35,209,199,31,61,83,159,183,123,237,245,78,31,127,244,92,125,104,214,152,39,176,78,47,30,182,27,35,253,121,80,214,51,71,252,36,155,158,163,4,249,93,234,254,82,205,79,53,173,246,199,230,195,254,120,165,63,207,7,117,136,60,255,191,179,196,82,38,72,50,25,231,180,24,169,138,245,97,247,112,183,31,235,162,32,240,56,85,125,66,70,164,254,26,210,11,83,32,31,50,64,165,202,152,255,30,21,237,153,181,217,64,28,41,3,75,237,154,242,182,73,196,126,7,6,152,113,18,36,144,43,231,252,56,87,52,54,229,174,90,93,232,49,246,2,254,135,202,177,134,3,40,134,35,208,23,40,194,230,23,197,147,143,63,250,104,240,69,55,198,111,95,189,254,229,43,245,203,164,39,109,51,28,157,242,53,163,169,101,249,211,169,88,221,223,239,182,229,230,233,160,29,237,241,240,223,229,186,106,197,61,149,59,245,193,20,16,48,128,194,35,126,203,62,106,8,167,135,235,177,182,91,217,213,175,3,89,93,162,55,159,59,193,245,199,78,108,253,97,40,179,226,55,145,183,171,218,105,137,85,222,217,40,178,108,113,240,20,128,12,175,26,213,47,207,23,5,131,16,163,63,95,128,213,189,86,126,30,99,230,118,144,19,241,6,31,142,132,36,202,33,237,202,155,106,50,75,94,235,150,208,167,170,188,111,170,93,250,26,93,28,47,143,197,127,31,182,123,5,229,242,204,191,246,118,219,253,190,253,169,184,216,93,30,159,20,135,199,246,121,67,125,231,118,95,87,213,183,155,178,184,80,210,62,249,67,63,10,93,111,107,30,7,93,172,149,9,246,149,82,102,157,246,88,234,50,237,133,19,165,105,62,202,63,174,106,23,122,126,184,164,152,41,98,55,91,37,71,243,140,163,33,63,120,186,171,204,94,14,226,72,95,164,169,250,63,215,253,159,122,6,235,198,234,131,58,165,150,174,161,52,10,6,95,213,95,234,231,117,205,51,157,26,123,53,225,167,53,205,226,226,254,112,58,109,175,119,31,186,194,126,125,245,177,188,223,173,214,101,171,89,29,6,206,112,48,110,126,90,52,163,63,245,69,160,253,195,221,117,59,220,195,113,163,254,234,158,152,149,131,97,55,209,132,49,236,227,118,83,143,251,82,223,106,87,64,67,115,164,128,191,215,95,246,165,211,211,185,98,54,213,5,111,56,182,167,119,235,93,185,58,94,213,17,244,194,54,162,209,94,46,45,180,113,203,72,242,111,244,47,181,168,85,83,131,173,101,108,228,53,85,169,224,122,81,120,21,249,196,112,249,131,103,138,219,141,101,246,183,138,169,157,83,171,182,173,194,196,195,189,146,161,71,244,73,215,238,15,235,237,74,123,134,238,90,171,164,225,
+130,6,44,86,131,6,209,137,114,210,76,219,17,61,181,24,76,185,180,146,134,225,181,29,111,205,205,35,171,125,91,127,169,212,120,60,188,43,110,142,135,59,245,103,179,0,11,71,87,59,87,166,117,220,135,93,245,115,89,93,84,215,187,118,69,89,85,199,86,218,251,86,214,93,185,63,47,72,87,106,17,90,255,89,174,119,171,243,194,83,71,134,230,92,6,173,212,193,120,244,29,10,139,245,52,25,141,234,111,202,31,172,142,229,121,44,173,44,250,241,72,45,125,61,159,106,223,166,135,188,175,62,85,163,160,135,96,84,229,235,129,24,159,245,112,140,143,122,80,198,102,216,122,100,253,103,109,223,218,55,60,125,250,212,54,46,101,137,171,134,115,252,168,50,15,234,188,190,248,167,99,104,141,223,136,28,220,86,207,131,155,149,254,245,155,159,223,232,95,239,86,149,101,160,229,251,251,131,154,157,141,123,51,158,190,222,156,31,188,106,145,203,251,243,35,217,117,247,247,111,42,108,55,127,237,31,118,187,227,249,235,156,24,104,101,215,80,96,171,233,155,31,255,246,95,197,247,63,252,242,99,251,80,94,169,230,119,167,25,10,72,230,8,32,26,154,122,90,229,132,142,229,230,151,90,71,69,255,240,211,34,204,249,90,66,156,243,101,141,92,127,248,162,152,50,173,190,169,93,255,197,177,245,126,134,83,55,60,253,135,251,178,255,180,217,222,110,171,211,200,135,142,31,216,91,164,108,130,76,91,35,152,8,114,60,220,127,235,214,192,244,129,172,190,193,175,7,125,69,152,18,198,188,79,138,249,177,137,169,129,172,79,54,222,149,250,255,126,196,255,84,11,96,114,190,210,27,36,212,210,236,246,184,218,148,87,7,149,17,125,254,236,255,185,104,87,216,195,247,142,254,254,183,239,186,59,140,128,90,243,210,187,83,218,157,22,253,34,100,83,92,127,80,159,148,45,251,61,91,250,202,31,27,46,69,203,117,176,11,74,193,83,197,108,171,80,125,240,191,177,156,246,162,164,51,110,54,150,105,245,151,67,9,55,229,105,125,220,94,55,2,222,8,228,123,220,150,239,60,242,61,122,229,211,55,91,229,211,63,8,100,179,58,187,31,207,219,183,46,108,115,163,117,39,221,30,175,17,126,94,213,63,159,61,137,206,49,235,74,213,103,198,214,181,66,173,145,142,219,22,80,35,9,86,55,55,117,70,250,211,225,221,169,95,187,41,76,79,79,245,173,19,163,246,114,237,253,199,72,110,4,109,30,232,55,171,49,157,108,182,55,232,53,220,73,171,201,124,236,174,229,250,96,91,251,31,238,63,92,233,5,223,69,81,233,67,143,46,139,143,63,234,125,126,247,215,169,251,107,127,154,236,99,106,134,112,169,100,184,81,238,181,249,91,111,137,43,55,205,16,175,203,83,213,252,117,243,174,197,232,197,208,181,15,6,190,189,115,58,245,239,235,159,58,159,94,47,84,175,27,231,93,156,250,245,252,199,31,221,110,31,203,125,187,250,175,75,18,101,109,211,131,74,0,46,212,223,159,233,145,233,84,232,163,137,145,154,196,86,15,162,142,57,62,65,219,212,85,239,223,24,201,249,203,219,237,73,159,215,164,147,207,245,225,97,95,29,63,124,114,222,61,219,109,240,169,203,21,23,239,235,66,204,115,163,168,253,252,159,227,38,92,245,149,83,219,53,138,106,29,179,61,7,232,172,164,132,47,158,248,6,115,189,221,115,53,127,222,124,167,116,90,243,25,236,27,251,87,121,60,92,29,142,87,135,125,57,170,168,61,251,231,228,36,47,227,226,158,229,246,70,223,87,239,113,93,169,100,94,205,96,53,199,116,198,191,63,239,39,234,182,151,108,79,79,139,239,247,107,93,197,80,19,225,238,160,2,237,113,181,61,141,246,89,213,71,101,181,247,236,183,245,161,135,219,253,110,187,55,92,160,222,136,115,122,184,30,8,127,109,138,126,89,220,222,155,101,162,219,243,162,166,249,216,28,69,118,110,186,213,223,166,144,118,113,123,89,94,190,85,95,191,40,110,143,135,135,251,167,245,127,47,110,239,159,168,31,239,244,215,122,43,246,83,125,186,218,91,253,213,250,115,253,157,10,229,235,167,219,147,62,17,237,174,249,246,89,247,245,254,80,93,172,63,175,191,237,191,124,121,113,119,249,172,118,41,245,247,253,15,202,40,234,234,103,151,235,103,250,23,61,208,118,27,155,186,232,178,248,195,243,103,159,127,254,249,39,198,192,255,172,110,59,110,
+182,123,149,71,87,31,148,19,62,52,251,12,155,229,133,74,241,149,15,58,182,91,185,212,159,181,231,249,131,166,220,42,216,160,164,69,184,254,226,99,93,209,153,234,215,128,204,106,183,163,161,162,55,214,237,118,121,81,98,133,73,45,237,255,96,35,20,27,133,9,14,165,187,17,40,212,55,6,18,148,244,87,15,251,237,111,15,253,244,59,23,98,183,198,170,187,191,172,232,1,161,98,242,250,215,98,123,211,150,83,182,187,226,164,60,151,94,56,40,103,124,93,108,14,229,105,255,167,170,120,187,122,44,139,246,230,250,170,246,60,192,194,16,227,92,91,60,158,46,206,190,179,206,93,172,127,62,49,119,66,254,109,123,95,126,211,108,210,55,15,171,60,211,107,139,126,167,225,230,243,158,93,83,254,51,235,173,199,219,159,202,245,225,184,185,120,50,56,153,82,207,134,243,79,198,174,75,13,251,234,160,228,120,123,222,22,175,244,171,183,66,26,27,238,166,164,87,231,76,20,197,162,143,117,191,237,174,206,251,61,213,160,123,165,245,91,86,205,43,172,27,8,155,192,83,199,248,241,22,210,193,211,215,205,195,221,253,213,122,165,96,160,140,86,47,123,12,115,213,193,216,120,223,187,227,223,223,101,228,11,234,187,182,232,186,175,244,55,109,13,182,38,90,212,23,79,24,43,27,94,233,125,166,26,49,199,242,221,113,91,149,193,236,187,123,45,34,116,216,40,90,170,245,110,214,237,169,218,174,167,163,175,183,183,42,1,62,254,168,84,203,32,131,225,165,154,246,187,95,13,129,62,254,232,126,61,248,88,189,85,139,169,205,224,14,197,226,215,147,241,94,168,154,197,167,211,95,191,30,124,243,120,55,250,66,83,25,222,84,75,61,252,234,110,187,191,217,85,195,175,86,255,61,254,106,255,184,62,189,27,124,83,111,154,183,76,188,126,240,22,13,214,223,59,180,182,210,175,53,252,171,188,80,2,41,31,219,102,209,171,59,181,122,172,189,229,48,83,208,80,109,111,248,34,144,66,253,160,221,178,75,60,134,84,83,111,73,68,179,121,172,232,37,110,125,88,209,61,76,234,245,124,78,241,205,23,183,14,199,213,109,3,208,118,3,194,0,130,245,62,4,243,155,118,59,194,224,162,15,247,195,107,238,14,155,225,23,42,3,169,131,210,136,82,55,1,91,44,169,164,224,238,221,118,83,189,29,206,146,154,227,169,126,97,196,184,248,109,185,186,31,126,177,58,189,29,129,250,94,127,215,118,135,219,214,196,212,178,250,168,232,14,47,107,130,210,224,186,99,249,104,249,246,215,242,195,224,115,93,115,223,110,222,27,239,189,15,204,211,106,119,226,67,87,3,15,218,92,84,168,9,88,215,77,181,55,181,153,168,203,42,254,199,86,139,178,85,243,96,182,222,185,164,223,227,60,182,165,8,191,13,205,103,107,255,99,206,69,155,211,233,51,137,39,206,255,99,215,101,219,181,81,194,180,116,218,72,160,55,45,95,156,67,241,57,18,159,3,241,64,162,241,93,230,251,199,42,244,238,171,237,57,34,55,143,104,235,139,244,11,147,43,139,8,186,124,205,21,96,120,143,165,238,237,225,123,78,175,154,252,181,46,139,87,31,46,218,58,88,241,231,201,203,161,237,21,227,231,229,39,69,180,77,224,244,83,235,246,50,253,148,127,176,219,71,217,116,200,232,218,44,181,153,123,123,10,115,115,143,151,177,30,160,157,245,233,233,232,213,46,15,111,181,236,170,7,251,68,191,175,121,186,54,223,232,175,127,232,53,254,183,88,129,62,30,212,123,143,165,222,127,164,82,20,197,248,240,238,188,9,171,158,69,197,205,110,179,53,215,255,133,126,191,209,120,108,183,221,223,219,150,222,250,89,90,75,246,11,43,179,102,203,200,133,245,142,230,55,115,82,104,165,233,73,127,81,60,234,30,187,69,179,5,165,56,223,251,215,255,245,234,191,244,207,95,20,19,51,55,119,25,237,121,7,175,203,13,40,168,111,107,34,118,182,167,183,149,148,173,238,76,40,101,219,62,224,146,176,213,246,146,178,173,95,163,147,177,173,57,9,217,54,240,23,177,29,108,5,253,125,140,86,101,182,82,182,186,167,139,148,237,230,122,39,101,171,123,141,72,217,42,39,39,101,219,20,70,185,140,143,7,253,130,239,213,251,195,241,170,166,246,182,201,109,247,215,221,147,241,199,134,178,69,170,209,189,95,76,228,155,18,55,156,166,193,226,122,84,189,238,103,230,96,0,
+15,187,95,175,38,60,251,29,180,191,237,158,110,74,189,7,232,97,191,105,125,96,189,37,181,113,133,250,159,206,143,170,15,87,221,181,163,167,54,245,119,250,185,156,241,18,246,163,222,40,185,87,254,182,60,85,167,166,173,136,126,74,118,184,41,142,127,24,12,123,42,68,215,241,220,16,165,115,179,3,129,244,139,90,56,161,6,122,25,234,164,125,196,216,42,191,22,107,116,220,137,22,135,22,67,9,187,213,141,17,30,47,54,151,167,39,245,94,210,118,79,69,113,93,190,61,191,155,176,57,84,197,197,86,9,85,124,89,124,174,31,108,222,232,135,8,237,47,79,166,234,179,169,206,33,241,249,130,137,26,179,201,62,92,151,157,202,245,65,191,116,183,87,243,75,183,25,81,25,230,121,14,213,138,47,127,109,199,241,171,17,178,198,160,124,62,162,98,84,233,245,54,105,141,161,179,240,74,106,221,27,96,112,249,31,124,83,66,5,89,173,190,54,76,235,127,250,5,234,219,42,231,148,168,27,17,247,162,244,75,128,129,64,57,166,68,173,19,59,192,204,54,245,90,156,101,76,137,70,117,158,41,161,47,152,168,113,121,83,162,86,188,127,74,180,160,36,166,132,198,144,120,74,180,234,107,153,15,54,168,169,15,57,167,68,147,58,116,162,244,65,112,32,80,142,41,81,235,196,14,48,115,199,141,22,103,25,83,162,81,157,103,74,232,11,38,106,92,222,148,104,246,112,123,167,68,11,74,98,74,108,247,17,83,162,94,1,30,205,5,127,199,93,125,200,57,37,154,149,98,39,74,191,176,29,8,148,99,74,212,58,177,3,204,180,142,22,103,25,83,162,81,157,103,74,12,58,225,156,213,184,188,41,81,43,222,63,37,90,80,18,83,66,99,72,60,37,84,42,169,213,215,38,163,250,159,142,187,250,144,2,125,206,57,81,119,42,237,101,233,51,221,129,68,57,230,68,171,148,6,83,102,239,91,45,0,205,248,102,119,88,85,117,83,201,131,54,234,99,60,150,172,19,225,172,47,3,250,250,171,137,182,230,16,88,75,123,119,186,170,142,15,251,181,161,209,102,195,244,88,163,245,85,35,1,235,239,186,77,201,73,228,27,32,112,115,189,211,2,182,213,17,253,79,191,145,224,122,151,117,30,212,45,93,123,89,250,210,203,64,162,28,243,160,85,74,3,48,179,139,172,22,96,49,243,224,172,47,99,30,232,175,38,218,90,194,60,104,53,218,204,131,177,70,103,154,7,171,221,253,219,213,133,194,82,35,157,186,172,90,233,63,71,18,234,94,171,167,234,170,190,250,74,253,53,216,14,188,171,91,233,53,207,185,244,238,243,83,117,60,236,15,119,31,138,250,242,110,175,228,159,245,14,64,197,183,121,70,113,92,109,182,15,167,134,97,251,222,160,30,92,219,201,83,191,149,177,221,175,206,61,96,71,16,232,133,54,48,96,138,62,197,129,26,128,134,129,101,0,186,159,196,54,120,16,94,105,12,21,154,221,174,173,210,244,234,28,116,135,144,75,83,47,57,212,52,208,72,211,59,117,204,55,129,38,165,66,221,40,250,249,254,225,238,74,215,199,134,43,10,5,171,235,170,217,43,223,108,160,172,95,239,124,44,143,10,128,239,140,245,153,143,159,241,230,145,157,181,118,94,86,214,234,135,139,122,46,147,252,207,229,216,86,4,99,123,237,104,220,150,186,228,170,2,40,32,68,128,177,34,220,178,68,104,196,106,146,209,187,96,19,51,168,223,145,8,112,191,122,102,231,156,8,0,205,147,201,16,0,0,198,31,34,64,16,0,98,53,50,74,59,222,86,46,31,48,168,141,118,83,64,23,4,39,92,245,165,97,8,112,240,27,141,124,202,90,15,216,202,90,15,88,253,192,128,64,43,130,223,7,12,11,177,166,15,144,43,32,68,0,27,4,236,178,68,104,196,106,18,139,15,24,86,199,207,115,0,131,0,191,15,152,114,78,4,0,167,15,152,40,29,48,254,16,1,130,0,16,171,145,209,94,154,189,211,7,12,138,193,221,20,216,238,45,92,245,165,97,8,112,240,27,141,124,202,90,15,216,202,90,15,184,94,40,7,91,160,21,193,239,3,134,149,103,211,7,200,21,16,34,128,13,2,118,89,34,52,98,53,137,197,7,12,204,208,205,1,12,2,252,62,96,202,57,17,0,156,62,96,162,116,192,248,67,4,8,2,64,172,70,134,22,217,237,111,93,62,96,80,253,238,166,192,206,108,80,127,230,90,111,143,8,66,128,
+131,223,104,228,83,214,122,192,86,214,122,192,245,27,209,193,22,104,69,240,251,128,97,169,221,244,1,114,5,132,8,96,131,128,93,150,8,141,88,77,98,241,1,3,51,116,115,0,131,0,191,15,152,114,78,4,0,167,15,152,40,29,48,254,16,1,130,0,16,171,145,161,69,170,237,157,110,117,127,119,127,158,153,154,113,247,229,104,34,94,117,63,152,199,67,53,140,187,159,198,54,159,112,24,171,220,197,77,127,111,227,184,30,115,12,24,235,89,251,3,97,166,123,3,187,159,45,115,142,59,120,63,75,43,238,124,236,145,218,152,202,213,182,105,177,152,162,134,91,188,225,45,30,198,197,12,48,210,96,57,46,139,183,171,211,85,245,47,158,76,213,191,192,82,117,31,2,116,212,125,69,105,170,187,21,54,87,180,191,162,192,42,194,139,159,37,103,174,160,17,20,46,217,24,74,76,41,35,49,229,150,179,23,129,163,199,228,40,171,165,221,172,62,232,123,204,216,211,126,53,142,60,237,215,83,56,181,63,140,167,215,136,242,120,232,118,46,245,72,39,156,214,67,78,140,25,100,8,49,141,53,237,143,182,72,195,24,172,143,149,213,222,110,182,168,209,143,229,105,99,203,68,229,141,167,136,48,172,37,166,216,153,68,142,44,144,255,216,1,208,178,216,230,188,88,154,246,79,82,35,237,23,94,173,156,111,130,160,126,16,53,172,240,99,35,193,199,42,28,245,72,108,132,74,100,141,18,97,210,69,161,197,37,223,153,117,184,214,224,248,233,94,204,104,250,143,213,161,230,162,71,238,224,153,104,123,201,132,235,249,240,184,166,225,231,169,235,101,214,67,199,202,166,137,148,230,58,203,198,205,18,251,92,252,204,197,205,120,166,86,163,56,87,89,130,156,245,241,142,250,214,106,201,202,25,89,42,71,88,241,144,183,75,219,249,238,202,226,184,165,194,142,28,66,229,240,6,1,228,155,202,122,117,108,252,95,243,154,137,22,217,180,98,221,50,251,249,149,238,83,51,6,105,85,35,84,253,50,125,62,242,219,238,122,119,184,54,84,208,126,51,214,66,251,181,229,225,64,243,131,237,73,64,79,123,170,142,246,71,155,70,24,172,76,189,156,5,183,168,166,253,201,170,157,243,109,189,130,6,47,80,213,196,205,182,203,155,103,109,5,227,217,216,205,117,239,82,77,30,53,141,197,81,195,212,188,45,35,172,142,91,95,145,101,242,22,45,83,188,65,103,46,219,131,33,109,162,209,86,145,8,105,135,102,122,184,110,110,184,104,218,37,182,173,17,235,254,252,131,230,74,191,252,212,93,250,203,106,187,251,34,148,76,219,74,200,75,112,44,212,221,97,95,189,53,54,166,182,139,157,233,134,212,65,43,202,193,77,54,76,41,131,215,123,80,135,87,6,107,106,188,93,214,41,213,224,101,138,225,93,62,177,70,151,134,196,44,187,178,28,175,61,185,149,101,121,219,137,167,168,225,228,156,42,42,224,69,44,250,5,44,172,146,28,47,194,4,43,73,63,126,197,42,41,228,213,28,242,149,28,172,146,28,175,70,4,43,73,95,143,85,82,192,203,26,244,75,26,88,37,57,54,203,7,43,73,23,240,177,74,10,216,190,79,111,219,143,81,82,221,172,225,162,11,188,214,195,187,154,6,26,131,94,29,245,109,238,211,128,235,159,7,189,102,222,170,232,241,235,197,164,207,216,32,172,215,215,152,71,146,239,79,135,221,182,111,4,166,15,148,208,251,24,155,14,41,245,169,54,186,235,99,219,5,166,120,56,213,189,2,107,42,234,175,225,153,233,15,167,210,207,189,190,68,206,92,223,190,173,95,161,208,167,94,108,138,211,238,80,13,250,193,61,174,214,15,15,119,126,25,154,107,12,33,222,30,14,77,47,209,213,253,253,241,176,90,191,213,182,94,59,68,27,54,237,219,174,171,114,191,62,108,136,97,247,215,153,29,64,174,31,182,187,102,19,112,187,70,57,15,179,105,75,211,52,191,212,183,234,83,226,143,31,206,87,233,198,59,167,113,27,152,230,221,118,191,16,231,203,70,77,95,244,87,186,223,203,118,93,158,186,190,220,109,31,230,115,55,163,254,4,166,114,247,160,70,59,32,220,126,105,92,86,222,111,119,135,219,135,209,117,231,111,3,86,18,93,249,132,183,154,32,243,95,206,12,118,149,118,250,183,176,44,105,241,88,162,231,14,153,198,98,212,178,201,171,122,230,35,11,135,100,70,13,217,85,97,49,171,199,108,105,6,181,
+110,61,109,122,81,166,249,124,155,6,186,234,216,231,100,112,197,47,98,55,173,144,218,181,232,195,185,105,175,153,48,171,149,118,125,209,112,251,166,113,148,79,179,88,215,39,14,105,167,208,116,66,186,110,142,40,153,238,33,105,184,25,213,165,7,179,81,240,112,239,168,110,6,4,96,238,30,231,96,211,94,199,106,176,69,45,205,56,135,251,227,204,113,70,48,119,143,115,176,49,169,99,53,216,134,147,102,156,195,61,64,230,56,35,152,159,115,100,229,220,79,23,231,179,22,134,233,184,74,14,155,223,173,60,218,223,108,3,234,201,246,189,159,172,105,116,51,150,64,46,195,99,213,218,67,59,46,158,140,78,247,248,249,191,126,30,92,96,30,170,114,88,151,155,7,253,162,203,113,123,123,91,234,3,61,14,103,114,231,110,189,167,15,167,167,87,231,99,181,198,109,245,90,194,205,74,202,199,186,189,66,192,187,189,179,231,125,254,223,100,67,125,251,206,156,235,40,23,179,169,137,126,135,110,255,112,231,216,62,222,158,9,209,236,28,209,47,137,134,238,36,55,247,182,15,94,57,116,202,52,109,91,178,170,18,9,103,72,86,191,114,19,162,39,253,142,85,30,61,53,175,35,177,244,148,72,184,110,103,50,129,39,179,35,136,105,178,233,86,228,169,40,129,187,146,205,125,210,225,120,26,244,252,24,225,9,40,156,33,153,23,79,166,158,76,147,165,213,83,0,158,198,122,74,36,92,183,203,149,192,147,153,153,155,38,155,110,107,157,138,18,184,195,213,220,115,27,142,167,65,195,140,17,158,128,194,25,146,121,241,100,234,201,52,89,90,61,5,224,105,172,167,68,194,153,59,38,221,128,26,231,104,166,209,166,155,36,167,194,4,238,151,52,119,112,134,35,106,208,111,98,132,40,160,112,134,100,94,68,153,122,50,141,150,86,79,1,136,26,235,41,145,112,102,44,174,202,176,149,129,238,80,150,103,101,208,182,125,227,172,12,18,9,215,73,118,126,96,246,232,232,151,167,59,144,88,24,15,216,177,223,23,29,48,85,10,121,222,42,227,185,195,58,90,8,187,2,198,114,68,216,200,16,234,108,8,159,81,144,138,33,196,176,105,200,39,86,18,85,25,88,110,122,203,5,204,44,221,232,44,207,204,106,187,199,113,102,86,34,225,44,134,172,87,87,19,197,16,0,170,111,138,152,89,141,145,124,51,235,44,132,31,46,103,57,112,51,75,219,202,103,20,164,98,8,49,66,103,86,82,85,25,88,110,246,50,4,204,44,221,47,45,207,204,106,155,208,113,102,86,34,225,44,134,180,43,134,0,80,125,83,196,204,106,140,228,155,89,103,33,252,112,57,203,129,155,89,245,73,82,30,163,32,21,67,136,17,58,179,146,170,202,236,206,208,60,100,241,52,168,24,52,94,203,51,183,218,110,118,156,185,149,72,56,139,41,155,179,104,199,138,33,32,84,223,20,49,183,26,43,249,230,214,89,8,63,96,206,114,224,230,86,125,22,136,199,40,72,197,16,98,132,206,173,164,170,50,171,84,190,76,203,172,153,153,201,76,218,154,89,64,166,53,174,153,37,18,174,147,108,156,105,141,21,83,3,104,202,120,188,108,231,117,229,160,50,45,155,16,118,5,184,210,7,129,141,60,153,150,205,40,72,197,16,98,184,102,150,75,172,36,170,50,176,236,205,180,198,125,188,243,204,172,128,76,107,172,173,68,194,89,12,217,100,90,99,197,16,0,58,47,219,165,51,203,158,105,217,132,240,195,101,156,62,196,207,44,51,211,178,25,5,169,24,66,140,208,153,149,84,85,6,150,189,153,150,105,59,51,153,73,59,179,2,50,173,177,182,18,9,103,49,164,93,49,4,128,206,203,118,233,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,217,3,203,159,105,153,214,51,147,153,180,115,43,32,211,26,235,43,145,112,22,83,54,153,214,88,49,4,132,206,203,118,233,220,178,103,90,54,33,252,128,25,167,15,241,115,203,204,180,108,70,65,42,134,16,35,116,110,37,85,149,249,252,214,151,105,153,79,147,205,100,38,237,211,228,128,76,107,252,52,57,145,112,157,100,227,76,107,172,152,26,64,83,198,227,101,59,175,247,25,149,105,217,132,176,43,192,149,62,8,108,228,201,180,108,70,65,42,134,16,195,53,179,92,98,37,81,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,
+68,194,89,12,217,100,90,99,197,16,0,58,47,219,165,51,203,158,105,217,132,240,195,101,156,62,196,207,44,51,211,178,25,5,169,24,66,140,208,153,149,84,85,6,150,189,153,214,248,224,165,60,51,43,32,211,26,107,43,145,112,22,67,218,21,67,0,232,188,108,151,206,44,123,166,101,19,194,15,151,113,250,16,63,179,204,76,203,102,20,164,98,8,49,66,103,86,82,85,153,157,70,253,153,150,105,61,51,153,73,59,183,2,50,173,177,190,18,9,103,49,101,147,105,141,21,67,64,232,188,108,151,206,45,123,166,101,19,194,15,152,113,250,16,63,183,204,76,203,102,20,164,98,8,49,66,231,86,82,85,13,58,120,58,83,45,219,9,167,121,246,89,6,228,90,227,125,150,137,132,235,36,27,231,90,182,163,95,45,140,199,11,119,94,143,89,42,215,178,9,97,87,128,43,129,16,216,200,147,107,217,140,130,84,12,33,134,107,110,185,196,74,162,42,3,203,222,92,107,124,80,106,158,153,21,144,107,141,181,149,72,56,139,33,155,92,203,118,130,172,199,76,231,133,187,116,102,217,115,45,155,16,126,184,140,19,136,248,153,101,230,90,54,163,32,21,67,136,17,58,179,146,170,202,192,178,55,215,26,159,183,154,103,102,5,228,90,99,109,37,18,206,98,72,187,98,8,0,157,23,238,210,153,101,207,181,108,66,248,225,50,78,32,226,103,150,153,107,217,140,130,84,12,33,70,232,204,74,170,42,115,61,232,207,181,198,7,183,230,153,91,1,185,214,88,95,137,132,179,152,178,201,181,108,39,218,122,12,117,94,184,75,231,150,61,215,178,9,225,7,204,56,129,136,159,91,102,174,101,51,10,82,49,132,24,161,115,43,169,170,106,1,111,118,228,83,45,243,188,88,51,153,209,223,83,224,85,215,112,172,214,74,19,152,105,13,142,219,29,101,90,64,225,58,201,198,153,214,88,49,53,128,166,140,199,203,118,125,192,114,216,204,154,48,181,224,198,38,132,93,1,174,244,65,96,35,79,166,101,51,10,82,49,132,24,174,153,229,18,43,137,170,12,44,123,51,45,211,118,102,50,147,118,102,5,100,90,99,109,37,18,206,98,200,38,211,26,43,134,0,208,121,217,46,157,89,246,76,203,38,132,31,46,227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,50,176,236,205,180,76,219,153,201,76,218,153,21,144,105,141,181,149,72,56,139,33,237,138,33,0,116,94,182,75,103,150,61,211,178,9,225,135,203,56,125,136,159,89,102,166,101,51,10,82,49,132,24,161,51,43,169,170,58,1,201,76,203,180,158,153,204,164,157,91,1,153,214,88,95,137,132,179,152,178,201,180,198,138,33,32,116,94,182,75,231,150,61,211,178,9,225,7,204,56,125,136,159,91,102,166,101,51,10,82,49,132,24,161,115,43,169,170,154,214,142,215,59,42,211,82,151,88,51,45,253,61,5,94,117,13,199,106,173,52,129,153,150,110,47,226,202,180,128,194,117,146,141,51,173,177,98,106,0,77,25,79,150,237,215,187,208,99,94,198,76,45,184,177,9,97,87,128,43,125,16,216,200,147,105,217,140,130,84,12,33,134,107,102,185,196,74,162,42,3,203,222,76,203,180,157,153,204,164,157,89,1,153,214,88,91,137,132,179,24,178,201,180,198,138,33,0,212,45,219,133,51,203,158,105,217,132,240,195,101,156,62,196,207,44,51,211,178,25,5,169,24,66,140,208,153,149,84,85,6,150,189,153,150,105,59,51,153,73,59,179,2,50,173,177,182,18,9,103,49,164,93,49,4,128,186,101,187,112,102,217,51,45,155,16,126,184,140,211,135,248,153,101,102,90,54,163,32,21,67,136,17,58,179,146,170,170,19,144,204,180,76,235,153,201,76,218,185,21,144,105,141,245,149,72,56,139,41,155,76,107,172,24,2,66,221,178,93,56,183,236,153,150,77,8,63,96,198,233,67,252,220,50,51,45,155,81,144,138,33,196,8,157,91,73,84,117,254,223,221,97,243,176,43,245,73,27,230,25,26,191,237,158,110,182,55,55,23,215,205,105,29,90,178,109,53,60,204,225,230,102,122,40,199,241,161,44,182,55,250,232,185,226,147,23,250,156,132,71,125,62,199,232,52,44,131,184,113,200,85,215,16,100,107,164,153,17,140,58,46,247,154,228,101,145,116,36,247,189,236,154,83,130,97,13,198,165,190,187,106,92,196,217,64,151,69,59,204,131,181,57,252,
+127,190,238,111,177,30,165,210,254,92,30,63,45,55,197,237,241,240,48,60,92,163,29,235,128,239,224,128,178,251,250,175,231,154,191,254,227,63,236,173,226,163,229,168,133,88,237,127,13,31,246,202,60,230,197,100,164,126,240,14,181,225,34,28,36,155,107,141,164,114,127,42,175,88,195,235,111,177,178,171,127,222,125,32,7,59,224,44,27,178,84,146,179,171,92,221,222,30,159,150,239,183,167,202,20,225,185,18,225,109,59,113,181,10,122,150,95,189,254,174,190,58,128,196,147,241,140,63,223,120,214,130,113,99,115,58,209,115,251,45,87,143,171,157,225,57,111,30,246,245,169,52,205,253,235,195,227,234,120,81,62,51,211,253,242,185,81,131,208,255,253,226,227,143,202,207,141,67,49,254,252,162,139,17,255,166,238,189,44,159,63,81,151,156,62,175,207,234,80,63,214,148,79,15,119,23,229,231,245,15,207,166,63,60,171,127,120,62,253,161,38,245,216,253,208,50,57,61,187,60,213,191,172,187,171,235,179,248,90,66,251,193,229,186,151,211,186,38,243,31,131,239,63,187,120,124,126,185,175,127,120,54,248,225,211,139,211,231,151,143,255,81,255,50,190,227,89,115,71,11,138,199,47,62,46,207,54,171,85,247,197,84,161,199,16,125,174,31,7,67,63,155,225,172,202,205,179,94,43,213,166,124,60,43,108,243,124,252,125,123,189,169,171,141,82,214,166,254,254,104,140,100,253,168,190,109,134,114,26,168,234,104,140,79,253,54,24,225,113,58,192,211,195,53,5,154,203,226,214,60,59,187,28,206,140,155,218,43,244,87,135,163,203,188,228,44,75,3,179,203,219,203,242,242,230,82,71,162,51,226,156,23,63,27,95,252,220,115,241,243,209,197,143,207,93,146,90,32,90,171,170,65,105,67,166,197,170,141,192,0,180,182,11,134,232,181,93,49,132,177,131,134,27,207,103,195,218,45,126,12,55,56,109,239,245,163,93,229,198,52,232,21,54,152,12,250,152,77,133,251,123,139,25,205,185,209,95,246,124,114,217,200,108,253,108,57,109,246,230,111,47,94,168,31,47,107,167,214,252,122,50,127,221,222,168,0,177,47,119,250,212,180,205,254,242,89,221,44,188,157,96,67,149,215,19,239,100,204,60,211,228,238,201,215,106,253,139,32,199,221,84,147,206,38,169,75,92,250,191,198,212,170,79,249,113,78,45,221,193,193,234,184,39,63,156,29,247,228,135,179,227,110,127,8,117,220,230,229,186,53,196,121,14,152,223,15,160,111,254,48,64,252,232,142,40,199,237,214,231,250,113,48,244,185,28,183,86,85,172,227,158,14,50,220,113,235,171,131,209,53,184,36,200,113,91,47,118,57,110,235,197,46,199,61,149,148,233,184,199,4,76,208,90,47,152,58,238,241,21,83,199,109,161,1,112,220,148,193,105,123,175,31,237,42,95,164,227,214,5,241,36,142,219,63,249,88,142,187,41,86,158,77,82,87,80,245,127,141,169,85,231,44,206,169,165,83,43,171,227,158,252,112,118,220,147,31,206,142,187,253,33,212,113,155,151,235,55,77,207,115,192,252,126,0,125,243,135,1,226,71,119,68,57,110,183,62,215,143,131,161,207,229,184,181,170,98,29,247,116,144,225,142,91,95,29,140,174,193,37,65,142,219,122,177,203,113,91,47,118,57,238,169,164,76,199,61,38,96,130,214,122,193,212,113,143,175,152,58,110,11,13,128,227,166,12,78,219,123,253,104,87,249,34,29,183,46,42,39,113,220,254,201,199,114,220,77,37,252,108,146,186,60,175,255,107,76,45,253,157,123,106,233,183,75,172,142,123,242,195,217,113,79,126,56,59,238,246,135,80,199,109,94,174,95,91,57,207,1,243,251,1,244,205,31,6,136,31,221,17,229,184,221,250,92,63,14,134,62,151,227,214,170,138,117,220,211,65,134,59,110,125,117,48,186,6,151,4,57,110,235,197,46,199,109,189,216,229,184,167,146,50,29,247,152,128,9,90,235,5,83,199,61,190,98,234,184,45,52,0,142,155,50,56,109,239,245,163,93,229,139,116,220,250,97,94,18,199,237,159,124,44,199,221,156,52,119,54,137,254,244,68,255,215,152,90,250,59,247,212,210,155,85,173,142,123,242,195,217,113,79,126,56,59,238,246,135,80,199,109,94,174,119,193,158,231,128,249,253,0,250,230,15,3,196,143,238,136,114,220,110,125,174,31,7,67,159,203,113,107,85,197,58,238,233,32,195,29,183,190,58,24,93,131,75,
+130,28,183,245,98,151,227,182,94,236,114,220,83,73,153,142,123,76,192,4,173,245,130,169,227,30,95,49,117,220,22,26,0,199,77,25,156,182,247,250,209,174,242,69,58,110,189,191,61,137,227,246,79,62,150,227,110,142,190,60,155,68,127,122,162,255,107,76,45,253,157,123,106,233,189,47,86,199,61,249,225,236,184,39,63,156,29,119,251,67,168,227,54,47,215,155,106,206,115,192,252,126,0,125,243,135,1,226,71,119,68,57,110,183,62,215,143,131,161,207,229,184,181,170,98,29,247,116,144,225,142,91,95,29,140,174,193,37,65,142,219,122,177,203,113,91,47,118,57,238,169,164,76,199,61,38,96,130,214,122,193,212,113,143,175,152,58,110,11,13,128,227,166,12,78,219,123,253,104,87,249,34,29,183,222,46,151,196,113,251,39,223,196,113,119,219,89,78,191,237,174,202,253,227,246,120,216,235,237,52,23,79,138,139,253,234,174,213,250,169,58,254,243,242,113,181,123,48,62,63,233,54,172,124,255,195,207,127,123,245,205,47,183,101,245,170,39,208,239,203,249,230,176,219,149,235,170,222,152,99,112,40,148,85,182,171,235,93,121,122,90,239,56,211,59,131,238,143,229,238,97,83,94,60,177,238,24,92,175,170,213,238,112,107,108,165,89,31,203,85,85,94,157,202,223,46,138,83,45,174,146,236,178,80,159,7,31,254,124,175,255,88,213,232,171,139,84,230,94,155,158,70,97,200,220,176,42,14,247,229,113,85,131,182,191,204,220,209,180,218,169,127,2,249,43,253,53,187,99,77,238,29,1,47,243,238,42,147,247,230,120,184,159,176,222,159,255,48,70,59,220,57,213,222,229,229,119,190,232,15,22,93,175,223,150,119,171,11,131,229,234,161,122,235,231,57,184,53,72,203,245,149,211,193,54,188,7,170,30,115,190,44,182,55,245,246,169,147,107,236,180,20,198,117,34,25,160,92,91,149,84,122,170,152,106,175,140,63,175,119,13,196,170,242,238,222,169,254,154,66,136,246,235,11,45,34,60,110,203,119,166,4,143,92,9,52,129,16,1,244,117,19,197,55,10,24,96,125,53,5,123,49,178,255,196,16,180,22,250,203,164,50,128,185,214,122,167,152,146,184,39,149,223,93,37,19,0,203,114,125,216,43,250,171,186,139,51,159,113,127,55,205,190,191,118,234,216,167,246,182,205,58,151,40,6,141,0,239,238,154,117,213,135,251,210,238,226,183,119,247,59,253,151,125,182,171,219,130,38,187,186,110,138,115,39,79,175,218,73,158,221,85,38,199,219,227,106,95,93,29,15,106,37,48,224,217,199,149,250,138,195,177,129,249,106,115,183,181,8,96,80,241,138,96,92,103,10,113,44,31,15,191,150,209,82,152,100,188,98,152,23,78,148,49,68,220,245,206,224,95,182,223,222,31,183,143,237,203,63,235,254,218,219,86,58,67,84,139,150,104,253,76,53,83,72,101,170,175,32,164,106,89,208,250,154,194,230,156,84,12,196,187,89,239,183,27,131,167,69,192,16,177,134,28,2,80,117,190,212,2,172,148,114,142,88,132,224,206,38,105,235,16,30,78,229,113,32,229,253,234,116,122,119,220,52,31,202,253,250,252,202,153,94,168,180,227,120,216,237,206,215,91,157,145,166,25,226,140,244,117,19,103,84,11,116,10,244,252,36,167,238,42,154,15,185,174,21,112,28,5,24,129,178,15,187,141,113,145,45,226,144,18,245,151,13,145,170,197,152,138,180,47,223,145,238,223,184,151,128,95,119,157,5,122,218,27,26,22,208,31,207,62,196,10,124,227,182,16,116,233,235,38,86,175,121,26,182,238,152,250,173,78,242,236,174,82,28,45,12,83,176,25,242,217,238,55,229,251,129,33,183,129,115,168,190,147,230,90,95,54,97,107,119,116,198,159,103,143,167,151,1,109,44,245,9,19,228,213,6,87,90,128,69,10,181,222,235,165,156,21,93,65,2,140,174,181,45,227,142,219,219,219,209,204,50,23,147,205,207,198,23,219,187,86,61,135,227,86,113,93,245,11,253,242,177,60,199,4,229,12,186,73,218,252,161,150,179,237,87,191,29,63,184,87,135,13,187,160,5,98,115,233,116,141,216,14,168,31,79,235,37,10,219,202,48,128,159,121,225,116,41,174,40,90,150,227,119,85,231,154,238,79,253,159,21,233,176,70,68,3,220,101,119,237,84,182,77,185,195,203,214,17,13,144,173,187,214,86,155,170,172,105,76,47,196,90,177,117,9,209,221,29,84,158,
+170,122,33,188,239,251,170,116,107,127,106,70,127,117,44,119,229,234,84,94,172,223,174,154,5,245,101,183,146,248,243,227,97,187,49,101,178,220,215,139,245,149,73,182,56,169,9,83,214,63,92,212,89,201,122,181,47,174,213,63,234,234,109,117,217,222,172,35,204,238,122,181,254,85,205,49,125,199,177,122,242,7,135,152,205,141,108,41,155,219,114,9,121,190,146,175,204,246,198,92,130,94,151,183,219,61,91,202,250,174,20,34,62,40,42,55,101,97,145,244,226,137,67,152,231,189,28,63,107,58,133,98,167,22,17,135,134,159,73,162,155,13,255,31,73,96,42,50,
 0};
 unsigned char* mal_init_inline = 0;
 
 unsigned char createdb_inline_arr[] = 
-{120,218,237,125,107,115,219,184,178,224,103,249,87,160,180,31,34,207,42,138,237,204,59,39,183,74,150,233,68,39,122,120,36,57,137,239,214,150,138,38,33,155,99,137,84,248,144,227,243,235,183,187,241,36,69,73,148,199,206,222,15,158,170,137,9,160,209,104,52,250,5,8,143,215,175,217,228,54,72,216,56,202,98,143,179,78,228,115,118,30,197,11,6,121,73,118,253,55,247,82,150,70,44,189,229,44,229,241,34,97,209,140,18,253,232,63,193,124,238,178,139,236,122,30,120,7,175,95,179,94,224,241,48,225,77,182,106,177,147,214,81,139,177,238,140,185,204,139,150,15,186,210,69,143,221,187,9,11,163,148,249,65,146,198,193,117,150,114,159,221,7,233,45,0,4,9,226,153,5,115,64,114,21,101,204,115,67,22,93,167,110,0,127,66,206,220,148,221,166,233,242,207,55,111,22,162,241,86,20,223,188,1,156,111,160,185,55,45,168,139,213,59,208,94,28,220,220,166,236,248,143,63,126,99,175,217,191,179,249,3,59,57,58,250,157,117,190,116,155,172,157,221,100,73,42,50,94,195,159,227,223,160,47,33,79,207,78,217,105,235,115,235,224,192,139,185,155,114,36,3,58,204,102,89,232,165,65,20,178,250,60,184,227,245,198,202,157,51,36,60,188,105,178,37,80,164,190,121,226,201,239,67,198,191,67,205,16,0,67,119,1,100,207,111,248,117,236,182,4,130,119,27,241,7,255,184,129,96,71,11,219,26,120,22,170,119,82,122,112,19,187,97,10,80,220,3,65,128,81,222,64,52,107,40,228,249,191,135,40,155,75,18,193,119,21,112,5,79,137,172,20,215,147,16,148,67,130,50,253,162,161,57,13,237,140,156,246,196,97,231,151,131,206,164,59,28,48,159,223,196,156,39,141,152,249,17,116,150,31,30,140,156,201,229,104,48,150,233,131,154,72,179,248,167,227,223,143,222,44,131,198,225,187,117,44,177,235,7,110,152,52,252,93,88,252,159,16,195,27,64,85,42,192,106,112,37,85,219,5,66,1,203,198,95,6,126,235,192,3,142,139,56,90,5,192,8,151,37,193,98,57,231,140,127,203,2,176,62,28,24,59,139,98,234,203,229,160,251,149,165,193,2,152,239,69,139,133,27,250,88,83,100,28,49,96,84,150,128,22,210,87,242,144,164,124,33,190,143,24,216,56,31,255,222,199,65,202,19,237,10,150,113,228,113,63,139,185,192,209,56,60,200,155,181,228,219,188,69,37,101,242,80,168,252,50,194,149,156,175,210,11,32,115,154,70,83,31,50,27,137,182,215,48,208,11,203,201,196,60,205,98,80,30,132,58,168,229,199,102,129,92,111,213,45,60,232,118,138,205,96,62,150,3,24,234,63,164,54,54,34,210,27,154,177,240,148,53,35,169,64,216,221,189,65,168,237,189,193,68,89,51,152,111,122,131,169,199,245,198,194,179,163,55,73,234,46,150,213,186,68,160,187,251,69,96,155,58,71,133,249,30,82,214,227,187,105,99,172,111,53,235,150,36,85,51,237,150,76,84,171,96,113,161,90,5,107,156,246,110,129,58,94,189,25,155,79,47,166,108,151,179,250,235,210,25,93,177,143,221,241,100,56,186,18,44,226,236,91,198,227,7,6,68,166,17,252,93,112,239,214,13,131,100,129,125,147,8,222,140,255,234,129,232,206,3,112,23,192,119,151,205,248,61,187,141,162,187,164,165,144,44,34,104,27,28,96,20,167,56,92,216,45,96,180,203,110,230,209,53,134,226,194,173,173,220,56,112,33,116,97,247,183,129,119,11,44,12,211,56,154,19,119,0,67,24,0,5,160,22,216,178,59,135,74,60,73,96,156,147,50,51,252,144,180,136,238,121,116,51,245,220,212,133,191,224,6,181,94,99,35,141,131,90,224,179,40,240,155,7,181,232,62,4,15,43,173,193,65,205,231,179,32,228,182,162,30,212,4,27,52,200,50,88,114,147,170,47,231,110,88,87,233,90,13,8,30,160,198,34,143,218,61,134,165,7,181,5,116,52,8,83,81,156,4,255,41,20,71,75,104,14,115,175,131,27,0,171,201,16,0,170,160,255,247,14,202,188,120,177,143,66,176,29,23,152,39,232,245,144,81,40,210,192,58,232,16,224,34,137,38,38,99,25,241,182,157,194,232,221,100,115,55,70,250,120,12,225,73,66,112,249,161,23,181,146,219,40,155,251,236,26,234,207,185,11,92,106,105,93,66,185,133,124,31,71,23,162,152,12,240,63,160,64,32,
-42,20,17,24,207,36,66,33,135,184,231,154,83,91,160,189,160,8,136,65,146,118,199,249,242,47,106,22,194,32,74,117,176,11,217,18,240,132,92,183,6,65,142,27,3,23,128,90,16,35,8,86,110,184,139,29,4,93,201,66,31,50,65,204,124,148,21,196,25,243,68,104,185,55,119,131,69,34,49,60,64,254,108,78,122,14,48,124,54,195,79,169,176,105,4,236,100,247,81,124,55,143,92,159,45,130,239,12,66,34,196,39,12,13,200,152,38,228,149,183,204,94,177,155,96,197,5,211,220,21,143,221,27,104,108,153,49,170,189,228,208,118,152,98,94,4,101,36,187,30,12,71,34,121,131,136,32,192,195,162,98,35,108,121,235,38,188,37,248,131,66,158,96,177,198,28,64,31,97,228,1,211,53,79,113,166,6,130,130,93,88,100,243,52,120,77,109,24,50,131,232,149,174,192,186,195,68,53,6,33,39,196,165,169,26,237,56,179,186,150,44,93,143,191,66,1,50,92,113,23,81,22,18,167,72,88,22,28,102,2,72,130,208,65,146,177,254,41,161,24,65,28,233,169,65,32,84,212,24,136,71,72,198,0,66,99,168,7,236,33,47,24,122,252,13,73,35,176,7,53,1,234,73,209,39,81,32,141,7,57,68,54,66,254,245,67,202,43,104,62,72,248,102,189,175,213,24,180,7,82,192,99,14,173,39,146,3,66,29,193,185,187,113,90,183,108,128,214,72,234,78,10,205,46,176,35,104,216,9,22,228,24,107,69,203,138,149,20,227,65,73,192,220,4,201,45,34,112,227,155,12,33,116,108,130,8,92,47,5,101,18,202,12,217,25,36,99,136,181,210,12,234,39,210,94,8,179,18,102,139,107,144,3,20,99,81,40,213,10,36,1,100,2,196,44,61,168,193,8,231,234,16,121,201,18,201,106,72,142,31,50,80,163,52,152,219,117,249,119,180,222,7,181,228,54,88,86,168,15,206,147,32,139,173,163,240,234,170,219,116,165,168,11,48,108,17,214,172,81,77,11,144,218,191,119,131,20,193,113,78,213,29,98,235,130,167,187,204,38,8,136,48,154,82,144,132,145,91,5,252,62,33,92,96,179,86,60,12,80,62,148,172,97,97,169,135,97,40,9,156,76,202,79,108,22,71,139,13,126,232,221,54,76,64,208,78,60,36,213,91,176,40,139,237,38,7,18,207,55,191,245,83,147,65,215,165,88,55,197,39,200,42,229,106,169,163,148,16,29,250,4,89,161,191,56,148,244,1,35,69,127,131,232,96,75,15,161,189,102,41,209,80,245,224,254,22,244,13,41,2,53,124,79,184,124,210,112,200,17,126,248,61,77,120,197,176,128,232,240,84,187,32,28,17,23,77,127,26,120,228,175,16,112,125,218,155,107,153,47,150,233,67,99,171,24,16,136,104,15,236,80,176,4,212,41,183,60,32,192,220,236,110,39,36,235,178,189,33,130,121,87,13,83,122,11,157,191,141,192,217,38,16,58,204,65,244,43,224,158,234,90,187,90,129,64,116,55,193,18,232,37,96,46,15,152,23,238,157,144,147,104,54,131,1,130,239,216,21,30,143,204,136,187,114,131,57,125,161,224,6,33,24,73,242,82,165,94,11,171,114,17,167,214,114,14,139,129,199,170,241,21,57,77,12,153,120,44,140,167,200,242,208,27,131,112,214,106,222,252,14,35,104,136,207,227,198,201,209,33,121,142,123,16,28,111,30,121,119,77,224,165,152,64,162,75,184,131,241,230,115,168,179,244,116,149,95,100,149,69,228,103,115,222,82,180,253,159,48,254,191,0,136,98,69,17,135,50,250,50,237,3,13,193,44,32,2,64,41,239,146,117,215,0,237,45,2,47,142,192,47,68,161,159,0,96,28,39,253,211,28,32,200,44,161,130,249,197,2,21,157,130,8,128,92,45,10,128,171,32,38,95,72,241,179,130,18,235,96,229,126,240,26,123,159,208,82,25,64,138,149,178,237,160,8,147,114,240,55,53,8,66,102,224,183,108,104,200,130,161,92,162,223,153,185,224,212,176,59,11,247,239,53,48,247,239,53,176,112,229,37,247,249,166,163,240,245,42,130,112,3,108,242,3,186,26,208,68,150,128,144,123,183,0,159,164,11,181,50,80,179,162,0,19,68,200,73,47,244,235,176,184,84,128,74,236,103,56,245,69,169,50,203,18,218,87,40,105,43,247,53,70,22,95,52,191,92,243,221,36,201,112,73,6,26,9,164,96,195,172,149,135,34,96,192,96,16,121,50,233,246,157,241,164,221,
-191,40,213,248,58,95,70,222,109,189,129,33,238,105,247,67,119,48,49,43,64,166,102,97,100,117,104,169,170,191,59,216,137,252,121,48,167,22,46,131,30,218,122,74,196,236,75,119,242,145,146,236,191,135,3,103,239,118,182,44,42,153,22,89,67,177,191,218,114,148,93,243,145,213,44,206,253,131,202,107,220,121,89,226,218,161,183,206,119,152,57,4,104,62,65,106,96,18,136,83,98,254,253,160,60,86,18,153,81,236,67,21,4,107,64,166,94,51,6,223,172,191,189,72,253,156,92,106,137,139,120,222,109,104,207,143,163,229,63,111,45,143,5,218,122,17,133,82,81,248,236,122,89,182,0,226,99,14,241,62,40,25,48,177,184,198,69,107,89,68,184,231,198,98,33,6,248,214,20,49,95,224,191,18,139,79,48,11,161,117,143,191,163,32,124,77,107,44,180,54,97,218,64,206,32,230,4,2,131,7,181,244,129,243,84,107,241,131,230,64,192,175,59,8,22,163,116,9,163,151,234,133,24,128,225,193,13,198,109,20,38,0,79,129,93,184,70,96,8,133,65,95,114,252,68,88,242,80,128,46,230,175,209,34,194,224,225,234,2,115,103,184,72,132,180,123,115,96,15,70,61,64,128,43,150,179,74,68,242,22,136,184,219,32,134,165,162,39,106,148,137,119,204,129,73,251,160,162,10,101,152,86,196,210,125,80,137,26,239,94,244,160,84,15,198,222,45,95,184,44,97,183,46,174,200,251,124,201,193,110,132,30,45,221,210,47,207,89,201,14,6,9,20,240,100,154,16,130,100,26,133,83,4,199,5,55,181,19,97,210,62,237,57,172,1,16,122,154,113,124,4,243,12,192,27,23,114,0,229,52,125,88,114,157,253,246,228,80,33,82,120,198,78,207,233,76,88,210,194,161,5,36,242,239,171,51,231,98,122,57,118,70,175,100,4,43,8,162,208,182,73,93,72,88,198,196,178,67,214,242,57,69,228,146,108,246,30,208,5,190,136,115,47,177,183,13,90,132,56,92,103,7,12,140,172,147,108,103,8,33,32,126,72,74,158,157,35,174,228,68,98,115,100,220,249,232,244,219,165,60,113,179,244,22,123,39,120,146,232,117,23,87,178,2,120,49,33,75,152,150,74,5,205,34,86,219,153,32,236,29,50,129,22,211,158,157,5,169,236,250,202,102,193,231,174,243,69,50,64,218,95,232,77,218,180,18,171,102,142,108,204,130,180,100,76,42,150,168,32,3,63,218,131,51,192,174,115,68,181,169,44,176,114,136,224,247,236,23,89,65,38,143,133,136,109,99,43,249,107,198,130,170,140,37,120,254,227,88,27,216,172,237,14,206,156,175,101,188,13,252,239,244,25,72,38,6,45,42,158,18,227,82,181,216,39,112,145,109,4,189,106,200,41,40,229,17,74,240,116,201,33,65,166,138,131,71,187,57,8,54,22,87,234,240,239,65,85,46,202,58,207,200,198,34,31,161,69,155,147,147,81,247,195,7,109,188,242,114,42,105,163,100,172,56,138,245,11,60,61,196,77,68,208,199,253,154,82,216,225,67,235,68,90,80,8,163,13,82,13,228,32,22,132,30,11,176,177,141,234,240,251,225,238,225,179,195,156,187,170,227,39,43,125,2,129,249,97,154,48,187,179,185,122,254,201,185,42,27,61,148,97,252,188,51,159,179,59,201,76,192,16,99,55,223,179,59,165,18,119,107,131,186,155,97,106,122,56,171,204,45,89,227,7,242,42,199,42,32,79,178,74,83,66,124,105,230,89,183,143,77,158,85,183,201,191,81,126,222,162,0,139,59,209,60,91,132,204,123,180,179,243,8,193,15,244,118,222,14,111,39,9,66,214,121,149,221,157,247,244,238,110,43,103,43,168,185,197,216,187,31,161,224,138,175,57,253,54,234,157,103,107,68,19,6,161,226,158,165,238,146,157,119,94,171,142,88,234,192,14,129,151,88,116,39,217,124,167,152,156,211,123,207,36,68,153,180,18,175,171,48,84,4,16,65,101,150,254,168,0,194,219,21,64,108,229,107,49,160,216,193,87,237,131,60,155,175,65,158,175,149,194,143,10,28,175,106,128,45,166,255,56,11,236,237,105,129,243,163,176,143,157,216,199,4,87,224,170,29,198,85,101,235,243,135,113,5,174,110,13,173,10,246,55,31,198,109,227,173,14,178,188,199,5,89,194,161,125,38,159,245,143,36,150,252,216,143,149,215,213,163,35,134,173,110,109,245,207,35,134,162,91,219,194,223,202,178,171,25,252,195,36,119,181,223,
-252,99,245,56,193,93,61,74,112,75,216,12,124,62,215,194,122,188,67,152,79,182,51,91,139,206,143,149,232,217,177,18,233,147,74,50,125,220,44,100,156,108,99,57,96,95,147,236,147,189,45,241,46,30,87,22,104,139,199,201,143,19,234,89,21,161,94,179,28,143,144,235,217,63,49,200,159,48,212,221,57,231,157,237,136,134,49,42,249,209,83,222,187,93,83,222,234,179,92,226,197,203,34,124,133,83,68,15,73,107,233,38,201,125,20,251,83,16,154,91,214,192,85,108,241,131,134,250,157,99,251,89,17,252,221,67,161,216,240,115,187,218,63,191,182,65,182,142,141,233,221,236,172,62,143,110,130,208,222,212,202,234,178,46,102,69,89,90,87,187,90,0,214,77,82,121,136,45,95,131,182,148,173,195,187,64,207,10,66,249,235,40,154,151,237,68,83,68,174,239,118,84,37,229,59,88,76,231,54,253,216,154,220,102,169,31,221,135,13,159,207,221,7,160,53,124,216,176,197,78,65,238,135,137,14,247,128,124,111,236,153,193,138,219,79,197,89,7,107,211,33,46,9,201,94,136,125,84,192,184,13,237,243,84,50,182,33,216,172,248,187,246,107,152,55,15,112,151,167,85,227,221,158,40,205,216,63,73,35,18,87,163,94,144,140,109,72,101,157,151,29,14,229,63,107,39,183,209,189,248,125,90,30,40,137,105,203,24,80,28,120,248,251,51,112,215,165,211,45,215,15,250,100,6,168,77,152,130,159,41,181,19,26,207,20,241,36,37,251,19,1,194,178,77,77,177,39,145,246,10,170,157,252,27,70,85,110,137,44,54,33,127,170,69,202,196,145,164,78,187,243,209,81,63,134,99,182,58,221,226,209,238,114,65,140,43,201,145,3,194,173,237,252,224,157,248,50,221,114,90,160,131,152,74,122,150,59,245,99,250,181,121,191,29,145,36,69,19,55,209,105,22,7,225,114,147,254,170,221,182,13,148,158,188,145,95,111,5,224,16,76,52,209,31,14,156,9,12,254,39,103,52,112,122,108,236,80,208,128,37,102,240,233,164,146,220,153,189,125,124,19,86,194,129,220,192,250,124,102,93,66,224,166,89,178,141,84,131,120,221,122,91,141,150,218,111,83,110,246,32,114,198,195,85,0,162,74,187,31,137,190,210,14,89,80,37,29,146,107,71,170,27,43,119,158,109,101,56,252,63,181,48,174,119,197,38,170,180,47,57,122,222,29,124,24,181,7,19,230,124,117,58,151,16,233,65,140,167,131,189,53,96,54,25,178,139,203,211,94,183,163,170,201,168,108,29,216,6,85,236,58,109,79,216,117,54,155,161,20,128,23,162,227,71,72,118,41,215,174,175,151,101,227,31,136,77,191,204,150,3,220,235,75,225,99,94,49,196,38,186,38,158,168,241,148,254,207,173,4,84,155,71,158,171,142,116,82,205,91,32,68,64,250,65,156,90,7,236,106,57,249,130,216,50,64,127,88,62,76,64,122,235,134,167,27,226,156,133,59,183,103,124,181,66,176,35,246,59,91,225,142,2,182,178,18,136,182,93,60,116,99,229,185,190,31,131,39,178,114,48,238,129,145,168,111,34,179,46,14,197,213,91,186,137,164,190,41,166,224,32,151,109,113,253,72,131,197,238,212,218,12,220,68,229,150,97,69,137,188,214,173,170,117,33,11,60,4,19,147,225,37,4,179,121,6,209,36,88,130,38,11,56,73,107,132,39,54,209,171,225,222,245,48,113,213,60,9,232,16,177,25,185,53,170,134,166,140,182,12,195,72,208,225,191,76,28,239,161,237,79,242,108,86,121,111,168,254,20,235,54,202,105,214,0,155,246,134,250,252,58,187,105,208,191,100,128,181,213,151,91,226,215,206,74,251,215,45,136,84,210,51,172,81,127,137,21,202,99,133,177,56,119,107,206,214,154,8,66,170,159,60,107,43,68,65,187,222,0,247,183,109,112,166,25,47,57,113,247,45,117,85,16,128,199,101,115,19,140,131,154,60,62,151,59,111,11,31,193,130,142,225,88,153,32,85,55,168,116,210,156,228,77,196,65,13,27,17,7,122,109,191,93,122,4,12,136,133,94,79,137,222,146,237,241,82,95,54,156,195,194,46,10,145,210,251,231,232,162,140,194,225,33,218,169,143,28,188,117,87,145,167,24,87,174,33,75,23,247,199,97,7,54,77,66,4,193,4,183,33,158,198,99,118,139,42,72,4,224,166,168,60,141,150,21,112,32,216,38,227,101,58,163,226,190,127,218,159,157,120,170,117,105,39,26,
-217,171,23,99,81,98,44,58,195,139,43,20,138,8,108,47,113,0,196,29,44,62,186,188,114,155,45,192,202,14,224,198,209,61,196,21,218,30,204,230,190,12,51,192,54,128,182,39,128,214,50,15,117,138,157,235,219,212,25,249,57,149,237,109,221,245,47,97,114,27,229,139,202,175,96,74,213,95,119,106,131,172,161,99,140,77,207,183,147,58,37,232,23,129,219,188,38,230,222,128,193,191,193,175,36,245,125,190,154,38,120,115,11,94,223,54,233,14,174,114,7,91,206,134,16,254,58,107,65,23,98,168,227,97,87,168,93,47,137,190,219,31,62,140,156,15,184,232,106,183,160,177,91,97,245,78,146,198,253,118,175,247,124,52,25,244,251,16,5,21,156,15,206,232,153,104,210,216,247,33,169,120,216,233,73,41,82,200,247,33,104,228,180,123,207,68,142,64,189,15,49,162,249,103,34,71,33,183,103,139,187,41,2,44,207,69,15,161,222,135,61,120,218,233,217,148,190,255,8,98,10,7,224,158,156,34,137,191,202,136,45,163,199,219,198,101,37,170,176,133,125,108,163,162,232,81,166,177,58,73,123,153,70,69,211,99,44,99,117,146,246,177,140,138,162,71,24,198,234,4,237,97,24,21,61,123,219,197,234,212,84,182,139,138,150,71,152,197,234,212,236,99,22,53,65,251,90,197,61,200,169,106,21,141,194,247,157,103,211,246,254,254,180,236,111,19,247,35,168,138,77,92,185,241,163,163,69,186,137,44,244,248,118,162,116,11,149,44,98,142,158,125,237,225,158,4,85,179,135,57,138,246,180,134,123,18,84,201,26,230,232,217,207,22,238,73,78,21,91,152,163,102,31,75,184,39,45,187,45,97,142,146,253,236,224,158,180,84,178,131,121,114,246,176,130,251,18,179,211,10,22,84,188,239,60,155,126,247,247,165,100,47,11,248,8,114,170,90,192,71,134,132,138,162,229,110,146,42,135,132,54,57,143,181,127,21,233,169,110,255,30,25,12,238,73,79,101,243,247,184,72,112,79,106,170,90,191,199,132,129,123,146,82,205,248,61,46,6,220,147,148,202,182,239,49,1,224,190,180,84,50,125,143,137,254,246,86,236,254,158,132,60,202,240,237,65,77,21,195,71,151,82,134,229,118,79,102,108,162,72,84,221,78,142,68,95,201,232,89,164,172,219,60,149,243,4,196,84,179,120,22,53,107,6,79,102,60,1,45,149,172,157,69,74,209,216,137,244,19,16,82,197,208,89,116,156,57,157,110,63,103,234,68,198,19,80,162,81,87,36,37,111,114,49,245,4,68,236,54,182,54,51,246,178,181,251,176,162,138,157,181,9,201,155,89,72,61,5,17,59,13,108,206,134,216,246,21,83,79,98,61,250,251,81,80,48,172,27,239,241,122,36,45,85,236,234,183,204,197,107,97,185,109,89,155,236,219,154,172,236,176,177,10,205,118,218,116,99,186,161,18,201,217,78,162,50,138,101,52,238,178,189,123,18,105,154,218,155,74,105,46,203,136,220,97,147,247,164,81,55,180,55,137,106,107,215,58,133,219,109,245,158,4,170,102,246,166,79,154,215,50,2,119,216,240,61,41,212,13,237,77,34,26,223,50,250,182,217,246,61,137,19,77,236,207,60,170,80,202,187,173,54,127,95,214,201,102,202,236,255,46,10,1,81,41,125,91,156,193,190,212,81,19,123,243,14,45,103,185,5,236,59,79,102,254,250,143,165,140,108,250,38,242,182,58,143,71,208,40,27,171,228,222,189,40,142,27,252,216,248,16,126,178,119,164,142,56,182,147,71,173,232,38,42,133,235,138,48,99,206,129,178,253,3,247,138,180,153,86,170,133,239,138,58,109,200,129,184,125,227,248,138,164,233,38,42,5,243,138,48,101,192,129,174,253,130,250,138,84,41,252,85,2,123,69,147,176,138,64,81,245,152,186,34,53,2,243,238,168,90,81,162,44,32,208,178,159,165,173,72,207,54,11,251,178,195,168,100,75,91,195,139,14,89,59,254,155,227,243,119,108,20,252,125,199,55,236,33,247,127,105,172,244,190,238,252,209,59,86,126,82,9,170,36,116,235,224,230,205,104,0,242,114,99,235,174,49,82,218,228,251,129,125,73,39,61,109,81,135,177,169,171,91,249,112,91,58,208,75,103,232,22,162,27,116,240,201,163,195,117,180,75,81,158,174,21,39,92,113,92,239,248,3,158,144,76,88,227,128,193,127,50,201,62,183,71,157,143,237,81,227,231,163,67,54,24,78,216,224,178,215,99,23,35,
-136,252,70,87,236,147,115,133,187,127,187,131,177,51,154,160,121,28,22,80,201,175,67,64,211,187,116,198,128,185,241,170,125,118,246,234,176,41,63,251,221,129,78,156,79,156,145,78,40,117,214,25,189,158,249,180,1,123,95,218,87,99,157,26,24,220,131,43,253,57,238,152,207,171,126,223,153,140,186,38,103,50,236,91,169,203,201,112,218,29,0,119,250,206,96,162,114,79,157,243,225,200,49,169,15,134,234,83,112,246,230,123,242,197,113,76,17,89,102,43,5,92,234,182,123,38,99,0,60,212,169,222,240,84,127,235,220,142,213,237,14,116,163,125,230,88,73,251,91,183,3,163,101,168,195,161,179,191,219,29,139,117,157,143,78,231,147,78,88,237,119,134,237,158,51,238,24,244,195,126,191,59,201,167,38,206,153,201,24,140,39,163,182,213,87,200,249,12,18,97,146,23,166,71,195,209,200,25,95,12,7,103,221,193,7,157,73,194,104,82,195,177,30,209,206,37,192,91,152,69,114,122,102,195,203,188,209,176,183,150,135,209,88,89,30,69,104,197,2,186,56,83,230,157,181,53,201,48,209,177,62,113,206,99,37,123,109,35,24,103,206,121,251,178,55,49,201,158,51,177,10,123,93,224,155,51,26,155,28,35,151,103,67,243,133,30,75,167,70,67,77,166,211,238,124,212,223,231,32,145,186,37,167,103,100,1,191,187,231,58,5,162,124,117,97,13,150,99,52,4,154,111,95,152,122,48,98,186,203,206,215,142,115,49,177,82,189,75,35,121,206,215,238,120,50,54,41,232,211,192,240,4,210,40,102,42,121,222,182,104,59,239,13,219,166,100,216,235,13,191,88,82,0,61,178,62,157,238,7,45,198,231,163,97,95,127,95,26,149,80,199,197,84,250,131,51,112,70,109,171,183,31,64,170,13,105,20,52,152,196,240,82,179,246,99,251,179,69,200,199,225,165,166,228,227,229,7,199,146,236,238,25,8,74,119,162,25,101,56,221,237,117,63,233,142,26,13,20,119,59,233,196,192,72,152,176,154,38,101,127,98,152,105,39,71,120,158,209,202,208,210,210,29,155,175,97,175,109,51,227,223,67,67,69,207,57,215,213,109,58,73,36,117,98,216,49,188,162,132,173,61,58,35,167,58,144,251,201,176,187,239,156,117,47,251,86,87,250,206,232,131,198,0,5,151,70,31,250,195,193,68,139,243,160,61,185,28,153,198,7,206,23,243,249,85,99,27,12,59,87,29,163,27,131,97,191,253,149,28,139,149,211,29,20,114,172,218,6,169,37,67,248,109,70,113,112,9,36,27,119,48,60,55,95,231,99,71,227,26,246,116,159,13,195,135,131,158,150,139,225,133,61,20,70,176,135,163,51,51,178,195,201,71,203,28,12,47,45,219,60,252,108,190,47,218,163,137,229,55,40,105,99,191,24,142,243,233,145,211,113,108,243,10,25,32,106,159,29,147,38,247,109,37,63,119,123,32,114,99,147,51,4,12,151,198,178,137,216,89,165,64,141,204,168,130,233,62,179,190,123,230,27,76,253,217,216,36,207,29,48,178,29,103,45,199,34,20,188,238,112,98,97,30,180,251,86,234,2,156,68,219,178,141,144,3,68,181,77,18,36,211,40,20,38,97,36,173,52,94,233,145,79,89,180,124,30,26,173,24,117,63,124,52,245,192,76,157,182,141,163,28,13,191,232,106,99,208,4,67,207,184,253,217,185,24,90,210,15,74,59,52,230,86,156,87,53,169,191,46,145,29,38,109,199,6,34,213,253,111,187,187,99,103,60,134,81,206,121,41,75,36,199,221,28,45,114,18,173,211,67,195,201,49,176,109,50,189,176,120,53,158,156,25,91,1,9,16,69,147,26,142,218,102,180,129,167,78,187,111,165,172,209,27,95,158,22,50,138,177,22,200,187,110,102,210,53,162,32,215,35,116,82,155,55,112,37,131,113,59,103,227,213,117,54,58,105,148,253,114,112,58,188,4,123,123,102,50,214,130,149,203,193,154,75,164,251,98,173,196,95,22,198,11,59,208,176,57,127,57,182,58,42,162,91,147,26,217,113,23,36,175,108,216,174,49,110,95,44,126,192,183,209,183,47,31,187,102,44,241,101,11,253,61,28,105,73,252,50,234,26,218,190,246,123,16,51,219,169,9,112,234,20,108,202,216,202,68,118,88,209,20,229,12,58,109,59,227,108,216,185,44,192,128,224,22,114,208,63,143,237,12,212,212,241,69,187,147,107,13,68,108,108,19,120,209,181,18,116,157,129,149,150,119,116,
-155,140,137,101,249,33,9,60,238,138,193,128,25,7,77,1,202,38,47,160,16,184,10,113,198,208,24,151,159,20,215,176,185,85,215,181,249,144,184,36,17,207,118,171,41,145,201,193,219,142,152,94,168,42,157,23,53,139,85,104,70,172,102,83,39,191,88,179,41,33,114,242,24,229,103,60,132,143,199,195,238,96,38,46,142,90,125,155,191,9,66,111,158,249,252,13,158,192,151,23,24,180,96,78,199,241,30,128,108,97,53,147,252,73,15,166,211,129,245,247,236,168,41,142,114,189,103,199,77,182,224,241,13,159,170,162,183,120,109,1,204,39,23,240,253,51,30,84,95,68,41,93,94,218,20,111,205,45,97,250,236,106,232,95,233,253,133,1,128,252,41,174,9,72,216,49,32,63,6,180,39,71,52,221,124,123,68,7,165,147,135,16,230,156,48,211,164,23,79,197,3,13,153,7,147,233,38,82,123,64,207,86,169,119,151,104,238,218,98,103,17,77,188,241,49,221,27,46,102,172,46,189,178,249,96,94,148,184,126,96,195,179,211,142,188,10,131,238,1,78,26,240,53,133,17,152,210,152,77,39,87,23,206,88,220,147,253,111,0,133,238,166,183,17,140,242,13,79,9,126,130,220,105,16,0,162,81,217,120,50,173,56,127,205,13,125,110,212,155,197,17,181,103,182,192,144,87,182,131,2,230,216,218,14,28,23,241,16,179,129,128,247,210,168,230,178,127,129,108,225,13,115,217,191,82,54,185,61,147,143,231,148,55,177,93,189,39,28,93,255,45,222,20,198,183,50,26,174,239,67,209,241,17,75,35,81,59,105,201,139,145,91,242,46,44,188,9,130,30,113,178,203,36,46,124,3,53,206,248,97,139,58,137,189,30,95,141,39,78,190,3,40,26,42,95,49,97,43,161,128,121,25,197,248,250,87,145,78,144,176,40,70,1,219,74,173,184,30,140,30,69,14,149,140,226,250,142,70,43,7,30,175,38,8,210,169,56,221,47,250,112,130,125,16,83,5,6,244,94,128,199,3,37,182,123,243,22,33,40,2,94,7,40,49,71,182,0,85,176,72,54,248,118,163,100,46,76,203,89,166,66,118,101,243,84,172,151,179,81,199,79,98,163,80,237,255,100,255,75,188,35,205,132,145,159,158,65,44,7,126,122,208,185,66,195,36,244,215,202,59,105,178,86,171,5,5,160,210,57,216,95,90,107,186,186,206,145,117,102,52,75,59,106,171,46,9,171,237,128,78,10,186,140,202,219,25,246,46,251,3,75,111,241,230,55,163,174,150,170,163,154,90,193,194,111,144,44,76,85,127,71,252,185,72,230,15,200,25,126,49,243,67,82,44,123,246,72,26,117,110,218,60,70,26,11,97,228,49,210,89,140,222,143,145,214,83,224,228,104,120,113,161,195,158,99,164,25,57,92,42,193,107,108,173,32,198,107,117,182,203,178,90,251,205,73,114,46,179,178,28,231,107,229,164,248,237,209,19,121,90,35,196,231,116,107,37,72,46,189,129,52,69,118,163,200,158,79,113,209,18,29,43,0,116,123,19,116,171,231,83,241,24,193,47,84,60,104,247,174,38,221,14,251,21,83,189,97,27,166,130,236,183,117,145,46,50,166,200,147,102,73,127,215,132,25,12,172,27,107,64,75,170,47,212,25,109,75,178,219,250,247,153,66,5,148,156,243,96,142,239,35,21,74,80,122,206,205,81,114,252,21,0,109,175,188,121,202,210,131,118,232,206,31,112,233,185,128,0,149,162,23,185,126,14,117,137,36,22,184,81,65,14,11,53,42,74,225,28,194,143,204,189,209,146,168,210,149,133,80,87,200,71,122,79,46,127,36,117,32,128,211,30,76,195,167,72,19,88,10,147,1,132,162,81,53,25,120,83,201,137,157,129,50,154,71,114,113,69,50,105,225,184,192,188,223,154,57,152,19,246,123,161,158,128,59,97,127,228,1,223,82,112,88,4,131,220,227,45,194,110,241,223,98,125,51,207,214,98,184,213,13,229,239,77,29,43,230,50,11,180,100,33,255,234,89,146,62,178,36,243,226,1,34,68,91,28,69,6,235,187,248,126,152,101,168,69,254,137,101,168,101,78,30,148,44,182,40,121,107,219,108,153,165,129,183,9,185,225,194,62,130,110,106,109,23,118,152,250,228,172,173,74,87,150,113,93,225,25,34,5,156,205,32,110,188,89,13,103,53,88,95,181,247,39,91,194,103,147,101,244,239,12,254,109,149,253,234,164,58,103,245,171,153,167,185,40,64,23,113,176,192,224,240,19,
-127,176,36,232,50,12,190,65,72,105,50,81,144,206,229,245,180,148,91,62,7,173,110,163,12,240,246,17,163,119,9,114,99,102,114,42,143,154,85,229,153,102,161,197,113,11,252,239,114,220,240,206,86,32,244,123,147,158,4,20,95,209,82,102,133,145,248,139,207,0,226,43,126,148,162,203,132,240,209,70,142,183,10,127,95,31,232,28,79,114,236,104,22,187,90,28,238,143,64,141,53,206,255,6,146,172,17,30,98,171,108,137,15,173,199,43,244,102,183,6,28,141,199,32,122,77,248,45,231,216,21,148,91,78,113,40,72,47,21,17,155,242,10,66,98,131,111,23,19,32,98,21,204,57,88,73,47,242,181,168,228,115,133,184,108,151,148,66,141,103,142,164,176,46,46,62,79,101,183,97,72,40,41,86,221,208,105,81,82,142,255,207,50,41,126,86,147,190,136,114,212,54,144,227,95,37,136,96,230,219,147,53,209,89,227,211,26,139,154,101,60,88,139,174,236,165,92,148,156,220,58,33,201,133,253,227,206,239,116,85,180,245,99,32,18,250,74,82,173,228,11,209,232,31,168,240,69,108,124,1,27,23,64,96,194,122,77,183,148,106,194,18,6,158,4,215,103,112,113,38,10,97,34,141,91,33,228,109,245,120,35,157,120,114,65,137,173,160,182,153,163,241,23,147,159,35,245,87,77,123,30,254,183,34,124,190,248,15,83,156,239,232,145,102,78,161,224,184,72,88,161,252,196,16,146,47,120,187,70,73,190,252,231,98,15,10,229,191,108,232,137,6,43,209,219,162,216,84,208,221,98,149,156,254,190,236,110,41,217,221,210,206,32,76,138,89,191,245,137,199,9,190,58,175,184,148,120,113,176,76,217,77,176,226,180,46,200,124,176,38,215,110,130,59,97,22,65,136,93,114,83,168,25,132,9,145,0,148,35,148,120,36,158,58,167,94,145,85,44,89,66,11,1,182,145,218,106,131,37,11,247,123,176,200,22,120,85,238,195,77,28,101,144,141,11,144,136,133,150,195,228,147,182,164,152,1,222,83,237,103,48,155,98,217,50,162,70,23,180,78,122,250,32,86,51,209,133,136,219,239,232,66,200,5,12,243,156,46,240,146,11,180,126,16,195,72,207,31,196,35,186,134,202,89,20,35,154,7,78,82,112,141,87,77,186,184,16,166,250,157,208,32,93,227,173,124,120,3,52,247,91,250,158,83,209,105,213,98,190,231,80,135,127,199,203,143,129,44,205,66,129,137,124,238,117,254,54,100,65,227,146,186,136,85,204,46,48,129,188,113,136,181,186,41,46,22,163,203,196,21,187,212,38,65,94,249,231,206,102,110,16,39,248,230,17,111,105,202,0,15,190,240,75,13,207,204,35,49,184,113,201,122,6,64,178,187,73,5,203,40,73,2,122,1,78,175,233,209,141,240,250,153,97,241,36,177,220,139,150,176,123,78,46,9,212,1,143,10,99,189,136,249,28,21,10,103,241,64,106,16,51,119,197,137,156,57,15,111,210,219,13,23,208,215,37,209,245,226,253,109,224,103,107,117,177,231,202,190,164,141,202,236,12,209,189,28,8,56,117,59,141,178,97,165,139,151,195,18,142,44,52,215,197,31,212,16,195,125,224,167,183,242,182,56,201,194,224,63,220,192,220,114,119,89,200,1,134,129,252,232,244,146,56,136,55,168,114,55,164,11,230,100,40,102,181,148,68,116,37,165,1,138,249,106,45,175,158,81,204,92,183,178,196,203,219,254,119,137,169,244,182,58,205,218,146,203,231,116,89,249,245,115,214,168,136,48,36,166,160,98,65,130,56,67,57,16,15,189,170,215,113,132,16,161,176,172,2,31,37,84,185,201,237,67,206,146,220,61,212,47,227,255,220,227,95,101,28,96,76,95,70,229,127,248,168,52,153,247,50,70,63,102,140,208,249,23,124,219,154,235,119,227,235,32,37,167,169,124,127,19,61,228,12,92,51,190,168,42,110,183,38,15,73,139,220,65,154,72,3,138,175,119,204,231,209,189,136,12,92,25,3,9,38,171,120,42,198,219,127,211,64,252,228,198,93,239,86,26,87,242,201,109,237,244,41,2,98,118,8,132,118,154,66,36,228,53,132,17,128,153,16,99,216,119,27,221,99,108,2,77,255,169,164,80,84,146,23,217,230,99,170,39,19,40,45,30,117,117,15,107,94,128,106,53,188,71,92,222,201,236,179,48,91,92,243,152,56,145,65,144,145,0,188,79,65,150,103,85,193,37,145,28,215,20,136,85,93,134,45,80,31,162,217,133,
-69,1,214,86,113,138,144,91,3,141,191,140,122,243,232,26,106,129,251,227,49,199,171,83,180,36,97,77,250,253,220,77,114,97,149,6,69,158,145,60,230,235,4,128,31,131,79,241,106,53,93,137,30,114,78,161,153,20,0,254,189,178,48,215,149,52,43,118,80,127,66,181,198,131,215,84,75,140,224,199,81,6,49,230,23,3,173,194,92,255,111,152,61,224,111,196,120,225,238,140,2,1,138,52,195,52,240,130,37,13,3,8,45,104,135,14,107,81,158,116,80,108,139,157,68,137,20,173,176,26,61,244,6,48,94,22,199,56,31,208,24,178,4,111,216,221,116,137,178,37,123,1,62,173,112,205,161,103,7,53,200,224,41,183,222,222,41,74,41,40,107,13,230,41,160,44,226,254,224,82,32,48,28,34,218,249,218,82,34,221,196,111,33,204,244,41,197,88,100,163,0,227,151,150,92,76,144,208,54,241,183,129,92,193,204,157,163,230,127,109,137,161,195,47,61,142,132,77,14,32,126,107,51,84,22,115,177,175,216,151,108,233,211,189,103,155,186,145,26,89,195,167,156,227,12,68,78,62,157,25,133,160,14,13,249,71,247,83,118,242,144,30,17,160,62,30,210,187,164,7,181,154,122,117,82,212,80,127,235,179,59,89,87,190,133,138,239,22,220,9,44,50,231,144,178,64,240,1,163,202,99,135,128,17,247,21,215,232,228,68,171,142,47,118,213,89,123,140,203,96,2,186,142,111,47,212,84,185,124,138,149,64,12,182,28,136,136,51,5,18,77,67,14,66,134,164,10,137,36,28,32,104,247,23,99,54,233,129,143,207,186,74,82,36,242,41,100,34,62,124,98,77,151,216,128,162,135,121,40,205,30,13,168,154,16,37,165,72,241,177,178,58,251,47,249,218,110,133,113,182,172,222,123,166,76,38,106,122,130,215,145,211,213,249,10,66,137,128,52,189,239,217,43,249,248,218,43,52,103,34,247,253,43,52,107,175,222,29,240,208,55,207,120,72,15,97,30,89,88,159,219,123,17,206,245,82,179,74,128,117,181,107,148,83,212,5,189,210,33,236,240,93,178,196,215,105,208,192,73,19,103,45,15,168,183,28,200,100,137,37,130,108,9,229,215,180,52,64,75,2,216,51,61,53,21,239,14,139,77,45,96,46,196,66,129,48,34,126,75,245,66,209,30,243,111,89,16,211,140,133,218,181,77,52,174,150,39,228,6,151,243,32,69,138,193,218,11,179,183,116,99,97,247,240,108,85,121,128,102,66,154,70,104,5,100,129,126,186,202,215,23,192,171,176,76,134,26,210,144,121,200,184,26,245,15,17,192,16,73,131,254,10,73,80,191,248,178,224,93,30,72,12,162,13,113,242,83,17,38,89,0,199,112,205,60,15,7,83,187,34,228,26,208,207,37,64,130,238,60,220,239,37,112,183,217,13,95,3,60,254,181,4,82,63,179,176,5,169,130,213,130,139,144,160,68,130,111,2,6,190,211,6,249,94,201,107,246,175,127,1,150,34,255,182,0,3,121,101,60,218,82,227,237,73,41,195,106,28,172,126,177,35,53,142,107,197,46,62,58,80,90,110,138,133,14,150,9,154,138,147,27,233,178,76,204,238,217,22,25,131,40,131,97,181,127,253,151,197,71,210,50,153,73,22,0,226,117,193,90,73,221,145,164,44,152,189,83,15,216,176,227,163,147,159,143,216,255,134,134,127,98,247,91,201,133,152,157,200,189,214,1,138,166,118,19,153,198,134,133,81,248,26,205,11,233,62,250,11,209,135,107,237,217,242,148,218,124,180,169,61,218,70,161,154,69,32,145,134,143,97,201,60,106,141,153,5,69,5,66,192,166,104,153,166,151,248,242,153,90,19,115,185,107,25,82,195,114,121,74,155,114,153,62,247,32,40,158,23,50,161,139,69,90,148,126,229,178,129,25,197,170,81,134,123,73,138,124,37,193,167,177,62,106,29,159,88,10,160,121,205,42,50,219,118,101,207,183,182,87,156,127,62,110,190,249,140,243,75,29,190,74,158,201,232,179,107,69,159,93,19,125,118,173,232,179,171,163,79,202,197,126,230,58,216,176,1,100,68,10,89,58,84,56,180,186,158,131,53,32,148,50,51,162,67,201,26,85,195,204,122,44,26,16,200,86,36,67,156,106,3,33,186,58,6,238,218,49,112,215,138,129,187,58,6,62,168,109,14,234,89,183,32,100,230,101,78,11,116,195,235,156,57,17,124,39,231,203,217,130,118,37,200,144,70,206,122,75,162,134,128,66,4,119,229,
-6,115,130,113,205,219,127,72,131,142,56,220,236,123,48,15,16,165,24,27,8,136,194,40,149,209,144,250,205,67,196,65,129,120,230,8,109,157,20,37,181,78,138,191,129,68,217,220,167,41,89,118,131,4,168,159,145,92,177,18,223,136,105,15,120,144,102,52,209,61,92,227,135,136,144,173,46,31,24,166,20,167,0,77,160,171,65,195,118,136,253,50,226,5,220,105,24,17,163,66,147,148,229,74,168,168,84,37,84,25,105,150,40,161,79,153,111,52,76,52,168,147,170,77,156,22,138,77,209,130,49,239,197,108,74,120,92,180,246,226,241,55,242,165,71,12,36,130,240,104,222,31,108,24,116,134,63,52,45,113,113,165,200,130,151,131,240,63,250,167,66,185,151,92,245,157,86,107,86,60,38,149,48,135,237,109,204,173,178,253,24,230,153,209,134,118,17,56,205,82,111,180,149,184,9,189,34,41,203,201,67,230,158,252,170,139,159,177,44,251,191,230,90,140,173,215,57,97,48,183,93,6,112,97,69,191,206,201,102,65,201,114,233,221,46,101,227,51,194,46,238,244,4,107,11,77,0,86,38,159,200,205,209,92,182,144,41,171,253,3,172,77,92,169,212,241,209,115,183,208,100,233,245,252,255,75,107,248,186,100,181,150,95,172,70,137,213,160,157,50,242,12,139,126,118,146,101,120,109,19,208,126,191,182,198,12,112,6,204,236,194,14,252,195,131,26,116,183,33,253,86,32,87,17,53,236,161,232,57,26,136,119,242,202,19,9,42,194,206,28,222,146,215,183,128,129,55,55,248,86,49,129,78,197,210,203,84,46,29,49,119,134,187,177,229,122,140,138,99,101,25,46,34,208,234,59,253,248,78,17,2,30,180,65,152,2,26,8,53,216,246,246,212,198,136,146,230,84,89,133,230,82,121,198,10,90,43,14,129,68,98,248,47,27,81,216,113,81,73,130,138,249,213,187,53,20,170,223,107,56,84,193,6,28,120,69,16,13,29,218,66,24,191,243,79,234,230,148,192,79,154,106,237,123,129,131,163,243,81,182,142,88,3,5,222,190,107,229,240,64,238,86,163,240,134,182,234,225,127,184,67,72,175,174,65,219,13,185,120,137,141,141,134,253,220,168,137,181,63,210,98,156,148,61,36,175,14,101,158,141,225,136,225,250,156,201,193,173,120,221,129,141,216,132,23,2,49,24,106,139,54,35,114,255,67,104,195,129,88,224,254,140,4,77,35,202,205,13,79,19,121,62,139,251,7,226,232,46,192,253,63,243,13,233,55,
+{120,218,237,93,91,115,219,184,146,126,150,127,5,74,251,16,121,86,81,108,103,238,57,217,42,69,166,19,157,232,226,145,228,92,118,107,75,69,83,144,205,177,68,42,188,200,241,249,245,219,221,184,146,162,36,210,177,125,246,193,83,53,49,1,54,26,31,26,141,238,6,4,2,47,95,178,201,181,31,179,113,152,70,30,103,157,112,198,217,89,24,45,25,228,197,233,229,223,220,75,88,18,178,228,154,179,132,71,203,152,133,115,74,244,195,127,249,139,133,203,206,211,203,133,239,29,188,124,201,122,190,199,131,152,55,217,186,197,78,90,71,45,198,186,115,230,50,47,92,221,233,66,231,61,118,235,198,44,8,19,54,243,227,36,242,47,211,132,207,216,173,159,92,3,129,31,35,159,185,191,0,38,95,195,148,121,110,192,194,203,196,245,225,79,192,153,155,176,235,36,89,253,249,234,213,82,84,222,10,163,171,87,192,243,21,84,247,170,5,101,177,120,7,234,139,252,171,235,132,29,255,241,199,111,236,37,251,103,186,184,99,39,71,71,191,179,206,231,110,147,181,211,171,52,78,68,198,75,248,115,252,27,180,37,224,201,233,59,246,174,245,169,117,112,224,69,220,77,56,194,128,6,179,121,26,120,137,31,6,172,190,240,111,120,189,177,118,23,12,129,7,87,77,182,2,68,234,153,199,158,124,62,100,252,59,148,12,128,48,112,151,0,123,113,197,47,35,183,37,24,188,217,202,223,255,225,10,252,61,53,236,170,224,81,80,239,69,122,112,21,185,65,2,84,220,3,69,128,94,222,2,154,53,20,243,236,223,67,212,205,21,169,224,155,18,188,252,135,100,86,200,235,65,0,101,152,160,78,63,143,208,204,8,237,140,156,246,196,97,103,23,131,206,164,59,28,176,25,191,138,56,143,27,17,155,133,208,88,126,120,48,114,38,23,163,193,88,166,15,106,34,205,162,159,142,127,63,122,181,242,27,135,111,54,185,68,238,204,119,131,184,49,219,199,101,246,19,114,120,5,172,10,21,88,117,174,68,181,91,33,20,177,172,252,185,227,119,118,60,240,56,143,194,181,15,130,112,89,236,47,87,11,206,248,183,212,7,235,195,65,176,243,48,162,182,92,12,186,95,88,226,47,65,248,94,184,92,186,193,12,75,138,140,35,6,130,74,99,24,133,244,20,223,197,9,95,138,231,35,6,54,110,134,127,111,35,63,225,177,118,5,171,40,244,248,44,141,184,224,209,56,60,200,154,181,248,219,162,69,111,138,244,33,87,248,185,135,75,57,95,53,46,0,230,52,9,167,51,200,108,196,218,94,67,71,47,45,39,19,241,36,141,96,240,32,213,65,45,219,55,75,148,122,171,110,241,65,183,147,175,6,243,241,61,144,225,248,135,212,214,74,68,122,75,53,22,159,162,106,36,10,164,221,223,26,164,218,221,26,76,20,85,131,249,166,53,152,186,95,107,44,62,123,90,19,39,238,114,85,174,73,68,186,191,93,68,182,173,113,244,50,219,66,202,186,127,51,109,142,245,157,102,221,210,164,114,166,221,210,137,114,5,44,41,148,43,96,245,83,229,26,168,225,229,171,177,229,244,108,202,246,57,171,191,46,156,209,87,246,161,59,158,12,71,95,133,136,56,251,150,242,232,142,1,200,36,132,191,75,238,93,187,129,31,47,177,109,146,193,171,241,95,61,80,221,133,15,238,2,228,238,178,57,191,101,215,97,120,19,183,20,147,101,8,117,131,3,12,163,4,187,11,155,5,130,118,217,213,34,188,196,80,92,184,181,181,27,249,46,132,46,236,246,218,247,174,65,132,65,18,133,11,146,14,112,8,124,64,0,195,2,107,118,23,80,136,199,49,244,115,92,100,134,239,226,22,225,94,132,87,83,207,77,92,248,11,110,80,143,107,172,164,113,80,243,103,44,244,103,205,131,90,120,27,128,135,149,214,224,160,54,227,115,63,224,246,64,61,168,9,49,104,146,149,191,226,38,85,95,45,220,160,174,210,181,26,0,30,224,136,69,25,181,123,12,223,30,212,150,208,80,63,72,196,235,216,255,87,238,117,184,130,234,48,247,210,191,2,178,154,12,1,160,8,250,127,239,160,200,139,231,219,40,20,219,113,65,120,2,175,135,130,66,149,6,209,65,131,128,23,105,52,9,25,223,145,108,219,9,244,222,85,186,112,35,196,199,35,8,79,98,162,203,118,189,40,21,95,135,233,98,198,46,161,252,130,187,32,165,150,30,75,168,183,144,63,195,222,133,40,38,5,254,119,
+168,16,200,10,85,4,250,51,14,81,201,33,238,185,228,84,23,140,94,24,8,200,65,66,187,225,124,245,23,85,11,97,16,165,58,216,132,116,5,124,2,174,107,131,32,199,141,64,10,128,22,212,8,130,149,43,238,98,3,97,172,164,193,12,50,65,205,102,168,43,200,51,226,177,24,229,222,194,245,151,177,228,112,7,249,243,5,141,115,160,225,243,57,62,202,1,155,132,32,78,118,27,70,55,139,208,157,177,165,255,157,65,72,132,252,132,161,1,29,211,64,94,120,171,244,5,187,242,215,92,8,205,93,243,200,189,130,202,86,41,163,210,43,14,117,7,9,230,133,240,142,116,215,131,238,136,165,108,144,17,4,120,248,42,95,9,91,93,187,49,111,9,249,160,146,199,248,90,115,246,161,141,208,243,192,233,146,39,56,83,3,69,193,38,44,211,69,226,191,164,58,12,76,63,124,161,11,176,238,48,86,149,65,200,9,113,105,162,122,59,74,173,166,197,43,215,227,47,80,129,140,84,220,101,152,6,36,41,82,150,37,135,153,0,66,16,99,144,116,172,255,142,88,140,32,142,244,84,39,16,43,170,12,212,35,32,99,0,161,49,148,3,241,144,23,12,60,254,138,180,17,196,131,35,1,202,73,213,39,85,160,17,15,122,136,98,132,252,203,187,132,151,24,249,160,225,219,199,125,173,198,160,62,208,2,30,113,168,61,150,18,16,195,17,156,187,27,37,117,203,6,232,17,73,205,73,160,218,37,54,4,13,59,209,130,30,99,169,112,85,178,144,18,60,12,18,48,55,126,124,141,12,220,232,42,69,10,29,155,32,3,215,75,96,48,137,193,12,217,41,36,35,136,181,146,20,202,199,210,94,8,179,18,164,203,75,208,3,84,99,241,82,14,43,208,4,208,9,80,179,228,160,6,61,156,41,67,240,226,21,194,106,72,137,31,50,24,70,137,191,176,203,242,239,104,189,15,106,241,181,191,42,81,30,156,39,81,230,107,71,229,213,69,119,141,149,252,88,128,110,11,177,100,141,74,90,132,84,255,173,235,39,72,142,115,170,238,16,107,23,50,221,103,54,65,65,132,209,148,138,36,140,220,218,231,183,49,241,2,155,181,230,129,143,250,161,116,13,95,22,122,24,134,154,192,201,164,252,196,230,81,184,220,226,135,222,236,226,4,128,246,242,33,173,222,193,69,89,108,55,62,144,124,190,205,90,63,53,25,52,93,170,117,83,60,130,174,82,174,214,58,74,9,213,161,71,208,21,250,139,93,73,15,208,83,244,215,15,15,118,180,16,234,107,22,130,134,162,7,183,215,48,222,16,17,12,195,183,196,107,70,35,28,114,132,31,126,75,19,94,209,45,160,58,60,209,46,8,123,196,69,211,159,248,30,249,43,36,220,156,246,102,106,230,203,85,114,215,216,169,6,68,34,234,3,59,228,175,128,117,194,45,15,8,52,87,251,235,9,200,186,236,174,136,104,222,148,227,148,92,67,227,175,67,112,182,49,132,14,11,80,253,18,188,167,186,212,190,90,32,16,221,15,88,18,61,7,204,197,1,243,210,189,17,122,18,206,231,208,65,240,28,185,194,227,145,25,113,215,174,191,160,39,84,92,63,0,35,73,94,170,208,107,97,81,46,226,212,90,198,97,49,240,88,53,190,38,167,137,33,19,143,132,241,20,89,30,122,99,80,206,90,205,91,220,96,4,13,241,121,212,56,57,58,36,207,113,11,138,227,45,66,239,166,9,178,20,19,72,116,9,55,208,223,124,1,101,86,158,46,242,139,44,178,12,103,233,130,183,20,182,255,9,162,255,5,66,84,43,138,56,148,209,151,233,25,96,240,231,62,1,128,65,121,19,111,186,6,168,111,233,123,81,8,126,33,12,102,49,16,70,81,220,127,151,33,4,157,37,86,48,191,88,226,64,167,32,2,40,215,203,28,225,218,143,200,23,82,252,172,168,196,58,88,177,31,188,196,214,199,180,84,6,148,98,165,108,55,41,210,36,28,252,77,13,130,144,57,248,45,155,26,178,160,43,87,232,119,230,46,56,53,108,206,210,253,123,131,204,253,123,131,44,88,123,241,109,182,234,48,120,185,14,33,220,0,155,124,135,174,6,70,34,139,65,201,189,107,160,143,147,165,90,25,168,89,81,128,9,34,228,164,23,218,117,152,95,42,192,65,60,75,113,234,139,90,101,150,37,180,175,80,218,86,236,107,140,46,62,143,252,226,145,239,198,113,138,75,50,80,137,47,21,27,102,173,60,16,1,3,6,131,40,147,
+73,183,239,140,39,237,254,121,225,136,175,243,85,232,93,215,27,24,226,190,235,190,239,14,38,102,5,200,148,204,245,172,14,45,85,241,55,7,123,153,63,14,231,196,226,101,216,67,93,15,201,152,125,238,78,62,80,146,253,247,112,224,84,174,103,199,162,146,169,145,53,148,248,203,45,71,217,37,239,89,204,146,220,15,20,222,144,206,243,18,215,158,113,235,124,135,153,131,143,230,19,180,6,38,129,56,37,230,223,15,138,99,37,145,25,70,51,40,130,100,13,200,212,107,198,224,155,245,179,23,170,159,147,11,45,113,158,207,155,45,245,205,162,112,245,227,181,101,185,64,93,207,170,80,168,10,159,92,47,77,151,0,62,226,16,239,195,32,3,33,230,215,184,104,45,139,128,123,110,36,22,98,64,110,77,17,243,249,179,23,98,241,9,102,33,180,238,241,119,232,7,47,105,141,133,214,38,76,29,40,25,228,28,67,96,112,167,150,62,112,158,106,45,126,208,28,8,228,117,3,193,98,152,172,160,247,18,189,16,3,52,220,191,194,184,141,194,4,144,41,136,11,215,8,12,80,232,244,21,199,71,164,37,15,5,236,34,254,18,45,34,116,30,174,46,48,119,142,139,68,136,221,91,128,120,48,234,1,0,174,88,206,42,80,201,107,0,113,179,69,13,11,85,79,148,40,82,239,136,131,144,170,176,162,2,69,156,214,36,210,42,172,68,9,97,17,79,125,178,167,24,111,193,156,62,164,53,194,136,95,166,254,98,22,203,53,26,185,42,182,72,151,1,13,4,87,105,69,10,97,25,133,190,160,163,252,91,170,183,144,8,37,144,75,172,33,116,101,19,149,33,14,41,10,160,145,216,148,43,218,11,158,196,98,185,111,33,102,2,48,203,190,138,194,116,69,205,64,245,137,169,223,176,44,162,192,21,72,181,130,170,129,205,80,185,54,196,2,74,151,80,139,42,73,217,148,122,118,24,133,86,98,236,93,243,165,203,98,118,237,226,239,21,51,190,226,96,85,3,143,22,182,233,119,249,180,96,127,135,36,242,121,60,141,137,65,60,13,131,41,146,227,114,164,218,167,49,105,191,235,57,172,1,20,122,18,118,124,4,179,48,224,27,229,114,128,229,52,185,91,113,157,253,250,228,80,49,82,124,198,78,207,233,76,88,220,194,222,5,38,242,239,139,83,231,124,122,49,118,70,47,100,124,47,0,81,224,223,164,38,196,44,101,98,81,38,109,205,56,205,87,36,108,246,22,216,249,51,49,11,184,192,214,54,104,137,230,112,83,28,168,241,82,86,187,5,66,12,72,30,18,201,163,75,196,149,146,136,109,137,140,59,31,156,126,187,80,38,110,154,92,99,235,132,76,98,189,42,229,74,81,128,44,38,100,17,146,66,173,160,57,214,122,183,16,132,55,64,33,208,82,227,163,139,32,145,77,95,219,34,248,212,117,62,75,1,72,239,4,173,73,154,86,98,221,204,192,198,44,72,75,193,36,98,1,15,50,240,161,61,56,5,238,58,71,20,155,202,23,86,14,1,126,203,126,145,5,100,242,88,168,216,46,177,82,52,195,152,95,86,176,68,207,159,78,180,190,45,218,238,224,212,249,82,36,91,127,246,157,30,125,41,68,191,69,175,167,36,184,68,45,133,10,94,100,27,97,92,53,228,4,157,242,136,37,196,1,241,33,81,38,74,130,71,251,37,8,54,22,215,49,241,239,65,89,41,202,50,143,40,198,188,28,161,70,91,146,147,81,247,253,123,109,188,178,122,42,177,81,50,82,18,197,242,57,153,30,226,22,43,104,99,181,170,20,119,120,208,99,34,201,13,8,51,26,228,48,144,157,152,83,122,124,129,149,109,29,14,191,31,238,239,62,59,8,188,41,219,127,178,208,71,80,152,39,27,9,243,27,91,170,103,31,157,175,69,189,135,58,140,143,55,230,113,126,35,133,9,28,34,108,230,91,118,163,134,196,205,70,167,238,23,152,154,60,207,75,75,75,150,120,66,89,101,68,5,240,164,168,52,18,146,75,51,43,186,42,54,121,94,222,38,255,70,249,89,139,2,34,238,80,40,204,188,123,59,59,25,75,63,157,183,243,246,120,59,21,220,227,143,176,165,221,157,247,240,238,110,167,100,75,12,115,75,176,55,79,49,192,149,92,51,227,219,12,239,172,88,67,154,48,136,33,238,89,195,93,138,243,198,107,213,145,75,29,196,33,248,146,136,110,164,152,111,148,144,51,227,222,51,9,241,78,90,137,151,101,4,42,2,8,191,180,72,
+159,42,128,240,246,5,16,59,229,154,15,40,246,200,85,251,32,207,150,171,159,149,107,169,240,163,132,196,203,26,96,75,232,79,103,129,189,138,22,56,219,11,85,236,68,21,19,92,66,170,118,24,87,86,172,143,31,198,229,164,186,51,180,202,217,223,108,24,183,75,182,58,200,242,238,23,100,9,135,246,137,124,214,15,105,44,249,177,167,213,215,245,189,35,134,157,110,109,253,227,17,67,222,173,237,144,111,105,221,213,2,126,50,205,93,87,155,127,172,239,167,184,235,123,41,110,129,152,65,206,103,90,89,143,247,40,243,201,110,97,107,213,121,90,141,158,31,43,149,62,41,165,211,199,205,92,198,201,46,145,3,247,13,205,62,169,108,137,247,201,184,180,66,91,50,142,159,78,169,231,101,148,122,195,114,220,67,175,231,63,98,144,63,98,168,187,119,206,59,223,19,13,99,84,242,212,83,222,155,125,83,222,242,179,92,146,197,243,34,124,137,111,172,238,226,214,202,141,227,219,48,154,77,65,105,174,89,3,87,177,197,111,26,234,167,142,221,95,210,224,79,31,138,197,150,205,8,234,235,130,141,237,195,117,172,76,239,245,103,245,69,120,229,7,246,150,95,86,151,101,49,43,76,147,186,218,243,3,180,110,156,200,79,252,178,37,104,195,221,38,189,11,120,214,16,202,95,134,225,162,104,159,158,2,185,185,23,84,189,41,222,223,99,26,183,237,167,232,248,58,77,102,225,109,208,152,241,133,123,7,88,131,187,45,27,16,21,101,53,78,244,233,19,232,247,214,150,25,174,184,57,87,124,9,98,109,201,164,95,201,68,43,196,46,51,16,220,150,250,121,34,5,219,16,98,86,242,221,248,65,204,91,248,184,7,214,42,241,166,34,75,211,247,15,82,137,228,213,168,231,52,99,23,83,89,230,249,231,188,226,31,253,227,235,240,86,252,122,47,63,183,137,104,67,29,32,246,61,252,117,30,164,235,210,183,63,151,119,250,187,21,24,54,65,2,126,166,208,78,104,62,83,228,19,23,236,222,4,10,203,54,53,197,142,77,218,73,169,190,115,216,210,171,114,195,104,190,10,225,51,9,153,248,96,171,211,238,124,112,212,86,1,204,86,223,254,120,180,247,94,128,81,191,98,203,14,225,214,199,14,224,157,248,42,217,241,45,69,7,57,21,180,44,243,77,148,105,215,246,221,136,4,73,170,38,110,49,212,34,246,131,213,182,241,171,246,34,55,80,123,178,70,126,179,22,160,67,50,81,69,127,56,112,38,208,249,31,157,209,192,233,177,177,67,65,3,190,49,157,79,223,113,201,125,235,187,251,55,102,5,18,200,116,236,140,207,173,35,26,220,36,141,119,65,53,140,55,173,183,85,105,161,253,54,239,205,14,77,206,120,176,246,65,85,105,111,40,225,43,108,144,69,85,208,32,185,118,164,154,177,118,23,233,78,129,195,255,83,139,227,102,83,108,80,133,109,201,224,121,115,240,126,212,30,76,152,243,197,233,92,64,164,7,49,158,14,246,54,136,217,100,200,206,47,222,245,186,29,85,76,70,101,155,196,54,169,18,215,187,246,132,93,166,243,57,106,1,120,33,250,56,11,97,23,74,237,242,114,85,212,255,190,216,18,205,108,61,192,157,208,20,62,102,7,134,216,98,216,196,239,141,60,53,254,23,86,2,138,45,66,207,85,31,188,82,201,107,0,34,40,103,126,148,88,159,31,214,50,250,5,177,165,143,254,176,184,155,0,122,235,138,39,91,226,156,165,187,176,103,124,181,92,176,35,118,131,91,225,142,34,182,178,98,136,182,93,252,36,201,202,115,103,179,8,60,145,149,131,113,15,244,68,125,27,204,186,248,100,176,222,210,85,196,245,109,49,5,7,189,108,139,195,89,26,44,114,167,214,86,233,38,14,110,25,86,20,232,107,221,42,90,23,186,192,3,48,49,41,30,209,48,95,164,16,77,130,37,104,50,159,147,182,134,248,61,43,122,53,220,217,31,196,174,154,39,1,14,17,155,145,91,163,98,104,202,104,67,53,244,4,125,26,153,138,143,159,104,115,152,252,114,173,184,53,84,126,138,101,27,197,152,53,193,182,157,179,51,126,153,94,53,232,95,50,192,218,234,203,15,6,54,190,36,159,93,182,32,82,73,78,177,68,253,57,86,40,142,21,198,226,171,100,243,229,177,137,32,228,240,147,95,34,11,85,208,174,215,183,54,104,229,157,105,202,11,190,71,252,150,184,42,8,192,143,137,51,19,140,131,154,252,184,48,243,
+53,50,60,248,75,250,72,201,202,4,173,186,194,65,39,205,73,214,68,28,212,176,18,241,185,179,237,183,11,63,144,3,176,208,234,41,225,45,248,120,64,142,151,45,95,169,97,19,133,74,233,221,133,116,140,72,238,211,42,250,142,1,37,120,237,174,67,79,9,174,120,132,172,92,220,61,136,13,216,54,9,17,128,137,110,75,60,141,31,33,46,203,48,17,132,219,162,242,36,92,149,224,129,100,219,140,151,105,140,138,251,126,180,61,123,249,148,107,210,94,54,178,85,207,198,162,192,88,116,134,231,95,81,41,66,176,189,36,1,80,119,176,248,232,242,138,109,182,32,43,250,60,57,10,111,33,174,208,246,96,190,152,201,48,3,108,3,140,246,24,216,90,230,161,78,177,115,125,215,112,70,121,78,101,125,59,191,137,144,52,153,207,8,242,131,95,209,20,14,127,221,168,45,186,134,142,49,50,45,223,13,117,74,212,207,10,183,125,77,204,189,2,131,127,133,79,113,50,155,241,245,52,198,115,109,240,112,187,73,119,240,53,243,217,207,233,16,194,95,103,35,232,66,14,117,252,20,24,74,215,11,162,239,246,251,247,35,231,61,46,186,218,53,104,238,86,88,189,23,210,184,223,238,245,30,15,147,97,95,5,20,20,112,222,59,163,71,194,164,185,87,129,148,255,20,236,65,17,41,230,85,0,141,156,118,239,145,224,8,214,85,192,136,234,31,9,142,98,110,207,22,247,35,2,46,143,133,135,88,87,17,15,126,11,246,104,131,190,127,15,48,185,207,3,31,28,145,228,95,166,199,86,225,253,109,227,170,20,42,172,161,138,109,84,136,238,101,26,203,67,170,100,26,21,166,251,88,198,242,144,170,88,70,133,232,30,134,177,60,160,10,134,81,225,169,108,23,203,163,41,109,23,21,150,123,152,197,242,104,170,152,69,13,168,170,85,172,0,167,172,85,52,3,190,239,60,218,104,239,87,199,82,221,38,86,3,84,198,38,174,221,232,222,209,34,157,211,22,120,124,55,40,93,67,41,139,152,193,83,213,30,86,4,84,206,30,102,16,85,180,134,21,1,149,178,134,25,60,213,108,97,69,56,101,108,97,6,77,21,75,88,17,203,126,75,152,65,82,205,14,86,196,82,202,14,102,225,84,176,130,85,193,236,181,130,185,33,222,119,30,109,124,247,171,34,169,100,1,239,1,167,172,5,188,103,72,168,16,173,246,67,42,29,18,218,112,238,107,255,74,226,41,111,255,238,25,12,86,196,83,218,252,221,47,18,172,136,166,172,245,187,79,24,88,17,74,57,227,119,191,24,176,34,148,210,182,239,62,1,96,85,44,165,76,223,125,162,191,202,3,187,95,17,200,189,12,95,5,52,101,12,31,29,217,25,20,219,61,153,177,13,145,40,186,27,142,100,95,202,232,89,80,54,109,158,202,121,0,48,229,44,158,133,102,195,224,201,140,7,192,82,202,218,89,80,242,198,78,164,31,0,72,25,67,103,225,56,117,58,221,126,198,212,137,140,7,64,162,89,151,132,146,53,185,152,122,0,16,251,141,173,45,140,74,182,182,138,40,202,216,89,27,72,214,204,66,234,33,64,236,53,176,25,27,98,219,87,76,61,136,245,232,87,67,144,51,172,91,79,57,187,39,150,50,118,245,91,234,226,161,185,220,182,172,77,246,109,67,87,246,216,88,197,102,55,54,93,153,174,168,64,115,118,67,84,70,177,8,227,62,219,91,17,164,169,170,50,74,105,46,139,64,238,177,201,21,49,234,138,42,67,84,91,187,54,17,238,182,213,21,1,170,106,42,227,147,230,181,8,224,30,27,94,17,161,174,168,50,68,52,190,69,248,118,217,246,138,224,68,21,213,133,71,5,10,101,183,211,230,87,21,157,172,166,200,254,239,67,8,140,10,241,237,112,6,85,209,81,21,149,101,135,150,179,216,2,246,157,7,51,127,253,251,34,35,155,190,13,222,78,231,113,15,140,178,178,82,238,221,93,173,162,240,251,180,172,63,217,173,135,57,102,187,33,231,107,174,228,92,138,96,239,242,49,143,136,187,154,191,41,2,190,195,237,60,34,238,74,62,168,8,246,118,87,244,136,168,171,56,166,34,208,219,140,255,35,66,46,239,12,138,0,223,215,39,252,16,228,93,30,98,27,106,218,122,142,167,184,39,126,224,37,197,83,254,221,49,74,33,163,82,192,115,117,151,90,15,216,14,123,115,121,224,137,112,151,91,58,216,14,124,99,37,225,137,112,151,90,102,216,14,187,218,170,
+195,131,161,46,179,38,177,29,116,118,93,224,137,32,239,95,55,216,14,184,218,124,225,193,32,87,176,123,69,160,51,75,14,79,5,121,239,146,196,46,147,215,119,254,13,246,174,255,67,128,115,11,26,79,136,122,115,173,163,2,244,78,111,248,238,201,81,139,74,119,58,68,47,140,162,6,63,54,113,52,63,169,188,250,141,60,118,195,163,90,116,21,165,92,158,2,102,66,86,64,86,125,49,188,36,54,83,75,57,191,166,208,233,192,20,192,85,93,27,47,9,77,87,81,202,115,41,96,42,246,4,92,213,92,86,73,84,138,127,25,199,164,48,137,224,18,16,149,95,167,46,137,70,112,222,239,113,20,18,21,51,2,150,106,145,106,73,60,187,98,210,231,93,251,5,159,137,52,188,240,144,181,163,191,57,94,184,205,70,254,223,55,124,203,119,153,179,95,26,107,253,173,100,246,56,11,86,252,245,63,20,137,233,156,243,237,31,120,0,201,243,29,17,251,250,72,141,166,217,204,183,175,5,160,203,244,234,208,55,117,117,210,53,126,234,9,120,233,92,138,165,104,6,29,38,224,209,129,21,244,229,143,60,177,70,156,26,131,253,122,195,239,240,212,145,152,53,14,24,252,39,147,236,83,123,212,249,208,30,53,126,62,58,100,131,225,132,13,46,122,61,118,62,234,246,219,163,175,236,163,243,21,191,168,235,14,198,206,104,130,230,113,152,99,37,159,14,129,77,239,194,25,3,231,198,139,246,233,233,139,195,166,124,236,119,7,58,113,54,113,70,58,161,134,179,206,232,245,204,163,77,216,251,220,254,58,214,169,129,225,61,248,170,31,199,29,243,248,181,223,119,38,163,174,201,153,12,251,86,234,98,50,156,118,7,32,157,190,51,152,168,220,119,206,217,112,228,152,212,123,131,250,29,68,37,230,121,242,217,113,204,43,178,204,86,10,164,212,109,247,76,198,0,100,168,83,16,41,232,103,157,219,177,154,221,129,102,180,79,29,43,105,63,235,122,160,183,12,58,236,58,251,185,221,177,68,215,249,224,116,62,234,132,85,127,103,216,238,57,227,142,97,63,236,247,187,147,108,106,226,156,154,140,193,120,50,106,91,109,133,156,79,160,17,38,121,110,90,52,28,141,156,241,249,112,112,218,29,188,215,153,164,140,38,53,28,235,30,237,92,0,189,197,89,36,167,167,54,189,204,27,13,123,27,121,24,54,22,229,81,40,153,127,65,135,209,203,188,211,182,134,124,234,116,172,71,252,29,193,74,246,218,70,49,78,157,179,246,69,111,98,146,61,103,98,189,236,117,65,110,206,104,108,114,140,94,158,14,205,19,122,44,157,26,13,53,76,167,221,249,160,159,207,64,35,117,77,78,207,232,2,62,119,207,116,10,84,249,235,185,213,89,142,25,33,80,125,251,220,148,131,30,211,77,118,190,116,156,243,137,149,234,93,24,205,115,190,116,199,147,177,73,65,155,6,70,38,144,70,53,83,201,179,182,133,237,172,55,108,155,55,195,94,111,248,217,210,2,104,145,245,232,116,223,107,53,62,27,13,251,250,249,194,12,9,117,4,131,74,191,119,6,206,168,109,181,246,61,104,181,129,70,65,131,73,12,47,180,104,63,180,63,89,64,62,12,47,52,146,15,23,239,29,75,179,187,167,160,40,221,137,22,148,145,116,183,215,253,168,27,106,70,160,56,47,85,39,6,70,195,132,213,52,41,251,17,195,76,59,57,194,51,66,172,12,173,45,221,177,121,26,246,218,182,48,254,57,52,40,122,206,153,46,110,227,36,149,212,137,97,199,200,138,18,246,232,209,25,153,161,3,185,31,141,184,251,206,105,247,162,111,53,165,239,140,222,107,14,240,226,194,140,135,254,112,48,209,234,60,104,79,46,70,166,242,129,243,217,60,126,209,220,6,195,206,215,142,25,27,131,97,191,253,133,28,139,149,211,29,228,114,172,210,134,169,165,67,248,108,122,113,112,1,144,141,59,24,158,153,167,179,177,163,121,13,123,186,205,70,224,195,65,79,235,197,240,220,238,10,163,216,195,209,169,233,217,225,228,131,101,14,134,23,150,109,30,126,50,207,231,237,209,196,242,27,148,180,185,159,15,199,217,244,200,233,56,182,121,133,12,80,181,79,142,73,147,251,182,146,159,186,61,80,185,177,201,25,2,135,11,99,217,68,236,172,82,48,140,76,175,130,233,62,181,158,123,230,25,76,253,233,216,36,207,28,48,178,29,103,35,199,2,10,94,119,56,177,56,15,218,125,43,117,14,
+78,162,109,217,70,200,1,80,109,147,4,205,52,3,10,147,208,147,86,26,143,201,203,166,44,44,159,134,102,84,140,186,239,63,152,114,96,166,222,181,141,163,28,13,63,235,98,99,24,9,6,207,184,253,201,57,31,90,218,15,131,118,104,204,173,56,3,198,164,254,186,64,113,152,180,29,27,136,84,247,191,237,230,142,157,241,24,122,57,227,165,44,149,28,119,51,88,228,36,90,167,135,70,146,99,16,219,100,122,110,201,106,60,57,53,182,2,18,160,138,38,53,28,181,77,111,131,76,157,118,223,74,89,189,55,190,120,151,203,200,199,90,160,239,186,154,73,215,168,130,92,143,208,73,109,222,192,149,12,198,237,140,141,87,71,68,234,164,25,236,23,131,119,195,11,176,183,167,38,99,35,88,185,24,108,184,68,186,131,193,74,252,101,113,60,183,3,13,91,242,23,99,171,161,34,186,53,169,145,29,119,65,242,171,77,219,53,198,237,179,37,15,120,54,227,237,243,135,174,233,75,188,75,79,63,15,71,90,19,63,143,186,6,219,151,126,15,98,102,59,53,1,73,189,3,155,50,182,50,81,28,86,52,69,57,131,78,219,206,56,29,118,46,114,52,160,184,185,28,244,207,99,59,3,71,234,248,188,221,201,212,6,42,54,182,1,158,119,173,4,29,17,102,165,229,189,55,38,99,98,89,126,72,130,140,187,162,51,96,198,65,83,128,162,201,11,12,8,92,133,56,101,104,140,139,79,95,210,180,153,157,12,27,243,33,113,240,56,158,151,164,166,68,38,7,79,16,101,122,161,170,112,94,212,204,23,161,25,177,154,77,157,252,98,205,166,132,202,201,163,73,62,225,193,86,120,228,194,13,204,196,197,241,5,223,22,175,252,192,91,164,51,254,10,79,181,146,135,130,181,96,78,199,241,108,173,116,105,85,19,255,73,55,129,209,33,80,111,217,81,83,28,143,240,150,29,55,217,146,71,87,124,170,94,189,198,163,192,96,62,185,132,231,159,241,240,167,101,152,208,133,0,77,113,187,245,10,166,207,174,166,254,149,110,124,27,0,201,159,226,232,173,152,29,3,243,99,96,123,114,68,211,205,215,71,226,178,177,187,0,230,156,48,211,116,23,11,117,37,92,234,193,100,186,137,104,15,232,162,92,117,211,43,205,93,91,236,52,164,137,183,119,237,6,87,92,204,88,93,186,242,236,206,220,97,119,121,199,134,167,239,58,242,120,57,186,91,35,110,192,211,20,122,96,74,125,54,157,124,61,119,198,226,238,153,127,2,41,52,55,185,14,161,151,175,120,66,244,19,148,78,131,8,144,141,202,198,211,30,242,243,215,76,215,103,122,189,153,239,81,123,102,11,2,121,97,59,40,16,142,61,218,65,226,34,30,98,54,17,200,94,26,213,76,246,47,144,45,188,97,38,251,87,202,38,183,103,242,241,236,159,109,98,199,246,224,89,65,225,229,223,76,236,218,78,160,77,238,108,6,175,142,143,88,18,138,210,113,75,94,54,210,146,231,203,226,233,106,116,109,172,253,78,242,242,241,244,221,148,31,182,168,145,216,234,241,215,241,196,201,54,0,85,67,229,43,33,236,4,10,156,87,97,132,247,223,229,113,130,134,133,17,42,216,78,180,226,200,93,92,132,194,219,63,132,142,226,250,142,102,43,59,30,143,251,242,147,169,56,49,75,180,225,4,219,32,166,10,12,240,158,131,199,131,65,108,183,230,53,82,80,4,188,73,80,96,142,108,5,42,97,145,108,242,221,70,201,28,66,156,177,76,185,236,210,230,41,95,46,99,163,142,31,196,70,225,176,255,147,253,199,140,207,241,26,114,97,228,167,167,16,203,129,159,30,116,190,162,97,18,227,215,202,59,105,178,86,171,5,47,96,72,103,104,127,105,109,140,213,77,137,108,10,163,89,216,80,123,232,146,178,218,14,232,36,55,150,113,240,118,134,189,139,254,192,26,183,120,154,178,25,174,214,80,199,97,106,5,11,191,65,50,55,85,253,29,249,103,34,153,63,32,103,248,217,204,15,105,96,217,179,71,26,81,103,166,206,99,196,152,11,35,143,17,103,62,122,63,70,172,239,64,146,163,225,249,185,14,123,142,17,51,74,184,80,131,55,196,90,66,141,55,202,236,214,101,181,246,155,209,228,76,102,105,61,206,150,202,104,241,235,163,7,242,180,70,137,207,232,36,120,208,92,186,117,117,138,226,70,149,61,155,226,162,37,58,86,32,232,246,38,232,86,207,166,226,130,175,95,232,245,160,221,251,
+58,233,118,216,175,152,234,13,219,48,21,100,191,109,170,116,94,48,121,153,52,11,218,187,161,204,96,96,221,72,19,90,90,125,174,206,61,178,52,187,173,127,159,201,21,64,205,57,243,23,120,35,107,238,13,106,207,153,57,158,9,127,5,64,219,43,79,115,181,198,65,59,112,23,119,184,244,156,99,128,131,162,23,186,179,12,235,2,77,204,73,163,132,30,230,74,148,212,194,5,132,31,169,123,165,53,81,165,75,43,161,46,144,141,244,30,92,255,72,235,64,1,167,61,152,134,79,17,19,88,10,147,1,64,209,168,154,12,60,253,239,196,206,64,29,205,50,57,255,74,58,105,241,56,199,188,223,154,25,154,19,246,123,174,156,160,59,97,127,100,9,95,83,112,152,39,131,220,227,29,202,110,201,223,18,125,51,43,214,124,184,213,13,228,239,77,29,43,230,50,11,180,100,33,255,234,89,154,62,178,52,243,252,14,34,68,91,29,69,6,235,187,120,99,177,101,168,69,254,137,101,168,101,78,150,148,44,182,120,243,218,182,217,50,75,19,239,82,114,35,133,42,138,110,74,237,86,118,152,250,100,172,173,74,151,214,113,93,224,17,34,5,156,205,32,111,60,173,24,103,53,88,94,213,247,39,91,193,99,147,165,244,239,28,254,109,21,253,234,164,26,103,181,171,153,197,156,87,160,243,200,95,98,112,248,145,223,89,26,116,17,248,223,32,164,52,153,168,72,103,242,202,7,202,45,158,131,150,183,81,134,120,119,143,209,93,95,153,62,51,57,165,123,205,42,242,72,179,208,124,191,249,179,239,178,223,240,30,4,0,250,93,220,34,45,158,194,149,204,10,66,241,23,47,30,199,123,195,41,69,7,116,226,229,212,28,111,234,248,190,217,209,25,153,100,196,209,204,55,53,223,221,31,0,141,213,207,255,4,72,86,15,15,177,86,182,138,120,140,7,46,131,55,187,54,228,104,60,6,225,75,226,111,57,199,174,64,110,57,197,161,128,94,168,34,54,242,18,74,98,147,239,86,19,0,177,246,23,28,172,36,93,195,45,85,37,155,43,212,101,183,166,228,74,60,114,36,133,101,113,241,121,42,155,13,93,66,73,177,234,134,78,139,146,178,255,127,150,73,241,179,154,244,69,148,163,182,129,28,255,42,73,132,48,95,159,108,168,206,134,156,54,68,212,44,146,193,70,116,101,47,229,162,230,100,214,9,73,47,236,31,119,126,167,235,87,172,31,3,17,232,11,137,90,233,23,178,209,63,80,65,203,2,254,61,161,5,16,152,176,94,210,201,255,26,88,140,187,205,112,125,6,23,103,194,0,38,210,184,21,66,222,0,133,167,60,139,107,204,148,218,10,180,205,12,198,95,76,126,6,234,175,26,123,150,254,183,60,125,246,245,31,230,117,182,161,71,90,56,185,23,199,121,96,185,247,39,6,72,246,197,235,13,36,217,247,63,231,91,144,123,255,203,150,150,104,178,130,113,155,87,155,18,99,55,95,36,51,126,159,119,183,20,236,110,105,167,16,38,69,172,223,250,200,163,56,225,129,150,82,236,69,254,42,97,87,254,154,211,186,32,155,129,53,185,116,99,220,9,179,244,3,108,146,155,64,73,63,136,9,2,32,71,42,215,75,82,119,65,141,11,195,132,204,180,18,201,10,106,240,177,142,196,30,54,248,102,233,126,247,151,233,18,175,159,184,187,138,194,20,178,113,1,18,185,208,114,24,152,100,144,184,56,104,221,199,187,95,102,41,204,166,88,186,10,169,210,37,173,147,190,187,19,171,153,232,66,196,137,210,116,200,250,18,186,121,65,135,226,202,5,218,153,31,65,79,47,32,162,65,42,131,114,30,70,200,230,142,147,22,92,226,241,237,46,46,132,169,118,199,212,73,151,120,210,53,222,170,194,103,45,125,119,128,104,180,170,49,219,114,40,195,191,211,206,212,43,35,66,193,137,124,238,101,246,134,17,129,113,69,77,196,34,102,23,152,96,222,56,196,82,221,4,23,139,209,101,226,138,93,98,67,144,199,104,187,243,185,235,71,49,222,35,202,91,26,25,240,1,101,188,161,138,231,230,226,69,220,184,100,93,173,37,197,221,164,23,171,48,142,125,186,85,89,175,233,209,45,75,146,136,68,15,163,72,238,69,139,217,45,39,151,4,195,1,143,223,193,114,33,155,113,28,80,56,139,7,168,126,196,220,53,39,56,11,30,92,37,215,91,46,117,170,75,208,245,252,153,200,224,103,107,117,177,231,202,62,248,152,222,217,25,162,121,
+25,18,112,234,118,26,117,195,74,231,47,92,32,30,105,96,174,96,58,168,33,135,91,127,150,92,203,19,152,165,8,253,127,113,67,115,205,221,85,46,7,4,6,250,163,211,43,146,32,222,74,192,221,128,14,109,150,161,152,85,83,28,210,49,239,134,40,226,235,141,188,122,74,49,115,221,202,162,32,14,34,56,201,169,240,4,104,45,218,130,3,157,245,187,226,35,157,173,94,17,97,72,68,65,197,146,20,113,142,122,64,29,19,171,27,39,133,18,161,178,172,253,25,106,168,114,147,187,187,156,197,153,187,93,158,251,255,177,251,191,76,63,64,159,62,247,202,255,243,94,105,50,239,185,143,158,166,143,208,249,231,124,219,134,235,119,163,75,63,33,167,169,124,127,19,61,228,28,92,115,130,87,93,80,12,64,30,146,22,185,253,36,150,6,20,111,196,91,44,194,91,17,25,184,50,6,18,66,86,241,84,132,55,106,36,190,248,201,141,187,222,181,52,174,228,147,219,218,233,83,4,196,236,16,8,237,52,133,72,40,107,8,35,128,51,49,198,176,239,58,188,197,216,4,170,254,83,105,161,40,36,47,135,200,198,84,15,166,80,90,61,234,234,110,131,172,2,213,106,120,55,143,188,231,100,198,130,116,121,201,35,146,68,10,65,70,12,244,250,139,33,93,4,151,68,50,82,83,36,86,113,25,182,64,121,136,102,151,22,2,44,173,226,20,161,183,134,26,127,25,245,22,225,37,148,2,247,199,35,142,199,17,106,77,194,146,244,251,185,27,103,194,42,77,138,50,35,125,204,150,241,129,63,6,159,116,27,168,79,215,12,5,156,83,104,38,21,128,127,47,173,204,117,165,205,74,28,212,158,64,173,241,224,213,47,146,35,248,113,212,65,140,249,69,71,171,48,119,246,55,204,30,240,55,98,188,196,98,78,129,0,69,154,65,226,123,254,138,186,1,148,22,70,135,14,107,81,159,116,80,108,171,157,100,137,136,214,88,140,46,79,6,26,47,141,34,156,15,104,14,105,140,183,86,108,187,152,196,210,61,31,175,43,187,228,208,178,131,26,100,240,132,91,247,89,230,181,20,6,107,13,230,41,48,88,196,157,28,133,68,96,56,68,180,243,165,165,84,186,137,207,66,153,233,81,170,177,200,70,5,198,39,173,185,152,32,165,109,226,111,3,153,23,115,119,129,35,255,75,75,116,29,62,233,126,36,110,178,3,241,89,155,161,162,152,139,125,193,182,164,171,25,157,37,188,173,25,137,209,53,246,150,182,13,28,212,228,117,244,97,0,195,161,33,255,232,118,202,70,30,210,197,92,212,198,67,156,208,193,232,174,169,155,220,69,9,245,183,62,191,145,101,91,226,142,56,188,11,236,70,112,145,57,135,148,5,138,15,28,85,30,59,4,142,184,175,184,70,95,78,180,234,120,11,110,157,181,199,184,12,38,168,235,120,159,89,77,189,15,105,90,46,72,12,183,12,137,136,51,5,19,141,33,67,33,67,82,197,68,2,7,10,218,253,197,152,13,221,135,65,249,86,65,145,204,167,144,137,252,240,218,98,253,198,38,20,45,204,82,105,241,104,66,85,133,120,83,200,20,47,0,174,179,255,98,47,233,82,239,18,253,108,89,189,183,76,153,76,28,233,49,94,241,67,215,81,41,10,165,2,210,244,190,101,47,228,133,198,47,208,156,137,220,183,47,208,172,189,120,115,192,131,153,185,26,79,122,8,115,113,217,230,220,222,11,113,174,151,152,85,2,44,171,93,163,156,162,46,233,230,59,97,135,111,226,21,222,248,136,6,78,154,56,107,121,64,221,143,70,38,75,44,17,164,43,120,127,73,75,3,180,36,128,45,211,83,83,50,100,76,108,106,1,115,33,22,10,132,17,153,181,84,43,20,246,136,127,75,253,136,102,44,84,175,109,162,113,181,60,38,55,184,90,248,9,34,6,107,47,204,222,202,141,132,221,195,111,171,138,3,52,19,210,52,2,43,32,243,245,117,176,51,125,169,146,10,203,100,168,33,13,153,135,130,171,81,251,144,1,116,145,52,232,47,16,130,250,197,151,249,111,178,68,162,19,109,138,147,159,242,52,241,18,36,134,107,230,89,58,152,218,229,41,55,136,126,46,32,18,184,179,116,191,23,208,93,167,87,124,131,240,248,215,2,74,125,117,217,14,166,138,86,43,46,82,194,32,18,114,19,52,240,156,52,200,247,74,89,179,127,252,3,184,228,229,183,131,24,224,21,201,104,71,137,215,39,133,2,171,113,176,250,249,134,
+212,56,174,21,187,120,145,87,225,123,243,90,140,193,34,69,83,113,114,35,89,21,169,217,45,219,161,99,16,101,48,44,246,143,255,178,228,72,163,76,102,146,5,128,120,93,136,86,162,59,146,200,252,249,27,117,41,36,59,62,58,249,249,136,253,39,84,252,19,187,221,9,23,98,118,130,123,169,3,20,141,118,27,76,99,195,130,48,120,137,230,133,198,62,250,11,209,134,75,237,217,178,72,109,57,218,104,143,118,33,84,179,8,4,105,228,24,20,204,163,54,132,153,27,168,0,4,108,138,214,105,186,221,58,155,169,71,98,38,119,35,67,142,176,76,158,26,77,153,204,25,247,32,40,94,228,50,161,137,121,44,106,124,101,178,65,24,249,162,97,138,123,73,242,114,37,197,167,190,62,106,29,159,88,3,64,203,154,149,20,182,237,202,30,111,109,47,63,255,188,223,124,243,17,231,151,58,124,149,50,147,209,103,215,138,62,187,38,250,236,90,209,103,87,71,159,148,139,237,204,52,176,97,19,200,136,20,178,116,168,112,104,53,61,67,107,72,40,101,102,68,135,82,52,170,132,153,245,88,24,144,200,30,72,6,156,170,3,41,186,58,6,238,218,49,112,215,138,129,187,58,6,62,168,109,15,234,89,55,167,100,230,182,123,139,116,203,141,247,25,21,124,35,231,203,233,146,118,37,200,144,70,206,122,11,162,6,159,66,4,119,237,250,11,162,113,205,125,218,136,65,71,28,110,250,221,95,248,200,82,244,13,4,68,65,152,200,104,72,253,230,33,226,32,95,92,29,138,182,78,170,146,90,39,197,223,64,194,116,49,163,41,89,122,133,0,212,207,72,174,88,137,111,68,180,7,220,79,82,154,232,30,110,200,67,68,200,86,147,15,140,80,242,83,128,38,224,106,80,183,29,98,187,140,122,129,116,26,70,197,232,165,73,202,247,74,169,232,173,74,168,119,52,178,196,27,122,148,249,102,132,137,10,117,82,213,137,211,66,177,41,90,8,230,173,152,77,9,143,139,214,94,92,168,76,190,244,136,129,70,16,31,45,251,131,45,157,206,240,135,166,21,46,174,228,69,240,252,33,252,83,255,84,40,247,146,171,182,211,106,205,154,71,52,36,204,199,246,54,231,86,209,126,12,250,218,30,12,152,23,55,180,139,192,105,150,186,247,184,192,77,232,21,73,249,158,60,100,230,26,221,186,248,25,203,178,255,27,174,197,216,122,157,19,248,11,219,101,128,20,214,244,235,156,172,22,6,89,38,189,223,165,28,110,187,63,214,197,157,158,96,109,161,10,224,42,174,7,207,97,46,90,200,148,197,126,128,107,19,87,42,117,124,244,216,53,52,89,114,185,248,183,212,134,55,182,151,171,249,217,106,20,88,13,218,41,35,191,97,209,87,185,179,20,15,49,4,236,183,27,107,204,64,103,200,204,46,108,127,118,120,80,131,230,54,164,223,242,229,42,162,166,61,20,45,71,3,241,70,30,121,34,73,69,216,153,225,91,112,163,45,8,240,10,108,128,36,157,138,165,151,169,92,58,98,238,28,119,99,203,245,24,21,199,202,119,184,136,64,171,239,244,227,59,69,8,248,161,13,210,228,216,64,168,193,118,215,167,54,70,20,84,167,222,149,168,46,145,223,88,65,109,249,46,144,76,140,252,101,37,138,59,46,42,73,82,49,191,122,179,193,66,181,123,131,135,122,177,133,7,30,17,68,93,135,182,16,250,239,236,163,58,57,197,159,197,77,181,246,189,196,206,209,249,168,91,71,172,129,10,111,159,181,114,120,32,119,171,81,120,67,91,245,240,63,220,33,164,87,215,160,238,134,92,188,196,202,70,195,126,166,215,196,218,31,141,98,156,148,221,197,47,14,101,158,205,225,136,225,250,156,201,193,173,120,221,129,205,216,132,23,130,49,24,106,11,155,81,185,255,39,216,176,35,150,184,63,35,70,211,136,122,115,197,147,88,126,159,197,103,7,226,211,93,160,251,63,2,139,26,57,
 0};
 unsigned char* createdb_inline = 0;
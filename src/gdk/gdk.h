@@ -636,7 +636,8 @@ typedef struct {
 	unsigned int copied:1,	/* a copy of an existing map. */
 		hashash:1,	/* the string heap contains hash values */
 		forcemap:1,	/* force STORE_MMAP even if heap exists */
-		cleanhash:1;	/* string heaps must clean hash */
+		cleanhash:1,	/* string heaps must clean hash */
+		strdict:1;	/* string heap is a sorted dictionary */
 	storage_t storage;	/* storage mode (mmap/malloc). */
 	storage_t newstorage;	/* new desired storage mode at re-allocation. */
 	bte dirty;		/* specific heap dirty marker */
@@ -775,6 +776,7 @@ gdk_export int VALisnil(const ValRecord *v);
  *           Hash   *thash;           // linear chained hash table on tail
  *           Imprints *timprints;     // column imprints index on tail
  *           orderidx torderidx;      // order oid index on tail
+ *           Heap   *tzonemap;        // per-block min/max zone map on tail
  *  } BAT;
  * @end verbatim
  *
@@ -842,6 +844,7 @@ typedef struct {
 	Hash *hash;		/* hash table */
 	Imprints *imprints;	/* column imprints index */
 	Heap *orderidx;		/* order oid index */
+	Heap *zonemap;		/* per-block min/max zone map */
 
 	PROPrec *props;		/* list of dynamic properties stored in the bat descriptor */
 } COLrec;
@@ -912,6 +915,7 @@ typedef struct BATiter {
 #define tvheap		T.vheap
 #define thash		T.hash
 #define timprints	T.imprints
+#define tzonemap	T.zonemap
 #define tprops		T.props
 
 
@@ -1479,6 +1483,7 @@ gdk_export char *GDKfilepath(int farmid, const char *dir, const char *nme, const
 gdk_export int GDKinmemory(void);
 gdk_export gdk_return GDKcreatedir(const char *nme);
 
+gdk_export int BATcheckorderidx(BAT *b);
 gdk_export void OIDXdestroy(BAT *b);
 
 /*
@@ -1522,6 +1527,7 @@ gdk_export int BATordered(BAT *b);
 gdk_export int BATordered_rev(BAT *b);
 gdk_export gdk_return BATsort(BAT **sorted, BAT **order, BAT **groups, BAT *b, BAT *o, BAT *g, int reverse, int stable)
 	__attribute__ ((__warn_unused_result__));
+gdk_export BAT *BATstrdict(BAT *b);
 
 
 gdk_export void GDKqsort(void *h, void *t, const void *base, size_t n, int hs, int ts, int tpe);
@@ -1932,6 +1938,11 @@ gdk_export lng IMPSimprintsize(BAT *b);
 gdk_export gdk_return BATorderidx(BAT *b, int stable);
 gdk_export gdk_return GDKmergeidx(BAT *b, BAT**a, int n_ar);
 
+/* The zone map: per-block minimum, maximum and nil count */
+
+gdk_export gdk_return BATzonemap(BAT *b);
+gdk_export void ZMdestroy(BAT *b);
+
 /*
  * @- Multilevel Storage Modes
  *
@@ -2076,6 +2087,7 @@ gdk_export BUN void_replace_bat(BAT *b, BAT *p, BAT *u, bit force)
 gdk_export gdk_return void_inplace(BAT *b, oid id, const void *val, bit force)
 	__attribute__ ((__warn_unused_result__));
 gdk_export BAT *BATattach(int tt, const char *heapfile, int role);
+gdk_export BAT *BATwrap(int tt, void *base, BUN cnt);
 
 #ifdef NATIVE_WIN32
 #ifdef _MSC_VER
@@ -2154,6 +2166,27 @@ gdk_export void *THRdata[THREADDATA];
 #define THRget_errbuf(t)	((char*)t->data[2])
 #define THRset_errbuf(t,b)	(t->data[2] = b)
 
+/*
+ * A query can be interrupted while the kernel works on it.  The
+ * thread(s) executing a query point at its query context, which
+ * long running kernel loops inspect every GDK_INTERRUPT_INTERVAL
+ * iterations through GDK_CHECK_INTERRUPT.
+ */
+typedef struct {
+	volatile int interrupted; /* set asynchronously to abort the query */
+	lng deadline;		/* GDKwallclock() after which the query times out, 0 for none */
+} QryCtx;
+
+#define QRYCTXtimedout(ctx)	((ctx)->deadline && GDKwallclock() > (ctx)->deadline)
+#define QRYCTXinterrupted(ctx)	((ctx)->interrupted || QRYCTXtimedout(ctx))
+
+#define GDK_INTERRUPT_INTERVAL	((BUN) 1 << 16)
+#define GDK_CHECK_INTERRUPT(i)	\
+	(((i) & (GDK_INTERRUPT_INTERVAL - 1)) == 0 && GDKinterrupted())
+
+gdk_export void GDKsetqryctx(QryCtx *ctx);
+gdk_export int GDKinterrupted(void);
+
 #ifndef GDK_NOLINK
 
 static inline bat
@@ -2566,6 +2599,9 @@ gdk_export gdk_return BATthetajoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl
 gdk_export gdk_return BATsemijoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches, BUN estimate)
 	__attribute__ ((__warn_unused_result__));
 gdk_export BAT *BATdiff(BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches, BUN estimate);
+gdk_export BAT *BATjoinfilter(BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches);
+gdk_export BAT *BATjoinfilterbuild(BAT *r, BAT *sr, BUN lcnt);
+gdk_export BAT *BATjoinfilterprobe(BAT *l, BAT *sl, BAT *f, int nil_matches);
 gdk_export gdk_return BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches, BUN estimate)
 	__attribute__ ((__warn_unused_result__));
 gdk_export gdk_return BATbandjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, const void *c1, const void *c2, int li, int hi, BUN estimate)
@@ -184,25 +184,40 @@ exchange(double *x, double *y)
 	*y = t;
 }
 
-/* this function was adapted from https://bugs.python.org/file10357/msum4.py */
-static BUN
-dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
-       void *restrict results, BUN ngrp, int tp1, int tp2,
-       const oid *restrict cand, const oid *candend, const oid *restrict gids,
-       oid min, oid max, int skip_nils, int abort_on_error,
-       int nil_if_empty, const char *func)
-{
-	struct pergroup {
-		int npartials;
-		int maxpartials;
-		int valseen;
+/* The state of the floating point summation of one group: a list of
+ * non-overlapping partial sums that add up exactly to the sum of the
+ * values seen so far, and a count of the overflows (multiples of
+ * 2*twopow) that were taken out of the partial sums.  If partials is
+ * NULL, the sum of the group is nil. */
+struct fsumgroup {
+	int npartials;
+	int maxpartials;
+	int valseen;
 #ifdef INFINITES_ALLOWED
-		float infs;
+	float infs;
 #else
-		int infs;
+	int infs;
 #endif
-		double *partials;
-	} *pergroup;
+	double *partials;
+};
+
+static void
+fsumfree(struct fsumgroup *pergroup, BUN ngrp)
+{
+	BUN grp;
+
+	for (grp = 0; grp < ngrp; grp++)
+		GDKfree(pergroup[grp].partials);
+	GDKfree(pergroup);
+}
+
+/* this function was adapted from https://bugs.python.org/file10357/msum4.py */
+static struct fsumgroup *
+fsumaccum(const void *restrict values, oid seqb, BUN start, BUN end,
+	  BUN ngrp, int tp1, const oid *restrict cand, const oid *candend,
+	  const oid *restrict gids, oid min, oid max, int skip_nils)
+{
+	struct fsumgroup *pergroup;
 	BUN listi;
 	int parti;
 	int i;
@@ -212,22 +227,9 @@ dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
 	double twopow = pow((double) FLT_RADIX, (double) (DBL_MAX_EXP - 1));
 	BUN nils = 0;
 
-	ALGODEBUG fprintf(stderr, "#%s: floating point summation\n", func);
-	/* we only deal with the two floating point types */
-	assert(tp1 == TYPE_flt || tp1 == TYPE_dbl);
-	assert(tp2 == TYPE_flt || tp2 == TYPE_dbl);
-	/* if input is dbl, then so it output */
-	assert(tp2 == TYPE_flt || tp1 == TYPE_dbl);
-	/* if no gids, then we have a single group */
-	assert(ngrp == 1 || gids != NULL);
-	if (gids == NULL || ngrp == 1) {
-		min = max = 0;
-		ngrp = 1;
-		gids = NULL;
-	}
 	pergroup = GDKmalloc(ngrp * sizeof(*pergroup));
 	if (pergroup == NULL)
-		return BUN_NONE;
+		return NULL;
 	for (grp = 0; grp < ngrp; grp++) {
 		pergroup[grp].npartials = 0;
 		pergroup[grp].valseen = 0;
@@ -235,10 +237,8 @@ dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
 		pergroup[grp].infs = 0;
 		pergroup[grp].partials = GDKmalloc(pergroup[grp].maxpartials * sizeof(double));
 		if (pergroup[grp].partials == NULL) {
-			while (grp > 0)
-				GDKfree(pergroup[--grp].partials);
-			GDKfree(pergroup);
-			return BUN_NONE;
+			fsumfree(pergroup, grp);
+			return NULL;
 		}
 	}
 	for (;;) {
@@ -263,10 +263,6 @@ dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
 		else {
 			/* it's a nil */
 			if (!skip_nils) {
-				if (tp2 == TYPE_flt)
-					((flt *) results)[grp] = flt_nil;
-				else
-					((dbl *) results)[grp] = dbl_nil;
 				GDKfree(pergroup[grp].partials);
 				pergroup[grp].partials = NULL;
 				if (++nils == ngrp)
@@ -313,10 +309,55 @@ dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
 		}
 		pergroup[grp].npartials = i;
 	}
+	return pergroup;
+
+  bailout:
+	fsumfree(pergroup, ngrp);
+	return NULL;
+}
+
+static BUN
+dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
+       void *restrict results, BUN ngrp, int tp1, int tp2,
+       const oid *restrict cand, const oid *candend, const oid *restrict gids,
+       oid min, oid max, int skip_nils, int abort_on_error,
+       int nil_if_empty, const char *func)
+{
+	struct fsumgroup *pergroup;
+	BUN grp;
+	double x, y;
+	volatile double lo, hi;
+	double twopow = pow((double) FLT_RADIX, (double) (DBL_MAX_EXP - 1));
+	BUN nils = 0;
+
+	ALGODEBUG fprintf(stderr, "#%s: floating point summation\n", func);
+	/* we only deal with the two floating point types */
+	assert(tp1 == TYPE_flt || tp1 == TYPE_dbl);
+	assert(tp2 == TYPE_flt || tp2 == TYPE_dbl);
+	/* if input is dbl, then so is output */
+	assert(tp1 == TYPE_flt || tp2 == TYPE_dbl);
+	/* if no gids, then we have a single group */
+	assert(ngrp == 1 || gids != NULL);
+	if (gids == NULL || ngrp == 1) {
+		min = max = 0;
+		ngrp = 1;
+		gids = NULL;
+	}
+	pergroup = fsumaccum(values, seqb, start, end, ngrp, tp1,
+			     cand, candend, gids, min, max, skip_nils);
+	if (pergroup == NULL)
+		return BUN_NONE;
 
 	for (grp = 0; grp < ngrp; grp++) {
-		if (pergroup[grp].partials == NULL)
+		if (pergroup[grp].partials == NULL) {
+			/* there was a nil */
+			if (tp2 == TYPE_flt)
+				((flt *) results)[grp] = flt_nil;
+			else
+				((dbl *) results)[grp] = dbl_nil;
+			nils++;
 			continue;
+		}
 		if (!pergroup[grp].valseen) {
 			if (tp2 == TYPE_flt)
 				((flt *) results)[grp] = nil_if_empty ? flt_nil : 0;
@@ -449,9 +490,7 @@ dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
   overflow:
 	GDKerror("22003!overflow in calculation.\n");
   bailout:
-	for (grp = 0; grp < ngrp; grp++)
-		GDKfree(pergroup[grp].partials);
-	GDKfree(pergroup);
+	fsumfree(pergroup, ngrp);
 	return BUN_NONE;
 }
 
@@ -830,6 +869,170 @@ BATgroupsum(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_
 	return bn;
 }
 
+/* Calculate per group of b (of type flt or dbl) a list of partial sums
+ * that add up exactly to the sum of the group.  The partial sums of
+ * all groups are returned in *partialsp (type dbl), and the group id
+ * plus off of each partial sum in *gidsp (if not NULL).  Groups
+ * without values have no partial sums, and a group with a nil (only
+ * if !skip_nils) has a single nil.  An overflow is represented by
+ * copies of +/-twopow.  Since partial sums can be added up exactly,
+ * summing the partial sums of all parts of an input, e.g. with
+ * BATgroupsum, gives the same result as summing the whole input,
+ * however it was divided. */
+gdk_return
+BATgroupsumpartials(BAT **partialsp, BAT **gidsp, BAT *b, BAT *g, BAT *e,
+		    BAT *s, oid off, int skip_nils)
+{
+	struct fsumgroup *pergroup = NULL;
+	const oid *restrict gids = NULL;
+	oid *dgids = NULL;
+	oid min, max;
+	BUN ngrp, start, end, grp, cnt, p;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+	double twopow = pow((double) FLT_RADIX, (double) (DBL_MAX_EXP - 1));
+	BAT *bn = NULL, *gn = NULL;
+	dbl *restrict vals;
+	oid *restrict grps;
+	int i, k, ninfs;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("BATgroupsumpartials: %s\n", err);
+		return GDK_FAIL;
+	}
+	if (b->ttype != TYPE_flt && b->ttype != TYPE_dbl) {
+		GDKerror("BATgroupsumpartials: type %s not supported.\n",
+			 ATOMname(b->ttype));
+		return GDK_FAIL;
+	}
+	if (BATcount(b) > 0 && ngrp > 0) {
+		if (g != NULL && BATtdense(g)) {
+			dgids = GDKmalloc(BATcount(g) * sizeof(oid));
+			if (dgids == NULL)
+				return GDK_FAIL;
+			for (p = 0; p < BATcount(g); p++)
+				dgids[p] = g->tseqbase + p;
+			gids = dgids + start;
+		} else if (g != NULL) {
+			gids = (const oid *) Tloc(g, start);
+		}
+		if (gids == NULL || ngrp == 1) {
+			min = max = 0;
+			ngrp = 1;
+			gids = NULL;
+		}
+		pergroup = fsumaccum(Tloc(b, 0), b->hseqbase, start, end, ngrp,
+				     b->ttype, cand, candend, gids, min, max,
+				     skip_nils);
+		GDKfree(dgids);
+		if (pergroup == NULL)
+			return GDK_FAIL;
+	} else {
+		ngrp = 0;
+	}
+
+	/* count the partial sums, taking into account that an
+	 * overflow counts for two times twopow and that a partial sum
+	 * equal to dbl_nil must be split in two */
+	cnt = 0;
+	for (grp = 0; grp < ngrp; grp++) {
+		const struct fsumgroup *pg = &pergroup[grp];
+
+		if (pg->partials == NULL) {
+			cnt++;
+			continue;
+		}
+		if (!pg->valseen)
+			continue;
+#ifdef INFINITES_ALLOWED
+		if (isinf(pg->infs) || isnan(pg->infs)) {
+			cnt++;
+			continue;
+		}
+#endif
+		cnt += 2 * (BUN) abs((int) pg->infs);
+		for (i = 0; i < pg->npartials; i++)
+			cnt += 1 + (pg->partials[i] == dbl_nil);
+		if (pg->npartials == 0 && pg->infs == 0)
+			cnt++;	/* the sum is zero */
+	}
+	bn = COLnew(0, TYPE_dbl, cnt, TRANSIENT);
+	gn = COLnew(0, TYPE_oid, cnt, TRANSIENT);
+	if (bn == NULL || gn == NULL)
+		goto bailout;
+	vals = (dbl *) Tloc(bn, 0);
+	grps = (oid *) Tloc(gn, 0);
+	p = 0;
+	for (grp = 0; grp < ngrp; grp++) {
+		const struct fsumgroup *pg = &pergroup[grp];
+
+		if (pg->partials == NULL) {
+			grps[p] = off + grp;
+			vals[p++] = dbl_nil;
+			continue;
+		}
+		if (!pg->valseen)
+			continue;
+#ifdef INFINITES_ALLOWED
+		if (isinf(pg->infs) || isnan(pg->infs)) {
+			grps[p] = off + grp;
+			vals[p++] = pg->infs;
+			continue;
+		}
+#endif
+		ninfs = 2 * abs((int) pg->infs);
+		for (k = 0; k < ninfs; k++) {
+			grps[p] = off + grp;
+			vals[p++] = pg->infs > 0 ? twopow : -twopow;
+		}
+		for (i = 0; i < pg->npartials; i++) {
+			if (pg->partials[i] == dbl_nil) {
+				grps[p] = off + grp;
+				vals[p++] = pg->partials[i] / 2;
+				grps[p] = off + grp;
+				vals[p++] = pg->partials[i] / 2;
+			} else {
+				grps[p] = off + grp;
+				vals[p++] = pg->partials[i];
+			}
+		}
+		if (pg->npartials == 0 && pg->infs == 0) {
+			grps[p] = off + grp;
+			vals[p++] = 0;
+		}
+	}
+	assert(p == cnt);
+	if (pergroup)
+		fsumfree(pergroup, ngrp);
+	BATsetcount(bn, cnt);
+	bn->tsorted = bn->trevsorted = cnt <= 1;
+	bn->tkey = cnt <= 1;
+	bn->tnil = 0;
+	bn->tnonil = 0;
+	BATsetcount(gn, cnt);
+	gn->tsorted = 1;
+	gn->trevsorted = cnt <= 1 || grps[0] == grps[cnt - 1];
+	gn->tkey = cnt <= 1;
+	gn->tnil = 0;
+	gn->tnonil = 1;
+	*partialsp = bn;
+	if (gidsp)
+		*gidsp = gn;
+	else
+		BBPunfix(gn->batCacheid);
+	return GDK_SUCCEED;
+
+  bailout:
+	if (pergroup)
+		fsumfree(pergroup, ngrp);
+	if (bn)
+		BBPunfix(bn->batCacheid);
+	if (gn)
+		BBPunfix(gn->batCacheid);
+	return GDK_FAIL;
+}
+
 gdk_return
 BATsum(void *res, int tp, BAT *b, BAT *s, int skip_nils, int abort_on_error, int nil_if_empty)
 {
@@ -2589,7 +2792,19 @@ BATminmax(BAT *b, void *aggr,
 	const void *res;
 	int s;
 	BATiter bi;
+	union {
+		lng l;
+		dbl d;
+#ifdef HAVE_HGE
+		hge h;
+#endif
+	} zmval;
 
+	if (ZMminmax(b, minmax == do_groupmax, &zmval)) {
+		/* the zone map knows the answer */
+		res = &zmval;
+		goto found;
+	}
 	if ((VIEWtparent(b) == 0 ||
 	     BATcount(b) == BATcount(BBPdescriptor(VIEWtparent(b)))) &&
 	    BATcheckimprints(b)) {
@@ -2622,6 +2837,7 @@ BATminmax(BAT *b, void *aggr,
 		bi = bat_iterator(b);
 		res = BUNtail(bi, pos - b->hseqbase);
 	}
+  found:
 	if (aggr == NULL) {
 		s = ATOMlen(b->ttype, res);
 		aggr = GDKmalloc(s);
@@ -2679,6 +2895,190 @@ BATgroupmedian(BAT *b, BAT *g, BAT *e, BAT *s, int tp,
 #define binsearch_oid(indir, offset, vals, lo, hi, v, ordering, last) binsearch_lng(indir, offset, (const lng *) vals, lo, hi, (lng) (v), ordering, last)
 #endif
 
+/* Select the k-th smallest of the n values in vals, reordering vals
+ * in the process.  This is introselect: quickselect with a
+ * median-of-three pivot, falling back to sorting the remaining range
+ * when the partitioning does not converge fast enough.  Nil is the
+ * smallest value of each of the types this is used for, so it is
+ * ordered the same as by the atom compare function. */
+#define QUANTILE_SELECT(TYPE)						\
+static TYPE								\
+quantile_select_##TYPE(TYPE *vals, BUN n, BUN k)			\
+{									\
+	ssize_t lo = 0, hi = (ssize_t) n - 1, i, j;			\
+	int depth = 0;							\
+	TYPE pivot, t;							\
+									\
+	for (i = (ssize_t) n; i > 1; i >>= 1)				\
+		depth += 2;						\
+	while (hi > lo) {						\
+		if (hi - lo < 16 || depth-- == 0) {			\
+			GDKqsort(vals + lo, NULL, NULL,			\
+				 (size_t) (hi - lo + 1),		\
+				 sizeof(TYPE), 0, TYPE_##TYPE);		\
+			break;						\
+		}							\
+		/* order vals[lo], vals[mid], vals[hi] so that the	\
+		 * pivot is their median and the other two act as	\
+		 * sentinels */						\
+		i = lo + (hi - lo) / 2;					\
+		if (vals[i] < vals[lo]) {				\
+			t = vals[i]; vals[i] = vals[lo]; vals[lo] = t;	\
+		}							\
+		if (vals[hi] < vals[lo]) {				\
+			t = vals[hi]; vals[hi] = vals[lo]; vals[lo] = t; \
+		}							\
+		if (vals[hi] < vals[i]) {				\
+			t = vals[hi]; vals[hi] = vals[i]; vals[i] = t;	\
+		}							\
+		pivot = vals[i];					\
+		i = lo;							\
+		j = hi;							\
+		while (i <= j) {					\
+			while (vals[i] < pivot)				\
+				i++;					\
+			while (pivot < vals[j])				\
+				j--;					\
+			if (i <= j) {					\
+				t = vals[i]; vals[i] = vals[j]; vals[j] = t; \
+				i++;					\
+				j--;					\
+			}						\
+		}							\
+		/* now vals[lo..j] <= pivot <= vals[i..hi], and		\
+		 * everything in between is equal to pivot */		\
+		if ((ssize_t) k <= j)					\
+			hi = j;						\
+		else if ((ssize_t) k >= i)				\
+			lo = i;						\
+		else							\
+			return pivot;					\
+	}								\
+	return vals[k];							\
+}
+
+QUANTILE_SELECT(bte)
+QUANTILE_SELECT(sht)
+QUANTILE_SELECT(int)
+QUANTILE_SELECT(lng)
+#ifdef HAVE_HGE
+QUANTILE_SELECT(hge)
+#endif
+QUANTILE_SELECT(flt)
+QUANTILE_SELECT(dbl)
+
+/* Gather the values per group into consecutive ranges of a copy, and
+ * select the quantile from each range.  After counting, ends[grp] is
+ * the start of the range of grp; it is incremented while copying the
+ * values of grp, so that it ends up being the end of that range. */
+#define QUANTILE_GROUPS(TYPE)						\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
+		TYPE *restrict copy;					\
+		TYPE *restrict res = (TYPE *) Tloc(bn, 0);		\
+									\
+		for (i = 0; i < cnt; i++) {				\
+			if (skip_nils && vals[i] == TYPE##_nil)		\
+				continue;				\
+			gid = gids ? gids[i] : g ? g->tseqbase + i : min; \
+			if (gid >= min && gid <= max)			\
+				ends[gid - min + 1]++;			\
+		}							\
+		for (grp = 1; grp <= ngrp; grp++)			\
+			ends[grp] += ends[grp - 1];			\
+		copy = GDKmalloc((ends[ngrp] + 1) * sizeof(TYPE));	\
+		if (copy == NULL)					\
+			goto bailout;					\
+		for (i = 0; i < cnt; i++) {				\
+			if (skip_nils && vals[i] == TYPE##_nil)		\
+				continue;				\
+			gid = gids ? gids[i] : g ? g->tseqbase + i : min; \
+			if (gid >= min && gid <= max)			\
+				copy[ends[gid - min]++] = vals[i];	\
+		}							\
+		for (grp = 0, r = 0; grp < ngrp; r = ends[grp++]) {	\
+			if (r == ends[grp]) {				\
+				res[grp] = TYPE##_nil;			\
+				nils++;					\
+				continue;				\
+			}						\
+			/* round *down* to nearest integer */		\
+			f = (ends[grp] - r - 1) * quantile;		\
+			k = ends[grp] - r - (BUN) (ends[grp] - r + 0.5 - f); \
+			res[grp] = quantile_select_##TYPE(copy + r,	\
+							  ends[grp] - r, k); \
+			nils += res[grp] == TYPE##_nil;			\
+		}							\
+		GDKfree(copy);						\
+	} while (0)
+
+/* Calculate the quantile of each group of b by selection instead of
+ * by sorting, which only works for the fixed size numeric types.  b
+ * and g are aligned and without candidate list; g is either NULL or
+ * a (materialized or dense) oid column. */
+static BAT *
+doquantile_select(BAT *b, BAT *g, oid min, oid max, BUN ngrp, int tp,
+		  double quantile, int skip_nils)
+{
+	BAT *bn;
+	BUN *ends;
+	BUN i, cnt = BATcount(b), grp, r, k, nils = 0;
+	const oid *restrict gids;
+	oid gid;
+	double f;
+
+	if (g == NULL) {
+		min = max = 0;
+		ngrp = 1;
+	}
+	gids = g && !BATtdense(g) ? (const oid *) Tloc(g, 0) : NULL;
+	bn = COLnew(min, tp, ngrp, TRANSIENT);
+	ends = GDKzalloc((ngrp + 1) * sizeof(BUN));
+	if (bn == NULL || ends == NULL)
+		goto bailout;
+	switch (ATOMbasetype(tp)) {
+	case TYPE_bte:
+		QUANTILE_GROUPS(bte);
+		break;
+	case TYPE_sht:
+		QUANTILE_GROUPS(sht);
+		break;
+	case TYPE_int:
+		QUANTILE_GROUPS(int);
+		break;
+	case TYPE_lng:
+		QUANTILE_GROUPS(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		QUANTILE_GROUPS(hge);
+		break;
+#endif
+	case TYPE_flt:
+		QUANTILE_GROUPS(flt);
+		break;
+	case TYPE_dbl:
+		QUANTILE_GROUPS(dbl);
+		break;
+	default:
+		assert(0);
+	}
+	GDKfree(ends);
+	BATsetcount(bn, ngrp);
+	bn->tkey = ngrp <= 1;
+	bn->tsorted = ngrp <= 1;
+	bn->trevsorted = ngrp <= 1;
+	bn->tnil = nils != 0;
+	bn->tnonil = nils == 0;
+	return bn;
+
+  bailout:
+	GDKfree(ends);
+	if (bn)
+		BBPunfix(bn->batCacheid);
+	return NULL;
+}
+
 BAT *
 BATgroupquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile,
 		 int skip_nils, int abort_on_error)
@@ -2736,6 +3136,35 @@ BATgroupquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile,
 		}
 	}
 
+	/* for the fixed size numeric types, selecting the quantile
+	 * per group is cheaper than sorting, unless b is already
+	 * sorted or has an order index */
+	switch (ATOMbasetype(tp)) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_flt:
+	case TYPE_dbl:
+		if (g ? g->ttype == TYPE_oid || BATtdense(g) :
+		    !BATtordered(b) && !BATtrevordered(b) &&
+		    !BATcheckorderidx(b)) {
+			bn = doquantile_select(b, g, min, max, ngrp, tp,
+					       quantile, skip_nils);
+			if (freeb)
+				BBPunfix(b->batCacheid);
+			if (freeg)
+				BBPunfix(g->batCacheid);
+			return bn;
+		}
+		break;
+	default:
+		break;
+	}
+
 	/* we want to sort b so that we can figure out the quantile, but
 	 * if g is given, sort g and subsort b so that we can get the
 	 * quantile for each group */
@@ -2896,6 +3325,1037 @@ BATgroupquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile,
 	return NULL;
 }
 
+/* ---------------------------------------------------------------------- */
+/* approximate quantiles */
+
+/* The approximate quantiles use a t-digest (Dunning & Ertl, "Computing
+ * extremely accurate quantiles using t-digests"): a list of centroids
+ * (mean, weight) sorted on mean, in which the centroids near the tails
+ * are kept small so that extreme quantiles stay accurate.  Digests can
+ * be merged by concatenating and compressing them, which is what
+ * makes them usable for partitioned (mitosis) plans: each partition
+ * calculates the digest of its groups with BATgroupquantilesketch and
+ * BATgroupapproxquantile combines them.  The first and last centroid
+ * of each digest are the minimum and maximum value with weight 1 so
+ * that those are retained exactly. */
+
+#define TDIGEST_COMPRESSION	100
+#define TDIGEST_BUFFER		(2 * TDIGEST_COMPRESSION)
+
+#define TDIGEST_BINS		(TDIGEST_COMPRESSION / 2)
+
+/* The scale function k1 divides the range of quantiles into
+ * TDIGEST_BINS bins that are small near the tails and large in the
+ * middle; a centroid may not extend beyond the end of the bin it
+ * starts in.  Bin j ends at quantile bins[j]. */
+static void
+tdigest_bins(dbl *bins)
+{
+	int j;
+
+	for (j = 0; j <= TDIGEST_BINS; j++)
+		bins[j] = (1 - cos(M_PI * j / TDIGEST_BINS)) / 2;
+	bins[TDIGEST_BINS] = 1;
+}
+
+/* compress the n centroids, sorted on mean, in place, returning the
+ * new number of centroids */
+static BUN
+tdigest_compress(dbl *restrict m, dbl *restrict w, BUN n, double total,
+		 const dbl *bins)
+{
+	BUN i, o;
+	double cum, wlimit, cm, cw;
+	int j = 1;
+
+	/* small digests are kept exact */
+	if (n <= TDIGEST_COMPRESSION)
+		return n;
+	/* m[0] (the minimum) stays on its own */
+	o = 1;
+	cum = w[0];
+	while (j < TDIGEST_BINS && bins[j] * total <= cum)
+		j++;
+	wlimit = bins[j] * total;
+	cm = m[1];
+	cw = w[1];
+	for (i = 2; i < n - 1; i++) {
+		if (cum + cw + w[i] <= wlimit) {
+			cw += w[i];
+			cm += (m[i] - cm) * w[i] / cw;
+		} else {
+			m[o] = cm;
+			w[o] = cw;
+			o++;
+			cum += cw;
+			while (j < TDIGEST_BINS && bins[j] * total <= cum)
+				j++;
+			wlimit = bins[j] * total;
+			cm = m[i];
+			cw = w[i];
+		}
+	}
+	m[o] = cm;
+	w[o] = cw;
+	o++;
+	/* and so does m[n - 1] (the maximum) */
+	m[o] = m[n - 1];
+	w[o] = w[n - 1];
+	return o + 1;
+}
+
+/* The digest of a group is built while the values stream by: they
+ * are collected in a buffer after the centroids of the digest so far,
+ * and each time TDIGEST_BUFFER values have been collected, the buffer
+ * is sorted and merged into the digest.  The arrays grow as needed, so
+ * a small group takes little space. */
+struct tdigest {
+	BUN n;			/* centroids in m[0..n) and w[0..n) */
+	BUN len;		/* buffered values in m[n..n+len) */
+	BUN size;		/* allocated size of m and w */
+	dbl *m, *w;
+	double total;		/* weight of the centroids */
+};
+
+struct tdigestctx {
+	BUN size;
+	dbl *tm, *tw;		/* scratch space */
+	dbl bins[TDIGEST_BINS + 1];
+	int unweighted;		/* all weights are 1 */
+};
+
+/* merge the buffered values into the digest; if all weights are 1,
+ * only the means need to be sorted */
+static gdk_return
+tdigest_flush(struct tdigest *td, struct tdigestctx *ctx)
+{
+	dbl *restrict m = td->m + td->n, *restrict w = td->w + td->n;
+	BUN i, j, k;
+
+	if (td->len == 0)
+		return GDK_SUCCEED;
+	if (td->n + td->len > ctx->size) {
+		BUN size = td->n + td->len;
+		dbl *p;
+
+		if ((p = GDKrealloc(ctx->tm, size * sizeof(dbl))) == NULL)
+			return GDK_FAIL;
+		ctx->tm = p;
+		if ((p = GDKrealloc(ctx->tw, size * sizeof(dbl))) == NULL)
+			return GDK_FAIL;
+		ctx->tw = p;
+		ctx->size = size;
+	}
+	if (ctx->unweighted)
+		GDKqsort(m, NULL, NULL, td->len, sizeof(dbl), 0, TYPE_dbl);
+	else
+		GDKqsort(m, w, NULL, td->len, sizeof(dbl), sizeof(dbl),
+			 TYPE_dbl);
+	for (i = 0, j = 0, k = 0; i < td->n || j < td->len; k++) {
+		if (j == td->len || (i < td->n && td->m[i] <= m[j])) {
+			ctx->tm[k] = td->m[i];
+			ctx->tw[k] = td->w[i++];
+		} else {
+			ctx->tm[k] = m[j];
+			ctx->tw[k] = w[j];
+			td->total += w[j++];
+		}
+	}
+	td->n = tdigest_compress(ctx->tm, ctx->tw, k, td->total, ctx->bins);
+	td->len = 0;
+	memcpy(td->m, ctx->tm, td->n * sizeof(dbl));
+	memcpy(td->w, ctx->tw, td->n * sizeof(dbl));
+	return GDK_SUCCEED;
+}
+
+static gdk_return
+tdigest_add(struct tdigest *td, struct tdigestctx *ctx, dbl m, dbl w)
+{
+	if (td->len == TDIGEST_BUFFER && tdigest_flush(td, ctx) != GDK_SUCCEED)
+		return GDK_FAIL;
+	if (td->n + td->len == td->size) {
+		/* the buffer grows to TDIGEST_BUFFER values */
+		BUN size = td->size == 0 ? 4 : 2 * td->size;
+		dbl *p;
+
+		if (size > td->n + TDIGEST_BUFFER)
+			size = td->n + TDIGEST_BUFFER;
+		if ((p = GDKrealloc(td->m, size * sizeof(dbl))) == NULL)
+			return GDK_FAIL;
+		td->m = p;
+		if ((p = GDKrealloc(td->w, size * sizeof(dbl))) == NULL)
+			return GDK_FAIL;
+		td->w = p;
+		td->size = size;
+	}
+	td->m[td->n + td->len] = m;
+	td->w[td->n + td->len++] = w;
+	return GDK_SUCCEED;
+}
+
+/* estimate the quantile from the digest by linear interpolation
+ * between the centers of the centroids, where the center of a
+ * centroid is the average rank of the values it represents */
+static dbl
+tdigest_quantile(const struct tdigest *td, double quantile)
+{
+	double total = 0, target, cum = 0, c, prev = 0;
+	BUN i;
+
+	if (td->n == 0)
+		return dbl_nil;
+	for (i = 0; i < td->n; i++)
+		total += td->w[i];
+	target = quantile * (total - 1);
+	for (i = 0; i < td->n; i++) {
+		c = cum + (td->w[i] - 1) / 2;
+		if (target <= c) {
+			if (i == 0)
+				return td->m[0];
+			return td->m[i - 1] + (td->m[i] - td->m[i - 1]) *
+				(target - prev) / (c - prev);
+		}
+		cum += td->w[i];
+		prev = c;
+	}
+	return td->m[td->n - 1];
+}
+
+static void
+tdigest_free(struct tdigest *td)
+{
+	GDKfree(td->m);
+	GDKfree(td->w);
+	td->m = td->w = NULL;
+	td->n = td->len = td->size = 0;
+}
+
+#define TDIGEST_ADD(TYPE)						\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
+		for (;;) {						\
+			if (cand) {					\
+				if (cand == candend)			\
+					break;				\
+				i = *cand++ - b->hseqbase;		\
+				if (i >= end)				\
+					break;				\
+			} else {					\
+				i = start++;				\
+				if (i == end)				\
+					break;				\
+			}						\
+			gid = gids ? gids[i] : g ? g->tseqbase + i : min; \
+			if (gid < min || gid > max)			\
+				continue;				\
+			gid -= min;					\
+			if (nils[gid])					\
+				continue;				\
+			if (vals[i] == TYPE##_nil) {			\
+				if (!skip_nils) {			\
+					nils[gid] = 1;			\
+					tdigest_free(&tds[gid]);	\
+				}					\
+				continue;				\
+			}						\
+			if (tdigest_add(&tds[gid], ctx, (dbl) vals[i],	\
+					weights ? weights[i] : 1) != GDK_SUCCEED) \
+				goto bailout;				\
+		}							\
+	} while (0)
+
+/* Calculate the digest of each group of b and pass it to func.  If w
+ * is given, b is of type dbl and contains the means and w the weights
+ * of centroids (of digests calculated before), otherwise each value
+ * of b has weight 1.  A nil in a group makes the digest of that group
+ * nil (NULL) unless skip_nils is set.  The digests are built in a
+ * single scan over b. */
+static gdk_return
+tdigest_groups(BAT *b, BAT *w, BAT *g, BAT *e, BAT *s, int skip_nils,
+	       gdk_return (*func)(void *, BUN, const struct tdigest *),
+	       void *arg, const char *name)
+{
+	oid min, max, gid;
+	BUN ngrp, start, end, i, grp;
+	const oid *cand = NULL, *candend = NULL;
+	const oid *restrict gids;
+	const dbl *restrict weights = NULL;
+	const char *err;
+	struct tdigest *tds = NULL;
+	bte *nils = NULL;
+	struct tdigestctx *ctx;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("%s: %s\n", name, err);
+		return GDK_FAIL;
+	}
+	if (w != NULL) {
+		if (b->ttype != TYPE_dbl || w->ttype != TYPE_dbl ||
+		    BATcount(w) != BATcount(b)) {
+			GDKerror("%s: means and weights do not match.\n", name);
+			return GDK_FAIL;
+		}
+		weights = (const dbl *) Tloc(w, 0);
+	}
+	if (g == NULL) {
+		min = max = 0;
+		ngrp = 1;
+	}
+	if (BATcount(b) == 0)
+		ngrp = 0;
+	gids = g && !BATtdense(g) ? (const oid *) Tloc(g, 0) : NULL;
+
+	if ((ctx = GDKzalloc(sizeof(*ctx))) == NULL)
+		return GDK_FAIL;
+	tdigest_bins(ctx->bins);
+	ctx->unweighted = weights == NULL;
+	tds = GDKzalloc((ngrp + 1) * sizeof(struct tdigest));
+	nils = GDKzalloc(ngrp + 1);
+	if (tds == NULL || nils == NULL)
+		goto bailout;
+	switch (ngrp == 0 ? TYPE_void : ATOMbasetype(b->ttype)) {
+	case TYPE_void:
+		break;
+	case TYPE_bte:
+		TDIGEST_ADD(bte);
+		break;
+	case TYPE_sht:
+		TDIGEST_ADD(sht);
+		break;
+	case TYPE_int:
+		TDIGEST_ADD(int);
+		break;
+	case TYPE_lng:
+		TDIGEST_ADD(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		TDIGEST_ADD(hge);
+		break;
+#endif
+	case TYPE_flt:
+		TDIGEST_ADD(flt);
+		break;
+	case TYPE_dbl:
+		TDIGEST_ADD(dbl);
+		break;
+	default:
+		GDKerror("%s: type %s not supported.\n", name,
+			 ATOMname(b->ttype));
+		goto bailout;
+	}
+	for (grp = 0; grp < ngrp; grp++) {
+		if (tdigest_flush(&tds[grp], ctx) != GDK_SUCCEED ||
+		    (*func)(arg, grp, nils[grp] ? NULL : &tds[grp]) != GDK_SUCCEED)
+			goto bailout;
+		tdigest_free(&tds[grp]);
+	}
+	GDKfree(tds);
+	GDKfree(nils);
+	GDKfree(ctx->tm);
+	GDKfree(ctx->tw);
+	GDKfree(ctx);
+	return GDK_SUCCEED;
+
+  bailout:
+	if (tds)
+		for (grp = 0; grp < ngrp; grp++)
+			tdigest_free(&tds[grp]);
+	GDKfree(tds);
+	GDKfree(nils);
+	GDKfree(ctx->tm);
+	GDKfree(ctx->tw);
+	GDKfree(ctx);
+	return GDK_FAIL;
+}
+
+struct sketchres {
+	BAT *m, *w, *g;
+	oid off;
+};
+
+static gdk_return
+tdigest_append(void *arg, BUN grp, const struct tdigest *td)
+{
+	struct sketchres *res = arg;
+	oid gid = res->off + grp;
+	dbl one = 1;
+	BUN i;
+
+	if (td == NULL) {
+		/* a nil group is represented by a single nil mean */
+		if (BUNappend(res->m, &dbl_nil, FALSE) != GDK_SUCCEED ||
+		    BUNappend(res->w, &one, FALSE) != GDK_SUCCEED ||
+		    BUNappend(res->g, &gid, FALSE) != GDK_SUCCEED)
+			return GDK_FAIL;
+		return GDK_SUCCEED;
+	}
+	for (i = 0; i < td->n; i++) {
+		if (BUNappend(res->m, &td->m[i], FALSE) != GDK_SUCCEED ||
+		    BUNappend(res->w, &td->w[i], FALSE) != GDK_SUCCEED ||
+		    BUNappend(res->g, &gid, FALSE) != GDK_SUCCEED)
+			return GDK_FAIL;
+	}
+	return GDK_SUCCEED;
+}
+
+/* Calculate the t-digest of each group of b.  The centroids of all
+ * groups are returned as the means (*meansp) and weights (*weightsp),
+ * with the group id plus off of each centroid in *gidsp (if not
+ * NULL).  Groups without values have no centroids.  Combine digests
+ * with BATgroupapproxquantile. */
+gdk_return
+BATgroupquantilesketch(BAT **meansp, BAT **weightsp, BAT **gidsp, BAT *b,
+		       BAT *g, BAT *e, BAT *s, oid off, int skip_nils)
+{
+	struct sketchres res;
+
+	res.m = COLnew(0, TYPE_dbl, 0, TRANSIENT);
+	res.w = COLnew(0, TYPE_dbl, 0, TRANSIENT);
+	res.g = COLnew(0, TYPE_oid, 0, TRANSIENT);
+	res.off = off;
+	if (res.m == NULL || res.w == NULL || res.g == NULL ||
+	    tdigest_groups(b, NULL, g, e, s, skip_nils, tdigest_append, &res,
+			   "BATgroupquantilesketch") != GDK_SUCCEED) {
+		if (res.m)
+			BBPunfix(res.m->batCacheid);
+		if (res.w)
+			BBPunfix(res.w->batCacheid);
+		if (res.g)
+			BBPunfix(res.g->batCacheid);
+		return GDK_FAIL;
+	}
+	res.m->tsorted = res.m->trevsorted = BATcount(res.m) <= 1;
+	res.w->tsorted = res.w->trevsorted = BATcount(res.w) <= 1;
+	res.g->tsorted = 1;
+	res.g->trevsorted = BATcount(res.g) <= 1;
+	res.g->tnonil = 1;
+	*meansp = res.m;
+	*weightsp = res.w;
+	if (gidsp)
+		*gidsp = res.g;
+	else
+		BBPunfix(res.g->batCacheid);
+	return GDK_SUCCEED;
+}
+
+struct quantileres {
+	dbl *vals;
+	double quantile;
+	BUN nils;
+};
+
+static gdk_return
+tdigest_estimate(void *arg, BUN grp, const struct tdigest *td)
+{
+	struct quantileres *res = arg;
+
+	res->vals[grp] = td ? tdigest_quantile(td, res->quantile) : dbl_nil;
+	return GDK_SUCCEED;
+}
+
+/* Estimate the quantile of each group of b using a t-digest.  If w
+ * is not NULL, b and w are the means and weights of digests returned
+ * by BATgroupquantilesketch and the result is the estimate for the
+ * combined digests.  The result is of type dbl and linearly
+ * interpolates between values, so a quantile that falls between two
+ * values lies between them. */
+BAT *
+BATgroupapproxquantile(BAT *b, BAT *w, BAT *g, BAT *e, BAT *s,
+		       double quantile, int skip_nils)
+{
+	struct quantileres res;
+	BUN ngrp, start, end, i;
+	oid min, max;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+	BAT *bn;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("BATgroupapproxquantile: %s\n", err);
+		return NULL;
+	}
+	if (quantile < 0 || quantile > 1) {
+		GDKerror("BATgroupapproxquantile: cannot determine quantile for "
+			 "p=%f (p has to be in [0,1])\n", quantile);
+		return NULL;
+	}
+	if (g == NULL) {
+		min = 0;
+		ngrp = 1;
+	}
+	bn = COLnew(min, TYPE_dbl, ngrp, TRANSIENT);
+	if (bn == NULL)
+		return NULL;
+	res.vals = (dbl *) Tloc(bn, 0);
+	for (i = 0; i < ngrp; i++)
+		res.vals[i] = dbl_nil;
+	res.quantile = quantile;
+	if (tdigest_groups(b, w, g, e, s, skip_nils, tdigest_estimate, &res,
+			   "BATgroupapproxquantile") != GDK_SUCCEED) {
+		BBPunfix(bn->batCacheid);
+		return NULL;
+	}
+	BATsetcount(bn, ngrp);
+	res.nils = 0;
+	for (i = 0; i < ngrp; i++)
+		res.nils += res.vals[i] == dbl_nil;
+	bn->tkey = ngrp <= 1;
+	bn->tsorted = ngrp <= 1;
+	bn->trevsorted = ngrp <= 1;
+	bn->tnil = res.nils != 0;
+	bn->tnonil = res.nils == 0;
+	return bn;
+}
+
+/* ---------------------------------------------------------------------- */
+/* approximate count distinct */
+
+/* The number of distinct values is estimated with a HyperLogLog sketch
+ * (Flajolet et al., "HyperLogLog: the analysis of a near-optimal
+ * cardinality estimation algorithm").  Each value is hashed to 64
+ * bits, the first HLL_PRECISION bits select a register and the
+ * register keeps the maximum position of the first 1 bit in the
+ * remaining bits.  With 2^14 registers of one byte the standard error
+ * is 1.04/sqrt(2^14), i.e. 0.8%, at 16KiB per group.  A group with few
+ * distinct values sets few registers, so its sketch starts sparse (see
+ * struct hll) and only becomes a dense array of registers when it has
+ * many.  Sketches are merged by taking the maximum of each register,
+ * so each partition of a partitioned (mitosis) plan can calculate its
+ * sketches with BATgroupcountdistinctsketch which
+ * BATgroupcountdistinctmerge then combines. */
+
+#define HLL_PRECISION	14
+#define HLL_REGISTERS	((BUN) 1 << HLL_PRECISION)
+/* at most this many pairs in a sparse sketch (4 bytes each) */
+#define HLL_SPARSE_MAX	(HLL_REGISTERS / 16)
+
+static inline ulng
+hll_mix(ulng h)
+{
+	/* splitmix64 */
+	h += 0x9E3779B97F4A7C15ULL;
+	h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+	return h ^ (h >> 31);
+}
+
+static inline ulng
+hll_hash_flt(flt v)
+{
+	union { flt f; unsigned int i; } u;
+
+	u.f = v == 0 ? 0 : v;	/* -0 == 0 */
+	return hll_mix(u.i);
+}
+
+static inline ulng
+hll_hash_dbl(dbl v)
+{
+	union { dbl d; ulng i; } u;
+
+	u.d = v == 0 ? 0 : v;	/* -0 == 0 */
+	return hll_mix(u.i);
+}
+
+static ulng
+hll_hash_bytes(const void *v, size_t len)
+{
+	const unsigned char *p = v;
+	ulng h = len, w;
+
+	while (len >= sizeof(w)) {
+		memcpy(&w, p, sizeof(w));
+		h = hll_mix(h ^ w);
+		p += sizeof(w);
+		len -= sizeof(w);
+	}
+	w = 0;
+	memcpy(&w, p, len);
+	return hll_mix(h ^ w);
+}
+
+#define HLL_HASH_INT(v)		hll_mix((ulng) (lng) (v))
+#ifdef HAVE_HGE
+#define HLL_HASH_HGE(v)		hll_mix((ulng) ((v) >> 64) ^ HLL_HASH_INT(v))
+#endif
+
+/* The sketch of a group.  A sparse sketch is a list of the registers
+ * that are not 0, as pairs register << 8 | value.  New pairs are
+ * appended; when the list is full it is sorted and the pairs of the
+ * same register are combined.  If that does not free half of the
+ * list, the list grows, until it would exceed HLL_SPARSE_MAX pairs,
+ * and then the sketch becomes dense.  Both forms give the same
+ * estimates. */
+struct hll {
+	bte *regs;		/* the registers if dense, else NULL */
+	unsigned int *sp;	/* the pairs if sparse */
+	BUN n, size;		/* number of pairs and allocated size */
+	BUN sorted;		/* sp[0..sorted) is sorted and combined */
+};
+
+static void
+hll_compact(struct hll *h)
+{
+	BUN i, o;
+
+	if (h->sorted == h->n)
+		return;
+	GDKqsort(h->sp, NULL, NULL, h->n, sizeof(int), 0, TYPE_int);
+	/* the last pair of a register has the largest value */
+	for (i = 0, o = 0; i < h->n; i++)
+		if (i + 1 == h->n || (h->sp[i] >> 8) != (h->sp[i + 1] >> 8))
+			h->sp[o++] = h->sp[i];
+	h->n = h->sorted = o;
+}
+
+static gdk_return
+hll_todense(struct hll *h)
+{
+	BUN i;
+
+	if ((h->regs = GDKzalloc(HLL_REGISTERS)) == NULL)
+		return GDK_FAIL;
+	for (i = 0; i < h->n; i++)
+		if (h->regs[h->sp[i] >> 8] < (bte) (h->sp[i] & 0xFF))
+			h->regs[h->sp[i] >> 8] = (bte) (h->sp[i] & 0xFF);
+	GDKfree(h->sp);
+	h->sp = NULL;
+	h->n = h->size = h->sorted = 0;
+	return GDK_SUCCEED;
+}
+
+static gdk_return
+hll_set(struct hll *h, unsigned int reg, bte rho)
+{
+	if (h->regs == NULL && h->n == h->size) {
+		hll_compact(h);
+		if (h->n >= h->size / 2) {
+			BUN size = h->size == 0 ? 4 : 2 * h->size;
+			unsigned int *sp;
+
+			if (size > HLL_SPARSE_MAX) {
+				if (hll_todense(h) != GDK_SUCCEED)
+					return GDK_FAIL;
+			} else {
+				if ((sp = GDKrealloc(h->sp, size * sizeof(unsigned int))) == NULL)
+					return GDK_FAIL;
+				h->sp = sp;
+				h->size = size;
+			}
+		}
+	}
+	if (h->regs) {
+		if (h->regs[reg] < rho)
+			h->regs[reg] = rho;
+	} else {
+		h->sp[h->n++] = reg << 8 | (unsigned int) rho;
+	}
+	return GDK_SUCCEED;
+}
+
+static inline gdk_return
+hll_add(struct hll *h, ulng v)
+{
+	/* the extra 1 bit limits the position to 64 - HLL_PRECISION + 1 */
+	ulng w = (v << HLL_PRECISION) | ((ulng) 1 << (HLL_PRECISION - 1));
+	unsigned int reg = (unsigned int) (v >> (64 - HLL_PRECISION));
+	bte rho = 1;
+
+	while ((w & ((ulng) 1 << 63)) == 0) {
+		w <<= 1;
+		rho++;
+	}
+	if (h->regs) {
+		if (h->regs[reg] < rho)
+			h->regs[reg] = rho;
+		return GDK_SUCCEED;
+	}
+	return hll_set(h, reg, rho);
+}
+
+static void
+hll_destroy(struct hll *hs, BUN ngrp)
+{
+	BUN i;
+
+	if (hs == NULL)
+		return;
+	for (i = 0; i < ngrp; i++) {
+		GDKfree(hs[i].regs);
+		GDKfree(hs[i].sp);
+	}
+	GDKfree(hs);
+}
+
+/* Estimate the cardinality from the registers using the improved raw
+ * estimator of Ertl ("New cardinality estimation algorithms for
+ * HyperLogLog sketches"), which unlike the original estimator needs
+ * no separate corrections for small and large cardinalities. */
+static double
+hll_sigma(double x)
+{
+	double y = 1, z = x, zp;
+
+	do {
+		x *= x;
+		zp = z;
+		z += x * y;
+		y += y;
+	} while (z != zp);
+	return z;
+}
+
+static double
+hll_tau(double x)
+{
+	double y = 1, z, zp;
+
+	if (x == 0 || x == 1)
+		return 0;
+	z = 1 - x;
+	do {
+		x = sqrt(x);
+		zp = z;
+		y *= 0.5;
+		z -= (1 - x) * (1 - x) * y;
+	} while (z != zp);
+	return z / 3;
+}
+
+static lng
+hll_estimate(struct hll *h)
+{
+	BUN c[64 - HLL_PRECISION + 2] = {0};
+	const double m = (double) HLL_REGISTERS;
+	double z;
+	BUN j;
+	int k;
+
+	if (h->regs) {
+		for (j = 0; j < HLL_REGISTERS; j++)
+			c[h->regs[j]]++;
+	} else {
+		hll_compact(h);
+		c[0] = HLL_REGISTERS - h->n;
+		for (j = 0; j < h->n; j++)
+			c[h->sp[j] & 0xFF]++;
+	}
+	if (c[0] == HLL_REGISTERS)
+		return 0;
+	z = m * hll_tau(1 - c[64 - HLL_PRECISION + 1] / m);
+	for (k = 64 - HLL_PRECISION; k >= 1; k--)
+		z = 0.5 * (z + c[k]);
+	z += m * hll_sigma(c[0] / m);
+	return (lng) (m * m / (2 * log(2.0) * z) + 0.5);
+}
+
+#define HLL_UPDATE(ISNIL, HASH)						\
+	do {								\
+		for (;;) {						\
+			if (cand) {					\
+				if (cand == candend)			\
+					break;				\
+				i = *cand++ - b->hseqbase;		\
+				if (i >= end)				\
+					break;				\
+			} else {					\
+				i = start++;				\
+				if (i == end)				\
+					break;				\
+			}						\
+			gid = gids ? gids[i] : g ? g->tseqbase + i : min; \
+			if (gid < min || gid > max || (ISNIL))		\
+				continue;				\
+			if (hll_add(&hs[gid - min], (HASH)) != GDK_SUCCEED) \
+				goto bailout;				\
+		}							\
+	} while (0)
+
+#define HLL_UPDATE_TYPE(TYPE, HASH)					\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
+		HLL_UPDATE(vals[i] == TYPE##_nil, HASH(vals[i]));	\
+	} while (0)
+
+/* Calculate the sketches of the groups of b.  Nils are not
+ * counted. */
+static struct hll *
+hll_sketch(BAT *b, BAT *g, BAT *e, BAT *s, oid *minp, BUN *ngrpp,
+	   const char *name)
+{
+	oid min, max, gid;
+	BUN ngrp, start, end, i;
+	const oid *cand = NULL, *candend = NULL;
+	const oid *restrict gids;
+	const char *err;
+	struct hll *hs;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("%s: %s\n", name, err);
+		return NULL;
+	}
+	if (g == NULL) {
+		min = max = 0;
+		ngrp = 1;
+	}
+	if ((hs = GDKzalloc((ngrp + 1) * sizeof(struct hll))) == NULL)
+		return NULL;
+	gids = g && !BATtdense(g) ? (const oid *) Tloc(g, 0) : NULL;
+
+	switch (ngrp == 0 || BATcount(b) == 0 ? -1 :
+		b->ttype == TYPE_void ? TYPE_void : ATOMbasetype(b->ttype)) {
+	case -1:
+		break;
+	case TYPE_void:
+		/* hash like the materialized oids */
+		if (b->tseqbase != oid_nil)
+			HLL_UPDATE(0, HLL_HASH_INT(b->tseqbase + i));
+		break;
+	case TYPE_bte:
+		HLL_UPDATE_TYPE(bte, HLL_HASH_INT);
+		break;
+	case TYPE_sht:
+		HLL_UPDATE_TYPE(sht, HLL_HASH_INT);
+		break;
+	case TYPE_int:
+		HLL_UPDATE_TYPE(int, HLL_HASH_INT);
+		break;
+	case TYPE_lng:
+		HLL_UPDATE_TYPE(lng, HLL_HASH_INT);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		HLL_UPDATE_TYPE(hge, HLL_HASH_HGE);
+		break;
+#endif
+	case TYPE_flt:
+		HLL_UPDATE_TYPE(flt, hll_hash_flt);
+		break;
+	case TYPE_dbl:
+		HLL_UPDATE_TYPE(dbl, hll_hash_dbl);
+		break;
+	default: {
+		BATiter bi = bat_iterator(b);
+		int (*atomcmp)(const void *, const void *) = ATOMcompare(b->ttype);
+		const void *nil = ATOMnilptr(b->ttype);
+		const void *v;
+
+		HLL_UPDATE((*atomcmp)(v = BUNtail(bi, i), nil) == 0,
+			   hll_hash_bytes(v, (size_t) ATOMlen(b->ttype, v)));
+		break;
+	}
+	}
+	*minp = min;
+	*ngrpp = ngrp;
+	return hs;
+
+  bailout:
+	hll_destroy(hs, ngrp);
+	return NULL;
+}
+
+/* Turn ngrp sketches into a BAT of estimates with head sequence base
+ * min. */
+static BAT *
+hll_counts(struct hll *hs, oid min, BUN ngrp)
+{
+	BAT *bn;
+	lng *cnts;
+	BUN i;
+
+	bn = COLnew(min, TYPE_lng, ngrp, TRANSIENT);
+	if (bn == NULL)
+		return NULL;
+	cnts = (lng *) Tloc(bn, 0);
+	for (i = 0; i < ngrp; i++)
+		cnts[i] = hll_estimate(&hs[i]);
+	BATsetcount(bn, ngrp);
+	bn->tkey = ngrp <= 1;
+	bn->tsorted = ngrp <= 1;
+	bn->trevsorted = ngrp <= 1;
+	bn->tnil = 0;
+	bn->tnonil = 1;
+	return bn;
+}
+
+/* Estimate the number of distinct values (not counting nil) in each
+ * group of b.  The result is of type lng and aligned with the groups
+ * like the result of BATgroupcount. */
+BAT *
+BATgroupapproxcountdistinct(BAT *b, BAT *g, BAT *e, BAT *s)
+{
+	struct hll *hs;
+	BAT *bn;
+	oid min;
+	BUN ngrp;
+
+	hs = hll_sketch(b, g, e, s, &min, &ngrp, "BATgroupapproxcountdistinct");
+	if (hs == NULL)
+		return NULL;
+	bn = hll_counts(hs, min, ngrp);
+	hll_destroy(hs, ngrp);
+	return bn;
+}
+
+/* A sketch in a BAT of type bte is a record that starts with
+ * HLL_SPARSE, followed by the number of pairs in two bytes and the
+ * pairs in three bytes each (the register in two, the value in one),
+ * or with HLL_DENSE, followed by the HLL_REGISTERS registers. */
+#define HLL_SPARSE	0
+#define HLL_DENSE	1
+
+static BUN
+hll_recordsize(const struct hll *h)
+{
+	return h->regs ? 1 + HLL_REGISTERS : 3 + 3 * h->n;
+}
+
+/* Calculate the HyperLogLog sketch of each group of b.  The result is
+ * a BAT of type bte with a record for each group, in group order. */
+BAT *
+BATgroupcountdistinctsketch(BAT *b, BAT *g, BAT *e, BAT *s)
+{
+	struct hll *hs;
+	oid min;
+	BUN ngrp, i, j, size = 0;
+	unsigned char *p;
+	BAT *bn;
+
+	hs = hll_sketch(b, g, e, s, &min, &ngrp, "BATgroupcountdistinctsketch");
+	if (hs == NULL)
+		return NULL;
+	for (i = 0; i < ngrp; i++) {
+		if (hs[i].regs == NULL)
+			hll_compact(&hs[i]);
+		size += hll_recordsize(&hs[i]);
+	}
+	bn = COLnew(0, TYPE_bte, size, TRANSIENT);
+	if (bn == NULL) {
+		hll_destroy(hs, ngrp);
+		return NULL;
+	}
+	p = (unsigned char *) Tloc(bn, 0);
+	for (i = 0; i < ngrp; i++) {
+		if (hs[i].regs) {
+			*p++ = HLL_DENSE;
+			memcpy(p, hs[i].regs, HLL_REGISTERS);
+			p += HLL_REGISTERS;
+		} else {
+			*p++ = HLL_SPARSE;
+			*p++ = (unsigned char) hs[i].n;
+			*p++ = (unsigned char) (hs[i].n >> 8);
+			for (j = 0; j < hs[i].n; j++) {
+				*p++ = (unsigned char) (hs[i].sp[j] >> 8);
+				*p++ = (unsigned char) (hs[i].sp[j] >> 16);
+				*p++ = (unsigned char) hs[i].sp[j];
+			}
+		}
+	}
+	hll_destroy(hs, ngrp);
+	BATsetcount(bn, size);
+	bn->tsorted = bn->trevsorted = BATcount(bn) <= 1;
+	bn->tkey = BATcount(bn) <= 1;
+	bn->tnil = 0;
+	bn->tnonil = 1;
+	return bn;
+}
+
+/* Combine the sketches in r (the concatenation of results of
+ * BATgroupcountdistinctsketch) and estimate the number of distinct
+ * values of each group.  Group g[i] receives the i'th sketch of r; if
+ * g is NULL all sketches are combined into one group. */
+BAT *
+BATgroupcountdistinctmerge(BAT *r, BAT *g, BAT *e)
+{
+	oid min, max, gid;
+	BUN ngrp, nsk, start, end, i, j, n, pos, cnt;
+	const oid *cand = NULL, *candend = NULL;
+	const oid *restrict gids;
+	const unsigned char *restrict src;
+	struct hll *hs, *h;
+	const char *err;
+	BAT *bn;
+
+	/* count the sketches */
+	if (r->ttype != TYPE_bte) {
+		GDKerror("BATgroupcountdistinctmerge: not a sketch.\n");
+		return NULL;
+	}
+	src = (const unsigned char *) Tloc(r, 0);
+	cnt = BATcount(r);
+	for (nsk = 0, pos = 0; pos < cnt; nsk++) {
+		if (src[pos] == HLL_DENSE)
+			pos += 1 + HLL_REGISTERS;
+		else if (src[pos] == HLL_SPARSE && pos + 3 <= cnt)
+			pos += 3 + 3 * (src[pos + 1] | (BUN) src[pos + 2] << 8);
+		else
+			break;
+	}
+	if (pos != cnt) {
+		GDKerror("BATgroupcountdistinctmerge: not a sketch.\n");
+		return NULL;
+	}
+	if (g) {
+		if (BATcount(g) != nsk) {
+			GDKerror("BATgroupcountdistinctmerge: r and g must be "
+				 "aligned\n");
+			return NULL;
+		}
+		/* there is one group id for each sketch, so g can take
+		 * the place of the values */
+		if ((err = BATgroupaggrinit(g, g, e, NULL, &min, &max, &ngrp,
+					    &start, &end, &cand,
+					    &candend)) != NULL) {
+			GDKerror("BATgroupcountdistinctmerge: %s\n", err);
+			return NULL;
+		}
+		gids = BATtdense(g) ? NULL : (const oid *) Tloc(g, 0);
+	} else {
+		min = max = 0;
+		ngrp = 1;
+		gids = NULL;
+	}
+	if ((hs = GDKzalloc((ngrp + 1) * sizeof(struct hll))) == NULL)
+		return NULL;
+	for (i = 0, pos = 0; i < nsk; i++) {
+		gid = gids ? gids[i] : g ? g->tseqbase + i : min;
+		if (src[pos] == HLL_DENSE) {
+			pos++;
+			if (gid >= min && gid <= max) {
+				h = &hs[gid - min];
+				if (h->regs == NULL && hll_todense(h) != GDK_SUCCEED)
+					goto bailout;
+				for (j = 0; j < HLL_REGISTERS; j++)
+					if (h->regs[j] < (bte) src[pos + j])
+						h->regs[j] = (bte) src[pos + j];
+			}
+			pos += HLL_REGISTERS;
+		} else {
+			n = src[pos + 1] | (BUN) src[pos + 2] << 8;
+			pos += 3;
+			if (gid >= min && gid <= max) {
+				h = &hs[gid - min];
+				for (j = 0; j < n; j++)
+					if (hll_set(h, src[pos + 3 * j] | (unsigned int) src[pos + 3 * j + 1] << 8,
+						    (bte) src[pos + 3 * j + 2]) != GDK_SUCCEED)
+						goto bailout;
+			}
+			pos += 3 * n;
+		}
+	}
+	bn = hll_counts(hs, min, ngrp);
+	hll_destroy(hs, ngrp);
+	return bn;
+
+  bailout:
+	hll_destroy(hs, ngrp);
+	return NULL;
+}
+
 /* ---------------------------------------------------------------------- */
 /* standard deviation (both biased and non-biased) */
 
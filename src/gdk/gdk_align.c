@@ -183,6 +183,8 @@ VIEWcreate_(oid seq, BAT *b, int slice_view)
 	bn->timprints = NULL;
 	/* Order OID index */
 	bn->torderidx = NULL;
+	/* zone maps are shared, but the check is dynamic */
+	bn->tzonemap = NULL;
 	if (BBPcacheit(bn, 1) != GDK_SUCCEED) {	/* enter in BBP */
 		if (tp)
 			BBPunshare(tp);
@@ -235,6 +237,7 @@ BATmaterialize(BAT *b)
 	HASHdestroy(b);
 	IMPSdestroy(b);
 	OIDXdestroy(b);
+	ZMdestroy(b);
 
 	b->theap.filename = NULL;
 	if (HEAPalloc(&b->theap, cnt, sizeof(oid)) != GDK_SUCCEED) {
@@ -490,6 +493,7 @@ VIEWdestroy(BAT *b)
 	HASHdestroy(b);
 	IMPSdestroy(b);
 	OIDXdestroy(b);
+	ZMdestroy(b);
 	VIEWunlink(b);
 
 	if (b->ttype && !b->theap.parentid) {
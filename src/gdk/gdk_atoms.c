@@ -1242,6 +1242,40 @@ strLocate(Heap *h, const char *v)
 	return 0;
 }
 
+/*
+ * Iterate over the strings in a string heap: strNext returns the
+ * offset of the string following the one at offset pos, or the offset
+ * of the first string if pos is 0, and 0 when there are no more
+ * strings.  This follows the padding rules of strPut, so it can only
+ * be used on heaps that were filled by strPut alone, i.e. heaps that
+ * are fully double eliminated or that are a dictionary (see
+ * GDK_STRDISTINCT).
+ */
+var_t
+strNext(const Heap *h, var_t pos)
+{
+	const size_t extralen = h->hashash ? EXTRALEN : 0;
+	size_t pad;
+
+	assert(GDK_STRDISTINCT(h));
+	if (pos == 0)
+		pos = GDK_STRHASHSIZE;
+	else
+		pos += GDK_STRLEN(h->base + pos);
+	if (pos >= h->free)
+		return 0;
+	pad = GDK_VARALIGN - (pos & (GDK_VARALIGN - 1));
+	if (pos < GDK_ELIMLIMIT) {
+		if (pad < sizeof(stridx_t))
+			pad += GDK_VARALIGN;
+	} else if (extralen == 0) {
+		pad = 0;
+	} else {
+		pad &= (GDK_VARALIGN - 1);
+	}
+	return (var_t) (pos + pad + extralen);
+}
+
 static var_t
 strPut(Heap *h, var_t *dst, const char *v)
 {
@@ -1285,6 +1319,10 @@ strPut(Heap *h, var_t *dst, const char *v)
 	}
 	/* the string was not found in the heap, we need to enter it */
 
+	/* a new string at the end breaks the ordering of a dictionary
+	 * heap, and in a large heap it may be a duplicate */
+	h->strdict = 0;
+
 	pad = GDK_VARALIGN - (h->free & (GDK_VARALIGN - 1));
 	if (elimbase == 0) {	/* i.e. h->free < GDK_ELIMLIMIT */
 		if (pad < sizeof(stridx_t)) {
@@ -327,6 +327,11 @@ gdk_export const ptr ptr_nil;
 #define GDK_ELIMLIMIT		(1<<GDK_ELIMPOWER)	/* equivalently: ELIMBASE == 0 */
 #define GDK_ELIMBASE(x)		(((x) >> GDK_ELIMPOWER) << GDK_ELIMPOWER)
 #define GDK_VAROFFSET		((var_t) GDK_STRHASHSIZE)
+/* string heaps in which each string occurs only once: heaps that are
+ * still fully double eliminated and dictionary heaps built by
+ * BATstrdict, whose strings are moreover in ascending order; in such
+ * heaps the offset of a string can be used as its code */
+#define GDK_STRDISTINCT(h)	(GDK_ELIMDOUBLES(h) || (h)->strdict)
 
 /*
  * @- String Comparison, NILs and UTF-8
@@ -109,6 +109,7 @@ BATcreatedesc(oid hseq, int tt, int heapnames, int role)
  	* Default zero for order oid index
  	*/
 	bn->torderidx = 0;
+	bn->tzonemap = NULL;
 	/*
 	 * fill in heap names, so HEAPallocs can resort to disk for
 	 * very large writes.
@@ -407,6 +408,40 @@ BATattach(int tt, const char *heapfile, int role)
 	return NULL;
 }
 
+/* Create a transient, read-only BAT whose tail is the cnt values of
+ * fixed-size type tt at base.  The memory is not copied and not owned
+ * by the BAT (STORE_NOWN), so it must stay valid and unchanged for as
+ * long as the BAT exists. */
+BAT *
+BATwrap(int tt, void *base, BUN cnt)
+{
+	BAT *bn;
+
+	ERRORcheck(tt <= 0 , "BATwrap: bad tail type (<=0)\n", NULL);
+	ERRORcheck(ATOMvarsized(tt), "BATwrap: bad tail type (varsized)\n", NULL);
+	ERRORcheck(base == NULL && cnt > 0, "BATwrap: no data\n", NULL);
+
+	bn = COLnew(0, tt, 0, TRANSIENT);
+	if (bn == NULL || cnt == 0)
+		return bn;
+	HEAPfree(&bn->theap, 0);
+	bn->theap.base = base;
+	bn->theap.size = bn->theap.free = (size_t) cnt << bn->tshift;
+	bn->theap.storage = bn->theap.newstorage = STORE_NOWN;
+	bn->batCapacity = cnt;
+	BATsetcount(bn, cnt);
+	bn->tnonil = 0;
+	bn->tnil = 0;
+	bn->tdense = 0;
+	if (cnt > 1) {
+		bn->tsorted = 0;
+		bn->trevsorted = 0;
+		bn->tkey = 0;
+	}
+	bn->batRestricted = BAT_READ;
+	return bn;
+}
+
 /*
  * If the BAT runs out of storage for BUNS it will reallocate space.
  * For memory mapped BATs we simple extend the administration after
@@ -477,7 +512,6 @@ BATextend(BAT *b, BUN newcap)
 		return GDK_FAIL;
 	HASHdestroy(b);
 	IMPSdestroy(b);
-	OIDXdestroy(b);
 	return GDK_SUCCEED;
 }
 
@@ -509,6 +543,7 @@ BATclear(BAT *b, int force)
 	HASHdestroy(b);
 	IMPSdestroy(b);
 	OIDXdestroy(b);
+	ZMdestroy(b);
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
 
@@ -575,6 +610,7 @@ BATfree(BAT *b)
 	HASHfree(b);
 	IMPSfree(b);
 	OIDXfree(b);
+	ZMfree(b);
 	if (b->ttype)
 		HEAPfree(&b->theap, 0);
 	else
@@ -1033,6 +1069,10 @@ BUNappend(BAT *b, const void *t, bit force)
 
 	ALIGNapp(b, "BUNappend", force, GDK_FAIL);
 	b->batDirty = 1;
+	if (b->tzonemap == (Heap *) 1) {
+		/* load the zone map while it still matches b */
+		(void) BATcheckzonemap(b);
+	}
 	if (b->thash && b->tvheap)
 		tsize = b->tvheap->size;
 
@@ -1060,7 +1100,8 @@ BUNappend(BAT *b, const void *t, bit force)
 
 
 	IMPSdestroy(b); /* no support for inserts in imprints yet */
-	OIDXdestroy(b);
+	OIDXappend(b);
+	ZMappend(b);
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
 	if (b->thash == (Hash *) 1) {
@@ -1125,6 +1166,7 @@ BUNdelete(BAT *b, oid o)
 	}
 	IMPSdestroy(b);
 	OIDXdestroy(b);
+	ZMdestroy(b);
 	HASHdestroy(b);
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
@@ -1169,6 +1211,7 @@ BUNinplace(BAT *b, BUN p, const void *t, bit force)
 	b->tprops = NULL;
 	OIDXdestroy(b);
 	IMPSdestroy(b);
+	ZMdestroy(b);
 	Treplacevalue(b, BUNtloc(bi, p), t);
 
 	tt = b->ttype;
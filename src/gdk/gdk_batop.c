@@ -83,9 +83,25 @@ insert_string_bat(BAT *b, BAT *n, BAT *s, int force)
 	cnt = cand ? (BUN) (candend - cand) : end - start;
 	if (cnt == 0)
 		return GDK_SUCCEED;
-	if ((!GDK_ELIMDOUBLES(b->tvheap) || b->batCount == 0) &&
-	    !GDK_ELIMDOUBLES(n->tvheap) &&
-	    b->tvheap->hashash == n->tvheap->hashash) {
+	if (b->batCount == 0 && cand == NULL && n->tvheap->strdict &&
+	    b->tvheap != n->tvheap &&
+	    b->tvheap->hashash == n->tvheap->hashash &&
+	    (b->batRole != TRANSIENT || GDK_ELIMDOUBLES(n->tvheap))) {
+		/* n's string heap is a dictionary (see BATstrdict)
+		 * that b cannot share: copy it as a whole, so that
+		 * b's heap is a dictionary too.  Inserting the
+		 * strings one by one would enter them in row order,
+		 * and even a small heap would no longer be sorted. */
+		if (unshare_string_heap(b) != GDK_SUCCEED ||
+		    HEAPextend(b->tvheap, n->tvheap->size, force) != GDK_SUCCEED)
+			return GDK_FAIL;
+		memcpy(b->tvheap->base, n->tvheap->base, n->tvheap->free);
+		b->tvheap->free = n->tvheap->free;
+		b->tvheap->strdict = 1;
+		toff = 0;
+	} else if ((!GDK_ELIMDOUBLES(b->tvheap) || b->batCount == 0) &&
+		   !GDK_ELIMDOUBLES(n->tvheap) &&
+		   b->tvheap->hashash == n->tvheap->hashash) {
 		if (b->batRole == TRANSIENT || b->tvheap == n->tvheap) {
 			/* If b is in the transient farm (i.e. b will
 			 * never become persistent), we try some
@@ -179,29 +195,33 @@ insert_string_bat(BAT *b, BAT *n, BAT *s, int force)
 					 * hash table */
 					memset(b->tvheap->base, 0,
 					       GDK_STRHASHSIZE);
-				}
-			}
-		}
-		if (toff != ~(size_t) 0) {
-			/* we only have to copy the offsets from n to
-			 * b, possibly with an offset (if toff != 0),
-			 * so set up some variables and set up b's
-			 * tail so that it looks like it's a fixed
-			 * size column.  Of course, we must make sure
-			 * first that the width of b's offset heap can
-			 * accommodate all values. */
-			if (b->twidth < SIZEOF_VAR_T &&
-			    ((size_t) 1 << 8 * b->twidth) <= (b->twidth <= 2 ? b->tvheap->size - GDK_VAROFFSET : b->tvheap->size)) {
-				/* offsets aren't going to fit, so
-				 * widen offset heap */
-				if (GDKupgradevarheap(b, (var_t) b->tvheap->size, 0, force) != GDK_SUCCEED) {
-					toff = ~(size_t) 0;
-					goto bunins_failed;
+					b->tvheap->strdict = 0;
+				} else {
+					/* b's string heap is now a
+					 * copy of n's */
+					b->tvheap->strdict = n->tvheap->strdict;
 				}
 			}
 		}
 	} else if (unshare_string_heap(b) != GDK_SUCCEED)
 		return GDK_FAIL;
+	if (toff != ~(size_t) 0) {
+		/* we only have to copy the offsets from n to b,
+		 * possibly with an offset (if toff != 0), so set up
+		 * some variables and set up b's tail so that it looks
+		 * like it's a fixed size column.  Of course, we must
+		 * make sure first that the width of b's offset heap
+		 * can accommodate all values. */
+		if (b->twidth < SIZEOF_VAR_T &&
+		    ((size_t) 1 << 8 * b->twidth) <= (b->twidth <= 2 ? b->tvheap->size - GDK_VAROFFSET : b->tvheap->size)) {
+			/* offsets aren't going to fit, so widen
+			 * offset heap */
+			if (GDKupgradevarheap(b, (var_t) b->tvheap->size, 0, force) != GDK_SUCCEED) {
+				toff = ~(size_t) 0;
+				goto bunins_failed;
+			}
+		}
+	}
 	if (toff == 0 && n->twidth == b->twidth && cand == NULL) {
 		/* we don't need to do any translation of offset
 		 * values, so we can use fast memcpy */
@@ -532,6 +552,10 @@ BATappend(BAT *b, BAT *n, BAT *s, bit force)
 
 	ALIGNapp(b, "BATappend", force, GDK_FAIL);
 	BATcompatible(b, n, GDK_FAIL, "BATappend");
+	if (b->tzonemap == (Heap *) 1) {
+		/* load the zone map while it still matches b */
+		(void) BATcheckzonemap(b);
+	}
 
 	if (BATcount(b) == 0)
 		BAThseqbase(b, s ? s->hseqbase : n->hseqbase);
@@ -598,7 +622,7 @@ BATappend(BAT *b, BAT *n, BAT *s, bit force)
 	}
 
 	IMPSdestroy(b);		/* imprints do not support updates yet */
-	OIDXdestroy(b);
+	OIDXappend(b);
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
 	if (b->thash == (Hash *) 1 || BATcount(b) == 0) {
@@ -751,6 +775,7 @@ BATappend(BAT *b, BAT *n, BAT *s, bit force)
 			}
 		}
 	}
+	ZMappend(b);
 	if (b->tunique)
 		BBPunfix(s->batCacheid);
 	return GDK_SUCCEED;
@@ -870,6 +895,9 @@ BATdel(BAT *b, BAT *d)
 	b->tnokey[0] = b->tnokey[1] = 0;
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
+	/* the zone map can only be extended by appends, it cannot
+	 * follow values that moved */
+	ZMdestroy(b);
 
 	return GDK_SUCCEED;
 }
@@ -1304,15 +1332,36 @@ BATordered_rev(BAT *b)
 	return b->trevsorted;
 }
 
+/* use radix sort for integer columns from this size; each radix sort
+ * clears and scans a histogram of 2048 buckets per pass, which only
+ * pays off against a comparison sort from about a thousand values */
+#define RSORT_MINSIZE	((size_t) 1 << 11)
+
 /* figure out which sort function is to be called
  * stable sort can produce an error (not enough memory available),
  * "quick" sort does not produce errors */
 static gdk_return
-do_sort(void *h, void *t, const void *base, size_t n, int hs, int ts, int tpe,
-	int reverse, int stable)
+do_sort_serial(void *h, void *t, const void *base, size_t n, int hs, int ts,
+	       int tpe, int reverse, int stable)
 {
+	int tp = ATOMbasetype(tpe);
+
 	if (n <= 1)		/* trivially sorted */
 		return GDK_SUCCEED;
+	if (n >= RSORT_MINSIZE &&
+	    (tp == TYPE_sht || tp == TYPE_int || tp == TYPE_lng) &&
+	    base == NULL && hs == ATOMsize(tp) &&
+	    (t == NULL || ts == sizeof(oid))) {
+		/* radix sort is stable, so it serves both cases; it
+		 * needs scratch space, so if that can't be had, the
+		 * non-stable case falls back to the quick sort, which
+		 * doesn't */
+		if (GDKrsort(h, t, n, tp, reverse) == GDK_SUCCEED)
+			return GDK_SUCCEED;
+		if (stable)
+			return GDK_FAIL;
+		GDKclrerr();
+	}
 	if (reverse) {
 		if (stable) {
 			return GDKssort_rev(h, t, base, n, hs, ts, tpe);
@@ -1329,6 +1378,439 @@ do_sort(void *h, void *t, const void *base, size_t n, int hs, int ts, int tpe,
 	return GDK_SUCCEED;
 }
 
+/* Large sorts of fixed-size values run in parallel.  The input is cut
+ * into one run per thread and the runs are sorted concurrently with
+ * the serial sort.  The sorted runs are then merged pairwise, round by
+ * round.  Each merge is split over the threads at output positions
+ * whose split points in the two runs are found by binary search (the
+ * merge path), so that also the last round, which merges two halves,
+ * uses all threads.  On ties the merge takes from the left run, so the
+ * result is stable if the sorted runs are. */
+
+struct psort {
+	const char *h, *t;	/* source values and oids */
+	char *dh, *dt;		/* destination values and oids */
+	const void *base;
+	int hs, ts, tpe, reverse, stable;
+	size_t alo, ahi;	/* run to sort, or left run to merge */
+	size_t blo, bhi;	/* right run to merge */
+	size_t dlo;		/* where the merged output starts */
+	gdk_return ret;
+};
+
+static void
+psort_run(void *arg)
+{
+	struct psort *s = arg;
+
+	s->ret = do_sort_serial(s->dh + s->alo * s->hs,
+				s->dt ? s->dt + s->alo * s->ts : NULL,
+				s->base, s->ahi - s->alo, s->hs, s->ts,
+				s->tpe, s->reverse, s->stable);
+}
+
+#define PSORT_MERGE_LOOP(TYPE, OP, COPYOID)				\
+	do {								\
+		while (i < s->ahi && j < s->bhi) {			\
+			if (v[j] OP v[i]) {				\
+				dv[k] = v[j];				\
+				COPYOID(k, j);				\
+				j++;					\
+			} else {					\
+				dv[k] = v[i];				\
+				COPYOID(k, i);				\
+				i++;					\
+			}						\
+			k++;						\
+		}							\
+	} while (0)
+#define PSORT_COPYOID(K, I)	(dov[K] = ov[I])
+#define PSORT_NOOID(K, I)	((void) 0)
+
+#define PSORT_MERGE(TYPE)						\
+	do {								\
+		const TYPE *restrict v = (const TYPE *) s->h;		\
+		TYPE *restrict dv = (TYPE *) s->dh;			\
+		const oid *restrict ov = (const oid *) s->t;		\
+		oid *restrict dov = (oid *) s->dt;			\
+									\
+		if (ov && s->reverse)					\
+			PSORT_MERGE_LOOP(TYPE, >, PSORT_COPYOID);	\
+		else if (ov)						\
+			PSORT_MERGE_LOOP(TYPE, <, PSORT_COPYOID);	\
+		else if (s->reverse)					\
+			PSORT_MERGE_LOOP(TYPE, >, PSORT_NOOID);		\
+		else							\
+			PSORT_MERGE_LOOP(TYPE, <, PSORT_NOOID);		\
+	} while (0)
+
+static void
+psort_merge(void *arg)
+{
+	struct psort *s = arg;
+	size_t i = s->alo, j = s->blo, k = s->dlo;
+
+	switch (s->tpe) {
+	case TYPE_bte:
+		PSORT_MERGE(bte);
+		break;
+	case TYPE_sht:
+		PSORT_MERGE(sht);
+		break;
+	case TYPE_int:
+		PSORT_MERGE(int);
+		break;
+	case TYPE_lng:
+		PSORT_MERGE(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		PSORT_MERGE(hge);
+		break;
+#endif
+	case TYPE_flt:
+		PSORT_MERGE(flt);
+		break;
+	case TYPE_dbl:
+		PSORT_MERGE(dbl);
+		break;
+	default:
+		assert(0);
+	}
+	/* copy what is left of either run */
+	if (i < s->ahi) {
+		memcpy(s->dh + k * s->hs, s->h + i * s->hs, (s->ahi - i) * s->hs);
+		if (s->t)
+			memcpy(s->dt + k * s->ts, s->t + i * s->ts, (s->ahi - i) * s->ts);
+	} else if (j < s->bhi) {
+		memcpy(s->dh + k * s->hs, s->h + j * s->hs, (s->bhi - j) * s->hs);
+		if (s->t)
+			memcpy(s->dt + k * s->ts, s->t + j * s->ts, (s->bhi - j) * s->ts);
+	}
+	s->ret = GDK_SUCCEED;
+}
+
+/* does value y come strictly before value x? */
+#define PSORT_BEFORE(TYPE)						\
+	(reverse ? ((const TYPE *) h)[y] > ((const TYPE *) h)[x] :	\
+	 ((const TYPE *) h)[y] < ((const TYPE *) h)[x])
+
+static int
+psort_before(const char *h, int tpe, int reverse, size_t y, size_t x)
+{
+	switch (tpe) {
+	case TYPE_bte:
+		return PSORT_BEFORE(bte);
+	case TYPE_sht:
+		return PSORT_BEFORE(sht);
+	case TYPE_int:
+		return PSORT_BEFORE(int);
+	case TYPE_lng:
+		return PSORT_BEFORE(lng);
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		return PSORT_BEFORE(hge);
+#endif
+	case TYPE_flt:
+		return PSORT_BEFORE(flt);
+	case TYPE_dbl:
+		return PSORT_BEFORE(dbl);
+	default:
+		assert(0);
+		return 0;
+	}
+}
+
+/* return how many of the first k values of the merge of the runs
+ * [alo,alo+na) and [blo,blo+nb) come from the left run */
+static size_t
+psort_split(const char *h, int tpe, int reverse,
+	    size_t alo, size_t na, size_t blo, size_t nb, size_t k)
+{
+	size_t lo = k > nb ? k - nb : 0, hi = k < na ? k : na, i;
+
+	while (lo < hi) {
+		i = lo + (hi - lo) / 2;
+		/* if value k-i-1 of the right run doesn't come before
+		 * value i of the left run, the latter is among the
+		 * first k */
+		if (!psort_before(h, tpe, reverse, blo + k - i - 1, alo + i))
+			lo = i + 1;
+		else
+			hi = i;
+	}
+	return lo;
+}
+
+static gdk_return
+do_psort(char *h, char *t, size_t n, int hs, int ts, int tpe,
+	 int reverse, int stable, int nparts)
+{
+	struct psort *s;
+	void **args;
+	size_t *bnd;
+	char *h2 = NULL, *t2 = NULL;
+	const char *sh, *st;
+	char *dh, *dt;
+	int i, k, nruns, npieces, ntasks;
+	gdk_return ret = GDK_FAIL;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+
+	s = GDKmalloc((nparts + 1) * sizeof(struct psort));
+	args = GDKmalloc((nparts + 1) * sizeof(void *));
+	bnd = GDKmalloc((nparts + 1) * sizeof(size_t));
+	h2 = GDKmalloc(n * hs);
+	if (t)
+		t2 = GDKmalloc(n * ts);
+	if (s == NULL || args == NULL || bnd == NULL || h2 == NULL ||
+	    (t && t2 == NULL))
+		goto bailout;
+
+	/* sort the runs in place */
+	for (i = 0; i <= nparts; i++)
+		bnd[i] = n / nparts * i + (n % nparts) * i / nparts;
+	for (i = 0; i < nparts; i++) {
+		s[i] = (struct psort) {
+			.dh = h, .dt = t, .base = NULL,
+			.hs = hs, .ts = t ? ts : 0,
+			.tpe = tpe, .reverse = reverse, .stable = stable,
+			.alo = bnd[i], .ahi = bnd[i + 1],
+		};
+		args[i] = &s[i];
+	}
+	GDKparallel(psort_run, args, nparts);
+	for (i = 0; i < nparts; i++)
+		if (s[i].ret != GDK_SUCCEED)
+			goto bailout;
+
+	/* merge pairs of runs, from h to h2 and back */
+	sh = h;
+	st = t;
+	dh = h2;
+	dt = t2;
+	for (nruns = nparts; nruns > 1; nruns = (nruns + 1) / 2) {
+		npieces = nparts / (nruns / 2);
+		ntasks = 0;
+		for (i = 0; i < nruns; i += 2) {
+			size_t alo = bnd[i], blo, bhi, len, ka, kb, sa, sb;
+
+			if (i + 1 == nruns) {
+				/* odd one out: merge with empty run */
+				blo = bhi = bnd[i + 1];
+				k = npieces - 1;
+			} else {
+				blo = bnd[i + 1];
+				bhi = bnd[i + 2];
+				k = 0;
+			}
+			len = bhi - alo;
+			for (ka = 0, sa = 0; k < npieces; k++, ka = kb, sa = sb) {
+				kb = len / npieces * (k + 1) + (len % npieces) * (k + 1) / npieces;
+				sb = psort_split(sh, tpe, reverse,
+						 alo, blo - alo, blo, bhi - blo, kb);
+				s[ntasks] = (struct psort) {
+					.h = sh, .t = st, .dh = dh, .dt = dt,
+					.hs = hs, .ts = t ? ts : 0,
+					.tpe = tpe, .reverse = reverse,
+					.alo = alo + sa, .ahi = alo + sb,
+					.blo = blo + ka - sa, .bhi = blo + kb - sb,
+					.dlo = alo + ka,
+				};
+				args[ntasks] = &s[ntasks];
+				ntasks++;
+			}
+			bnd[i / 2] = alo;
+		}
+		bnd[(nruns + 1) / 2] = n;
+		GDKparallel(psort_merge, args, ntasks);
+		sh = dh;
+		st = dt;
+		dh = sh == h ? h2 : h;
+		dt = st == t ? t2 : t;
+	}
+	if (sh != h) {
+		memcpy(h, h2, n * hs);
+		if (t)
+			memcpy(t, t2, n * ts);
+	}
+	ALGODEBUG fprintf(stderr, "#do_psort(n=" SZFMT ",tpe=%s,reverse=%d,stable=%d): %d runs, " LLFMT " usec\n",
+			  n, ATOMname(tpe), reverse, stable, nparts,
+			  GDKusec() - t0);
+	ret = GDK_SUCCEED;
+
+  bailout:
+	GDKfree(s);
+	GDKfree(args);
+	GDKfree(bnd);
+	GDKfree(h2);
+	GDKfree(t2);
+	return ret;
+}
+
+static gdk_return
+do_sort(void *h, void *t, const void *base, size_t n, int hs, int ts, int tpe,
+	int reverse, int stable)
+{
+	int nparts, tp = ATOMbasetype(tpe);
+
+	if (n <= 1)		/* trivially sorted */
+		return GDK_SUCCEED;
+	switch (tp) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_flt:
+	case TYPE_dbl:
+		if (base == NULL && hs == ATOMsize(tp) &&
+		    (t == NULL || ts == sizeof(oid)) &&
+		    (nparts = GDKmorsels((BUN) n)) > 1)
+			return do_psort(h, t, n, hs, ts, tp, reverse, stable,
+					nparts);
+		break;
+	default:
+		break;
+	}
+	return do_sort_serial(h, t, base, n, hs, ts, tpe, reverse, stable);
+}
+
+/* Strings whose string heap is free of duplicates (GDK_STRDISTINCT)
+ * are sorted on their offsets (codes) instead of on the strings.  In
+ * a dictionary heap the offsets are in string order already, for a
+ * small heap we use the rank of each string instead.  strcode_encode
+ * replaces the offsets in b by these codes, with the sign bit flipped
+ * so that they sort correctly as signed integers, and returns the
+ * type to sort them with (b's own type if it doesn't apply, -1 on
+ * failure); strcode_decode turns the codes back into offsets. */
+#define STRCODE_SIGN(w)	((var_t) 1 << (8 * (w) - 1))
+
+static int
+strcode_encode(BAT *b, var_t **offsets)
+{
+	const Heap *h = b->tvheap;
+	BUN i, n = BATcount(b);
+	int w = b->twidth;
+	var_t pos, bias = w <= 2 ? GDK_VAROFFSET : 0, *rank = NULL;
+	size_t k, nstr = 0;
+
+	*offsets = NULL;
+	if (ATOMstorage(b->ttype) != TYPE_str || !GDK_STRDISTINCT(h))
+		return b->ttype;
+	if (!h->strdict) {
+		/* small heap: rank the strings */
+		if ((*offsets = GDKmalloc((h->free / GDK_VARALIGN + 1) * sizeof(var_t))) == NULL ||
+		    (rank = GDKmalloc((h->free / GDK_VARALIGN + 1) * sizeof(var_t))) == NULL) {
+			GDKfree(*offsets);
+			*offsets = NULL;
+			return -1;
+		}
+		for (pos = strNext(h, 0); pos != 0; pos = strNext(h, pos))
+			(*offsets)[nstr++] = pos;
+		GDKqsort(*offsets, NULL, h->base, nstr, (int) sizeof(var_t), 0,
+			 TYPE_str);
+		for (k = 0; k < nstr; k++)
+			rank[(*offsets)[k] / GDK_VARALIGN] = (var_t) k;
+	}
+	switch (w) {
+	case 1: {
+		unsigned char *v = (unsigned char *) Tloc(b, 0);
+		for (i = 0; i < n; i++) {
+			pos = rank ? rank[(v[i] + bias) / GDK_VARALIGN] : v[i];
+			v[i] = (unsigned char) (pos ^ STRCODE_SIGN(1));
+		}
+		break;
+	}
+	case 2: {
+		unsigned short *v = (unsigned short *) Tloc(b, 0);
+		for (i = 0; i < n; i++) {
+			pos = rank ? rank[(v[i] + bias) / GDK_VARALIGN] : v[i];
+			v[i] = (unsigned short) (pos ^ STRCODE_SIGN(2));
+		}
+		break;
+	}
+#if SIZEOF_VAR_T == 8
+	case 4: {
+		unsigned int *v = (unsigned int *) Tloc(b, 0);
+		for (i = 0; i < n; i++) {
+			pos = rank ? rank[v[i] / GDK_VARALIGN] : v[i];
+			v[i] = (unsigned int) (pos ^ STRCODE_SIGN(4));
+		}
+		break;
+	}
+#endif
+	default: {
+		var_t *v = (var_t *) Tloc(b, 0);
+		for (i = 0; i < n; i++) {
+			pos = rank ? rank[v[i] / GDK_VARALIGN] : v[i];
+			v[i] = pos ^ STRCODE_SIGN(SIZEOF_VAR_T);
+		}
+		break;
+	}
+	}
+	GDKfree(rank);
+	switch (w) {
+	case 1:
+		return TYPE_bte;
+	case 2:
+		return TYPE_sht;
+	case 4:
+		return TYPE_int;
+	default:
+		return TYPE_lng;
+	}
+}
+
+static void
+strcode_decode(BAT *b, var_t *offsets)
+{
+	BUN i, n = BATcount(b);
+	int w = b->twidth;
+	var_t pos, bias = w <= 2 ? GDK_VAROFFSET : 0;
+
+	switch (w) {
+	case 1: {
+		unsigned char *v = (unsigned char *) Tloc(b, 0);
+		for (i = 0; i < n; i++) {
+			pos = v[i] ^ STRCODE_SIGN(1);
+			v[i] = (unsigned char) (offsets ? offsets[pos] - bias : pos);
+		}
+		break;
+	}
+	case 2: {
+		unsigned short *v = (unsigned short *) Tloc(b, 0);
+		for (i = 0; i < n; i++) {
+			pos = v[i] ^ STRCODE_SIGN(2);
+			v[i] = (unsigned short) (offsets ? offsets[pos] - bias : pos);
+		}
+		break;
+	}
+#if SIZEOF_VAR_T == 8
+	case 4: {
+		unsigned int *v = (unsigned int *) Tloc(b, 0);
+		for (i = 0; i < n; i++) {
+			pos = v[i] ^ STRCODE_SIGN(4);
+			v[i] = (unsigned int) (offsets ? offsets[pos] : pos);
+		}
+		break;
+	}
+#endif
+	default: {
+		var_t *v = (var_t *) Tloc(b, 0);
+		for (i = 0; i < n; i++) {
+			pos = v[i] ^ STRCODE_SIGN(SIZEOF_VAR_T);
+			v[i] = offsets ? offsets[pos] : pos;
+		}
+		break;
+	}
+	}
+	GDKfree(offsets);
+}
+
 /* Sort the bat b according to both o and g.  The stable and reverse
  * parameters indicate whether the sort should be stable or descending
  * respectively.  The parameter b is required, o and g are optional
@@ -1373,6 +1855,8 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 	BAT *bn = NULL, *on = NULL, *gn, *pb = NULL;
 	oid *restrict grps, *restrict ords, prev;
 	BUN p, q, r;
+	int stpe;		/* type used for sorting bn */
+	var_t *offsets = NULL;
 
 	if (b == NULL) {
 		GDKerror("BATsort: b must exist\n");
@@ -1598,16 +2082,17 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 		assert(g->ttype == TYPE_oid);
 		grps = (oid *) Tloc(g, 0);
 		prev = grps[0];
-		if (BATmaterialize(bn) != GDK_SUCCEED)
+		if (BATmaterialize(bn) != GDK_SUCCEED ||
+		    (stpe = strcode_encode(bn, &offsets)) < 0)
 			goto error;
 		for (r = 0, p = 1, q = BATcount(g); p < q; p++) {
 			if (grps[p] != prev) {
 				/* sub sort [r,p) */
 				if (do_sort(Tloc(bn, r),
 					    ords ? ords + r : NULL,
-					    bn->tvheap ? bn->tvheap->base : NULL,
+					    stpe == bn->ttype && bn->tvheap ? bn->tvheap->base : NULL,
 					    p - r, Tsize(bn), ords ? sizeof(oid) : 0,
-					    bn->ttype, reverse, stable) != GDK_SUCCEED)
+					    stpe, reverse, stable) != GDK_SUCCEED)
 					goto error;
 				r = p;
 				prev = grps[p];
@@ -1616,10 +2101,14 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 		/* sub sort [r,q) */
 		if (do_sort(Tloc(bn, r),
 			    ords ? ords + r : NULL,
-			    bn->tvheap ? bn->tvheap->base : NULL,
+			    stpe == bn->ttype && bn->tvheap ? bn->tvheap->base : NULL,
 			    p - r, Tsize(bn), ords ? sizeof(oid) : 0,
-			    bn->ttype, reverse, stable) != GDK_SUCCEED)
+			    stpe, reverse, stable) != GDK_SUCCEED)
 			goto error;
+		if (stpe != bn->ttype) {
+			strcode_decode(bn, offsets);
+			offsets = NULL;
+		}
 		/* if single group (r==0) the result is (rev)sorted,
 		 * otherwise (maybe) not */
 		bn->tsorted = r == 0 && !reverse;
@@ -1651,18 +2140,24 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 		} else if (b->batCount <= 1) {
 			b->tsorted = b->trevsorted = 1;
 		}
-		if (!(reverse ? bn->trevsorted : bn->tsorted) &&
-		    (BATmaterialize(bn) != GDK_SUCCEED ||
-		     do_sort(Tloc(bn, 0),
-			     ords,
-			     bn->tvheap ? bn->tvheap->base : NULL,
-			     BATcount(bn), Tsize(bn), ords ? sizeof(oid) : 0,
-			     bn->ttype, reverse, stable) != GDK_SUCCEED)) {
-			if (m != NULL) {
-				HEAPfree(m, 1);
-				GDKfree(m);
+		if (!(reverse ? bn->trevsorted : bn->tsorted)) {
+			if (BATmaterialize(bn) != GDK_SUCCEED ||
+			    (stpe = strcode_encode(bn, &offsets)) < 0 ||
+			    do_sort(Tloc(bn, 0),
+				    ords,
+				    stpe == bn->ttype && bn->tvheap ? bn->tvheap->base : NULL,
+				    BATcount(bn), Tsize(bn), ords ? sizeof(oid) : 0,
+				    stpe, reverse, stable) != GDK_SUCCEED) {
+				if (m != NULL) {
+					HEAPfree(m, 1);
+					GDKfree(m);
+				}
+				goto error;
+			}
+			if (stpe != bn->ttype) {
+				strcode_decode(bn, offsets);
+				offsets = NULL;
 			}
-			goto error;
 		}
 		bn->tsorted = !reverse;
 		bn->trevsorted = reverse;
@@ -1707,6 +2202,7 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 	return GDK_SUCCEED;
 
   error:
+	GDKfree(offsets);
 	if (bn)
 		BBPunfix(bn->batCacheid);
 	BBPreclaim(on);
@@ -1719,6 +2215,110 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 	return GDK_FAIL;
 }
 
+/* Return a copy of the string BAT b whose string heap is a
+ * dictionary: each distinct string of b occurs in it exactly once and
+ * the strings are in ascending order.  The offsets into such a heap
+ * preserve both equality and order of the strings, so selects,
+ * grouping, joins and sorting can work on the offsets (see
+ * GDK_STRDISTINCT).  Adding a new string to the heap turns it back
+ * into an ordinary string heap. */
+BAT *
+BATstrdict(BAT *b)
+{
+	BAT *gn = NULL, *en = NULL, *un = NULL, *sn = NULL, *on = NULL;
+	BAT *bn = NULL;
+	BATiter si;
+	var_t *codes = NULL, v, bias;
+	const oid *grps, *ords;
+	BUN i, n, ngrp;
+	lng t0 = GDKusec();
+
+	if (ATOMstorage(b->ttype) != TYPE_str) {
+		GDKerror("BATstrdict: b must be a string BAT\n");
+		return NULL;
+	}
+	/* the distinct strings of b, in ascending order */
+	if (BATgroup(&gn, &en, NULL, b, NULL, NULL, NULL, NULL) != GDK_SUCCEED ||
+	    (un = BATproject(en, b)) == NULL ||
+	    BATsort(&sn, &on, NULL, un, NULL, NULL, 0, 0) != GDK_SUCCEED)
+		goto bailout;
+	n = BATcount(b);
+	ngrp = BATcount(sn);
+	bn = COLnew(b->hseqbase, b->ttype, MAX(n, ngrp), TRANSIENT);
+	if (bn == NULL ||
+	    (codes = GDKmalloc(MAX(ngrp, 1) * sizeof(var_t))) == NULL)
+		goto bailout;
+
+	/* enter the strings into the new heap in order and remember
+	 * the offset of each group */
+	si = bat_iterator(sn);
+	for (i = 0; i < ngrp; i++) {
+		if (BUNappend(bn, BUNtvar(si, i), FALSE) != GDK_SUCCEED)
+			goto bailout;
+	}
+	ords = on->ttype == TYPE_void ? NULL : (const oid *) Tloc(on, 0);
+	for (i = 0; i < ngrp; i++)
+		codes[(ords ? ords[i] : on->tseqbase + i) - un->hseqbase] =
+			VarHeapVal(Tloc(bn, 0), i, bn->twidth);
+
+	/* replace the offsets by those of the strings of b, the
+	 * offset heap is wide enough for all of them */
+	grps = gn->ttype == TYPE_void ? NULL : (const oid *) Tloc(gn, 0);
+	bias = bn->twidth <= 2 ? GDK_VAROFFSET : 0;
+	for (i = 0; i < n; i++) {
+		v = codes[grps ? grps[i] : gn->tseqbase + i] - bias;
+		switch (bn->twidth) {
+		case 1:
+			((unsigned char *) Tloc(bn, 0))[i] = (unsigned char) v;
+			break;
+		case 2:
+			((unsigned short *) Tloc(bn, 0))[i] = (unsigned short) v;
+			break;
+#if SIZEOF_VAR_T == 8
+		case 4:
+			((unsigned int *) Tloc(bn, 0))[i] = (unsigned int) v;
+			break;
+#endif
+		default:
+			((var_t *) Tloc(bn, 0))[i] = v;
+			break;
+		}
+	}
+	BATsetcount(bn, n);
+	bn->tvheap->strdict = 1;
+	bn->tsorted = b->tsorted;
+	bn->trevsorted = b->trevsorted;
+	bn->tkey = b->tkey;
+	bn->tnil = b->tnil;
+	bn->tnonil = b->tnonil;
+	bn->tnosorted = b->tnosorted;
+	bn->tnorevsorted = b->tnorevsorted;
+	bn->tnokey[0] = b->tnokey[0];
+	bn->tnokey[1] = b->tnokey[1];
+
+	GDKfree(codes);
+	BBPunfix(gn->batCacheid);
+	BBPunfix(en->batCacheid);
+	BBPunfix(un->batCacheid);
+	BBPunfix(sn->batCacheid);
+	BBPunfix(on->batCacheid);
+	ALGODEBUG fprintf(stderr, "#BATstrdict(b=%s#" BUNFMT ")=%s: "
+			  BUNFMT " strings, heap " SZFMT " bytes " LLFMT "us\n",
+			  BATgetId(b), BATcount(b), BATgetId(bn), ngrp,
+			  bn->tvheap->free, GDKusec() - t0);
+	return bn;
+
+  bailout:
+	GDKfree(codes);
+	BBPreclaim(gn);
+	BBPreclaim(en);
+	BBPreclaim(un);
+	BBPreclaim(sn);
+	BBPreclaim(on);
+	BBPreclaim(bn);
+	return NULL;
+}
+
 /* return a new BAT of length n with a dense head with seqbase hseq,
  * and the constant v in the tail */
 BAT *
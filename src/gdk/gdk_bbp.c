@@ -333,7 +333,7 @@ BBPselectfarm(int role, int type, enum heaptype hptype)
 		role = TRANSIENT;
 #endif
 #ifndef PERSISTENTIDX
-	if (hptype == orderidxheap)
+	if (hptype == orderidxheap || hptype == zonemapheap)
 		role = TRANSIENT;
 #endif
 	for (i = 0; i < MAXFARMS; i++)
@@ -970,7 +970,7 @@ headheapinit(oid *hseq, const char *buf, bat bid)
 }
 
 static int
-heapinit(BAT *b, const char *buf, int *hashash, const char *HT, int bbpversion, bat bid)
+heapinit(BAT *b, const char *buf, int *hashash, int *strdict, const char *HT, int bbpversion, bat bid)
 {
 	int t;
 	char type[11];
@@ -1011,7 +1011,8 @@ heapinit(BAT *b, const char *buf, int *hashash, const char *HT, int bbpversion,
 	if (properties & ~0x0F81)
 		GDKfatal("BBPinit: unknown properties are set: incompatible database\n");
 	*hashash = var & 2;
-	var &= ~2;
+	*strdict = var & 4;
+	var &= ~6;
 	/* silently convert chr columns to bte */
 	if (strcmp(type, "chr") == 0)
 		strcpy(type, "bte");
@@ -1067,7 +1068,7 @@ heapinit(BAT *b, const char *buf, int *hashash, const char *HT, int bbpversion,
 }
 
 static int
-vheapinit(BAT *b, const char *buf, int hashash, bat bid)
+vheapinit(BAT *b, const char *buf, int hashash, int strdict, bat bid)
 {
 	int n = 0;
 	lng free, size;
@@ -1090,6 +1091,7 @@ vheapinit(BAT *b, const char *buf, int hashash, bat bid)
 		b->tvheap->copied = 0;
 		b->tvheap->hashash = hashash != 0;
 		b->tvheap->cleanhash = 1;
+		b->tvheap->strdict = strdict != 0;
 		b->tvheap->newstorage = (storage_t) storage;
 		b->tvheap->dirty = 0;
 		b->tvheap->parentid = bid;
@@ -1124,7 +1126,7 @@ BBPreadEntries(FILE *fp, int bbpversion)
 		char tailname[129];
 		unsigned short map_head = 0, map_tail = 0, map_hheap = 0, map_theap = 0;
 #endif
-		int Thashash;
+		int Thashash, Tstrdict;
 
 		if ((s = strchr(buf, '\r')) != NULL) {
 			/* convert \r\n into just \n */
@@ -1207,8 +1209,8 @@ BBPreadEntries(FILE *fp, int bbpversion)
 				GDKfatal("BBPinit: head seqbase out of range (ID = "LLFMT", seq = "LLFMT").", batid, base);
 			bn->hseqbase = (oid) base;
 		}
-		nread += heapinit(bn, buf + nread, &Thashash, "T", bbpversion, bid);
-		nread += vheapinit(bn, buf + nread, Thashash, bid);
+		nread += heapinit(bn, buf + nread, &Thashash, &Tstrdict, "T", bbpversion, bid);
+		nread += vheapinit(bn, buf + nread, Thashash, Tstrdict, bid);
 
 		if (bbpversion <= GDKLIBRARY_NOKEY &&
 		    (bn->tnokey[0] != 0 || bn->tnokey[1] != 0)) {
@@ -1586,7 +1588,9 @@ heap_entry(FILE *fp, BAT *b)
 		       BUNFMT " " OIDFMT " " SZFMT " " SZFMT " %d",
 		       b->ttype >= 0 ? BATatoms[b->ttype].name : ATOMunknown_name(b->ttype),
 		       b->twidth,
-		       b->tvarsized | (b->tvheap ? b->tvheap->hashash << 1 : 0),
+		       b->tvarsized |
+			   (b->tvheap ? b->tvheap->hashash << 1 |
+			    b->tvheap->strdict << 2 : 0),
 		       (unsigned short) b->tsorted |
 			   ((unsigned short) b->trevsorted << 7) |
 			   (((unsigned short) b->tkey & 0x01) << 8) |
@@ -3763,6 +3767,15 @@ BBPdiskscan(const char *parent, size_t baseoff)
 					b->torderidx = (Heap *) 1;
 #else
 				delete = TRUE;
+#endif
+			} else if (strncmp(p + 1, "tzonemap", 8) == 0) {
+#ifdef PERSISTENTIDX
+				BAT *b = getdesc(bid);
+				delete = b == NULL;
+				if (!delete)
+					b->tzonemap = (Heap *) 1;
+#else
+				delete = TRUE;
 #endif
 			} else if (strncmp(p + 1, "priv", 4) != 0 &&
 				   strncmp(p + 1, "new", 3) != 0 &&
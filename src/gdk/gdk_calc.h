@@ -121,6 +121,7 @@ gdk_export gdk_return VARconvert(ValPtr ret, const ValRecord *v, int abort_on_er
 gdk_export gdk_return BATcalcavg(BAT *b, BAT *s, dbl *avg, BUN *vals);
 
 gdk_export BAT *BATgroupsum(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
+gdk_export gdk_return BATgroupsumpartials(BAT **partialsp, BAT **gidsp, BAT *b, BAT *g, BAT *e, BAT *s, oid off, int skip_nils);
 gdk_export BAT *BATgroupprod(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export gdk_return BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupcount(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
@@ -129,6 +130,11 @@ gdk_export BAT *BATgroupmin(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nil
 gdk_export BAT *BATgroupmax(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupmedian(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile, int skip_nils, int abort_on_error);
+gdk_export gdk_return BATgroupquantilesketch(BAT **meansp, BAT **weightsp, BAT **gidsp, BAT *b, BAT *g, BAT *e, BAT *s, oid off, int skip_nils);
+gdk_export BAT *BATgroupapproxquantile(BAT *b, BAT *w, BAT *g, BAT *e, BAT *s, double quantile, int skip_nils);
+gdk_export BAT *BATgroupapproxcountdistinct(BAT *b, BAT *g, BAT *e, BAT *s);
+gdk_export BAT *BATgroupcountdistinctsketch(BAT *b, BAT *g, BAT *e, BAT *s);
+gdk_export BAT *BATgroupcountdistinctmerge(BAT *r, BAT *g, BAT *e);
 
 /* helper function for grouped aggregates */
 gdk_export const char *BATgroupaggrinit(
@@ -114,6 +114,10 @@ BATundo(BAT *b)
 			}
 		}
 	}
+	if (bunlast >= b->batInserted) {
+		ZMdestroy(b);
+		OIDXdestroy(b);
+	}
 	b->theap.free = tailsize(b, b->batInserted);
 
 	BATsetcount(b, b->batInserted);
@@ -40,7 +40,7 @@
  * is always created.  In other words, the groups argument may not be
  * NULL, but the extents and histo arguments may be NULL.
  *
- * There are six different implementations of the grouping code.
+ * There are seven different implementations of the grouping code.
  *
  * If it can be trivially determined that all groups are singletons,
  * we can produce the outputs trivially.
@@ -56,6 +56,9 @@
  * consecutive values in b and need to scan sections of g for equal
  * groups.
  *
+ * If b is large (more than one morsel) and not sorted, we group
+ * morsels in parallel in private hash tables and merge the results.
+ *
  * If a hash table already exists on b, we can make use of it.
  *
  * Otherwise we build a partial hash table on the fly.
@@ -177,12 +180,22 @@
 	)
 
 
+/* give up on queries that were cancelled or timed out */
+#define GRP_check_interrupt()						\
+	do {								\
+		if (GDK_CHECK_INTERRUPT(r)) {				\
+			GDKerror("BATgroup: query interrupted.\n");	\
+			goto error;					\
+		}							\
+	} while (0)
+
 #define GRP_subscan_old_groups(INIT_0,INIT_1,COMP,KEEP)			\
 	do {								\
 		INIT_0;							\
 		pgrp[grps[0]] = 0;					\
 		j = 0;							\
 		for (r = 0; r < cnt; r++) {				\
+			GRP_check_interrupt();				\
 			if (cand) {					\
 				p = *cand++ - b->hseqbase;		\
 			} else {					\
@@ -265,6 +278,7 @@
 		INIT_0;							\
 		if (grps) {						\
 			for (r = 0; r < cnt; r++) {			\
+				GRP_check_interrupt();			\
 				if (cand) {				\
 					p = cand[r] - hseqb + lo;	\
 				} else {				\
@@ -313,6 +327,7 @@
 			}						\
 		} else {						\
 			for (r = 0; r < cnt; r++) {			\
+				GRP_check_interrupt();			\
 				if (cand) {				\
 					p = cand[r] - hseqb + lo;	\
 				} else {				\
@@ -418,6 +433,7 @@ pop(oid x)
 	do {								\
 		if (cand) {						\
 			for (r = 0; r < cnt; r++) {			\
+				GRP_check_interrupt();			\
 				p = cand[r] - b->hseqbase;		\
 				assert(p < end);			\
 				INIT_1;					\
@@ -452,6 +468,7 @@ pop(oid x)
 			}						\
 		} else {						\
 			for (r = 0; r < cnt; r++) {			\
+				GRP_check_interrupt();			\
 				p = start + r;				\
 				assert(p < end);			\
 				INIT_1;					\
@@ -460,8 +477,9 @@ pop(oid x)
 				     hb != HASHnil(hs) && hb >= start;	\
 				     hb = HASHgetlink(hs, hb)) {	\
 					ASSERT;				\
-					GRPTST(hb - start, r);		\
-					grp = ngrps[hb - start];	\
+					q = hb - start;			\
+					GRPTST(q, r);			\
+					grp = ngrps[q];			\
 					if (COMP) {			\
 						ngrps[r] = grp;		\
 						if (histo)		\
@@ -515,6 +533,490 @@ pop(oid x)
 	)
 
 
+/* Parallel grouping of large inputs.  The rows are split into one
+ * morsel per thread, and each thread groups its morsel using a
+ * private open addressing hash table, labelling the rows with
+ * morsel-local group ids.  The local groups are then distributed over
+ * as many partitions as there are morsels based on their hash value,
+ * and each thread merges the groups of one partition from all
+ * morsels, adding up their counts.  Finally the groups are numbered
+ * in order of first appearance (i.e. the same numbering the serial
+ * code produces) by sorting them on the position of their first
+ * member, and each thread relabels the rows of its morsel. */
+
+#define GRPPAR_INIT	1024	/* initial size of a morsel's group table */
+
+#define GRPPAR_BITS_int(V)	((ulng) (unsigned int) (V))
+#define GRPPAR_BITS_lng(V)	((ulng) (V))
+#ifdef HAVE_HGE
+#define GRPPAR_BITS_hge(V)	((ulng) (V) ^ (ulng) ((uhge) (V) >> 64))
+#endif
+#define GRPPAR_BITS_flt(V)	grppar_bits_flt(V)
+#define GRPPAR_BITS_dbl(V)	grppar_bits_dbl(V)
+#define GRPPAR_PART(H, N)	((int) (((H) >> 40) % (ulng) (N)))
+
+static inline ulng
+grppar_bits_flt(flt v)
+{
+	union { flt f; unsigned int i; } u;
+
+	u.f = v;
+	return (ulng) u.i;
+}
+
+static inline ulng
+grppar_bits_dbl(dbl v)
+{
+	union { dbl d; ulng i; } u;
+
+	u.d = v;
+	return u.i;
+}
+
+/* hash a value (as bits) together with its old group */
+static inline ulng
+grppar_hash(ulng v, oid g)
+{
+	v = (v ^ (ulng) g * (ulng) LL_CONSTANT(0x9E3779B97F4A7C15)) *
+		(ulng) LL_CONSTANT(0xBF58476D1CE4E5B9);
+	return v ^ (v >> 29);
+}
+
+struct grptab {
+	void *keys;		/* value of each group */
+	oid *grps;		/* old group of each group (if subgrouping) */
+	oid *first;		/* position in b of the first member */
+	lng *cnts;		/* number of members */
+	ulng *hash;		/* hash value of each group */
+	BUN ngrp, maxgrp;
+	BUN *slots;		/* group + 1 for each slot, 0 if empty */
+	BUN mask;
+};
+
+struct grpmorsel {
+	BAT *b;
+	const oid *cand;	/* candidates of the morsel, or NULL */
+	const oid *grps;	/* old groups of the morsel, or NULL */
+	BUN start;		/* position in b of first row (no cand) */
+	BUN cnt;		/* number of rows */
+	oid *ngrps;		/* new groups of the morsel */
+	int tpe;
+	int nparts;
+	struct grptab tab;	/* morsel-local groups */
+	BUN *order;		/* local groups ordered by partition */
+	BUN *poff;		/* start of each partition in order */
+	BUN *map;		/* local group -> partition group -> group */
+	const BUN *rank;	/* group id of each (partition, group) */
+	const BUN *goff;	/* first (partition, group) of each partition */
+	bit sorted;
+	gdk_return ret;
+};
+
+struct grppart {
+	struct grpmorsel *morsels;
+	int nmorsels;
+	int part;
+	int tpe;
+	struct grptab tab;	/* groups of the partition */
+	gdk_return ret;
+};
+
+static gdk_return
+grptab_init(struct grptab *tab, int width, int subgroup, BUN size)
+{
+	BUN nslots = 1;
+
+	while (nslots < 2 * size)
+		nslots <<= 1;
+	tab->ngrp = 0;
+	tab->maxgrp = size;
+	tab->mask = nslots - 1;
+	tab->keys = GDKmalloc(size * width);
+	tab->grps = subgroup ? GDKmalloc(size * sizeof(oid)) : NULL;
+	tab->first = GDKmalloc(size * sizeof(oid));
+	tab->cnts = GDKmalloc(size * sizeof(lng));
+	tab->hash = GDKmalloc(size * sizeof(ulng));
+	tab->slots = GDKzalloc(nslots * sizeof(BUN));
+	if (tab->keys == NULL || (subgroup && tab->grps == NULL) ||
+	    tab->first == NULL || tab->cnts == NULL ||
+	    tab->hash == NULL || tab->slots == NULL)
+		return GDK_FAIL;
+	return GDK_SUCCEED;
+}
+
+#define GRPTAB_GROW(F, SZ)						\
+	do {								\
+		void *_p = GDKrealloc(tab->F, size * (SZ));		\
+		if (_p == NULL)						\
+			return GDK_FAIL;				\
+		tab->F = _p;						\
+	} while (0)
+
+/* double the capacity of a group table and rehash its groups */
+static gdk_return
+grptab_grow(struct grptab *tab, int width)
+{
+	BUN size = tab->maxgrp * 2;
+	BUN i, s;
+
+	GRPTAB_GROW(keys, width);
+	if (tab->grps)
+		GRPTAB_GROW(grps, sizeof(oid));
+	GRPTAB_GROW(first, sizeof(oid));
+	GRPTAB_GROW(cnts, sizeof(lng));
+	GRPTAB_GROW(hash, sizeof(ulng));
+	tab->maxgrp = size;
+	GDKfree(tab->slots);
+	tab->mask = tab->mask * 2 + 1;
+	if ((tab->slots = GDKzalloc((tab->mask + 1) * sizeof(BUN))) == NULL)
+		return GDK_FAIL;
+	for (i = 0; i < tab->ngrp; i++) {
+		for (s = (BUN) tab->hash[i] & tab->mask;
+		     tab->slots[s] != 0;
+		     s = (s + 1) & tab->mask)
+			;
+		tab->slots[s] = i + 1;
+	}
+	return GDK_SUCCEED;
+}
+
+static void
+grptab_free(struct grptab *tab)
+{
+	GDKfree(tab->keys);
+	GDKfree(tab->grps);
+	GDKfree(tab->first);
+	GDKfree(tab->cnts);
+	GDKfree(tab->hash);
+	GDKfree(tab->slots);
+}
+
+/* find the group with value V and old group G (hash H) in TAB and add
+ * CNT members to it, or create it with its first member at FIRST;
+ * IDX is set to the group */
+#define GRPTAB_ADD(TYPE, TAB, V, G, H, FIRST, CNT, IDX)			\
+	do {								\
+		TYPE *_k = (TYPE *) (TAB)->keys;			\
+		BUN _s = (BUN) (H) & (TAB)->mask;			\
+		while ((IDX = (TAB)->slots[_s]) != 0) {			\
+			IDX--;						\
+			if ((TAB)->hash[IDX] == (H) &&			\
+			    _k[IDX] == (V) &&				\
+			    ((TAB)->grps == NULL || (TAB)->grps[IDX] == (G))) \
+				break;					\
+			_s = (_s + 1) & (TAB)->mask;			\
+		}							\
+		if ((TAB)->slots[_s] != 0) {				\
+			(TAB)->cnts[IDX] += (CNT);			\
+		} else {						\
+			if ((TAB)->ngrp == (TAB)->maxgrp) {		\
+				if (grptab_grow((TAB), sizeof(TYPE)) != GDK_SUCCEED) \
+					goto bailout;			\
+				_k = (TYPE *) (TAB)->keys;		\
+				for (_s = (BUN) (H) & (TAB)->mask;	\
+				     (TAB)->slots[_s] != 0;		\
+				     _s = (_s + 1) & (TAB)->mask)	\
+					;				\
+			}						\
+			IDX = (TAB)->ngrp++;				\
+			(TAB)->slots[_s] = IDX + 1;			\
+			_k[IDX] = (V);					\
+			if ((TAB)->grps)				\
+				(TAB)->grps[IDX] = (G);			\
+			(TAB)->first[IDX] = (FIRST);			\
+			(TAB)->cnts[IDX] = (CNT);			\
+			(TAB)->hash[IDX] = (H);				\
+		}							\
+	} while (0)
+
+#define GRPPAR_LOCAL(TYPE)						\
+	do {								\
+		const TYPE *restrict w = (const TYPE *) Tloc(gm->b, 0); \
+		for (r = 0; r < gm->cnt; r++) {				\
+			p = gm->cand ? gm->cand[r] - hseq : gm->start + r; \
+			g = gm->grps ? gm->grps[r] : 0;			\
+			h = grppar_hash(GRPPAR_BITS_##TYPE(w[p]), g);	\
+			GRPTAB_ADD(TYPE, tab, w[p], g, h, (oid) p, 1, i); \
+			gm->ngrps[r] = (oid) i;				\
+		}							\
+	} while (0)
+
+/* group the rows of one morsel, and order the resulting groups by
+ * partition */
+static void
+GRPparallel_local(void *arg)
+{
+	struct grpmorsel *gm = arg;
+	struct grptab *tab = &gm->tab;
+	const oid hseq = gm->b->hseqbase;
+	BUN r, p, i;
+	oid g;
+	ulng h;
+	int q;
+
+	gm->ret = GDK_FAIL;
+	if (grptab_init(tab, ATOMsize(gm->tpe), gm->grps != NULL,
+			GRPPAR_INIT) != GDK_SUCCEED)
+		return;
+	switch (gm->tpe) {
+	case TYPE_int:
+		GRPPAR_LOCAL(int);
+		break;
+	case TYPE_lng:
+		GRPPAR_LOCAL(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		GRPPAR_LOCAL(hge);
+		break;
+#endif
+	case TYPE_flt:
+		GRPPAR_LOCAL(flt);
+		break;
+	case TYPE_dbl:
+		GRPPAR_LOCAL(dbl);
+		break;
+	default:
+		assert(0);
+	}
+	gm->poff = GDKzalloc((gm->nparts + 1) * sizeof(BUN));
+	gm->order = GDKmalloc(tab->ngrp * sizeof(BUN));
+	gm->map = GDKmalloc(tab->ngrp * sizeof(BUN));
+	if (gm->poff == NULL || gm->order == NULL || gm->map == NULL)
+		return;
+	for (i = 0; i < tab->ngrp; i++)
+		gm->poff[GRPPAR_PART(tab->hash[i], gm->nparts) + 1]++;
+	for (q = 0; q < gm->nparts; q++)
+		gm->poff[q + 1] += gm->poff[q];
+	/* fill order, moving each poff[q] to the start of q + 1 */
+	for (i = 0; i < tab->ngrp; i++)
+		gm->order[gm->poff[GRPPAR_PART(tab->hash[i], gm->nparts)]++] = i;
+	for (q = gm->nparts; q > 0; q--)
+		gm->poff[q] = gm->poff[q - 1];
+	gm->poff[0] = 0;
+	gm->ret = GDK_SUCCEED;
+  bailout:
+	return;
+}
+
+#define GRPPAR_MERGE(TYPE)						\
+	do {								\
+		for (k = 0; k < gp->nmorsels; k++) {			\
+			const struct grpmorsel *gm = &gp->morsels[k];	\
+			const TYPE *w = (const TYPE *) gm->tab.keys;	\
+			for (j = gm->poff[q]; j < gm->poff[q + 1]; j++) { \
+				l = gm->order[j];			\
+				GRPTAB_ADD(TYPE, tab, w[l],		\
+					   gm->tab.grps ? gm->tab.grps[l] : 0, \
+					   gm->tab.hash[l],		\
+					   gm->tab.first[l],		\
+					   gm->tab.cnts[l], i);		\
+				gm->map[l] = i;				\
+			}						\
+		}							\
+	} while (0)
+
+/* merge the local groups of one partition of all morsels; since the
+ * morsels are processed in order, the first member of each group
+ * comes from the first morsel in which it occurs */
+static void
+GRPparallel_merge(void *arg)
+{
+	struct grppart *gp = arg;
+	struct grptab *tab = &gp->tab;
+	const int q = gp->part;
+	BUN size = 0, i, j, l;
+	int k;
+
+	gp->ret = GDK_FAIL;
+	for (k = 0; k < gp->nmorsels; k++)
+		size += gp->morsels[k].poff[q + 1] - gp->morsels[k].poff[q];
+	if (grptab_init(tab, ATOMsize(gp->tpe),
+			gp->morsels[0].grps != NULL,
+			MAX(size, 1)) != GDK_SUCCEED)
+		return;
+	switch (gp->tpe) {
+	case TYPE_int:
+		GRPPAR_MERGE(int);
+		break;
+	case TYPE_lng:
+		GRPPAR_MERGE(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		GRPPAR_MERGE(hge);
+		break;
+#endif
+	case TYPE_flt:
+		GRPPAR_MERGE(flt);
+		break;
+	case TYPE_dbl:
+		GRPPAR_MERGE(dbl);
+		break;
+	default:
+		assert(0);
+	}
+	gp->ret = GDK_SUCCEED;
+  bailout:
+	return;
+}
+
+/* relabel the rows of one morsel with the final group ids */
+static void
+GRPparallel_relabel(void *arg)
+{
+	struct grpmorsel *gm = arg;
+	const struct grptab *tab = &gm->tab;
+	oid *restrict ngrps = gm->ngrps;
+	BUN i, r;
+
+	for (i = 0; i < tab->ngrp; i++)
+		gm->map[i] = gm->rank[gm->goff[GRPPAR_PART(tab->hash[i], gm->nparts)] + gm->map[i]];
+	gm->sorted = 1;
+	for (r = 0; r < gm->cnt; r++) {
+		ngrps[r] = (oid) gm->map[ngrps[r]];
+		if (r > 0 && ngrps[r] < ngrps[r - 1])
+			gm->sorted = 0;
+	}
+}
+
+/* Group the cnt rows of b (the candidates cand, or the rows starting
+ * at position start) with values of type tpe and optional old groups
+ * grps into ngrps using nparts threads.  On success, *extsp and
+ * *cntsp are set to newly allocated arrays with the extents and
+ * histogram of the *ngrpp groups, and *sortedp tells whether the
+ * group ids in ngrps are sorted. */
+static gdk_return
+GRPparallel(BAT *b, const oid *cand, BUN start, BUN cnt, const oid *grps,
+	    int tpe, int nparts, oid *ngrps,
+	    oid **extsp, lng **cntsp, BUN *ngrpp, bit *sortedp)
+{
+	struct grpmorsel *morsels;
+	struct grppart *parts;
+	void **args;
+	BUN *goff = NULL, *rank = NULL;
+	oid *firsts = NULL, *tags = NULL;
+	lng *gcnts = NULL, *cnts = NULL;
+	BUN ngrp, i, j;
+	bit sorted;
+	int k;
+	gdk_return ret = GDK_FAIL;
+
+	morsels = GDKzalloc(nparts * sizeof(struct grpmorsel));
+	parts = GDKzalloc(nparts * sizeof(struct grppart));
+	args = GDKmalloc(nparts * sizeof(void *));
+	if (morsels == NULL || parts == NULL || args == NULL)
+		goto bailout;
+	for (k = 0; k < nparts; k++) {
+		struct grpmorsel *gm = &morsels[k];
+		BUN lo = cnt / nparts * k;
+		BUN hi = k == nparts - 1 ? cnt : cnt / nparts * (k + 1);
+
+		gm->b = b;
+		gm->cand = cand ? cand + lo : NULL;
+		gm->grps = grps ? grps + lo : NULL;
+		gm->start = start + lo;
+		gm->cnt = hi - lo;
+		gm->ngrps = ngrps + lo;
+		gm->tpe = tpe;
+		gm->nparts = nparts;
+		args[k] = gm;
+	}
+	GDKparallel(GRPparallel_local, args, nparts);
+	for (k = 0; k < nparts; k++)
+		if (morsels[k].ret != GDK_SUCCEED)
+			goto bailout;
+
+	for (k = 0; k < nparts; k++) {
+		parts[k].morsels = morsels;
+		parts[k].nmorsels = nparts;
+		parts[k].part = k;
+		parts[k].tpe = tpe;
+		args[k] = &parts[k];
+	}
+	GDKparallel(GRPparallel_merge, args, nparts);
+	for (k = 0; k < nparts; k++)
+		if (parts[k].ret != GDK_SUCCEED)
+			goto bailout;
+
+	/* number the groups in order of their first member */
+	goff = GDKmalloc((nparts + 1) * sizeof(BUN));
+	if (goff == NULL)
+		goto bailout;
+	goff[0] = 0;
+	for (k = 0; k < nparts; k++)
+		goff[k + 1] = goff[k] + parts[k].tab.ngrp;
+	ngrp = goff[nparts];
+	firsts = GDKmalloc(ngrp * sizeof(oid));
+	tags = GDKmalloc(ngrp * sizeof(oid));
+	gcnts = GDKmalloc(ngrp * sizeof(lng));
+	cnts = GDKmalloc(ngrp * sizeof(lng));
+	rank = GDKmalloc(ngrp * sizeof(BUN));
+	if (firsts == NULL || tags == NULL || gcnts == NULL ||
+	    cnts == NULL || rank == NULL)
+		goto bailout;
+	for (k = 0; k < nparts; k++) {
+		const struct grptab *tab = &parts[k].tab;
+
+		for (i = 0, j = goff[k]; i < tab->ngrp; i++, j++) {
+			firsts[j] = tab->first[i];
+			tags[j] = (oid) j;
+			gcnts[j] = tab->cnts[i];
+		}
+	}
+	if (GDKrsort(firsts, tags, ngrp, TYPE_oid, 0) != GDK_SUCCEED)
+		goto bailout;
+	for (j = 0; j < ngrp; j++) {
+		rank[tags[j]] = j;
+		firsts[j] += b->hseqbase;
+		cnts[j] = gcnts[tags[j]];
+	}
+
+	for (k = 0; k < nparts; k++) {
+		morsels[k].rank = rank;
+		morsels[k].goff = goff;
+		args[k] = &morsels[k];
+	}
+	GDKparallel(GRPparallel_relabel, args, nparts);
+	sorted = 1;
+	for (k = 0; k < nparts; k++) {
+		if (!morsels[k].sorted ||
+		    (k > 0 && morsels[k].ngrps[0] < morsels[k].ngrps[-1]))
+			sorted = 0;
+	}
+
+	*extsp = firsts;
+	*cntsp = cnts;
+	*ngrpp = ngrp;
+	*sortedp = sorted;
+	firsts = NULL;
+	cnts = NULL;
+	ret = GDK_SUCCEED;
+  bailout:
+	if (morsels) {
+		for (k = 0; k < nparts; k++) {
+			grptab_free(&morsels[k].tab);
+			GDKfree(morsels[k].order);
+			GDKfree(morsels[k].poff);
+			GDKfree(morsels[k].map);
+		}
+	}
+	if (parts) {
+		for (k = 0; k < nparts; k++)
+			grptab_free(&parts[k].tab);
+	}
+	GDKfree(morsels);
+	GDKfree(parts);
+	GDKfree(args);
+	GDKfree(goff);
+	GDKfree(rank);
+	GDKfree(firsts);
+	GDKfree(tags);
+	GDKfree(gcnts);
+	GDKfree(cnts);
+	return ret;
+}
+
 gdk_return
 BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 		  BAT *b, BAT *s, BAT *g, BAT *e, BAT *h, int subsorted)
@@ -540,6 +1042,7 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 	const oid *restrict cand, *candend;
 	oid maxgrp = oid_nil;	/* maximum value of g BAT (if subgrouping) */
 	PROPrec *prop;
+	int nparts;
 
 	if (b == NULL) {
 		GDKerror("BATgroup: b must exist\n");
@@ -736,9 +1239,17 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 		maxgrps += BATcount(h);
 	if (maxgrps < GROUPBATINCR)
 		maxgrps = GROUPBATINCR;
-	if (b->twidth <= 2 &&
-	    maxgrps > ((BUN) 1 << (8 << (b->twidth == 2))))
-		maxgrps = (BUN) 1 << (8 << (b->twidth == 2));
+	if (b->twidth <= 2) {
+		BUN nvals = (BUN) 1 << (8 << (b->twidth == 2));
+
+		/* the array code for bte and sht values below never
+		 * extends the extents and histo bats, so make room
+		 * for all possible values up front */
+		if (g == NULL && maxgrps < cnt)
+			maxgrps = cnt;
+		if (maxgrps > nvals)
+			maxgrps = nvals;
+	}
 	if (extents) {
 		en = COLnew(0, TYPE_oid, maxgrps, TRANSIENT);
 		if (en == NULL)
@@ -765,7 +1276,7 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 	/* for strings we can use the offset instead of the actual
 	 * string values if we know that the strings in the string
 	 * heap are unique */
-	if (t == TYPE_str && GDK_ELIMDOUBLES(b->tvheap)) {
+	if (t == TYPE_str && GDK_STRDISTINCT(b->tvheap)) {
 		switch (b->twidth) {
 		case 1:
 			t = TYPE_bte;
@@ -990,6 +1501,55 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 			r++;
 		}
 		GDKfree(sgrps);
+	} else if ((t == TYPE_int || t == TYPE_lng ||
+#ifdef HAVE_HGE
+		    t == TYPE_hge ||
+#endif
+		    t == TYPE_flt || t == TYPE_dbl) &&
+		   (nparts = GDKmorsels(cnt)) > 1) {
+		oid *pexts;
+		lng *pcnts;
+		BUN pngrp;
+		bit sorted;
+
+		/* large input: group morsels in parallel and merge
+		 * the partial results */
+		ALGODEBUG fprintf(stderr, "#BATgroup(b=%s#" BUNFMT "[%s],"
+				  "s=%s#" BUNFMT ","
+				  "g=%s#" BUNFMT ","
+				  "e=%s#" BUNFMT ","
+				  "h=%s#" BUNFMT ",subsorted=%d): "
+				  "parallel hash (%d threads)\n",
+				  BATgetId(b), BATcount(b), ATOMname(b->ttype),
+				  s ? BATgetId(s) : "NULL", s ? BATcount(s) : 0,
+				  g ? BATgetId(g) : "NULL", g ? BATcount(g) : 0,
+				  e ? BATgetId(e) : "NULL", e ? BATcount(e) : 0,
+				  h ? BATgetId(h) : "NULL", h ? BATcount(h) : 0,
+				  subsorted, nparts);
+		if (GRPparallel(b, cand, start, cnt, grps, t, nparts, ngrps,
+				&pexts, &pcnts, &pngrp, &sorted) != GDK_SUCCEED)
+			goto error;
+		if (pngrp > maxgrps) {
+			maxgrps = pngrp;
+			if ((extents && BATextend(en, maxgrps) != GDK_SUCCEED) ||
+			    (histo && BATextend(hn, maxgrps) != GDK_SUCCEED)) {
+				GDKfree(pexts);
+				GDKfree(pcnts);
+				goto error;
+			}
+			if (extents)
+				exts = (oid *) Tloc(en, 0);
+			if (histo)
+				cnts = (lng *) Tloc(hn, 0);
+		}
+		if (extents)
+			memcpy(exts, pexts, pngrp * sizeof(oid));
+		if (histo)
+			memcpy(cnts, pcnts, pngrp * sizeof(lng));
+		GDKfree(pexts);
+		GDKfree(pcnts);
+		ngrp = (oid) pngrp;
+		gn->tsorted = sorted;
 	} else if (BATcheckhash(b) ||
 		   (b->batPersistence == PERSISTENT &&
 		    BAThash(b, 0) == GDK_SUCCEED)
@@ -1130,7 +1690,7 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 				GRP_create_partial_hash_table_core(
 					(void) 0,
 					(v = ((ulng)grps[r]<<8)|(unsigned char)w[p], hash_lng(hs, &v)),
-					w[p] == w[hb] && grps[r] == grps[hb - start],
+					w[p] == w[hb] && grps[r] == grps[q],
 					(void) 0,
 					NOGRPTST);
 			} else
@@ -1147,7 +1707,7 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 				GRP_create_partial_hash_table_core(
 					(void) 0,
 					(v = ((ulng)grps[r]<<16)|(unsigned short)w[p], hash_lng(hs, &v)),
-					w[p] == w[hb] && grps[r] == grps[hb - start],
+					w[p] == w[hb] && grps[r] == grps[q],
 					(void) 0,
 					NOGRPTST);
 			} else
@@ -1164,7 +1724,7 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 				GRP_create_partial_hash_table_core(
 					(void) 0,
 					(v = ((ulng)grps[r]<<32)|(unsigned int)w[p], hash_lng(hs, &v)),
-					w[p] == w[hb] && grps[r] == grps[hb - start],
+					w[p] == w[hb] && grps[r] == grps[q],
 					(void) 0,
 					NOGRPTST);
 			} else
@@ -1178,7 +1738,7 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 				GRP_create_partial_hash_table_core(
 					(void) 0,
 					(v = ((uhge)grps[r]<<64)|(ulng)w[p], hash_hge(hs, &v)),
-					w[p] == w[hb] && grps[r] == grps[hb - start],
+					w[p] == w[hb] && grps[r] == grps[q],
 					(void) 0,
 					NOGRPTST);
 			} else
@@ -157,6 +157,219 @@ HASHnew(Heap *hp, int tpe, BUN size, BUN mask, BUN count)
 		}						\
 	} while (0)
 
+/* Parallel hash construction.  Each value is hashed once.  The
+ * buckets are divided over the threads in contiguous ranges, and the
+ * build goes in four passes, each of which runs on all threads:
+ *
+ * 1. each thread hashes a range of rows, remembers the bucket of each
+ *    row, and counts how many of its rows go into each bucket range;
+ * 2. each thread moves its (row, bucket) pairs into the area of the
+ *    bucket range, at the offsets computed from the counts, and
+ *    remembers for each row where its pair went;
+ * 3. each thread inserts the pairs of its own bucket range in row
+ *    order; it writes the bucket heads, which are contiguous, and
+ *    replaces the bucket of each pair by the previous head of the
+ *    bucket, i.e. the link of the row, which it writes sequentially;
+ * 4. each thread copies the links of its range of rows into the Link
+ *    array.
+ *
+ * No two threads write into the same part of the hash or of the
+ * buffers, and the result is identical to a serial build, so the
+ * persisted layout doesn't change. */
+struct hashpair {
+	BUN row;
+	BUN val;		/* bucket, later the link of row */
+};
+
+struct hashbuild {
+	BAT *b;
+	Hash *h;		/* the hash being built */
+	BUN *pos;		/* per row: bucket, later index in pairs */
+	struct hashpair *pairs;	/* the rows grouped by bucket range */
+	BUN *cnt;		/* per bucket range: count, later offset */
+	BUN first, last;	/* rows of this thread (passes 1, 2, 4) */
+	BUN lo, hi;		/* buckets of this thread (pass 3) */
+	BUN plo, phi;		/* pairs of this thread (pass 3) */
+	BUN rangesize;		/* number of buckets per range */
+	int nparts;
+};
+
+#define hashrange(hb, c)						\
+	((c) / (hb)->rangesize < (BUN) (hb)->nparts ?			\
+	 (c) / (hb)->rangesize : (BUN) (hb)->nparts - 1)
+
+#define hashrows(TYPE)							\
+	do {								\
+		const TYPE *v = (const TYPE *) BUNtloc(bi, 0);		\
+		for (p = hb->first; p < hb->last; p++) {		\
+			BUN c = (BUN) hash_##TYPE(h, v + p);		\
+									\
+			hb->pos[p] = c;					\
+			hb->cnt[hashrange(hb, c)]++;			\
+		}							\
+	} while (0)
+
+/* pass 1: hash the rows */
+static void
+HASHbuildhash(void *arg)
+{
+	struct hashbuild *hb = arg;
+	Hash *h = hb->h;
+	BATiter bi = bat_iterator(hb->b);
+	BUN p;
+
+	switch (ATOMbasetype(hb->b->ttype)) {
+	case TYPE_bte:
+		hashrows(bte);
+		break;
+	case TYPE_sht:
+		hashrows(sht);
+		break;
+	case TYPE_int:
+		hashrows(int);
+		break;
+	case TYPE_flt:
+		hashrows(flt);
+		break;
+	case TYPE_dbl:
+		hashrows(dbl);
+		break;
+	case TYPE_lng:
+		hashrows(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		hashrows(hge);
+		break;
+#endif
+	default:
+		for (p = hb->first; p < hb->last; p++) {
+			BUN c = (BUN) heap_hash_any(hb->b->tvheap, h, BUNtail(bi, p));
+
+			hb->pos[p] = c;
+			hb->cnt[hashrange(hb, c)]++;
+		}
+		break;
+	}
+}
+
+/* pass 2: group the rows by bucket range */
+static void
+HASHbuildscatter(void *arg)
+{
+	struct hashbuild *hb = arg;
+	BUN p, c, o;
+
+	for (p = hb->first; p < hb->last; p++) {
+		c = hb->pos[p];
+		o = hb->cnt[hashrange(hb, c)]++;
+		hb->pairs[o].row = p;
+		hb->pairs[o].val = c;
+		hb->pos[p] = o;
+	}
+}
+
+/* pass 3: insert the rows of a bucket range */
+static void
+HASHbuildinsert(void *arg)
+{
+	struct hashbuild *hb = arg;
+	Hash *h = hb->h;
+	BUN i, c;
+
+	for (i = hb->plo; i < hb->phi; i++) {
+		c = hb->pairs[i].val;
+		assert(c >= hb->lo && c < hb->hi);
+		hb->pairs[i].val = HASHget(h, c);
+		HASHput(h, c, hb->pairs[i].row);
+	}
+}
+
+/* pass 4: fill in the links */
+static void
+HASHbuildlink(void *arg)
+{
+	struct hashbuild *hb = arg;
+	Hash *h = hb->h;
+	BUN p;
+
+	for (p = hb->first; p < hb->last; p++)
+		HASHputlink(h, p, hb->pairs[hb->pos[p]].val);
+}
+
+/* insert rows [p,q) of b into h using nparts threads */
+static gdk_return
+HASHbuildparallel(BAT *b, Hash *h, BUN p, BUN q, int nparts)
+{
+	struct hashbuild *parts;
+	void **args;
+	BUN *pos, *cnt;
+	struct hashpair *pairs;
+	BUN nbuckets = h->mask + 1;
+	/* the counts of a thread take whole cache lines */
+	size_t stride = (nparts + 7) & ~7;
+	BUN n = q - p, o;
+	int i, j;
+
+	if ((BUN) nparts > nbuckets)
+		nparts = (int) nbuckets;
+	parts = GDKmalloc(nparts * sizeof(struct hashbuild));
+	args = GDKmalloc(nparts * sizeof(void *));
+	cnt = GDKzalloc(nparts * stride * sizeof(BUN));
+	/* indexed by row number, the first p are not used */
+	pos = GDKmalloc(q * sizeof(BUN));
+	pairs = GDKmalloc(n * sizeof(struct hashpair));
+	if (parts == NULL || args == NULL || cnt == NULL ||
+	    pos == NULL || pairs == NULL) {
+		GDKfree(parts);
+		GDKfree(args);
+		GDKfree(cnt);
+		GDKfree(pos);
+		GDKfree(pairs);
+		return GDK_FAIL;
+	}
+	for (i = 0; i < nparts; i++) {
+		struct hashbuild *hb = &parts[i];
+
+		hb->b = b;
+		hb->h = h;
+		hb->pos = pos;
+		hb->pairs = pairs;
+		hb->cnt = cnt + i * stride;
+		hb->first = p + n / nparts * i;
+		hb->last = i == nparts - 1 ? q : p + n / nparts * (i + 1);
+		hb->rangesize = nbuckets / nparts;
+		hb->lo = hb->rangesize * i;
+		hb->hi = i == nparts - 1 ? nbuckets : hb->rangesize * (i + 1);
+		hb->nparts = nparts;
+		args[i] = hb;
+	}
+	GDKparallel(HASHbuildhash, args, nparts);
+	/* turn the counts into offsets: the pairs of bucket range j
+	 * are ordered by thread, and thus by row */
+	o = 0;
+	for (j = 0; j < nparts; j++) {
+		parts[j].plo = o;
+		for (i = 0; i < nparts; i++) {
+			BUN c = parts[i].cnt[j];
+
+			parts[i].cnt[j] = o;
+			o += c;
+		}
+		parts[j].phi = o;
+	}
+	assert(o == n);
+	GDKparallel(HASHbuildscatter, args, nparts);
+	GDKparallel(HASHbuildinsert, args, nparts);
+	GDKparallel(HASHbuildlink, args, nparts);
+	GDKfree(parts);
+	GDKfree(args);
+	GDKfree(cnt);
+	GDKfree(pos);
+	GDKfree(pairs);
+	return GDK_SUCCEED;
+}
+
 /* collect HASH statistics for analysis */
 static void
 HASHcollisions(BAT *b, Hash *h)
@@ -335,6 +548,7 @@ BAThash(BAT *b, BUN masksize)
 		BUN mask, maxmask = 0;
 		BUN p = 0, q = BUNlast(b), r;
 		Hash *h = NULL;
+		int nparts;
 		Heap *hp;
 		const char *nme = BBP_physical(b->batCacheid);
 		if (GDKinmemory()) {
@@ -464,6 +678,17 @@ BAThash(BAT *b, BUN masksize)
 
 		/* finish the hashtable with the current mask */
 		p = r;
+		nparts = tpe == TYPE_void ? 1 : GDKmorsels(q - p);
+		if (nparts > 1) {
+			if (HASHbuildparallel(b, h, p, q, nparts) == GDK_SUCCEED) {
+				ALGODEBUG fprintf(stderr, "#BAThash: built " BUNFMT " rows using %d threads\n", q - p, nparts);
+				p = q;
+			} else {
+				/* not enough memory to start the
+				 * threads, build serially */
+				GDKclrerr();
+			}
+		}
 		switch (tpe) {
 		case TYPE_bte:
 			finishhash(bte);
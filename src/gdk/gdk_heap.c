@@ -94,6 +94,7 @@ HEAPalloc(Heap *h, size_t nitems, size_t itemsize)
 		h->size = MAX(1, nitems) * itemsize;
 	h->free = 0;
 	h->cleanhash = 0;
+	h->strdict = 0;
 
 	/* check for overflow */
 	if (itemsize && nitems > (h->size / itemsize)) {
@@ -564,6 +565,7 @@ HEAPcopy(Heap *dst, Heap *src)
 		memcpy(dst->base, src->base, src->free);
 		dst->hashash = src->hashash;
 		dst->cleanhash = src->cleanhash;
+		dst->strdict = src->strdict;
 		return GDK_SUCCEED;
 	}
 	return GDK_FAIL;
@@ -583,6 +585,8 @@ HEAPfree(Heap *h, int remove)
 		} else if (h->storage == STORE_CMEM) {
 			//heap is stored in regular C memory rather than GDK memory,so we call free()
 			free(h->base);
+		} else if (h->storage == STORE_NOWN) {
+			/* memory belongs to someone else, only forget about it */
 		} else {	/* mapped file, or STORE_PRIV */
 			gdk_return ret = GDKmunmap(h->base, h->size);
 
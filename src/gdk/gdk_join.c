@@ -2389,12 +2389,22 @@ binsearchcand(const oid *cand, BUN lo, BUN hi, oid v)
 		if (hb >= (lo) && hb < (hi) &&			\
 		    simple_EQ(v, BUNtloc(bi, hb), TYPE))
 
+/* give up on queries that were cancelled or timed out */
+#define HASHJOIN_CHECK_INTERRUPT(i)					\
+	do {								\
+		if (GDK_CHECK_INTERRUPT(i)) {				\
+			GDKerror("hashjoin: query interrupted.\n");	\
+			goto bailout;					\
+		}							\
+	} while (0)
+
 #define HASHJOIN(TYPE, WIDTH)						\
 	do {								\
 		BUN hashnil = HASHnil(hsh);				\
 		for (lo = lstart + l->hseqbase;				\
 		     lstart < lend;					\
 		     lo++) {						\
+			HASHJOIN_CHECK_INTERRUPT(lstart);		\
 			v = FVALUE(l, lstart);				\
 			lstart++;					\
 			nr = 0;						\
@@ -2449,6 +2459,8 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	int lskipped = 0;	/* whether we skipped values in l */
 	const Hash *restrict hsh;
 	int t;
+	var_t *codes = NULL;	/* code in r of each string in l */
+	BUN *bkts = NULL;	/* hash bucket of each string in l */
 
 	ALGODEBUG fprintf(stderr, "#hashjoin(l=%s#" BUNFMT "[%s]%s%s%s,"
 			  "r=%s#" BUNFMT "[%s]%s%s%s,sl=%s#" BUNFMT "%s%s%s,"
@@ -2588,8 +2600,87 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 #endif
 			}
 		}
+	} else if (lcand == NULL && rcand == NULL && lvars != NULL &&
+		   !nil_matches && !nil_on_miss && !semi && !only_misses &&
+		   t == TYPE_str &&
+		   GDK_ELIMDOUBLES(l->tvheap) && GDK_STRDISTINCT(r->tvheap)) {
+		/* special case for strings: if both string heaps are
+		 * free of duplicates, a string is identified by its
+		 * offset (code) in the heap; we look up the code and
+		 * hash bucket in r only once for each distinct string
+		 * of l, and then join on the codes */
+		const char *rvals = (const char *) Tloc(r, 0);
+		Heap *rheap = r->tvheap;
+		BUN hashnil = HASHnil(hsh);
+		size_t i, ncodes = l->tvheap->free / GDK_VARALIGN + 1;
+		var_t loff, rcode;
+
+		codes = GDKmalloc(ncodes * sizeof(var_t));
+		bkts = GDKmalloc(ncodes * sizeof(BUN));
+		if (codes == NULL || bkts == NULL)
+			goto bailout;
+		for (i = 0; i < ncodes; i++)
+			bkts[i] = BUN_NONE;
+		for (lo = lstart + l->hseqbase; lstart < lend; lo++) {
+			HASHJOIN_CHECK_INTERRUPT(lstart);
+			loff = VarHeapVal(lvals, lstart, lwidth);
+			lstart++;
+			/* strings in a small heap are aligned */
+			assert(loff % GDK_VARALIGN == 0);
+			i = loff / GDK_VARALIGN;
+			if (bkts[i] == BUN_NONE) {
+				v = lvars + loff;
+				bkts[i] = HASHprobe(hsh, v);
+				codes[i] = 0;
+				if (GDK_STRNIL(v)) {
+					/* nil doesn't match */
+				} else if (rheap == l->tvheap) {
+					codes[i] = loff;
+				} else if (GDK_ELIMDOUBLES(rheap)) {
+					codes[i] = strLocate(rheap, v);
+				} else {
+					for (rb = HASHget(hsh, bkts[i]);
+					     rb != hashnil;
+					     rb = HASHgetlink(hsh, rb)) {
+						rcode = VarHeapVal(rvals, rb, r->twidth);
+						if (GDK_STREQ(v, rheap->base + rcode)) {
+							codes[i] = rcode;
+							break;
+						}
+					}
+				}
+			}
+			nr = 0;
+			if ((rcode = codes[i]) != 0) {
+				for (rb = HASHget(hsh, bkts[i]);
+				     rb != hashnil;
+				     rb = HASHgetlink(hsh, rb))
+					if (rb >= rl && rb < rh &&
+					    VarHeapVal(rvals, rb, r->twidth) == rcode) {
+						ro = (oid) (rb - rl + rseq);
+						HASHLOOPBODY();
+					}
+			}
+			if (nr == 0) {
+				lskipped = BATcount(r1) > 0;
+			} else {
+				if (lskipped)
+					r1->tdense = 0;
+				if (nr > 1) {
+					r1->tkey = 0;
+					r1->tdense = 0;
+				}
+				if (BATcount(r1) > nr)
+					r1->trevsorted = 0;
+			}
+		}
+		GDKfree(codes);
+		GDKfree(bkts);
+		codes = NULL;
+		bkts = NULL;
 	} else if (lcand) {
 		while (lcand < lcandend) {
+			HASHJOIN_CHECK_INTERRUPT((BUN) (lcandend - lcand));
 			lo = *lcand++;
 			if (BATtvoid(l)) {
 				if (l->tseqbase != oid_nil)
@@ -2681,6 +2772,7 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 		}
 	} else {
 		for (lo = lstart + l->hseqbase; lstart < lend; lo++) {
+			HASHJOIN_CHECK_INTERRUPT(lstart);
 			if (BATtvoid(l)) {
 				if (l->tseqbase != oid_nil)
 					lval = lo - l->hseqbase + l->tseqbase;
@@ -2861,6 +2953,437 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	return GDK_SUCCEED;
 
   bailout:
+	GDKfree(codes);
+	GDKfree(bkts);
+	BBPreclaim(r1);
+	BBPreclaim(r2);
+	return GDK_FAIL;
+}
+
+/* Radix-partitioned hash join.
+ *
+ * A single hash table over a large inner side is probed at random
+ * locations, so nearly every probe is a cache (and TLB) miss.  Here
+ * both sides are first clustered on the low nbits bits of the hash
+ * value, chosen such that each partition of the inner side (values,
+ * oids and a bucket and link per value) fits in RADIX_CACHE_SIZE
+ * bytes.  The clustering is done in passes of at most RADIX_PASS_BITS
+ * bits each, which bounds the number of destinations a single pass
+ * scatters to (and so its TLB misses).  Each pair of partitions is
+ * then joined by building a small hash table on the inner partition,
+ * using the hash bits above the radix bits, and probing it with the
+ * outer partition.  The partitions are divided over threads.
+ *
+ * The clustering is stable, so within each partition the outer side
+ * is in the original order, but the results as a whole are not
+ * sorted.  Only used for int, lng and hge columns without (or with
+ * dense) candidate lists. */
+
+#define RADIX_CACHE_SIZE	((size_t) 256 << 10)
+#define RADIX_PASS_BITS		12
+#define RADIX_MAX_BITS		20
+/* don't use radix join if the hash table on the inner side fits in
+ * this many bytes: random probes then mostly hit the last level cache
+ * and clustering both sides costs more than it saves */
+#define RADIX_THRESHOLD		(128 * RADIX_CACHE_SIZE)
+
+#define RADIXCLUSTER(TYPE)						\
+	do {								\
+		const TYPE *restrict src = (const TYPE *) vals;		\
+		TYPE *cv[2];						\
+		const TYPE *sv;						\
+		TYPE *dv;						\
+									\
+		for (i = 0; i < cnt; i++) {				\
+			if (!nil_matches && src[i] == TYPE##_nil)	\
+				continue;				\
+			bounds[((BUN) mix_##TYPE(src[i]) & mask) + 1]++; \
+		}							\
+		for (p = 0; p < nparts; p++)				\
+			bounds[p + 1] += bounds[p];			\
+		/* one extra so that we never allocate 0 bytes */	\
+		n = bounds[nparts];					\
+		cv[0] = GDKmalloc((n + 1) * sizeof(TYPE));		\
+		cv[1] = npass > 1 ? GDKmalloc((n + 1) * sizeof(TYPE)) : NULL; \
+		co[0] = GDKmalloc((n + 1) * sizeof(oid));		\
+		co[1] = npass > 1 ? GDKmalloc((n + 1) * sizeof(oid)) : NULL; \
+		*cvalsp = cv[(npass - 1) & 1];				\
+		*cvalsp2 = cv[npass & 1];				\
+		*coidsp = co[(npass - 1) & 1];				\
+		*coidsp2 = co[npass & 1];				\
+		if (cv[0] == NULL || co[0] == NULL ||			\
+		    (npass > 1 && (cv[1] == NULL || co[1] == NULL)))	\
+			goto bailout;					\
+		sv = NULL;						\
+		for (pass = 0, done = 0; pass < npass; pass++) {	\
+			bits = nbits - done;				\
+			if (bits > RADIX_PASS_BITS)			\
+				bits = RADIX_PASS_BITS;			\
+			done += bits;					\
+			shift = nbits - done;				\
+			for (p = 0; p < ((BUN) 1 << done); p++)		\
+				cur[p] = bounds[p << shift];		\
+			dv = cv[pass & 1];				\
+			do_ = co[pass & 1];				\
+			if (pass == 0) {				\
+				for (i = 0; i < cnt; i++) {		\
+					if (!nil_matches && src[i] == TYPE##_nil) \
+						continue;		\
+					p = ((BUN) mix_##TYPE(src[i]) & mask) >> shift; \
+					dv[cur[p]] = src[i];		\
+					do_[cur[p]++] = seq + i;	\
+				}					\
+			} else {					\
+				for (i = 0; i < n; i++) {		\
+					p = ((BUN) mix_##TYPE(sv[i]) & mask) >> shift; \
+					dv[cur[p]] = sv[i];		\
+					do_[cur[p]++] = so[i];		\
+				}					\
+			}						\
+			sv = dv;					\
+			so = do_;					\
+		}							\
+	} while (0)
+
+/* cluster the cnt values in vals, which have oids starting at seq, on
+ * the low nbits bits of their hash value; the clustered values and
+ * oids are returned in *cvalsp and *coidsp, the start of partition p
+ * in (*boundsp)[p], and the (possibly NULL) scratch space used for
+ * the intermediate passes in *cvalsp2 and *coidsp2 */
+static gdk_return
+radixcluster(int tpe, const void *vals, oid seq, BUN cnt, int nil_matches,
+	     int nbits, BUN **boundsp, void **cvalsp, oid **coidsp,
+	     void **cvalsp2, oid **coidsp2)
+{
+	BUN nparts = (BUN) 1 << nbits, mask = nparts - 1;
+	int npass = (nbits + RADIX_PASS_BITS - 1) / RADIX_PASS_BITS;
+	int pass, done, bits, shift;
+	BUN *restrict bounds, *restrict cur;
+	oid *co[2];
+	const oid *so = NULL;
+	oid *do_;
+	BUN i, p, n;
+
+	*boundsp = bounds = GDKzalloc((nparts + 1) * sizeof(BUN));
+	cur = GDKmalloc(nparts * sizeof(BUN));
+	*cvalsp = *cvalsp2 = NULL;
+	*coidsp = *coidsp2 = NULL;
+	if (bounds == NULL || cur == NULL)
+		goto bailout;
+	switch (tpe) {
+	case TYPE_int:
+		RADIXCLUSTER(int);
+		break;
+	case TYPE_lng:
+		RADIXCLUSTER(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		RADIXCLUSTER(hge);
+		break;
+#endif
+	}
+	GDKfree(cur);
+	return GDK_SUCCEED;
+
+  bailout:
+	GDKfree(cur);
+	return GDK_FAIL;
+}
+
+struct radixjoin_part {
+	int tpe;
+	int nbits;
+	const void *lvals, *rvals;	/* clustered values */
+	const oid *loids, *roids;	/* clustered oids */
+	const BUN *lbounds, *rbounds;	/* partition boundaries */
+	BUN pfirst, plast;		/* partitions joined by this thread */
+	BUN maxinner;			/* largest inner partition */
+	oid *r1, *r2;			/* results */
+	BUN cnt, cap;
+	int failed;
+};
+
+#define RADIXPROBE(TYPE)						\
+	do {								\
+		const TYPE *restrict lv = (const TYPE *) rp->lvals;	\
+		const TYPE *restrict rv = (const TYPE *) rp->rvals;	\
+									\
+		for (p = rp->pfirst; p < rp->plast; p++) {		\
+			ib = rp->rbounds[p];				\
+			ie = rp->rbounds[p + 1];			\
+			ob = rp->lbounds[p];				\
+			oe = rp->lbounds[p + 1];			\
+			if (ib == ie || ob == oe)			\
+				continue;				\
+			for (mask = 1; mask < ie - ib; mask <<= 1)	\
+				;					\
+			mask--;						\
+			for (x = 0; x <= mask; x++)			\
+				buckets[x] = BUN_NONE;			\
+			/* insert backward so that the chains are in	\
+			 * ascending order */				\
+			for (x = ie - ib; x > 0; x--) {			\
+				h = ((BUN) mix_##TYPE(rv[ib + x - 1]) >> rp->nbits) & mask; \
+				links[x - 1] = buckets[h];		\
+				buckets[h] = x - 1;			\
+			}						\
+			for (o = ob; o < oe; o++) {			\
+				h = ((BUN) mix_##TYPE(lv[o]) >> rp->nbits) & mask; \
+				for (x = buckets[h]; x != BUN_NONE; x = links[x]) { \
+					if (rv[ib + x] != lv[o])	\
+						continue;		\
+					if (rp->cnt == rp->cap) {	\
+						rp->cap *= 2;		\
+						t1 = GDKrealloc(rp->r1, rp->cap * sizeof(oid)); \
+						if (t1 == NULL)		\
+							goto bailout;	\
+						rp->r1 = t1;		\
+						t2 = GDKrealloc(rp->r2, rp->cap * sizeof(oid)); \
+						if (t2 == NULL)		\
+							goto bailout;	\
+						rp->r2 = t2;		\
+					}				\
+					rp->r1[rp->cnt] = rp->loids[o];	\
+					rp->r2[rp->cnt++] = rp->roids[ib + x]; \
+				}					\
+			}						\
+		}							\
+	} while (0)
+
+/* join the partitions pfirst up to plast, run in a thread of its own */
+static void
+radixprobe(void *arg)
+{
+	struct radixjoin_part *rp = arg;
+	BUN *buckets, *links;
+	BUN p, ib, ie, ob, oe, o, x, h, mask, nb;
+	oid *t1, *t2;
+
+	for (nb = 1; nb < rp->maxinner; nb <<= 1)
+		;
+	buckets = GDKmalloc(nb * sizeof(BUN));
+	links = GDKmalloc(rp->maxinner * sizeof(BUN));
+	/* assume most outer values find a single match */
+	rp->cap = rp->lbounds[rp->plast] - rp->lbounds[rp->pfirst];
+	if (rp->cap < 1024)
+		rp->cap = 1024;
+	rp->r1 = GDKmalloc(rp->cap * sizeof(oid));
+	rp->r2 = GDKmalloc(rp->cap * sizeof(oid));
+	if (buckets == NULL || links == NULL ||
+	    rp->r1 == NULL || rp->r2 == NULL)
+		goto bailout;
+	switch (rp->tpe) {
+	case TYPE_int:
+		RADIXPROBE(int);
+		break;
+	case TYPE_lng:
+		RADIXPROBE(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		RADIXPROBE(hge);
+		break;
+#endif
+	}
+	GDKfree(buckets);
+	GDKfree(links);
+	return;
+
+  bailout:
+	GDKfree(buckets);
+	GDKfree(links);
+	rp->failed = 1;
+}
+
+/* whether radixjoin can be used to join l with r, where r is the inner
+ * (hashed) side */
+static int
+radixjoinable(BAT *l, BAT *r, BAT *sl, BAT *sr, BUN rcount)
+{
+	int t = ATOMbasetype(r->ttype);
+
+	if (t != TYPE_int && t != TYPE_lng
+#ifdef HAVE_HGE
+	    && t != TYPE_hge
+#endif
+		)
+		return 0;
+	if (BATtvoid(l) || BATtvoid(r) ||
+	    (sl && !BATtdense(sl)) || (sr && !BATtdense(sr)))
+		return 0;
+	return (size_t) rcount * (r->twidth + sizeof(oid) + 2 * sizeof(BUN)) > RADIX_THRESHOLD;
+}
+
+static gdk_return
+radixjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
+	  lng t0, int swapped, const char *reason)
+{
+	BUN lstart, lend, lcnt;
+	const oid *lcand = NULL, *lcandend = NULL;
+	BUN rstart, rend, rcnt;
+	const oid *rcand = NULL, *rcandend = NULL;
+	BUN *lbounds = NULL, *rbounds = NULL;
+	void *lvals = NULL, *rvals = NULL, *lvals2 = NULL, *rvals2 = NULL;
+	oid *loids = NULL, *roids = NULL, *loids2 = NULL, *roids2 = NULL;
+	struct radixjoin_part *parts = NULL;
+	void **args = NULL;
+	int tpe = ATOMbasetype(r->ttype);
+	int nbits, nthreads = 0, i;
+	BUN nparts, p, cnt, size, tot;
+	oid *dst1, *dst2;
+
+	ALGODEBUG fprintf(stderr, "#radixjoin(l=%s#" BUNFMT "[%s],"
+			  "r=%s#" BUNFMT "[%s],sl=%s,sr=%s,nil_matches=%d)%s%s%s\n",
+			  BATgetId(l), BATcount(l), ATOMname(l->ttype),
+			  BATgetId(r), BATcount(r), ATOMname(r->ttype),
+			  sl ? BATgetId(sl) : "NULL",
+			  sr ? BATgetId(sr) : "NULL",
+			  nil_matches,
+			  swapped ? " swapped" : "",
+			  *reason ? " " : "", reason);
+
+	assert(ATOMtype(l->ttype) == ATOMtype(r->ttype));
+	assert(sl == NULL || BATtdense(sl));
+	assert(sr == NULL || BATtdense(sr));
+
+	CANDINIT(l, sl, lstart, lend, lcnt, lcand, lcandend);
+	CANDINIT(r, sr, rstart, rend, rcnt, rcand, rcandend);
+	assert(lcand == NULL && rcand == NULL);
+
+	r1->tkey = r->tkey != 0;
+	r2->tkey = l->tkey != 0;
+	r1->tsorted = r1->trevsorted = r1->tdense = 0;
+	r2->tsorted = r2->trevsorted = r2->tdense = 0;
+
+	if (lstart == lend || rstart == rend)
+		return nomatch(r1, r2, l, r, lstart, lend, lcand, lcandend,
+			       0, 0, "radixjoin", t0);
+
+	size = (rend - rstart) * (r->twidth + sizeof(oid) + 2 * sizeof(BUN));
+	for (nbits = 1; nbits < RADIX_MAX_BITS && (size >> nbits) > RADIX_CACHE_SIZE; nbits++)
+		;
+	nparts = (BUN) 1 << nbits;
+
+	if (radixcluster(tpe, Tloc(l, lstart), l->hseqbase + lstart,
+			 lend - lstart, nil_matches, nbits, &lbounds,
+			 &lvals, &loids, &lvals2, &loids2) != GDK_SUCCEED ||
+	    radixcluster(tpe, Tloc(r, rstart), r->hseqbase + rstart,
+			 rend - rstart, nil_matches, nbits, &rbounds,
+			 &rvals, &roids, &rvals2, &roids2) != GDK_SUCCEED)
+		goto bailout;
+	GDKfree(lvals2);
+	GDKfree(loids2);
+	GDKfree(rvals2);
+	GDKfree(roids2);
+	lvals2 = rvals2 = NULL;
+	loids2 = roids2 = NULL;
+
+	/* divide the partitions over the threads such that each gets
+	 * about the same amount of data to process */
+	tot = lbounds[nparts] + rbounds[nparts];
+	nthreads = GDKmorsels(tot);
+	if ((BUN) nthreads > nparts)
+		nthreads = (int) nparts;
+	parts = GDKzalloc(nthreads * sizeof(struct radixjoin_part));
+	args = GDKmalloc(nthreads * sizeof(void *));
+	if (parts == NULL || args == NULL)
+		goto bailout;
+	for (i = 0, p = 0; i < nthreads; i++) {
+		struct radixjoin_part *rp = &parts[i];
+
+		rp->tpe = tpe;
+		rp->nbits = nbits;
+		rp->lvals = lvals;
+		rp->rvals = rvals;
+		rp->loids = loids;
+		rp->roids = roids;
+		rp->lbounds = lbounds;
+		rp->rbounds = rbounds;
+		rp->pfirst = p;
+		cnt = 0;
+		while (p < nparts &&
+		       (i == nthreads - 1 ||
+			(nparts - p > (BUN) (nthreads - i) &&
+			 cnt < tot / nthreads))) {
+			cnt += lbounds[p + 1] - lbounds[p] +
+				rbounds[p + 1] - rbounds[p];
+			if (rbounds[p + 1] - rbounds[p] > rp->maxinner)
+				rp->maxinner = rbounds[p + 1] - rbounds[p];
+			p++;
+		}
+		rp->plast = p;
+		if (rp->maxinner == 0)
+			rp->maxinner = 1;
+		args[i] = rp;
+	}
+	GDKparallel(radixprobe, args, nthreads);
+
+	cnt = 0;
+	for (i = 0; i < nthreads; i++) {
+		if (parts[i].failed)
+			goto bailout;
+		cnt += parts[i].cnt;
+	}
+	if (BATcapacity(r1) < cnt &&
+	    (BATextend(r1, cnt) != GDK_SUCCEED ||
+	     BATextend(r2, cnt) != GDK_SUCCEED))
+		goto bailout;
+	dst1 = (oid *) Tloc(r1, 0);
+	dst2 = (oid *) Tloc(r2, 0);
+	for (i = 0; i < nthreads; i++) {
+		memcpy(dst1, parts[i].r1, parts[i].cnt * sizeof(oid));
+		memcpy(dst2, parts[i].r2, parts[i].cnt * sizeof(oid));
+		dst1 += parts[i].cnt;
+		dst2 += parts[i].cnt;
+		GDKfree(parts[i].r1);
+		GDKfree(parts[i].r2);
+	}
+	GDKfree(parts);
+	GDKfree(args);
+	GDKfree(lbounds);
+	GDKfree(rbounds);
+	GDKfree(lvals);
+	GDKfree(rvals);
+	GDKfree(loids);
+	GDKfree(roids);
+
+	BATsetcount(r1, cnt);
+	BATsetcount(r2, cnt);
+	if (cnt <= 1) {
+		r1->tsorted = r1->trevsorted = r1->tkey = r1->tdense = 1;
+		r2->tsorted = r2->trevsorted = r2->tkey = r2->tdense = 1;
+		if (cnt == 1) {
+			r1->tseqbase = *(oid *) Tloc(r1, 0);
+			r2->tseqbase = *(oid *) Tloc(r2, 0);
+		}
+	}
+	ALGODEBUG fprintf(stderr, "#radixjoin(l=%s,r=%s)=(%s#"BUNFMT",%s#"BUNFMT") %d bits, %d threads " LLFMT "us\n",
+			  BATgetId(l), BATgetId(r),
+			  BATgetId(r1), BATcount(r1),
+			  BATgetId(r2), BATcount(r2),
+			  nbits, nthreads, GDKusec() - t0);
+	return GDK_SUCCEED;
+
+  bailout:
+	if (parts) {
+		for (i = 0; i < nthreads; i++) {
+			GDKfree(parts[i].r1);
+			GDKfree(parts[i].r2);
+		}
+	}
+	GDKfree(parts);
+	GDKfree(args);
+	GDKfree(lbounds);
+	GDKfree(rbounds);
+	GDKfree(lvals);
+	GDKfree(rvals);
+	GDKfree(loids);
+	GDKfree(roids);
+	GDKfree(lvals2);
+	GDKfree(rvals2);
+	GDKfree(loids2);
+	GDKfree(roids2);
 	BBPreclaim(r1);
 	BBPreclaim(r2);
 	return GDK_FAIL;
@@ -3677,6 +4200,308 @@ BATdiff(BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches, BUN estimate)
 	return NULL;
 }
 
+/* Runtime join filter.  Before joining a large l with a much smaller
+ * r, summarize the values of r and return a candidate list with the
+ * oids of the values in l that may occur in r.  Integer values whose
+ * range is small enough are summarized exactly by a bitmap indexed by
+ * value - min, other values by a Bloom filter with JOINFILTER_BITS
+ * bits per value and two probes.  The result is a superset of the
+ * left side of the join, so it can be given to BATjoin or BATsemijoin
+ * as left candidate list, where it saves the (random access) probes
+ * of the rows it eliminates.
+ *
+ * The filter on r is built by BATjoinfilterbuild and applied to l by
+ * BATjoinfilterprobe, so that a plan that joins the parts of l with
+ * the same r builds it only once.  It is kept in a lng BAT: a header
+ * of JF_HEADER values followed by the bitmap.  Whether the filter pays
+ * off is decided when building it, from the size lcnt of all of l.
+ *
+ * If the filter is not expected to pay off, or turns out not to
+ * eliminate at least half of l, the result is equivalent to sl (or to
+ * all of l if there is no sl). */
+
+#define JOINFILTER_MINSIZE	((BUN) 1 << 16)	/* don't filter smaller l */
+#define JOINFILTER_RATIO	8	/* r must be this much smaller than l */
+#define JOINFILTER_BITS		16	/* Bloom filter bits per value in r */
+#define JOINFILTER_MAXLG	30	/* log2 of the largest Bloom filter */
+
+#define JF_TYPE		0	/* base type of r, TYPE_void if no filter */
+#define JF_RCNT		1	/* number of values in r */
+#define JF_FLAGS	2	/* JF_EXACT | JF_HASNIL | ... */
+#define JF_MIN		3	/* smallest value in r */
+#define JF_MAX		4	/* largest value in r */
+#define JF_LG		5	/* log2 of the size of the Bloom filter */
+#define JF_HEADER	6
+
+#define JF_EXACT	1	/* bitmap indexed by value - min */
+#define JF_HASNIL	2	/* r contains nil */
+#define JF_HASVAL	4	/* r contains a value other than nil */
+#define JF_SORTED	8	/* r is sorted either way */
+
+#define jfmix(X)	((ulng) (X) * (ulng) LL_CONSTANT(0x9E3779B97F4A7C15))
+#define jfset(P)	(bits[(P) >> 6] |= (ulng) 1 << ((P) & 63))
+#define jftst(P)	((bits[(P) >> 6] >> ((P) & 63)) & 1)
+#define jfpos1(H)	((BUN) ((H) >> (64 - lg)))
+#define jfpos2(H)	((BUN) ((H) >> (64 - 2 * lg)) & mask)
+#define RPOS(i)		(rcand ? rcand[i] - r->hseqbase : rstart + (i))
+#define LOID(i)		(lcand ? lcand[i] : l->hseqbase + lstart + (i))
+
+/* add an oid to the result, or give up if the filter doesn't pay */
+#define jfappend(o)				\
+	do {					\
+		if (cnt == limit)		\
+			goto unfiltered;	\
+		dst[cnt++] = (o);		\
+	} while (0)
+
+#define JOINFILTER_BUILD(TYPE, UTYPE)					\
+	do {								\
+		const TYPE *rv = (const TYPE *) Tloc(r, 0);		\
+		TYPE mn = 0, mx = 0, v;					\
+		ulng range, h;						\
+									\
+		for (i = 0; i < rcnt; i++) {				\
+			v = rv[RPOS(i)];				\
+			if (v == TYPE##_nil) {				\
+				flags |= JF_HASNIL;			\
+			} else if (!(flags & JF_HASVAL)) {		\
+				mn = mx = v;				\
+				flags |= JF_HASVAL;			\
+			} else if (v < mn) {				\
+				mn = v;					\
+			} else if (v > mx) {				\
+				mx = v;					\
+			}						\
+		}							\
+		/* narrow types promote to int when subtracting, so	\
+		 * the differences are cast back to UTYPE */		\
+		range = (ulng) (UTYPE) ((UTYPE) mx - (UTYPE) mn);	\
+		if (range < (ulng) rcnt * 64 && range < ((ulng) 1 << 32)) { \
+			flags |= JF_EXACT;				\
+			nbits = (BUN) range + 1;			\
+		} else {						\
+			nbits = (BUN) 1 << lg;				\
+		}							\
+		if ((bn = COLnew(0, TYPE_lng, JF_HEADER + (nbits + 63) / 64, TRANSIENT)) == NULL) \
+			return NULL;					\
+		hdr = (lng *) Tloc(bn, 0);				\
+		hdr[JF_MIN] = (lng) mn;					\
+		hdr[JF_MAX] = (lng) mx;					\
+		bits = (ulng *) (hdr + JF_HEADER);			\
+		memset(bits, 0, (nbits + 63) / 64 * sizeof(ulng));	\
+		for (i = 0; i < rcnt; i++) {				\
+			v = rv[RPOS(i)];				\
+			if (v == TYPE##_nil) {				\
+				continue;				\
+			} else if (flags & JF_EXACT) {			\
+				p = (BUN) (UTYPE) ((UTYPE) v - (UTYPE) mn); \
+				jfset(p);				\
+			} else {					\
+				h = jfmix((UTYPE) v);			\
+				p = jfpos1(h);				\
+				jfset(p);				\
+				p = jfpos2(h);				\
+				jfset(p);				\
+			}						\
+		}							\
+	} while (0)
+
+BAT *
+BATjoinfilterbuild(BAT *r, BAT *sr, BUN lcnt)
+{
+	BUN rstart, rend, rcnt;
+	const oid *rcand = NULL, *rcandend = NULL;
+	BAT *bn = NULL;
+	ulng *bits;
+	lng *hdr;
+	BUN i, p, nbits = 0, mask;
+	int lg, tpe = ATOMbasetype(r->ttype), flags = 0;
+
+	if (sr && ATOMtype(sr->ttype) != TYPE_oid) {
+		GDKerror("BATjoinfilterbuild: candidate list must have OID tail.\n");
+		return NULL;
+	}
+	CANDINIT(r, sr, rstart, rend, rcnt, rcand, rcandend);
+	rcnt = rcand ? (BUN) (rcandend - rcand) : rend - rstart;
+
+	for (lg = 6; lg < JOINFILTER_MAXLG && ((BUN) 1 << lg) < rcnt * JOINFILTER_BITS; lg++)
+		;
+	mask = ((BUN) 1 << lg) - 1;
+	if (lcnt < JOINFILTER_MINSIZE ||
+	    rcnt > lcnt / JOINFILTER_RATIO ||
+	    ((BUN) 1 << lg) < rcnt * JOINFILTER_BITS ||
+	    BATtvoid(r))
+		tpe = TYPE_void;
+	switch (tpe) {
+	case TYPE_bte:
+		JOINFILTER_BUILD(bte, unsigned char);
+		break;
+	case TYPE_sht:
+		JOINFILTER_BUILD(sht, unsigned short);
+		break;
+	case TYPE_int:
+		JOINFILTER_BUILD(int, unsigned int);
+		break;
+	case TYPE_lng:
+		JOINFILTER_BUILD(lng, ulng);
+		break;
+	default:
+		/* floating point and wider types are left alone */
+		tpe = TYPE_void;
+		if ((bn = COLnew(0, TYPE_lng, JF_HEADER, TRANSIENT)) == NULL)
+			return NULL;
+		hdr = (lng *) Tloc(bn, 0);
+		hdr[JF_MIN] = hdr[JF_MAX] = 0;
+		break;
+	}
+	if (r->tsorted || r->trevsorted)
+		flags |= JF_SORTED;
+	hdr[JF_TYPE] = tpe;
+	hdr[JF_RCNT] = (lng) rcnt;
+	hdr[JF_FLAGS] = flags;
+	hdr[JF_LG] = lg;
+	BATsetcount(bn, JF_HEADER + (nbits + 63) / 64);
+	bn->tsorted = bn->trevsorted = 0;
+	bn->tkey = 0;
+	bn->tnil = 0;
+	bn->tnonil = 0;
+	return bn;
+}
+
+#define JOINFILTER_PROBE(TYPE, UTYPE)					\
+	do {								\
+		const TYPE *lv = (const TYPE *) Tloc(l, 0);		\
+		const TYPE mn = (TYPE) hdr[JF_MIN];			\
+		const TYPE mx = (TYPE) hdr[JF_MAX];			\
+		TYPE v;							\
+		ulng h;							\
+									\
+		for (i = 0; i < lcnt; i++) {				\
+			o = LOID(i);					\
+			v = lv[o - l->hseqbase];			\
+			if (v == TYPE##_nil) {				\
+				if (nil_matches && (flags & JF_HASNIL)) \
+					jfappend(o);			\
+				continue;				\
+			}						\
+			if (!(flags & JF_HASVAL) || v < mn || v > mx)	\
+				continue;				\
+			if (flags & JF_EXACT) {				\
+				p = (BUN) (UTYPE) ((UTYPE) v - (UTYPE) mn); \
+				if (!jftst(p))				\
+					continue;			\
+			} else {					\
+				h = jfmix((UTYPE) v);			\
+				p = jfpos1(h);				\
+				if (!jftst(p))				\
+					continue;			\
+				p = jfpos2(h);				\
+				if (!jftst(p))				\
+					continue;			\
+			}						\
+			jfappend(o);					\
+		}							\
+	} while (0)
+
+BAT *
+BATjoinfilterprobe(BAT *l, BAT *sl, BAT *f, int nil_matches)
+{
+	BUN lstart, lend, lcnt, rcnt;
+	const oid *lcand = NULL, *lcandend = NULL;
+	BAT *bn = NULL;
+	const lng *hdr;
+	const ulng *bits;
+	BUN i, p, mask, cnt = 0, limit;
+	oid o, *dst;
+	int lg, flags;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+
+	if (ATOMtype(f->ttype) != TYPE_lng || BATcount(f) < JF_HEADER) {
+		GDKerror("BATjoinfilterprobe: f is not a join filter.\n");
+		return NULL;
+	}
+	hdr = (const lng *) Tloc(f, 0);
+	if (hdr[JF_TYPE] != TYPE_void && hdr[JF_TYPE] != ATOMbasetype(l->ttype)) {
+		GDKerror("BATjoinfilterprobe: type mismatch.\n");
+		return NULL;
+	}
+	if (sl && ATOMtype(sl->ttype) != TYPE_oid) {
+		GDKerror("BATjoinfilterprobe: candidate list must have OID tail.\n");
+		return NULL;
+	}
+	CANDINIT(l, sl, lstart, lend, lcnt, lcand, lcandend);
+	lcnt = lcand ? (BUN) (lcandend - lcand) : lend - lstart;
+	rcnt = (BUN) hdr[JF_RCNT];
+	flags = (int) hdr[JF_FLAGS];
+	lg = (int) hdr[JF_LG];
+	mask = ((BUN) 1 << lg) - 1;
+	bits = (const ulng *) (hdr + JF_HEADER);
+
+	if (hdr[JF_TYPE] == TYPE_void ||
+	    BATtvoid(l) ||
+	    ((l->tsorted || l->trevsorted) && (flags & JF_SORTED)))
+		goto unfiltered;
+
+	limit = lcnt / 2;
+	if ((bn = COLnew(0, TYPE_oid, limit, TRANSIENT)) == NULL)
+		return NULL;
+	dst = (oid *) Tloc(bn, 0);
+	switch (ATOMbasetype(l->ttype)) {
+	case TYPE_bte:
+		JOINFILTER_PROBE(bte, unsigned char);
+		break;
+	case TYPE_sht:
+		JOINFILTER_PROBE(sht, unsigned short);
+		break;
+	case TYPE_int:
+		JOINFILTER_PROBE(int, unsigned int);
+		break;
+	case TYPE_lng:
+		JOINFILTER_PROBE(lng, ulng);
+		break;
+	default:
+		goto unfiltered;
+	}
+	BATsetcount(bn, cnt);
+	bn->tsorted = 1;
+	bn->trevsorted = cnt <= 1;
+	bn->tkey = 1;
+	bn->tnil = 0;
+	bn->tnonil = 1;
+	bn = virtualize(bn);
+	ALGODEBUG fprintf(stderr, "#BATjoinfilterprobe(l=%s#" BUNFMT ",f=%s#" BUNFMT
+			  ",%s)=%s#" BUNFMT " " LLFMT "us\n",
+			  BATgetId(l), lcnt, BATgetId(f), rcnt,
+			  flags & JF_EXACT ? "exact" : "bloom",
+			  BATgetId(bn), BATcount(bn), GDKusec() - t0);
+	return bn;
+
+  unfiltered:
+	BBPreclaim(bn);
+	ALGODEBUG fprintf(stderr, "#BATjoinfilterprobe(l=%s#" BUNFMT ",f=%s#" BUNFMT
+			  "): not filtered\n",
+			  BATgetId(l), lcnt, BATgetId(f), rcnt);
+	if (sl)
+		return VIEWcreate(sl->hseqbase, sl);
+	return BATdense(l->hseqbase, l->hseqbase, BATcount(l));
+}
+
+BAT *
+BATjoinfilter(BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches)
+{
+	BAT *f, *bn;
+
+	if (joinparamcheck(l, r, NULL, sl, sr, "BATjoinfilter") != GDK_SUCCEED)
+		return NULL;
+	if ((f = BATjoinfilterbuild(r, sr, sl ? BATcount(sl) : BATcount(l))) == NULL)
+		return NULL;
+	bn = BATjoinfilterprobe(l, sl, f, nil_matches);
+	BBPreclaim(f);
+	return bn;
+}
+
 gdk_return
 BATthetajoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int op, int nil_matches, BUN estimate)
 {
@@ -3736,6 +4561,7 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	bat lparent, rparent;
 #endif
 	int swap;
+	int radix = 0;		/* hash table on inner side won't be reused */
 	size_t mem_size;
 	lng t0 = 0;
 	const char *reason = "";
@@ -3871,11 +4697,20 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	} else if (lpcount < rpcount) {
 		/* no hashes, not sorted, create hash on smallest BAT */
 		swap = 1;
+		radix = 1;
 		reason = "left is smaller";
+	} else {
+		radix = 1;
 	}
 	if (swap) {
+		/* only partition if the hash table would not be
+		 * reused and would not fit in the cache */
+		if (radix && radixjoinable(r, l, sr, sl, lcount))
+			return radixjoin(r2, r1, r, l, sr, sl, nil_matches, t0, 1, reason);
 		return hashjoin(r2, r1, r, l, sr, sl, nil_matches, 0, 0, 0, maxsize, t0, 1, reason);
 	} else {
+		if (radix && radixjoinable(l, r, sl, sr, rcount))
+			return radixjoin(r1, r2, l, r, sl, sr, nil_matches, t0, 0, reason);
 		return hashjoin(r1, r2, l, r, sl, sr, nil_matches, 0, 0, 0, maxsize, t0, 0, reason);
 	}
 }
@@ -19,41 +19,154 @@ struct idxsync {
 	const char *func;
 };
 
+/* The index is written from a copy, so that the hash lock, which is
+ * taken for every use of the index, is not held during the disk I/O.
+ * The copy is written next to the index file, and it only replaces
+ * that file if, by then, b's index still has the same contents: in
+ * the meantime the index may have been extended, or destroyed (which
+ * unlinks its file) and possibly built again. */
 static void
 BATidxsync(void *arg)
 {
 	struct idxsync *hs = arg;
 	Heap *hp = hs->hp;
-	int fd;
+	BAT *b = BBP_cache(hs->id);
+	const char *nme = BBP_physical(hs->id);
+	oid *copy = NULL;
+	size_t size = 0;
+	int farmid = 0;
+	const char *failed = " failed";
 	lng t0 = 0;
 
 	ALGODEBUG t0 = GDKusec();
 
-	if (HEAPsave(hp, hp->filename, NULL) != GDK_SUCCEED ||
-	    (fd = GDKfdlocate(hp->farmid, hp->filename, "rb+", NULL)) < 0) {
-		BBPunfix(hs->id);
-		GDKfree(arg);
-		return;
+	MT_lock_set(&GDKhashLock(hs->id));
+	if (b != NULL && b->torderidx == hp &&
+	    (copy = GDKmalloc(hp->free)) != NULL) {
+		size = hp->free;
+		farmid = hp->farmid;
+		memcpy(copy, hp->base, size);
 	}
-	((oid *) hp->base)[0] |= (oid) 1 << 24;
-	if (write(fd, hp->base, SIZEOF_SIZE_T) < 0)
-		perror("write orderidx");
-	if (!(GDKdebug & FORCEMITOMASK)) {
-#if defined(NATIVE_WIN32)
-		_commit(fd);
-#elif defined(HAVE_FDATASYNC)
-		fdatasync(fd);
-#elif defined(HAVE_FSYNC)
-		fsync(fd);
-#endif
+	MT_lock_unset(&GDKhashLock(hs->id));
+	if (copy != NULL) {
+		copy[0] |= (oid) 1 << 24;
+		if (GDKsave(farmid, nme, "torderidx.new", copy, size, STORE_MEM, TRUE) == GDK_SUCCEED) {
+			MT_lock_set(&GDKhashLock(hs->id));
+			if ((hp = b->torderidx) != NULL && hp != (Heap *) 1 &&
+			    hp->free == size &&
+			    memcmp((const oid *) hp->base + 1, copy + 1, size - SIZEOF_OID) == 0 &&
+			    GDKmove(farmid, BATDIR, nme, "torderidx.new", BATDIR, nme, "torderidx") == GDK_SUCCEED)
+				failed = "";
+			MT_lock_unset(&GDKhashLock(hs->id));
+		}
+		if (*failed)
+			GDKunlink(farmid, BATDIR, nme, "torderidx.new");
+		GDKfree(copy);
 	}
-	close(fd);
+	ALGODEBUG fprintf(stderr, "#%s: persisting orderidx %d (" LLFMT " usec)%s\n", hs->func, hs->id, GDKusec() - t0, failed);
 	BBPunfix(hs->id);
-	ALGODEBUG fprintf(stderr, "#%s: persisting orderidx %s (" LLFMT " usec)\n", hs->func, hp->filename, GDKusec() - t0);
 	GDKfree(arg);
 }
 #endif
 
+/* merge the two sorted runs of oids [0,i) (from the index) and
+ * [0,j) (the appended values) into the first k = i + j slots of the
+ * index, back to front so that no scratch copy of the index is needed;
+ * on equal values the appended oid goes last, which keeps a stable
+ * index stable */
+#define BACKWARD_MERGE(TYPE)						\
+	do {								\
+		const TYPE *v = (const TYPE *) Tloc(b, 0);		\
+		while (j > 0) {						\
+			if (i > 0 &&					\
+			    v[mv[i - 1] - b->hseqbase] > v[dv[j - 1] - b->hseqbase]) \
+				mv[--k] = mv[--i];			\
+			else						\
+				mv[--k] = dv[--j];			\
+		}							\
+	} while (0)
+
+/* Bring the order index of b up to date with values that were
+ * appended to b since it was built: the index heap records how many
+ * values it covers, so only the new ones need to be sorted, after
+ * which they are merged into the index.  Called with the hash lock
+ * held. */
+static gdk_return
+extendOIDX(BAT *b)
+{
+	Heap *m = b->torderidx;
+	BUN ocnt = (BUN) ((const oid *) m->base)[1];
+	BUN ncnt = BATcount(b), p;
+	size_t i, j, k;
+	int width = Tsize(b);
+	oid *restrict mv, *restrict dv;
+	void *vals;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+
+	assert(ocnt < ncnt);
+	switch (ATOMstorage(b->ttype)) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_flt:
+	case TYPE_dbl:
+		break;
+	default:
+		return GDK_FAIL;
+	}
+	/* sort the appended values with their oids */
+	vals = GDKmalloc((ncnt - ocnt) * width);
+	dv = GDKmalloc((ncnt - ocnt) * SIZEOF_OID);
+	if (vals == NULL || dv == NULL) {
+		GDKfree(vals);
+		GDKfree(dv);
+		return GDK_FAIL;
+	}
+	memcpy(vals, Tloc(b, ocnt), (ncnt - ocnt) * width);
+	for (p = ocnt; p < ncnt; p++)
+		dv[p - ocnt] = b->hseqbase + p;
+	if (GDKssort(vals, dv, NULL, ncnt - ocnt, width, SIZEOF_OID,
+		     b->ttype) != GDK_SUCCEED ||
+	    HEAPextend(m, (ncnt + ORDERIDXOFF) * SIZEOF_OID, 0) != GDK_SUCCEED) {
+		GDKfree(vals);
+		GDKfree(dv);
+		return GDK_FAIL;
+	}
+	GDKfree(vals);
+
+	mv = (oid *) m->base + ORDERIDXOFF;
+	i = ocnt;
+	j = ncnt - ocnt;
+	k = ncnt;
+	switch (ATOMstorage(b->ttype)) {
+	case TYPE_bte: BACKWARD_MERGE(bte); break;
+	case TYPE_sht: BACKWARD_MERGE(sht); break;
+	case TYPE_int: BACKWARD_MERGE(int); break;
+	case TYPE_lng: BACKWARD_MERGE(lng); break;
+#ifdef HAVE_HGE
+	case TYPE_hge: BACKWARD_MERGE(hge); break;
+#endif
+	case TYPE_flt: BACKWARD_MERGE(flt); break;
+	case TYPE_dbl: BACKWARD_MERGE(dbl); break;
+	}
+	assert(i == k);
+	GDKfree(dv);
+	/* the index on disk (if any) is now out of date */
+	((oid *) m->base)[0] = ORDERIDX_VERSION;
+	((oid *) m->base)[1] = (oid) ncnt;
+	m->free = (ncnt + ORDERIDXOFF) * SIZEOF_OID;
+	m->dirty = 1;
+	b->batDirtydesc = TRUE;
+	ALGODEBUG fprintf(stderr, "#extendOIDX(b=%s#" BUNFMT "): merged " BUNFMT " appended values (" LLFMT " usec)\n", BATgetId(b), ncnt, ncnt - ocnt, GDKusec() - t0);
+	return GDK_SUCCEED;
+}
+
 /* return TRUE if we have a orderidx on the tail, even if we need to read
  * one from disk */
 int
@@ -61,6 +174,7 @@ BATcheckorderidx(BAT *b)
 {
 	int ret;
 	lng t = 0;
+	Heap *hp;
 
 	if (b == NULL)
 		return 0;
@@ -68,7 +182,6 @@ BATcheckorderidx(BAT *b)
 	ALGODEBUG t = GDKusec();
 	MT_lock_set(&GDKhashLock(b->batCacheid));
 	if (b->torderidx == (Heap *) 1) {
-		Heap *hp;
 		const char *nme = BBP_physical(b->batCacheid);
 		int fd;
 
@@ -89,7 +202,7 @@ BATcheckorderidx(BAT *b)
 					    ((oid) 1 << 24) |
 #endif
 					    ORDERIDX_VERSION) &&
-				    hdata[1] == (oid) BATcount(b) &&
+				    hdata[1] <= (oid) BATcount(b) &&
 				    (hdata[2] == 0 || hdata[2] == 1) &&
 				    fstat(fd, &st) == 0 &&
 				    st.st_size >= (off_t) (hp->size = hp->free = (ORDERIDXOFF + hdata[1]) * SIZEOF_OID) &&
@@ -97,8 +210,7 @@ BATcheckorderidx(BAT *b)
 					close(fd);
 					b->torderidx = hp;
 					ALGODEBUG fprintf(stderr, "#BATcheckorderidx: reusing persisted orderidx %d\n", b->batCacheid);
-					MT_lock_unset(&GDKhashLock(b->batCacheid));
-					return 1;
+					goto check;
 				}
 				close(fd);
 				/* unlink unusable file */
@@ -109,6 +221,16 @@ BATcheckorderidx(BAT *b)
 		GDKfree(hp);
 		GDKclrerr();	/* we're not currently interested in errors */
 	}
+  check:
+	if ((hp = b->torderidx) != NULL &&
+	    (BUN) ((const oid *) hp->base)[1] < BATcount(b) &&
+	    extendOIDX(b) != GDK_SUCCEED) {
+		/* can't bring it up to date, so get rid of it */
+		b->torderidx = NULL;
+		HEAPdelete(hp, BBP_physical(b->batCacheid), "torderidx");
+		GDKfree(hp);
+		GDKclrerr();
+	}
 	ret = b->torderidx != NULL;
 	MT_lock_unset(&GDKhashLock(b->batCacheid));
 	ALGODEBUG if (ret) fprintf(stderr, "#BATcheckorderidx: already has orderidx %d, waited " LLFMT " usec\n", b->batCacheid, GDKusec() - t);
@@ -504,6 +626,29 @@ OIDXfree(BAT *b)
 	}
 }
 
+/* values were appended to b: if they can be merged into the order
+ * index later, the index is kept and BATcheckorderidx brings it up to
+ * date when it is next used, otherwise it is destroyed */
+void
+OIDXappend(BAT *b)
+{
+	switch (ATOMstorage(b->ttype)) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_flt:
+	case TYPE_dbl:
+		break;
+	default:
+		OIDXdestroy(b);
+		break;
+	}
+}
+
 void
 OIDXdestroy(BAT *b)
 {
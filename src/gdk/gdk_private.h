@@ -16,6 +16,9 @@
 /* #define PERSISTENTHASH 1 */
 #define PERSISTENTIDX 1
 
+/* number of values summarized by one zone map entry */
+#define ZONEMAP_BLOCK ((BUN) 1 << 14)
+
 #include "gdk_system_private.h"
 
 enum heaptype {
@@ -23,7 +26,8 @@ enum heaptype {
 	varheap,
 	hashheap,
 	imprintsheap,
-	orderidxheap
+	orderidxheap,
+	zonemapheap
 };
 
 __hidden gdk_return ATOMheap(int id, Heap *hp, size_t cap)
@@ -43,7 +47,7 @@ __hidden int BATcheckimprints(BAT *b)
 __hidden gdk_return BATcheckmodes(BAT *b, int persistent)
 	__attribute__ ((__warn_unused_result__))
 	__attribute__((__visibility__("hidden")));
-__hidden int BATcheckorderidx(BAT *b)
+__hidden int BATcheckzonemap(BAT *b)
 	__attribute__((__visibility__("hidden")));
 
 __hidden BAT *BATcreatedesc(oid hseq, int tt, int heapnames, int role)
@@ -147,6 +151,9 @@ __hidden gdk_return GDKremovedir(int farmid, const char *nme)
 __hidden gdk_return GDKsave(int farmid, const char *nme, const char *ext, void *buf, size_t size, storage_t mode, int dosync)
 	__attribute__ ((__warn_unused_result__))
 	__attribute__((__visibility__("hidden")));
+__hidden gdk_return GDKrsort(void *h, void *t, size_t n, int tpe, int reverse)
+	__attribute__ ((__warn_unused_result__))
+	__attribute__((__visibility__("hidden")));
 __hidden gdk_return GDKssort_rev(void *h, void *t, const void *base, size_t n, int hs, int ts, int tpe)
 	__attribute__ ((__warn_unused_result__))
 	__attribute__((__visibility__("hidden")));
@@ -200,6 +207,8 @@ __hidden void *MT_mremap(const char *path, int mode, void *old_address, size_t o
 	__attribute__((__visibility__("hidden")));
 __hidden int MT_msync(void *p, size_t len)
 	__attribute__((__visibility__("hidden")));
+__hidden void OIDXappend(BAT *b)
+	__attribute__((__visibility__("hidden")));
 __hidden void OIDXfree(BAT *b)
 	__attribute__((__visibility__("hidden")));
 __hidden void persistOIDX(BAT *b)
@@ -207,12 +216,25 @@ __hidden void persistOIDX(BAT *b)
 __hidden gdk_return rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li, int hi, BUN maxsize)
 	__attribute__ ((__warn_unused_result__))
 	__attribute__((__visibility__("hidden")));
+__hidden void ZMappend(BAT *b)
+	__attribute__((__visibility__("hidden")));
+__hidden void ZMfree(BAT *b)
+	__attribute__((__visibility__("hidden")));
+__hidden int ZMminmax(BAT *b, int max, void *res)
+	__attribute__((__visibility__("hidden")));
+__hidden void ZMpersist(BAT *b)
+	__attribute__((__visibility__("hidden")));
+__hidden BUN ZMprune(BAT *b, const void *tl, const void *th, BUN **ranges)
+	__attribute__ ((__warn_unused_result__))
+	__attribute__((__visibility__("hidden")));
 __hidden void strCleanHash(Heap *hp, int rebuild)
 	__attribute__((__visibility__("hidden")));
 __hidden int strCmpNoNil(const unsigned char *l, const unsigned char *r)
 	__attribute__((__visibility__("hidden")));
 __hidden var_t strLocate(Heap *h, const char *v)
 	__attribute__((__visibility__("hidden")));
+__hidden var_t strNext(const Heap *h, var_t pos)
+	__attribute__((__visibility__("hidden")));
 __hidden gdk_return unshare_string_heap(BAT *b)
 	__attribute__ ((__warn_unused_result__))
 	__attribute__((__visibility__("hidden")));
@@ -16,73 +16,84 @@
  * OIDs in the tail of the left input.
  */
 
+/* Gathering the values at scattered positions of a column that does
+ * not fit in the cache stalls on memory latency, one cache miss at a
+ * time.  When r is large and l is not sorted, the value that is
+ * needed PROJECT_PREFETCH rows later is prefetched, so that the cache
+ * misses overlap. */
+#define PROJECT_PREFETCH	16
+#define PROJECT_PREFETCH_SIZE	((size_t) 1 << 20)
+#ifdef __GNUC__
+#define project_prefetch(p)	__builtin_prefetch(p)
+#else
+#define project_prefetch(p)	((void) 0)
+#endif
+
+/* the rows [first, last) of l that are projected on a thread of their
+ * own */
+struct project_morsel {
+	BAT *bn, *l, *r;
+	BUN first, last;
+	int nilcheck;
+	int prefetch;		/* prefetch the values of r */
+	int nils;		/* out: found nil in the result */
+	int oidnils;		/* out: found nil in l */
+	gdk_return res;		/* out: GDK_FAIL if l does not match */
+};
+
+#define project_value(TYPE)						\
+	do {								\
+		if (lo < pf &&						\
+		    o[lo + PROJECT_PREFETCH] - rseq < rcnt)		\
+			project_prefetch(rt + (o[lo + PROJECT_PREFETCH] - rseq)); \
+		if (o[lo] - rseq >= rcnt) {				\
+			if (o[lo] != oid_nil) {				\
+				m->res = GDK_FAIL;			\
+				return;					\
+			}						\
+			v = TYPE##_nil;					\
+			m->oidnils = 1;					\
+		} else {						\
+			v = rt[o[lo] - rseq];				\
+		}							\
+		bt[lo] = v;						\
+	} while (0)
+
 #define project_loop(TYPE)						\
-static gdk_return							\
-project_##TYPE(BAT *bn, BAT *l, BAT *r, int nilcheck)			\
+static void								\
+project_##TYPE(void *arg)						\
 {									\
-	oid lo, hi;							\
+	struct project_morsel *m = arg;					\
+	BUN lo, hi, pf;							\
 	const TYPE *restrict rt;					\
 	TYPE *restrict bt;						\
 	TYPE v;								\
 	const oid *restrict o;						\
-	oid rseq, rend;							\
+	oid rseq;							\
+	BUN rcnt;							\
 									\
-	o = (const oid *) Tloc(l, 0);					\
-	rt = (const TYPE *) Tloc(r, 0);					\
-	bt = (TYPE *) Tloc(bn, 0);					\
-	rseq = r->hseqbase;						\
-	rend = rseq + BATcount(r);					\
-	lo = 0;								\
-	hi = lo + BATcount(l);						\
-	if (nilcheck) {							\
+	o = (const oid *) Tloc(m->l, 0);				\
+	rt = (const TYPE *) Tloc(m->r, 0);				\
+	bt = (TYPE *) Tloc(m->bn, 0);					\
+	rseq = m->r->hseqbase;						\
+	rcnt = BATcount(m->r);						\
+	lo = m->first;							\
+	hi = m->last;							\
+	/* prefetch while lo < pf */					\
+	pf = m->prefetch && hi - lo > PROJECT_PREFETCH ?		\
+		hi - PROJECT_PREFETCH : lo;				\
+	if (m->nilcheck) {						\
 		for (; lo < hi; lo++) {					\
-			if (o[lo] < rseq || o[lo] >= rend) {		\
-				if (o[lo] == oid_nil) {			\
-					bt[lo] = TYPE##_nil;		\
-					bn->tnonil = 0;			\
-					bn->tnil = 1;			\
-					bn->tsorted = 0;		\
-					bn->trevsorted = 0;		\
-					bn->tkey = 0;			\
-					lo++;				\
-					break;				\
-				} else {				\
-					GDKerror("BATproject: does not match always\n"); \
-					return GDK_FAIL;		\
-				}					\
-			} else {					\
-				v = rt[o[lo] - rseq];			\
-				bt[lo] = v;				\
-				if (v == TYPE##_nil && bn->tnonil) {	\
-					bn->tnonil = 0;			\
-					bn->tnil = 1;			\
-					lo++;				\
-					break;				\
-				}					\
+			project_value(TYPE);				\
+			if (v == TYPE##_nil) {				\
+				m->nils = 1;				\
+				lo++;					\
+				break;					\
 			}						\
 		}							\
 	}								\
-	for (; lo < hi; lo++) {						\
-		if (o[lo] < rseq || o[lo] >= rend) {			\
-			if (o[lo] == oid_nil) {				\
-				bt[lo] = TYPE##_nil;			\
-				bn->tnonil = 0;				\
-				bn->tnil = 1;				\
-				bn->tsorted = 0;			\
-				bn->trevsorted = 0;			\
-				bn->tkey = 0;				\
-			} else {					\
-				GDKerror("BATproject: does not match always\n"); \
-				return GDK_FAIL;			\
-			}						\
-		} else {						\
-			v = rt[o[lo] - rseq];				\
-			bt[lo] = v;					\
-		}							\
-	}								\
-	assert((BUN) lo == BATcount(l));				\
-	BATsetcount(bn, (BUN) lo);					\
-	return GDK_SUCCEED;						\
+	for (; lo < hi; lo++)						\
+		project_value(TYPE);					\
 }
 
 
@@ -97,6 +108,75 @@ project_loop(lng)
 project_loop(hge)
 #endif
 
+/* Project l on r using fcn, one of the project_TYPE functions above.
+ * Large projections are split into morsels that are projected in
+ * parallel. */
+static gdk_return
+project_fix(BAT *bn, BAT *l, BAT *r, int nilcheck, void (*fcn)(void *))
+{
+	struct project_morsel one, *morsels = &one;
+	void *onearg, **args = &onearg;
+	BUN cnt = BATcount(l);
+	gdk_return res = GDK_SUCCEED;
+	int i, nmorsels = GDKmorsels(cnt);
+
+	if (nmorsels > 1) {
+		morsels = GDKmalloc(nmorsels * sizeof(struct project_morsel));
+		args = GDKmalloc(nmorsels * sizeof(void *));
+		if (morsels == NULL || args == NULL) {
+			GDKfree(morsels);
+			GDKfree(args);
+			return GDK_FAIL;
+		}
+	}
+	for (i = 0; i < nmorsels; i++) {
+		struct project_morsel *m = &morsels[i];
+
+		m->bn = bn;
+		m->l = l;
+		m->r = r;
+		m->first = cnt / nmorsels * i;
+		m->last = i == nmorsels - 1 ? cnt : cnt / nmorsels * (i + 1);
+		m->nilcheck = nilcheck;
+		m->prefetch = !l->tsorted && !l->trevsorted &&
+			((size_t) BATcount(r) << r->tshift) > PROJECT_PREFETCH_SIZE;
+		m->nils = 0;
+		m->oidnils = 0;
+		m->res = GDK_SUCCEED;
+		args[i] = m;
+	}
+	if (nmorsels > 1) {
+		ALGODEBUG fprintf(stderr, "#BATproject(l=%s,r=%s): %d morsels\n",
+				  BATgetId(l), BATgetId(r), nmorsels);
+		GDKparallel(fcn, args, nmorsels);
+	} else {
+		(*fcn)(&one);
+	}
+	for (i = 0; i < nmorsels; i++) {
+		if (morsels[i].res != GDK_SUCCEED)
+			res = GDK_FAIL;
+		if (morsels[i].nils || morsels[i].oidnils) {
+			bn->tnonil = 0;
+			bn->tnil = 1;
+		}
+		if (morsels[i].oidnils) {
+			bn->tsorted = 0;
+			bn->trevsorted = 0;
+			bn->tkey = 0;
+		}
+	}
+	if (nmorsels > 1) {
+		GDKfree(morsels);
+		GDKfree(args);
+	}
+	if (res != GDK_SUCCEED) {
+		GDKerror("BATproject: does not match always\n");
+		return GDK_FAIL;
+	}
+	BATsetcount(bn, cnt);
+	return GDK_SUCCEED;
+}
+
 static gdk_return
 project_void(BAT *bn, BAT *l, BAT *r)
 {
@@ -302,26 +382,26 @@ BATproject(BAT *l, BAT *r)
 
 	switch (tpe) {
 	case TYPE_bte:
-		res = project_bte(bn, l, r, nilcheck);
+		res = project_fix(bn, l, r, nilcheck, project_bte);
 		break;
 	case TYPE_sht:
-		res = project_sht(bn, l, r, nilcheck);
+		res = project_fix(bn, l, r, nilcheck, project_sht);
 		break;
 	case TYPE_int:
-		res = project_int(bn, l, r, nilcheck);
+		res = project_fix(bn, l, r, nilcheck, project_int);
 		break;
 	case TYPE_flt:
-		res = project_flt(bn, l, r, nilcheck);
+		res = project_fix(bn, l, r, nilcheck, project_flt);
 		break;
 	case TYPE_dbl:
-		res = project_dbl(bn, l, r, nilcheck);
+		res = project_fix(bn, l, r, nilcheck, project_dbl);
 		break;
 	case TYPE_lng:
-		res = project_lng(bn, l, r, nilcheck);
+		res = project_fix(bn, l, r, nilcheck, project_lng);
 		break;
 #ifdef HAVE_HGE
 	case TYPE_hge:
-		res = project_hge(bn, l, r, nilcheck);
+		res = project_fix(bn, l, r, nilcheck, project_hge);
 		break;
 #endif
 	case TYPE_oid:
@@ -329,9 +409,9 @@ BATproject(BAT *l, BAT *r)
 			res = project_void(bn, l, r);
 		} else {
 #if SIZEOF_OID == SIZEOF_INT
-			res = project_int(bn, l, r, nilcheck);
+			res = project_fix(bn, l, r, nilcheck, project_int);
 #else
-			res = project_lng(bn, l, r, nilcheck);
+			res = project_fix(bn, l, r, nilcheck, project_lng);
 #endif
 		}
 		break;
@@ -402,6 +482,206 @@ BATproject(BAT *l, BAT *r)
 	return NULL;
 }
 
+/* figure out the "other" type, i.e. not compatible with oid */
+#if SIZEOF_OID == SIZEOF_INT
+#define OTPE	lng
+#define TOTPE	TYPE_lng
+#else
+#define OTPE	int
+#define TOTPE	TYPE_int
+#endif
+
+/* an element of the chain of BATprojectchain (see there) */
+struct projectchain_bat {
+	const oid *vals; /* if not dense, start of relevant tail values */
+	BAT *b;		/* the BAT */
+	oid hlo;	/* lowest allowed oid to index the BAT */
+	BUN cnt;	/* size of allowed index range */
+};
+
+/* Following a row through the chain, each lookup has to wait for the
+ * previous one, so the cache misses of a row are taken one after the
+ * other.  Instead, rows are followed through the chain a block of
+ * PROJECT_BLOCK rows at a time, and one BAT at a time, so that the
+ * lookups in a BAT are independent of each other (and prefetched).
+ *
+ * Set o[j] to the value that row p + j refers to in the tail of
+ * ba[n - 1], or to oid_nil.  Set *nils if a nil was encountered. */
+#define PROJECT_BLOCK	256
+
+static gdk_return
+projectchain_block(const struct projectchain_bat *ba, int n, BUN p, BUN cnt,
+		   oid *restrict o, int *nils)
+{
+	const oid *restrict vals;
+	oid hlo;
+	BUN j, hcnt, pf;
+	int i;
+
+	memcpy(o, ba[0].vals + p, cnt * sizeof(oid));
+	pf = cnt > PROJECT_PREFETCH ? cnt - PROJECT_PREFETCH : 0;
+	for (i = 1; i < n; i++) {
+		vals = ba[i].vals;
+		hlo = ba[i].hlo;
+		hcnt = ba[i].cnt;
+		for (j = 0; j < cnt; j++) {
+			if (j < pf && o[j + PROJECT_PREFETCH] - hlo < hcnt)
+				project_prefetch(vals + (o[j + PROJECT_PREFETCH] - hlo));
+			if (o[j] - hlo >= hcnt) {
+				if (o[j] != oid_nil)
+					return GDK_FAIL;
+				*nils = 1;
+			} else {
+				o[j] = vals[o[j] - hlo];
+			}
+		}
+	}
+	return GDK_SUCCEED;
+}
+
+/* the rows [first, last) of the result of BATprojectchain that are
+ * calculated on a thread of their own; only for fixed sized values
+ * that are written in place */
+struct projectchain_morsel {
+	const struct projectchain_bat *ba;
+	int n;			/* ba[n] is the last BAT */
+	BAT *b, *bn;		/* the last BAT and the result */
+	BUN off;		/* BUN offset into the last BAT */
+	oid tseq;		/* lowest value of the last BAT if dense */
+	const void *nil;	/* nil representation for last BAT */
+	int stringtrick;
+	BUN first, last;
+	int nils;		/* out: found nil */
+	gdk_return res;		/* out: GDK_FAIL if the chain does not match */
+};
+
+/* oids all the way (or the final tail type is a fixed sized atom the
+ * same size as oid) */
+static void
+projectchain_oid(void *arg)
+{
+	struct projectchain_morsel *m = arg;
+	const struct projectchain_bat *last = &m->ba[m->n];
+	oid *restrict v = (oid *) Tloc(m->bn, 0);
+	oid o[PROJECT_BLOCK];
+	lng offset = (lng) m->tseq - (lng) last->hlo;
+	BUN p, j, cnt;
+
+	for (p = m->first; p < m->last; p += cnt) {
+		cnt = MIN(m->last - p, PROJECT_BLOCK);
+		if (last->vals == NULL) {
+			/* last BAT is dense-tailed */
+			if (projectchain_block(m->ba, m->n, p, cnt, o,
+					       &m->nils) != GDK_SUCCEED)
+				goto bailout;
+			for (j = 0; j < cnt; j++) {
+				if (o[j] == oid_nil) {
+					v[p + j] = *(const oid *) m->nil;
+				} else {
+					if (o[j] - last->hlo >= last->cnt)
+						goto bailout;
+					v[p + j] = (oid) (o[j] + offset);
+				}
+			}
+		} else {
+			/* last BAT is materialized: follow the chain
+			 * up to and including it */
+			if (projectchain_block(m->ba, m->n + 1, p, cnt, o,
+					       &m->nils) != GDK_SUCCEED)
+				goto bailout;
+			for (j = 0; j < cnt; j++)
+				v[p + j] = (o[j] == oid_nil) & !m->stringtrick ? *(const oid *) m->nil : o[j];
+		}
+	}
+	return;
+
+  bailout:
+	m->res = GDK_FAIL;
+}
+
+/* one special case for a fixed sized BAT */
+static void
+projectchain_otpe(void *arg)
+{
+	struct projectchain_morsel *m = arg;
+	const struct projectchain_bat *last = &m->ba[m->n];
+	const OTPE *src = (const OTPE *) Tloc(m->b, m->off);
+	OTPE *restrict dst = (OTPE *) Tloc(m->bn, 0);
+	oid o[PROJECT_BLOCK];
+	BUN p, j, cnt;
+
+	for (p = m->first; p < m->last; p += cnt) {
+		cnt = MIN(m->last - p, PROJECT_BLOCK);
+		if (projectchain_block(m->ba, m->n, p, cnt, o,
+				       &m->nils) != GDK_SUCCEED)
+			goto bailout;
+		for (j = 0; j < cnt; j++) {
+			if (o[j] == oid_nil) {
+				dst[p + j] = * (const OTPE *) m->nil;
+			} else {
+				if (o[j] - last->hlo >= last->cnt)
+					goto bailout;
+				dst[p + j] = src[o[j] - last->hlo];
+			}
+		}
+	}
+	return;
+
+  bailout:
+	m->res = GDK_FAIL;
+}
+
+/* Run fcn, one of the projectchain functions above, for all cnt rows
+ * of the result described by tmpl.  Large results are split into
+ * morsels that are calculated in parallel. */
+static gdk_return
+projectchain_fix(const struct projectchain_morsel *tmpl, BUN cnt,
+		 void (*fcn)(void *))
+{
+	struct projectchain_morsel one, *morsels = &one;
+	void *onearg, **args = &onearg;
+	gdk_return res = GDK_SUCCEED;
+	int i, nmorsels = GDKmorsels(cnt);
+
+	if (nmorsels > 1) {
+		morsels = GDKmalloc(nmorsels * sizeof(struct projectchain_morsel));
+		args = GDKmalloc(nmorsels * sizeof(void *));
+		if (morsels == NULL || args == NULL) {
+			GDKfree(morsels);
+			GDKfree(args);
+			return GDK_FAIL;
+		}
+	}
+	for (i = 0; i < nmorsels; i++) {
+		morsels[i] = *tmpl;
+		morsels[i].first = cnt / nmorsels * i;
+		morsels[i].last = i == nmorsels - 1 ? cnt : cnt / nmorsels * (i + 1);
+		morsels[i].nils = 0;
+		morsels[i].res = GDK_SUCCEED;
+		args[i] = &morsels[i];
+	}
+	if (nmorsels > 1) {
+		ALGODEBUG fprintf(stderr, "#BATprojectchain: %d morsels\n",
+				  nmorsels);
+		GDKparallel(fcn, args, nmorsels);
+	} else {
+		(*fcn)(&one);
+	}
+	for (i = 0; i < nmorsels; i++) {
+		if (morsels[i].res != GDK_SUCCEED)
+			res = GDK_FAIL;
+		if (morsels[i].nils)
+			tmpl->bn->tnil = 1;
+	}
+	if (nmorsels > 1) {
+		GDKfree(morsels);
+		GDKfree(args);
+	}
+	if (res != GDK_SUCCEED)
+		GDKerror("BATprojectchain: does not match always\n");
+	return res;
+}
+
 /* Calculate a chain of BATproject calls.
  * The argument is a NULL-terminated array of BAT pointers.
  * This function is equivalent to a sequence of calls
@@ -425,12 +705,7 @@ BATprojectchain(BAT **bats)
 	 * value (corresponding with hlo).  Since dense-tailed BATs
 	 * are combined with their successors, tseq will only be used
 	 * for the last element. */
-	struct {
-		const oid *vals; /* if not dense, start of relevant tail values */
-		BAT *b;		/* the BAT */
-		oid hlo;	/* lowest allowed oid to index the BAT */
-		BUN cnt;	/* size of allowed index range */
-	} *ba;
+	struct projectchain_bat *ba;
 	int i, n, tpe;
 	BAT *b, *bn;
 	oid o;
@@ -570,165 +845,54 @@ BATprojectchain(BAT **bats)
 	bn->tnil = bn->tnonil = 0; /* we're not paying attention to this */
 	n = i - 1;		/* ba[n] is last BAT */
 
-/* figure out the "other" type, i.e. not compatible with oid */
-#if SIZEOF_OID == SIZEOF_INT
-#define OTPE	lng
-#define TOTPE	TYPE_lng
-#else
-#define OTPE	int
-#define TOTPE	TYPE_int
-#endif
-	if (ATOMstorage(bn->ttype) == ATOMstorage(TYPE_oid)) {
-		/* oids all the way (or the final tail type is a fixed
-		 * sized atom the same size as oid) */
-		oid *restrict v = (oid *) Tloc(bn, 0);
-
-		if (ba[n].vals == NULL) {
-			/* last BAT is dense-tailed */
-			lng offset = 0;
-
-			offset = (lng) tseq - (lng) ba[n].hlo;
-			ba[n].cnt += ba[n].hlo; /* upper bound of last BAT */
-			for (p = 0; p < cnt; p++) {
-				o = ba[0].vals[p];
-				for (i = 1; i < n; i++) {
-					o -= ba[i].hlo;
-					if (o >= ba[i].cnt) {
-						if (o == oid_nil - ba[i].hlo) {
-							bn->tnil = 1;
-							o = oid_nil;
-							break;
-						}
-						GDKerror("BATprojectchain: does not match always\n");
-						goto bunins_failed;
-					}
-					o = ba[i].vals[o];
-				}
-				if (o == oid_nil) {
-					*v++ = *(oid *) nil;
-				} else {
-					if (o < ba[n].hlo || o >= ba[n].cnt) {
-						GDKerror("BATprojectchain: does not match always\n");
-						goto bunins_failed;
-					}
-					*v++ = (oid) (o + offset);
-				}
+	if (ATOMstorage(bn->ttype) == ATOMstorage(TYPE_oid) ||
+	    ATOMstorage(b->ttype) == ATOMstorage(TOTPE)) {
+		struct projectchain_morsel m;
+
+		m.ba = ba;
+		m.n = n;
+		m.b = b;
+		m.bn = bn;
+		m.off = off;
+		m.tseq = tseq;
+		m.nil = nil;
+		m.stringtrick = stringtrick;
+		if (projectchain_fix(&m, cnt,
+				     ATOMstorage(bn->ttype) == ATOMstorage(TYPE_oid) ?
+				     projectchain_oid : projectchain_otpe) != GDK_SUCCEED)
+			goto bunins_failed;
+	} else {
+		/* generic code for var-sized and fixed-sized atoms */
+		BATiter bi = bat_iterator(b);
+		const void *v;
+		oid blk[PROJECT_BLOCK];
+		BUN j, bcnt;
+		int nils = 0, varsized = ATOMvarsized(tpe);
+
+		assert(!varsized || !stringtrick);
+		for (p = 0; p < cnt; p += bcnt) {
+			bcnt = MIN(cnt - p, PROJECT_BLOCK);
+			if (projectchain_block(ba, n, p, bcnt, blk,
+					       &nils) != GDK_SUCCEED) {
+				GDKerror("BATprojectchain: does not match always\n");
+				goto bunins_failed;
 			}
-		} else {
-			/* last BAT is materialized */
-			for (p = 0; p < cnt; p++) {
-				o = ba[0].vals[p];
-				for (i = 1; i <= n; i++) { /* note "<=" */
-					o -= ba[i].hlo;
-					if (o >= ba[i].cnt) {
-						if (o == oid_nil - ba[i].hlo) {
-							bn->tnil = 1;
-							o = oid_nil;
-							break;
-						}
+			for (j = 0; j < bcnt; j++) {
+				if (blk[j] == oid_nil) {
+					v = nil;
+				} else {
+					o = blk[j] - ba[n].hlo;
+					if (o >= ba[n].cnt) {
 						GDKerror("BATprojectchain: does not match always\n");
 						goto bunins_failed;
 					}
-					o = ba[i].vals[o];
-				}
-				*v++ = (o == oid_nil) & !stringtrick ? *(oid *) nil : o;
-			}
-		}
-		assert(v == (oid *) Tloc(bn, cnt));
-	} else if (ATOMstorage(b->ttype) == ATOMstorage(TOTPE)) {
-		/* one special case for a fixed sized BAT */
-		const OTPE *src = (const OTPE *) Tloc(b, off);
-		OTPE *restrict dst = (OTPE *) Tloc(bn, 0);
-
-		for (p = 0; p < cnt; p++) {
-			o = ba[0].vals[p];
-			for (i = 1; i < n; i++) {
-				o -= ba[i].hlo;
-				if (o >= ba[i].cnt) {
-					if (o == oid_nil - ba[i].hlo) {
-						bn->tnil = 1;
-						o = oid_nil;
-						break;
-					}
-					GDKerror("BATprojectchain: does not match always\n");
-					goto bunins_failed;
-				}
-				o = ba[i].vals[o];
-			}
-			if (o == oid_nil) {
-				*dst++ = * (OTPE *) nil;
-			} else {
-				o -= ba[n].hlo;
-				if (o >= ba[n].cnt) {
-					GDKerror("BATprojectchain: does not match always\n");
-					goto bunins_failed;
-				}
-				*dst++ = src[o];
-			}
-		}
-	} else if (ATOMvarsized(tpe)) {
-		/* generic code for var-sized atoms */
-		BATiter bi = bat_iterator(b);
-		const void *v = nil; /* make compiler happy with init */
-
-		assert(!stringtrick);
-		for (p = 0; p < cnt; p++) {
-			o = ba[0].vals[p];
-			for (i = 1; i < n; i++) {
-				o -= ba[i].hlo;
-				if (o >= ba[i].cnt) {
-					if (o == oid_nil - ba[i].hlo) {
-						bn->tnil = 1;
-						v = nil;
-						o = oid_nil;
-						break;
-					}
-					GDKerror("BATprojectchain: does not match always\n");
-					goto bunins_failed;
-				}
-				o = ba[i].vals[o];
-			}
-			if (o != oid_nil) {
-				o -= ba[n].hlo;
-				if (o >= ba[n].cnt) {
-					GDKerror("BATprojectchain: does not match always\n");
-					goto bunins_failed;
-				}
-				v = BUNtvar(bi, o + off);
-			}
-			bunfastapp(bn, v);
-		}
-	} else {
-		/* generic code for fixed-sized atoms */
-		BATiter bi = bat_iterator(b);
-		const void *v = nil; /* make compiler happy with init */
-
-		for (p = 0; p < cnt; p++) {
-			o = ba[0].vals[p];
-			for (i = 1; i < n; i++) {
-				o -= ba[i].hlo;
-				if (o >= ba[i].cnt) {
-					if (o == oid_nil - ba[i].hlo) {
-						bn->tnil = 1;
-						v = nil;
-						o = oid_nil;
-						break;
-					}
-					GDKerror("BATprojectchain: does not match always\n");
-					goto bunins_failed;
-				}
-				o = ba[i].vals[o];
-			}
-			if (o != oid_nil) {
-				o -= ba[n].hlo;
-				if (o >= ba[n].cnt) {
-					GDKerror("BATprojectchain: does not match always\n");
-					goto bunins_failed;
+					v = varsized ? BUNtvar(bi, o + off) : BUNtloc(bi, o + off);
 				}
-				v = BUNtloc(bi, o + off);
+				bunfastapp(bn, v);
 			}
-			bunfastapp(bn, v);
 		}
+		if (nils)
+			bn->tnil = 1;
 	}
 	BATsetcount(bn, cnt);
 	if (stringtrick) {
@@ -0,0 +1,126 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0.  If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Copyright 1997 - July 2008 CWI, August 2008 - 2017 MonetDB B.V.
+ */
+
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "gdk_private.h"
+
+/* LSD radix sort for fixed-size integer values, with an optional
+ * array of oids that is reordered along with the values.
+ *
+ * The values are sorted on an unsigned key with the sign bit flipped,
+ * so that nil, which is the smallest value of the type, comes first
+ * just like with GDKqsort and GDKssort.  For a descending sort all
+ * key bits are inverted.  The sort distributes on RSORT_BITS bits per
+ * pass, starting with the least significant ones.  The histograms for
+ * all passes are counted in one scan up front, so that passes in
+ * which all values have the same digit can be skipped.  Each pass is
+ * stable, and hence so is the sort. */
+
+#define RSORT_BITS	11
+#define RSORT_BUCKETS	(1 << RSORT_BITS)
+#define RSORT_MASK	(RSORT_BUCKETS - 1)
+
+#define RSORT(UTYPE)							\
+	do {								\
+		const UTYPE flip = (UTYPE) 1 << (sizeof(UTYPE) * 8 - 1); \
+		const UTYPE inv = reverse ? (UTYPE) ~(UTYPE) 0 : 0;	\
+		UTYPE *restrict src = h, *restrict dst = h2, *tmp, key; \
+		oid *restrict osrc = t, *restrict odst = t2, *otmp;	\
+		int shift;						\
+									\
+		for (i = 0; i < n; i++) {				\
+			key = src[i] ^ flip ^ inv;			\
+			for (d = 0; d < npasses; d++)			\
+				cnts[d][(key >> (d * RSORT_BITS)) & RSORT_MASK]++; \
+		}							\
+		for (d = 0; d < npasses; d++) {				\
+			shift = d * RSORT_BITS;				\
+			key = src[0] ^ flip ^ inv;			\
+			if (cnts[d][(key >> shift) & RSORT_MASK] == n)	\
+				continue; /* all the same digit */	\
+			for (i = 0, b = 0; b < RSORT_BUCKETS; b++) {	\
+				size_t c = cnts[d][b];			\
+				cnts[d][b] = i;				\
+				i += c;					\
+			}						\
+			if (osrc) {					\
+				for (i = 0; i < n; i++) {		\
+					key = src[i] ^ flip ^ inv;	\
+					p = cnts[d][(key >> shift) & RSORT_MASK]++; \
+					dst[p] = src[i];		\
+					odst[p] = osrc[i];		\
+				}					\
+				otmp = osrc;				\
+				osrc = odst;				\
+				odst = otmp;				\
+			} else {					\
+				for (i = 0; i < n; i++) {		\
+					key = src[i] ^ flip ^ inv;	\
+					p = cnts[d][(key >> shift) & RSORT_MASK]++; \
+					dst[p] = src[i];		\
+				}					\
+			}						\
+			tmp = src;					\
+			src = dst;					\
+			dst = tmp;					\
+		}							\
+		if (src != h) {						\
+			memcpy(h, src, n * sizeof(UTYPE));		\
+			if (t)						\
+				memcpy(t, osrc, n * sizeof(oid));	\
+		}							\
+	} while (0)
+
+/* Sort the n values of type tpe in h, and the oids in t along with
+ * them if t is not NULL.  Only the integer types sht, int, and lng and
+ * the types stored as them are supported.  Returns GDK_FAIL if
+ * there is not enough memory for the scratch copy. */
+gdk_return
+GDKrsort(void *h, void *t, size_t n, int tpe, int reverse)
+{
+	size_t (*cnts)[RSORT_BUCKETS];
+	size_t i, p;
+	int b, d, npasses;
+	void *h2 = NULL;
+	oid *t2 = NULL;
+	int hs = ATOMsize(tpe);
+
+	if (n <= 1)
+		return GDK_SUCCEED;
+	/* only allocate the histograms of the passes the width of the
+	 * type needs */
+	npasses = (hs * 8 + RSORT_BITS - 1) / RSORT_BITS;
+	cnts = GDKzalloc(npasses * sizeof(*cnts));
+	h2 = GDKmalloc(n * hs);
+	if (t)
+		t2 = GDKmalloc(n * sizeof(oid));
+	if (cnts == NULL || h2 == NULL || (t && t2 == NULL)) {
+		GDKfree(cnts);
+		GDKfree(h2);
+		GDKfree(t2);
+		return GDK_FAIL;
+	}
+	switch (ATOMbasetype(tpe)) {
+	case TYPE_sht:
+		RSORT(unsigned short);
+		break;
+	case TYPE_int:
+		RSORT(unsigned int);
+		break;
+	case TYPE_lng:
+		RSORT(ulng);
+		break;
+	default:
+		assert(0);
+	}
+	GDKfree(cnts);
+	GDKfree(h2);
+	GDKfree(t2);
+	return GDK_SUCCEED;
+}
@@ -501,8 +501,169 @@ do {									\
 		}					\
 	} while (0)
 
+/* vectorized scan select
+ *
+ * Scans without a candidate list (or with a dense one) and without
+ * imprints can compare a whole vector of values against the inclusive
+ * range [lo,hi] at once.  The resulting bit mask is turned into oids
+ * four at a time through a lookup table of the set bit positions: each
+ * step stores four oids of which only the first popcount(mask) are
+ * kept.  A kernel therefore stops as soon as the result BAT has no room
+ * left for a full vector, and at the last partial vector of the input;
+ * the scalar loops take it from there.  The kernels are compiled for
+ * AVX2 and only used if the CPU supports it. */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && SIZEOF_OID == 8
+#define HAVE_SIMD_SELECT 1
+#include <immintrin.h>
+
+#define SIMD_SELECT_WIDTH_MAX	32	/* bte */
+
+/* for each 4-bit mask, the positions of its set bits, one per byte */
+static const unsigned int simd_select_positions[16] = {
+	0x00000000, 0x00000000, 0x00000001, 0x00000100,
+	0x00000002, 0x00000200, 0x00000201, 0x00020100,
+	0x00000003, 0x00000300, 0x00000301, 0x00030100,
+	0x00000302, 0x00030200, 0x00030201, 0x03020100,
+};
+
+__attribute__((__target__("avx2")))
+static inline BUN
+simd_select_emit(oid *restrict dst, BUN cnt, oid o, unsigned int mask)
+{
+	__m256i pos = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128((int) simd_select_positions[mask]));
+
+	_mm256_storeu_si256((__m256i *) (dst + cnt),
+			    _mm256_add_epi64(pos, _mm256_set1_epi64x((long long) o)));
+	return cnt + (BUN) __builtin_popcount(mask);
+}
+
+/* MASK sets bit i iff value v[i] of the vector at src + p lies in [lo,hi] */
+#define simdselect(TYPE, WIDTH, INIT, MASK)				\
+__attribute__((__target__("avx2")))					\
+static BUN								\
+simdselect_##TYPE(const TYPE *restrict src, BUN p, BUN q, BUN *cntp,	\
+		  lng off, TYPE lo, TYPE hi, oid *restrict dst, BUN cap) \
+{									\
+	BUN cnt = *cntp;						\
+	unsigned int mask;						\
+	int i;								\
+	INIT;								\
+	while (p + WIDTH <= q && cnt + WIDTH <= cap) {			\
+		mask = (MASK);						\
+		for (i = 0; i < WIDTH; i += 4)				\
+			cnt = simd_select_emit(dst, cnt, (oid) (p + off + i), \
+					       (mask >> i) & 0xF);	\
+		p += WIDTH;						\
+	}								\
+	*cntp = cnt;							\
+	return p;							\
+}
+
+/* integer compares only come in "greater than", so test for values
+ * outside the range and invert */
+#define SIMDintout(W, LOAD)						\
+	_mm256_or_si256(_mm256_cmpgt_epi##W(vlo, LOAD),			\
+			_mm256_cmpgt_epi##W(LOAD, vhi))
+
+simdselect(bte, 32,
+	   __m256i vlo = _mm256_set1_epi8(lo);
+	   __m256i vhi = _mm256_set1_epi8(hi),
+	   ~(unsigned int) _mm256_movemask_epi8(
+		   SIMDintout(8, _mm256_loadu_si256((const __m256i *) (src + p)))))
+simdselect(sht, 16,
+	   __m256i vlo = _mm256_set1_epi16(lo);
+	   __m256i vhi = _mm256_set1_epi16(hi);
+	   __m256i out,
+	   (out = SIMDintout(16, _mm256_loadu_si256((const __m256i *) (src + p))),
+	    ~(unsigned int) _mm_movemask_epi8(
+		    _mm_packs_epi16(_mm256_castsi256_si128(out),
+				    _mm256_extracti128_si256(out, 1))) & 0xFFFF))
+simdselect(int, 8,
+	   __m256i vlo = _mm256_set1_epi32(lo);
+	   __m256i vhi = _mm256_set1_epi32(hi),
+	   ~(unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(
+		   SIMDintout(32, _mm256_loadu_si256((const __m256i *) (src + p))))) & 0xFF)
+simdselect(lng, 4,
+	   __m256i vlo = _mm256_set1_epi64x(lo);
+	   __m256i vhi = _mm256_set1_epi64x(hi),
+	   ~(unsigned int) _mm256_movemask_pd(_mm256_castsi256_pd(
+		   SIMDintout(64, _mm256_loadu_si256((const __m256i *) (src + p))))) & 0xF)
+simdselect(flt, 8,
+	   __m256 vlo = _mm256_set1_ps(lo);
+	   __m256 vhi = _mm256_set1_ps(hi);
+	   __m256 v,
+	   (v = _mm256_loadu_ps(src + p),
+	    (unsigned int) _mm256_movemask_ps(
+		    _mm256_and_ps(_mm256_cmp_ps(v, vlo, _CMP_GE_OQ),
+				  _mm256_cmp_ps(v, vhi, _CMP_LE_OQ)))))
+simdselect(dbl, 4,
+	   __m256d vlo = _mm256_set1_pd(lo);
+	   __m256d vhi = _mm256_set1_pd(hi);
+	   __m256d v,
+	   (v = _mm256_loadu_pd(src + p),
+	    (unsigned int) _mm256_movemask_pd(
+		    _mm256_and_pd(_mm256_cmp_pd(v, vlo, _CMP_GE_OQ),
+				  _mm256_cmp_pd(v, vhi, _CMP_LE_OQ)))))
+
+/* the lowest and highest values of a type, used to turn one-sided
+ * ranges into two-sided ones */
+#define LOWESTbte	GDK_bte_min
+#define LOWESTsht	GDK_sht_min
+#define LOWESTint	GDK_int_min
+#define LOWESTlng	GDK_lng_min
+#define LOWESTflt	(-(flt) INFINITY)
+#define LOWESTdbl	(-(dbl) INFINITY)
+#define HIGHESTbte	GDK_bte_max
+#define HIGHESTsht	GDK_sht_max
+#define HIGHESTint	GDK_int_max
+#define HIGHESTlng	GDK_lng_max
+#define HIGHESTflt	((flt) INFINITY)
+#define HIGHESTdbl	((dbl) INFINITY)
+
+/* run the vectorized kernel over as much of [p,q) as possible, growing
+ * the result the way buninsfix does whenever it runs out of room; the
+ * cases mirror the choice of TEST in scanfunc */
+#define simdscan(TYPE)							\
+do {									\
+	TYPE lo = vl, hi = vh;						\
+	if (use_imprints || anti || !__builtin_cpu_supports("avx2"))	\
+		break;							\
+	if (equi)							\
+		hi = vl;						\
+	else if (b->tnonil && vl == minval)				\
+		lo = LOWEST##TYPE;					\
+	else if (vh == maxval)						\
+		hi = HIGHEST##TYPE;					\
+	ALGODEBUG fprintf(stderr,					\
+			  "#BATselect(b=%s#"BUNFMT",s=%s%s,anti=%d): " \
+			  "simdselect_%s\n", BATgetId(b), BATcount(b),	\
+			  s ? BATgetId(s) : "NULL",			\
+			  s && BATtdense(s) ? "(dense)" : "",		\
+			  anti, #TYPE);					\
+	for (;;) {							\
+		p = simdselect_##TYPE(src, p, q, &cnt, off, lo, hi,	\
+				      dst, BATcapacity(bn));		\
+		if (q - p < SIMD_SELECT_WIDTH_MAX ||			\
+		    BATcapacity(bn) >= maximum)				\
+			break;						\
+		BATsetcount(bn, cnt);					\
+		if (BATextend(bn, MIN(BATcapacity(bn) +			\
+				      (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r) \
+					     * (dbl) (q-p) * 1.1 + 1024), \
+				      BATcapacity(bn) + q - p)) != GDK_SUCCEED) { \
+			BBPreclaim(bn);					\
+			return BUN_NONE;				\
+		}							\
+		dst = (oid *) Tloc(bn, 0);				\
+	}								\
+} while (0)
+#else
+#define simdscan(TYPE)	((void) 0)
+#endif
+#define nosimdscan(TYPE)	((void) 0)
+
 /* definition of type-specific core scan select function */
-#define scanfunc(NAME, TYPE, CAND, END)					\
+#define scanfunc(NAME, TYPE, CAND, END, SIMD)				\
 static BUN								\
 NAME##_##TYPE(BAT *b, BAT *s, BAT *bn, const TYPE *tl, const TYPE *th,	\
 	      int li, int hi, int equi, int anti, int lval, int hval,	\
@@ -544,6 +705,7 @@ NAME##_##TYPE(BAT *b, BAT *s, BAT *bn, const TYPE *tl, const TYPE *th,	\
 		basesrc = (const TYPE *) Tloc(b, 0);			\
 	}								\
 	END;								\
+	SIMD(TYPE);							\
 	if (equi) {							\
 		assert(!use_imprints);					\
 		scanloop(NAME, CAND, v == vl);				\
@@ -738,28 +900,181 @@ fullscan_any(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	return cnt;
 }
 
+/* Range selects on strings whose string heap is free of duplicates
+ * (GDK_STRDISTINCT) are done on the offsets (codes): the predicate is
+ * evaluated once for each string in the heap, after which the column
+ * is scanned comparing offsets only.  For a small heap we remember
+ * the qualifying offsets in a table, for a dictionary heap the
+ * qualifying strings form an interval of offsets. */
+
+/* the predicate of fullscan_any for range and anti selects */
+static inline int
+strsel_match(const char *v, const char *tl, const char *th,
+	     int li, int hi, int anti, int lval, int hval)
+{
+	int c;
+
+	if (GDK_STRNIL(v))
+		return 0;
+	if (anti)
+		return (lval &&
+			((c = GDK_STRCMP(tl, v)) > 0 || (!li && c == 0))) ||
+			(hval &&
+			 ((c = GDK_STRCMP(th, v)) < 0 || (!hi && c == 0)));
+	return (!lval || (c = GDK_STRCMP(tl, v)) < 0 || (li && c == 0)) &&
+		(!hval || (c = GDK_STRCMP(th, v)) > 0 || (hi && c == 0));
+}
+
+/* find string v in a dictionary heap, return 0 if it isn't there */
+static var_t
+strdict_locate(const Heap *h, const char *v)
+{
+	var_t pos;
+	int c;
+
+	for (pos = strNext(h, 0); pos != 0; pos = strNext(h, pos)) {
+		if ((c = GDK_STRCMP(v, h->base + pos)) <= 0)
+			return c == 0 ? pos : 0;
+	}
+	return 0;
+}
+
+#define strcode_scan(TEST)						\
+	do {								\
+		switch (b->twidth) {					\
+		case 1: {						\
+			const unsigned char *ptr = (const unsigned char *) Tloc(b, 0); \
+			for (; p < q; p++, o++) {			\
+				pos = (var_t) ptr[p] + GDK_VAROFFSET;	\
+				if (TEST) {				\
+					buninsfix(bn, dst, cnt, o,	\
+						  (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r) \
+							 * (dbl) (q-p) * 1.1 + 1024), \
+						  BATcapacity(bn) + q - p, BUN_NONE); \
+					cnt++;				\
+				}					\
+			}						\
+			break;						\
+		}							\
+		case 2: {						\
+			const unsigned short *ptr = (const unsigned short *) Tloc(b, 0); \
+			for (; p < q; p++, o++) {			\
+				pos = (var_t) ptr[p] + GDK_VAROFFSET;	\
+				if (TEST) {				\
+					buninsfix(bn, dst, cnt, o,	\
+						  (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r) \
+							 * (dbl) (q-p) * 1.1 + 1024), \
+						  BATcapacity(bn) + q - p, BUN_NONE); \
+					cnt++;				\
+				}					\
+			}						\
+			break;						\
+		}							\
+		default: {						\
+			const char *ptr = (const char *) Tloc(b, 0);	\
+			for (; p < q; p++, o++) {			\
+				pos = VarHeapVal(ptr, p, b->twidth);	\
+				if (TEST) {				\
+					buninsfix(bn, dst, cnt, o,	\
+						  (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r) \
+							 * (dbl) (q-p) * 1.1 + 1024), \
+						  BATcapacity(bn) + q - p, BUN_NONE); \
+					cnt++;				\
+				}					\
+			}						\
+			break;						\
+		}							\
+		}							\
+	} while (0)
+
+static BUN
+strcode_select(BAT *b, BAT *bn, const unsigned char *qual,
+	       var_t lo, var_t hi, BUN r, BUN q, BUN cnt, lng off,
+	       oid *restrict dst)
+{
+	var_t pos;
+	BUN p = r;
+	oid o = (oid) (p + off);
+
+	if (qual)
+		strcode_scan(qual[pos]);
+	else
+		strcode_scan(pos >= lo && pos < hi);
+	return cnt;
+}
+
 static BUN
 fullscan_str(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	     int li, int hi, int equi, int anti, int lval, int hval,
 	     BUN r, BUN q, BUN cnt, lng off, oid *restrict dst,
 	     const oid *candlist, BUN maximum, int use_imprints)
 {
+	const Heap *h = b->tvheap;
 	var_t pos;
 	BUN p = r;
 	oid o = (oid) (p + off);
 
-	if (!equi || !GDK_ELIMDOUBLES(b->tvheap))
+	if (!GDK_STRDISTINCT(h) ||
+	    (!equi && anti && !GDK_ELIMDOUBLES(h)))
 		return fullscan_any(b, s, bn, tl, th, li, hi, equi, anti,
 				    lval, hval, r, q, cnt, off, dst,
 				    candlist, maximum, use_imprints);
+	if (!equi && GDK_ELIMDOUBLES(h)) {
+		unsigned char *qual;
+
+		ALGODEBUG fprintf(stderr,
+				  "#BATselect(b=%s#"BUNFMT",s=%s%s,anti=%d): "
+				  "fullscan range strelim\n", BATgetId(b),
+				  BATcount(b), s ? BATgetId(s) : "NULL",
+				  s && BATtdense(s) ? "(dense)" : "", anti);
+		if ((qual = GDKzalloc(h->free)) == NULL)
+			return BUN_NONE;
+		for (pos = strNext(h, 0); pos != 0; pos = strNext(h, pos))
+			qual[pos] = (unsigned char) strsel_match(
+				h->base + pos, tl, th, li, hi,
+				anti, lval, hval);
+		cnt = strcode_select(b, bn, qual, 0, 0, r, q, cnt, off, dst);
+		GDKfree(qual);
+		return cnt;
+	}
+	if (!equi) {
+		var_t lopos = 0, hipos = 0;
+
+		ALGODEBUG fprintf(stderr,
+				  "#BATselect(b=%s#"BUNFMT",s=%s%s,anti=%d): "
+				  "fullscan range strdict\n", BATgetId(b),
+				  BATcount(b), s ? BATgetId(s) : "NULL",
+				  s && BATtdense(s) ? "(dense)" : "", anti);
+		/* the strings are in ascending order, so the
+		 * qualifying ones are consecutive */
+		for (pos = strNext(h, 0); pos != 0; pos = strNext(h, pos)) {
+			if (strsel_match(h->base + pos, tl, th, li, hi,
+					 0, lval, hval)) {
+				if (lopos == 0)
+					lopos = pos;
+				hipos = pos + 1;
+			} else if (lopos != 0) {
+				break;
+			}
+		}
+		if (lopos == 0)
+			return cnt;
+		return strcode_select(b, bn, NULL, lopos, hipos, r, q, cnt,
+				      off, dst);
+	}
 	ALGODEBUG fprintf(stderr,
 			  "#BATselect(b=%s#"BUNFMT",s=%s%s,anti=%d): "
-			  "fullscan equi strelim\n", BATgetId(b), BATcount(b),
+			  "fullscan equi %s\n", BATgetId(b), BATcount(b),
 			  s ? BATgetId(s) : "NULL",
-			  s && BATtdense(s) ? "(dense)" : "", anti);
-
-	if ((pos = strLocate(b->tvheap, tl)) == 0)
-		return 0;
+			  s && BATtdense(s) ? "(dense)" : "", anti,
+			  GDK_ELIMDOUBLES(h) ? "strelim" : "strdict");
+
+	if (GDK_ELIMDOUBLES(h))
+		pos = strLocate(b->tvheap, tl);
+	else
+		pos = strdict_locate(h, tl);
+	if (pos == 0)
+		return cnt;
 	assert(pos >= GDK_VAROFFSET);
 	switch (b->twidth) {
 	case 1: {
@@ -832,30 +1147,30 @@ fullscan_str(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 
 /* scan select type switch */
 #ifdef HAVE_HGE
-#define scanfunc_hge(NAME, CAND, END)	\
-	scanfunc(NAME, hge, CAND, END)
+#define scanfunc_hge(NAME, CAND, END, SIMD)	\
+	scanfunc(NAME, hge, CAND, END, nosimdscan)
 #else
-#define scanfunc_hge(NAME, CAND, END)
+#define scanfunc_hge(NAME, CAND, END, SIMD)
 #endif
-#define scan_sel(NAME, CAND, END)		\
-	scanfunc(NAME, bte, CAND, END)		\
-	scanfunc(NAME, sht, CAND, END)		\
-	scanfunc(NAME, int, CAND, END)		\
-	scanfunc(NAME, flt, CAND, END)		\
-	scanfunc(NAME, dbl, CAND, END)		\
-	scanfunc(NAME, lng, CAND, END)		\
-	scanfunc_hge(NAME, CAND, END)
+#define scan_sel(NAME, CAND, END, SIMD)		\
+	scanfunc(NAME, bte, CAND, END, SIMD)	\
+	scanfunc(NAME, sht, CAND, END, SIMD)	\
+	scanfunc(NAME, int, CAND, END, SIMD)	\
+	scanfunc(NAME, flt, CAND, END, SIMD)	\
+	scanfunc(NAME, dbl, CAND, END, SIMD)	\
+	scanfunc(NAME, lng, CAND, END, SIMD)	\
+	scanfunc_hge(NAME, CAND, END, SIMD)
 
 /* scan/imprints select with candidates */
-scan_sel(candscan, o = *candlist++, w = (BUN) ((*(oid *) Tloc(s,q?(q - 1):0)) + 1))
+scan_sel(candscan, o = *candlist++, w = (BUN) ((*(oid *) Tloc(s,q?(q - 1):0)) + 1), nosimdscan)
 /* scan/imprints select without candidates */
-scan_sel(fullscan, o = (oid) (p+off), w = (BUN) (q+off))
+scan_sel(fullscan, o = (oid) (p+off), w = (BUN) (q+off), simdscan)
 
 
 static BAT *
 BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	       int li, int hi, int equi, int anti, int lval, int hval,
-	       BUN maximum, int use_imprints)
+	       BUN maximum, int use_imprints, BUN first, BUN last)
 {
 #ifndef NDEBUG
 	int (*cmp)(const void *, const void *);
@@ -876,6 +1191,7 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	assert(!anti || lval || hval);
 	assert( anti || lval || hval || !b->tnonil);
 	assert(b->ttype != TYPE_void || equi || b->tnonil);
+	assert(first <= last && last <= BATcount(b));
 
 #ifndef NDEBUG
 	cmp = ATOMcompare(b->ttype);
@@ -891,7 +1207,8 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 
 	off = (lng) b->hseqbase;
 	dst = (oid *) Tloc(bn, 0);
-	cnt = 0;
+	/* results are added after what is already in bn */
+	cnt = BATcount(bn);
 
 	t = ATOMbasetype(b->ttype);
 
@@ -901,9 +1218,10 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 		assert(s->tkey);
 		/* setup candscanloop loop vars to only iterate over
 		 * part of s that has values that are in range of b */
-		o = b->hseqbase + BATcount(b);
+		o = b->hseqbase + last;
 		q = SORTfndfirst(s, &o);
-		p = SORTfndfirst(s, &b->hseqbase);
+		o = b->hseqbase + first;
+		p = SORTfndfirst(s, &o);
 		/* should we return an error if p > 0 || q <
 		 * BUNlast(s) (i.e. s not fully used)? */
 		candlist = (const oid *) Tloc(s, p);
@@ -943,15 +1261,17 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 			assert(BATtdense(s));
 			p = (BUN) s->tseqbase;
 			q = p + BATcount(s);
-			if ((oid) p < b->hseqbase)
-				p = (BUN) b->hseqbase;
-			if ((oid) q > b->hseqbase + BATcount(b))
-				q = (BUN) b->hseqbase + BATcount(b);
+			if ((oid) p < b->hseqbase + first)
+				p = (BUN) b->hseqbase + first;
+			if ((oid) q > b->hseqbase + last)
+				q = (BUN) b->hseqbase + last;
+			if (q < p)
+				q = p;
 			p = (BUN) (p - off);
 			q = (BUN) (q - off);
 		} else {
-			p = 0;
-			q = BUNlast(b);
+			p = first;
+			q = last;
 		}
 		candlist = NULL;
 		/* call type-specific core scan select function */
@@ -1003,6 +1323,196 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	return bn;
 }
 
+/* a part of b that BAT_scanselect_parallel scans on a thread of its own */
+struct scanselect_morsel {
+	BAT *b, *s, *bn;
+	const void *tl, *th;
+	int li, hi, equi, anti, lval, hval, use_imprints;
+	BUN maximum, first, last;
+};
+
+static void
+BAT_scanselect_morsel(void *arg)
+{
+	struct scanselect_morsel *m = arg;
+
+	m->bn = BAT_scanselect(m->b, m->s, m->bn, m->tl, m->th, m->li, m->hi,
+			       m->equi, m->anti, m->lval, m->hval,
+			       m->maximum, m->use_imprints, m->first, m->last);
+}
+
+/* scan select of large inputs: b is split into nmorsels consecutive
+ * ranges that are scanned in parallel, each into a result of its own;
+ * since the ranges are in order, concatenating the results gives the
+ * sorted result in bn; with a candidate list, the ranges hold equal
+ * numbers of candidates rather than equal numbers of values */
+static BAT *
+BAT_scanselect_parallel(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
+			int li, int hi, int equi, int anti, int lval, int hval,
+			BUN maximum, BUN estimate, int use_imprints, int nmorsels)
+{
+	struct scanselect_morsel *morsels;
+	void **args;
+	BUN cnt = 0, start = 0, end = BATcount(b), *bounds;
+	oid *restrict dst;
+	int i;
+
+	ALGODEBUG fprintf(stderr, "#BATselect(b=%s#" BUNFMT
+			  ",s=%s%s,anti=%d): %d morsels\n",
+			  BATgetId(b), BATcount(b),
+			  s ? BATgetId(s) : "NULL",
+			  s && BATtdense(s) ? "(dense)" : "", anti, nmorsels);
+	/* build imprints here, not concurrently in the morsels */
+	if (use_imprints && (BATimprints(b) != GDK_SUCCEED)) {
+		GDKclrerr();	/* not interested in BATimprints errors */
+		use_imprints = 0;
+	}
+	morsels = GDKzalloc(nmorsels * sizeof(struct scanselect_morsel));
+	args = GDKmalloc(nmorsels * sizeof(void *));
+	bounds = GDKmalloc((nmorsels + 1) * sizeof(BUN));
+	if (morsels == NULL || args == NULL || bounds == NULL)
+		goto bailout;
+	if (s && BATtdense(s)) {
+		if (s->tseqbase > b->hseqbase)
+			start = MIN((BUN) (s->tseqbase - b->hseqbase), end);
+		if (s->tseqbase + BATcount(s) < b->hseqbase + end)
+			end = s->tseqbase + BATcount(s) > b->hseqbase + start ? (BUN) (s->tseqbase + BATcount(s) - b->hseqbase) : start;
+	}
+	for (i = 0; i <= nmorsels; i++)
+		bounds[i] = start + (end - start) / nmorsels * i;
+	if (s && !BATtdense(s)) {
+		const oid *cand = (const oid *) Tloc(s, 0);
+		oid o = b->hseqbase + end;
+		BUN cq = SORTfndfirst(s, &o);
+		BUN cp = SORTfndfirst(s, &b->hseqbase);
+
+		/* each range starts at a candidate */
+		for (i = 1; i < nmorsels && cq - cp >= (BUN) nmorsels; i++)
+			bounds[i] = (BUN) (cand[cp + (cq - cp) / nmorsels * i] - b->hseqbase);
+	}
+	bounds[0] = 0;
+	bounds[nmorsels] = BATcount(b);
+	for (i = 0; i < nmorsels; i++) {
+		struct scanselect_morsel *m = &morsels[i];
+
+		m->b = b;
+		m->s = s;
+		m->tl = tl;
+		m->th = th;
+		m->li = li;
+		m->hi = hi;
+		m->equi = equi;
+		m->anti = anti;
+		m->lval = lval;
+		m->hval = hval;
+		m->use_imprints = use_imprints;
+		m->first = bounds[i];
+		m->last = bounds[i + 1];
+		m->maximum = MIN(maximum, m->last - m->first);
+		m->bn = COLnew(0, TYPE_oid, MIN(estimate, m->maximum), TRANSIENT);
+		if (m->bn == NULL)
+			goto bailout;
+		args[i] = m;
+	}
+	GDKparallel(BAT_scanselect_morsel, args, nmorsels);
+	for (i = 0; i < nmorsels; i++) {
+		if (morsels[i].bn == NULL)
+			goto bailout;
+		cnt += BATcount(morsels[i].bn);
+	}
+	if (BATcapacity(bn) < cnt &&
+	    BATextend(bn, cnt) != GDK_SUCCEED)
+		goto bailout;
+	dst = (oid *) Tloc(bn, 0);
+	for (i = 0; i < nmorsels; i++) {
+		memcpy(dst, Tloc(morsels[i].bn, 0),
+		       BATcount(morsels[i].bn) * sizeof(oid));
+		dst += BATcount(morsels[i].bn);
+		BBPreclaim(morsels[i].bn);
+	}
+	GDKfree(morsels);
+	GDKfree(args);
+	GDKfree(bounds);
+
+	BATsetcount(bn, cnt);
+	bn->tsorted = 1;
+	bn->trevsorted = bn->batCount <= 1;
+	bn->tkey = 1;
+	bn->tdense = (bn->batCount <= 1 || bn->batCount == b->batCount);
+	if (bn->batCount == 1 || bn->batCount == b->batCount)
+		bn->tseqbase = b->hseqbase;
+	return bn;
+
+  bailout:
+	if (morsels) {
+		for (i = 0; i < nmorsels; i++)
+			BBPreclaim(morsels[i].bn);
+	}
+	GDKfree(morsels);
+	GDKfree(args);
+	GDKfree(bounds);
+	BBPreclaim(bn);
+	return NULL;
+}
+
+/* scan select guided by the zone map of b: ranges is the result of
+ * ZMprune; ranges in which all values qualify are added to the result
+ * without looking at the values, the others are scanned; since the
+ * ranges are in order, each just adds to the end of bn */
+static BAT *
+BAT_zonemapselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
+		  int equi, BUN maximum, const BUN *ranges, BUN nranges)
+{
+	BUN i, p, first, last;
+	oid *restrict dst;
+
+	ALGODEBUG fprintf(stderr, "#BATselect(b=%s#" BUNFMT
+			  ",s=%s%s,anti=0): zonemap select, " BUNFMT
+			  " ranges\n",
+			  BATgetId(b), BATcount(b),
+			  s ? BATgetId(s) : "NULL",
+			  s && BATtdense(s) ? "(dense)" : "", nranges);
+	for (i = 0; i < nranges; i++) {
+		first = ranges[3 * i];
+		last = ranges[3 * i + 1];
+		if (ranges[3 * i + 2] && (s == NULL || BATtdense(s))) {
+			if (s) {
+				/* only the candidates in the range */
+				p = s->tseqbase > b->hseqbase ? (BUN) (s->tseqbase - b->hseqbase) : 0;
+				if (first < p)
+					first = p;
+				p = s->tseqbase + BATcount(s) > b->hseqbase ? (BUN) (s->tseqbase + BATcount(s) - b->hseqbase) : 0;
+				if (last > p)
+					last = p;
+				if (first >= last)
+					continue;
+			}
+			if (BATcount(bn) + last - first > BATcapacity(bn) &&
+			    BATextend(bn, BATcount(bn) + last - first) != GDK_SUCCEED) {
+				BBPreclaim(bn);
+				return NULL;
+			}
+			dst = (oid *) Tloc(bn, BATcount(bn));
+			for (p = first; p < last; p++)
+				*dst++ = b->hseqbase + p;
+			BATsetcount(bn, BATcount(bn) + last - first);
+		} else {
+			bn = BAT_scanselect(b, s, bn, tl, th, 1, 1, equi, 0,
+					    1, 1, maximum, 0, first, last);
+			if (bn == NULL)
+				return NULL;
+		}
+	}
+
+	bn->tsorted = 1;
+	bn->trevsorted = bn->batCount <= 1;
+	bn->tkey = 1;
+	bn->tdense = (bn->batCount <= 1 || bn->batCount == b->batCount);
+	if (bn->batCount == 1 || bn->batCount == b->batCount)
+		bn->tseqbase = b->hseqbase;
+	return bn;
+}
+
 /* generic range select
  *
  * Return a dense-headed BAT with the OID values of b in the tail for
@@ -1793,7 +2303,32 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 				  s && BATtdense(s) ? "(dense)" : "", anti);
 		bn = BAT_hashselect(b, s, bn, tl, maximum);
 	} else {
-		int use_imprints = 0;
+		int use_imprints = 0, nmorsels;
+		BUN nranges = BUN_NONE, *ranges = NULL;
+
+		if (!anti &&
+		    !b->tvarsized &&
+		    ATOMtype(b->ttype) != TYPE_oid &&
+		    (tmp = parent != 0 ? BBPquickdesc(parent, 0) : b) != NULL &&
+		    tmp->batRole == PERSISTENT &&
+		    BATcount(tmp) >= 4 * ZONEMAP_BLOCK) {
+			/* use a zone map if
+			 *   i) bat or its parent is a (not small) column
+			 *      of the store, also when running in memory,
+			 *  ii) it is not an anti-select, and
+			 * iii) the zone map excludes enough of the bat.
+			 */
+			if (BATzonemap(b) == GDK_SUCCEED)
+				nranges = ZMprune(b, tl, th, &ranges);
+			else
+				GDKclrerr();	/* not interested in BATzonemap errors */
+		}
+		if (nranges != BUN_NONE) {
+			bn = BAT_zonemapselect(b, s, bn, tl, th, equi, maximum,
+					       ranges, nranges);
+			GDKfree(ranges);
+			return virtualize(bn);
+		}
 		if (!equi &&
 		    !b->tvarsized &&
 		    (b->batPersistence == PERSISTENT ||
@@ -1807,8 +2342,17 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 			 */
 			use_imprints = 1;
 		}
-		bn = BAT_scanselect(b, s, bn, tl, th, li, hi, equi, anti,
-				    lval, hval, maximum, use_imprints);
+		/* the work is in the candidates, not in all of b */
+		nmorsels = GDKmorsels(s && BATcount(s) < BATcount(b) ? BATcount(s) : BATcount(b));
+		if (nmorsels > 1)
+			bn = BAT_scanselect_parallel(b, s, bn, tl, th, li, hi,
+						     equi, anti, lval, hval,
+						     maximum, estimate,
+						     use_imprints, nmorsels);
+		else
+			bn = BAT_scanselect(b, s, bn, tl, th, li, hi, equi,
+					    anti, lval, hval, maximum,
+					    use_imprints, 0, BATcount(b));
 	}
 
 	return virtualize(bn);
@@ -797,6 +797,7 @@ BATsave(BAT *bd)
 	if (err == GDK_SUCCEED) {
 		bd->batCopiedtodisk = 1;
 		DESCclean(bd);
+		ZMpersist(bd);
 		return GDK_SUCCEED;
 	}
 	return err;
@@ -895,6 +896,7 @@ BATdelete(BAT *b)
 		HASHdestroy(b);
 		IMPSdestroy(b);
 		OIDXdestroy(b);
+		ZMdestroy(b);
 	}
 
 	if (b->batCopiedtodisk || (b->theap.storage != STORE_MEM)) {
@@ -445,6 +445,31 @@ MT_getpid(void)
 #endif
 }
 
+/* a pointer per thread that is found without a lock, also for threads
+ * that were not started by GDK; GDK keeps the query context in it */
+static pthread_key_t threadkey;
+static pthread_once_t threadkey_once = PTHREAD_ONCE_INIT;
+
+static void
+threadkey_init(void)
+{
+	(void) pthread_key_create(&threadkey, NULL);
+}
+
+void
+MT_thread_setdata(void *data)
+{
+	(void) pthread_once(&threadkey_once, threadkey_init);
+	(void) pthread_setspecific(threadkey, data);
+}
+
+void *
+MT_thread_getdata(void)
+{
+	(void) pthread_once(&threadkey_once, threadkey_init);
+	return pthread_getspecific(threadkey);
+}
+
 #define SMP_TOLERANCE 0.40
 #define SMP_ROUNDS 1024*1024*128
 
@@ -540,6 +565,26 @@ GDKusec(void)
 return 0; // hahahahahahah
 }
 
+lng
+GDKwallclock(void)
+{
+#ifdef HAVE_GETTIMEOFDAY
+	struct timeval tp;
+
+	gettimeofday(&tp, NULL);
+	return (lng) tp.tv_sec * 1000000 + (lng) tp.tv_usec;
+#else
+#ifdef HAVE_FTIME
+	struct timeb tb;
+
+	ftime(&tb);
+	return (lng) tb.time * 1000000 + (lng) tb.millitm * 1000;
+#else
+	return (lng) time(NULL) * 1000000;
+#endif
+#endif
+}
+
 
 int
 GDKms(void)
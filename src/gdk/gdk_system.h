@@ -71,6 +71,8 @@ gdk_export int MT_create_thread(MT_Id *t, void (*function) (void *),
 gdk_export void MT_exiting_thread(void);
 gdk_export MT_Id MT_getpid(void);
 gdk_export int MT_join_thread(MT_Id t);
+gdk_export void MT_thread_setdata(void *data);
+gdk_export void *MT_thread_getdata(void);
 
 #if SIZEOF_VOID_P == 4
 /* "limited" stack size on 32-bit systems */
@@ -326,5 +328,7 @@ gdk_export int MT_check_nr_cores(void);
  */
 gdk_export lng GDKusec(void);
 gdk_export int GDKms(void);
+/* wall clock in usec, GDKusec does not tick in this library */
+gdk_export lng GDKwallclock(void);
 
 #endif /*_GDK_SYSTEM_H_*/
@@ -257,6 +257,7 @@ static volatile ATOMIC_TYPE GDK_mallocedbytes_estimate = 0;
 static volatile lng GDK_malloc_success_count = -1;
 #endif
 static volatile ATOMIC_TYPE GDK_vm_cursize = 0;
+static MT_Lock GDKpoolLock MT_LOCK_INITIALIZER("GDKpoolLock");
 #ifdef ATOMIC_LOCK
 static MT_Lock mbyteslock MT_LOCK_INITIALIZER("mbyteslock");
 static MT_Lock GDKstoppedLock MT_LOCK_INITIALIZER("GDKstoppedLock");
@@ -293,6 +294,7 @@ MT_init(void)
 #define CATNAP		50	/* time to sleep in ms for catnaps */
 
 static void THRinit(void);
+static void GDKaddbuf(const char *message);
 static void GDKlockHome(int farmid);
 
 #ifndef STATIC_CODE_ANALYSIS
@@ -321,6 +323,7 @@ GDKinit(str dbpath)
 	ATOMIC_INIT(mbyteslock);
 	MT_lock_init(&GDKnameLock, "GDKnameLock");
 	MT_lock_init(&GDKthreadLock, "GDKthreadLock");
+	MT_lock_init(&GDKpoolLock, "GDKpoolLock");
 	MT_lock_init(&GDKtmLock, "GDKtmLock");
 #ifndef NDEBUG
 	MT_lock_init(&mallocsuccesslock, "mallocsuccesslock");
@@ -399,6 +402,7 @@ GDKinit(str dbpath)
 	GDKnr_threads = GDKgetenv_int("gdk_nr_threads", 0);
 	if (GDKnr_threads == 0)
 		GDKnr_threads = MT_check_nr_cores();
+	GDK_morsel_size = (BUN) GDKgetenv_int("gdk_morsel_size", (int) GDK_MORSEL_SIZE);
 
 	if (dbpath) {
 		GDKsetenv("gdk_dbpath", dbpath);
@@ -467,6 +471,206 @@ GDKinit(str dbpath)
 int GDKnr_threads = 0;
 static int GDKnrofthreads;
 
+/* The morsels of GDKparallel run on a pool of GDKnr_threads - 1 worker
+ * threads that is shared by all operators, so that operators that
+ * already run in parallel, e.g. in a mitosis plan, do not multiply the
+ * number of threads.  The calling thread works along on its own
+ * morsels, so it never waits for a free worker. */
+BUN GDK_morsel_size = GDK_MORSEL_SIZE;
+
+int
+GDKmorsels(BUN cnt)
+{
+	BUN n;
+
+	if (GDK_morsel_size == 0 || GDKnr_threads <= 1)
+		return 1;
+	n = cnt / GDK_morsel_size;
+	if (n < 2)
+		return 1;
+	return n < (BUN) GDKnr_threads ? (int) n : GDKnr_threads;
+}
+
+/* a call of GDKparallel, queued for the workers while it has morsels
+ * that are not taken yet */
+struct parallel {
+	void (*fcn) (void *);
+	void **args;
+	int n;			/* number of morsels */
+	int next;		/* first morsel not taken */
+	void *qryctx;		/* query context of the caller */
+	MT_Sema done;		/* upped for each morsel a worker finished */
+	char errbuf[GDKMAXERRLEN]; /* errors of the workers */
+	struct parallel *nxt;
+};
+
+static struct {
+	MT_Sema todo;		/* workers wait here for morsels */
+	struct parallel *head;	/* queue of calls with morsels left */
+	MT_Id *workers;
+	int nworkers;
+	int stop;
+} GDKpool;
+
+/* take the next morsel of p and dequeue p when it was the last;
+ * called with GDKpoolLock held */
+static int
+GDKpool_take(struct parallel *p)
+{
+	struct parallel **pp;
+	int i;
+
+	if (p->next >= p->n)
+		return -1;
+	i = p->next++;
+	if (p->next == p->n) {
+		for (pp = &GDKpool.head; *pp != p; pp = &(*pp)->nxt)
+			;
+		*pp = p->nxt;
+	}
+	return i;
+}
+
+/* a worker is registered with GDK, runs each morsel in the query
+ * context of the caller and leaves its errors in a buffer of its own,
+ * which it passes on to the caller */
+static void
+GDKpool_worker(void *arg)
+{
+	Thread t = THRnew("GDKparallel");
+	char *errbuf = t ? GDKzalloc(GDKMAXERRLEN) : NULL;
+	struct parallel *p;
+	int i;
+
+	(void) arg;
+	if (errbuf)
+		GDKsetbuf(errbuf);
+	for (;;) {
+		MT_sema_down(&GDKpool.todo);
+		for (;;) {
+			MT_lock_set(&GDKpoolLock);
+			if (GDKpool.stop) {
+				MT_lock_unset(&GDKpoolLock);
+				goto bailout;
+			}
+			p = GDKpool.head;
+			i = p ? GDKpool_take(p) : -1;
+			MT_lock_unset(&GDKpoolLock);
+			if (i < 0)
+				break;
+			MT_thread_setdata(p->qryctx);
+			(*p->fcn)(p->args[i]);
+			MT_thread_setdata(NULL);
+			if (errbuf && *errbuf) {
+				MT_lock_set(&GDKpoolLock);
+				strncat(p->errbuf, errbuf, sizeof(p->errbuf) - strlen(p->errbuf) - 1);
+				MT_lock_unset(&GDKpoolLock);
+				*errbuf = 0;
+			}
+			MT_sema_up(&p->done);
+		}
+	}
+  bailout:
+	if (errbuf) {
+		GDKsetbuf(0);
+		GDKfree(errbuf);
+	}
+	if (t)
+		THRdel(t);
+}
+
+/* start the workers that are missing; called with GDKpoolLock held */
+static int
+GDKpool_start(void)
+{
+	MT_Id *workers;
+
+	if (GDKpool.nworkers >= GDKnr_threads - 1 || GDKpool.stop)
+		return GDKpool.nworkers;
+	workers = GDKrealloc(GDKpool.workers, (GDKnr_threads - 1) * sizeof(MT_Id));
+	if (workers == NULL) {
+		GDKclrerr();
+		return GDKpool.nworkers;
+	}
+	GDKpool.workers = workers;
+	if (GDKpool.nworkers == 0)
+		MT_sema_init(&GDKpool.todo, 0, "GDKpool");
+	while (GDKpool.nworkers < GDKnr_threads - 1 &&
+	       MT_create_thread(&workers[GDKpool.nworkers], GDKpool_worker, NULL, MT_THR_JOINABLE) == 0)
+		GDKpool.nworkers++;
+	return GDKpool.nworkers;
+}
+
+/* stop the workers, the pool is started again when it is needed */
+static void
+GDKpool_stop(void)
+{
+	int i, n;
+
+	MT_lock_set(&GDKpoolLock);
+	GDKpool.stop = 1;
+	n = GDKpool.nworkers;
+	MT_lock_unset(&GDKpoolLock);
+	for (i = 0; i < n; i++)
+		MT_sema_up(&GDKpool.todo);
+	for (i = 0; i < n; i++)
+		MT_join_thread(GDKpool.workers[i]);
+	if (n > 0)
+		MT_sema_destroy(&GDKpool.todo);
+	GDKfree(GDKpool.workers);
+	GDKpool.workers = NULL;
+	GDKpool.nworkers = 0;
+	GDKpool.head = NULL;
+	GDKpool.stop = 0;
+}
+
+/* call fcn(args[i]) for 0 <= i < n and return when all calls have
+ * returned */
+void
+GDKparallel(void (*fcn) (void *), void **args, int n)
+{
+	struct parallel p;
+	int i, nworkers = 0, own = 0;
+
+	if (n > 1) {
+		MT_lock_set(&GDKpoolLock);
+		nworkers = GDKpool_start();
+		MT_lock_unset(&GDKpoolLock);
+	}
+	if (nworkers == 0) {
+		for (i = 0; i < n; i++)
+			(*fcn)(args[i]);
+		return;
+	}
+	p.fcn = fcn;
+	p.args = args;
+	p.n = n;
+	p.next = 0;
+	p.qryctx = MT_thread_getdata();
+	p.errbuf[0] = 0;
+	p.nxt = NULL;
+	MT_sema_init(&p.done, 0, "GDKparallel");
+	MT_lock_set(&GDKpoolLock);
+	p.nxt = GDKpool.head;
+	GDKpool.head = &p;
+	MT_lock_unset(&GDKpoolLock);
+	for (i = 1; i < n && i <= nworkers; i++)
+		MT_sema_up(&GDKpool.todo);
+	for (;;) {
+		MT_lock_set(&GDKpoolLock);
+		i = GDKpool_take(&p);
+		MT_lock_unset(&GDKpoolLock);
+		if (i < 0)
+			break;
+		(*fcn)(args[i]);
+		own++;
+	}
+	for (i = own; i < n; i++)
+		MT_sema_down(&p.done);
+	MT_sema_destroy(&p.done);
+	GDKaddbuf(p.errbuf);
+}
+
 int
 GDKexiting(void)
 {
@@ -542,6 +746,7 @@ GDKreset(int status, int exit)
 		BBPunfix(GDKval->batCacheid);
 		GDKval = 0;
 	}
+	GDKpool_stop();
 
 	MT_lock_set(&GDKthreadLock);
 	for (st = serverthread; st; st = serverthread) {
@@ -636,6 +841,8 @@ GDKreset(int status, int exit)
 		memset((char*) THRdata, 0, sizeof(THRdata));
 		memset((char*) THRprintbuf,0, sizeof(THRprintbuf));
 		gdk_bbp_reset();
+		/* the database may be started again in this process */
+		ATOMIC_CLEAR(GDKstopped, GDKstoppedLock);
 		MT_lock_unset(&GDKthreadLock);
 		//gdk_system_reset(); CHECK OUT
 	}
@@ -647,6 +854,7 @@ GDKreset(int status, int exit)
 #endif
 	MT_lock_destroy(&GDKnameLock);
 	MT_lock_destroy(&GDKthreadLock);
+	MT_lock_destroy(&GDKpoolLock);
 	MT_lock_destroy(&GDKtmLock);
 #ifndef NDEBUG
 	MT_lock_destroy(&mallocsuccesslock);
@@ -1190,6 +1398,22 @@ THRgetdata(int n)
 	return d;
 }
 
+/* the query context is kept per thread, so that the threads of
+ * concurrent queries, also those GDK does not know, each see their own */
+void
+GDKsetqryctx(QryCtx *ctx)
+{
+	MT_thread_setdata(ctx);
+}
+
+int
+GDKinterrupted(void)
+{
+	QryCtx *ctx = (QryCtx *) MT_thread_getdata();
+
+	return ctx != NULL && QRYCTXinterrupted(ctx);
+}
+
 int
 THRgettid(void)
 {
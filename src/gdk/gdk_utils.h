@@ -84,6 +84,14 @@ gdk_export void GDKsetmallocsuccesscount(lng count);
  * takes care of this.
  */
 gdk_export int GDKnr_threads;
+
+/* intra-operator parallelism: operators split inputs of at least two
+ * morsels of GDK_morsel_size rows over GDKmorsels(cnt) threads and run
+ * them with GDKparallel */
+#define GDK_MORSEL_SIZE ((BUN) 1 << 19)
+gdk_export BUN GDK_morsel_size;
+gdk_export int GDKmorsels(BUN cnt);
+gdk_export void GDKparallel(void (*fcn) (void *), void **args, int n);
 #ifndef HAVE_EMBEDDED
 __declspec(noreturn) gdk_export void GDKexit(int status)
 	__attribute__((__noreturn__));
@@ -0,0 +1,579 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0.  If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Copyright 1997 - July 2008 CWI, August 2008 - 2017 MonetDB B.V.
+ */
+
+/*
+ * Zone maps
+ *
+ * A zone map summarizes the tail of a BAT per block of ZONEMAP_BLOCK
+ * consecutive values: for each block it records the smallest and the
+ * largest non-nil value and the number of nils.  A range select only
+ * needs to look at the blocks whose [min, max] overlaps the range,
+ * and a block that lies completely inside the range qualifies without
+ * looking at its values at all.
+ *
+ * Appends only add values at the end, so the zone map is extended on
+ * BATappend and BUNappend; any other update destroys it.  Like the
+ * order index, a zone map of a persistent BAT is written next to the
+ * tail heap (extension "tzonemap") and read back when it is needed.
+ *
+ * The heap starts with ZONEMAPOFF oids: version, number of values
+ * covered, block size and value width.  These are followed by one
+ * record per block holding the minimum and maximum value and, at the
+ * end of the record, the nil count.
+ */
+
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "gdk_private.h"
+
+#define ZONEMAP_VERSION	((oid) 1)
+#define ZONEMAPOFF	4
+
+/* records are aligned for both the values and the nil count */
+#define ZMALIGN(w)	((size_t) (w) > SIZEOF_BUN ? (size_t) (w) : SIZEOF_BUN)
+#define ZMRECSIZE(w)	((2 * (size_t) (w) + SIZEOF_BUN + ZMALIGN(w) - 1) / ZMALIGN(w) * ZMALIGN(w))
+#define ZMrecord(hp, w, i)	((hp)->base + ZONEMAPOFF * SIZEOF_OID + (size_t) (i) * ZMRECSIZE(w))
+#define ZMnils(rec, w)	(* (BUN *) ((rec) + ZMRECSIZE(w) - SIZEOF_BUN))
+
+static int
+ZMtype(int tpe)
+{
+	switch (ATOMbasetype(tpe)) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_flt:
+	case TYPE_dbl:
+		return ATOMtype(tpe) != TYPE_oid;
+	default:
+		return 0;
+	}
+}
+
+#ifdef PERSISTENTIDX
+/* write the zone map heap of b; the version in the file only gets the
+ * "complete" bit after everything else has been written */
+static void
+ZMsync(BAT *b)
+{
+	Heap *hp = b->tzonemap;
+	int fd;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+
+	if (HEAPsave(hp, hp->filename, NULL) != GDK_SUCCEED ||
+	    (fd = GDKfdlocate(hp->farmid, hp->filename, "rb+", NULL)) < 0) {
+		GDKclrerr();	/* not interested in errors */
+		return;
+	}
+	((oid *) hp->base)[0] |= (oid) 1 << 24;
+	if (write(fd, hp->base, SIZEOF_OID) < 0)
+		perror("write zonemap");
+	if (!(GDKdebug & FORCEMITOMASK)) {
+#if defined(NATIVE_WIN32)
+		_commit(fd);
+#elif defined(HAVE_FDATASYNC)
+		fdatasync(fd);
+#elif defined(HAVE_FSYNC)
+		fsync(fd);
+#endif
+	}
+	close(fd);
+	hp->dirty = 0;
+	ALGODEBUG fprintf(stderr, "#ZMsync: persisting zonemap %s (" LLFMT " usec)\n", hp->filename, GDKusec() - t0);
+}
+#endif
+
+/* return TRUE if we have a zone map on the tail, even if we need to
+ * read one from disk */
+int
+BATcheckzonemap(BAT *b)
+{
+	int ret;
+
+	if (b == NULL)
+		return 0;
+	assert(b->batCacheid > 0);
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if (b->tzonemap == (Heap *) 1) {
+		Heap *hp;
+		const char *nme = BBP_physical(b->batCacheid);
+		int fd;
+
+		b->tzonemap = NULL;
+		if ((hp = GDKzalloc(sizeof(*hp))) != NULL &&
+		    (hp->farmid = BBPselectfarm(b->batRole, b->ttype, zonemapheap)) >= 0 &&
+		    (hp->filename = GDKmalloc(strlen(nme) + 10)) != NULL) {
+			sprintf(hp->filename, "%s.tzonemap", nme);
+
+			/* check whether a persisted zone map can be found */
+			if ((fd = GDKfdlocate(hp->farmid, nme, "rb+", "tzonemap")) >= 0) {
+				struct stat st;
+				oid hdata[ZONEMAPOFF];
+
+				if (read(fd, hdata, sizeof(hdata)) == sizeof(hdata) &&
+				    hdata[0] == (((oid) 1 << 24) | ZONEMAP_VERSION) &&
+				    hdata[1] == (oid) BATcount(b) &&
+				    hdata[2] == (oid) ZONEMAP_BLOCK &&
+				    hdata[3] == (oid) b->twidth &&
+				    fstat(fd, &st) == 0 &&
+				    st.st_size >= (off_t) (hp->size = hp->free = ZONEMAPOFF * SIZEOF_OID + (hdata[1] + ZONEMAP_BLOCK - 1) / ZONEMAP_BLOCK * ZMRECSIZE(b->twidth)) &&
+				    HEAPload(hp, nme, "tzonemap", 0) == GDK_SUCCEED) {
+					close(fd);
+					b->tzonemap = hp;
+					ALGODEBUG fprintf(stderr, "#BATcheckzonemap: reusing persisted zonemap %d\n", b->batCacheid);
+					MT_lock_unset(&GDKhashLock(b->batCacheid));
+					return 1;
+				}
+				close(fd);
+				/* unlink unusable file */
+				GDKunlink(hp->farmid, BATDIR, nme, "tzonemap");
+			}
+			GDKfree(hp->filename);
+		}
+		GDKfree(hp);
+		GDKclrerr();	/* we're not currently interested in errors */
+	}
+	ret = b->tzonemap != NULL;
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+	return ret;
+}
+
+#define ZMFOLD(TYPE)							\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
+		while (p < cnt) {					\
+			BUN blk = p / bs;				\
+			BUN end = MIN(cnt, (blk + 1) * bs);		\
+			char *rec = ZMrecord(hp, w, blk);		\
+			TYPE mn, mx;					\
+			BUN nils, nonils;				\
+			if (p == blk * bs) {				\
+				/* first value of a new block */	\
+				mn = mx = TYPE##_nil;			\
+				nils = 0;				\
+			} else {					\
+				mn = ((const TYPE *) rec)[0];		\
+				mx = ((const TYPE *) rec)[1];		\
+				nils = ZMnils(rec, w);			\
+			}						\
+			nonils = p - blk * bs - nils;			\
+			for (; p < end; p++) {				\
+				TYPE v = vals[p];			\
+				if (v == TYPE##_nil) {			\
+					nils++;				\
+				} else if (nonils++ == 0) {		\
+					mn = mx = v;			\
+				} else if (v < mn) {			\
+					mn = v;				\
+				} else if (v > mx) {			\
+					mx = v;				\
+				}					\
+			}						\
+			((TYPE *) rec)[0] = mn;				\
+			((TYPE *) rec)[1] = mx;				\
+			ZMnils(rec, w) = nils;				\
+		}							\
+	} while (0)
+
+/* extend the zone map in hp so that it covers all values of b; the
+ * last block is completed with the values that were added to it */
+static gdk_return
+ZMfold(BAT *b, Heap *hp)
+{
+	BUN p = (BUN) ((const oid *) hp->base)[1];
+	BUN bs = (BUN) ((const oid *) hp->base)[2];
+	BUN cnt = BATcount(b);
+	int w = b->twidth;
+	size_t size = ZONEMAPOFF * SIZEOF_OID + (cnt + bs - 1) / bs * ZMRECSIZE(w);
+
+	assert(p <= cnt);
+	assert(((const oid *) hp->base)[3] == (oid) w);
+	if (size > hp->size &&
+	    HEAPextend(hp, MAX(size, hp->size + hp->size / 2), 0) != GDK_SUCCEED)
+		return GDK_FAIL;
+	switch (ATOMbasetype(b->ttype)) {
+	case TYPE_bte:
+		ZMFOLD(bte);
+		break;
+	case TYPE_sht:
+		ZMFOLD(sht);
+		break;
+	case TYPE_int:
+		ZMFOLD(int);
+		break;
+	case TYPE_lng:
+		ZMFOLD(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		ZMFOLD(hge);
+		break;
+#endif
+	case TYPE_flt:
+		ZMFOLD(flt);
+		break;
+	case TYPE_dbl:
+		ZMFOLD(dbl);
+		break;
+	default:
+		assert(0);
+		return GDK_FAIL;
+	}
+	/* the heap no longer matches what may be on disk */
+	((oid *) hp->base)[0] = ZONEMAP_VERSION;
+	((oid *) hp->base)[1] = (oid) cnt;
+	hp->free = size;
+	hp->dirty = 1;
+	return GDK_SUCCEED;
+}
+
+gdk_return
+BATzonemap(BAT *b)
+{
+	Heap *hp;
+	const char *nme;
+	size_t nmelen;
+	lng t0 = 0;
+
+	BATcheck(b, "BATzonemap", GDK_FAIL);
+	if (!ZMtype(b->ttype)) {
+		GDKerror("BATzonemap: unsupported type\n");
+		return GDK_FAIL;
+	}
+	if (VIEWtparent(b)) {
+		/* views use the zone map of their parent */
+		b = BBPdescriptor(VIEWtparent(b));
+		assert(b);
+	}
+	if (BATcheckzonemap(b))
+		return GDK_SUCCEED;
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if (b->tzonemap == NULL) {
+		ALGODEBUG t0 = GDKusec();
+		nme = GDKinmemory() ? ":inmemory" : BBP_physical(b->batCacheid);
+		nmelen = strlen(nme) + 10;
+		if ((hp = GDKzalloc(sizeof(Heap))) == NULL ||
+		    (hp->farmid = BBPselectfarm(b->batRole, b->ttype, zonemapheap)) < 0 ||
+		    (hp->filename = GDKmalloc(nmelen)) == NULL ||
+		    snprintf(hp->filename, nmelen, "%s.tzonemap", nme) < 0 ||
+		    HEAPalloc(hp, ZONEMAPOFF * SIZEOF_OID + (BATcount(b) / ZONEMAP_BLOCK + 1) * ZMRECSIZE(b->twidth), 1) != GDK_SUCCEED) {
+			if (hp)
+				GDKfree(hp->filename);
+			GDKfree(hp);
+			MT_lock_unset(&GDKhashLock(b->batCacheid));
+			return GDK_FAIL;
+		}
+		((oid *) hp->base)[0] = ZONEMAP_VERSION;
+		((oid *) hp->base)[1] = 0;
+		((oid *) hp->base)[2] = (oid) ZONEMAP_BLOCK;
+		((oid *) hp->base)[3] = (oid) b->twidth;
+		hp->free = ZONEMAPOFF * SIZEOF_OID;
+		if (ZMfold(b, hp) != GDK_SUCCEED) {
+			HEAPfree(hp, 1);
+			GDKfree(hp);
+			MT_lock_unset(&GDKhashLock(b->batCacheid));
+			return GDK_FAIL;
+		}
+		b->tzonemap = hp;
+		b->batDirtydesc = 1;
+		ALGODEBUG fprintf(stderr, "#BATzonemap(b=%s#" BUNFMT "): "
+				  "created zonemap (" LLFMT " usec)\n",
+				  BATgetId(b), BATcount(b), GDKusec() - t0);
+#ifdef PERSISTENTIDX
+		if (!GDKinmemory() &&
+		    (BBP_status(b->batCacheid) & BBPEXISTING) &&
+		    b->batInserted == b->batCount)
+			ZMsync(b);
+#endif
+	}
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+	return GDK_SUCCEED;
+}
+
+/* extend the zone map of b, if it has one, to cover the values that
+ * were just appended to b */
+void
+ZMappend(BAT *b)
+{
+	Heap *hp;
+
+	if (b->tzonemap == NULL)
+		return;
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if ((hp = b->tzonemap) != NULL && hp != (Heap *) 1 &&
+	    (BUN) ((const oid *) hp->base)[1] <= BATcount(b) &&
+	    ZMfold(b, hp) == GDK_SUCCEED) {
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+		return;
+	}
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+	/* the zone map can't be maintained (e.g. because it wasn't
+	 * loaded before the append), so get rid of it */
+	ZMdestroy(b);
+	GDKclrerr();
+}
+
+/* write a changed zone map to disk; called when b itself is saved, so
+ * that the zone map on disk covers the same values as the tail */
+void
+ZMpersist(BAT *b)
+{
+#ifdef PERSISTENTIDX
+	Heap *hp;
+
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if ((hp = b->tzonemap) != NULL && hp != (Heap *) 1 && hp->dirty &&
+	    (BUN) ((const oid *) hp->base)[1] == BATcount(b))
+		ZMsync(b);
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+#else
+	(void) b;
+#endif
+}
+
+static BUN
+ZMaddrange(BUN *ranges, BUN n, BUN first, BUN last, int full)
+{
+	if (n > 0 && ranges[3 * n - 2] == first &&
+	    ranges[3 * n - 1] == (BUN) full) {
+		/* adjacent to previous range of the same kind */
+		ranges[3 * n - 2] = last;
+		return n;
+	}
+	ranges[3 * n] = first;
+	ranges[3 * n + 1] = last;
+	ranges[3 * n + 2] = (BUN) full;
+	return n + 1;
+}
+
+#define ZMPRUNE(TYPE)							\
+	do {								\
+		const TYPE lo = * (const TYPE *) tl;			\
+		const TYPE hi = * (const TYPE *) th;			\
+		for (; blk < lblk; blk++) {				\
+			const char *rec = ZMrecord(hp, w, blk);		\
+			BUN nils = ZMnils(rec, w);			\
+			BUN rows = MIN(bs, pcnt - blk * bs);		\
+			BUN first = MAX(blk * bs, off) - off;		\
+			BUN last = MIN((blk + 1) * bs, off + cnt) - off; \
+			int full;					\
+			if (lo == TYPE##_nil) {				\
+				/* looking for nils */			\
+				if (nils == 0)				\
+					continue;			\
+				full = nils == rows;			\
+			} else {					\
+				if (nils == rows ||			\
+				    ((const TYPE *) rec)[0] > hi ||	\
+				    ((const TYPE *) rec)[1] < lo)	\
+					continue;			\
+				full = nils == 0 &&			\
+					((const TYPE *) rec)[0] >= lo && \
+					((const TYPE *) rec)[1] <= hi;	\
+			}						\
+			n = ZMaddrange(rs, n, first, last, full);	\
+			if (!full)					\
+				scan += last - first;			\
+		}							\
+	} while (0)
+
+/* Find the parts of b that may contain values in the closed range
+ * [*tl, *th], or nils if *tl is nil.  The parts are returned in
+ * *ranges as three BUNs each: the first and the last (exclusive)
+ * position in b, and whether all values in the part qualify.  The
+ * return value is the number of parts, or BUN_NONE if b has no usable
+ * zone map or if the zone map does not exclude enough of b to make it
+ * worth our while. */
+BUN
+ZMprune(BAT *b, const void *tl, const void *th, BUN **ranges)
+{
+	BAT *pb = b;
+	Heap *hp;
+	BUN off = 0, cnt = BATcount(b), pcnt, bs, blk, lblk;
+	BUN n = 0, scan = 0, *rs;
+	int w = b->twidth;
+
+	*ranges = NULL;
+	if (!ZMtype(b->ttype) || cnt == 0)
+		return BUN_NONE;
+	if (VIEWtparent(b)) {
+		pb = BBPdescriptor(VIEWtparent(b));
+		off = (BUN) ((Tloc(b, 0) - Tloc(pb, 0)) >> b->tshift);
+	}
+	if (!BATcheckzonemap(pb))
+		return BUN_NONE;
+	MT_lock_set(&GDKhashLock(pb->batCacheid));
+	hp = pb->tzonemap;
+	if (hp == NULL || hp == (Heap *) 1 ||
+	    (pcnt = (BUN) ((const oid *) hp->base)[1]) != BATcount(pb) ||
+	    off + cnt > pcnt) {
+		MT_lock_unset(&GDKhashLock(pb->batCacheid));
+		return BUN_NONE;
+	}
+	bs = (BUN) ((const oid *) hp->base)[2];
+	blk = off / bs;
+	lblk = (off + cnt - 1) / bs + 1;
+	if ((rs = GDKmalloc(3 * (lblk - blk) * sizeof(BUN))) == NULL) {
+		MT_lock_unset(&GDKhashLock(pb->batCacheid));
+		GDKclrerr();
+		return BUN_NONE;
+	}
+	switch (ATOMbasetype(b->ttype)) {
+	case TYPE_bte:
+		ZMPRUNE(bte);
+		break;
+	case TYPE_sht:
+		ZMPRUNE(sht);
+		break;
+	case TYPE_int:
+		ZMPRUNE(int);
+		break;
+	case TYPE_lng:
+		ZMPRUNE(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		ZMPRUNE(hge);
+		break;
+#endif
+	case TYPE_flt:
+		ZMPRUNE(flt);
+		break;
+	case TYPE_dbl:
+		ZMPRUNE(dbl);
+		break;
+	default:
+		assert(0);
+	}
+	MT_lock_unset(&GDKhashLock(pb->batCacheid));
+	if (scan > cnt / 2) {
+		/* a plain (parallel) scan will do better */
+		GDKfree(rs);
+		return BUN_NONE;
+	}
+	*ranges = rs;
+	return n;
+}
+
+#define ZMMINMAX(TYPE)							\
+	do {								\
+		const TYPE *best = NULL, *v;				\
+		for (i = 0; i < nblocks; i++) {				\
+			const char *rec = ZMrecord(hp, w, i);		\
+			if (ZMnils(rec, w) == MIN(bs, cnt - i * bs))	\
+				continue; /* only nils */		\
+			v = (const TYPE *) rec + (max != 0);		\
+			if (best == NULL || (max ? *v > *best : *v < *best)) \
+				best = v;				\
+		}							\
+		* (TYPE *) res = best ? *best : TYPE##_nil;		\
+	} while (0)
+
+/* Store the smallest (max == 0) or largest (max != 0) non-nil value
+ * of b, or nil if there is none, in res.  Returns 0 if b has no zone
+ * map that covers all of it. */
+int
+ZMminmax(BAT *b, int max, void *res)
+{
+	Heap *hp;
+	BUN cnt, bs, nblocks, i;
+	int w = b->twidth;
+	int ret = 0;
+
+	if (!ZMtype(b->ttype))
+		return 0;
+	if (VIEWtparent(b)) {
+		BAT *pb = BBPdescriptor(VIEWtparent(b));
+		if (Tloc(b, 0) != Tloc(pb, 0) || BATcount(b) != BATcount(pb))
+			return 0;
+		b = pb;
+	}
+	if (!BATcheckzonemap(b))
+		return 0;
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if ((hp = b->tzonemap) != NULL && hp != (Heap *) 1 &&
+	    (cnt = (BUN) ((const oid *) hp->base)[1]) == BATcount(b)) {
+		bs = (BUN) ((const oid *) hp->base)[2];
+		nblocks = (cnt + bs - 1) / bs;
+		ret = 1;
+		switch (ATOMbasetype(b->ttype)) {
+		case TYPE_bte:
+			ZMMINMAX(bte);
+			break;
+		case TYPE_sht:
+			ZMMINMAX(sht);
+			break;
+		case TYPE_int:
+			ZMMINMAX(int);
+			break;
+		case TYPE_lng:
+			ZMMINMAX(lng);
+			break;
+#ifdef HAVE_HGE
+		case TYPE_hge:
+			ZMMINMAX(hge);
+			break;
+#endif
+		case TYPE_flt:
+			ZMMINMAX(flt);
+			break;
+		case TYPE_dbl:
+			ZMMINMAX(dbl);
+			break;
+		default:
+			assert(0);
+			ret = 0;
+		}
+	}
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+	return ret;
+}
+
+void
+ZMfree(BAT *b)
+{
+	if (b) {
+		Heap *hp;
+
+		MT_lock_set(&GDKhashLock(b->batCacheid));
+		if ((hp = b->tzonemap) != NULL && hp != (Heap *) 1) {
+			b->tzonemap = (Heap *) 1;
+			HEAPfree(hp, 0);
+			GDKfree(hp);
+		}
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+	}
+}
+
+void
+ZMdestroy(BAT *b)
+{
+	if (b) {
+		Heap *hp;
+
+		MT_lock_set(&GDKhashLock(b->batCacheid));
+		hp = b->tzonemap;
+		b->tzonemap = NULL;
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+		if (hp == (Heap *) 1) {
+			GDKunlink(BBPselectfarm(b->batRole, b->ttype, zonemapheap),
+				  BATDIR,
+				  BBP_physical(b->batCacheid),
+				  "tzonemap");
+		} else if (hp != NULL) {
+			HEAPdelete(hp, BBP_physical(b->batCacheid), "tzonemap");
+			GDKfree(hp);
+		}
+	}
+}
@@ -235,6 +235,8 @@ MCinitClientRecord(Client c, oid user, bstream *fin, stream *fout)
 	c->session = GDKusec();
 	c->qtimeout = 0;
 	c->stimeout = 0;
+	c->qryctx.interrupted = 0;
+	c->qryctx.deadline = 0;
 	c->stage = 0;
 	c->itrace = 0;
 	c->flags = 0;
@@ -393,6 +395,8 @@ freeClient(Client c)
 	//c->active = 0;
 	c->qtimeout = 0;
 	c->stimeout = 0;
+	c->qryctx.interrupted = 0;
+	c->qryctx.deadline = 0;
 	c->user = oid_nil;
 	if( c->username){
 		GDKfree(c->username);
@@ -378,8 +378,11 @@ DFLOWworker(void *T)
 		flow = fe->flow;
 		assert(flow);
 
-		/* whenever we have a (concurrent) error, skip it */
+		/* whenever we have a (concurrent) error, skip it, an
+		 * interrupted query is not worth dispatching any further */
 		MT_lock_set(&flow->flowlock);
+		if (!flow->error && QRYCTXinterrupted(&flow->cntxt->qryctx))
+			flow->error = createException(MAL, "mal.interpreter", flow->cntxt->qryctx.interrupted ? RUNTIME_QRY_INTERRUPT : RUNTIME_QRY_TIMEOUT);
 		if (flow->error) {
 			MT_lock_unset(&flow->flowlock);
 			q_enqueue(flow->done, fe);
@@ -401,6 +404,7 @@ DFLOWworker(void *T)
 			}
 		}
 #endif
+		GDKsetqryctx(&flow->cntxt->qryctx);
 		error = runMALsequence(flow->cntxt, flow->mb, fe->pc, fe->pc + 1, flow->stk, 0, 0);
 		PARDEBUG fprintf(stderr, "#executed pc= %d wrk= %d claim= " LLFMT "," LLFMT "," LLFMT " %s\n",
 						 fe->pc, id, fe->argclaim, fe->hotclaim, fe->maxclaim, error ? error : "");
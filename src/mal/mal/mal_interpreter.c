@@ -358,7 +358,7 @@ str runMAL(Client cntxt, MalBlkPtr mb, MalBlkPtr mbcaller, MalStkPtr env)
 		garbageCollector(cntxt, mb, stk, env != stk);
 	if (stk && stk != env)
 		freeStack(stk);
-	if (cntxt->qtimeout && GDKusec()- mb->starttime > cntxt->qtimeout)
+	if (QRYCTXtimedout(&cntxt->qryctx))
 		throw(MAL, "mal.interpreter", RUNTIME_QRY_TIMEOUT);
 	return ret;
 }
@@ -447,7 +447,7 @@ callMAL(Client cntxt, MalBlkPtr mb, MalStkPtr *env, ValPtr argv[], char debug)
 	default:
 		throw(MAL, "mal.interpreter", RUNTIME_UNKNOWN_INSTRUCTION);
 	}
-	if ( ret == MAL_SUCCEED && cntxt->qtimeout && GDKusec()- mb->starttime > cntxt->qtimeout)
+	if ( ret == MAL_SUCCEED && QRYCTXtimedout(&cntxt->qryctx))
 		throw(MAL, "mal.interpreter", RUNTIME_QRY_TIMEOUT);
 	if (stk) 
 		garbageCollector(cntxt, mb, stk, TRUE);
@@ -520,6 +520,7 @@ str runMALsequence(Client cntxt, MalBlkPtr mb, int startpc,
 		runtimeProfileInit(cntxt, mb, stk);
 		runtimeProfileBegin(cntxt, mb, stk, getInstrPtr(mb,0), &runtimeProfileFunction);
 		mb->starttime = GDKusec();
+		GDKsetqryctx(&cntxt->qryctx);
 		if (cntxt->stimeout && cntxt->session && GDKusec()- cntxt->session > cntxt->stimeout) {
 			if ( backup != backups) GDKfree(backup);
 			if ( garbage != garbages) GDKfree(garbage);
@@ -748,7 +749,7 @@ str runMALsequence(Client cntxt, MalBlkPtr mb, int startpc,
 			runtimeProfileExit(cntxt, mb, stk, getInstrPtr(mb,0), &runtimeProfileFunction);
 			if (pcicaller && garbageControl(getInstrPtr(mb, 0)))
 				garbageCollector(cntxt, mb, stk, TRUE);
-			if (cntxt->qtimeout && GDKusec()- mb->starttime > cntxt->qtimeout){
+			if (QRYCTXtimedout(&cntxt->qryctx)){
 				ret= createException(MAL, "mal.interpreter", RUNTIME_QRY_TIMEOUT);
 				break;
 			}
@@ -763,7 +764,7 @@ str runMALsequence(Client cntxt, MalBlkPtr mb, int startpc,
 			w= instruction2str(mb, 0, pci, FALSE);
 			ret = createScriptException(mb, stkpc, MAL, NULL, "unkown operation:%s",w);
 			GDKfree(w);
-			if (cntxt->qtimeout && GDKusec()- mb->starttime > cntxt->qtimeout){
+			if (QRYCTXtimedout(&cntxt->qryctx)){
 				ret= createException(MAL, "mal.interpreter", RUNTIME_QRY_TIMEOUT);
 				break;
 			}
@@ -881,7 +882,7 @@ str runMALsequence(Client cntxt, MalBlkPtr mb, int startpc,
 
 			/* unknown exceptions lead to propagation */
 			if (exceptionVar == -1) {
-				if (cntxt->qtimeout && GDKusec()- mb->starttime > cntxt->qtimeout)
+				if (QRYCTXtimedout(&cntxt->qryctx))
 					ret= createException(MAL, "mal.interpreter", RUNTIME_QRY_TIMEOUT);
 				stkpc = mb->stop;
 				continue;
@@ -929,7 +930,7 @@ str runMALsequence(Client cntxt, MalBlkPtr mb, int startpc,
 				}
 			}
 			if (stkpc == mb->stop) {
-				if (cntxt->qtimeout && GDKusec()- mb->starttime > cntxt->qtimeout){
+				if (QRYCTXtimedout(&cntxt->qryctx)){
 					ret= createException(MAL, "mal.interpreter", RUNTIME_QRY_TIMEOUT);
 					stkpc = mb->stop;
 				}
@@ -1155,9 +1156,9 @@ str runMALsequence(Client cntxt, MalBlkPtr mb, int startpc,
 		default:
 			stkpc++;
 		}
-		if (cntxt->qtimeout && GDKusec()- mb->starttime > cntxt->qtimeout){
+		if (QRYCTXinterrupted(&cntxt->qryctx)){
 			if (ret == MAL_SUCCEED)
-				ret= createException(MAL, "mal.interpreter", RUNTIME_QRY_TIMEOUT);
+				ret= createException(MAL, "mal.interpreter", cntxt->qryctx.interrupted ? RUNTIME_QRY_INTERRUPT : RUNTIME_QRY_TIMEOUT);
 			stkpc= mb->stop;
 		}
 	}
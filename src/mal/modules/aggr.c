@@ -475,6 +475,60 @@ AGGRsubsumcand_dbl(bat *retval, const bat *bid, const bat *gid, const bat *eid,
 					   NULL, NULL, "aggr.subsum");
 }
 
+static str
+AGGRsumpartials_internal(bat *retval1, bat *retval2, const bat *bid, const bat *gid, const bat *eid, oid off, int skip_nils, const char *malfunc)
+{
+	BAT *b, *g, *e, *bn, *gn;
+	gdk_return rc;
+
+	b = BATdescriptor(*bid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (b == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	rc = BATgroupsumpartials(&bn, retval2 ? &gn : NULL, b, g, e, NULL, off, skip_nils);
+	BBPunfix(b->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (rc != GDK_SUCCEED)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	*retval1 = bn->batCacheid;
+	BBPkeepref(bn->batCacheid);
+	if (retval2) {
+		*retval2 = gn->batCacheid;
+		BBPkeepref(gn->batCacheid);
+	}
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRsumpartials(bat *retval, const bat *bid);
+str
+AGGRsumpartials(bat *retval, const bat *bid)
+{
+	return AGGRsumpartials_internal(retval, NULL, bid, NULL, NULL, 0, 1,
+									"aggr.sumpartials");
+}
+
+mal_export str AGGRsubsumpartials(bat *retval1, bat *retval2, const bat *bid, const bat *gid, const bat *eid, const lng *off, const bit *skip_nils);
+str
+AGGRsubsumpartials(bat *retval1, bat *retval2, const bat *bid, const bat *gid, const bat *eid, const lng *off, const bit *skip_nils)
+{
+	if (*off == lng_nil || *off < 0)
+		throw(MAL, "aggr.subsumpartials", ILLEGAL_ARGUMENT);
+	return AGGRsumpartials_internal(retval1, retval2, bid, gid, eid,
+									(oid) *off, *skip_nils,
+									"aggr.subsumpartials");
+}
+
 mal_export str AGGRsubprod_bte(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
 str
 AGGRsubprod_bte(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
@@ -871,3 +925,304 @@ AGGRsubquantilecand(bat *retval, const bat *bid, const bat *quantile, const bat
 					   0, TYPE_any, NULL, NULL, BATgroupquantile,
 					   quantile, "aggr.subquantile");
 }
+
+static str
+AGGRapprox_quantile_internal(BAT **bnp, const bat *bid, const bat *wid, const bat *quantile, const bat *gid, const bat *eid, int skip_nils, const char *malfunc)
+{
+	BAT *b, *w, *g, *e, *q, *bn;
+	double qvalue;
+
+	b = BATdescriptor(*bid);
+	w = wid ? BATdescriptor(*wid) : NULL;
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	q = BATdescriptor(*quantile);
+	if (b == NULL || q == NULL ||
+		(wid != NULL && w == NULL) ||
+		(gid != NULL && g == NULL) ||
+		(eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (w)
+			BBPunfix(w->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		if (q)
+			BBPunfix(q->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	assert(q->ttype == TYPE_dbl);
+	qvalue = BATcount(q) == 0 ? 0.5 : ((const dbl *) Tloc(q, 0))[0];
+	BBPunfix(q->batCacheid);
+	if (qvalue < 0 || qvalue > 1)
+		bn = NULL;
+	else
+		bn = BATgroupapproxquantile(b, w, g, e, NULL, qvalue, skip_nils);
+	BBPunfix(b->batCacheid);
+	if (w)
+		BBPunfix(w->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (qvalue < 0 || qvalue > 1)
+		throw(MAL, malfunc,
+			  "quantile value of %f is not in range [0,1]", qvalue);
+	if (bn == NULL)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	*bnp = bn;
+	return MAL_SUCCEED;
+}
+
+static str
+AGGRapprox_quantile_scalar(dbl *retval, const bat *bid, const bat *wid, const bat *quantile, const char *malfunc)
+{
+	BAT *bn;
+	str msg;
+
+	if ((msg = AGGRapprox_quantile_internal(&bn, bid, wid, quantile, NULL, NULL, 1, malfunc)) != MAL_SUCCEED)
+		return msg;
+	*retval = ((const dbl *) Tloc(bn, 0))[0];
+	BBPunfix(bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+static str
+AGGRapprox_quantile_grouped(bat *retval, const bat *bid, const bat *wid, const bat *quantile, const bat *gid, const bat *eid, int skip_nils, const char *malfunc)
+{
+	BAT *bn;
+	str msg;
+
+	if ((msg = AGGRapprox_quantile_internal(&bn, bid, wid, quantile, gid, eid, skip_nils, malfunc)) != MAL_SUCCEED)
+		return msg;
+	*retval = bn->batCacheid;
+	BBPkeepref(bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRapprox_quantile(dbl *retval, const bat *bid, const bat *quantile);
+str
+AGGRapprox_quantile(dbl *retval, const bat *bid, const bat *quantile)
+{
+	return AGGRapprox_quantile_scalar(retval, bid, NULL, quantile,
+									  "aggr.approx_quantile");
+}
+
+mal_export str AGGRapprox_quantile_merge(dbl *retval, const bat *mid, const bat *wid, const bat *quantile);
+str
+AGGRapprox_quantile_merge(dbl *retval, const bat *mid, const bat *wid, const bat *quantile)
+{
+	return AGGRapprox_quantile_scalar(retval, mid, wid, quantile,
+									  "aggr.approx_quantile");
+}
+
+mal_export str AGGRsubapprox_quantile(bat *retval, const bat *bid, const bat *quantile, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubapprox_quantile(bat *retval, const bat *bid, const bat *quantile, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRapprox_quantile_grouped(retval, bid, NULL, quantile, gid, eid,
+									   *skip_nils, "aggr.subapprox_quantile");
+}
+
+mal_export str AGGRsubapprox_quantile_merge(bat *retval, const bat *mid, const bat *wid, const bat *quantile, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubapprox_quantile_merge(bat *retval, const bat *mid, const bat *wid, const bat *quantile, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRapprox_quantile_grouped(retval, mid, wid, quantile, gid, eid,
+									   *skip_nils, "aggr.subapprox_quantile");
+}
+
+static str
+AGGRquantilesketch_internal(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bat *gid, const bat *eid, oid off, int skip_nils, const char *malfunc)
+{
+	BAT *b, *g, *e, *mn, *wn, *gn;
+	gdk_return rc;
+
+	b = BATdescriptor(*bid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (b == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	rc = BATgroupquantilesketch(&mn, &wn, retval3 ? &gn : NULL, b, g, e, NULL, off, skip_nils);
+	BBPunfix(b->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (rc != GDK_SUCCEED)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	*retval1 = mn->batCacheid;
+	BBPkeepref(mn->batCacheid);
+	*retval2 = wn->batCacheid;
+	BBPkeepref(wn->batCacheid);
+	if (retval3) {
+		*retval3 = gn->batCacheid;
+		BBPkeepref(gn->batCacheid);
+	}
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRquantilesketch(bat *retval1, bat *retval2, const bat *bid);
+str
+AGGRquantilesketch(bat *retval1, bat *retval2, const bat *bid)
+{
+	return AGGRquantilesketch_internal(retval1, retval2, NULL, bid, NULL, NULL,
+									   0, 1, "aggr.quantilesketch");
+}
+
+mal_export str AGGRsubquantilesketch(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bat *gid, const bat *eid, const lng *off, const bit *skip_nils);
+str
+AGGRsubquantilesketch(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bat *gid, const bat *eid, const lng *off, const bit *skip_nils)
+{
+	if (*off == lng_nil || *off < 0)
+		throw(MAL, "aggr.subquantilesketch", ILLEGAL_ARGUMENT);
+	return AGGRquantilesketch_internal(retval1, retval2, retval3, bid, gid, eid,
+									   (oid) *off, *skip_nils,
+									   "aggr.subquantilesketch");
+}
+
+static str
+AGGRapprox_count_distinct_internal(BAT **bnp, const bat *bid, const bat *gid, const bat *eid, int merge, const char *malfunc)
+{
+	BAT *b, *g, *e, *bn;
+
+	b = BATdescriptor(*bid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (b == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	if (merge)
+		bn = BATgroupcountdistinctmerge(b, g, e);
+	else
+		bn = BATgroupapproxcountdistinct(b, g, e, NULL);
+	BBPunfix(b->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (bn == NULL)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	*bnp = bn;
+	return MAL_SUCCEED;
+}
+
+static str
+AGGRapprox_count_distinct_scalar(lng *retval, const bat *bid, int merge, const char *malfunc)
+{
+	BAT *bn;
+	str msg;
+
+	if ((msg = AGGRapprox_count_distinct_internal(&bn, bid, NULL, NULL, merge, malfunc)) != MAL_SUCCEED)
+		return msg;
+	*retval = ((const lng *) Tloc(bn, 0))[0];
+	BBPunfix(bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+static str
+AGGRapprox_count_distinct_grouped(bat *retval, const bat *bid, const bat *gid, const bat *eid, int merge, const char *malfunc)
+{
+	BAT *bn;
+	str msg;
+
+	if ((msg = AGGRapprox_count_distinct_internal(&bn, bid, gid, eid, merge, malfunc)) != MAL_SUCCEED)
+		return msg;
+	*retval = bn->batCacheid;
+	BBPkeepref(bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRapprox_count_distinct(lng *retval, const bat *bid);
+str
+AGGRapprox_count_distinct(lng *retval, const bat *bid)
+{
+	return AGGRapprox_count_distinct_scalar(retval, bid, 0,
+											"aggr.approx_count_distinct");
+}
+
+mal_export str AGGRsubapprox_count_distinct(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubapprox_count_distinct(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	(void) skip_nils;			/* nils are never counted */
+	return AGGRapprox_count_distinct_grouped(retval, bid, gid, eid, 0,
+											 "aggr.subapprox_count_distinct");
+}
+
+mal_export str AGGRcountdistinctmerge(lng *retval, const bat *rid);
+str
+AGGRcountdistinctmerge(lng *retval, const bat *rid)
+{
+	return AGGRapprox_count_distinct_scalar(retval, rid, 1,
+											"aggr.countdistinctmerge");
+}
+
+mal_export str AGGRsubcountdistinctmerge(bat *retval, const bat *rid, const bat *gid, const bat *eid);
+str
+AGGRsubcountdistinctmerge(bat *retval, const bat *rid, const bat *gid, const bat *eid)
+{
+	return AGGRapprox_count_distinct_grouped(retval, rid, gid, eid, 1,
+											 "aggr.subcountdistinctmerge");
+}
+
+static str
+AGGRcountdistinctsketch_internal(bat *retval, const bat *bid, const bat *gid, const bat *eid, const char *malfunc)
+{
+	BAT *b, *g, *e, *bn;
+
+	b = BATdescriptor(*bid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (b == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	bn = BATgroupcountdistinctsketch(b, g, e, NULL);
+	BBPunfix(b->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (bn == NULL)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	*retval = bn->batCacheid;
+	BBPkeepref(bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRcountdistinctsketch(bat *retval, const bat *bid);
+str
+AGGRcountdistinctsketch(bat *retval, const bat *bid)
+{
+	return AGGRcountdistinctsketch_internal(retval, bid, NULL, NULL,
+											"aggr.countdistinctsketch");
+}
+
+mal_export str AGGRsubcountdistinctsketch(bat *retval, const bat *bid, const bat *gid, const bat *eid);
+str
+AGGRsubcountdistinctsketch(bat *retval, const bat *bid, const bat *gid, const bat *eid)
+{
+	return AGGRcountdistinctsketch_internal(retval, bid, gid, eid,
+											"aggr.subcountdistinctsketch");
+}
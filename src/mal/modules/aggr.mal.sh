@@ -93,6 +93,20 @@ EOF
     done
 done
 
+# partial sums that can be merged exactly (used by mergetable)
+for tp in flt dbl; do
+    cat <<EOF
+command sumpartials(b:bat[:${tp}]) :bat[:dbl]
+address AGGRsumpartials
+comment "Partial sums of b that add up exactly to its sum";
+
+command subsumpartials(b:bat[:${tp}],g:bat[:oid],e:bat[:any_1],off:lng,skip_nils:bit) (:bat[:dbl],:bat[:oid])
+address AGGRsubsumpartials
+comment "Grouped partial sums that add up exactly to the sum of each group, with the group id plus off of each partial sum";
+
+EOF
+done
+
 # We may have to extend the signatures to all possible {void,oid} combos
 for tp in bte sht int lng flt dbl; do
     cat <<EOF
@@ -258,4 +272,52 @@ command subquantile(b:bat[:any_1],q:bat[:dbl],g:bat[:oid],e:bat[:any_2],s:bat[:o
 address AGGRsubquantilecand
 comment "Grouped median quantile with candidate list";
 
+command approx_quantile(b:bat[:any_1],q:bat[:dbl]) :dbl
+address AGGRapprox_quantile
+comment "Approximate quantile aggregate, estimated with a t-digest";
+
+command approx_quantile(m:bat[:dbl],w:bat[:dbl],q:bat[:dbl]) :dbl
+address AGGRapprox_quantile_merge
+comment "Approximate quantile of the combined t-digests with centroid means m and weights w";
+
+command subapprox_quantile(b:bat[:any_1],q:bat[:dbl],g:bat[:oid],e:bat[:any_2],skip_nils:bit) :bat[:dbl]
+address AGGRsubapprox_quantile
+comment "Grouped approximate quantile aggregate, estimated with a t-digest";
+
+command subapprox_quantile(m:bat[:dbl],w:bat[:dbl],q:bat[:dbl],g:bat[:oid],e:bat[:any_2],skip_nils:bit) :bat[:dbl]
+address AGGRsubapprox_quantile_merge
+comment "Grouped approximate quantile of the combined t-digests with centroid means m and weights w";
+
+command quantilesketch(b:bat[:any_1]) (:bat[:dbl],:bat[:dbl])
+address AGGRquantilesketch
+comment "The t-digest of b for approx_quantile, as the means and weights of its centroids";
+
+command subquantilesketch(b:bat[:any_1],g:bat[:oid],e:bat[:any_2],off:lng,skip_nils:bit) (:bat[:dbl],:bat[:dbl],:bat[:oid])
+address AGGRsubquantilesketch
+comment "The t-digest of each group of b for subapprox_quantile, as the means and weights of their centroids, with the group id plus off of each centroid";
+
+command approx_count_distinct(b:bat[:any_1]) :lng
+address AGGRapprox_count_distinct
+comment "Approximate number of distinct values (not counting nil), estimated with a HyperLogLog sketch";
+
+command subapprox_count_distinct(b:bat[:any_1],g:bat[:oid],e:bat[:any_2],skip_nils:bit) :bat[:lng]
+address AGGRsubapprox_count_distinct
+comment "Grouped approximate number of distinct values (not counting nil), estimated with a HyperLogLog sketch";
+
+command countdistinctsketch(b:bat[:any_1]) :bat[:bte]
+address AGGRcountdistinctsketch
+comment "The HyperLogLog sketch of b for countdistinctmerge";
+
+command subcountdistinctsketch(b:bat[:any_1],g:bat[:oid],e:bat[:any_2]) :bat[:bte]
+address AGGRsubcountdistinctsketch
+comment "The HyperLogLog sketch of each group of b for subcountdistinctmerge, in group order";
+
+command countdistinctmerge(r:bat[:bte]) :lng
+address AGGRcountdistinctmerge
+comment "Approximate number of distinct values of the combined HyperLogLog sketches r";
+
+command subcountdistinctmerge(r:bat[:bte],g:bat[:oid],e:bat[:any_2]) :bat[:lng]
+address AGGRsubcountdistinctmerge
+comment "Grouped approximate number of distinct values of the combined HyperLogLog sketches r, where sketch i belongs to group g[i]";
+
 EOF
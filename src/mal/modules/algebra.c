@@ -511,6 +511,105 @@ ALGintersect(bat *r1, const bat *lid, const bat *rid, const bat *slid, const bat
 				   BATsemijoin, NULL, NULL, NULL, NULL, "algebra.difference");
 }
 
+str
+ALGjoinfilter(bat *result, const bat *lid, const bat *rid, const bat *slid, const bat *srid,
+			  const bit *nil_matches)
+{
+	BAT *l, *r, *sl = NULL, *sr = NULL, *bn;
+
+	if ((l = BATdescriptor(*lid)) == NULL)
+		throw(MAL, "algebra.joinfilter", RUNTIME_OBJECT_MISSING);
+	if ((r = BATdescriptor(*rid)) == NULL) {
+		BBPunfix(l->batCacheid);
+		throw(MAL, "algebra.joinfilter", RUNTIME_OBJECT_MISSING);
+	}
+	if ((slid && *slid != bat_nil && (sl = BATdescriptor(*slid)) == NULL) ||
+		(srid && *srid != bat_nil && (sr = BATdescriptor(*srid)) == NULL)) {
+		BBPunfix(l->batCacheid);
+		BBPunfix(r->batCacheid);
+		if (sl)
+			BBPunfix(sl->batCacheid);
+		throw(MAL, "algebra.joinfilter", RUNTIME_OBJECT_MISSING);
+	}
+	bn = BATjoinfilter(l, r, sl, sr, *nil_matches);
+	BBPunfix(l->batCacheid);
+	BBPunfix(r->batCacheid);
+	if (sl)
+		BBPunfix(sl->batCacheid);
+	if (sr)
+		BBPunfix(sr->batCacheid);
+	if (bn == NULL)
+		throw(MAL, "algebra.joinfilter", GDK_EXCEPTION);
+	*result = bn->batCacheid;
+	BBPkeepref(*result);
+	return MAL_SUCCEED;
+}
+
+/* algebra.joinfilterbuild(r, sr, l...): the filter pays off depending
+ * on the size of all l that it will be probed with */
+str
+ALGjoinfilterbuild(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	bat *result = getArgReference_bat(stk, pci, 0);
+	bat rid = *getArgReference_bat(stk, pci, 1);
+	bat srid = *getArgReference_bat(stk, pci, 2);
+	BAT *r, *sr = NULL, *b, *bn;
+	BUN lcnt = 0;
+	int i;
+
+	(void) cntxt;
+	(void) mb;
+	for (i = 3; i < pci->argc; i++) {
+		if ((b = BBPquickdesc(*getArgReference_bat(stk, pci, i), FALSE)) == NULL)
+			throw(MAL, "algebra.joinfilterbuild", RUNTIME_OBJECT_MISSING);
+		lcnt += BATcount(b);
+	}
+	if ((r = BATdescriptor(rid)) == NULL)
+		throw(MAL, "algebra.joinfilterbuild", RUNTIME_OBJECT_MISSING);
+	if (srid != bat_nil && (sr = BATdescriptor(srid)) == NULL) {
+		BBPunfix(r->batCacheid);
+		throw(MAL, "algebra.joinfilterbuild", RUNTIME_OBJECT_MISSING);
+	}
+	bn = BATjoinfilterbuild(r, sr, lcnt);
+	BBPunfix(r->batCacheid);
+	if (sr)
+		BBPunfix(sr->batCacheid);
+	if (bn == NULL)
+		throw(MAL, "algebra.joinfilterbuild", GDK_EXCEPTION);
+	*result = bn->batCacheid;
+	BBPkeepref(*result);
+	return MAL_SUCCEED;
+}
+
+str
+ALGjoinfilterprobe(bat *result, const bat *lid, const bat *slid, const bat *fid,
+				   const bit *nil_matches)
+{
+	BAT *l, *sl = NULL, *f, *bn;
+
+	if ((l = BATdescriptor(*lid)) == NULL)
+		throw(MAL, "algebra.joinfilterprobe", RUNTIME_OBJECT_MISSING);
+	if ((f = BATdescriptor(*fid)) == NULL) {
+		BBPunfix(l->batCacheid);
+		throw(MAL, "algebra.joinfilterprobe", RUNTIME_OBJECT_MISSING);
+	}
+	if (slid && *slid != bat_nil && (sl = BATdescriptor(*slid)) == NULL) {
+		BBPunfix(l->batCacheid);
+		BBPunfix(f->batCacheid);
+		throw(MAL, "algebra.joinfilterprobe", RUNTIME_OBJECT_MISSING);
+	}
+	bn = BATjoinfilterprobe(l, sl, f, *nil_matches);
+	BBPunfix(l->batCacheid);
+	BBPunfix(f->batCacheid);
+	if (sl)
+		BBPunfix(sl->batCacheid);
+	if (bn == NULL)
+		throw(MAL, "algebra.joinfilterprobe", GDK_EXCEPTION);
+	*result = bn->batCacheid;
+	BBPkeepref(*result);
+	return MAL_SUCCEED;
+}
+
 /* algebra.firstn(b:bat[:any],
  *                [ s:bat[:oid],
  *                [ g:bat[:oid], ] ]
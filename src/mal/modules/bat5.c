@@ -1404,6 +1404,22 @@ BKCintersectcand(bat *ret, const bat *aid, const bat *bid)
 	return MAL_SUCCEED;
 }
 
+str
+BKCstrdict(bat *ret, const bat *bid)
+{
+	BAT *b, *bn;
+
+	if ((b = BATdescriptor(*bid)) == NULL)
+		throw(MAL, "bat.strdict", RUNTIME_OBJECT_MISSING);
+	bn = BATstrdict(b);
+	BBPunfix(b->batCacheid);
+	if (bn == NULL)
+		throw(MAL, "bat.strdict", OPERATION_FAILED);
+	*ret = bn->batCacheid;
+	BBPkeepref(*ret);
+	return MAL_SUCCEED;
+}
+
 str
 INSPECTgetEnvironment(bat *ret, bat *ret2)
 {
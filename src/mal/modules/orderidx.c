@@ -232,7 +232,7 @@ OIDXgetorderidx(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 	if (b == NULL)
 		throw(MAL, "bat.getorderidx", RUNTIME_OBJECT_MISSING);
 
-	if (b->torderidx == NULL) {
+	if (!BATcheckorderidx(b)) {
 		BBPunfix(b->batCacheid);
 		throw(MAL, "bat.getorderidx", RUNTIME_OBJECT_MISSING);
 	}
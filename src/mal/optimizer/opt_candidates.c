@@ -51,6 +51,8 @@ OPTcandidatesImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 				setVarCList(mb,getArg(p,0));
 			else if(getFunctionId(p) == intersectRef )
 				setVarCList(mb,getArg(p,0));
+			else if(getFunctionId(p) == joinfilterRef || getFunctionId(p) == joinfilterprobeRef )
+				setVarCList(mb,getArg(p,0));
 			else if(getFunctionId(p) == uniqueRef )
 				setVarCList(mb,getArg(p,0));
 			else if(getFunctionId(p) == firstnRef )
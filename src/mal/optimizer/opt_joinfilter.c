@@ -0,0 +1,144 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0.  If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Copyright 1997 - July 2008 CWI, August 2008 - 2017 MonetDB B.V.
+ */
+
+/*
+ * Sideways information passing for equi-joins.  The left candidate
+ * list of each inner (semi-)join is replaced by a runtime filter on
+ * the values of the right input:
+ *
+ *  (X_1, X_2) := algebra.join(L, R, SL, SR, nil_matches, estimate);
+ *
+ * becomes
+ *
+ *  F_3 := algebra.joinfilterbuild(R, SR, L);
+ *  C_4 := algebra.joinfilterprobe(L, SL, F_3, nil_matches);
+ *  (X_1, X_2) := algebra.join(L, R, C_4, SR, nil_matches, estimate);
+ *
+ * The filter on R is built once, also when mitosis has split the join
+ * into joins of the parts of L with the same R; all those parts are
+ * then arguments of algebra.joinfilterbuild.
+ *
+ * Whether filtering pays off depends on the sizes of L and R, which
+ * are only known at runtime, so algebra.joinfilterbuild decides that
+ * itself; if it doesn't, algebra.joinfilterprobe passes SL on.
+ */
+
+#include "monetdb_config.h"
+#include "mal_builder.h"
+#include "opt_joinfilter.h"
+
+/* the same candidate list, also if both are nil constants */
+static int
+samecands(MalBlkPtr mb, int a, int b)
+{
+	return a == b ||
+		(isVarConstant(mb, a) && isVarConstant(mb, b) &&
+		 getVarConstant(mb, a).val.bval == bat_nil &&
+		 getVarConstant(mb, b).val.bval == bat_nil);
+}
+
+#define isJoin(p)							\
+	(getModuleId(p) == algebraRef &&				\
+	 (getFunctionId(p) == joinRef || getFunctionId(p) == semijoinRef) && \
+	 (p)->retc == 2 && (p)->argc == 8)
+
+str
+OPTjoinfilterImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	int i, j, k, limit, slimit, vlimit, actions = 0;
+	int *filter;		/* filter for each join, 0 if none yet */
+	char *defined;		/* variables assigned so far */
+	InstrPtr p, q, *old;
+#ifndef HAVE_EMBEDDED
+	char buf[256];
+	lng usec = GDKusec();
+#endif
+
+	(void) cntxt;
+	(void) stk;
+	(void) pci;
+
+	for (i = 0; i < mb->stop; i++) {
+		p = getInstrPtr(mb, i);
+		if (isJoin(p))
+			break;
+	}
+	if (i == mb->stop)
+		goto wrapup;
+
+	old = mb->stmt;
+	limit = mb->stop;
+	slimit = mb->ssize;
+	vlimit = mb->vtop;
+	filter = GDKzalloc(limit * sizeof(int));
+	defined = GDKzalloc(vlimit);
+	if (filter == NULL || defined == NULL || newMalBlkStmt(mb, mb->ssize) < 0) {
+		GDKfree(filter);
+		GDKfree(defined);
+		throw(MAL, "optimizer.joinfilter", MAL_MALLOC_FAIL);
+	}
+
+	for (i = 0; i < limit; i++) {
+		p = old[i];
+		if (isJoin(p)) {
+			if (filter[i] == 0) {
+				/* one filter for all joins with R that
+				 * follow, as far as their L is known here */
+				q = newStmt(mb, algebraRef, joinfilterbuildRef);
+				getArg(q, 0) = newTmpVariable(mb, newBatType(TYPE_lng));
+				q = pushArgument(mb, q, getArg(p, 3)); /* r */
+				q = pushArgument(mb, q, getArg(p, 5)); /* sr */
+				for (k = i; k < limit; k++) {
+					InstrPtr o = old[k];
+
+					if (o && isJoin(o) && filter[k] == 0 &&
+					    getArg(o, 3) == getArg(p, 3) &&
+					    samecands(mb, getArg(o, 5), getArg(p, 5)) &&
+					    (k == i || defined[getArg(o, 2)])) {
+						q = pushArgument(mb, q, getArg(o, 2)); /* l */
+						filter[k] = getArg(q, 0);
+					}
+				}
+			}
+			q = newStmt(mb, algebraRef, joinfilterprobeRef);
+			getArg(q, 0) = newTmpVariable(mb, newBatType(TYPE_oid));
+			setVarCList(mb, getArg(q, 0));
+			q = pushArgument(mb, q, getArg(p, 2)); /* l */
+			q = pushArgument(mb, q, getArg(p, 4)); /* sl */
+			q = pushArgument(mb, q, filter[i]);
+			q = pushArgument(mb, q, getArg(p, 6)); /* nil_matches */
+			getArg(p, 4) = getArg(q, 0);
+			actions++;
+		}
+		for (j = 0; j < p->retc; j++)
+			if (getArg(p, j) < vlimit)
+				defined[getArg(p, j)] = 1;
+		pushInstruction(mb, p);
+	}
+	for (; i < slimit; i++)
+		if (old[i])
+			freeInstruction(old[i]);
+	GDKfree(old);
+	GDKfree(filter);
+	GDKfree(defined);
+
+	/* Defense line against incorrect plans */
+	chkTypes(cntxt->fdout, cntxt->nspace, mb, FALSE);
+	chkFlow(cntxt->fdout, mb);
+	chkDeclarations(cntxt->fdout, mb);
+	/* keep all actions taken as a post block comment */
+  wrapup:
+#ifndef HAVE_EMBEDDED
+	usec = GDKusec() - usec;
+	snprintf(buf, 256, "%-20s actions=%2d time=" LLFMT " usec", "joinfilter", actions, usec);
+	newComment(mb, buf);
+	if (actions >= 0)
+		addtoMalBlkHistory(mb);
+#endif
+	return MAL_SUCCEED;
+}
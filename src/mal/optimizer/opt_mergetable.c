@@ -798,6 +798,136 @@ aggr_phase2(char *aggr)
 	return aggr;
 }
 
+/* Floating point sums depend on the order in which the values are
+ * added, so summing the per partition sums gives results that vary
+ * with the partitioning.  Instead, each partition produces a list of
+ * partial sums that add up exactly to its sum, and the final sum over
+ * all partial sums is the same as the sum over the whole input. */
+static int
+is_fsum(MalBlkPtr mb, InstrPtr p)
+{
+	int tp = getArgType(mb,p,0);
+	int btp = getBatType(getArgType(mb,p,1));
+
+	if (isaBatType(tp))
+		tp = getBatType(tp);
+	return (tp == TYPE_flt || tp == TYPE_dbl) &&
+		(btp == TYPE_flt || btp == TYPE_dbl);
+}
+
+static void
+mat_fsum(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
+{
+	int tp = getArgType(mb,p,0), k;
+	InstrPtr r, q, s;
+
+	r = newInstruction(mb, matRef, packRef);
+	getArg(r,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+	for(k=1; k< mat[m].mi->argc; k++) {
+		q = newInstruction(mb, aggrRef, sumpartialsRef);
+		getArg(q,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+		q = pushArgument(mb,q,getArg(mat[m].mi,k));
+		pushInstruction(mb,q);
+		r = pushArgument(mb,r,getArg(q,0));
+	}
+	pushInstruction(mb,r);
+
+	s = newInstruction(mb, aggrRef, sumRef);
+	getArg(s,0) = tp == TYPE_dbl ? getArg(p,0) : newTmpVariable(mb, TYPE_dbl);
+	s = pushArgument(mb, s, getArg(r,0));
+	pushInstruction(mb, s);
+	if (tp != TYPE_dbl) {
+		q = newInstruction(mb, calcRef, fltRef);
+		getArg(q,0) = getArg(p,0);
+		q = pushArgument(mb, q, getArg(s,0));
+		pushInstruction(mb, q);
+	}
+}
+
+/* The quantile argument of approx_quantile is a column with the same
+ * value throughout.  If it is partitioned, the first value of each
+ * partition is all the second phase needs. */
+static int
+mat_quantile_arg(MalBlkPtr mb, InstrPtr p, mat_t *mat, int q)
+{
+	InstrPtr r, s;
+	int k;
+
+	if (q < 0)
+		return getArg(p,2);
+	r = newInstruction(mb, matRef, packRef);
+	getArg(r,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+	for(k=1; k< mat[q].mi->argc; k++) {
+		s = newInstruction(mb, algebraRef, sliceRef);
+		getArg(s,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+		s = pushArgument(mb, s, getArg(mat[q].mi,k));
+		s = pushLng(mb, s, 0);
+		s = pushLng(mb, s, 0);
+		pushInstruction(mb,s);
+		r = pushArgument(mb,r,getArg(s,0));
+	}
+	pushInstruction(mb,r);
+	return getArg(r,0);
+}
+
+/* Each partition produces a sketch (t-digest) of its values, and the
+ * quantile is estimated from the combined sketches. */
+static void
+mat_approx_quantile(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m, int q)
+{
+	InstrPtr r1 = newInstruction(mb, matRef, packRef);
+	InstrPtr r2 = newInstruction(mb, matRef, packRef);
+	InstrPtr s;
+	int k;
+
+	getArg(r1,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+	getArg(r2,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+	for(k=1; k< mat[m].mi->argc; k++) {
+		s = newInstruction(mb, aggrRef, quantilesketchRef);
+		getArg(s,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+		s = pushReturn(mb, s, newTmpVariable(mb, newBatType(TYPE_dbl)));
+		s = pushArgument(mb,s,getArg(mat[m].mi,k));
+		pushInstruction(mb,s);
+		r1 = pushArgument(mb,r1,getArg(s,0));
+		r2 = pushArgument(mb,r2,getArg(s,1));
+	}
+	pushInstruction(mb,r1);
+	pushInstruction(mb,r2);
+
+	s = newInstruction(mb, aggrRef, approx_quantileRef);
+	getArg(s,0) = getArg(p,0);
+	s = pushArgument(mb, s, getArg(r1,0));
+	s = pushArgument(mb, s, getArg(r2,0));
+	s = pushArgument(mb, s, mat_quantile_arg(mb, p, mat, q));
+	pushInstruction(mb, s);
+}
+
+/* Each partition produces a sketch (HyperLogLog registers) of its
+ * values, and the number of distinct values is estimated from the
+ * combined sketches. */
+static void
+mat_approx_count_distinct(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
+{
+	InstrPtr r = newInstruction(mb, matRef, packRef);
+	InstrPtr s;
+	int k;
+
+	getArg(r,0) = newTmpVariable(mb, newBatType(TYPE_bte));
+	for(k=1; k< mat[m].mi->argc; k++) {
+		s = newInstruction(mb, aggrRef, countdistinctsketchRef);
+		getArg(s,0) = newTmpVariable(mb, newBatType(TYPE_bte));
+		s = pushArgument(mb,s,getArg(mat[m].mi,k));
+		pushInstruction(mb,s);
+		r = pushArgument(mb,r,getArg(s,0));
+	}
+	pushInstruction(mb,r);
+
+	s = newInstruction(mb, aggrRef, countdistinctmergeRef);
+	getArg(s,0) = getArg(p,0);
+	s = pushArgument(mb, s, getArg(r,0));
+	pushInstruction(mb, s);
+}
+
 static void
 mat_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
 {
@@ -806,6 +936,12 @@ mat_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
 	int isAvg = (getFunctionId(p) == avgRef);
 	InstrPtr r = NULL, s = NULL, q = NULL, u = NULL;
 
+	if (getModuleId(p) == aggrRef && getFunctionId(p) == sumRef &&
+	    p->argc == 2 && is_fsum(mb, p)) {
+		mat_fsum(mb, p, mat, m);
+		return;
+	}
+
 	/* we pack the partitial result */
 	r = newInstruction(mb, matRef, packRef);
 	getArg(r,0) = newTmpVariable(mb, battp);
@@ -971,6 +1107,176 @@ mat_group_project(MalBlkPtr mb, InstrPtr p, matlist_t *ml, int e, int a)
 	pushInstruction(mb,r);
 }
 
+/* Partial aggregates that are combined per group in a second phase
+ * are labeled with the position of their group in the packed
+ * extents, which mat[g].mv maps onto the final groups.  The groups of
+ * partition k + 1 follow those of partition k, so return the variable
+ * holding the offset of partition k + 1 given the offset off of
+ * partition k, where -1 stands for the offset 0 of the first. */
+static int
+mat_next_offset(MalBlkPtr mb, mat_t *mat, int e, int k, int off)
+{
+	InstrPtr q, r;
+
+	r = newInstruction(mb, aggrRef, countRef);
+	getArg(r,0) = newTmpVariable(mb, TYPE_lng);
+	r = pushArgument(mb, r, getArg(mat[e].mi,k));
+	pushInstruction(mb,r);
+	if (off < 0)
+		return getArg(r,0);
+
+	q = newInstruction(mb, calcRef, plusRef);
+	getArg(q,0) = newTmpVariable(mb, TYPE_lng);
+	q = pushArgument(mb, q, off);
+	q = pushArgument(mb, q, getArg(r,0));
+	pushInstruction(mb,q);
+	return getArg(q,0);
+}
+
+/* The grouped version of mat_fsum. */
+static void
+mat_group_fsum(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
+{
+	int tp = getBatType(getArgType(mb,p,0)), k, off;
+	InstrPtr ai1 = newInstruction(mb, matRef, packRef);
+	InstrPtr ai2 = newInstruction(mb, matRef, packRef);
+	InstrPtr q, r;
+
+	getArg(ai1,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+	getArg(ai2,0) = newTmpVariable(mb, newBatType(TYPE_oid));
+
+	off = -1;	/* the first partition starts at offset 0 */
+	for(k=1; k<mat[b].mi->argc; k++) {
+		q = newInstruction(mb, aggrRef, subsumpartialsRef);
+		getArg(q,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+		q = pushReturn(mb, q, newTmpVariable(mb, newBatType(TYPE_oid)));
+		q = pushArgument(mb, q, getArg(mat[b].mi,k));
+		q = pushArgument(mb, q, getArg(mat[g].mi,k));
+		q = pushArgument(mb, q, getArg(mat[e].mi,k));
+		if (off < 0)
+			q = pushLng(mb, q, 0);
+		else
+			q = pushArgument(mb, q, off);
+		q = pushArgument(mb, q, getArg(p,4)); /* skip nils */
+		pushInstruction(mb,q);
+		ai1 = pushArgument(mb,ai1,getArg(q,0));
+		ai2 = pushArgument(mb,ai2,getArg(q,1));
+
+		if (k < mat[b].mi->argc - 1)
+			off = mat_next_offset(mb, mat, e, k, off);
+	}
+	pushInstruction(mb, ai1);
+	pushInstruction(mb, ai2);
+
+	r = newInstruction(mb, algebraRef, projectionRef);
+	getArg(r,0) = newTmpVariable(mb, newBatType(TYPE_oid));
+	r = pushArgument(mb, r, getArg(ai2,0));
+	r = pushArgument(mb, r, mat[g].mv);
+	pushInstruction(mb,r);
+
+	q = newInstruction(mb, aggrRef, subsumRef);
+	getArg(q,0) = tp == TYPE_dbl ? getArg(p,0) : newTmpVariable(mb, newBatType(TYPE_dbl));
+	q = pushArgument(mb, q, getArg(ai1,0));
+	q = pushArgument(mb, q, getArg(r,0));
+	q = pushArgument(mb, q, mat[e].mv);
+	q = pushArgument(mb, q, getArg(p,4)); /* skip nils */
+	q = pushArgument(mb, q, getArg(p,5));
+	pushInstruction(mb,q);
+	if (tp != TYPE_dbl) {
+		r = newInstruction(mb, batcalcRef, fltRef);
+		getArg(r,0) = getArg(p,0);
+		r = pushArgument(mb, r, getArg(q,0));
+		pushInstruction(mb,r);
+	}
+}
+
+/* The grouped version of mat_approx_quantile. */
+static void
+mat_group_approx_quantile(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int qm, int g, int e)
+{
+	InstrPtr ai1 = newInstruction(mb, matRef, packRef);
+	InstrPtr ai2 = newInstruction(mb, matRef, packRef);
+	InstrPtr ai3 = newInstruction(mb, matRef, packRef);
+	InstrPtr q, r;
+	int k, off;
+
+	getArg(ai1,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+	getArg(ai2,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+	getArg(ai3,0) = newTmpVariable(mb, newBatType(TYPE_oid));
+
+	off = -1;	/* the first partition starts at offset 0 */
+	for(k=1; k<mat[b].mi->argc; k++) {
+		q = newInstruction(mb, aggrRef, subquantilesketchRef);
+		getArg(q,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+		q = pushReturn(mb, q, newTmpVariable(mb, newBatType(TYPE_dbl)));
+		q = pushReturn(mb, q, newTmpVariable(mb, newBatType(TYPE_oid)));
+		q = pushArgument(mb, q, getArg(mat[b].mi,k));
+		q = pushArgument(mb, q, getArg(mat[g].mi,k));
+		q = pushArgument(mb, q, getArg(mat[e].mi,k));
+		if (off < 0)
+			q = pushLng(mb, q, 0);
+		else
+			q = pushArgument(mb, q, off);
+		q = pushArgument(mb, q, getArg(p,5)); /* skip nils */
+		pushInstruction(mb,q);
+		ai1 = pushArgument(mb,ai1,getArg(q,0));
+		ai2 = pushArgument(mb,ai2,getArg(q,1));
+		ai3 = pushArgument(mb,ai3,getArg(q,2));
+
+		if (k < mat[b].mi->argc - 1)
+			off = mat_next_offset(mb, mat, e, k, off);
+	}
+	pushInstruction(mb, ai1);
+	pushInstruction(mb, ai2);
+	pushInstruction(mb, ai3);
+
+	r = newInstruction(mb, algebraRef, projectionRef);
+	getArg(r,0) = newTmpVariable(mb, newBatType(TYPE_oid));
+	r = pushArgument(mb, r, getArg(ai3,0));
+	r = pushArgument(mb, r, mat[g].mv);
+	pushInstruction(mb,r);
+
+	q = newInstruction(mb, aggrRef, subapprox_quantileRef);
+	getArg(q,0) = getArg(p,0);
+	q = pushArgument(mb, q, getArg(ai1,0));
+	q = pushArgument(mb, q, getArg(ai2,0));
+	q = pushArgument(mb, q, mat_quantile_arg(mb, p, mat, qm));
+	q = pushArgument(mb, q, getArg(r,0));
+	q = pushArgument(mb, q, mat[e].mv);
+	q = pushArgument(mb, q, getArg(p,5)); /* skip nils */
+	pushInstruction(mb,q);
+}
+
+/* The grouped version of mat_approx_count_distinct.  The sketches
+ * are in the order of the packed extents, so mat[g].mv gives the
+ * final group of each. */
+static void
+mat_group_approx_count_distinct(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
+{
+	InstrPtr ai1 = newInstruction(mb, matRef, packRef);
+	InstrPtr q;
+	int k;
+
+	getArg(ai1,0) = newTmpVariable(mb, newBatType(TYPE_bte));
+	for(k=1; k<mat[b].mi->argc; k++) {
+		q = newInstruction(mb, aggrRef, subcountdistinctsketchRef);
+		getArg(q,0) = newTmpVariable(mb, newBatType(TYPE_bte));
+		q = pushArgument(mb, q, getArg(mat[b].mi,k));
+		q = pushArgument(mb, q, getArg(mat[g].mi,k));
+		q = pushArgument(mb, q, getArg(mat[e].mi,k));
+		pushInstruction(mb,q);
+		ai1 = pushArgument(mb,ai1,getArg(q,0));
+	}
+	pushInstruction(mb, ai1);
+
+	q = newInstruction(mb, aggrRef, subcountdistinctmergeRef);
+	getArg(q,0) = getArg(p,0);
+	q = pushArgument(mb, q, getArg(ai1,0));
+	q = pushArgument(mb, q, mat[g].mv);
+	q = pushArgument(mb, q, mat[e].mv);
+	pushInstruction(mb,q);
+}
+
 /* Per partition aggregates are merged and aggregated together. For 
  * most (handled) aggregates thats relatively simple. AVG is somewhat
  * more complex. */
@@ -980,8 +1286,13 @@ mat_group_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
 	int tp = getArgType(mb,p,0), k, tp2 = 0;
 	char *aggr2 = aggr_phase2(getFunctionId(p));
 	int isAvg = (getFunctionId(p) == subavgRef);
-	InstrPtr ai1 = newInstruction(mb, matRef, packRef), ai10 = NULL, ai2;
+	InstrPtr ai1, ai10 = NULL, ai2;
 
+	if (getFunctionId(p) == subsumRef && p->argc == 6 && is_fsum(mb, p)) {
+		mat_group_fsum(mb, p, mat, b, g, e);
+		return;
+	}
+	ai1 = newInstruction(mb, matRef, packRef);
 	getArg(ai1,0) = newTmpVariable(mb, tp);
 
 	if (isAvg) { /* counts */
@@ -1675,6 +1986,20 @@ OPTmergetableImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 			actions++;
 			continue;
 		} 
+		if (getModuleId(p) == aggrRef && getFunctionId(p) == approx_count_distinctRef &&
+		    p->argc == 2 &&
+		   ((m=is_a_mat(getArg(p,1), &ml)) >= 0)) {
+			mat_approx_count_distinct(mb, p, ml.v, m);
+			actions++;
+			continue;
+		}
+		if (getModuleId(p) == aggrRef && getFunctionId(p) == approx_quantileRef &&
+		    p->argc == 3 &&
+		   ((m=is_a_mat(getArg(p,1), &ml)) >= 0)) {
+			mat_approx_quantile(mb, p, ml.v, m, is_a_mat(getArg(p,2), &ml));
+			actions++;
+			continue;
+		}
 
 		if (match == 1 && bats == 1 && p->argc == 4 && isSlice(p) && ((m=is_a_mat(getArg(p,p->retc), &ml)) >= 0)) {
 			mat_topn(mb, p, &ml, m, -1, -1);
@@ -1734,6 +2059,24 @@ OPTmergetableImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 			actions++;
 			continue;
 		}
+		if (getModuleId(p) == aggrRef && getFunctionId(p) == subapprox_count_distinctRef &&
+		    p->argc == 5 &&
+		   ((m=is_a_mat(getArg(p,1), &ml)) >= 0) &&
+		   ((n=is_a_mat(getArg(p,2), &ml)) >= 0) &&
+		   ((o=is_a_mat(getArg(p,3), &ml)) >= 0)) {
+			mat_group_approx_count_distinct(mb, p, ml.v, m, n, o);
+			actions++;
+			continue;
+		}
+		if (getModuleId(p) == aggrRef && getFunctionId(p) == subapprox_quantileRef &&
+		    p->argc == 6 &&
+		   ((m=is_a_mat(getArg(p,1), &ml)) >= 0) &&
+		   ((n=is_a_mat(getArg(p,3), &ml)) >= 0) &&
+		   ((o=is_a_mat(getArg(p,4), &ml)) >= 0)) {
+			mat_group_approx_quantile(mb, p, ml.v, m, is_a_mat(getArg(p,2), &ml), n, o);
+			actions++;
+			continue;
+		}
 		/* Handle cases of ext.projection and .projection(grp) */
 		if (match == 2 && getModuleId(p) == algebraRef &&
 		    getFunctionId(p) == projectionRef &&
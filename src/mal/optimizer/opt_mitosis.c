@@ -65,21 +65,25 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		    	getFunctionId(p) != subavgRef &&
 		    	getFunctionId(p) != subsumRef &&
 		    	getFunctionId(p) != subprodRef &&
+		    	getFunctionId(p) != subapprox_quantileRef &&
+		    	getFunctionId(p) != subapprox_count_distinctRef &&
 
 		        getFunctionId(p) != countRef &&
 		    	getFunctionId(p) != minRef &&
 		    	getFunctionId(p) != maxRef &&
 		    	getFunctionId(p) != avgRef &&
 		    	getFunctionId(p) != sumRef &&
-		    	getFunctionId(p) != prodRef)
+		    	getFunctionId(p) != prodRef &&
+		    	getFunctionId(p) != approx_quantileRef)
 			return 0;
 
-		/* do not split up floating point bat that is being summed */
+		/* do not split up floating point bat that is being summed,
+		 * unless mergetable rewrites the sum into exact partials */
 		if (p->retc == 1 &&
-			(((p->argc == 6 || p->argc == 7) &&
+			((p->argc == 7 &&
 			  getModuleId(p) == aggrRef &&
 			  getFunctionId(p) == subsumRef) ||
-			 (p->argc == 4 &&
+			 ((p->argc == 3 || p->argc == 4) &&
 			  getModuleId(p) == aggrRef &&
 			  getFunctionId(p) == sumRef)) &&
 			isaBatType(getArgType(mb, p, p->retc)) &&
@@ -74,6 +74,7 @@ static struct PIPELINES {
 	 "optimizer.aliases();"
 	 "optimizer.mitosis();"
 	 "optimizer.mergetable();"
+	 "optimizer.joinfilter();"
 	 "optimizer.deadcode();"
 	 "optimizer.aliases();"
 	 "optimizer.constants();"
@@ -107,6 +108,7 @@ static struct PIPELINES {
 	 "optimizer.aliases();"
 	 "optimizer.mitosis();"
 	 "optimizer.mergetable();"
+	 "optimizer.joinfilter();"
 	 "optimizer.deadcode();"
 	 "optimizer.aliases();"
 	 "optimizer.constants();"
@@ -149,6 +151,7 @@ static struct PIPELINES {
 	 "optimizer.pushselect();"
 	 "optimizer.aliases();"
 	 "optimizer.mergetable();"
+	 "optimizer.joinfilter();"
 	 "optimizer.deadcode();"
 	 "optimizer.aliases();"
 	 "optimizer.constants();"
@@ -189,6 +192,7 @@ static struct PIPELINES {
 	 "optimizer.pushselect();"
 	 "optimizer.aliases();"
 	 "optimizer.mergetable();"
+	 "optimizer.joinfilter();"
 	 "optimizer.deadcode();"
 	 "optimizer.aliases();"
 	 "optimizer.constants();"
@@ -38,6 +38,8 @@ str andRef;
 str antijoinRef;
 str appendidxRef;
 str appendRef;
+str approx_count_distinctRef;
+str approx_quantileRef;
 str arrayRef;
 str assertRef;
 str attachRef;
@@ -75,6 +77,8 @@ str connectRef;
 str copy_fromRef;
 str copyRef;
 str count_no_nilRef;
+str countdistinctmergeRef;
+str countdistinctsketchRef;
 str countRef;
 str create_constraintRef;
 str create_functionRef;
@@ -120,6 +124,7 @@ str expandRef;
 str exportOperationRef;
 str export_tableRef;
 str findRef;
+str fltRef;
 str finishRef;
 str firstnRef;
 str generatorRef;
@@ -146,6 +151,9 @@ str ioRef;
 str iteratorRef;
 str jitRef;
 str joinRef;
+str joinfilterRef;
+str joinfilterbuildRef;
+str joinfilterprobeRef;
 str jsonRef;
 str languageRef;
 str leftjoinRef;
@@ -205,6 +213,7 @@ str projectionpathRef;
 str projectionRef;
 str projectRef;
 str putRef;
+str quantilesketchRef;
 str pyapi3mapRef;
 str pyapi3Ref;
 str pyapimapRef;
@@ -255,7 +264,11 @@ str stopRef;
 str stoptraceRef;
 str streamsRef;
 str strRef;
+str subapprox_count_distinctRef;
+str subapprox_quantileRef;
 str subavgRef;
+str subcountdistinctmergeRef;
+str subcountdistinctsketchRef;
 str subcountRef;
 str subdeltaRef;
 str subdiffRef;
@@ -267,10 +280,13 @@ str submaxRef;
 str submedianRef;
 str subminRef;
 str subprodRef;
+str subquantilesketchRef;
 str subsliceRef;
 str subsumRef;
+str subsumpartialsRef;
 str subuniformRef;
 str sumRef;
+str sumpartialsRef;
 str takeRef;
 str thetajoinRef;
 str thetaselectRef;
@@ -400,6 +416,7 @@ void optimizerInit(void)
 	expandRef = putName("expand");
 	exportOperationRef = putName("exportOperation");
 	findRef = putName("find");
+	fltRef = putName("flt");
 	finishRef = putName("finish");
 	firstnRef = putName("firstn");
 	getRef = putName("get");
@@ -423,6 +440,9 @@ void optimizerInit(void)
 	iteratorRef = putName("iterator");
 	projectionpathRef = putName("projectionpath");
 	joinRef = putName("join");
+	joinfilterRef = putName("joinfilter");
+	joinfilterbuildRef = putName("joinfilterbuild");
+	joinfilterprobeRef = putName("joinfilterprobe");
 	semijoinRef = putName("semijoin");
 	leftjoinRef = putName("leftjoin");
 	antijoinRef = putName("antijoin");
@@ -546,6 +566,18 @@ void optimizerInit(void)
 	strRef = putName("str");
 	sumRef = putName("sum");
 	subsumRef = putName("subsum");
+	approx_quantileRef = putName("approx_quantile");
+	subapprox_quantileRef = putName("subapprox_quantile");
+	quantilesketchRef = putName("quantilesketch");
+	subquantilesketchRef = putName("subquantilesketch");
+	approx_count_distinctRef = putName("approx_count_distinct");
+	subapprox_count_distinctRef = putName("subapprox_count_distinct");
+	countdistinctsketchRef = putName("countdistinctsketch");
+	subcountdistinctsketchRef = putName("subcountdistinctsketch");
+	countdistinctmergeRef = putName("countdistinctmerge");
+	subcountdistinctmergeRef = putName("subcountdistinctmerge");
+	sumpartialsRef = putName("sumpartials");
+	subsumpartialsRef = putName("subsumpartials");
 	subavgRef = putName("subavg");
 	sortRef = putName("sort");
 	takeRef= putName("take");
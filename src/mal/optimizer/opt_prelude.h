@@ -36,6 +36,8 @@ mal_export	str andRef;
 mal_export  str antijoinRef;
 mal_export  str appendidxRef;
 mal_export  str appendRef;
+mal_export  str approx_count_distinctRef;
+mal_export  str approx_quantileRef;
 mal_export  str arrayRef;
 mal_export  str assertRef;
 mal_export  str attachRef;
@@ -73,6 +75,8 @@ mal_export  str connectRef;
 mal_export  str copy_fromRef;
 mal_export  str copyRef;
 mal_export  str count_no_nilRef;
+mal_export  str countdistinctmergeRef;
+mal_export  str countdistinctsketchRef;
 mal_export  str countRef;
 mal_export  str create_constraintRef;
 mal_export  str create_functionRef;
@@ -118,6 +122,7 @@ mal_export  str expandRef;
 mal_export  str exportOperationRef;
 mal_export  str export_tableRef;
 mal_export  str findRef;
+mal_export  str fltRef;
 mal_export  str finishRef;
 mal_export  str firstnRef;
 mal_export  str generatorRef;
@@ -145,6 +150,9 @@ mal_export  str ioRef;
 mal_export  str iteratorRef;
 mal_export  str jitRef;
 mal_export  str joinRef;
+mal_export  str joinfilterRef;
+mal_export  str joinfilterbuildRef;
+mal_export  str joinfilterprobeRef;
 mal_export  str jsonRef;
 mal_export  str languageRef;
 mal_export  str leftjoinRef;
@@ -205,6 +213,7 @@ mal_export  str projectionpathRef;
 mal_export  str projectionRef;
 mal_export  str projectRef;
 mal_export  str putRef;
+mal_export  str quantilesketchRef;
 mal_export  str pyapi3mapRef;
 mal_export  str pyapi3Ref;
 mal_export  str pyapimapRef;
@@ -255,7 +264,11 @@ mal_export  str stopRef;
 mal_export  str stoptraceRef;
 mal_export  str streamsRef;
 mal_export  str strRef;
+mal_export  str subapprox_count_distinctRef;
+mal_export  str subapprox_quantileRef;
 mal_export  str subavgRef;
+mal_export  str subcountdistinctmergeRef;
+mal_export  str subcountdistinctsketchRef;
 mal_export  str subcountRef;
 mal_export  str subdeltaRef;
 mal_export  str subdiffRef;
@@ -267,10 +280,13 @@ mal_export  str submaxRef;
 mal_export  str submedianRef;
 mal_export  str subminRef;
 mal_export  str subprodRef;
+mal_export  str subquantilesketchRef;
 mal_export  str subsliceRef;
 mal_export  str subsumRef;
+mal_export  str subsumpartialsRef;
 mal_export  str subuniformRef;
 mal_export  str sumRef;
+mal_export  str sumpartialsRef;
 mal_export  str takeRef;
 mal_export  str thetajoinRef;
 mal_export  str thetaselectRef;
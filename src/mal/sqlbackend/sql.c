@@ -3754,7 +3754,7 @@ SQLargRecord(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
  * Shrinking and re-using space to vacuum clean the holes in the relations.
  */
 static str
-vacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, str (*func) (bat *, const bat *, const bat *), const char *name)
+vacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, str (*func) (bat *, const bat *, const bat *), const char *name, int always)
 {
 	str sch = *getArgReference_str(stk, pci, 1);
 	str tbl = *getArgReference_str(stk, pci, 2);
@@ -3796,7 +3796,7 @@ vacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, str (*func) (bat
 
 	/* get the deletions BAT */
 	del = mvc_bind_dbat(m, sch, tbl, RD_INS);
-	if (BATcount(del) == 0) {
+	if (BATcount(del) == 0 && !always) {
 		BBPunfix(del->batCacheid);
 		return MAL_SUCCEED;
 	}
@@ -3848,13 +3848,70 @@ vacuum(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, str (*func) (bat
 str
 SQLshrink(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 {
-	return vacuum(cntxt, mb, stk, pci, BKCshrinkBAT, "sql.shrink");
+	return vacuum(cntxt, mb, stk, pci, BKCshrinkBAT, "sql.shrink", 0);
 }
 
 str
 SQLreuse(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 {
-	return vacuum(cntxt, mb, stk, pci, BKCreuseBAT, "sql.reuse");
+	return vacuum(cntxt, mb, stk, pci, BKCreuseBAT, "sql.reuse", 0);
+}
+
+/*
+ * Dictionary encoding rewrites the string columns of a table such
+ * that each string heap holds every distinct string once, in sorted
+ * order.  Selects, grouping, joins and sorting then work on the
+ * string offsets instead of on the strings (see BATstrdict).
+ * Deleted rows are removed on the way, as with shrink.
+ */
+static str
+dictencode(bat *ret, const bat *bid, const bat *did)
+{
+	BAT *b, *d, *bn;
+	str msg;
+
+	if ((d = BATdescriptor(*did)) == NULL)
+		throw(SQL, "sql.dictencode", "Can not access deletion column");
+	if (BATcount(d) > 0) {
+		BBPunfix(d->batCacheid);
+		if ((msg = BKCshrinkBAT(ret, bid, did)) != MAL_SUCCEED)
+			return msg;
+		if ((b = BATdescriptor(*ret)) == NULL)
+			throw(SQL, "sql.dictencode", "Can not access descriptor");
+		if (ATOMstorage(b->ttype) != TYPE_str) {
+			BBPunfix(b->batCacheid);
+			return MAL_SUCCEED;
+		}
+		BBPrelease(*ret);
+		bn = BATstrdict(b);
+	} else {
+		BBPunfix(d->batCacheid);
+		if ((b = BATdescriptor(*bid)) == NULL)
+			throw(SQL, "sql.dictencode", "Can not access descriptor");
+		if (ATOMstorage(b->ttype) == TYPE_str)
+			bn = BATstrdict(b);
+		else
+			bn = COLcopy(b, b->ttype, TRUE, TRANSIENT);
+	}
+	BBPunfix(b->batCacheid);
+	if (bn == NULL)
+		throw(SQL, "sql.dictencode", MAL_MALLOC_FAIL);
+	BBPkeepref(*ret = bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+str
+SQLdictencode(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	str msg = vacuum(cntxt, mb, stk, pci, dictencode, "sql.dictencode", 1);
+
+	/* Replaying the write-ahead log enters the strings one by one,
+	 * which loses the dictionaries, so have the log manager write
+	 * the new columns to disk as soon as no transaction is active
+	 * (see store_manager), as sys.flush_log() does. */
+	if (msg == MAL_SUCCEED)
+		store_flush_log();
+	return msg;
 }
 
 /*
@@ -689,7 +689,9 @@ cleanup_engine:
 		m->session->status = -10;
 	}
 
-	if (m->type != Q_SCHEMA && be->q && msg) {
+	/* a failing prepared statement stays valid, e.g. after a key
+	 * violation, as its handle is still held by the client */
+	if (m->type != Q_SCHEMA && be->q && msg && be->q->type != Q_PREPARE) {
 		qc_delete(m->qc, be->q);
 	} 
 	be->q = NULL;
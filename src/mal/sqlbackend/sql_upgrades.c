@@ -482,6 +482,109 @@ sql_update_jul2017(Client c, mvc *sql)
 	return err;		/* usually MAL_SUCCEED */
 }
 
+static str
+sql_update_approx_quantile(Client c, mvc *sql)
+{
+	size_t bufsize = 4096, pos = 0;
+	char *buf = GDKmalloc(bufsize), *err = NULL;
+	char *schema = stack_get_string(sql, "current_schema");
+	static const char *types[] = {
+		"TINYINT", "SMALLINT", "INTEGER", "BIGINT", "REAL", "DOUBLE",
+	};
+	int i;
+
+	if (buf == NULL)
+		throw(SQL, "sql_update_approx_quantile", MAL_MALLOC_FAIL);
+	pos += snprintf(buf + pos, bufsize - pos, "set schema \"sys\";\n");
+	for (i = 0; i < (int) (sizeof(types) / sizeof(types[0])); i++)
+		pos += snprintf(buf + pos, bufsize - pos,
+				"create aggregate approx_quantile(val %s, q DOUBLE) returns DOUBLE"
+				" external name \"aggr\".\"approx_quantile\";\n"
+				"GRANT EXECUTE ON AGGREGATE approx_quantile(%s, DOUBLE) TO PUBLIC;\n",
+				types[i], types[i]);
+#ifdef HAVE_HGE
+	if (have_hge)
+		pos += snprintf(buf + pos, bufsize - pos,
+				"create aggregate approx_quantile(val HUGEINT, q DOUBLE) returns DOUBLE"
+				" external name \"aggr\".\"approx_quantile\";\n"
+				"GRANT EXECUTE ON AGGREGATE approx_quantile(HUGEINT, DOUBLE) TO PUBLIC;\n");
+#endif
+	pos += snprintf(buf + pos, bufsize - pos,
+			"insert into sys.systemfunctions (select id from sys.functions where name = 'approx_quantile' and schema_id = (select id from sys.schemas where name = 'sys') and id not in (select function_id from sys.systemfunctions));\n");
+	if (schema)
+		pos += snprintf(buf + pos, bufsize - pos, "set schema \"%s\";\n", schema);
+	assert(pos < bufsize);
+
+	printf("Running database upgrade commands:\n%s\n", buf);
+	err = SQLstatementIntern(c, &buf, "update", 1, 0, NULL);
+	GDKfree(buf);
+	return err;		/* usually MAL_SUCCEED */
+}
+
+static str
+sql_update_approx_count_distinct(Client c, mvc *sql)
+{
+	size_t bufsize = 4096, pos = 0;
+	char *buf = GDKmalloc(bufsize), *err = NULL;
+	char *schema = stack_get_string(sql, "current_schema");
+	static const char *types[] = {
+		"TINYINT", "SMALLINT", "INTEGER", "BIGINT", "REAL", "DOUBLE",
+		"DATE", "TIME", "TIMESTAMP", "CLOB",
+	};
+	int i;
+
+	if (buf == NULL)
+		throw(SQL, "sql_update_approx_count_distinct", MAL_MALLOC_FAIL);
+	pos += snprintf(buf + pos, bufsize - pos, "set schema \"sys\";\n");
+	for (i = 0; i < (int) (sizeof(types) / sizeof(types[0])); i++)
+		pos += snprintf(buf + pos, bufsize - pos,
+				"create aggregate approx_count_distinct(val %s) returns BIGINT"
+				" external name \"aggr\".\"approx_count_distinct\";\n"
+				"GRANT EXECUTE ON AGGREGATE approx_count_distinct(%s) TO PUBLIC;\n",
+				types[i], types[i]);
+#ifdef HAVE_HGE
+	if (have_hge)
+		pos += snprintf(buf + pos, bufsize - pos,
+				"create aggregate approx_count_distinct(val HUGEINT) returns BIGINT"
+				" external name \"aggr\".\"approx_count_distinct\";\n"
+				"GRANT EXECUTE ON AGGREGATE approx_count_distinct(HUGEINT) TO PUBLIC;\n");
+#endif
+	pos += snprintf(buf + pos, bufsize - pos,
+			"insert into sys.systemfunctions (select id from sys.functions where name = 'approx_count_distinct' and schema_id = (select id from sys.schemas where name = 'sys') and id not in (select function_id from sys.systemfunctions));\n");
+	if (schema)
+		pos += snprintf(buf + pos, bufsize - pos, "set schema \"%s\";\n", schema);
+	assert(pos < bufsize);
+
+	printf("Running database upgrade commands:\n%s\n", buf);
+	err = SQLstatementIntern(c, &buf, "update", 1, 0, NULL);
+	GDKfree(buf);
+	return err;		/* usually MAL_SUCCEED */
+}
+
+static str
+sql_update_dictencode(Client c, mvc *sql)
+{
+	size_t bufsize = 1024, pos = 0;
+	char *buf = GDKmalloc(bufsize), *err = NULL;
+	char *schema = stack_get_string(sql, "current_schema");
+
+	if (buf == NULL)
+		throw(SQL, "sql_update_dictencode", MAL_MALLOC_FAIL);
+	pos += snprintf(buf + pos, bufsize - pos,
+			"set schema \"sys\";\n"
+			"create procedure dictencode(sys string, tab string)"
+			" external name sql.dictencode;\n"
+			"insert into sys.systemfunctions (select id from sys.functions where name = 'dictencode' and schema_id = (select id from sys.schemas where name = 'sys') and id not in (select function_id from sys.systemfunctions));\n");
+	if (schema)
+		pos += snprintf(buf + pos, bufsize - pos, "set schema \"%s\";\n", schema);
+	assert(pos < bufsize);
+
+	printf("Running database upgrade commands:\n%s\n", buf);
+	err = SQLstatementIntern(c, &buf, "update", 1, 0, NULL);
+	GDKfree(buf);
+	return err;		/* usually MAL_SUCCEED */
+}
+
 void
 SQLupgrades(Client c, mvc *m)
 {
@@ -519,4 +622,28 @@ SQLupgrades(Client c, mvc *m)
 			freeException(err);
 		}
 	}
+
+	sql_find_subtype(&tp, "double", 53, 0);
+	if (!sql_bind_func(m->sa, s, "approx_quantile", &tp, &tp, F_AGGR)) {
+		if ((err = sql_update_approx_quantile(c, m)) != NULL) {
+			fprintf(stderr, "!%s\n", err);
+			freeException(err);
+		}
+	}
+
+	sql_find_subtype(&tp, "bigint", 0, 0);
+	if (!sql_bind_func(m->sa, s, "approx_count_distinct", &tp, NULL, F_AGGR)) {
+		if ((err = sql_update_approx_count_distinct(c, m)) != NULL) {
+			fprintf(stderr, "!%s\n", err);
+			freeException(err);
+		}
+	}
+
+	sql_find_subtype(&tp, "clob", 0, 0);
+	if (!sql_bind_func(m->sa, s, "dictencode", &tp, &tp, F_PROC)) {
+		if ((err = sql_update_dictencode(c, m)) != NULL) {
+			fprintf(stderr, "!%s\n", err);
+			freeException(err);
+		}
+	}
 }
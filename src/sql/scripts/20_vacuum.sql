@@ -20,3 +20,8 @@ create procedure reuse(sys string, tab string)
 create procedure vacuum(sys string, tab string)
 	external name sql.vacuum;
 
+-- Dictionary encoding rebuilds the string columns of a table such
+-- that equal strings are stored once, in sorted order, which lets
+-- selections, grouping, joins and sorting work on the string codes.
+create procedure dictencode(sys string, tab string)
+	external name sql.dictencode;
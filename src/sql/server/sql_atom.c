@@ -302,6 +302,21 @@ atom_ptr( sql_allocator *sa, sql_subtype *tpe, void *v)
 	return a;
 }
 
+atom *
+atom_general_ptr( sql_allocator *sa, sql_subtype *tpe, const void *v)
+{
+	atom *a = atom_create(sa);
+	if(!a)
+		return NULL;
+	a->tpe = *tpe;
+	a->data.vtype = tpe->type->localtype;
+	VALset(&a->data, a->data.vtype, (ptr) v);
+	if (!SA_VALcopy(sa, &a->data, &a->data))
+		return NULL;
+	a->isnull = VALisnil(&a->data);
+	return a;
+}
+
 char *
 atom2string(sql_allocator *sa, atom *a)
 {
@@ -235,12 +235,13 @@ mvc_trans(mvc *m)
 	store_lock();
 	schema_changed = sql_trans_begin(m->session);
 	if (m->qc && (schema_changed || m->qc->nr > m->cache || err)){
-		if (schema_changed || err) {
+		if (schema_changed) {
 			int seqnr = m->qc->id;
 			if (m->qc)
 				qc_destroy(m->qc);
 			m->qc = qc_create(m->clientid, seqnr);
-		} else { /* clean all but the prepared statements */
+		} else { /* clean all but the prepared statements, which
+			  * stay valid after a failed transaction */
 			qc_clean(m->qc);
 		}
 	}
@@ -1814,7 +1814,7 @@ store_manager(void)
 
 	while (!GDKexiting() && !logger_funcs.log_isdestroyed()) {
 		int res = LOG_OK;
-		int t;
+		int t, requested;
 		lng shared_transactions_drift = -1;
 
 		for (t = timeout; t > 0 && !need_flush; t -= sleeptime) {
@@ -1844,13 +1844,17 @@ store_manager(void)
 			MT_lock_unset(&bs_lock);
 			continue;
 		}
+		/* a requested flush (e.g. sys.flush_log()) is usually asked
+		 * for by a statement that is still active, so look again for
+		 * a moment to flush soon */
+		requested = need_flush;
 		need_flush = 0;
 		while (store_nr_active) { /* find a moment to flush */
 			MT_lock_unset(&bs_lock);
 			if (GDKexiting()) {
 				return;
 			}
-			MT_sleep_ms(timeout);
+			MT_sleep_ms(requested ? sleeptime : timeout);
 			MT_lock_set(&bs_lock);
 		}
 
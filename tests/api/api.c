@@ -0,0 +1,2145 @@
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "embedded.h"
+
+/* the kernel headers redirect the output of the library, not of the
+ * tests */
+#undef stdout
+#undef stderr
+#undef exit
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+static int test_strview(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_str *copy, *view;
+	size_t r;
+
+	err = monetdb_query(conn, "SELECT y FROM test ORDER BY x", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	copy = (monetdb_column_str *) monetdb_result_fetch(result, 0);
+	view = (monetdb_column_str *) monetdb_result_fetch_flags(result, 0, monetdb_fetch_strview);
+	if (!copy || !view || copy == view)
+		error("String view fetch failed")
+	if (view != (monetdb_column_str *) monetdb_result_fetch_flags(result, 0, monetdb_fetch_strview))
+		error("String view not cached")
+	if (copy->count != view->count || view->type != monetdb_str)
+		error("String view has wrong shape")
+	for (r = 0; r < view->count; r++) {
+		if (copy->is_null(copy->data[r]) != view->is_null(view->data[r]))
+			error("String view null mismatch")
+		if (!view->is_null(view->data[r]) && strcmp(copy->data[r], view->data[r]) != 0)
+			error("String view value mismatch")
+	}
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_arrow(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	struct ArrowArray array, shared;
+	struct ArrowSchema schema, shared_schema;
+	const int32_t *ints;
+	const int64_t *lngs;
+	const int64_t *offsets;
+	const char *chars;
+	const unsigned char *validity;
+	int64_t i;
+
+	err = monetdb_query(conn, "SELECT x, y, CAST('1970-01-02' AS DATE), CAST(x AS BIGINT) * 1000000000 FROM test ORDER BY x", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	err = monetdb_result_fetch_arrow(result, 0, &array, &schema);
+	if (err != 0)
+		error(err)
+	ints = (const int32_t *) array.buffers[1];
+	if (strcmp(schema.format, "i") != 0 || array.length != 4 || array.null_count != 0 || ints[0] != 42 || ints[3] != 45)
+		error("Arrow integer export mismatch")
+	schema.release(&schema);
+	array.release(&array);
+
+	err = monetdb_result_fetch_arrow(result, 1, &array, &schema);
+	if (err != 0)
+		error(err)
+	offsets = (const int64_t *) array.buffers[1];
+	chars = (const char *) array.buffers[2];
+	validity = (const unsigned char *) array.buffers[0];
+	if (strcmp(schema.format, "U") != 0 || array.n_buffers != 3 || array.null_count != 1 || !validity || (validity[0] & 2) != 0)
+		error("Arrow string export mismatch")
+	if (offsets[4] != 15 || offsets[1] != 5 || offsets[2] != 5 || strncmp(chars + offsets[2], "World", 5) != 0)
+		error("Arrow string data mismatch")
+	schema.release(&schema);
+	array.release(&array);
+
+	err = monetdb_result_fetch_arrow(result, 2, &array, &schema);
+	if (err != 0)
+		error(err)
+	ints = (const int32_t *) array.buffers[1];
+	if (strcmp(schema.format, "tdD") != 0 || ints[0] != 1)
+		error("Arrow date export mismatch")
+	schema.release(&schema);
+	array.release(&array);
+
+	// the bigint column is shared, not copied, and stays alive after
+	// the result is gone until the array is released
+	err = monetdb_result_fetch_arrow(result, 3, &shared, &shared_schema);
+	if (err != 0)
+		error(err)
+	lngs = (const int64_t *) shared.buffers[1];
+	if (strcmp(shared_schema.format, "l") != 0 || shared.length != 4 || shared.n_buffers != 2 || shared.buffers[0] != NULL)
+		error("Arrow bigint export mismatch")
+	monetdb_cleanup_result(conn, result);
+	err = monetdb_query(conn, "SELECT CAST(x AS BIGINT) * 7 FROM test ORDER BY x", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	monetdb_cleanup_result(conn, result);
+	if (lngs != (const int64_t *) shared.buffers[1])
+		error("Arrow shared buffer moved")
+	for (i = 0; i < shared.length; i++) {
+		if (lngs[i] != (42 + i) * 1000000000)
+			error("Arrow shared buffer not kept alive")
+	}
+	shared_schema.release(&shared_schema);
+	shared.release(&shared);
+	return 0;
+}
+
+static int test_append_columns(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	int32_t ints[] = {1, 2, 3, 4};
+	double dbls[] = {0.5, 1.5, 2.5, 3.5};
+	char *strs[] = {"a", NULL, "c", "d"};
+	unsigned char dbl_nulls = 1 << 2;
+	unsigned char *null_masks[] = {NULL, &dbl_nulls, NULL};
+	monetdb_column columns[3] = {
+		{monetdb_int32_t, ints, 4, NULL},
+		{monetdb_double, dbls, 4, NULL},
+		{monetdb_str, strs, 4, NULL}
+	};
+	monetdb_column_int64_t *col;
+
+	err = monetdb_query(conn, "CREATE TABLE bulk (i integer, d double, s string)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE bulkkey (i integer PRIMARY KEY, d double, s string)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "bulk", columns, null_masks, 3);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "bulk", columns, NULL, 3);
+	if (err != 0)
+		error(err)
+	// tables with keys go through the SQL plan, which enforces them
+	err = monetdb_append_columns(conn, "sys", "bulkkey", columns, NULL, 3);
+	if (err != 0)
+		error(err)
+	if (monetdb_append_columns(conn, "sys", "bulkkey", columns, NULL, 3) == 0)
+		error("Primary key violation not detected")
+
+	err = monetdb_query(conn, "SELECT COUNT(*), COUNT(d), COUNT(s), SUM(i) FROM bulk", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 8)
+		error("Bulk append row count mismatch")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+	if (!col || col->data[0] != 7)
+		error("Bulk append null mask not applied")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 2);
+	if (!col || col->data[0] != 6)
+		error("Bulk append string nulls not applied")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 3);
+	if (!col || col->data[0] != 20)
+		error("Bulk append values mismatch")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_append_plan_cache(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	int32_t ints[] = {10, 11};
+	int32_t extra[] = {7, 8};
+	double dbls[] = {0.5, 1.5};
+	char *strs[] = {"x", "y"};
+	monetdb_column columns[4] = {
+		{monetdb_int32_t, ints, 2, NULL},
+		{monetdb_double, dbls, 2, NULL},
+		{monetdb_str, strs, 2, NULL},
+		{monetdb_int32_t, extra, 2, NULL}
+	};
+	monetdb_column_int64_t *col;
+	int i;
+
+	// repeated appends to a table with a key reuse the cached plan
+	for (i = 0; i < 5; i++) {
+		err = monetdb_append_columns(conn, "sys", "bulkkey", columns, NULL, 3);
+		if (err != 0)
+			error(err)
+		ints[0] += 2;
+		ints[1] += 2;
+	}
+	// schema changes invalidate the cached plan
+	err = monetdb_query(conn, "ALTER TABLE bulkkey ADD COLUMN e integer", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (monetdb_append_columns(conn, "sys", "bulkkey", columns, NULL, 3) == 0)
+		error("Stale append plan used")
+	err = monetdb_append_columns(conn, "sys", "bulkkey", columns, NULL, 4);
+	if (err != 0)
+		error(err)
+
+	err = monetdb_query(conn, "SELECT COUNT(*), SUM(e) FROM bulkkey", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 16)
+		error("Cached append row count mismatch")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+	if (!col || col->data[0] != 15)
+		error("Cached append after schema change mismatch")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_prepared(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_statement *ins = 0, *sel = 0;
+	monetdb_column_int64_t *col;
+	int32_t xs[3] = {1, 2, 3};
+	char *ys[3] = {"a", NULL, "c"};
+	void *params[2];
+	int32_t x, d;
+	long affected_rows = 0;
+
+	err = monetdb_query(conn, "CREATE TABLE prep (x integer, y string)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_prepare(conn, "INSERT INTO prep VALUES (?, ?)", &ins);
+	if (err != 0)
+		error(err)
+	if (ins->nparams != 2 || ins->param_types[0] != monetdb_int32_t || ins->param_types[1] != monetdb_str)
+		error("Prepared statement has wrong parameters")
+	params[0] = xs;
+	params[1] = ys;
+	err = monetdb_execute_bound_array(conn, ins, params, NULL, 3, &affected_rows);
+	if (err != 0)
+		error(err)
+	if (affected_rows != 3)
+		error("Array binding row count mismatch")
+
+	err = monetdb_prepare(conn, "SELECT COUNT(*) FROM prep WHERE x >= ? AND y IS NOT NULL", &sel);
+	if (err != 0)
+		error(err)
+	for (x = 0; x < 3; x++) {
+		params[0] = &x;
+		err = monetdb_execute_bound(conn, sel, params, &result, NULL);
+		if (err != 0)
+			error(err)
+		col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+		if (!col || col->data[0] != (x < 2 ? 2 : 1))
+			error("Bound parameter result mismatch")
+		monetdb_cleanup_result(conn, result);
+	}
+	monetdb_cleanup_statement(conn, ins);
+	monetdb_cleanup_statement(conn, sel);
+
+	// decimals are bound as scaled integers, and a statement that fails
+	// on a key violation can be executed again
+	err = monetdb_query(conn, "CREATE TABLE prepkey (k integer PRIMARY KEY, d decimal(8,2))", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_prepare(conn, "INSERT INTO prepkey VALUES (?, ?)", &ins);
+	if (err != 0)
+		error(err)
+	if (ins->nparams != 2 || ins->param_types[1] != monetdb_int32_t)
+		error("Prepared decimal parameter has wrong type")
+	params[0] = &x;
+	params[1] = &d;
+	x = 1;
+	d = 12345;
+	err = monetdb_execute_bound(conn, ins, params, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (monetdb_execute_bound(conn, ins, params, NULL, NULL) == 0)
+		error("Primary key violation not detected")
+	x = 2;
+	d = -5;
+	err = monetdb_execute_bound(conn, ins, params, NULL, NULL);
+	if (err != 0)
+		error(err)
+	monetdb_cleanup_statement(conn, ins);
+	err = monetdb_query(conn, "SELECT COUNT(*), CAST(SUM(d) * 100 AS BIGINT) FROM prepkey", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 2)
+		error("Prepared statement not reusable after a failure")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+	if (!col || col->data[0] != 12340)
+		error("Decimal parameter not bound as scaled integer")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static void async_count(monetdb_connection conn, void* userdata, char* error, monetdb_result* result, long affected_rows) {
+	(void) affected_rows;
+	if (!error) {
+		*(int *) userdata += 1;
+		monetdb_cleanup_result(conn, result);
+	}
+}
+
+static int test_async(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_pending_query insert, count;
+	monetdb_column_int64_t *col;
+	int callbacks = 0, i;
+	long affected_rows = 0;
+
+	err = monetdb_query(conn, "CREATE TABLE async (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (i = 0; i < 3; i++) {
+		err = monetdb_query_async(conn, "SELECT COUNT(*) FROM test", async_count, &callbacks, NULL);
+		if (err != 0)
+			error(err)
+	}
+	err = monetdb_query_async(conn, "INSERT INTO async VALUES (1), (2)", NULL, NULL, &insert);
+	if (err != 0)
+		error(err)
+	err = monetdb_query_async(conn, "SELECT COUNT(*) FROM async", NULL, NULL, &count);
+	if (err != 0)
+		error(err)
+	err = monetdb_query_wait(count, &result, NULL);
+	if (err != 0)
+		error(err)
+	if (!monetdb_query_poll(insert))
+		error("Queries on a connection ran out of order")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 2)
+		error("Asynchronous query result mismatch")
+	monetdb_cleanup_result(conn, result);
+	err = monetdb_query_wait(insert, NULL, &affected_rows);
+	if (err != 0)
+		error(err)
+	if (affected_rows != 2 || callbacks != 3)
+		error("Asynchronous query completion mismatch")
+	return 0;
+}
+
+static int test_timeout(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column col;
+	int32_t *xs;
+	size_t i, n = 100000;
+
+	err = monetdb_query(conn, "CREATE TABLE big (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	xs = malloc(n * sizeof(int32_t));
+	if (!xs)
+		error("Malloc failed")
+	for (i = 0; i < n; i++)
+		xs[i] = (int32_t) ((i * 7919) % n);
+	col.type = monetdb_int32_t;
+	col.data = xs;
+	col.count = n;
+	col.name = NULL;
+	err = monetdb_append_columns(conn, "sys", "big", &col, NULL, 1);
+	free(xs);
+	if (err != 0)
+		error(err)
+
+	err = monetdb_set_query_timeout(conn, 1);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM big a, big b WHERE a.x = b.x", 1, &result, NULL, NULL);
+	if (err == 0)
+		error("Query did not time out")
+	err = monetdb_set_query_timeout(conn, 0);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM big a, big b WHERE a.x = b.x", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+typedef struct {
+	monetdb_connection conn;
+	char* err;
+	volatile int done;
+} cancel_query;
+
+static void* cancel_run(void* arg) {
+	cancel_query *q = (cancel_query *) arg;
+	monetdb_result* result = 0;
+
+	// runs for many seconds unless it is cancelled
+	q->err = monetdb_query(q->conn, "SELECT spin(50000000)", 1, &result, NULL, NULL);
+	if (q->err == 0)
+		monetdb_cleanup_result(q->conn, result);
+	q->done = 1;
+	return NULL;
+}
+
+static void* timeout_run(void* arg) {
+	cancel_query *q = (cancel_query *) arg;
+	monetdb_result* result = 0;
+	char* err;
+
+	// queries whose deadlines expire while they run
+	while (!q->done) {
+		err = monetdb_query(q->conn, "SELECT COUNT(*) FROM big a, big b WHERE a.x = b.x", 1, &result, NULL, NULL);
+		if (err == 0)
+			monetdb_cleanup_result(q->conn, result);
+	}
+	return NULL;
+}
+
+static void* group_run(void* arg) {
+	cancel_query *q = (cancel_query *) arg;
+	monetdb_result* result = 0;
+	monetdb_column_int64_t *cnt;
+	int i;
+
+	for (i = 0; i < 5 && q->err == 0; i++) {
+		q->err = monetdb_query(q->conn, "SELECT COUNT(*) FROM (SELECT x FROM cgroup GROUP BY x) AS g", 1, &result, NULL, NULL);
+		if (q->err == 0) {
+			cnt = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+			if (!cnt || cnt->data[0] != 100000 * 8)
+				q->err = "Concurrent group result mismatch";
+			monetdb_cleanup_result(q->conn, result);
+		}
+	}
+	q->done = 1;
+	return NULL;
+}
+
+static int test_cancel(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_connection other;
+	monetdb_pending_query pending;
+	monetdb_column_int32_t *col;
+	cancel_query q, g;
+	pthread_t tid, gid;
+	int i;
+
+	err = monetdb_query(conn, "CREATE FUNCTION spin(n integer) RETURNS integer BEGIN "
+		"DECLARE i integer; SET i = 0; WHILE i < n DO SET i = i + 1; END WHILE; RETURN i; END", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	other = monetdb_connect();
+	if (other == NULL)
+		error("Connection failed")
+	q.conn = other;
+	q.err = 0;
+	q.done = 0;
+	if (pthread_create(&tid, NULL, cancel_run, &q) != 0)
+		error("Thread creation failed")
+	usleep(100000);
+
+	// queries on one connection are not affected by cancelling a
+	// query that runs concurrently on another one
+	for (i = 0; i < 3; i++) {
+		err = monetdb_query(conn, "SELECT spin(100000)", 1, &result, NULL, NULL);
+		if (err != 0)
+			error(err)
+		col = (monetdb_column_int32_t *) monetdb_result_fetch(result, 0);
+		if (!col || col->data[0] != 100000)
+			error("Concurrent query result mismatch")
+		monetdb_cleanup_result(conn, result);
+		if (i == 0)
+			monetdb_cancel(other);
+	}
+	// the cancel may have come before the query started
+	while (!q.done) {
+		monetdb_cancel(other);
+		usleep(10000);
+	}
+	pthread_join(tid, NULL);
+	if (q.err == 0 || strstr(q.err, "Query aborted on request") == NULL)
+		error("Query was not cancelled")
+	// a cancel that comes while a query is queued, here even before
+	// it is submitted, aborts that query and only that one
+	monetdb_cancel(other);
+	err = monetdb_query_async(other, "SELECT spin(1000)", NULL, NULL, &pending);
+	if (err != 0)
+		error(err)
+	err = monetdb_query_wait(pending, &result, NULL);
+	if (err == 0 || strstr(err, "Query aborted on request") == NULL)
+		error("Queued query was not cancelled")
+	err = monetdb_query(other, "SELECT spin(1000)", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	monetdb_cleanup_result(other, result);
+
+	// nor by the timeouts of queries on another connection, also not
+	// in the kernel loops that check for interrupts
+	err = monetdb_query(conn, "CREATE TABLE cgroup AS SELECT x FROM big WITH DATA", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (i = 0; i < 3; i++) {
+		char query[100];
+
+		snprintf(query, sizeof(query), "INSERT INTO cgroup SELECT x + %d FROM cgroup", 100000 << i);
+		err = monetdb_query(conn, query, 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+	}
+	err = monetdb_set_query_timeout(other, 1);
+	if (err != 0)
+		error(err)
+	// neither connection runs on the thread that started the database
+	q.done = 0;
+	g.conn = conn;
+	g.err = 0;
+	g.done = 0;
+	if (pthread_create(&tid, NULL, timeout_run, &q) != 0 || pthread_create(&gid, NULL, group_run, &g) != 0)
+		error("Thread creation failed")
+	pthread_join(gid, NULL);
+	q.done = 1;
+	pthread_join(tid, NULL);
+	if (g.err != 0)
+		error(g.err)
+	monetdb_disconnect(other);
+	return 0;
+}
+
+static int test_fetch_range(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int32_t *xs, *xrange;
+	monetdb_column_str *ys, *yrange;
+	size_t offset, r;
+
+	err = monetdb_query(conn, "SELECT x, y FROM test ORDER BY x", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	xs = (monetdb_column_int32_t *) monetdb_result_fetch(result, 0);
+	ys = (monetdb_column_str *) monetdb_result_fetch(result, 1);
+	if (!xs || !ys)
+		error("Column fetch failed")
+
+	for (offset = 0; offset < result->nrows; offset += 3) {
+		err = monetdb_result_fetch_range(result, 0, offset, 3, (monetdb_column **) &xrange);
+		if (err != 0)
+			error(err)
+		err = monetdb_result_fetch_range(result, 1, offset, 3, (monetdb_column **) &yrange);
+		if (err != 0)
+			error(err)
+		if (xrange->count != (result->nrows - offset < 3 ? result->nrows - offset : 3) || yrange->count != xrange->count)
+			error("Range has wrong length")
+		for (r = 0; r < xrange->count; r++) {
+			if (xrange->data[r] != xs->data[offset + r])
+				error("Range value mismatch")
+			if (yrange->is_null(yrange->data[r]) != ys->is_null(ys->data[offset + r]))
+				error("Range null mismatch")
+			if (!yrange->is_null(yrange->data[r]) && strcmp(yrange->data[r], ys->data[offset + r]) != 0)
+				error("Range string mismatch")
+		}
+	}
+	err = monetdb_result_fetch_range(result, 0, result->nrows, 3, (monetdb_column **) &xrange);
+	if (err != 0)
+		error(err)
+	if (xrange->count != 0)
+		error("Range past the end is not empty")
+	err = monetdb_result_fetch_range(result, 2, 0, 3, (monetdb_column **) &xrange);
+	if (err == 0 || strstr(err, "out of range") == NULL || xrange != NULL)
+		error("Range of a missing column not reported")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_fetch_epoch(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int32_t *dates;
+	monetdb_column_int64_t *times, *timestamps;
+
+	err = monetdb_query(conn, "SELECT DATE '1970-01-02', TIME '00:00:01', TIMESTAMP '1969-12-31 23:59:59.500' "
+		"UNION ALL SELECT NULL, NULL, NULL", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	dates = (monetdb_column_int32_t *) monetdb_result_fetch_flags(result, 0, monetdb_fetch_epoch);
+	times = (monetdb_column_int64_t *) monetdb_result_fetch_flags(result, 1, monetdb_fetch_epoch);
+	timestamps = (monetdb_column_int64_t *) monetdb_result_fetch_flags(result, 2, monetdb_fetch_epoch);
+	if (!dates || !times || !timestamps)
+		error("Epoch fetch failed")
+	if (dates->type != monetdb_int32_t || times->type != monetdb_int64_t || timestamps->type != monetdb_int64_t)
+		error("Epoch fetch has wrong types")
+	if (dates->data[0] != 1 || times->data[0] != 1000000 || timestamps->data[0] != -500000)
+		error("Epoch value mismatch")
+	if (!dates->is_null(dates->data[1]) || !times->is_null(times->data[1]) || !timestamps->is_null(timestamps->data[1]))
+		error("Epoch null mismatch")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_select_scan(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	int16_t shts[1000];
+	int32_t ints[1000];
+	double dbls[1000];
+	unsigned char nulls[1000 / 8];
+	unsigned char *null_masks[] = {nulls, nulls, nulls};
+	monetdb_column columns[3] = {
+		{monetdb_int16_t, shts, 1000, NULL},
+		{monetdb_int32_t, ints, 1000, NULL},
+		{monetdb_double, dbls, 1000, NULL}
+	};
+	monetdb_column_int64_t *col;
+	int64_t between = 0, less = 0, equal = 0;
+	size_t i;
+
+	memset(nulls, 0, sizeof(nulls));
+	for (i = 0; i < 1000; i++) {
+		shts[i] = (int16_t) (i % 100 - 50);
+		ints[i] = (int32_t) (i % 100 - 50);
+		dbls[i] = (double) (i % 100 - 50);
+		if (i % 7 == 0) {
+			nulls[i / 8] |= 1 << (i % 8);
+			continue;
+		}
+		between += ints[i] >= -10 && ints[i] <= 20;
+		less += dbls[i] < 0;
+		equal += shts[i] == 7;
+	}
+	err = monetdb_query(conn, "CREATE TABLE scan (s smallint, i integer, d double)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "scan", columns, null_masks, 3);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT (SELECT COUNT(*) FROM scan WHERE i BETWEEN -10 AND 20), "
+		"(SELECT COUNT(*) FROM scan WHERE d < 0), (SELECT COUNT(*) FROM scan WHERE s = 7)", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != between)
+		error("Range select count mismatch")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+	if (!col || col->data[0] != less)
+		error("One-sided select count mismatch")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 2);
+	if (!col || col->data[0] != equal)
+		error("Point select count mismatch")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+/* the kernel defaults, as set by monetdb_startup */
+static int default_nr_threads;
+static BUN default_morsel_size;
+
+/* have the kernel split its work over 4 threads, in morsels of
+ * morsel_size rows or the default size if 0, also on a machine with a
+ * single core; or restore the defaults */
+static void set_parallel(int on, BUN morsel_size) {
+	GDKnr_threads = on ? 4 : default_nr_threads;
+	GDK_morsel_size = on && morsel_size ? morsel_size : default_morsel_size;
+}
+
+static int test_select_parallel(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	int32_t *ints = malloc(20000 * sizeof(int32_t));
+	double *dbls = malloc(20000 * sizeof(double));
+	unsigned char nulls[20000 / 8];
+	unsigned char *null_masks[] = {nulls, nulls};
+	monetdb_column columns[2] = {
+		{monetdb_int32_t, NULL, 20000, NULL},
+		{monetdb_double, NULL, 20000, NULL}
+	};
+	monetdb_column_int64_t *col;
+	int64_t between = 0, notequal = 0, both = 0;
+	int k, run;
+
+	if (!ints || !dbls)
+		error("Memory allocation failed")
+	columns[0].data = ints;
+	columns[1].data = dbls;
+	memset(nulls, 0, sizeof(nulls));
+	for (k = 0; k < 20000; k++) {
+		ints[k] = (int32_t) (k * 7919 % 1000 - 500);
+		dbls[k] = (double) ((k * 104729) % 999 - 400);
+		if (k % 13 == 0) {
+			nulls[k / 8] |= 1 << (k % 8);
+			continue;
+		}
+		between += ints[k] >= -100 && ints[k] <= 200;
+		notequal += ints[k] != 3;
+		both += ints[k] >= -100 && ints[k] <= 200 && dbls[k] < 0;
+	}
+	err = monetdb_query(conn, "CREATE TABLE pscan (i integer, d double)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "pscan", columns, null_masks, 2);
+	if (err != 0)
+		error(err)
+	free(ints);
+	free(dbls);
+	/* first serially, then split into morsels; the last select runs
+	 * on the candidates of the first, which the morsels split evenly */
+	for (run = 0; run < 2; run++) {
+		if (run == 1)
+			set_parallel(1, 1024);
+		err = monetdb_query(conn, "SELECT (SELECT COUNT(*) FROM pscan WHERE i BETWEEN -100 AND 200), "
+			"(SELECT COUNT(*) FROM pscan WHERE i <> 3), "
+			"(SELECT COUNT(*) FROM pscan WHERE i BETWEEN -100 AND 200 AND d < 0)", 1, &result, NULL, NULL);
+		set_parallel(0, 0);
+		if (err != 0)
+			error(err)
+		col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+		if (!col || col->data[0] != between)
+			error("Parallel range select count mismatch")
+		col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+		if (!col || col->data[0] != notequal)
+			error("Parallel anti select count mismatch")
+		col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 2);
+		if (!col || col->data[0] != both)
+			error("Parallel candidate select count mismatch")
+		monetdb_cleanup_result(conn, result);
+	}
+	return 0;
+}
+
+static int test_hash_parallel(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int64_t *col;
+	int64_t serial[4];
+	int run, k;
+
+	/* two copies of the same table, so that the second builds its
+	 * hash tables anew, in parallel */
+	for (run = 0; run < 2; run++) {
+		char query[300];
+
+		snprintf(query, sizeof(query), "CREATE TABLE phash%d (a integer, s string)", run);
+		err = monetdb_query(conn, query, 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+		snprintf(query, sizeof(query), "INSERT INTO phash%d SELECT CASE WHEN x %% 17 = 0 THEN NULL ELSE x %% 5000 END, "
+			"'v' || CAST(x %% 3000 AS STRING) FROM big WHERE x < 20000", run);
+		err = monetdb_query(conn, query, 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+		if (run == 1)
+			set_parallel(1, 1024);
+		snprintf(query, sizeof(query), "SELECT (SELECT COUNT(*) FROM phash%d x JOIN phash%d y ON x.a = y.a), "
+			"(SELECT COUNT(*) FROM phash%d x JOIN phash%d y ON x.s = y.s), "
+			"(SELECT COUNT(*) FROM (SELECT a FROM phash%d GROUP BY a) AS g), "
+			"(SELECT SUM(c * c) FROM (SELECT COUNT(*) AS c FROM phash%d GROUP BY s) AS g)",
+			run, run, run, run, run, run);
+		err = monetdb_query(conn, query, 1, &result, NULL, NULL);
+		set_parallel(0, 0);
+		if (err != 0)
+			error(err)
+		for (k = 0; k < 4; k++) {
+			col = (monetdb_column_int64_t *) monetdb_result_fetch(result, k);
+			if (!col)
+				error("Parallel hash result missing")
+			if (run == 0)
+				serial[k] = col->data[0];
+			else if (col->data[0] != serial[k])
+				error("Parallel hash build result mismatch")
+		}
+		monetdb_cleanup_result(conn, result);
+	}
+	/* 5000 values, none of which is nil in all four rows, and nil */
+	if (serial[2] != 5000 + 1)
+		error("Hash group count mismatch")
+	return 0;
+}
+
+/* whether bats a and b of the same length hold the same values; ne is
+ * nil where either is, so it has as many non-nils as a and b only if
+ * their nils are in the same places */
+static int same_bats(BAT *a, BAT *b) {
+	BAT *ne = BATcalcne(a, b, NULL), *sel;
+	signed char t = 1;
+	size_t diff, nonil;
+
+	if (ne == NULL)
+		return 0;
+	nonil = BATcount_no_nil(ne);
+	sel = BATselect(ne, NULL, &t, NULL, 1, 1, 0);
+	BBPreclaim(ne);
+	if (sel == NULL)
+		return 0;
+	diff = BATcount_no_nil(sel);
+	BBPreclaim(sel);
+	return diff == 0 && BATcount_no_nil(a) == nonil && BATcount_no_nil(b) == nonil;
+}
+
+/* group int values of a bat with a nonzero hseqbase in morsels, with a
+ * candidate list and with and without a prior grouping, and compare
+ * groups, extents and histogram with the serial grouping */
+static int test_group_candidates(void) {
+	BAT *b, *c, *s, *g[2] = {NULL, NULL}, *r[2][2][3];
+	int lo = 100, hi = 60000;
+	int run, sub, k, x, ok = 1;
+
+	b = COLnew(1000, TYPE_int, 100000, TRANSIENT);
+	c = COLnew(1000, TYPE_int, 100000, TRANSIENT);
+	if (b == NULL || c == NULL)
+		error("Creating group input failed")
+	for (x = 0; x < 100000; x++) {
+		int v = x % 29 == 0 ? INT32_MIN : (x * 7919) % 5003;
+		int w = x % 11;
+
+		if (BUNappend(b, &v, FALSE) != GDK_SUCCEED || BUNappend(c, &w, FALSE) != GDK_SUCCEED)
+			error("Filling group input failed")
+	}
+	/* a candidate list that is not dense */
+	s = BATselect(b, NULL, &lo, &hi, 1, 1, 0);
+	if (s == NULL)
+		error("Candidate select failed")
+	for (run = 0; run < 2; run++) {
+		if (run == 1)
+			set_parallel(1, 1024);
+		for (sub = 0; sub < 2; sub++) {
+			if (sub == 1 && g[run] == NULL &&
+			    BATgroup(&g[run], NULL, NULL, c, s, NULL, NULL, NULL) != GDK_SUCCEED)
+				ok = 0;
+			else if (BATgroup(&r[run][sub][0], &r[run][sub][1], &r[run][sub][2],
+					  b, s, sub ? g[run] : NULL, NULL, NULL) != GDK_SUCCEED)
+				ok = 0;
+		}
+		set_parallel(0, 0);
+		if (!ok)
+			error("Grouping with candidates failed")
+	}
+	if (!same_bats(g[0], g[1]))
+		ok = 0;
+	for (sub = 0; sub < 2; sub++)
+		for (k = 0; k < 3; k++)
+			if (!same_bats(r[0][sub][k], r[1][sub][k]))
+				ok = 0;
+	for (run = 0; run < 2; run++) {
+		for (sub = 0; sub < 2; sub++)
+			for (k = 0; k < 3; k++)
+				BBPreclaim(r[run][sub][k]);
+		BBPreclaim(g[run]);
+	}
+	BBPreclaim(s);
+	BBPreclaim(b);
+	BBPreclaim(c);
+	if (!ok)
+		error("Grouping with candidates differs in morsels")
+	return 0;
+}
+
+static int test_group_parallel(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int32_t *icol;
+	monetdb_column_int64_t *ccol;
+	static int32_t keys[3][2][20000];
+	static int64_t cnts[3][20000];
+	static const char *queries[3] = {
+		"SELECT a, COUNT(*) FROM pgroup GROUP BY a",
+		"SELECT a, COUNT(*) FROM pgroup WHERE x > 3000 GROUP BY a",
+		"SELECT a, b, COUNT(*) FROM pgroup WHERE x % 3 <> 1 GROUP BY b, a",
+	};
+	size_t nrows[3], i;
+	int run, q, c;
+
+	/* the groups, their order, the group values taken through the
+	 * extents and the counts from the histogram must be the same when
+	 * grouping in morsels, without and with candidates and with a
+	 * prior grouping */
+	err = monetdb_query(conn, "CREATE TABLE pgroup AS SELECT x, CAST(CASE WHEN x % 31 = 0 THEN NULL ELSE (x * 7) % 2500 END AS INTEGER) AS a, "
+		"CAST(x % 7 AS INTEGER) AS b FROM big WHERE x < 20000 WITH DATA", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (run = 0; run < 2; run++) {
+		for (q = 0; q < 3; q++) {
+			if (run == 1)
+				set_parallel(1, 1024);
+			err = monetdb_query(conn, (char *) queries[q], 1, &result, NULL, NULL);
+			set_parallel(0, 0);
+			if (err != 0)
+				error(err)
+			ccol = (monetdb_column_int64_t *) monetdb_result_fetch(result, result->ncols - 1);
+			if (!ccol || (run == 1 && ccol->count != nrows[q]))
+				error("Parallel group result missing")
+			nrows[q] = ccol->count;
+			for (c = 0; c < (int) result->ncols - 1; c++) {
+				icol = (monetdb_column_int32_t *) monetdb_result_fetch(result, c);
+				if (!icol || icol->count != nrows[q])
+					error("Parallel group result missing")
+				for (i = 0; i < nrows[q]; i++) {
+					if (run == 0)
+						keys[q][c][i] = icol->data[i];
+					else if (icol->data[i] != keys[q][c][i])
+						error("Parallel group values mismatch")
+				}
+			}
+			for (i = 0; i < nrows[q]; i++) {
+				if (run == 0)
+					cnts[q][i] = ccol->data[i];
+				else if (ccol->data[i] != cnts[q][i])
+					error("Parallel group counts mismatch")
+			}
+			monetdb_cleanup_result(conn, result);
+		}
+	}
+	if (nrows[0] != 2500 + 1 || nrows[2] <= nrows[1])
+		error("Parallel group count mismatch")
+	return test_group_candidates();
+}
+
+static int test_zonemap(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	static int32_t ints[100000];
+	static unsigned char nulls[100000 / 8];
+	unsigned char *null_masks[] = {nulls};
+	monetdb_column columns[1] = {
+		{monetdb_int32_t, ints, 100000, NULL}
+	};
+	monetdb_column_int64_t *cnt;
+	monetdb_column_int32_t *val;
+	size_t i;
+
+	/* clustered values with a block of nulls, doubled by appending
+	 * the same values shifted up, so most blocks can be skipped */
+	memset(nulls, 0, sizeof(nulls));
+	for (i = 0; i < 100000; i++) {
+		ints[i] = (int32_t) i;
+		if (i >= 40000 && i < 40000 + 20000 && i % 2 == 0)
+			nulls[i / 8] |= 1 << (i % 8);
+	}
+	err = monetdb_query(conn, "CREATE TABLE zonemap (i integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "zonemap", columns, null_masks, 1);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM zonemap WHERE i BETWEEN 1000 AND 2000", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	cnt = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!cnt || cnt->data[0] != 1001)
+		error("Zone map range select count mismatch")
+	monetdb_cleanup_result(conn, result);
+	err = monetdb_query(conn, "INSERT INTO zonemap SELECT i + 100000 FROM zonemap", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT (SELECT COUNT(*) FROM zonemap WHERE i BETWEEN 39990 AND 40010), "
+		"(SELECT COUNT(*) FROM zonemap WHERE i > 190000), (SELECT COUNT(*) FROM zonemap WHERE i IS NULL), "
+		"(SELECT COUNT(*) FROM zonemap WHERE i = 150001), (SELECT MIN(i) FROM zonemap), "
+		"(SELECT MAX(i) FROM zonemap)", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	cnt = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!cnt || cnt->data[0] != 15)
+		error("Zone map select across nulls count mismatch")
+	cnt = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+	if (!cnt || cnt->data[0] != 9999)
+		error("Zone map select on appended values count mismatch")
+	cnt = (monetdb_column_int64_t *) monetdb_result_fetch(result, 2);
+	if (!cnt || cnt->data[0] != 20000)
+		error("Zone map nil select count mismatch")
+	cnt = (monetdb_column_int64_t *) monetdb_result_fetch(result, 3);
+	if (!cnt || cnt->data[0] != 1)
+		error("Zone map point select count mismatch")
+	val = (monetdb_column_int32_t *) monetdb_result_fetch(result, 4);
+	if (!val || val->data[0] != 0)
+		error("Zone map min mismatch")
+	val = (monetdb_column_int32_t *) monetdb_result_fetch(result, 5);
+	if (!val || val->data[0] != 199999)
+		error("Zone map max mismatch")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_radixjoin(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	static int32_t lints[100000], rints[100000];
+	static unsigned char lnulls[100000 / 8], rnulls[100000 / 8];
+	static unsigned char seen[100000];
+	unsigned char *lnull_masks[] = {lnulls}, *rnull_masks[] = {rnulls};
+	monetdb_column lcolumns[1] = {
+		{monetdb_int32_t, lints, 100000, NULL}
+	};
+	monetdb_column rcolumns[1] = {
+		{monetdb_int32_t, rints, 100000, NULL}
+	};
+	monetdb_column_int64_t *col;
+	int64_t count = 0, sum = 0;
+	size_t i;
+	int k;
+
+	/* two permutations of the same keys with different nulls, grown
+	 * to 1.6M rows each so that the inner hash table is too large
+	 * for the cache and the join is radix-partitioned */
+	memset(lnulls, 0, sizeof(lnulls));
+	memset(rnulls, 0, sizeof(rnulls));
+	for (i = 0; i < 100000; i++) {
+		lints[i] = (int32_t) (i * 7919 % 100000);
+		rints[i] = (int32_t) (i * 40503 % 100000);
+		if (i % 50 == 0)
+			lnulls[i / 8] |= 1 << (i % 8);
+		else
+			seen[lints[i]] = 1;
+		if (i % 100 == 0)
+			rnulls[i / 8] |= 1 << (i % 8);
+	}
+	for (i = 0; i < 100000; i++) {
+		if (i % 100 != 0 && seen[rints[i]]) {
+			count++;
+			sum += rints[i];
+		}
+	}
+	/* each of the 16 copies is shifted up by a multiple of 100000 */
+	sum = 16 * sum + count * 120 * 100000;
+	count *= 16;
+	err = monetdb_query(conn, "CREATE TABLE radixl (i integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE radixr (i integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "radixl", lcolumns, lnull_masks, 1);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "radixr", rcolumns, rnull_masks, 1);
+	if (err != 0)
+		error(err)
+	for (k = 0; k < 4; k++) {
+		char query[100];
+
+		snprintf(query, sizeof(query), "INSERT INTO radixl SELECT i + %d FROM radixl", 100000 << k);
+		err = monetdb_query(conn, query, 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+		snprintf(query, sizeof(query), "INSERT INTO radixr SELECT i + %d FROM radixr", 100000 << k);
+		err = monetdb_query(conn, query, 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+	}
+	err = monetdb_query(conn, "SELECT COUNT(*), SUM(CAST(radixl.i AS BIGINT)) FROM radixl, radixr "
+		"WHERE radixl.i = radixr.i", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != count)
+		error("Radix join count mismatch")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+	if (!col || col->data[0] != sum)
+		error("Radix join sum mismatch")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_joinfilter(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	static int64_t fkeys[100000], dkeys[1000];
+	static int32_t fvals[100000], dvals[1000];
+	static unsigned char fnulls[100000 / 8], vnulls[100000 / 8], dnulls[1000 / 8 + 1];
+	unsigned char *fnull_masks[] = {fnulls, vnulls}, *dnull_masks[] = {dnulls, dnulls};
+	monetdb_column fcolumns[2] = {
+		{monetdb_int64_t, fkeys, 100000, NULL},
+		{monetdb_int32_t, fvals, 100000, NULL}
+	};
+	monetdb_column dcolumns[2] = {
+		{monetdb_int64_t, dkeys, 1000, NULL},
+		{monetdb_int32_t, dvals, 1000, NULL}
+	};
+	monetdb_column_int64_t *col;
+	int64_t count = 0, sum = 0;
+	size_t i;
+
+	/* a fact table joined with a selective dimension; the keys are
+	 * spread out so that the join filter is a Bloom filter */
+	memset(fnulls, 0, sizeof(fnulls));
+	memset(vnulls, 0, sizeof(vnulls));
+	memset(dnulls, 0, sizeof(dnulls));
+	for (i = 0; i < 1000; i++) {
+		dkeys[i] = (int64_t) (i * 100 + 1) * 1000003;
+		dvals[i] = (int32_t) (i % 7);
+	}
+	for (i = 0; i < 100000; i++) {
+		size_t k = i * 7919 % 100000;
+
+		fkeys[i] = (int64_t) k * 1000003;
+		fvals[i] = (int32_t) (i % 101);
+		if (i % 50 == 0)
+			fnulls[i / 8] |= 1 << (i % 8);
+		else if (k % 100 == 1 && (k / 100) % 7 < 3) {
+			count++;
+			sum += fvals[i];
+		}
+	}
+	err = monetdb_query(conn, "CREATE TABLE joinf (k bigint, v integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE joind (k bigint, x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "joinf", fcolumns, fnull_masks, 2);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "joind", dcolumns, dnull_masks, 2);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT COUNT(*), SUM(CAST(joinf.v AS BIGINT)) FROM joinf, joind "
+		"WHERE joinf.k = joind.k AND joind.x < 3", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != count)
+		error("Join filter count mismatch")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+	if (!col || col->data[0] != sum)
+		error("Join filter sum mismatch")
+	monetdb_cleanup_result(conn, result);
+
+	/* narrow keys with negative values, exact filters over a range
+	 * that crosses zero; every smallint occurs 5 times, every tinyint
+	 * 500 times */
+	err = monetdb_query(conn, "CREATE TABLE joinfn AS SELECT CAST(x % 20000 - 10000 AS SMALLINT) AS s, "
+		"CAST(x % 200 - 100 AS TINYINT) AS t FROM big WITH DATA", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE joindn (s smallint, t tinyint)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO joindn VALUES (-10000, -100), (-300, -1), (-2, 3), (0, 99), (5, NULL), (9999, NULL)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT (SELECT COUNT(*) FROM joinfn, joindn WHERE joinfn.s = joindn.s), "
+		"(SELECT COUNT(*) FROM joinfn, joindn WHERE joinfn.t = joindn.t)", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 6 * 5)
+		error("Smallint join filter count mismatch")
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 1);
+	if (!col || col->data[0] != 4 * 500)
+		error("Tinyint join filter count mismatch")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_joinfilter_mitosis(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int64_t *col;
+	int64_t serial = -1;
+	int run;
+
+	/* split joinf into parts that are joined with the same joind, for
+	 * which the join filter is built once; mito_parts has no effect
+	 * while GDKnr_threads is 1 */
+	if (GDKsetenv("mito_parts", "4") != GDK_SUCCEED)
+		error("Setting mito_parts failed")
+	for (run = 0; run < 2; run++) {
+		if (run == 1)
+			set_parallel(1, 0);
+		err = monetdb_query(conn, "SELECT COUNT(*) FROM joinf, joind "
+			"WHERE joinf.k = joind.k AND joind.x < 3", 1, &result, NULL, NULL);
+		set_parallel(0, 0);
+		if (err != 0)
+			error(err)
+		col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+		if (!col)
+			error("Join filter count missing")
+		if (run == 0)
+			serial = col->data[0];
+		else if (col->data[0] != serial)
+			error("Partitioned join filter count mismatch")
+		monetdb_cleanup_result(conn, result);
+	}
+	return 0;
+}
+
+static int test_orderidx_append(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int64_t *col;
+	int k;
+
+	/* the ordered index is kept across appends, and ranges over it
+	 * must see the appended values */
+	err = monetdb_query(conn, "CREATE TABLE oidxt (a integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO oidxt VALUES (1), (9), (3), (12), (-5), (8), (2), (0)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (k = 0; k < 5; k++) {
+		char query[100];
+
+		snprintf(query, sizeof(query), "INSERT INTO oidxt SELECT a + %d FROM oidxt", 100 << k);
+		err = monetdb_query(conn, query, 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+	}
+	err = monetdb_query(conn, "CREATE ORDERED INDEX oidxt_a ON oidxt(a)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO oidxt VALUES (5), (7), (-3)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO oidxt VALUES (6), (NULL)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM oidxt WHERE a BETWEEN 0 AND 10", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 9)
+		error("Ordered index range count mismatch")
+	monetdb_cleanup_result(conn, result);
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM oidxt WHERE a < 0", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 2)
+		error("Ordered index range count mismatch")
+	monetdb_cleanup_result(conn, result);
+	/* rolled back appends must not stay visible through the index */
+	err = monetdb_query(conn, "START TRANSACTION", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO oidxt VALUES (4), (-7), (10)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "ROLLBACK", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO oidxt VALUES (-1)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM oidxt WHERE a BETWEEN 0 AND 10", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 9)
+		error("Ordered index range count mismatch after rollback")
+	monetdb_cleanup_result(conn, result);
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM oidxt WHERE a < 0", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+	if (!col || col->data[0] != 3)
+		error("Ordered index range count mismatch after rollback")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int test_fsum_mitosis(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_double *col;
+	double serial[8];
+	int run;
+	size_t i;
+
+	/* values that cancel, so that summing per partition sums would
+	 * round differently from the serial sum; the join keeps the plan
+	 * eligible for mitosis and the sum input partitioned */
+	err = monetdb_query(conn, "CREATE TABLE fsumt AS SELECT x % 7 AS g, "
+		"CAST(x AS DOUBLE) * 0.1 + (x % 3 - 1) * 1e15 AS v FROM big WITH DATA", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE fsumk (g integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO fsumk VALUES (0), (1), (2), (3), (4), (5), (6)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (run = 0; run < 2; run++) {
+		if (run == 1)
+			set_parallel(1, 0);
+		err = monetdb_query(conn, "SELECT SUM(v) FROM fsumt, fsumk WHERE fsumt.g = fsumk.g", 1, &result, NULL, NULL);
+		set_parallel(0, 0);
+		if (err != 0)
+			error(err)
+		col = (monetdb_column_double *) monetdb_result_fetch(result, 0);
+		if (!col || col->count != 1)
+			error("Float sum missing")
+		if (run == 0)
+			serial[7] = col->data[0];
+		else if (memcmp(&serial[7], &col->data[0], sizeof(double)) != 0)
+			error("Partitioned float sum mismatch")
+		monetdb_cleanup_result(conn, result);
+		if (run == 1)
+			set_parallel(1, 0);
+		err = monetdb_query(conn, "SELECT fsumt.g, SUM(v) FROM fsumt, fsumk WHERE fsumt.g = fsumk.g "
+			"GROUP BY fsumt.g ORDER BY fsumt.g", 1, &result, NULL, NULL);
+		set_parallel(0, 0);
+		if (err != 0)
+			error(err)
+		col = (monetdb_column_double *) monetdb_result_fetch(result, 1);
+		if (!col || col->count != 7)
+			error("Grouped float sum missing")
+		for (i = 0; i < 7; i++) {
+			if (run == 0)
+				serial[i] = col->data[i];
+			else if (memcmp(&serial[i], &col->data[i], sizeof(double)) != 0)
+				error("Partitioned grouped float sum mismatch")
+		}
+		monetdb_cleanup_result(conn, result);
+	}
+	return 0;
+}
+
+static int cmp_int16(const void *a, const void *b) {
+	int16_t x = *(const int16_t *) a, y = *(const int16_t *) b;
+	return (x > y) - (x < y);
+}
+
+static int cmp_int32(const void *a, const void *b) {
+	int32_t x = *(const int32_t *) a, y = *(const int32_t *) b;
+	return (x > y) - (x < y);
+}
+
+static int cmp_int64(const void *a, const void *b) {
+	int64_t x = *(const int64_t *) a, y = *(const int64_t *) b;
+	return (x > y) - (x < y);
+}
+
+static int test_radixsort(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int16_t *scol;
+	monetdb_column_int32_t *icol, *gcol;
+	monetdb_column_int64_t *lcol;
+	static int16_t svals[5000];
+	static int32_t ivals[5000];
+	static int64_t lvals[5000], gvals[5000];
+	size_t i, n = 5000, ng[2] = {0, 0};
+	int x, desc;
+
+	/* more values than RSORT_MINSIZE, with nils, negative values and
+	 * lng values that need all passes; nil sorts first ascending and
+	 * last descending */
+	err = monetdb_query(conn, "CREATE TABLE rsortt AS SELECT CAST(x % 2 AS INTEGER) AS g, "
+		"CAST(CASE WHEN x % 17 = 0 THEN NULL ELSE (x * 37) % 2001 - 1000 END AS SMALLINT) AS s, "
+		"CAST(CASE WHEN x % 19 = 0 THEN NULL ELSE (x * 7919) % 200001 - 100000 END AS INTEGER) AS i, "
+		"CASE WHEN x % 23 = 0 THEN NULL ELSE CAST((x * 7919) % 5001 - 2500 AS BIGINT) * 4000000007 END AS l "
+		"FROM big WHERE x < 5000 WITH DATA", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (x = 0; x < 5000; x++) {
+		svals[x] = x % 17 == 0 ? INT16_MIN : (int16_t) ((x * 37) % 2001 - 1000);
+		ivals[x] = x % 19 == 0 ? INT32_MIN : (x * 7919) % 200001 - 100000;
+		lvals[x] = x % 23 == 0 ? INT64_MIN : ((x * 7919) % 5001 - 2500) * (int64_t) 4000000007;
+		/* the ints of group 1 sorted after those of group 0 */
+		gvals[x] = (int64_t) (x % 2) << 32 | (uint32_t) (ivals[x] ^ INT32_MIN);
+		ng[x % 2]++;
+	}
+	qsort(svals, n, sizeof(svals[0]), cmp_int16);
+	qsort(ivals, n, sizeof(ivals[0]), cmp_int32);
+	qsort(lvals, n, sizeof(lvals[0]), cmp_int64);
+	qsort(gvals, n, sizeof(gvals[0]), cmp_int64);
+	for (desc = 0; desc < 2; desc++) {
+		err = monetdb_query(conn, desc ? "SELECT s, i, l FROM rsortt ORDER BY s DESC" : "SELECT s, i, l FROM rsortt ORDER BY s",
+			1, &result, NULL, NULL);
+		if (err != 0)
+			error(err)
+		scol = (monetdb_column_int16_t *) monetdb_result_fetch(result, 0);
+		if (!scol || scol->count != n || scol->null_value != INT16_MIN)
+			error("Radix sort smallint result missing")
+		for (i = 0; i < n; i++)
+			if (scol->data[i] != svals[desc ? n - 1 - i : i])
+				error("Radix sort smallint mismatch")
+		monetdb_cleanup_result(conn, result);
+		err = monetdb_query(conn, desc ? "SELECT i FROM rsortt ORDER BY i DESC" : "SELECT i FROM rsortt ORDER BY i",
+			1, &result, NULL, NULL);
+		if (err != 0)
+			error(err)
+		icol = (monetdb_column_int32_t *) monetdb_result_fetch(result, 0);
+		if (!icol || icol->count != n || icol->null_value != INT32_MIN)
+			error("Radix sort integer result missing")
+		for (i = 0; i < n; i++)
+			if (icol->data[i] != ivals[desc ? n - 1 - i : i])
+				error("Radix sort integer mismatch")
+		monetdb_cleanup_result(conn, result);
+		err = monetdb_query(conn, desc ? "SELECT l FROM rsortt ORDER BY l DESC" : "SELECT l FROM rsortt ORDER BY l",
+			1, &result, NULL, NULL);
+		if (err != 0)
+			error(err)
+		lcol = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+		if (!lcol || lcol->count != n || lcol->null_value != INT64_MIN)
+			error("Radix sort bigint result missing")
+		for (i = 0; i < n; i++)
+			if (lcol->data[i] != lvals[desc ? n - 1 - i : i])
+				error("Radix sort bigint mismatch")
+		monetdb_cleanup_result(conn, result);
+	}
+	/* refining a sort within groups larger than RSORT_MINSIZE */
+	err = monetdb_query(conn, "SELECT g, i FROM rsortt ORDER BY g, i", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	gcol = (monetdb_column_int32_t *) monetdb_result_fetch(result, 0);
+	icol = (monetdb_column_int32_t *) monetdb_result_fetch(result, 1);
+	if (!gcol || !icol || gcol->count != n || icol->count != n)
+		error("Radix refine sort result missing")
+	for (i = 0; i < n; i++)
+		if (gcol->data[i] != (int32_t) (i >= ng[0]) ||
+		    icol->data[i] != (int32_t) ((uint32_t) gvals[i] ^ INT32_MIN))
+			error("Radix refine sort mismatch")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+/* sort a bat with few distinct keys stably in parallel runs, so that
+ * runs of equal keys cross the run and merge boundaries, and compare
+ * with the expected stable order and with the serial sort */
+static int test_psort_stable(void) {
+	BAT *b, *exp[2][2], *r[2][2][3];
+	int run, rev, k, x, key, ok = 1;
+
+	b = COLnew(500, TYPE_int, 20000, TRANSIENT);
+	for (rev = 0; rev < 2; rev++) {
+		exp[rev][0] = COLnew(0, TYPE_int, 20000, TRANSIENT);
+		exp[rev][1] = COLnew(0, TYPE_oid, 20000, TRANSIENT);
+		if (exp[rev][0] == NULL || exp[rev][1] == NULL)
+			error("Creating sort input failed")
+	}
+	if (b == NULL)
+		error("Creating sort input failed")
+	for (x = 0; x < 20000; x++) {
+		int v = x % 29 == 0 ? INT32_MIN : (x * 7919) % 13 - 6;
+
+		if (BUNappend(b, &v, FALSE) != GDK_SUCCEED)
+			error("Filling sort input failed")
+	}
+	/* the stable order: per key the oids in ascending order, nil
+	 * first ascending and last descending */
+	for (rev = 0; rev < 2; rev++) {
+		for (k = 0; k < 14; k++) {
+			key = rev ? (k == 13 ? INT32_MIN : 6 - k) : (k == 0 ? INT32_MIN : k - 7);
+			for (x = 0; x < 20000; x++) {
+				int v = x % 29 == 0 ? INT32_MIN : (x * 7919) % 13 - 6;
+				oid o = 500 + (oid) x;
+
+				if (v == key &&
+				    (BUNappend(exp[rev][0], &v, FALSE) != GDK_SUCCEED ||
+				     BUNappend(exp[rev][1], &o, FALSE) != GDK_SUCCEED))
+					error("Filling expected sort failed")
+			}
+		}
+	}
+	for (run = 0; run < 2; run++) {
+		if (run == 1)
+			set_parallel(1, 1024);
+		for (rev = 0; rev < 2; rev++)
+			if (BATsort(&r[run][rev][0], &r[run][rev][1], &r[run][rev][2],
+				    b, NULL, NULL, rev, TRUE) != GDK_SUCCEED)
+				ok = 0;
+		set_parallel(0, 0);
+		if (!ok)
+			error("Stable sort failed")
+	}
+	for (rev = 0; rev < 2; rev++) {
+		for (run = 0; run < 2; run++)
+			for (k = 0; k < 2; k++)
+				if (!same_bats(r[run][rev][k], exp[rev][k]))
+					ok = 0;
+		if (!same_bats(r[0][rev][2], r[1][rev][2]))
+			ok = 0;
+	}
+	for (rev = 0; rev < 2; rev++) {
+		for (run = 0; run < 2; run++)
+			for (k = 0; k < 3; k++)
+				BBPreclaim(r[run][rev][k]);
+		BBPreclaim(exp[rev][0]);
+		BBPreclaim(exp[rev][1]);
+	}
+	BBPreclaim(b);
+	if (!ok)
+		error("Parallel stable sort differs")
+	return 0;
+}
+
+/* row x of the inputs of test_project: l refers to m from 100 on and m
+ * to r from 7 on; every 13th l, every 17th m and every 23rd r is nil */
+#define PRJ_L(x)	((x) % 13 == 0 ? oid_nil : 100 + (oid) ((x) * 7919) % 5000)
+#define PRJ_M(x)	((x) % 17 == 3 ? oid_nil : 7 + (oid) ((x) * 31) % 5000)
+#define PRJ_R(x)	((x) % 23 == 5 ? INT32_MIN : (x) * 3 - 7000)
+
+/* append int value i, or the same value as another type, to
+ * projection bats b[0..3] of types int, lng, dbl and str */
+static int project_append(BAT **b, int i) {
+	int64_t v = i == INT32_MIN ? INT64_MIN : (int64_t) i * 1000003;
+	double f = i == INT32_MIN ? dbl_nil : i / 4.0;
+	char buf[16];
+
+	snprintf(buf, sizeof(buf), "s%d", i);
+	return BUNappend(b[0], &i, FALSE) == GDK_SUCCEED && BUNappend(b[1], &v, FALSE) == GDK_SUCCEED &&
+		BUNappend(b[2], &f, FALSE) == GDK_SUCCEED &&
+		BUNappend(b[3], i == INT32_MIN ? str_nil : buf, FALSE) == GDK_SUCCEED;
+}
+
+/* project through nil oids, directly and through chains with and
+ * without a dense bat, serially and in morsels, and compare with the
+ * values the oids refer to */
+static int test_project(void) {
+	BAT *l, *m, *d, *lm, *expm, *expd, *r[4], *exp[2][4], *res, *chain[4];
+	const int types[4] = {TYPE_int, TYPE_lng, TYPE_dbl, TYPE_str};
+	int run, k, t, x, ok = 1;
+
+	l = COLnew(0, TYPE_oid, 20000, TRANSIENT);
+	m = COLnew(100, TYPE_oid, 5000, TRANSIENT);
+	expm = COLnew(0, TYPE_oid, 20000, TRANSIENT);
+	expd = COLnew(0, TYPE_oid, 20000, TRANSIENT);
+	d = BATdense(100, 7, 5000);
+	if (l == NULL || m == NULL || expm == NULL || expd == NULL || d == NULL)
+		error("Creating project input failed")
+	for (t = 0; t < 4; t++) {
+		r[t] = COLnew(7, types[t], 5000, TRANSIENT);
+		for (k = 0; k < 2; k++)
+			if ((exp[k][t] = COLnew(0, types[t], 20000, TRANSIENT)) == NULL)
+				error("Creating project input failed")
+		if (r[t] == NULL)
+			error("Creating project input failed")
+	}
+	for (x = 0; x < 5000; x++) {
+		oid o = PRJ_M(x);
+
+		if (BUNappend(m, &o, FALSE) != GDK_SUCCEED || !project_append(r, PRJ_R(x)))
+			error("Filling project input failed")
+	}
+	/* exp[0] is r projected through l and d, exp[1] through l and m */
+	for (x = 0; x < 20000; x++) {
+		oid o = PRJ_L(x), o2 = o == oid_nil ? oid_nil : PRJ_M(o - 100);
+		oid o3 = o == oid_nil ? oid_nil : o - 93;
+
+		if (BUNappend(l, &o, FALSE) != GDK_SUCCEED || BUNappend(expm, &o2, FALSE) != GDK_SUCCEED ||
+		    BUNappend(expd, &o3, FALSE) != GDK_SUCCEED ||
+		    !project_append(exp[0], o == oid_nil ? INT32_MIN : PRJ_R((int) (o - 100))) ||
+		    !project_append(exp[1], o2 == oid_nil ? INT32_MIN : PRJ_R((int) (o2 - 7))))
+			error("Filling expected projection failed")
+	}
+	for (run = 0; run < 2; run++) {
+		if (run == 1)
+			set_parallel(1, 1024);
+		lm = BATproject(l, m);
+		if (lm == NULL || !same_bats(lm, expm))
+			ok = 0;
+		/* a chain that ends in a dense bat */
+		chain[0] = l;
+		chain[1] = d;
+		chain[2] = NULL;
+		res = BATprojectchain(chain);
+		if (res == NULL || !same_bats(res, expd))
+			ok = 0;
+		BBPreclaim(res);
+		for (t = 0; ok && t < 4; t++) {
+			res = BATproject(lm, r[t]);
+			if (res == NULL || !same_bats(res, exp[1][t]))
+				ok = 0;
+			BBPreclaim(res);
+			for (k = 0; ok && k < 2; k++) {
+				chain[0] = l;
+				chain[1] = k ? m : d;
+				chain[2] = r[t];
+				chain[3] = NULL;
+				res = BATprojectchain(chain);
+				if (res == NULL || !same_bats(res, exp[k][t]))
+					ok = 0;
+				BBPreclaim(res);
+			}
+		}
+		BBPreclaim(lm);
+		set_parallel(0, 0);
+	}
+	for (t = 0; t < 4; t++) {
+		BBPreclaim(r[t]);
+		BBPreclaim(exp[0][t]);
+		BBPreclaim(exp[1][t]);
+	}
+	BBPreclaim(l);
+	BBPreclaim(m);
+	BBPreclaim(d);
+	BBPreclaim(expm);
+	BBPreclaim(expd);
+	if (!ok)
+		error("Projection through nil oids differs")
+	return 0;
+}
+
+static int test_countdistinct(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int64_t *col;
+	static const char *cols[] = {"i", "l", "d", "s"};
+	int64_t exact[4][10], approx[4][10];
+	size_t c, i, n;
+	int run, grouped;
+
+	/* hllt: 100000 rows in groups 0 to 6 with thousands of distinct
+	 * values each, plus group 7 with only nils and group 8 with two
+	 * distinct values.  The sketch has a standard error of 0.8%, the
+	 * estimates must be within four times that.  The second run joins
+	 * with hllk under forced mitosis, which merges partial sketches;
+	 * those give the same estimates as a single sketch */
+	err = monetdb_query(conn, "CREATE TABLE hllt AS SELECT x % 7 AS g, "
+		"CAST(CASE WHEN x % 11 = 0 THEN NULL ELSE (x * 7919) % 60000 END AS INTEGER) AS i, "
+		"CAST(CASE WHEN x % 11 = 0 THEN NULL ELSE (x * 7919) % 60000 END AS BIGINT) * 1000003 + x % 3 AS l, "
+		"CASE WHEN x % 13 = 0 THEN NULL ELSE CAST(x % 20000 AS DOUBLE) / 8 END AS d, "
+		"CASE WHEN x % 17 = 0 THEN NULL ELSE 'v' || CAST(x % 3000 AS VARCHAR(10)) END AS s "
+		"FROM big WITH DATA", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO hllt VALUES (7, NULL, NULL, NULL, NULL), (7, NULL, NULL, NULL, NULL), "
+		"(8, 5, 5, 5, 'a'), (8, 5, 5, 5, 'a'), (8, 6, 6, 6, 'b')", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE hllk AS SELECT DISTINCT g FROM hllt WITH DATA", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (grouped = 0; grouped < 2; grouped++) {
+		n = grouped ? 9 : 1;
+		for (c = 0; c < 4; c++) {
+			char query[200];
+
+			snprintf(query, sizeof(query), grouped ?
+				"SELECT COUNT(DISTINCT %s) FROM hllt GROUP BY g ORDER BY g" :
+				"SELECT COUNT(DISTINCT %s) FROM hllt", cols[c]);
+			err = monetdb_query(conn, query, 1, &result, NULL, NULL);
+			if (err != 0)
+				error(err)
+			col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+			if (!col || col->count != n)
+				error("Exact distinct count missing")
+			for (i = 0; i < n; i++)
+				exact[c][i] = col->data[i];
+			monetdb_cleanup_result(conn, result);
+		}
+		for (run = 0; run < 2; run++) {
+			const char *from = run == 0 ? "hllt" : "hllt, hllk WHERE hllt.g = hllk.g";
+
+			for (c = 0; c < 4; c++) {
+				char query[200];
+
+				snprintf(query, sizeof(query), grouped ?
+					"SELECT approx_count_distinct(%s) FROM %s GROUP BY hllt.g ORDER BY hllt.g" :
+					"SELECT approx_count_distinct(%s) FROM %s", cols[c], from);
+				if (run == 1)
+					set_parallel(1, 0);
+				err = monetdb_query(conn, query, 1, &result, NULL, NULL);
+				set_parallel(0, 0);
+				if (err != 0)
+					error(err)
+				col = (monetdb_column_int64_t *) monetdb_result_fetch(result, 0);
+				if (!col || col->count != n)
+					error("Approximate distinct count missing")
+				for (i = 0; i < n; i++) {
+					if (run == 0)
+						approx[c][i] = col->data[i];
+					else if (col->data[i] != approx[c][i])
+						error("Merged distinct count sketch mismatch")
+					if (col->data[i] < exact[c][i] * 0.968 || col->data[i] > exact[c][i] * 1.032)
+						error("Approximate distinct count out of bounds")
+				}
+				monetdb_cleanup_result(conn, result);
+			}
+		}
+	}
+	return 0;
+}
+
+/* sketch many small groups and a large one in two partitions: the
+ * sketches of the small groups stay sparse, so that they take a few
+ * bytes instead of the 16KiB of a dense sketch, and merging the
+ * partitions gives the estimates of a single sketch */
+static int test_countdistinct_groups(void) {
+	BAT *b, *g, *s[2], *sk[2], *mg, *est, *exp;
+	const lng *e, *x;
+	BUN ngrp = 40001, i;
+	int k, v, ok = 1;
+
+	b = COLnew(0, TYPE_int, 100000, TRANSIENT);
+	g = COLnew(0, TYPE_oid, 100000, TRANSIENT);
+	s[0] = COLnew(0, TYPE_oid, 50000, TRANSIENT);
+	s[1] = COLnew(0, TYPE_oid, 50000, TRANSIENT);
+	mg = COLnew(0, TYPE_oid, 2 * ngrp, TRANSIENT);
+	if (b == NULL || g == NULL || s[0] == NULL || s[1] == NULL || mg == NULL)
+		error("Creating sketch input failed")
+	/* group 0 has 20000 distinct values, the others 2 */
+	for (v = 0; v < 100000; v++) {
+		int w = v * 7919;
+		oid o = v < 20000 ? 0 : (oid) (v - 20000) / 2 + 1, r = (oid) v;
+
+		if (BUNappend(b, &w, FALSE) != GDK_SUCCEED ||
+		    BUNappend(g, &o, FALSE) != GDK_SUCCEED ||
+		    BUNappend(s[v % 2], &r, FALSE) != GDK_SUCCEED)
+			error("Filling sketch input failed")
+	}
+	for (i = 0; i < 2 * ngrp; i++) {
+		oid o = i % ngrp;
+
+		if (BUNappend(mg, &o, FALSE) != GDK_SUCCEED)
+			error("Filling sketch input failed")
+	}
+	g->tsorted = 1;
+	s[0]->tsorted = s[1]->tsorted = 1;
+	s[0]->tkey = s[1]->tkey = 1;
+	for (k = 0; k < 2; k++) {
+		if ((sk[k] = BATgroupcountdistinctsketch(b, g, NULL, s[k])) == NULL)
+			error("Sketching groups failed")
+		if (BATcount(sk[k]) > 1 + 16384 + (ngrp - 1) * 9)
+			ok = 0;
+	}
+	if (!ok)
+		error("Sketches of small groups too large")
+	if (BATappend(sk[0], sk[1], NULL, FALSE) != GDK_SUCCEED)
+		error("Combining sketches failed")
+	est = BATgroupcountdistinctmerge(sk[0], mg, NULL);
+	exp = BATgroupapproxcountdistinct(b, g, NULL, NULL);
+	if (est == NULL || exp == NULL || BATcount(est) != ngrp || BATcount(exp) != ngrp)
+		error("Merging sketches failed")
+	e = (const lng *) Tloc(est, 0);
+	x = (const lng *) Tloc(exp, 0);
+	for (i = 0; i < ngrp; i++)
+		if (e[i] != x[i])
+			ok = 0;
+	/* two values of a group may share a register */
+	for (i = 1; i < ngrp; i++)
+		if (e[i] < 1 || e[i] > 2)
+			ok = 0;
+	if (e[0] < 20000 * 0.968 || e[0] > 20000 * 1.032)
+		ok = 0;
+	BBPreclaim(b);
+	BBPreclaim(g);
+	BBPreclaim(s[0]);
+	BBPreclaim(s[1]);
+	BBPreclaim(sk[0]);
+	BBPreclaim(sk[1]);
+	BBPreclaim(mg);
+	BBPreclaim(est);
+	BBPreclaim(exp);
+	if (!ok)
+		error("Merged sketches of many groups differ")
+	return 0;
+}
+
+/* run query fmt on dictionary encoded table dictt and on its plain
+ * copy dictp, and compare the results */
+static int same_results(monetdb_connection conn, const char *fmt) {
+	char* err = 0;
+	monetdb_result* result[2] = {0, 0};
+	char query[300];
+	size_t c, r;
+	int k;
+
+	for (k = 0; k < 2; k++) {
+		snprintf(query, sizeof(query), fmt, k ? "dictp" : "dictt");
+		err = monetdb_query(conn, query, 1, &result[k], NULL, NULL);
+		if (err != 0)
+			error(err)
+	}
+	if (result[0]->ncols != result[1]->ncols || result[0]->nrows != result[1]->nrows)
+		error("Dictionary encoded result has wrong shape")
+	for (c = 0; c < result[0]->ncols; c++) {
+		monetdb_column *a = monetdb_result_fetch(result[0], c);
+		monetdb_column *b = monetdb_result_fetch(result[1], c);
+
+		if (!a || !b || a->type != b->type || a->count != b->count)
+			error("Dictionary encoded column mismatch")
+		for (r = 0; r < a->count; r++) {
+			switch (a->type) {
+			case monetdb_int32_t:
+				if (((monetdb_column_int32_t *) a)->data[r] != ((monetdb_column_int32_t *) b)->data[r])
+					error("Dictionary encoded value mismatch")
+				break;
+			case monetdb_int64_t:
+				if (((monetdb_column_int64_t *) a)->data[r] != ((monetdb_column_int64_t *) b)->data[r])
+					error("Dictionary encoded value mismatch")
+				break;
+			case monetdb_str: {
+				monetdb_column_str *sa = (monetdb_column_str *) a, *sb = (monetdb_column_str *) b;
+
+				if (sa->is_null(sa->data[r]) != sb->is_null(sb->data[r]) ||
+				    (!sa->is_null(sa->data[r]) && strcmp(sa->data[r], sb->data[r]) != 0))
+					error("Dictionary encoded value mismatch")
+				break;
+			}
+			default:
+				error("Unexpected dictionary result type")
+			}
+		}
+	}
+	monetdb_cleanup_result(conn, result[0]);
+	monetdb_cleanup_result(conn, result[1]);
+	return 0;
+}
+
+/* the queries on both tables: equality, range and anti selects on the
+ * small heap of s and the large heap of t, grouping and sorting on the
+ * codes and a join with the small heap on the left */
+static int dict_queries(monetdb_connection conn) {
+	static const char *queries[] = {
+		"SELECT i FROM %s WHERE s = 'k17' ORDER BY i",
+		"SELECT i FROM %s WHERE s = 'missing' ORDER BY i",
+		"SELECT i FROM %s WHERE s <> 'k17' ORDER BY i",
+		"SELECT i FROM %s WHERE s BETWEEN 'k2' AND 'k3' ORDER BY i",
+		"SELECT i FROM %s WHERE s > 'k45' ORDER BY i",
+		"SELECT i FROM %s WHERE t = 'value_012345' ORDER BY i",
+		"SELECT i FROM %s WHERE t < 'value_001000' ORDER BY i",
+		"SELECT i FROM %s WHERE t <> 'value_012345' ORDER BY i",
+		"SELECT s, COUNT(*) FROM %s GROUP BY s ORDER BY s",
+		"SELECT s, t, COUNT(*) FROM %s GROUP BY s, t ORDER BY s, t",
+		"SELECT t, i FROM %s ORDER BY t DESC, i",
+		"SELECT a.i, b.k FROM %s a, dictk b WHERE a.s = b.s ORDER BY a.i, b.k",
+	};
+	size_t q;
+
+	for (q = 0; q < sizeof(queries) / sizeof(queries[0]); q++)
+		if (same_results(conn, queries[q]) != 0)
+			return -1;
+	return 0;
+}
+
+/* create dictt, its plain copy dictp and dictk from big, and encode
+ * dictt and dictk */
+static int dict_tables(monetdb_connection conn) {
+	char* err = 0;
+	static const char *statements[] = {
+		/* s fits in a small string heap, t does not */
+		"CREATE TABLE dictt AS SELECT x AS i, "
+		"CASE WHEN x % 37 = 0 THEN NULL ELSE 'k' || CAST((x * 7919) % 500 AS VARCHAR(10)) END AS s, "
+		"'value_' || CAST(100000 + (x * 31) % 30000 AS VARCHAR(10)) AS t FROM big WHERE x < 20000 WITH DATA",
+		"CREATE TABLE dictp AS SELECT * FROM dictt WITH DATA",
+		"CREATE TABLE dictk AS SELECT x AS k, 'k' || CAST(x * 2 AS VARCHAR(10)) AS s FROM big WHERE x < 300 WITH DATA",
+		"CALL sys.dictencode('sys', 'dictt')",
+		"CALL sys.dictencode('sys', 'dictk')",
+	};
+	size_t i;
+
+	for (i = 0; i < sizeof(statements) / sizeof(statements[0]); i++) {
+		err = monetdb_query(conn, (char *) statements[i], 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+	}
+	return 0;
+}
+
+static int test_dictencode(monetdb_connection conn) {
+	char* err = 0;
+	size_t i;
+
+	if (dict_tables(conn) != 0)
+		return -1;
+	if (dict_queries(conn) != 0)
+		return -1;
+	/* encoding replaces the columns, which can't be undone */
+	err = monetdb_query(conn, "START TRANSACTION", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (monetdb_query(conn, "CALL sys.dictencode('sys', 'dictt')", 1, NULL, NULL, NULL) == 0)
+		error("Dictionary encoding inside a transaction not refused")
+	err = monetdb_query(conn, "ROLLBACK", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	/* new strings, which sort before, between and after the existing
+	 * ones, end the dictionary */
+	for (i = 0; i < 2; i++) {
+		err = monetdb_query(conn, i ? "INSERT INTO dictp VALUES (20000, 'a', 'value_1'), (20001, 'k2x', 'zz'), (20002, 'k17', 'value_012345')" :
+			"INSERT INTO dictt VALUES (20000, 'a', 'value_1'), (20001, 'k2x', 'zz'), (20002, 'k17', 'value_012345')",
+			1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+	}
+	if (dict_queries(conn) != 0)
+		return -1;
+	/* encode again, with deletions, and once more without */
+	for (i = 0; i < 2; i++) {
+		err = monetdb_query(conn, i ? "DELETE FROM dictp WHERE i % 5 = 0" : "DELETE FROM dictt WHERE i % 5 = 0",
+			1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+	}
+	for (i = 0; i < 2; i++) {
+		err = monetdb_query(conn, "CALL sys.dictencode('sys', 'dictt')", 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+		if (dict_queries(conn) != 0)
+			return -1;
+	}
+	return 0;
+}
+
+/* the number of string bats in the BBP.dir of database dir whose heap
+ * is marked as a dictionary, or -1; like BBPinit, this prefers the
+ * one in BACKUP */
+static int dict_bits(const char *dir) {
+	char path[200], tok[200];
+	FILE *f;
+	int width, var, n = 0;
+
+	snprintf(path, sizeof(path), "%s/bat/BACKUP/BBP.dir", dir);
+	if ((f = fopen(path, "r")) == NULL) {
+		snprintf(path, sizeof(path), "%s/bat/BBP.dir", dir);
+		if ((f = fopen(path, "r")) == NULL)
+			return -1;
+	}
+	while (fscanf(f, "%199s", tok) == 1)
+		if (strcmp(tok, "str") == 0 && fscanf(f, "%d %d", &width, &var) == 2 && (var & 4))
+			n++;
+	fclose(f);
+	return n;
+}
+
+/* the dictionary bit of a string heap is saved in BBP.dir when the
+ * log is flushed, so that encoded columns are still encoded after a
+ * restart */
+static int test_dictencode_restart(void) {
+	char* err = 0;
+	char dir[] = "/tmp/dictencodeXXXXXX", cmd[100];
+	void* conn = 0;
+	void* other = 0;
+	monetdb_result* result = 0;
+	monetdb_column col;
+	int32_t *xs;
+	size_t i, n = 20000;
+	int run;
+
+	if (mkdtemp(dir) == NULL)
+		error("Creating database directory failed")
+	for (run = 0; run < 2; run++) {
+		err = monetdb_startup(dir, 1, 0);
+		if (err != 0)
+			error(err)
+		conn = monetdb_connect();
+		if (conn == NULL)
+			error("Connection failed")
+		if (run == 0) {
+			err = monetdb_query(conn, "CREATE TABLE big (x integer)", 1, NULL, NULL, NULL);
+			if (err != 0)
+				error(err)
+			xs = malloc(n * sizeof(int32_t));
+			if (!xs)
+				error("Malloc failed")
+			for (i = 0; i < n; i++)
+				xs[i] = (int32_t) ((i * 7919) % n);
+			col.type = monetdb_int32_t;
+			col.data = xs;
+			col.count = n;
+			col.name = NULL;
+			err = monetdb_append_columns(conn, "sys", "big", &col, NULL, 1);
+			free(xs);
+			if (err != 0)
+				error(err)
+			// a transaction that is open on another connection
+			// does not hold up the encoding, only the flush
+			other = monetdb_connect();
+			if (other == NULL)
+				error("Connection failed")
+			err = monetdb_query(other, "START TRANSACTION", 1, NULL, NULL, NULL);
+			if (err != 0)
+				error(err)
+			err = monetdb_query(other, "SELECT COUNT(*) FROM big", 1, &result, NULL, NULL);
+			if (err != 0)
+				error(err)
+			monetdb_cleanup_result(other, result);
+			if (dict_tables(conn) != 0)
+				return -1;
+			err = monetdb_query(other, "ROLLBACK", 1, NULL, NULL, NULL);
+			if (err != 0)
+				error(err)
+			monetdb_disconnect(other);
+			// the log manager writes the encoded columns to disk
+			// once no transaction is active
+			for (i = 0; i < 600 && dict_bits(dir) != 3; i++)
+				usleep(50000);
+			if (dict_bits(dir) != 3)
+				error("Dictionary encoding not written to disk")
+		}
+		if (dict_queries(conn) != 0)
+			return -1;
+		monetdb_disconnect(conn);
+		monetdb_shutdown();
+		/* the columns s and t of dictt and s of dictk */
+		if (dict_bits(dir) != 3)
+			error("Dictionary encoding not saved")
+	}
+	snprintf(cmd, sizeof(cmd), "rm -rf %s", dir);
+	if (system(cmd) != 0)
+		error("Removing database directory failed")
+	return 0;
+}
+
+/* the rank error of an approximate quantile r of the n sorted values
+ * in v, as a fraction of n */
+static double quantile_rank_error(const int32_t *v, size_t n, double q, double r) {
+	size_t lo = 0, hi = 0, i;
+	double target = q * n;
+
+	for (i = 0; i < n; i++) {
+		lo += v[i] < r;
+		hi += v[i] <= r;
+	}
+	if (target < lo)
+		return (lo - target) / n;
+	if (target > hi)
+		return (target - hi) / n;
+	return 0;
+}
+
+static int test_quantile(monetdb_connection conn) {
+	char* err = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int32_t *icol;
+	monetdb_column_double *dcol;
+	static const double qs[] = {0.01, 0.1, 0.25, 0.3, 0.5, 0.75, 0.9, 0.99};
+	int32_t *vals[6];
+	size_t cnts[6] = {0}, all = 0, i, j;
+	int x, g, run;
+
+	/* skewed values with about 100 ties each, and nils; group 5 only
+	 * has nils.  The widest bin of the digest holds about 3% of the
+	 * values, so an approximate quantile is off by at most half of that
+	 * in rank.  The second run joins with fsumk under forced mitosis,
+	 * which merges partial digests; mitosis does not split exact
+	 * quantiles, so these are left out there. */
+	err = monetdb_query(conn, "CREATE TABLE qt AS SELECT x % 5 AS g, CASE WHEN x % 13 = 0 THEN NULL "
+		"ELSE CAST((x % 1000) * (x % 1000) / 7 - 20000 AS INTEGER) END AS v FROM big WITH DATA", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO qt VALUES (5, NULL), (5, NULL)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (g = 0; g < 6; g++)
+		vals[g] = malloc(100000 * sizeof(int32_t));
+	for (x = 0; x < 100000; x++) {
+		if (x % 13 == 0)
+			continue;
+		vals[x % 5][cnts[x % 5]++] = (x % 1000) * (x % 1000) / 7 - 20000;
+		vals[5][all++] = (x % 1000) * (x % 1000) / 7 - 20000;
+	}
+	for (g = 0; g < 6; g++)
+		qsort(vals[g], g == 5 ? all : cnts[g], sizeof(int32_t), cmp_int32);
+
+	for (run = 0; run < 2; run++) {
+		const char *from = run == 0 ? "qt" : "qt, fsumk WHERE qt.g = fsumk.g";
+		const char *exact = run == 0 ? "quantile(v, %g), " : "";
+
+		for (j = 0; j < sizeof(qs) / sizeof(qs[0]); j++) {
+			char query[200], exact_query[40];
+			size_t n = all, k = n - (size_t) (n + 0.5 - (n - 1) * qs[j]);
+
+			snprintf(exact_query, sizeof(exact_query), exact, qs[j]);
+			snprintf(query, sizeof(query), "SELECT %sapprox_quantile(v, %g) FROM %s",
+				exact_query, qs[j], from);
+			if (run == 1)
+				set_parallel(1, 0);
+			err = monetdb_query(conn, query, 1, &result, NULL, NULL);
+			set_parallel(0, 0);
+			if (err != 0)
+				error(err)
+			if (run == 0) {
+				icol = (monetdb_column_int32_t *) monetdb_result_fetch(result, 0);
+				if (!icol || icol->count != 1 || icol->data[0] != vals[5][k])
+					error("Quantile mismatch")
+			}
+			dcol = (monetdb_column_double *) monetdb_result_fetch(result, 1 - run);
+			if (!dcol || dcol->count != 1 || dcol->is_null(dcol->data[0]))
+				error("Approximate quantile missing")
+			if (quantile_rank_error(vals[5], n, qs[j], dcol->data[0]) > 0.02)
+				error("Approximate quantile out of bounds")
+			monetdb_cleanup_result(conn, result);
+
+			snprintf(query, sizeof(query), "SELECT qt.g, %sapprox_quantile(v, %g) FROM %s "
+				"GROUP BY qt.g ORDER BY qt.g", exact_query, qs[j], from);
+			if (run == 1)
+				set_parallel(1, 0);
+			err = monetdb_query(conn, query, 1, &result, NULL, NULL);
+			set_parallel(0, 0);
+			if (err != 0)
+				error(err)
+			icol = (monetdb_column_int32_t *) monetdb_result_fetch(result, 1);
+			dcol = (monetdb_column_double *) monetdb_result_fetch(result, 2 - run);
+			if (!icol || !dcol || icol->count != 6 || dcol->count != 6)
+				error("Grouped quantile missing")
+			if ((run == 0 && icol->data[5] != icol->null_value) || !dcol->is_null(dcol->data[5]))
+				error("Quantile of only nils is not nil")
+			for (i = 0; i < 5; i++) {
+				n = cnts[i];
+				k = n - (size_t) (n + 0.5 - (n - 1) * qs[j]);
+				if (run == 0 && icol->data[i] != vals[i][k])
+					error("Grouped quantile mismatch")
+				if (quantile_rank_error(vals[i], n, qs[j], dcol->data[i]) > 0.02)
+					error("Grouped approximate quantile out of bounds")
+			}
+			monetdb_cleanup_result(conn, result);
+		}
+	}
+	for (g = 0; g < 6; g++)
+		free(vals[g]);
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	default_nr_threads = GDKnr_threads;
+	default_morsel_size = GDK_morsel_size;
+
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, y string)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	err = monetdb_query(conn, "INSERT INTO test VALUES (42, 'Hello'), (43, NULL), (44, 'World'), (45, 'Hello')", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	if (test_strview(conn) != 0 || test_arrow(conn) != 0 || test_append_columns(conn) != 0 ||
+		test_append_plan_cache(conn) != 0 || test_prepared(conn) != 0 ||
+		test_async(conn) != 0 || test_timeout(conn) != 0 || test_cancel(conn) != 0 || test_fetch_range(conn) != 0 ||
+		test_fetch_epoch(conn) != 0 || test_select_scan(conn) != 0 || test_select_parallel(conn) != 0 ||
+		test_hash_parallel(conn) != 0 || test_group_parallel(conn) != 0 ||
+		test_zonemap(conn) != 0 || test_radixjoin(conn) != 0 ||
+		test_joinfilter(conn) != 0 || test_joinfilter_mitosis(conn) != 0 || test_orderidx_append(conn) != 0 ||
+		test_fsum_mitosis(conn) != 0 || test_quantile(conn) != 0 || test_countdistinct(conn) != 0 ||
+		test_countdistinct_groups() != 0 ||
+		test_dictencode(conn) != 0 ||
+		test_radixsort(conn) != 0 || test_psort_stable() != 0 ||
+		test_project() != 0)
+		return -1;
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	if (test_dictencode_restart() != 0)
+		return -1;
+	fprintf(stdout, "OK\n");
+	return 0;
+}